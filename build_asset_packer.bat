@@ -24,7 +24,7 @@ IF NOT "%1" == "" (
 )
 
 REM DEFINE COMPILER OPTIONS.
-SET COMMON_COMPILER_OPTIONS=/EHsc /WX /W4 /TP /std:c++17 /Fo:asset_packer /DSFML_STATIC
+SET COMMON_COMPILER_OPTIONS=/EHsc /WX /W4 /TP /std:c++latest /Fo:asset_packer /DSFML_STATIC
 SET DEBUG_COMPILER_OPTIONS=%COMMON_COMPILER_OPTIONS% /Z7 /Od /MTd
 SET RELEASE_COMPILER_OPTIONS=%COMMON_COMPILER_OPTIONS% /O2 /MT
 
@@ -22,7 +22,7 @@ IF NOT "%1" == "" (
 )
 
 REM DEFINE COMPILER OPTIONS.
-SET COMMON_COMPILER_OPTIONS=/EHsc /WX /W4 /TP /std:c++17 /Fo:font_metric_builder /DSFML_STATIC
+SET COMMON_COMPILER_OPTIONS=/EHsc /WX /W4 /TP /std:c++latest /Fo:font_metric_builder /DSFML_STATIC
 SET DEBUG_COMPILER_OPTIONS=%COMMON_COMPILER_OPTIONS% /Z7 /Od /MTd
 SET RELEASE_COMPILER_OPTIONS=%COMMON_COMPILER_OPTIONS% /O2 /MT
 
@@ -63,8 +63,9 @@ PUSHD "%build_directory%"
 
 POPD
 
-REM BUILD ACTUAL FONT METRICS.
-%build_directory%\font_metric_builder.exe > code\library\Graphics\Gui\Glyph.cpp
+REM BUILD ACTUAL FONT METRICS AND THE PACKED FONT TEXTURE.
+REM The builder writes out its generated files directly and must be run from the root directory.
+%build_directory%\font_metric_builder.exe
 
 ECHO Done (font metric builder)
 
@@ -0,0 +1,10 @@
+# CREATE THE BUILD DIRECTORY IF IT DOESN'T EXIST.
+mkdir -p build
+
+# BUILD THE FONT METRIC BUILDER.
+COMPILATION_FILE="code/font_metric_builder/main.cpp"
+$CXX $COMPILATION_FILE -std=c++2a -o "build/font_metric_builder" -lsfml-graphics -lsfml-system
+
+# BUILD ACTUAL FONT METRICS AND THE PACKED FONT TEXTURE.
+# The builder writes out its generated files directly and must be run from the root directory.
+./build/font_metric_builder
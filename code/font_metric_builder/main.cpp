@@ -1,36 +1,42 @@
 #include <algorithm>
+#include <cstddef>
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
 #include <SFML/Graphics.hpp>
 
-/// A basic utility to generate code for font metrics for the Noah's ark game.
-/// This is automated to help simplify font-rendering.
-/// @return 0 for success; non-zero for failure.
-int main()
+/// A bitmap font to generate metrics for.
+struct BitmapFont
 {
-    // OPEN UP THE FONT IMAGE FILE.
-    // The serif one is used for now since it is assumed to have some slightly
-    // wider characters, but the differences aren't important enough yet to be
-    // worth calculating different metrics for the sans-serif font as well.
-    const std::string FONT_IMAGE_FILEPATH = "assets/res/images/main_font_serif.png";
-    sf::Image font_image;
-    bool font_image_loaded = font_image.loadFromFile(FONT_IMAGE_FILEPATH);
-    if (!font_image_loaded)
-    {
-        std::cerr << "Failed to load font image." << std::endl;
-        return EXIT_FAILURE;
-    }
+    /// The filepath of the font's image.
+    std::string ImageFilepath = "";
+    /// The name of the C++ variable to hold the font's glyph metrics.
+    std::string GlyphMetricsVariableName = "";
+    /// A description of the font for documenting the generated code.
+    std::string Description = "";
+};
 
+/// Generates glyph metrics code for a single font, packing its glyphs into the provided texture image.
+/// @param[in]  font - The font to generate metrics for.
+/// @param[in]  font_image - The image of the font's glyphs.
+/// @param[in]  packed_texture_top_position - The top position at which the font's
+///     image is placed within the packed texture.
+/// @param[in,out]  packed_texture_image - The packed texture image containing all fonts.
+/// @param[in,out]  glyph_metrics_code - The stream to write the generated code to.
+void GenerateFontMetrics(
+    const BitmapFont& font,
+    const sf::Image& font_image,
+    const unsigned int packed_texture_top_position,
+    sf::Image& packed_texture_image,
+    std::ostream& glyph_metrics_code)
+{
     // WRITE OUT THE INITIAL C++ CODE FOR THE GLYPH DATA.
-    // It can be redirected to file to have it output to an actual file.
-    std::cout
-        << "#include \"Graphics/Gui/Glyph.h\"" << std::endl
-        << std::endl
-        << "namespace GRAPHICS" << std::endl
-        << "{" << std::endl
-        << "namespace GUI" << std::endl
-        << "{" << std::endl
-        << "    const std::array<MATH::FloatRectangle, Glyph::TOTAL_COUNT> Glyph::TEXTURE_SUB_RECTANGLES = " << std::endl
+    glyph_metrics_code
+        << "    /// " << font.Description << std::endl
+        << "    inline constexpr FontGlyphMetrics " << font.GlyphMetricsVariableName << " =" << std::endl
         << "    {" << std::endl;
 
     // CALCULATE FONT METRICS FOR EACH CHARACTER.
@@ -82,6 +88,11 @@ int main()
                     // UPDATE THE MIN/MAX BOUNDARIES OF THE GLYPH.
                     glyph_min_x = std::min(glyph_min_x, current_glyph_x);
                     glyph_max_x = std::max(glyph_max_x, current_glyph_x);
+
+                    // COPY THE PIXEL TO THE PACKED TEXTURE.
+                    // Only glyph data is copied, leaving the background fully transparent
+                    // so that no color masking is needed when the texture is loaded.
+                    packed_texture_image.setPixel(current_glyph_x, packed_texture_top_position + current_glyph_y, current_pixel_color);
                 }
             }
         }
@@ -96,21 +107,108 @@ int main()
         unsigned int glyph_width_in_pixels = glyph_max_x - glyph_min_x + SINGLE_PIXEL_RELATED_TO_DOUBLE_COUNTING;
 
         // OUTPUT THE C++ CODE FOR THE GLYPH.
-        std::cout
-            << "        MATH::FloatRectangle::FromLeftTopAndDimensions(" << std::endl
-            << "            " << glyph_min_x << ".0f," << std::endl
-            << "            " << glyph_box_top_position << ".0f," << std::endl
-            << "            " << glyph_width_in_pixels << ".0f," << std::endl
-            << "            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS))," << std::endl;
+        glyph_metrics_code
+            << "        GlyphMetrics { "
+            << ".LeftInPixels = " << glyph_min_x << ", "
+            << ".TopInPixels = " << (packed_texture_top_position + glyph_box_top_position) << ", "
+            << ".WidthInPixels = " << glyph_width_in_pixels << ", "
+            << ".HeightInPixels = " << GLYPH_MAX_HEIGHT_IN_PIXELS << " },"
+            << std::endl;
     }
 
     // WRITE OUT THE FINAL GLYPH DATA FOR THE C++ CODE.
-    std::cout
-        << "    };" << std::endl
-        << "}" << std::endl
-        << "}" << std::endl;
+    glyph_metrics_code << "    };" << std::endl;
+}
+
+/// A basic utility to generate font metrics and textures for the Noah's ark game.
+/// This is automated to help simplify font-rendering and avoid any font setup
+/// at runtime.  The following are generated:
+/// - A C++ header with constexpr glyph metrics for each font.
+/// - A single texture with glyphs for all fonts packed together.
+///
+/// This should be run from the root directory of the repository.
+/// @return 0 for success; non-zero for failure.
+int main()
+{
+    // DEFINE THE FONTS TO GENERATE METRICS FOR.
+    // Fonts are packed in order from top-to-bottom in the texture.
+    const std::vector<BitmapFont> FONTS =
+    {
+        BitmapFont
+        {
+            .ImageFilepath = "assets/res/images/main_font1.png",
+            .GlyphMetricsVariableName = "MAIN_FONT_GLYPH_METRICS",
+            .Description = "Glyph metrics for the main font texture, positioned within the packed font texture."
+        },
+        BitmapFont
+        {
+            .ImageFilepath = "assets/res/images/main_font_serif.png",
+            .GlyphMetricsVariableName = "SERIF_FONT_GLYPH_METRICS",
+            .Description = "Glyph metrics for the serif font texture, positioned within the packed font texture."
+        },
+    };
+    const std::string GLYPH_METRICS_CODE_FILEPATH = "code/library/Graphics/Gui/FontMetrics.h";
+    const std::string PACKED_FONT_TEXTURE_FILEPATH = "assets/res/images/packed_fonts.png";
+
+    // CREATE THE PACKED TEXTURE TO HOLD ALL FONTS.
+    // Each font is a 256x256 image, so fonts are stacked vertically.
+    constexpr unsigned int FONT_IMAGE_DIMENSION_IN_PIXELS = 256;
+    const unsigned int packed_texture_height_in_pixels = static_cast<unsigned int>(FONTS.size()) * FONT_IMAGE_DIMENSION_IN_PIXELS;
+    sf::Image packed_texture_image;
+    packed_texture_image.create(FONT_IMAGE_DIMENSION_IN_PIXELS, packed_texture_height_in_pixels, sf::Color::Transparent);
+
+    // WRITE OUT THE INITIAL C++ CODE FOR THE GLYPH METRICS.
+    std::ofstream glyph_metrics_code(GLYPH_METRICS_CODE_FILEPATH);
+    if (!glyph_metrics_code)
+    {
+        std::cerr << "Failed to open glyph metrics code file." << std::endl;
+        return EXIT_FAILURE;
+    }
+    glyph_metrics_code
+        << "#pragma once" << std::endl
+        << std::endl
+        << "// This file is generated by the font_metric_builder and should not be edited directly." << std::endl
+        << std::endl
+        << "#include \"Graphics/Gui/GlyphMetrics.h\"" << std::endl
+        << std::endl
+        << "namespace GRAPHICS::GUI" << std::endl
+        << "{" << std::endl;
+
+    // GENERATE METRICS FOR EACH FONT.
+    for (std::size_t font_index = 0; font_index < FONTS.size(); ++font_index)
+    {
+        // OPEN UP THE FONT IMAGE FILE.
+        const BitmapFont& font = FONTS[font_index];
+        sf::Image font_image;
+        bool font_image_loaded = font_image.loadFromFile(font.ImageFilepath);
+        if (!font_image_loaded)
+        {
+            std::cerr << "Failed to load font image: " << font.ImageFilepath << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        // GENERATE THE FONT'S METRICS.
+        bool first_font = (0 == font_index);
+        if (!first_font)
+        {
+            glyph_metrics_code << std::endl;
+        }
+        unsigned int packed_texture_top_position = static_cast<unsigned int>(font_index) * FONT_IMAGE_DIMENSION_IN_PIXELS;
+        GenerateFontMetrics(font, font_image, packed_texture_top_position, packed_texture_image, glyph_metrics_code);
+    }
+
+    // WRITE OUT THE FINAL C++ CODE FOR THE GLYPH METRICS.
+    glyph_metrics_code << "}" << std::endl;
+
+    // SAVE THE PACKED FONT TEXTURE.
+    bool packed_texture_saved = packed_texture_image.saveToFile(PACKED_FONT_TEXTURE_FILEPATH);
+    if (!packed_texture_saved)
+    {
+        std::cerr << "Failed to save packed font texture." << std::endl;
+        return EXIT_FAILURE;
+    }
 
     // INDICATE THAT ALL THE FONT METRICS WERE SUCCESSFULLY CALCULATED.
+    std::cout << "Font metrics generated successfully." << std::endl;
     return EXIT_SUCCESS;
 }
-
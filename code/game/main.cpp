@@ -1,20 +1,38 @@
 // To avoid annoyances with Windows min/max #defines.
 #define NOMINMAX
+// Allocation tracking is opt-in since it slows down every allocation.
+// Tracking call sites is much slower still but helps find what is allocating.
+#define TRACK_ALLOCATIONS 0
+#define TRACK_ALLOCATION_CALL_SITES 0
 
 #include <cassert>
 #include <chrono>
+#include <cstddef>
 #include <exception>
 #include <future>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string>
+#include <utility>
 #include <Windows.h>
 #include <SFML/Graphics.hpp>
 #include "Debugging/DebugConsole.h"
+#include "Graphics/Gui/Font.h"
+#include "Graphics/Gui/FontMetrics.h"
 #include "Graphics/Renderer.h"
 #include "Graphics/Screen.h"
 #include "Hardware/GamingHardware.h"
 #include "Input/InputController.h"
+#include "Maps/Data/WorldMapData.h"
+#include "Maps/TileMapFile.h"
+#include "Maps/TileMapStreaming.h"
+#include "Maps/World.h"
+#include "Memory/AllocationTracker.h"
+#if TRACK_ALLOCATIONS
+#include "Memory/GlobalAllocationHooks.h"
+#endif
+#include "Memory/FrameArena.h"
 #include "Resources/AnimalSounds.h"
 #include "Resources/AssetPackage.h"
 #include "Resources/FoodGraphics.h"
@@ -39,57 +57,22 @@ void LoadRemainingAssets(HARDWARE::GamingHardware& gaming_hardware)
                 break;
             case RESOURCES::AssetType::SOUND_EFFECT:
                 gaming_hardware.Speakers->LoadSound(asset.Id, asset.BinaryData);
+                gaming_hardware.Speakers->SetSoundProperties(asset.Id, asset.SoundProperties);
                 break;
             case RESOURCES::AssetType::MUSIC:
-            {
-                gaming_hardware.Speakers->LoadMusic(asset.Id, asset.BinaryData);
-
-                // Adjustments to certain music items are done in code for simplicity to avoid complicating the asset file format.
-                auto overworld_music = gaming_hardware.Speakers->GetMusic(RESOURCES::AssetId::OVERWORLD_BACKGROUND_MUSIC);
-                if (overworld_music)
-                {
-                    // The pitch is lowered to give the background music a more somber, ambient tone.
-                    // It might be possible to make it go lower to achieve more of an ambient effect,
-                    // at the expense of sounding more "scary".
-                    overworld_music->Sfml.setPitch(0.5f);
-                    overworld_music->Sfml.setLoop(true);
-                }
-
-                auto flood_start_background_music = gaming_hardware.Speakers->GetMusic(RESOURCES::AssetId::BASIC_RAIN_BACKGROUND_SOUNDS);
-                if (flood_start_background_music)
-                {
-                    // Slower pitch to better match the duration of the cutscene.
-                    flood_start_background_music->Sfml.setPitch(0.4f);
-                }
-
-                auto flood_rain_background_music = gaming_hardware.Speakers->GetMusic(RESOURCES::AssetId::THUNDERSTORM_BACKGROUND_SOUNDS);
-                if (flood_rain_background_music)
-                {
-                    // Lowered volume for greater subtleness.
-                    flood_rain_background_music->Sfml.setVolume(60.0f);
-                    flood_rain_background_music->Sfml.setLoop(true);
-                }
-
-                auto after_flood_background_music = gaming_hardware.Speakers->GetMusic(RESOURCES::AssetId::AFTER_RAIN_BACKGROUND_SOUNDS);
-                if (after_flood_background_music)
-                {
-                    // Lowered volume for greater subtleness.
-                    after_flood_background_music->Sfml.setVolume(40.0f);
-                    after_flood_background_music->Sfml.setLoop(true);
-                }
-
-                auto final_credits_music = gaming_hardware.Speakers->GetMusic(RESOURCES::AssetId::FINAL_CREDITS_MUSIC);
-                if (final_credits_music)
-                {
-                    final_credits_music->Sfml.setLoop(true);
-                }
-
+                // Music is only streamed from the asset package while playing, so just where it is located is needed here.
+                // Adjustments to how music is played (like pitch or volume) come from the asset package.
+                gaming_hardware.Speakers->LoadMusic(asset.Id, asset.DataLocation, asset.MusicProperties);
                 break;
-            }
             case RESOURCES::AssetType::SHADER:
                 // All shaders are currently fragment shaders.
                 gaming_hardware.GraphicsDevice->LoadShader(asset.Id, sf::Shader::Fragment, asset.BinaryData);
                 break;
+            case RESOURCES::AssetType::WORLD_SNAPSHOT:
+                [[fallthrough]];
+            case RESOURCES::AssetType::MAP_DATA:
+                // Map data and world snapshots are only used when the world is created.
+                break;
             case RESOURCES::AssetType::INVALID:
                 [[fallthrough]];
             default:
@@ -103,6 +86,7 @@ void LoadRemainingAssets(HARDWARE::GamingHardware& gaming_hardware)
     DEBUGGING::DebugConsole::WriteLine("Remaining asset raw load time: ", load_time_diff.count());
     DEBUGGING::DebugConsole::WriteLine("Remaining asset load time (ms): ", std::chrono::duration_cast<std::chrono::milliseconds>(load_time_diff).count());
     DEBUGGING::DebugConsole::WriteLine("Remaining asset load time (s): ", std::chrono::duration_cast<std::chrono::seconds>(load_time_diff).count());
+    DEBUGGING::DebugConsole::WriteLine("Resident audio memory (bytes): ", gaming_hardware.Speakers->ResidentAudioMemoryInBytes());
 }
 
 #if _DEBUG
@@ -149,7 +133,7 @@ int CALLBACK WinMain(
         HARDWARE::GamingHardware gaming_hardware;
 
         const auto& intro_music_asset = intro_assets[RESOURCES::AssetId::INTRO_MUSIC];
-        gaming_hardware.Speakers->LoadMusic(intro_music_asset.Id, intro_music_asset.BinaryData);
+        gaming_hardware.Speakers->LoadMusic(intro_music_asset.Id, intro_music_asset.DataLocation, intro_music_asset.MusicProperties);
 
         const auto& colored_texture_shader = intro_assets[RESOURCES::AssetId::COLORED_TEXTURE_SHADER];
         gaming_hardware.GraphicsDevice->LoadShader(RESOURCES::AssetId::COLORED_TEXTURE_SHADER, sf::Shader::Fragment, colored_texture_shader.BinaryData);
@@ -168,34 +152,73 @@ int CALLBACK WinMain(
             renderer.Screen->RenderTarget.getView().getSize().x,
             renderer.Screen->RenderTarget.getView().getSize().y));
 
-        std::shared_ptr<GRAPHICS::GUI::Font> default_sans_serif_font = GRAPHICS::GUI::Font::LoadSystemDefaultFont(SYSTEM_FIXED_FONT);
-        if (!default_sans_serif_font)
-        {
-            std::cerr << "Failed to load default sans-serif font." << std::endl;
-            return EXIT_FAILURE;
-        }
-        renderer.Fonts[RESOURCES::AssetId::FONT_TEXTURE] = default_sans_serif_font;
-
-        std::shared_ptr<GRAPHICS::GUI::Font> default_serif_font = GRAPHICS::GUI::Font::LoadSystemDefaultFont(ANSI_FIXED_FONT);
-        if (!default_serif_font)
-        {
-            std::cerr << "Failed to load default serif font." << std::endl;
-            return EXIT_FAILURE;
-        }
-        renderer.Fonts[RESOURCES::AssetId::SERIF_FONT_TEXTURE] = default_serif_font;
+        // INITIALIZE THE FONTS.
+        // Glyph metrics are generated ahead of time, so fonts only need their packed texture.
+        const auto& packed_font_texture_asset = intro_assets[RESOURCES::AssetId::PACKED_FONT_TEXTURE];
+        gaming_hardware.GraphicsDevice->LoadTexture(RESOURCES::AssetId::PACKED_FONT_TEXTURE, packed_font_texture_asset.BinaryData);
+        std::shared_ptr<GRAPHICS::Texture> packed_font_texture = gaming_hardware.GraphicsDevice->GetTexture(RESOURCES::AssetId::PACKED_FONT_TEXTURE).get();
+        renderer.Fonts[RESOURCES::AssetId::FONT_TEXTURE] = GRAPHICS::GUI::Font::Create(
+            GRAPHICS::GUI::MAIN_FONT_GLYPH_METRICS,
+            packed_font_texture);
+        renderer.Fonts[RESOURCES::AssetId::SERIF_FONT_TEXTURE] = GRAPHICS::GUI::Font::Create(
+            GRAPHICS::GUI::SERIF_FONT_GLYPH_METRICS,
+            packed_font_texture);
 
         // INITIALIZE THE INTRO SEQUENCE.
         STATES::GameStates game_states;
         game_states.IntroSequence.Load(*gaming_hardware.Speakers);
 
+        // READ THE RAW MAP DATA.
+        std::optional<MAPS::DATA::WorldMapData> map_data = MAPS::TileMapFile::Read(intro_assets[RESOURCES::AssetId::WORLD_MAP_DATA].BinaryData);
+        if (!map_data)
+        {
+            DEBUGGING::DebugConsole::WriteErrorLine("Invalid map data.");
+            return EXIT_FAILURE;
+        }
+
         // CREATE THE WORLD.
-        MAPS::World world;
+        // It's restored from a prebuilt snapshot if possible since that's faster than building it from the raw map data.
+        MAPS::World world(std::move(*map_data), std::move(intro_assets[RESOURCES::AssetId::INITIAL_WORLD_SNAPSHOT].BinaryData));
         game_states.CurrentSavedGame.Player = world.NoahPlayer;
 
+        // STREAM TILE MAPS IN THE OVERWORLD.
+        // Only tile maps around the camera are kept in memory, so memory use doesn't grow with the size of the overworld.
+        // Any waits for tile maps to load are reported to help with tuning streaming.
+        world.Overworld.EnableStreaming(world.MapData.Overworld, MAPS::TileMapStreamingSettings());
+        world.Overworld.MapGrid.OnLoadStall = [](const unsigned int row, const unsigned int column, const std::chrono::microseconds stall_time)
+        {
+            std::string tile_map_text = "Waited on tile map (" + std::to_string(column) + ", " + std::to_string(row) + ") to load for microseconds: ";
+            DEBUGGING::DebugConsole::WriteLine(tile_map_text, stall_time.count());
+        };
+
+#if TRACK_ALLOCATIONS
+        // START TRACKING ALLOCATIONS FROM THE FIRST FRAME.
+        // Allocations from loading aren't counted against the first frame's budget.
+        // Frames exceeding this budget are reported, which is helpful for finding frames that allocate unexpectedly.
+        constexpr std::size_t FRAME_ALLOCATION_BUDGET = 100;
+        MEMORY::AllocationTracker::EndFrame();
+#if TRACK_ALLOCATION_CALL_SITES
+        MEMORY::AllocationTracker::EnableCallSiteTracking(true);
+#endif
+#endif
+
         // RUN THE GAME LOOP AS LONG AS THE WINDOW IS OPEN.
         DEBUGGING::DebugConsole::WriteLine("About to start main game loop...");
         while (window.isOpen())
         {
+            // START A NEW FRAME OF TEMPORARY MEMORY.
+            // Nothing allocated from the frame arena during the previous frame is in use anymore.
+            // Frames that needed more temporary memory than the arena has are reported to help with tuning its size.
+            gaming_hardware.FrameArena->BeginFrame();
+            const MEMORY::FrameArenaStatistics& previous_frame_arena_statistics = gaming_hardware.FrameArena->GetPreviousFrameStatistics();
+            bool previous_frame_overflowed_arena = (previous_frame_arena_statistics.OverflowAllocationCount > 0);
+            if (previous_frame_overflowed_arena)
+            {
+                DEBUGGING::DebugConsole::WriteLine(
+                    "Frame arena overflowed (high-water mark in bytes: " + std::to_string(previous_frame_arena_statistics.HighWaterMarkInBytes) +
+                    ", overflow bytes: " + std::to_string(previous_frame_arena_statistics.OverflowAllocatedByteCount) + ")");
+            }
+
             // PROCESS WINDOW EVENTS.
             sf::Event event;
             while (window.pollEvent(event))
@@ -245,12 +268,33 @@ int CALLBACK WinMain(
                 gaming_hardware.Clock.UpdateElapsedTime();
 
                 // UPDATE THE GAME'S CURRENT STATE.
-                STATES::GameState next_game_state = game_states.Update(world, renderer.Camera, gaming_hardware);
+                STATES::GameState next_game_state = STATES::GameState::INTRO_SEQUENCE;
+                {
+                    MEMORY::AllocationScope update_allocation_scope(MEMORY::AllocationTag::UPDATE);
+                    next_game_state = game_states.Update(world, renderer.Camera, gaming_hardware);
+                }
+
+                {
+                    MEMORY::AllocationScope audio_allocation_scope(MEMORY::AllocationTag::AUDIO);
+
+                    // HEAR SOUNDS FROM THE CENTER OF THE CAMERA'S VIEW.
+                    gaming_hardware.Speakers->SetListenerPosition(renderer.Camera.ViewBounds.Center());
+
+                    // PLAY SOUNDS FROM THE WORLD REQUESTED DURING THIS FRAME.
+                    gaming_hardware.SoundScheduler.SubmitFrame(
+                        gaming_hardware.Clock.ElapsedTimeSinceLastFrame,
+                        renderer.Camera.ViewBounds,
+                        *gaming_hardware.Speakers);
+                }
 
-                // RENDER THE CURRENT STATE OF THE GAME TO THE WINDOW.
-                sf::Sprite screen_sprite = game_states.Render(world, renderer, gaming_hardware);
-                window.draw(screen_sprite);
-                window.display();
+                {
+                    MEMORY::AllocationScope render_allocation_scope(MEMORY::AllocationTag::RENDER);
+
+                    // RENDER THE CURRENT STATE OF THE GAME TO THE WINDOW.
+                    sf::Sprite screen_sprite = game_states.Render(world, renderer, gaming_hardware);
+                    window.draw(screen_sprite);
+                    window.display();
+                }
 
 #if _DEBUG
                 // OVERRIDE GAME STATE SWITCHES WITH DEBUG KEY PRESSES.
@@ -329,9 +373,35 @@ int CALLBACK WinMain(
 
                 // SWITCH THE GAME STATE IF NEEDED.
                 game_states.SwitchStatesIfChanged(next_game_state, world, renderer, gaming_hardware);
+
+#if TRACK_ALLOCATIONS
+                // REPORT THE FRAME IF IT ALLOCATED TOO MUCH.
+                MEMORY::FrameAllocationStatistics frame_allocation_statistics = MEMORY::AllocationTracker::EndFrame();
+                bool frame_allocation_budget_exceeded = (frame_allocation_statistics.Total.AllocationCount > FRAME_ALLOCATION_BUDGET);
+                if (frame_allocation_budget_exceeded)
+                {
+                    const auto& counts_by_tag = frame_allocation_statistics.CountsByTag;
+                    DEBUGGING::DebugConsole::WriteLine(
+                        "Frame allocations over budget: " + std::to_string(frame_allocation_statistics.Total.AllocationCount) +
+                        " (update: " + std::to_string(counts_by_tag[static_cast<std::size_t>(MEMORY::AllocationTag::UPDATE)].AllocationCount) +
+                        ", render: " + std::to_string(counts_by_tag[static_cast<std::size_t>(MEMORY::AllocationTag::RENDER)].AllocationCount) +
+                        ", audio: " + std::to_string(counts_by_tag[static_cast<std::size_t>(MEMORY::AllocationTag::AUDIO)].AllocationCount) +
+                        ", GUI: " + std::to_string(counts_by_tag[static_cast<std::size_t>(MEMORY::AllocationTag::GUI)].AllocationCount) +
+                        ", other: " + std::to_string(counts_by_tag[static_cast<std::size_t>(MEMORY::AllocationTag::OTHER)].AllocationCount) + ")");
+                }
+#endif
             }
         }
 
+#if TRACK_ALLOCATIONS && TRACK_ALLOCATION_CALL_SITES
+        // REPORT WHAT ALLOCATED THE MOST WHILE THE GAME WAS RUNNING.
+        constexpr std::size_t REPORTED_CALL_SITE_COUNT = 20;
+        DEBUGGING::DebugConsole::WriteLine(MEMORY::AllocationTracker::GetTopCallSitesReport(REPORTED_CALL_SITE_COUNT));
+#endif
+
+        // REPORT HOW MUCH OF THE FRAME ARENA WAS NEEDED.
+        DEBUGGING::DebugConsole::WriteLine("Frame arena peak high-water mark (bytes): ", gaming_hardware.FrameArena->PeakHighWaterMarkInBytes());
+
         // INDICATE THAT THE GAME EXITED SUCCESSFULLY.
         return EXIT_SUCCESS;
     }
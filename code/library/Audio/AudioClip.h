@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+namespace AUDIO
+{
+    /// A read-only view of decoded audio samples that can be mixed in software.
+    /// The view keeps whatever owns the samples alive, so a clip remains valid
+    /// even if the sound it came from is replaced while the clip is playing.
+    struct AudioClip
+    {
+        /// Keeps the memory for the samples alive as long as the clip exists.
+        std::shared_ptr<const void> SampleOwner = nullptr;
+        /// The 16-bit samples for the audio, interleaved by channel.
+        std::span<const std::int16_t> Samples = {};
+        /// The number of channels of audio (1 for mono, 2 for stereo).
+        unsigned int ChannelCount = 1;
+        /// The number of frames (a sample for each channel) per second of audio.
+        unsigned int SampleRate = 44100;
+    };
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Math/Vector2.h"
+#include "Resources/AssetId.h"
+
+namespace AUDIO
+{
+    /// The different types of commands for changing audio being played.
+    enum class AudioCommandType
+    {
+        /// Starts playing a sound effect.
+        PLAY_SOUND = 0,
+        /// Starts playing a sound effect at a position in the world, with its volume based on distance from the listener.
+        PLAY_SOUND_AT_POSITION,
+        /// Moves the position in the world from which sounds are heard.
+        SET_LISTENER_POSITION,
+        /// Starts playing music.
+        PLAY_MUSIC,
+        /// Starts playing music only if it isn't already playing.
+        PLAY_MUSIC_IF_NOT_ALREADY,
+        /// Stops playing music.
+        STOP_MUSIC,
+        /// Changes the volume of music.
+        SET_MUSIC_VOLUME,
+        /// Stops all sound effects and music.
+        STOP_ALL_AUDIO
+    };
+
+    /// A command for changing audio being played, sent from the game to the audio thread.
+    /// Commands are small, self-contained values so that they can be cheaply copied between threads.
+    struct AudioCommand
+    {
+        /// The type of command.
+        AudioCommandType Type = AudioCommandType::STOP_ALL_AUDIO;
+        /// The ID of the audio affected by the command, if applicable.
+        RESOURCES::AssetId AudioId = RESOURCES::AssetId::INVALID;
+        /// The volume (as a percentage from 0 to 100) for volume commands.
+        float VolumePercent = 100.0f;
+        /// The position in the world for positional commands.
+        MATH::Vector2f WorldPosition = MATH::Vector2f();
+    };
+}
@@ -0,0 +1,321 @@
+#include <algorithm>
+#include <cmath>
+#include "Audio/AudioMixer.h"
+
+// SSE2 is available on all x64 processors, so it's used for mixing whenever the compiler targets it.
+#if defined(_M_X64) || defined(__SSE2__)
+#define MIX_AUDIO_WITH_SSE2 1
+#include <emmintrin.h>
+#else
+#define MIX_AUDIO_WITH_SSE2 0
+#endif
+
+namespace AUDIO
+{
+    /// The amount to scale 16-bit samples by to convert them to floating-point samples from -1 to 1.
+    constexpr float INTEGER_SAMPLE_TO_FLOAT_SCALE = 1.0f / 32768.0f;
+
+    /// Starts playing a clip through a voice, replacing anything already playing in the voice.
+    /// @param[in]  voice_index - The index of the voice in which to play the clip.  Ignored if invalid.
+    /// @param[in]  clip - The clip to play.
+    /// @param[in]  volume_percent - The volume of the clip, from 0 (silent) to 100 (full volume).
+    /// @param[in]  pitch - How fast to play the clip relative to its normal speed.
+    /// @param[in]  looping - True if the clip should start over once it ends; false to only play it once.
+    /// @param[in]  pan - How far to the left (-1) or right (1) to hear the clip, with 0 being centered.
+    void AudioMixer::Play(
+        const std::size_t voice_index,
+        const AudioClip& clip,
+        const float volume_percent,
+        const float pitch,
+        const bool looping,
+        const float pan)
+    {
+        // MAKE SURE THE VOICE EXISTS.
+        bool voice_exists = (voice_index < VOICE_COUNT);
+        if (!voice_exists)
+        {
+            return;
+        }
+
+        // START PLAYING THE CLIP FROM THE BEGINNING.
+        constexpr float MAX_VOLUME_PERCENT = 100.0f;
+        MixerVoice& voice = Voices[voice_index];
+        voice.Clip = clip;
+        voice.PlaybackPositionInFrames = 0.0;
+        voice.Gain = std::clamp(volume_percent, 0.0f, MAX_VOLUME_PERCENT) / MAX_VOLUME_PERCENT;
+        voice.Pitch = std::max(pitch, MIN_PITCH);
+        voice.Pan = std::clamp(pan, -1.0f, 1.0f);
+        voice.Looping = looping;
+        voice.Playing = true;
+    }
+
+    /// Stops playing anything in a voice.
+    /// @param[in]  voice_index - The index of the voice to stop.  Ignored if invalid.
+    void AudioMixer::Stop(const std::size_t voice_index)
+    {
+        bool voice_exists = (voice_index < VOICE_COUNT);
+        if (voice_exists)
+        {
+            Voices[voice_index] = MixerVoice();
+        }
+    }
+
+    /// Stops playing anything in all voices.
+    void AudioMixer::StopAll()
+    {
+        Voices.fill(MixerVoice());
+    }
+
+    /// Checks if a voice is currently playing.
+    /// @param[in]  voice_index - The index of the voice to check.
+    /// @return True if the voice is playing; false otherwise.
+    bool AudioMixer::VoiceIsPlaying(const std::size_t voice_index) const
+    {
+        bool voice_exists = (voice_index < VOICE_COUNT);
+        if (!voice_exists)
+        {
+            return false;
+        }
+
+        return Voices[voice_index].Playing;
+    }
+
+    /// Mixes the next chunk of audio from all playing voices, advancing each voice.
+    /// @param[out] output_samples - The samples to fill with mixed audio, interleaved by channel.
+    ///     Any partial frame at the end is left silent.  Samples are clamped to be from -1 to 1.
+    void AudioMixer::Mix(const std::span<float> output_samples)
+    {
+        auto mix_start_time = std::chrono::steady_clock::now();
+
+        // START WITH SILENCE.
+        std::fill(output_samples.begin(), output_samples.end(), 0.0f);
+
+        // ADD IN EACH PLAYING VOICE.
+        for (MixerVoice& voice : Voices)
+        {
+            if (voice.Playing)
+            {
+                MixedVoiceFrameCount += MixVoice(voice, output_samples);
+            }
+        }
+
+        // PREVENT LOUD VOICES FROM OVERFLOWING THE VALID RANGE OF SAMPLES.
+        ClampSamples(output_samples);
+
+        auto mix_end_time = std::chrono::steady_clock::now();
+        TotalMixTime += std::chrono::duration_cast<std::chrono::nanoseconds>(mix_end_time - mix_start_time);
+    }
+
+    /// Clamps samples to be within the valid range of -1 to 1.
+    /// @param[in,out]  samples - The samples to clamp.
+    void AudioMixer::ClampSamples(const std::span<float> samples)
+    {
+        constexpr float MIN_SAMPLE = -1.0f;
+        constexpr float MAX_SAMPLE = 1.0f;
+        std::size_t sample_index = 0;
+#if MIX_AUDIO_WITH_SSE2
+        constexpr std::size_t SAMPLES_PER_VECTOR = 4;
+        const __m128 MIN_SAMPLE_VECTOR = _mm_set1_ps(MIN_SAMPLE);
+        const __m128 MAX_SAMPLE_VECTOR = _mm_set1_ps(MAX_SAMPLE);
+        for (; sample_index + SAMPLES_PER_VECTOR <= samples.size(); sample_index += SAMPLES_PER_VECTOR)
+        {
+            __m128 sample_vector = _mm_loadu_ps(&samples[sample_index]);
+            sample_vector = _mm_max_ps(_mm_min_ps(sample_vector, MAX_SAMPLE_VECTOR), MIN_SAMPLE_VECTOR);
+            _mm_storeu_ps(&samples[sample_index], sample_vector);
+        }
+#endif
+        for (; sample_index < samples.size(); ++sample_index)
+        {
+            samples[sample_index] = std::clamp(samples[sample_index], MIN_SAMPLE, MAX_SAMPLE);
+        }
+    }
+
+    /// Gets the average time spent mixing each frame of a single voice.
+    /// @return The average mixing time per voice frame, in nanoseconds; 0 if nothing has been mixed.
+    double AudioMixer::AverageMixTimePerVoiceFrameInNanoseconds() const
+    {
+        if (0 == MixedVoiceFrameCount)
+        {
+            return 0.0;
+        }
+
+        double average_mix_time_in_nanoseconds = static_cast<double>(TotalMixTime.count()) / static_cast<double>(MixedVoiceFrameCount);
+        return average_mix_time_in_nanoseconds;
+    }
+
+    /// Mixes the next chunk of audio from a single voice into the output, advancing the voice.
+    /// @param[in,out]  voice - The voice to mix.  Stops playing if its clip ends without looping.
+    /// @param[in,out]  output_samples - The samples to add the voice's audio to, interleaved by channel.
+    /// @return The number of frames mixed from the voice.
+    std::size_t AudioMixer::MixVoice(MixerVoice& voice, const std::span<float> output_samples)
+    {
+        // MAKE SURE THE CLIP HAS AUDIO.
+        const AudioClip& clip = voice.Clip;
+        bool clip_has_channels = (clip.ChannelCount > 0);
+        std::size_t clip_frame_count = clip_has_channels ? (clip.Samples.size() / clip.ChannelCount) : 0;
+        bool clip_has_audio = (clip_frame_count > 0) && (clip.SampleRate > 0);
+        if (!clip_has_audio)
+        {
+            voice.Playing = false;
+            return 0;
+        }
+
+        // MIX SAMPLES DIRECTLY FROM THE CLIP IF IT DOESN'T NEED TO BE RESAMPLED.
+        // This is the common case for sounds recorded in the same format as the output.
+        const std::size_t output_frame_count = output_samples.size() / OUTPUT_CHANNEL_COUNT;
+        const float gain = voice.Gain * INTEGER_SAMPLE_TO_FLOAT_SCALE;
+        const ChannelGains channel_gains =
+        {
+            gain * std::min(1.0f, 1.0f - voice.Pan),
+            gain * std::min(1.0f, 1.0f + voice.Pan)
+        };
+        const double clip_frames_per_output_frame = static_cast<double>(voice.Pitch) * clip.SampleRate / OUTPUT_SAMPLE_RATE;
+        bool resampling_needed = (
+            (1.0 != clip_frames_per_output_frame) ||
+            (OUTPUT_CHANNEL_COUNT != clip.ChannelCount) ||
+            (std::floor(voice.PlaybackPositionInFrames) != voice.PlaybackPositionInFrames));
+        std::size_t mixed_frame_count = 0;
+        if (!resampling_needed)
+        {
+            while (voice.Playing && mixed_frame_count < output_frame_count)
+            {
+                // MIX AS MANY FRAMES AS POSSIBLE BEFORE REACHING THE END OF THE CLIP.
+                std::size_t clip_frame_index = static_cast<std::size_t>(voice.PlaybackPositionInFrames);
+                std::size_t remaining_clip_frame_count = clip_frame_count - clip_frame_index;
+                std::size_t remaining_output_frame_count = output_frame_count - mixed_frame_count;
+                std::size_t frame_count = std::min(remaining_clip_frame_count, remaining_output_frame_count);
+                AccumulateScaledSamples(
+                    &clip.Samples[clip_frame_index * OUTPUT_CHANNEL_COUNT],
+                    &output_samples[mixed_frame_count * OUTPUT_CHANNEL_COUNT],
+                    frame_count * OUTPUT_CHANNEL_COUNT,
+                    channel_gains);
+                mixed_frame_count += frame_count;
+
+                // MOVE TO THE NEXT PART OF THE CLIP.
+                voice.PlaybackPositionInFrames += static_cast<double>(frame_count);
+                bool clip_ended = (voice.PlaybackPositionInFrames >= static_cast<double>(clip_frame_count));
+                if (clip_ended)
+                {
+                    voice.PlaybackPositionInFrames = 0.0;
+                    voice.Playing = voice.Looping;
+                }
+            }
+
+            return mixed_frame_count;
+        }
+
+        // RESAMPLE THE CLIP INTO THE OUTPUT FORMAT.
+        // Each output frame is linearly interpolated between the two nearest frames of the clip.
+        // Mono clips are played equally in both output channels.
+        ResampledSamples.resize(output_samples.size());
+        while (voice.Playing && mixed_frame_count < output_frame_count)
+        {
+            // FIND THE NEAREST FRAMES OF THE CLIP.
+            std::size_t clip_frame_index = static_cast<std::size_t>(voice.PlaybackPositionInFrames);
+            std::size_t next_clip_frame_index = clip_frame_index + 1;
+            bool next_frame_past_end = (next_clip_frame_index >= clip_frame_count);
+            if (next_frame_past_end)
+            {
+                next_clip_frame_index = voice.Looping ? 0 : clip_frame_index;
+            }
+            float interpolation_ratio = static_cast<float>(voice.PlaybackPositionInFrames - static_cast<double>(clip_frame_index));
+
+            // INTERPOLATE EACH CHANNEL.
+            for (unsigned int output_channel_index = 0; output_channel_index < OUTPUT_CHANNEL_COUNT; ++output_channel_index)
+            {
+                unsigned int clip_channel_index = std::min(output_channel_index, clip.ChannelCount - 1);
+                float current_sample = static_cast<float>(clip.Samples[clip_frame_index * clip.ChannelCount + clip_channel_index]);
+                float next_sample = static_cast<float>(clip.Samples[next_clip_frame_index * clip.ChannelCount + clip_channel_index]);
+                float interpolated_sample = current_sample + (next_sample - current_sample) * interpolation_ratio;
+                ResampledSamples[mixed_frame_count * OUTPUT_CHANNEL_COUNT + output_channel_index] = interpolated_sample;
+            }
+            ++mixed_frame_count;
+
+            // MOVE TO THE NEXT PART OF THE CLIP.
+            voice.PlaybackPositionInFrames += clip_frames_per_output_frame;
+            bool clip_ended = (voice.PlaybackPositionInFrames >= static_cast<double>(clip_frame_count));
+            if (clip_ended)
+            {
+                voice.PlaybackPositionInFrames = std::fmod(voice.PlaybackPositionInFrames, static_cast<double>(clip_frame_count));
+                voice.Playing = voice.Looping;
+            }
+        }
+
+        // ADD THE RESAMPLED AUDIO TO THE OUTPUT.
+        AccumulateScaledSamples(ResampledSamples.data(), output_samples.data(), mixed_frame_count * OUTPUT_CHANNEL_COUNT, channel_gains);
+        return mixed_frame_count;
+    }
+
+    /// Adds scaled floating-point samples to other samples.
+    /// @param[in]  source_samples - The samples to scale and add, interleaved by channel.
+    /// @param[in,out]  destination_samples - The samples to add to, interleaved by channel.
+    /// @param[in]  sample_count - The number of samples to add.
+    /// @param[in]  channel_gains - The amount to scale the source samples by for each channel.
+    void AudioMixer::AccumulateScaledSamples(
+        const float* const source_samples,
+        float* const destination_samples,
+        const std::size_t sample_count,
+        const ChannelGains& channel_gains)
+    {
+        std::size_t sample_index = 0;
+#if MIX_AUDIO_WITH_SSE2
+        // Each vector holds whole frames, so the gains for each channel repeat within it.
+        static_assert(2 == OUTPUT_CHANNEL_COUNT, "Gains must repeat within each vector of samples.");
+        constexpr std::size_t SAMPLES_PER_VECTOR = 4;
+        const __m128 gain_vector = _mm_setr_ps(channel_gains[0], channel_gains[1], channel_gains[0], channel_gains[1]);
+        for (; sample_index + SAMPLES_PER_VECTOR <= sample_count; sample_index += SAMPLES_PER_VECTOR)
+        {
+            __m128 source_vector = _mm_loadu_ps(source_samples + sample_index);
+            __m128 destination_vector = _mm_loadu_ps(destination_samples + sample_index);
+            destination_vector = _mm_add_ps(destination_vector, _mm_mul_ps(source_vector, gain_vector));
+            _mm_storeu_ps(destination_samples + sample_index, destination_vector);
+        }
+#endif
+        for (; sample_index < sample_count; ++sample_index)
+        {
+            destination_samples[sample_index] += source_samples[sample_index] * channel_gains[sample_index % OUTPUT_CHANNEL_COUNT];
+        }
+    }
+
+    /// Converts 16-bit samples to floating-point and adds them (scaled) to other samples.
+    /// @param[in]  source_samples - The samples to scale and add, interleaved by channel.
+    /// @param[in,out]  destination_samples - The samples to add to, interleaved by channel.
+    /// @param[in]  sample_count - The number of samples to add.
+    /// @param[in]  channel_gains - The amount to scale the source samples by for each channel.
+    void AudioMixer::AccumulateScaledSamples(
+        const std::int16_t* const source_samples,
+        float* const destination_samples,
+        const std::size_t sample_count,
+        const ChannelGains& channel_gains)
+    {
+        std::size_t sample_index = 0;
+#if MIX_AUDIO_WITH_SSE2
+        constexpr std::size_t SAMPLES_PER_INTEGER_VECTOR = 8;
+        constexpr std::size_t SAMPLES_PER_FLOAT_VECTOR = 4;
+        constexpr int BITS_PER_SAMPLE = 16;
+        const __m128 gain_vector = _mm_setr_ps(channel_gains[0], channel_gains[1], channel_gains[0], channel_gains[1]);
+        for (; sample_index + SAMPLES_PER_INTEGER_VECTOR <= sample_count; sample_index += SAMPLES_PER_INTEGER_VECTOR)
+        {
+            // SIGN-EXTEND THE 16-BIT SAMPLES TO 32 BITS.
+            // Each sample is duplicated into both halves of a 32-bit lane and then shifted down to extend its sign.
+            __m128i integer_samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source_samples + sample_index));
+            __m128i low_samples = _mm_srai_epi32(_mm_unpacklo_epi16(integer_samples, integer_samples), BITS_PER_SAMPLE);
+            __m128i high_samples = _mm_srai_epi32(_mm_unpackhi_epi16(integer_samples, integer_samples), BITS_PER_SAMPLE);
+
+            // ADD THE SCALED SAMPLES TO THE DESTINATION.
+            float* low_destination_samples = destination_samples + sample_index;
+            float* high_destination_samples = low_destination_samples + SAMPLES_PER_FLOAT_VECTOR;
+            __m128 low_destination_vector = _mm_loadu_ps(low_destination_samples);
+            __m128 high_destination_vector = _mm_loadu_ps(high_destination_samples);
+            low_destination_vector = _mm_add_ps(low_destination_vector, _mm_mul_ps(_mm_cvtepi32_ps(low_samples), gain_vector));
+            high_destination_vector = _mm_add_ps(high_destination_vector, _mm_mul_ps(_mm_cvtepi32_ps(high_samples), gain_vector));
+            _mm_storeu_ps(low_destination_samples, low_destination_vector);
+            _mm_storeu_ps(high_destination_samples, high_destination_vector);
+        }
+#endif
+        for (; sample_index < sample_count; ++sample_index)
+        {
+            destination_samples[sample_index] += static_cast<float>(source_samples[sample_index]) * channel_gains[sample_index % OUTPUT_CHANNEL_COUNT];
+        }
+    }
+}
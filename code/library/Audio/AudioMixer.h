@@ -0,0 +1,105 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "Audio/AudioClip.h"
+#include "Audio/SoundVoicePool.h"
+
+namespace AUDIO
+{
+    /// A single voice being mixed by the audio mixer.
+    struct MixerVoice
+    {
+        /// The audio being played through the voice.
+        AudioClip Clip = {};
+        /// The position within the clip of the next frame to mix.
+        /// May be between frames when the clip is being resampled.
+        double PlaybackPositionInFrames = 0.0;
+        /// The amount to scale the clip's samples by (0 for silent, 1 for full volume).
+        float Gain = 1.0f;
+        /// How fast the clip is played relative to its normal speed, which also raises or lowers its pitch.
+        float Pitch = 1.0f;
+        /// How far to the left (-1) or right (1) the clip is heard, with 0 being centered.
+        float Pan = 0.0f;
+        /// True if the clip should start over once it ends; false if it should only play once.
+        bool Looping = false;
+        /// True if the voice is currently playing; false if it's free.
+        bool Playing = false;
+    };
+
+    /// Mixes multiple voices of audio together in software into a single stream of floating-point samples.
+    /// This allows audio to be sent somewhere other than directly to an audio device (like a file)
+    /// and makes the exact audio produced by the game deterministic and testable.
+    ///
+    /// Clips with a different sample rate, channel count, or pitch than the output are resampled
+    /// via linear interpolation.  Panning only ever quiets the channel on the opposite side,
+    /// so centered voices play at full volume in both channels.  The inner mixing loops use SSE2 when available.
+    class AudioMixer
+    {
+    public:
+        // CONSTANTS.
+        /// The number of channels in mixed audio (stereo).
+        static constexpr unsigned int OUTPUT_CHANNEL_COUNT = 2;
+        /// The number of frames per second in mixed audio.
+        static constexpr unsigned int OUTPUT_SAMPLE_RATE = 44100;
+        /// The number of voices that may be mixed at once, matching the voices the speakers allocate sounds to.
+        static constexpr std::size_t VOICE_COUNT = SoundVoicePool::VOICE_COUNT;
+        /// The slowest that a clip may be played, to avoid a voice never advancing.
+        static constexpr float MIN_PITCH = 0.01f;
+
+        // TYPES.
+        /// The amount to scale samples by for each output channel.
+        using ChannelGains = std::array<float, OUTPUT_CHANNEL_COUNT>;
+
+        // PLAYING.
+        void Play(
+            const std::size_t voice_index,
+            const AudioClip& clip,
+            const float volume_percent,
+            const float pitch = 1.0f,
+            const bool looping = false,
+            const float pan = 0.0f);
+        void Stop(const std::size_t voice_index);
+        void StopAll();
+
+        // STATUS QUERYING.
+        bool VoiceIsPlaying(const std::size_t voice_index) const;
+
+        // MIXING.
+        void Mix(const std::span<float> output_samples);
+        static void ClampSamples(const std::span<float> samples);
+
+        // PROFILING.
+        double AverageMixTimePerVoiceFrameInNanoseconds() const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The total number of frames mixed from all voices, for measuring the cost of mixing per voice.
+        std::uint64_t MixedVoiceFrameCount = 0;
+        /// The total time spent mixing.
+        std::chrono::nanoseconds TotalMixTime = std::chrono::nanoseconds::zero();
+
+    private:
+        // MIXING.
+        std::size_t MixVoice(MixerVoice& voice, const std::span<float> output_samples);
+        static void AccumulateScaledSamples(
+            const float* const source_samples,
+            float* const destination_samples,
+            const std::size_t sample_count,
+            const ChannelGains& channel_gains);
+        static void AccumulateScaledSamples(
+            const std::int16_t* const source_samples,
+            float* const destination_samples,
+            const std::size_t sample_count,
+            const ChannelGains& channel_gains);
+
+        // MEMBER VARIABLES.
+        /// The voices being mixed.
+        std::array<MixerVoice, VOICE_COUNT> Voices = {};
+        /// Scratch space for resampled audio, kept around to avoid allocating while mixing.
+        std::vector<float> ResampledSamples = {};
+    };
+}
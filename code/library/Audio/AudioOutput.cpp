@@ -0,0 +1,151 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include "Audio/AudioMixer.h"
+#include "Audio/AudioOutput.h"
+
+namespace AUDIO
+{
+    /// Creates output for playing audio through the computer's audio device.
+    /// @return The OpenAL output.
+    std::unique_ptr<AudioOutput> AudioOutput::OpenAl()
+    {
+        auto output = std::make_unique<AudioOutput>(AudioOutputType::OPEN_AL);
+        output->OpenAlStream = std::make_unique<MixedAudioStream>(AudioMixer::OUTPUT_CHANNEL_COUNT, AudioMixer::OUTPUT_SAMPLE_RATE);
+        return output;
+    }
+
+    /// Creates output that discards all audio.
+    /// @return The null output.
+    std::unique_ptr<AudioOutput> AudioOutput::NullDevice()
+    {
+        auto output = std::make_unique<AudioOutput>(AudioOutputType::NULL_DEVICE);
+        return output;
+    }
+
+    /// Creates output that writes audio to a WAV file.  The file is completed when the output is destroyed.
+    /// @param[in]  filepath - The path of the WAV file to write.  Overwritten if it already exists.
+    /// @return The WAV file output, if the file could be opened; null otherwise.
+    std::unique_ptr<AudioOutput> AudioOutput::WavFile(const std::filesystem::path& filepath)
+    {
+        // OPEN THE FILE.
+        auto output = std::make_unique<AudioOutput>(AudioOutputType::WAV_FILE);
+        output->WavFileStream.open(filepath, std::ios::binary | std::ios::out | std::ios::trunc);
+        bool file_opened = output->WavFileStream.is_open();
+        if (!file_opened)
+        {
+            return nullptr;
+        }
+
+        // RESERVE SPACE FOR THE HEADER.
+        // It's rewritten once all audio has been written since it contains the size of the audio.
+        output->WriteWavFileHeader();
+        return output;
+    }
+
+    /// Creates output of the specified type.  Prefer the more specific static creation methods.
+    /// @param[in]  type - The type of output.
+    AudioOutput::AudioOutput(const AudioOutputType type) :
+    Type(type)
+    {}
+
+    /// Finishes any output, completing any WAV file.
+    AudioOutput::~AudioOutput()
+    {
+        bool wav_file_being_written = WavFileStream.is_open();
+        if (wav_file_being_written)
+        {
+            WavFileStream.seekp(0);
+            WriteWavFileHeader();
+        }
+    }
+
+    /// Writes mixed audio to the output.
+    /// @param[in]  mixed_samples - The mixed samples to write, interleaved by channel.
+    void AudioOutput::Write(const std::span<const float> mixed_samples)
+    {
+        WrittenFrameCount += mixed_samples.size() / AudioMixer::OUTPUT_CHANNEL_COUNT;
+
+        switch (Type)
+        {
+            case AudioOutputType::OPEN_AL:
+            {
+                // QUEUE THE AUDIO FOR THE AUDIO DEVICE.
+                // If the audio device has fallen too far behind, audio that doesn't fit is dropped
+                // (and counted) rather than waiting on the device.
+                ConvertToIntegerSamples(mixed_samples);
+                std::size_t enqueued_sample_count = OpenAlStream->Enqueue(IntegerSamples);
+                std::size_t dropped_sample_count = IntegerSamples.size() - enqueued_sample_count;
+                DroppedFrameCount += dropped_sample_count / AudioMixer::OUTPUT_CHANNEL_COUNT;
+
+                // MAKE SURE THE AUDIO IS BEING PLAYED.
+                // This only needs to happen once audio has been queued to avoid starting with a gap of silence.
+                bool stream_playing = (sf::SoundSource::Playing == OpenAlStream->getStatus());
+                if (!stream_playing)
+                {
+                    OpenAlStream->play();
+                }
+                break;
+            }
+            case AudioOutputType::WAV_FILE:
+            {
+                ConvertToIntegerSamples(mixed_samples);
+                std::streamsize byte_count = static_cast<std::streamsize>(IntegerSamples.size() * sizeof(std::int16_t));
+                WavFileStream.write(reinterpret_cast<const char*>(IntegerSamples.data()), byte_count);
+                break;
+            }
+            case AudioOutputType::NULL_DEVICE:
+            default:
+                // The audio is intentionally discarded.
+                break;
+        }
+    }
+
+    /// Converts mixed floating-point samples to the integer samples used by the output.
+    /// @param[in]  mixed_samples - The mixed samples to convert.  Should be from -1 to 1.
+    void AudioOutput::ConvertToIntegerSamples(const std::span<const float> mixed_samples)
+    {
+        constexpr float MAX_INTEGER_SAMPLE = 32767.0f;
+        IntegerSamples.resize(mixed_samples.size());
+        for (std::size_t sample_index = 0; sample_index < mixed_samples.size(); ++sample_index)
+        {
+            float clamped_sample = std::clamp(mixed_samples[sample_index], -1.0f, 1.0f);
+            IntegerSamples[sample_index] = static_cast<std::int16_t>(std::lround(clamped_sample * MAX_INTEGER_SAMPLE));
+        }
+    }
+
+    /// Writes the header of a WAV file at the current position of the file
+    /// for all frames written so far.  See http://soundfile.sapp.org/doc/WaveFormat/.
+    void AudioOutput::WriteWavFileHeader()
+    {
+        // COMPUTE SIZES FOR THE HEADER.
+        constexpr std::uint16_t CHANNEL_COUNT = AudioMixer::OUTPUT_CHANNEL_COUNT;
+        constexpr std::uint32_t SAMPLE_RATE = AudioMixer::OUTPUT_SAMPLE_RATE;
+        constexpr std::uint16_t BYTES_PER_FRAME = CHANNEL_COUNT * (BITS_PER_OUTPUT_SAMPLE / 8);
+        constexpr std::uint32_t BYTES_PER_SECOND = SAMPLE_RATE * BYTES_PER_FRAME;
+        constexpr std::uint32_t FORMAT_CHUNK_SIZE_IN_BYTES = 16;
+        constexpr std::uint16_t PCM_FORMAT = 1;
+        constexpr std::uint32_t HEADER_SIZE_AFTER_RIFF_SIZE_IN_BYTES = 36;
+        std::uint32_t audio_data_size_in_bytes = static_cast<std::uint32_t>(WrittenFrameCount * BYTES_PER_FRAME);
+        std::uint32_t riff_chunk_size_in_bytes = HEADER_SIZE_AFTER_RIFF_SIZE_IN_BYTES + audio_data_size_in_bytes;
+
+        // WRITE THE RIFF HEADER.
+        WavFileStream.write("RIFF", 4);
+        WavFileStream.write(reinterpret_cast<const char*>(&riff_chunk_size_in_bytes), sizeof(riff_chunk_size_in_bytes));
+        WavFileStream.write("WAVE", 4);
+
+        // WRITE THE FORMAT OF THE AUDIO.
+        WavFileStream.write("fmt ", 4);
+        WavFileStream.write(reinterpret_cast<const char*>(&FORMAT_CHUNK_SIZE_IN_BYTES), sizeof(FORMAT_CHUNK_SIZE_IN_BYTES));
+        WavFileStream.write(reinterpret_cast<const char*>(&PCM_FORMAT), sizeof(PCM_FORMAT));
+        WavFileStream.write(reinterpret_cast<const char*>(&CHANNEL_COUNT), sizeof(CHANNEL_COUNT));
+        WavFileStream.write(reinterpret_cast<const char*>(&SAMPLE_RATE), sizeof(SAMPLE_RATE));
+        WavFileStream.write(reinterpret_cast<const char*>(&BYTES_PER_SECOND), sizeof(BYTES_PER_SECOND));
+        WavFileStream.write(reinterpret_cast<const char*>(&BYTES_PER_FRAME), sizeof(BYTES_PER_FRAME));
+        WavFileStream.write(reinterpret_cast<const char*>(&BITS_PER_OUTPUT_SAMPLE), sizeof(BITS_PER_OUTPUT_SAMPLE));
+
+        // WRITE THE HEADER FOR THE AUDIO DATA.
+        WavFileStream.write("data", 4);
+        WavFileStream.write(reinterpret_cast<const char*>(&audio_data_size_in_bytes), sizeof(audio_data_size_in_bytes));
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <span>
+#include <vector>
+#include "Audio/MixedAudioStream.h"
+
+namespace AUDIO
+{
+    /// The different places that audio mixed in software may be sent.
+    enum class AudioOutputType
+    {
+        /// The computer's audio device, through OpenAL.
+        OPEN_AL = 0,
+        /// Nowhere - audio is discarded.  Useful for running audio code without an audio device.
+        NULL_DEVICE,
+        /// A WAV file, for inspecting exactly what audio was produced.
+        WAV_FILE
+    };
+
+    /// A destination for audio mixed in software.
+    /// All mixed audio must be in the format produced by the audio mixer (stereo, 44.1 kHz).
+    class AudioOutput
+    {
+    public:
+        // CONSTANTS.
+        /// The number of bits in each sample sent to the audio device or written to a file.
+        static constexpr std::uint16_t BITS_PER_OUTPUT_SAMPLE = 16;
+
+        // CONSTRUCTION/DESTRUCTION.
+        static std::unique_ptr<AudioOutput> OpenAl();
+        static std::unique_ptr<AudioOutput> NullDevice();
+        static std::unique_ptr<AudioOutput> WavFile(const std::filesystem::path& filepath);
+        explicit AudioOutput(const AudioOutputType type);
+        ~AudioOutput();
+        AudioOutput(const AudioOutput&) = delete;
+        AudioOutput& operator=(const AudioOutput&) = delete;
+
+        // WRITING.
+        void Write(const std::span<const float> mixed_samples);
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The type of output.
+        AudioOutputType Type = AudioOutputType::NULL_DEVICE;
+        /// The total number of frames written to the output.
+        std::uint64_t WrittenFrameCount = 0;
+        /// The number of written frames that were dropped because the output couldn't keep up.
+        /// Only the audio device may drop frames, if too much audio is waiting to be played.
+        std::uint64_t DroppedFrameCount = 0;
+
+    private:
+        // HELPER METHODS.
+        void ConvertToIntegerSamples(const std::span<const float> mixed_samples);
+        void WriteWavFileHeader();
+
+        // MEMBER VARIABLES.
+        /// The WAV file being written, if writing to a file.
+        std::ofstream WavFileStream = {};
+        /// The stream through which audio is played, if playing through OpenAL.
+        std::unique_ptr<MixedAudioStream> OpenAlStream = nullptr;
+        /// Scratch space for samples converted to the output format, kept around to avoid allocating for each write.
+        std::vector<std::int16_t> IntegerSamples = {};
+    };
+}
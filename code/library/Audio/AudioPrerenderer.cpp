@@ -0,0 +1,82 @@
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <span>
+#include <vector>
+#include <SFML/Audio.hpp>
+#include "Audio/AudioMixer.h"
+#include "Audio/AudioOutput.h"
+#include "Audio/AudioPrerenderer.h"
+#include "Audio/SoundEffect.h"
+
+namespace AUDIO
+{
+    /// Renders an audio file with a different pitch to a WAV file.
+    /// @param[in]  source_filepath - The audio file to render.  Must be one of the formats supported by SFML.
+    /// @param[in]  pitch - How fast to play the audio relative to its normal speed.
+    /// @param[in]  wav_filepath - The WAV file to write.  Overwritten if it exists.
+    /// @return True if the WAV file was successfully rendered; false otherwise.
+    bool AudioPrerenderer::RenderPitchShiftedWavFile(
+        const std::filesystem::path& source_filepath,
+        const float pitch,
+        const std::filesystem::path& wav_filepath)
+    {
+        // DECODE THE SOURCE AUDIO.
+        SoundEffect source_audio;
+        source_audio.AudioSamples = std::make_shared<sf::SoundBuffer>();
+        bool source_audio_loaded = source_audio.AudioSamples->loadFromFile(source_filepath.string());
+        if (!source_audio_loaded)
+        {
+            return false;
+        }
+
+        // RENDER THE AUDIO.
+        return RenderPitchShiftedWavFile(source_audio.Clip(), pitch, wav_filepath);
+    }
+
+    /// Renders a clip of audio with a different pitch to a WAV file.
+    /// The WAV file is in the format produced by the audio mixer (stereo, 44.1 kHz),
+    /// so it plays back at the new pitch without any further resampling.
+    /// @param[in]  clip - The clip to render.
+    /// @param[in]  pitch - How fast to play the clip relative to its normal speed.
+    /// @param[in]  wav_filepath - The WAV file to write.  Overwritten if it exists.
+    /// @return True if the WAV file was successfully rendered; false otherwise.
+    bool AudioPrerenderer::RenderPitchShiftedWavFile(
+        const AudioClip& clip,
+        const float pitch,
+        const std::filesystem::path& wav_filepath)
+    {
+        // OPEN THE WAV FILE.
+        std::unique_ptr<AudioOutput> wav_file_output = AudioOutput::WavFile(wav_filepath);
+        if (!wav_file_output)
+        {
+            return false;
+        }
+
+        // DETERMINE HOW LONG THE RENDERED AUDIO WILL BE.
+        // The exact length is needed since the mixer pads anything past the end of a clip with silence,
+        // which would otherwise leave a gap when looping the rendered audio.
+        float clamped_pitch = std::max(pitch, AudioMixer::MIN_PITCH);
+        std::size_t clip_frame_count = clip.Samples.size() / std::max(clip.ChannelCount, 1u);
+        double output_frames_per_clip_frame = static_cast<double>(AudioMixer::OUTPUT_SAMPLE_RATE) / (static_cast<double>(clamped_pitch) * clip.SampleRate);
+        std::size_t rendered_frame_count = static_cast<std::size_t>(std::ceil(clip_frame_count * output_frames_per_clip_frame));
+
+        // RENDER THE CLIP IN CHUNKS.
+        constexpr std::size_t VOICE_INDEX = 0;
+        constexpr float FULL_VOLUME_PERCENT = 100.0f;
+        AudioMixer mixer;
+        mixer.Play(VOICE_INDEX, clip, FULL_VOLUME_PERCENT, clamped_pitch);
+        std::vector<float> mixed_samples(FRAMES_PER_CHUNK * AudioMixer::OUTPUT_CHANNEL_COUNT);
+        std::size_t remaining_frame_count = rendered_frame_count;
+        while (remaining_frame_count > 0)
+        {
+            std::size_t chunk_frame_count = std::min(remaining_frame_count, FRAMES_PER_CHUNK);
+            std::span<float> chunk_samples(mixed_samples.data(), chunk_frame_count * AudioMixer::OUTPUT_CHANNEL_COUNT);
+            mixer.Mix(chunk_samples);
+            wav_file_output->Write(chunk_samples);
+            remaining_frame_count -= chunk_frame_count;
+        }
+
+        return true;
+    }
+}
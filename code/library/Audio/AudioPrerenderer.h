@@ -0,0 +1,29 @@
+#pragma once
+
+#include <filesystem>
+#include "Audio/AudioClip.h"
+
+namespace AUDIO
+{
+    /// Renders audio ahead of time (like when packing assets) so that expensive effects,
+    /// like changing pitch, don't need to be applied while the game is running.
+    /// Audio is rendered through the same software mixer used for playing sounds, so
+    /// pre-rendered audio sounds the same as if the effects were applied at runtime.
+    class AudioPrerenderer
+    {
+    public:
+        // CONSTANTS.
+        /// The number of frames rendered at once, to avoid holding all rendered audio in memory.
+        static constexpr std::size_t FRAMES_PER_CHUNK = 4096;
+
+        // RENDERING.
+        static bool RenderPitchShiftedWavFile(
+            const std::filesystem::path& source_filepath,
+            const float pitch,
+            const std::filesystem::path& wav_filepath);
+        static bool RenderPitchShiftedWavFile(
+            const AudioClip& clip,
+            const float pitch,
+            const std::filesystem::path& wav_filepath);
+    };
+}
@@ -0,0 +1,56 @@
+#include <algorithm>
+#include "Audio/MixedAudioStream.h"
+
+namespace AUDIO
+{
+    /// Creates a stream for the specified format of audio.  The stream doesn't start playing
+    /// until explicitly played.
+    /// @param[in]  channel_count - The number of channels in the audio.
+    /// @param[in]  sample_rate - The number of frames per second in the audio.
+    MixedAudioStream::MixedAudioStream(const unsigned int channel_count, const unsigned int sample_rate)
+    {
+        initialize(channel_count, sample_rate);
+    }
+
+    /// Stops the stream.  This must be done here (rather than relying on the base class)
+    /// to prevent SFML's streaming thread from reading buffered samples while they're destroyed.
+    MixedAudioStream::~MixedAudioStream()
+    {
+        stop();
+    }
+
+    /// Adds samples to be played.  Must only be called from a single thread.
+    /// Only whole frames are added so that samples for each channel stay in the right order.
+    /// @param[in]  samples - The samples to add, interleaved by channel.  Should only contain whole frames.
+    /// @return The number of samples added, which may be fewer than provided if too many are already buffered.
+    std::size_t MixedAudioStream::Enqueue(const std::span<const std::int16_t> samples)
+    {
+        std::size_t enqueued_sample_count = BufferedSamples.TryPushMany(samples, getChannelCount());
+        return enqueued_sample_count;
+    }
+
+    /// Provides the next chunk of samples to SFML's streaming thread.
+    /// If not enough samples have been mixed yet, the rest of the chunk is filled with silence
+    /// to keep the stream playing.  Only whole frames are taken from the mixed samples, so each
+    /// chunk always starts with the first channel.
+    /// @param[out] data - The chunk of samples to play.
+    /// @return Always true to continue streaming.
+    bool MixedAudioStream::onGetData(Chunk& data)
+    {
+        // FILL THE CHUNK WITH AS MANY MIXED FRAMES AS POSSIBLE.
+        std::size_t sample_count = BufferedSamples.TryPopMany(ChunkSamples, getChannelCount());
+
+        // FILL THE REST OF THE CHUNK WITH SILENCE.
+        constexpr std::int16_t SILENT_SAMPLE = 0;
+        std::fill(ChunkSamples.begin() + static_cast<std::ptrdiff_t>(sample_count), ChunkSamples.end(), SILENT_SAMPLE);
+
+        data.samples = ChunkSamples.data();
+        data.sampleCount = ChunkSamples.size();
+        return true;
+    }
+
+    /// Does nothing since mixed audio can't be seeked.
+    /// @param[in]  time_offset - Ignored.
+    void MixedAudioStream::onSeek(sf::Time)
+    {}
+}
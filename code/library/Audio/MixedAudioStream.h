@@ -0,0 +1,47 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <SFML/Audio.hpp>
+#include "Containers/SingleProducerSingleConsumerQueue.h"
+
+namespace AUDIO
+{
+    /// A stream for playing audio mixed in software through the computer's audio device.
+    /// Mixed samples are pushed into the stream by one thread and pulled out by SFML's
+    /// streaming thread without either thread having to wait on the other.
+    class MixedAudioStream : public sf::SoundStream
+    {
+    public:
+        // CONSTANTS.
+        /// The maximum number of samples that may be waiting to be played.
+        /// Roughly 190 milliseconds of stereo audio, which is plenty to cover
+        /// any delays between audio being mixed.
+        static constexpr std::size_t MAX_BUFFERED_SAMPLE_COUNT = 16384;
+        /// The number of samples handed to the audio device at once.
+        /// Roughly 23 milliseconds of stereo audio.
+        static constexpr std::size_t SAMPLES_PER_CHUNK = 2048;
+
+        // CONSTRUCTION/DESTRUCTION.
+        explicit MixedAudioStream(const unsigned int channel_count, const unsigned int sample_rate);
+        ~MixedAudioStream();
+
+        // BUFFERING.
+        std::size_t Enqueue(const std::span<const std::int16_t> samples);
+
+    protected:
+        // STREAMING.
+        bool onGetData(Chunk& data) override;
+        void onSeek(sf::Time time_offset) override;
+
+    private:
+        // MEMBER VARIABLES.
+        /// Samples that have been mixed but not yet handed to the audio device.
+        CONTAINERS::SingleProducerSingleConsumerQueue<std::int16_t, MAX_BUFFERED_SAMPLE_COUNT> BufferedSamples = {};
+        /// The chunk of samples most recently handed to the audio device.
+        /// Must remain valid until the next chunk is requested.
+        std::array<std::int16_t, SAMPLES_PER_CHUNK> ChunkSamples = {};
+    };
+}
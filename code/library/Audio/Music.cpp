@@ -1,30 +1,122 @@
-#include <cstring>
 #include "Audio/Music.h"
 
 namespace AUDIO
 {
-    /// Attempts to load music from in-memory data.
-    /// @param[in]  binary_data - The binary music data to try loading from.
-    ///     Must be one of the formats supported by SFML
-    ///     (https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1InputSoundFile.php#a4e034a8e9e69ca3c33a3f11180250400).
-    /// @return The music, if successfully loaded; null otherwise.
-    std::unique_ptr<Music> Music::LoadFromMemory(const std::string& binary_data)
+    /// Creates music stored at the specified location.  The music isn't read until played.
+    /// @param[in]  encoded_data_location - Where the encoded music is stored.
+    /// @param[in]  properties - How the music is played.
+    Music::Music(const FILESYSTEM::FileRegion& encoded_data_location, const MusicProperties& properties) :
+    EncodedDataLocation(encoded_data_location),
+    Properties(properties)
+    {}
+
+    /// Starts playing the music from the beginning, opening a stream for it if necessary.
+    void Music::Play()
+    {
+        // MAKE SURE THE MUSIC IS STREAMING.
+        bool streaming = OpenStream();
+        if (!streaming)
+        {
+            return;
+        }
+
+        // PLAY THE MUSIC.
+        Stream->play();
+    }
+
+    /// Stops playing the music, closing its stream to release the memory for it.
+    void Music::Stop()
+    {
+        // The SFML music must be closed before the stream of data it reads from.
+        Stream.reset();
+        EncodedDataStream.reset();
+    }
+
+    /// Changes the volume of the music, including any music already playing.
+    /// @param[in]  volume_percent - The new volume, from 0 (muted) to 100 (full volume).
+    void Music::SetVolume(const float volume_percent)
+    {
+        Properties.VolumePercent = volume_percent;
+        if (Stream)
+        {
+            Stream->setVolume(Properties.VolumePercent);
+        }
+    }
+
+    /// Checks if the music is currently playing.
+    /// @return True if the music is playing; false otherwise.
+    bool Music::IsPlaying() const
+    {
+        if (!Stream)
+        {
+            return false;
+        }
+
+        bool playing = (sf::SoundSource::Playing == Stream->getStatus());
+        return playing;
+    }
+
+    /// Checks if a stream is currently open for the music.
+    /// @return True if the music is streaming; false otherwise.
+    bool Music::IsStreaming() const
+    {
+        return (nullptr != Stream);
+    }
+
+    /// Estimates the memory currently used by the music.
+    /// @return The approximate number of bytes of memory used by the music.
+    std::size_t Music::ResidentMemoryInBytes() const
+    {
+        // ONLY A SMALL AMOUNT OF MEMORY IS NEEDED IF THE MUSIC ISN'T STREAMING.
+        std::size_t resident_memory_in_bytes = sizeof(Music);
+        if (!Stream)
+        {
+            return resident_memory_in_bytes;
+        }
+
+        // ADD IN THE MEMORY FOR STREAMING.
+        // SFML decodes about a second of audio at a time, which is queued up in a few buffers
+        // (https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1SoundStream.php).
+        constexpr std::size_t SFML_STREAMING_BUFFER_COUNT = 3;
+        std::size_t decoded_bytes_per_second = static_cast<std::size_t>(Stream->getSampleRate()) * Stream->getChannelCount() * sizeof(sf::Int16);
+        resident_memory_in_bytes += sizeof(sf::Music) + decoded_bytes_per_second * (1 + SFML_STREAMING_BUFFER_COUNT);
+        resident_memory_in_bytes += sizeof(FILESYSTEM::FileRegionStream);
+        return resident_memory_in_bytes;
+    }
+
+    /// Opens a stream for the music if one isn't already open.
+    /// @return True if the music is streaming; false if a stream couldn't be opened.
+    bool Music::OpenStream()
     {
-        // STORE A COPY OF THE BINARY DATA.
-        auto music = std::make_unique<Music>();
-        std::size_t music_size_in_bytes = binary_data.size();
-        music->AudioData = std::make_unique<uint8_t[]>(music_size_in_bytes);
-        std::memcpy(music->AudioData.get(), binary_data.data(), music_size_in_bytes);
-
-        // TRY LOADING THE MUSIC FROM THE RAW DATA.
-        bool music_loaded = music->Sfml.openFromMemory(music->AudioData.get(), music_size_in_bytes);
-        if (music_loaded)
+        // CHECK IF THE MUSIC IS ALREADY STREAMING.
+        if (Stream)
         {
-            return music;
+            return true;
         }
-        else
+
+        // OPEN THE ENCODED MUSIC DATA.
+        auto encoded_data_stream = std::make_unique<FILESYSTEM::FileRegionStream>();
+        bool encoded_data_opened = encoded_data_stream->Open(EncodedDataLocation);
+        if (!encoded_data_opened)
         {
-            return nullptr;
+            return false;
         }
+
+        // OPEN THE MUSIC FOR DECODING.
+        auto stream = std::make_unique<sf::Music>();
+        bool stream_opened = stream->openFromStream(*encoded_data_stream);
+        if (!stream_opened)
+        {
+            return false;
+        }
+
+        // APPLY PLAYBACK SETTINGS TO THE MUSIC.
+        stream->setPitch(Properties.Pitch);
+        stream->setVolume(Properties.VolumePercent);
+        stream->setLoop(Properties.Looping);
+
+        EncodedDataStream = std::move(encoded_data_stream);
+        Stream = std::move(stream);
+        return true;
     }
 }
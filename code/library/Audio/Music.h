@@ -1,24 +1,51 @@
 #pragma once
 
-#include <cstdint>
+#include <cstddef>
 #include <memory>
-#include <string>
 #include <SFML/Audio.hpp>
+#include "Audio/MusicProperties.h"
+#include "Filesystem/FileRegion.h"
+#include "Filesystem/FileRegionStream.h"
 
 namespace AUDIO
 {
     /// Longer musical compositions.
+    ///
+    /// Music is streamed in small chunks directly from where it is stored (typically an asset package file).
+    /// A stream is only opened while the music is playing, so music that isn't playing
+    /// takes up almost no memory.
     class Music
     {
     public:
         // CONSTRUCTION.
-        static std::unique_ptr<Music> LoadFromMemory(const std::string& binary_data);
+        explicit Music(const FILESYSTEM::FileRegion& encoded_data_location, const MusicProperties& properties = {});
+
+        // PLAYING.
+        void Play();
+        void Stop();
+        void SetVolume(const float volume_percent);
+
+        // STATUS QUERYING.
+        bool IsPlaying() const;
+        bool IsStreaming() const;
+        std::size_t ResidentMemoryInBytes() const;
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
-        /// The underlying music from the SFML library.
-        sf::Music Sfml = {};
-        /// The underlying audio data.  Must remain in-memory due to how SFML works
-        /// (https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Music.php#ae93b21bcf28ff0b5fec458039111386e).
-        std::unique_ptr<uint8_t[]> AudioData = nullptr;
+        /// Where the encoded music is stored.  Must be one of the formats supported by SFML
+        /// (https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1InputSoundFile.php#a4e034a8e9e69ca3c33a3f11180250400).
+        FILESYSTEM::FileRegion EncodedDataLocation = {};
+        /// How the music is played.  Changes (other than to volume) take effect the next time a stream is opened.
+        MusicProperties Properties = {};
+
+    private:
+        // STREAMING.
+        bool OpenStream();
+
+        // MEMBER VARIABLES.
+        /// The stream of encoded music being read, if the music is streaming.
+        std::unique_ptr<FILESYSTEM::FileRegionStream> EncodedDataStream = nullptr;
+        /// The underlying music from the SFML library that decodes the encoded music, if the music is streaming.
+        /// Declared after the encoded data stream so that it is destroyed first.
+        std::unique_ptr<sf::Music> Stream = nullptr;
     };
 }
@@ -0,0 +1,16 @@
+#pragma once
+
+namespace AUDIO
+{
+    /// Properties controlling how music is played.
+    struct MusicProperties
+    {
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// How fast the music is played relative to its normal speed, which also raises or lowers its pitch.
+        float Pitch = 1.0f;
+        /// The volume of the music, from 0 (muted) to 100 (full volume).
+        float VolumePercent = 100.0f;
+        /// True if the music should start over once it ends; false if it should only play once.
+        bool Looping = false;
+    };
+}
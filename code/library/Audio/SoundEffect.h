@@ -3,11 +3,13 @@
 #include <memory>
 #include <string>
 #include <SFML/Audio.hpp>
+#include "Audio/AudioClip.h"
 
 /// Holds code related to audio (sound effects, music) for the game.
 namespace AUDIO
 {
-    /// A short sound effect.
+    /// A short sound effect.  Only holds the audio samples for the sound, which may be shared
+    /// by many instances of the sound playing at once through the speakers' voices.
     class SoundEffect
     {
     public:
@@ -16,19 +18,13 @@ namespace AUDIO
         explicit SoundEffect() = default;
         explicit SoundEffect(const std::shared_ptr<sf::SoundBuffer>& audio_samples);
 
-        // PLAYING.
-        void Play();
-        void Stop();
-
-        // STATUS QUERYING.
-        bool IsPlaying() const;
+        // SOFTWARE MIXING.
+        AudioClip Clip() const;
 
         // MEMBER VARIABLES.
         /// The buffer of audio samples for the sound.
         /// Stored here to ensure that the sound buffer remains in memory
         /// as long as the sound is in memory.
         std::shared_ptr<sf::SoundBuffer> AudioSamples = nullptr;
-        /// The SFML sound for the effect.
-        sf::Sound Sound = sf::Sound();
     };
 }
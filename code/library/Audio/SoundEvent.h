@@ -0,0 +1,16 @@
+#pragma once
+
+#include "Math/Vector2.h"
+#include "Resources/AssetId.h"
+
+namespace AUDIO
+{
+    /// A request to play a sound effect from a position in the world.
+    struct SoundEvent
+    {
+        /// The ID of the sound to play.
+        RESOURCES::AssetId SoundId = RESOURCES::AssetId::INVALID;
+        /// The position in the world from which the sound comes.
+        MATH::Vector2f WorldPosition = MATH::Vector2f();
+    };
+}
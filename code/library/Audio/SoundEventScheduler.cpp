@@ -0,0 +1,121 @@
+#include <algorithm>
+#include "Audio/SoundEventScheduler.h"
+
+namespace AUDIO
+{
+    /// Requests that a sound be played during the current frame.  The sound may
+    /// end up not being played if culled when the frame is submitted.
+    /// @param[in]  sound_id - The ID of the sound to play.
+    /// @param[in]  world_position - The position in the world from which the sound comes.
+    void SoundEventScheduler::Schedule(const RESOURCES::AssetId sound_id, const MATH::Vector2f& world_position)
+    {
+        PendingSounds.push_back(SoundEvent { .SoundId = sound_id, .WorldPosition = world_position });
+    }
+
+    /// Submits sounds requested during the frame to the speakers, culling any that shouldn't be played.
+    /// @param[in]  elapsed_time - The time elapsed since the last frame.
+    /// @param[in]  camera_view_bounds - The area of the world currently in view of the camera.
+    /// @param[in,out]  speakers - The speakers to play sounds through.
+    void SoundEventScheduler::SubmitFrame(const sf::Time& elapsed_time, const MATH::FloatRectangle& camera_view_bounds, Speakers& speakers)
+    {
+        std::span<const SoundEvent> sounds_to_play = TakeFrameSounds(elapsed_time, camera_view_bounds);
+        bool sounds_should_be_played = !sounds_to_play.empty();
+        if (sounds_should_be_played)
+        {
+            speakers.PlaySoundEffects(sounds_to_play);
+        }
+    }
+
+    /// Takes the sounds requested during the frame that should be played, culling the rest.
+    /// All requested sounds are cleared out for the next frame.
+    /// @param[in]  elapsed_time - The time elapsed since the last frame.
+    /// @param[in]  camera_view_bounds - The area of the world currently in view of the camera.
+    /// @return The sounds to play, closest to the camera first.  Only valid until the next frame is taken.
+    std::span<const SoundEvent> SoundEventScheduler::TakeFrameSounds(const sf::Time& elapsed_time, const MATH::FloatRectangle& camera_view_bounds)
+    {
+        CurrentTime += elapsed_time;
+
+        // DETERMINE THE NEIGHBORHOOD OF THE CAMERA.
+        MATH::Vector2f camera_view_center = camera_view_bounds.Center();
+        constexpr float CAMERA_VIEWS_ACROSS_NEIGHBORHOOD = 1.0f + 2.0f * NEIGHBORHOOD_DISTANCE_IN_CAMERA_VIEWS;
+        MATH::FloatRectangle camera_neighborhood = MATH::FloatRectangle::FromCenterAndDimensions(
+            camera_view_center.X,
+            camera_view_center.Y,
+            CAMERA_VIEWS_ACROSS_NEIGHBORHOOD * camera_view_bounds.Width(),
+            CAMERA_VIEWS_ACROSS_NEIGHBORHOOD * camera_view_bounds.Height());
+
+        // KEEP ONLY THE CLOSEST INSTANCE OF EACH SOUND THAT CAN BE PLAYED.
+        auto distance_from_camera = [camera_view_center](const SoundEvent& sound) -> float
+        {
+            return (sound.WorldPosition - camera_view_center).Length();
+        };
+        const sf::Time MIN_TIME_BETWEEN_SAME_SOUND = sf::seconds(MIN_SECONDS_BETWEEN_SAME_SOUND);
+        SubmittedSounds.clear();
+        for (const SoundEvent& sound : PendingSounds)
+        {
+            // CULL SOUNDS OUTSIDE OF THE CAMERA'S NEIGHBORHOOD.
+            bool sound_in_neighborhood = camera_neighborhood.Contains(sound.WorldPosition.X, sound.WorldPosition.Y);
+            if (!sound_in_neighborhood)
+            {
+                continue;
+            }
+
+            // CULL SOUNDS THAT WERE PLAYED TOO RECENTLY.
+            auto last_submitted_time = LastSubmittedTimesBySoundId.find(sound.SoundId);
+            bool sound_previously_submitted = (LastSubmittedTimesBySoundId.end() != last_submitted_time);
+            if (sound_previously_submitted)
+            {
+                sf::Time time_since_last_submitted = CurrentTime - last_submitted_time->second;
+                bool sound_played_too_recently = (time_since_last_submitted < MIN_TIME_BETWEEN_SAME_SOUND);
+                if (sound_played_too_recently)
+                {
+                    continue;
+                }
+            }
+
+            // KEEP THE CLOSEST INSTANCE OF THE SOUND.
+            auto same_sound = std::find_if(
+                SubmittedSounds.begin(),
+                SubmittedSounds.end(),
+                [&sound](const SoundEvent& submitted_sound) { return sound.SoundId == submitted_sound.SoundId; });
+            bool same_sound_already_submitted = (SubmittedSounds.end() != same_sound);
+            if (!same_sound_already_submitted)
+            {
+                SubmittedSounds.push_back(sound);
+            }
+            else if (distance_from_camera(sound) < distance_from_camera(*same_sound))
+            {
+                *same_sound = sound;
+            }
+        }
+        PendingSounds.clear();
+
+        // KEEP ONLY THE CLOSEST SOUNDS.
+        std::stable_sort(
+            SubmittedSounds.begin(),
+            SubmittedSounds.end(),
+            [&distance_from_camera](const SoundEvent& left_sound, const SoundEvent& right_sound)
+            {
+                return distance_from_camera(left_sound) < distance_from_camera(right_sound);
+            });
+        if (SubmittedSounds.size() > MAX_SOUNDS_PER_FRAME)
+        {
+            SubmittedSounds.resize(MAX_SOUNDS_PER_FRAME);
+        }
+
+        // TRACK WHEN THE SOUNDS WERE PLAYED.
+        for (const SoundEvent& sound : SubmittedSounds)
+        {
+            LastSubmittedTimesBySoundId[sound.SoundId] = CurrentTime;
+        }
+
+        return SubmittedSounds;
+    }
+
+    /// Gets the number of sounds requested during the current frame that haven't been submitted yet.
+    /// @return The number of pending sounds.
+    std::size_t SoundEventScheduler::PendingSoundCount() const
+    {
+        return PendingSounds.size();
+    }
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <unordered_map>
+#include <vector>
+#include <SFML/System/Time.hpp>
+#include "Audio/SoundEvent.h"
+#include "Audio/Speakers.h"
+#include "Math/Rectangle.h"
+#include "Resources/AssetId.h"
+
+namespace AUDIO
+{
+    /// Schedules sounds coming from things in the world (like animals) so that many of them
+    /// making sounds at once don't overwhelm the speakers.  Sounds requested during a frame
+    /// are collected and then submitted to the speakers together at the end of the frame, after:
+    /// - Culling sounds from outside the neighborhood of the camera (the tile maps surrounding the one in view).
+    /// - Limiting how often the same sound (like a single species of animal) can be played.
+    /// - Keeping only the closest instance of each sound and the closest few sounds overall.
+    /// The speakers then attenuate and pan each sound based on its position.
+    class SoundEventScheduler
+    {
+    public:
+        // CONSTANTS.
+        /// The shortest time allowed between playing the same sound.  Long enough that
+        /// many animals of the same species don't sound like a single constant noise.
+        static constexpr float MIN_SECONDS_BETWEEN_SAME_SOUND = 1.5f;
+        /// The most sounds submitted during a single frame, which leaves plenty of voices
+        /// in the speakers for sounds resulting from the player's actions.
+        static constexpr std::size_t MAX_SOUNDS_PER_FRAME = 4;
+        /// The number of camera views (which match the size of a tile map) in each direction
+        /// from the camera within which sounds are kept.
+        static constexpr float NEIGHBORHOOD_DISTANCE_IN_CAMERA_VIEWS = 1.0f;
+
+        // SCHEDULING.
+        void Schedule(const RESOURCES::AssetId sound_id, const MATH::Vector2f& world_position);
+        void SubmitFrame(const sf::Time& elapsed_time, const MATH::FloatRectangle& camera_view_bounds, Speakers& speakers);
+        std::span<const SoundEvent> TakeFrameSounds(const sf::Time& elapsed_time, const MATH::FloatRectangle& camera_view_bounds);
+
+        // STATUS QUERYING.
+        std::size_t PendingSoundCount() const;
+
+    private:
+        // MEMBER VARIABLES.
+        /// The total time that has elapsed across all submitted frames.
+        sf::Time CurrentTime = sf::Time::Zero;
+        /// The sounds requested during the current frame.
+        std::vector<SoundEvent> PendingSounds = {};
+        /// The sounds being submitted for the current frame, kept around to avoid allocating each frame.
+        std::vector<SoundEvent> SubmittedSounds = {};
+        /// When each sound was last submitted.
+        std::unordered_map<RESOURCES::AssetId, sf::Time> LastSubmittedTimesBySoundId = {};
+    };
+}
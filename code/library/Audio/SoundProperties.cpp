@@ -0,0 +1,58 @@
+#include <algorithm>
+#include "Audio/SoundProperties.h"
+
+namespace AUDIO
+{
+    /// Computes the volume of the sound based on its distance from the listener.
+    /// The volume fades linearly from full volume to silence between the full volume
+    /// and max audible distances.
+    /// @param[in]  distance_from_listener_in_pixels - The distance of the sound from the listener.
+    /// @return The volume of the sound, from 0 (silent) to 100 (full volume).
+    float SoundProperties::VolumePercentAtDistance(const float distance_from_listener_in_pixels) const
+    {
+        // CHECK IF THE SOUND IS CLOSE ENOUGH TO BE AT FULL VOLUME.
+        constexpr float FULL_VOLUME_PERCENT = 100.0f;
+        bool within_full_volume_distance = (distance_from_listener_in_pixels <= FullVolumeDistanceInPixels);
+        if (within_full_volume_distance)
+        {
+            return FULL_VOLUME_PERCENT;
+        }
+
+        // CHECK IF THE SOUND IS TOO FAR AWAY TO BE HEARD.
+        constexpr float SILENT_VOLUME_PERCENT = 0.0f;
+        bool beyond_audible_distance = (distance_from_listener_in_pixels >= MaxAudibleDistanceInPixels);
+        if (beyond_audible_distance)
+        {
+            return SILENT_VOLUME_PERCENT;
+        }
+
+        // FADE THE VOLUME BASED ON HOW FAR BETWEEN THE DISTANCES THE SOUND IS.
+        float fading_distance_in_pixels = MaxAudibleDistanceInPixels - FullVolumeDistanceInPixels;
+        float distance_into_fade_in_pixels = distance_from_listener_in_pixels - FullVolumeDistanceInPixels;
+        float remaining_volume_ratio = 1.0f - (distance_into_fade_in_pixels / fading_distance_in_pixels);
+        float volume_percent = std::clamp(FULL_VOLUME_PERCENT * remaining_volume_ratio, SILENT_VOLUME_PERCENT, FULL_VOLUME_PERCENT);
+        return volume_percent;
+    }
+
+    /// Computes how far to the left or right the sound should be heard based on where it is relative to the listener.
+    /// Sounds are panned fully to one side once at the max audible distance.
+    /// @param[in]  horizontal_offset_from_listener_in_pixels - How far to the right (positive) or left (negative)
+    ///     of the listener the sound is.
+    /// @return The pan of the sound, from -1 (fully left) to 1 (fully right), with 0 being centered.
+    float SoundProperties::PanAtHorizontalOffset(const float horizontal_offset_from_listener_in_pixels) const
+    {
+        // CENTER SOUNDS IF THEY DON'T HAVE ANY AUDIBLE DISTANCE.
+        constexpr float CENTER_PAN = 0.0f;
+        bool has_audible_distance = (MaxAudibleDistanceInPixels > 0.0f);
+        if (!has_audible_distance)
+        {
+            return CENTER_PAN;
+        }
+
+        // PAN THE SOUND PROPORTIONALLY TO ITS OFFSET.
+        constexpr float FULL_LEFT_PAN = -1.0f;
+        constexpr float FULL_RIGHT_PAN = 1.0f;
+        float pan = std::clamp(horizontal_offset_from_listener_in_pixels / MaxAudibleDistanceInPixels, FULL_LEFT_PAN, FULL_RIGHT_PAN);
+        return pan;
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+namespace AUDIO
+{
+    /// Properties controlling how a sound effect is played when many sounds
+    /// may be competing for a limited number of voices.
+    struct SoundProperties
+    {
+        // CONSTANTS.
+        /// The priority of most sounds, like those made by animals.
+        static constexpr unsigned int DEFAULT_PRIORITY = 1;
+        /// The priority of sounds directly resulting from the player's actions.
+        static constexpr unsigned int PLAYER_ACTION_PRIORITY = 2;
+        /// The default maximum number of instances of a single sound playing at once.
+        static constexpr unsigned int DEFAULT_MAX_INSTANCE_COUNT = 4;
+        /// The default distance from the listener within which sounds play at full volume.
+        /// Half of the screen's width, so that sounds anywhere near the center of view are clear.
+        static constexpr float DEFAULT_FULL_VOLUME_DISTANCE_IN_PIXELS = 256.0f;
+        /// The default distance from the listener beyond which sounds can't be heard.
+        static constexpr float DEFAULT_MAX_AUDIBLE_DISTANCE_IN_PIXELS = 768.0f;
+
+        // VOLUME.
+        float VolumePercentAtDistance(const float distance_from_listener_in_pixels) const;
+        float PanAtHorizontalOffset(const float horizontal_offset_from_listener_in_pixels) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// How important the sound is.  When all voices are in use, a sound may only take over
+        /// a voice playing a sound with the same or a lower priority.
+        unsigned int Priority = DEFAULT_PRIORITY;
+        /// The maximum number of instances of the sound that may be playing at once.
+        /// Additional requests to play the sound are ignored while at this limit.
+        unsigned int MaxInstanceCount = DEFAULT_MAX_INSTANCE_COUNT;
+        /// The distance from the listener within which the sound plays at full volume.
+        float FullVolumeDistanceInPixels = DEFAULT_FULL_VOLUME_DISTANCE_IN_PIXELS;
+        /// The distance from the listener beyond which the sound can't be heard.
+        float MaxAudibleDistanceInPixels = DEFAULT_MAX_AUDIBLE_DISTANCE_IN_PIXELS;
+    };
+}
@@ -0,0 +1,98 @@
+#include "Audio/SoundVoicePool.h"
+
+namespace AUDIO
+{
+    /// Allocates a voice for playing a sound, stealing a voice from another sound if necessary.
+    /// The allocated voice is immediately considered to be playing the sound.
+    /// @param[in]  sound_id - The ID of the sound to play.
+    /// @param[in]  sound_properties - The properties of the sound to play.
+    /// @return The index of the voice in which to play the sound; nothing if the sound shouldn't be played
+    ///     because too many instances of it are already playing or all voices are busy with more important sounds.
+    std::optional<std::size_t> SoundVoicePool::AllocateVoice(const RESOURCES::AssetId sound_id, const SoundProperties& sound_properties)
+    {
+        // DON'T PLAY THE SOUND IF TOO MANY INSTANCES OF IT ARE ALREADY PLAYING.
+        unsigned int playing_instance_count = PlayingInstanceCount(sound_id);
+        bool instance_limit_reached = (playing_instance_count >= sound_properties.MaxInstanceCount);
+        if (instance_limit_reached)
+        {
+            return std::nullopt;
+        }
+
+        // FIND THE BEST VOICE TO USE.
+        // A free voice is always preferred.  Otherwise, the least important voice is used,
+        // with older sounds being stolen before newer ones since more of them has already been heard.
+        std::optional<std::size_t> chosen_voice_index = std::nullopt;
+        for (std::size_t voice_index = 0; voice_index < VOICE_COUNT; ++voice_index)
+        {
+            const SoundVoice& voice = Voices[voice_index];
+            if (!voice.Playing)
+            {
+                chosen_voice_index = voice_index;
+                break;
+            }
+
+            bool voice_can_be_stolen = (voice.Priority <= sound_properties.Priority);
+            if (!voice_can_be_stolen)
+            {
+                continue;
+            }
+
+            if (!chosen_voice_index)
+            {
+                chosen_voice_index = voice_index;
+                continue;
+            }
+
+            const SoundVoice& chosen_voice = Voices[*chosen_voice_index];
+            bool voice_less_important = (voice.Priority < chosen_voice.Priority);
+            bool voice_equally_important_but_older = (
+                (voice.Priority == chosen_voice.Priority) &&
+                (voice.StartOrder < chosen_voice.StartOrder));
+            if (voice_less_important || voice_equally_important_but_older)
+            {
+                chosen_voice_index = voice_index;
+            }
+        }
+
+        // CHECK IF ANY VOICE WAS AVAILABLE.
+        if (!chosen_voice_index)
+        {
+            return std::nullopt;
+        }
+
+        // ASSIGN THE SOUND TO THE VOICE.
+        SoundVoice& chosen_voice = Voices[*chosen_voice_index];
+        chosen_voice.SoundId = sound_id;
+        chosen_voice.Priority = sound_properties.Priority;
+        chosen_voice.StartOrder = NextStartOrder;
+        chosen_voice.Playing = true;
+        ++NextStartOrder;
+        return chosen_voice_index;
+    }
+
+    /// Marks all voices as no longer playing.
+    void SoundVoicePool::StopAll()
+    {
+        for (SoundVoice& voice : Voices)
+        {
+            voice.Playing = false;
+        }
+    }
+
+    /// Counts the number of voices currently playing a sound.
+    /// @param[in]  sound_id - The ID of the sound to check.
+    /// @return The number of instances of the sound currently playing.
+    unsigned int SoundVoicePool::PlayingInstanceCount(const RESOURCES::AssetId sound_id) const
+    {
+        unsigned int playing_instance_count = 0;
+        for (const SoundVoice& voice : Voices)
+        {
+            bool voice_playing_sound = (voice.Playing && (sound_id == voice.SoundId));
+            if (voice_playing_sound)
+            {
+                ++playing_instance_count;
+            }
+        }
+        return playing_instance_count;
+    }
+}
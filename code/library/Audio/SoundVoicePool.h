@@ -0,0 +1,56 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include "Audio/SoundProperties.h"
+#include "Resources/AssetId.h"
+
+namespace AUDIO
+{
+    /// Bookkeeping for a single voice through which a sound effect may be played.
+    struct SoundVoice
+    {
+        /// The ID of the sound last played through the voice.
+        RESOURCES::AssetId SoundId = RESOURCES::AssetId::INVALID;
+        /// The priority of the sound last played through the voice.
+        unsigned int Priority = 0;
+        /// When the sound started playing, relative to other voices (higher is more recent).
+        std::uint64_t StartOrder = 0;
+        /// True if the voice is currently playing a sound; false if it's free.
+        bool Playing = false;
+    };
+
+    /// A fixed number of voices through which sound effects are played, allowing the same
+    /// sound to overlap with itself without creating new underlying sounds during gameplay.
+    /// This only decides which voice each sound should use - the owner of the pool is responsible
+    /// for actually playing sounds and keeping the playing status of each voice up-to-date.
+    ///
+    /// When all voices are in use, the oldest voice with the lowest priority is stolen,
+    /// as long as its priority isn't higher than that of the new sound.
+    class SoundVoicePool
+    {
+    public:
+        // CONSTANTS.
+        /// The number of voices in the pool.  Well under the number of sources typically
+        /// supported by audio devices, while still far more than sounds normally heard at once.
+        static constexpr std::size_t VOICE_COUNT = 32;
+
+        // VOICE ALLOCATION.
+        std::optional<std::size_t> AllocateVoice(const RESOURCES::AssetId sound_id, const SoundProperties& sound_properties);
+        void StopAll();
+
+        // STATUS QUERYING.
+        unsigned int PlayingInstanceCount(const RESOURCES::AssetId sound_id) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The voices in the pool.
+        std::array<SoundVoice, VOICE_COUNT> Voices = {};
+
+    private:
+        // MEMBER VARIABLES.
+        /// The start order to assign to the next allocated voice.
+        std::uint64_t NextStartOrder = 1;
+    };
+}
@@ -1,32 +1,69 @@
+#include <algorithm>
+#include <cmath>
 #include <al.h>
 #include <alc.h>
 #include "Audio/Speakers.h"
+#include "Memory/AllocationTracker.h"
 
 #define CHECK_OPEN_AL_ERRORS_DURING_LOADS 0 // These checks seem to cause audio to be disabled.
 #define CHECK_OPEN_AL_ERRORS_DURING_ADDS 1
-#define CHECK_OPEN_AL_ERRORS_DURING_CHECKS 1
-#define CHECK_OPEN_AL_ERRORS_DURING_PLAYS 1
-#define CHECK_OPEN_AL_ERRORS_DURING_STOPS 1
+#define CHECK_OPEN_AL_ERRORS_DURING_COMMANDS 1
 
 namespace AUDIO
 {
+    /// Initializes the speakers to play sounds directly through the computer's audio device.
+    Speakers::Speakers() :
+    Speakers(nullptr)
+    {}
+
     /// Initializes the speakers.
-    Speakers::Speakers()
+    /// @param[in]  software_mixing_output - The output for sounds mixed in software.
+    ///     If null, sounds are instead played directly through the computer's audio device.
+    Speakers::Speakers(std::unique_ptr<AudioOutput> software_mixing_output) :
+    SoftwareMixingOutput(std::move(software_mixing_output))
     {
         // CHECK IF SPEAKERS ARE ENABLED.
-        // This kind of code isn't exposed directly through SFML,
-        // so we have to replicate checking the device state here.
         // This is done during construction to avoid having to
         // repeat error checking in a bunch of other methods.
-        constexpr ALCchar* DEFAULT_DEVICE = nullptr;
-        ALCdevice* audio_device = alcOpenDevice(DEFAULT_DEVICE);
-        Enabled = (nullptr != audio_device);
+        // Output that doesn't go to an audio device is always usable.
+        OpenAlUsed = !SoftwareMixingOutput || (AudioOutputType::OPEN_AL == SoftwareMixingOutput->Type);
+        Enabled = !OpenAlUsed || AudioDeviceAvailable();
 
-        // CLOSE ANY AUDIO DEVICE THAT WAS OPENED.
-        // SFML will open up its own copy of the default device.
-        if (audio_device)
+        // START THE AUDIO THREAD.
+        // There's nothing for it to do if the speakers are disabled.
+        if (Enabled)
         {
-            alcCloseDevice(audio_device);
+            // All voices are created up-front to avoid creating sounds during gameplay.
+            if (SoftwareMixingOutput)
+            {
+                Mixer = std::make_unique<AudioMixer>();
+            }
+            else
+            {
+                VoiceSounds = std::make_unique<std::array<sf::Sound, SoundVoicePool::VOICE_COUNT>>();
+
+                // Sounds are positioned relative to the listener only to pan them left or right.
+                // Volume is already adjusted based on distance, so OpenAL shouldn't further attenuate them.
+                constexpr float NO_ATTENUATION = 0.0f;
+                for (sf::Sound& voice_sound : *VoiceSounds)
+                {
+                    voice_sound.setRelativeToListener(true);
+                    voice_sound.setAttenuation(NO_ATTENUATION);
+                }
+            }
+
+            AudioThreadRunning = true;
+            AudioThread = std::thread(&Speakers::ProcessCommands, this);
+        }
+    }
+
+    /// Stops the audio thread, waiting for it to finish.
+    Speakers::~Speakers()
+    {
+        AudioThreadRunning = false;
+        if (AudioThread.joinable())
+        {
+            AudioThread.join();
         }
     }
 
@@ -36,9 +73,6 @@ namespace AUDIO
     /// @param[in]  sound_binary_data - The raw binary data for the sound.
     void Speakers::LoadSound(const RESOURCES::AssetId sound_id, const std::string& sound_binary_data)
     {
-        // PROTECT AGAINST THIS CLASS BEING USED BY MULTIPLE THREADS.
-        std::lock_guard<std::recursive_mutex> lock(SpeakerMutex);
-
 #if CHECK_OPEN_AL_ERRORS_DURING_LOADS
         // DOUBLE-CHECK TO MAKE SURE AUDIO IS STILL USABLE.
         // Checking for if any OpenAL errors occur via this error code during initialization doesn't work,
@@ -46,8 +80,11 @@ namespace AUDIO
         // works during initialization on some computers, on others it still return AL_INVALID_OPERATION
         // regardless, which is the same kind of error code that would be returned later if audio isn't
         // usable (so there isn't a way to distinguish between things earlier).
-        ALenum error_code = alGetError();
-        Enabled = Enabled && (error_code == AL_NO_ERROR);
+        if (OpenAlUsed)
+        {
+            ALenum error_code = alGetError();
+            Enabled = Enabled && (error_code == AL_NO_ERROR);
+        }
 #endif
 
         // DON'T DO ANYTHING IF THE SPEAKERS ARE DISABLED.
@@ -58,10 +95,12 @@ namespace AUDIO
         }
 
         // LOAD THE SOUND INTO THE SPEAKERS.
+        // The sound is decoded before locking to avoid blocking the audio thread any longer than necessary.
         std::unique_ptr<AUDIO::SoundEffect> sound = AUDIO::SoundEffect::LoadFromMemory(sound_binary_data);
         if (sound)
         {
-            Sounds[sound_id] = *sound;
+            std::lock_guard<std::mutex> lock(LoadedAudioMutex);
+            Sounds.insert_or_assign(sound_id, std::move(*sound));
         }
     }
 
@@ -71,9 +110,6 @@ namespace AUDIO
     /// @param[in]  audio_samples - The audio samples for the sound.
     void Speakers::AddSound(const RESOURCES::AssetId sound_id, const std::shared_ptr<sf::SoundBuffer>& audio_samples)
     {
-        // PROTECT AGAINST THIS CLASS BEING USED BY MULTIPLE THREADS.
-        std::lock_guard<std::recursive_mutex> lock(SpeakerMutex);
-
 #if CHECK_OPEN_AL_ERRORS_DURING_ADDS
         // DOUBLE-CHECK TO MAKE SURE AUDIO IS STILL USABLE.
         // Checking for if any OpenAL errors occur via this error code during initialization doesn't work,
@@ -81,8 +117,11 @@ namespace AUDIO
         // works during initialization on some computers, on others it still return AL_INVALID_OPERATION
         // regardless, which is the same kind of error code that would be returned later if audio isn't
         // usable (so there isn't a way to distinguish between things earlier).
-        ALenum error_code = alGetError();
-        Enabled = Enabled && (error_code == AL_NO_ERROR);
+        if (OpenAlUsed)
+        {
+            ALenum error_code = alGetError();
+            Enabled = Enabled && (error_code == AL_NO_ERROR);
+        }
 #endif
 
         // DON'T DO ANYTHING IF THE SPEAKERS ARE DISABLED.
@@ -99,29 +138,27 @@ namespace AUDIO
         }
 
         // STORE THE SOUND.
-        AUDIO::SoundEffect sound_effect = AUDIO::SoundEffect(audio_samples);
-        Sounds[sound_id] = sound_effect;
+        std::lock_guard<std::mutex> lock(LoadedAudioMutex);
+        Sounds.insert_or_assign(sound_id, AUDIO::SoundEffect(audio_samples));
     }
 
-    /// Checks if a sound is currently playing in the speakers.
+    /// Changes the properties controlling how a sound is played.
+    /// Sounds without properties set use default properties.
+    /// @param[in]  sound_id - The ID of the sound.
+    /// @param[in]  sound_properties - The new properties for the sound.
+    void Speakers::SetSoundProperties(const RESOURCES::AssetId sound_id, const SoundProperties& sound_properties)
+    {
+        std::lock_guard<std::mutex> lock(LoadedAudioMutex);
+        SoundPropertiesById[sound_id] = sound_properties;
+    }
+
+    /// Checks if a sound is currently playing in the speakers.  The status comes from the most recent
+    /// check by the audio thread, so this never waits on the audio thread.  Sounds that have been requested
+    /// to play but haven't started yet are considered playing.
     /// @param[in]  sound_id - The ID of the sound to check.
     /// @return True if the sound is currently playing; false otherwise.
     bool Speakers::SoundIsPlaying(const RESOURCES::AssetId sound_id)
     {
-        // PROTECT AGAINST THIS CLASS BEING USED BY MULTIPLE THREADS.
-        std::lock_guard<std::recursive_mutex> lock(SpeakerMutex);
-
-#if CHECK_OPEN_AL_ERRORS_DURING_CHECKS
-        // DOUBLE-CHECK TO MAKE SURE AUDIO IS STILL USABLE.
-        // Checking for if any OpenAL errors occur via this error code during initialization doesn't work,
-        // so it must be repeated in effectively every method in this class.  While checking OpenAL error codes,
-        // works during initialization on some computers, on others it still return AL_INVALID_OPERATION
-        // regardless, which is the same kind of error code that would be returned later if audio isn't
-        // usable (so there isn't a way to distinguish between things earlier).
-        ALenum error_code = alGetError();
-        Enabled = Enabled && (error_code == AL_NO_ERROR);
-#endif
-
         // DON'T DO ANYTHING IF THE SPEAKERS ARE DISABLED.
         // It's not worth spending time on anything if the speakers are disabled.
         if (!Enabled)
@@ -129,64 +166,70 @@ namespace AUDIO
             return false;
         }
 
-        // CHECK IF THE SOUND EXISTS.
-        auto sound_effect = Sounds.find(sound_id);
-        bool sound_exists = (Sounds.end() != sound_effect);
-        if (sound_exists)
-        {
-            bool is_playing = sound_effect->second.IsPlaying();
-            return is_playing;
-        }
-        else
+        // MAKE SURE THE SOUND'S STATUS IS TRACKED.
+        std::size_t sound_index = static_cast<std::size_t>(sound_id);
+        bool sound_status_tracked = (sound_index < MAX_AUDIO_ID_COUNT);
+        if (!sound_status_tracked)
         {
             return false;
         }
+
+        // CHECK IF THE SOUND IS PLAYING OR ABOUT TO PLAY.
+        // Pending plays are checked first since the audio thread only clears them after publishing
+        // that the sound is playing, which ensures there isn't a moment where neither is visible.
+        bool sound_play_pending = (PendingSoundPlayCounts[sound_index] > 0);
+        bool sound_playing = SoundPlayingStatuses[sound_index];
+        bool sound_playing_or_pending = (sound_play_pending || sound_playing);
+        return sound_playing_or_pending;
     }
 
-    /// Starts playing the sound with the given ID, assuming it is already stored in the speakers.
+    /// Starts playing the sound with the given ID at full volume, assuming it is already stored in the speakers.
+    /// The sound may not be played if too many instances of it are already playing or if all voices are
+    /// busy with more important sounds.
     /// This method name has "Effect" appended to it to avoid conflicts with Windows API #defines.
     /// @param[in]  sound_id - The ID of the sound to play.
     void Speakers::PlaySoundEffect(const RESOURCES::AssetId sound_id)
     {
-        // PROTECT AGAINST THIS CLASS BEING USED BY MULTIPLE THREADS.
-        std::lock_guard<std::recursive_mutex> lock(SpeakerMutex);
+        SendCommand(AudioCommand { .Type = AudioCommandType::PLAY_SOUND, .AudioId = sound_id });
+    }
 
-#if CHECK_OPEN_AL_ERRORS_DURING_PLAYS
-        // DOUBLE-CHECK TO MAKE SURE AUDIO IS STILL USABLE.
-        // Checking for if any OpenAL errors occur via this error code during initialization doesn't work,
-        // so it must be repeated in effectively every method in this class.  While checking OpenAL error codes,
-        // works during initialization on some computers, on others it still return AL_INVALID_OPERATION
-        // regardless, which is the same kind of error code that would be returned later if audio isn't
-        // usable (so there isn't a way to distinguish between things earlier).
-        ALenum error_code = alGetError();
-        Enabled = Enabled && (error_code == AL_NO_ERROR);
-#endif
+    /// Starts playing the sound with the given ID from a position in the world, assuming it is already
+    /// stored in the speakers.  The sound gets quieter the further it is from the listener and isn't
+    /// played at all if too far away to be heard.
+    /// @param[in]  sound_id - The ID of the sound to play.
+    /// @param[in]  world_position - The position in the world from which the sound comes.
+    void Speakers::PlaySoundEffect(const RESOURCES::AssetId sound_id, const MATH::Vector2f& world_position)
+    {
+        SendCommand(AudioCommand { .Type = AudioCommandType::PLAY_SOUND_AT_POSITION, .AudioId = sound_id, .WorldPosition = world_position });
+    }
 
-        // DON'T DO ANYTHING IF THE SPEAKERS ARE DISABLED.
-        // It's not worth spending time on anything if the speakers are disabled.
-        if (!Enabled)
+    /// Starts playing several sounds from positions in the world at once, assuming they are already stored in the speakers.
+    /// @param[in]  sounds - The sounds to play.
+    void Speakers::PlaySoundEffects(const std::span<const SoundEvent> sounds)
+    {
+        for (const SoundEvent& sound : sounds)
         {
-            return;
+            PlaySoundEffect(sound.SoundId, sound.WorldPosition);
         }
+    }
 
-        // PLAY THE SOUND IF IT EXISTS.
-        auto sound_effect = Sounds.find(sound_id);
-        bool sound_exists = (Sounds.end() != sound_effect);
-        if (sound_exists)
-        {
-            sound_effect->second.Play();
-        }
+    /// Moves the position in the world from which sounds are heard, which is typically the center of the camera's view.
+    /// @param[in]  world_position - The new position of the listener.
+    void Speakers::SetListenerPosition(const MATH::Vector2f& world_position)
+    {
+        SendCommand(AudioCommand { .Type = AudioCommandType::SET_LISTENER_POSITION, .WorldPosition = world_position });
     }
 
-    /// Attempts to load music from binary data into the speakers.
+    /// Loads music into the speakers for streaming from where it is stored.
     /// If music with the specified ID already exists in the speakers, it will be overwritten.
     /// @param[in]  music_id - The unique ID for the music.
-    /// @param[in]  music_binary_data - The raw binary data for the music.
-    void Speakers::LoadMusic(const RESOURCES::AssetId music_id, const std::string& music_binary_data)
+    /// @param[in]  encoded_music_location - Where the encoded music is stored.
+    /// @param[in]  music_properties - How the music is played.
+    void Speakers::LoadMusic(
+        const RESOURCES::AssetId music_id,
+        const FILESYSTEM::FileRegion& encoded_music_location,
+        const MusicProperties& music_properties)
     {
-        // PROTECT AGAINST THIS CLASS BEING USED BY MULTIPLE THREADS.
-        std::lock_guard<std::recursive_mutex> lock(SpeakerMutex);
-
 #if CHECK_OPEN_AL_ERRORS_DURING_LOADS
         // DOUBLE-CHECK TO MAKE SURE AUDIO IS STILL USABLE.
         // Checking for if any OpenAL errors occur via this error code during initialization doesn't work,
@@ -194,8 +237,11 @@ namespace AUDIO
         // works during initialization on some computers, on others it still return AL_INVALID_OPERATION
         // regardless, which is the same kind of error code that would be returned later if audio isn't
         // usable (so there isn't a way to distinguish between things earlier).
-        ALenum error_code = alGetError();
-        Enabled = Enabled && (error_code == AL_NO_ERROR);
+        if (OpenAlUsed)
+        {
+            ALenum error_code = alGetError();
+            Enabled = Enabled && (error_code == AL_NO_ERROR);
+        }
 #endif
 
         // DON'T DO ANYTHING IF THE SPEAKERS ARE DISABLED.
@@ -206,11 +252,8 @@ namespace AUDIO
         }
 
         // LOAD THE MUSIC INTO THE SPEAKERS.
-        std::unique_ptr<AUDIO::Music> music = AUDIO::Music::LoadFromMemory(music_binary_data);
-        if (music)
-        {
-            AddMusic(music_id, std::move(music));
-        }
+        // The music isn't actually read until played.
+        AddMusic(music_id, std::make_shared<AUDIO::Music>(encoded_music_location, music_properties));
     }
 
     /// Adds music to the speakers for playing.
@@ -219,9 +262,6 @@ namespace AUDIO
     /// @param[in]  music - The music.
     void Speakers::AddMusic(const RESOURCES::AssetId music_id, const std::shared_ptr<AUDIO::Music>& music)
     {
-        // PROTECT AGAINST THIS CLASS BEING USED BY MULTIPLE THREADS.
-        std::lock_guard<std::recursive_mutex> lock(SpeakerMutex);
-
 #if CHECK_OPEN_AL_ERRORS_DURING_ADDS
         // DOUBLE-CHECK TO MAKE SURE AUDIO IS STILL USABLE.
         // Checking for if any OpenAL errors occur via this error code during initialization doesn't work,
@@ -229,8 +269,11 @@ namespace AUDIO
         // works during initialization on some computers, on others it still return AL_INVALID_OPERATION
         // regardless, which is the same kind of error code that would be returned later if audio isn't
         // usable (so there isn't a way to distinguish between things earlier).
-        ALenum error_code = alGetError();
-        Enabled = Enabled && (error_code == AL_NO_ERROR);
+        if (OpenAlUsed)
+        {
+            ALenum error_code = alGetError();
+            Enabled = Enabled && (error_code == AL_NO_ERROR);
+        }
 #endif
 
         // DON'T DO ANYTHING IF THE SPEAKERS ARE DISABLED.
@@ -247,6 +290,7 @@ namespace AUDIO
         }
 
         // STORE THE MUSIC.
+        std::lock_guard<std::mutex> lock(LoadedAudioMutex);
         Music[music_id] = music;
     }
 
@@ -254,34 +298,7 @@ namespace AUDIO
     /// @param[in]  music_id - The ID of the music to play.
     void Speakers::PlayMusic(const RESOURCES::AssetId music_id)
     {
-        // PROTECT AGAINST THIS CLASS BEING USED BY MULTIPLE THREADS.
-        std::lock_guard<std::recursive_mutex> lock(SpeakerMutex);
-
-#if CHECK_OPEN_AL_ERRORS_DURING_PLAYS
-        // DOUBLE-CHECK TO MAKE SURE AUDIO IS STILL USABLE.
-        // Checking for if any OpenAL errors occur via this error code during initialization doesn't work,
-        // so it must be repeated in effectively every method in this class.  While checking OpenAL error codes,
-        // works during initialization on some computers, on others it still return AL_INVALID_OPERATION
-        // regardless, which is the same kind of error code that would be returned later if audio isn't
-        // usable (so there isn't a way to distinguish between things earlier).
-        ALenum error_code = alGetError();
-        Enabled = Enabled && (error_code == AL_NO_ERROR);
-#endif
-
-        // DON'T DO ANYTHING IF THE SPEAKERS ARE DISABLED.
-        // It's not worth spending time on anything if the speakers are disabled.
-        if (!Enabled)
-        {
-            return;
-        }
-
-        // PLAY THE MUSIC IF IT EXISTS.
-        auto music = Music.find(music_id);
-        bool music_exists = (Music.end() != music) && (nullptr != music->second);
-        if (music_exists)
-        {
-            music->second->Sfml.play();
-        }
+        SendCommand(AudioCommand { .Type = AudioCommandType::PLAY_MUSIC, .AudioId = music_id });
     }
 
     /// Starts playing the music with the given ID, assuming it is already stored in the speakers
@@ -289,60 +306,104 @@ namespace AUDIO
     /// @param[in]  music_id - The ID of the music to play.
     void Speakers::PlayMusicIfNotAlready(const RESOURCES::AssetId music_id)
     {
-        // PROTECT AGAINST THIS CLASS BEING USED BY MULTIPLE THREADS.
-        std::lock_guard<std::recursive_mutex> lock(SpeakerMutex);
+        SendCommand(AudioCommand { .Type = AudioCommandType::PLAY_MUSIC_IF_NOT_ALREADY, .AudioId = music_id });
+    }
 
-#if CHECK_OPEN_AL_ERRORS_DURING_PLAYS
-        // DOUBLE-CHECK TO MAKE SURE AUDIO IS STILL USABLE.
-        // Checking for if any OpenAL errors occur via this error code during initialization doesn't work,
-        // so it must be repeated in effectively every method in this class.  While checking OpenAL error codes,
-        // works during initialization on some computers, on others it still return AL_INVALID_OPERATION
-        // regardless, which is the same kind of error code that would be returned later if audio isn't
-        // usable (so there isn't a way to distinguish between things earlier).
-        ALenum error_code = alGetError();
-        Enabled = Enabled && (error_code == AL_NO_ERROR);
-#endif
+    /// Stops playing the music with the given ID, assuming it is already stored in the speakers.
+    /// @param[in]  music_id - The ID of the music to stop.
+    void Speakers::StopMusic(const RESOURCES::AssetId music_id)
+    {
+        SendCommand(AudioCommand { .Type = AudioCommandType::STOP_MUSIC, .AudioId = music_id });
+    }
 
-        // DON'T DO ANYTHING IF THE SPEAKERS ARE DISABLED.
-        // It's not worth spending time on anything if the speakers are disabled.
-        if (!Enabled)
+    /// Changes the volume of the music with the given ID, assuming it is already stored in the speakers.
+    /// @param[in]  music_id - The ID of the music to change.
+    /// @param[in]  volume_percent - The new volume of the music, from 0 (muted) to 100 (full volume).
+    void Speakers::SetMusicVolume(const RESOURCES::AssetId music_id, const float volume_percent)
+    {
+        SendCommand(AudioCommand { .Type = AudioCommandType::SET_MUSIC_VOLUME, .AudioId = music_id, .VolumePercent = volume_percent });
+    }
+
+    /// Gets music with the specified ID, if it exists.
+    /// @param[in]  music_id - The ID of the music to get.
+    /// @return The music, if it exists; null otherwise.
+    std::shared_ptr<AUDIO::Music> Speakers::GetMusic(const RESOURCES::AssetId music_id)
+    {
+        // PROTECT AGAINST MUSIC BEING ADDED FROM ANOTHER THREAD.
+        std::lock_guard<std::mutex> lock(LoadedAudioMutex);
+
+        // RETURN THE MUSIC IF IT EXISTS.
+        auto id_and_music = Music.find(music_id);
+        bool music_exists = (Music.end() != id_and_music);
+        if (!music_exists)
         {
-            return;
+            return nullptr;
+        }
+
+        return id_and_music->second;
+    }
+
+    /// Estimates the memory currently used by audio loaded into the speakers.
+    /// @return The approximate number of bytes of memory used by sounds and music.
+    std::size_t Speakers::ResidentAudioMemoryInBytes()
+    {
+        // PROTECT AGAINST AUDIO BEING CHANGED FROM ANOTHER THREAD.
+        std::lock_guard<std::mutex> lock(LoadedAudioMutex);
+
+        // ADD UP THE MEMORY FOR ALL SOUNDS.
+        // Sounds are fully decoded into memory.
+        std::size_t resident_memory_in_bytes = 0;
+        for (const auto& [sound_id, sound_effect] : Sounds)
+        {
+            if (sound_effect.AudioSamples)
+            {
+                resident_memory_in_bytes += static_cast<std::size_t>(sound_effect.AudioSamples->getSampleCount()) * sizeof(sf::Int16);
+            }
         }
 
-        // CHECK IF THE MUSIC EXISTS IN THE SPEAKERS.
-        auto music = Music.find(music_id);
-        bool music_exists = (Music.end() != music) && (nullptr != music->second);
-        if (music_exists)
+        // ADD UP THE MEMORY FOR ALL MUSIC.
+        for (const auto& [music_id, music] : Music)
         {
-            // PLAY THE MUSIC ONLY IF IT'S NOT ALREADY PLAYING.
-            sf::SoundSource::Status music_status = music->second->Sfml.getStatus();
-            bool music_playing = (sf::SoundSource::Playing == music_status);
-            if (!music_playing)
+            if (music)
             {
-                music->second->Sfml.play();
+                resident_memory_in_bytes += music->ResidentMemoryInBytes();
             }
         }
+
+        return resident_memory_in_bytes;
     }
 
-    /// Stops playing the music with the given ID, assuming it is already stored in the speakers.
-    /// @param[in]  music_id - The ID of the music to stop.
-    void Speakers::StopMusic(const RESOURCES::AssetId music_id)
+    /// Stops all audio that may be playing in the speakers.
+    void Speakers::StopAllAudio()
     {
-        // PROTECT AGAINST THIS CLASS BEING USED BY MULTIPLE THREADS.
-        std::lock_guard<std::recursive_mutex> lock(SpeakerMutex);
+        SendCommand(AudioCommand { .Type = AudioCommandType::STOP_ALL_AUDIO });
+    }
 
-#if CHECK_OPEN_AL_ERRORS_DURING_STOPS
-        // DOUBLE-CHECK TO MAKE SURE AUDIO IS STILL USABLE.
-        // Checking for if any OpenAL errors occur via this error code during initialization doesn't work,
-        // so it must be repeated in effectively every method in this class.  While checking OpenAL error codes,
-        // works during initialization on some computers, on others it still return AL_INVALID_OPERATION
-        // regardless, which is the same kind of error code that would be returned later if audio isn't
-        // usable (so there isn't a way to distinguish between things earlier).
-        ALenum error_code = alGetError();
-        Enabled = Enabled && (error_code == AL_NO_ERROR);
-#endif
+    /// Checks if an audio device is available for playing audio.
+    /// This kind of code isn't exposed directly through SFML,
+    /// so we have to replicate checking the device state here.
+    /// @return True if an audio device is available; false otherwise.
+    bool Speakers::AudioDeviceAvailable()
+    {
+        // TRY OPENING THE DEFAULT AUDIO DEVICE.
+        constexpr ALCchar* DEFAULT_DEVICE = nullptr;
+        ALCdevice* audio_device = alcOpenDevice(DEFAULT_DEVICE);
+        bool audio_device_available = (nullptr != audio_device);
 
+        // CLOSE ANY AUDIO DEVICE THAT WAS OPENED.
+        // SFML will open up its own copy of the default device.
+        if (audio_device)
+        {
+            alcCloseDevice(audio_device);
+        }
+
+        return audio_device_available;
+    }
+
+    /// Sends a command to the audio thread for executing.
+    /// @param[in]  command - The command to send.
+    void Speakers::SendCommand(const AudioCommand& command)
+    {
         // DON'T DO ANYTHING IF THE SPEAKERS ARE DISABLED.
         // It's not worth spending time on anything if the speakers are disabled.
         if (!Enabled)
@@ -350,62 +411,347 @@ namespace AUDIO
             return;
         }
 
-        // STOP THE MUSIC IF IT EXISTS.
-        auto music = Music.find(music_id);
-        bool music_exists = (Music.end() != music) && (nullptr != music->second);
-        if (music_exists)
+        // TRACK IF A SOUND IS ABOUT TO BE PLAYED.
+        bool plays_sound = (
+            (AudioCommandType::PLAY_SOUND == command.Type) ||
+            (AudioCommandType::PLAY_SOUND_AT_POSITION == command.Type));
+        std::size_t sound_index = static_cast<std::size_t>(command.AudioId);
+        bool sound_status_tracked = (plays_sound && sound_index < MAX_AUDIO_ID_COUNT);
+        if (sound_status_tracked)
+        {
+            ++PendingSoundPlayCounts[sound_index];
+        }
+
+        // QUEUE THE COMMAND FOR THE AUDIO THREAD.
+        // If the queue is somehow full, the command is dropped rather than stalling the game.
+        bool command_queued = PendingCommands.TryPush(command);
+        if (!command_queued && sound_status_tracked)
         {
-            music->second->Sfml.stop();
+            // The sound will never be played, so it shouldn't be considered pending.
+            --PendingSoundPlayCounts[sound_index];
         }
     }
 
-    /// Stops all audio that may be playing in the speakers.
-    void Speakers::StopAllAudio()
+    /// Runs the audio thread, executing commands from the game and publishing
+    /// the status of sounds until the speakers are destroyed.
+    void Speakers::ProcessCommands()
     {
-        // PROTECT AGAINST THIS CLASS BEING USED BY MULTIPLE THREADS.
-        std::lock_guard<std::recursive_mutex> lock(SpeakerMutex);
+        // ATTRIBUTE ANY ALLOCATIONS ON THE AUDIO THREAD TO AUDIO.
+        MEMORY::AllocationScope audio_allocation_scope(MEMORY::AllocationTag::AUDIO);
 
-#if CHECK_OPEN_AL_ERRORS_DURING_STOPS
-        // DOUBLE-CHECK TO MAKE SURE AUDIO IS STILL USABLE.
-        // Checking for if any OpenAL errors occur via this error code during initialization doesn't work,
-        // so it must be repeated in effectively every method in this class.  While checking OpenAL error codes,
-        // works during initialization on some computers, on others it still return AL_INVALID_OPERATION
-        // regardless, which is the same kind of error code that would be returned later if audio isn't
-        // usable (so there isn't a way to distinguish between things earlier).
-        ALenum error_code = alGetError();
-        Enabled = Enabled && (error_code == AL_NO_ERROR);
+        // TRACK HOW MUCH AUDIO HAS BEEN MIXED IN SOFTWARE.
+        // Audio is mixed to keep up with how much time has passed since the audio thread started.
+        auto audio_thread_start_time = std::chrono::steady_clock::now();
+        std::uint64_t total_mixed_frame_count = 0;
+
+        while (AudioThreadRunning)
+        {
+            // PROTECT AGAINST AUDIO BEING ADDED FROM ANOTHER THREAD.
+            {
+                std::lock_guard<std::mutex> lock(LoadedAudioMutex);
+
+                // EXECUTE ANY COMMANDS FROM THE GAME.
+                bool commands_executed = false;
+                AudioCommand command;
+                while (PendingCommands.TryPop(command))
+                {
+                    ExecuteCommand(command);
+                    commands_executed = true;
+                }
+
+#if CHECK_OPEN_AL_ERRORS_DURING_COMMANDS
+                // DOUBLE-CHECK TO MAKE SURE AUDIO IS STILL USABLE.
+                // Checking for if any OpenAL errors occur via this error code during initialization doesn't work,
+                // so it must be repeated after using audio.  While checking OpenAL error codes works during
+                // initialization on some computers, on others it still return AL_INVALID_OPERATION regardless,
+                // which is the same kind of error code that would be returned later if audio isn't usable
+                // (so there isn't a way to distinguish between things earlier).  This is only done on the audio
+                // thread, once per batch of commands, to keep such checks off of the game thread.
+                if (commands_executed && OpenAlUsed)
+                {
+                    ALenum error_code = alGetError();
+                    Enabled = Enabled && (error_code == AL_NO_ERROR);
+                }
 #endif
 
-        // DON'T DO ANYTHING IF THE SPEAKERS ARE DISABLED.
-        // It's not worth spending time on anything if the speakers are disabled.
-        if (!Enabled)
+                // PUBLISH THE STATUS OF SOUNDS FOR THE GAME.
+                PublishSoundStatuses();
+
+                // FREE UP MEMORY FOR ANY MUSIC THAT HAS FINISHED.
+                ReleaseFinishedMusicStreams();
+            }
+
+            // MIX AUDIO IN SOFTWARE IF APPLICABLE.
+            if (Mixer)
+            {
+                // DETERMINE HOW MUCH AUDIO SHOULD HAVE BEEN MIXED BY NOW.
+                auto elapsed_time = std::chrono::steady_clock::now() - audio_thread_start_time;
+                std::uint64_t elapsed_time_in_nanoseconds = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed_time).count());
+                constexpr std::uint64_t NANOSECONDS_PER_SECOND = 1'000'000'000;
+                std::uint64_t due_frame_count = (elapsed_time_in_nanoseconds * AudioMixer::OUTPUT_SAMPLE_RATE) / NANOSECONDS_PER_SECOND;
+
+                // MIX THE AUDIO.
+                // If the audio thread somehow fell far behind, the oldest audio is skipped
+                // rather than trying to catch up all at once.
+                std::size_t frame_count = static_cast<std::size_t>(std::min<std::uint64_t>(due_frame_count - total_mixed_frame_count, MAX_FRAMES_MIXED_AT_ONCE));
+                MixAudio(frame_count);
+                total_mixed_frame_count = due_frame_count;
+            }
+
+            // WAIT FOR MORE COMMANDS.
+            std::this_thread::sleep_for(AUDIO_THREAD_POLLING_INTERVAL);
+        }
+    }
+
+    /// Executes a single command on the audio thread.
+    /// @param[in]  command - The command to execute.
+    void Speakers::ExecuteCommand(const AudioCommand& command)
+    {
+        switch (command.Type)
+        {
+            case AudioCommandType::PLAY_SOUND:
+            case AudioCommandType::PLAY_SOUND_AT_POSITION:
+            {
+                // PLAY THE SOUND.
+                std::optional<MATH::Vector2f> world_position = std::nullopt;
+                bool sound_positioned = (AudioCommandType::PLAY_SOUND_AT_POSITION == command.Type);
+                if (sound_positioned)
+                {
+                    world_position = command.WorldPosition;
+                }
+                PlaySoundInVoice(command.AudioId, world_position);
+
+                // INDICATE THAT THE SOUND IS NO LONGER PENDING.
+                // This must happen after its playing status is published (see SoundIsPlaying()).
+                std::size_t sound_index = static_cast<std::size_t>(command.AudioId);
+                bool sound_status_tracked = (sound_index < MAX_AUDIO_ID_COUNT);
+                if (sound_status_tracked)
+                {
+                    --PendingSoundPlayCounts[sound_index];
+                }
+                break;
+            }
+            case AudioCommandType::SET_LISTENER_POSITION:
+            {
+                ListenerWorldPosition = command.WorldPosition;
+                break;
+            }
+            case AudioCommandType::PLAY_MUSIC:
+            {
+                // PLAY THE MUSIC IF IT EXISTS.
+                // Music is only streamed through OpenAL (see the class comment), so it can't be played otherwise.
+                auto music = Music.find(command.AudioId);
+                bool music_playable = OpenAlUsed && (Music.end() != music) && (nullptr != music->second);
+                if (music_playable)
+                {
+                    music->second->Play();
+                }
+                break;
+            }
+            case AudioCommandType::PLAY_MUSIC_IF_NOT_ALREADY:
+            {
+                // CHECK IF THE MUSIC EXISTS IN THE SPEAKERS AND CAN BE PLAYED.
+                auto music = Music.find(command.AudioId);
+                bool music_playable = OpenAlUsed && (Music.end() != music) && (nullptr != music->second);
+                if (music_playable)
+                {
+                    // PLAY THE MUSIC ONLY IF IT'S NOT ALREADY PLAYING.
+                    bool music_playing = music->second->IsPlaying();
+                    if (!music_playing)
+                    {
+                        music->second->Play();
+                    }
+                }
+                break;
+            }
+            case AudioCommandType::STOP_MUSIC:
+            {
+                // STOP THE MUSIC IF IT EXISTS.
+                auto music = Music.find(command.AudioId);
+                bool music_exists = (Music.end() != music) && (nullptr != music->second);
+                if (music_exists)
+                {
+                    music->second->Stop();
+                }
+                break;
+            }
+            case AudioCommandType::SET_MUSIC_VOLUME:
+            {
+                // CHANGE THE MUSIC'S VOLUME IF IT EXISTS.
+                auto music = Music.find(command.AudioId);
+                bool music_exists = (Music.end() != music) && (nullptr != music->second);
+                if (music_exists)
+                {
+                    music->second->SetVolume(command.VolumePercent);
+                }
+                break;
+            }
+            case AudioCommandType::STOP_ALL_AUDIO:
+            {
+                // STOP ANY PLAYING SOUNDS.
+                if (Mixer)
+                {
+                    Mixer->StopAll();
+                }
+                else
+                {
+                    for (sf::Sound& voice_sound : *VoiceSounds)
+                    {
+                        voice_sound.stop();
+                    }
+                }
+                VoicePool.StopAll();
+
+                // STOP ANY PLAYING MUSIC.
+                for (auto& id_and_music : Music)
+                {
+                    id_and_music.second->Stop();
+                }
+                break;
+            }
+        }
+    }
+
+    /// Plays a sound through a voice from the pool, if the sound exists and should be heard.
+    /// The sound's playing status is published immediately if it started playing.
+    /// @param[in]  sound_id - The ID of the sound to play.
+    /// @param[in]  world_position - The position in the world from which the sound comes,
+    ///     if its volume should be based on its distance from the listener.
+    void Speakers::PlaySoundInVoice(const RESOURCES::AssetId sound_id, const std::optional<MATH::Vector2f>& world_position)
+    {
+        // MAKE SURE THE SOUND EXISTS.
+        auto sound_effect = Sounds.find(sound_id);
+        bool sound_exists = (Sounds.end() != sound_effect) && (nullptr != sound_effect->second.AudioSamples);
+        if (!sound_exists)
         {
             return;
         }
 
-        // STOP ANY PLAYING SOUNDS.
-        for (auto& id_and_sound : Sounds)
+        // GET THE SOUND'S PROPERTIES.
+        SoundProperties sound_properties;
+        auto id_and_sound_properties = SoundPropertiesById.find(sound_id);
+        bool sound_has_custom_properties = (SoundPropertiesById.end() != id_and_sound_properties);
+        if (sound_has_custom_properties)
         {
-            id_and_sound.second.Stop();
+            sound_properties = id_and_sound_properties->second;
         }
-        
-        // STOP ANY PLAYING MUSIC.
-        for (auto& id_and_music : Music)
+
+        // DETERMINE HOW LOUD THE SOUND SHOULD BE AND FROM WHICH SIDE IT SHOULD BE HEARD.
+        constexpr float FULL_VOLUME_PERCENT = 100.0f;
+        float volume_percent = FULL_VOLUME_PERCENT;
+        float pan = 0.0f;
+        if (world_position)
         {
-            id_and_music.second->Sfml.stop();
+            // Sounds that can't be heard aren't played to avoid taking voices from other sounds.
+            MATH::Vector2f offset_from_listener = *world_position - ListenerWorldPosition;
+            volume_percent = sound_properties.VolumePercentAtDistance(offset_from_listener.Length());
+            bool sound_audible = (volume_percent > 0.0f);
+            if (!sound_audible)
+            {
+                return;
+            }
+
+            pan = sound_properties.PanAtHorizontalOffset(offset_from_listener.X);
+        }
+
+        // FIND A VOICE FOR THE SOUND.
+        std::optional<std::size_t> voice_index = VoicePool.AllocateVoice(sound_id, sound_properties);
+        if (!voice_index)
+        {
+            return;
+        }
+
+        // PLAY THE SOUND IN THE VOICE.
+        if (Mixer)
+        {
+            constexpr float NORMAL_PITCH = 1.0f;
+            constexpr bool LOOPING = false;
+            Mixer->Play(*voice_index, sound_effect->second.Clip(), volume_percent, NORMAL_PITCH, LOOPING, pan);
+        }
+        else
+        {
+            // Any sound previously in the voice is stopped, and audio samples are only swapped
+            // in if necessary since the voice is often reused for the same sound.
+            sf::Sound& voice_sound = (*VoiceSounds)[*voice_index];
+            voice_sound.stop();
+            const sf::SoundBuffer* audio_samples = sound_effect->second.AudioSamples.get();
+            bool audio_samples_changed = (voice_sound.getBuffer() != audio_samples);
+            if (audio_samples_changed)
+            {
+                voice_sound.setBuffer(*audio_samples);
+            }
+            voice_sound.setVolume(volume_percent);
+
+            // The sound is placed on a unit circle in front of the listener so that only its direction changes.
+            // OpenAL can only do this for mono sounds, so stereo sounds are always centered.
+            constexpr float CENTERED = 0.0f;
+            voice_sound.setPosition(pan, CENTERED, -std::sqrt(1.0f - pan * pan));
+            voice_sound.play();
+        }
+
+        // PUBLISH THAT THE SOUND IS PLAYING.
+        std::size_t sound_index = static_cast<std::size_t>(sound_id);
+        bool sound_status_tracked = (sound_index < MAX_AUDIO_ID_COUNT);
+        if (sound_status_tracked)
+        {
+            SoundPlayingStatuses[sound_index] = true;
         }
     }
 
-    /// Gets music with the specified ID, if it exists.
-    /// @param[in]  music_id - The ID of the music to get.
-    /// @return The music, if it exists; null otherwise.
-    std::shared_ptr<AUDIO::Music> Speakers::GetMusic(const RESOURCES::AssetId music_id)
+    /// Publishes whether or not each sound is currently playing so that the game
+    /// can check without waiting on the audio thread.  Voices that have finished
+    /// playing are also freed up for other sounds.
+    void Speakers::PublishSoundStatuses()
     {
-        // PROTECT AGAINST THIS CLASS BEING USED BY MULTIPLE THREADS.
-        std::lock_guard<std::recursive_mutex> lock(SpeakerMutex);
+        // UPDATE WHICH VOICES ARE STILL PLAYING.
+        std::array<bool, MAX_AUDIO_ID_COUNT> sound_playing_statuses = {};
+        for (std::size_t voice_index = 0; voice_index < SoundVoicePool::VOICE_COUNT; ++voice_index)
+        {
+            SoundVoice& voice = VoicePool.Voices[voice_index];
+            if (Mixer)
+            {
+                voice.Playing = Mixer->VoiceIsPlaying(voice_index);
+            }
+            else
+            {
+                sf::SoundSource::Status voice_status = (*VoiceSounds)[voice_index].getStatus();
+                voice.Playing = (sf::SoundSource::Playing == voice_status);
+            }
 
-        // RETURN THE MUSIC IF IT EXISTS.
-        std::shared_ptr<AUDIO::Music> music = Music[music_id];
-        return music;
+            std::size_t sound_index = static_cast<std::size_t>(voice.SoundId);
+            bool sound_status_tracked = (sound_index < MAX_AUDIO_ID_COUNT);
+            if (voice.Playing && sound_status_tracked)
+            {
+                sound_playing_statuses[sound_index] = true;
+            }
+        }
+
+        // PUBLISH THE STATUS OF EACH SOUND.
+        for (std::size_t sound_index = 0; sound_index < MAX_AUDIO_ID_COUNT; ++sound_index)
+        {
+            SoundPlayingStatuses[sound_index] = sound_playing_statuses[sound_index];
+        }
+    }
+
+    /// Mixes the next chunk of audio in software and sends it to the output.
+    /// @param[in]  frame_count - The number of frames of audio to mix.
+    void Speakers::MixAudio(const std::size_t frame_count)
+    {
+        MixedSamples.resize(frame_count * AudioMixer::OUTPUT_CHANNEL_COUNT);
+        Mixer->Mix(MixedSamples);
+        SoftwareMixingOutput->Write(MixedSamples);
+    }
+
+    /// Closes streams for any music that has finished playing to release the memory used for streaming.
+    void Speakers::ReleaseFinishedMusicStreams()
+    {
+        for (auto& [music_id, music] : Music)
+        {
+            bool music_finished = music && music->IsStreaming() && !music->IsPlaying();
+            if (music_finished)
+            {
+                music->Stop();
+            }
+        }
     }
 }
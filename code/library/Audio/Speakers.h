@@ -1,11 +1,30 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <span>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <vector>
+#include "Audio/AudioCommand.h"
+#include "Audio/AudioMixer.h"
+#include "Audio/AudioOutput.h"
 #include "Audio/Music.h"
+#include "Audio/MusicProperties.h"
 #include "Audio/SoundEffect.h"
+#include "Audio/SoundEvent.h"
+#include "Audio/SoundProperties.h"
+#include "Audio/SoundVoicePool.h"
+#include "Containers/SingleProducerSingleConsumerQueue.h"
+#include "Filesystem/FileRegion.h"
+#include "Math/Vector2.h"
 #include "Resources/AssetId.h"
 
 namespace AUDIO
@@ -15,42 +34,123 @@ namespace AUDIO
     /// to the speakers.  This is because a limited number of sounds can be
     /// loaded by the underlying sound library at a given time, so this design
     /// is intended to help capture this idea by avoiding creation of an arbitrary
-    /// number of sound effects as gameplay goes on.
+    /// number of sound effects as gameplay goes on.  Sound effects are played through
+    /// a fixed pool of voices created up-front, so the same sound may overlap with itself
+    /// (up to a per-sound limit) without creating new underlying sounds during gameplay.
+    ///
+    /// Sounds may either be played directly through the computer's audio device or mixed
+    /// in software and sent to some other output (like a file), which allows audio to be
+    /// used and tested on computers without any audio devices.  Music is currently always
+    /// streamed directly through the audio device rather than mixed in software, so music
+    /// is only played if the audio device is used (it's skipped for other outputs, like
+    /// files or the null device, which may not have any audio device to stream to).
+    ///
+    /// Audio is actually played on a separate audio thread owned by the speakers.
+    /// The game thread only pushes commands (like playing a sound) into a lock-free queue
+    /// and checks the status of sounds published by the audio thread, so it never has to wait
+    /// on the underlying audio library or on assets being loaded in the background.
+    /// Methods for playing audio and checking its status must only be called from a single
+    /// (game) thread; methods for loading or adding audio may be called from another thread.
     class Speakers
     {
     public:
-        // CONSTRUCTION.
+        // CONSTANTS.
+        /// The maximum number of audio commands that may be waiting for the audio thread.
+        /// Far more than would be issued during a single frame.
+        static constexpr std::size_t MAX_PENDING_COMMAND_COUNT = 256;
+        /// The maximum number of audio IDs whose status can be tracked.
+        static constexpr std::size_t MAX_AUDIO_ID_COUNT = 256;
+        /// How long the audio thread waits between checking for new commands.
+        /// Short enough to not noticeably delay sounds within a frame.
+        static constexpr std::chrono::milliseconds AUDIO_THREAD_POLLING_INTERVAL = std::chrono::milliseconds(2);
+        /// The most frames of audio that are mixed in software at once (100 milliseconds).
+        static constexpr std::size_t MAX_FRAMES_MIXED_AT_ONCE = AudioMixer::OUTPUT_SAMPLE_RATE / 10;
+
+        // CONSTRUCTION/DESTRUCTION.
         explicit Speakers();
+        explicit Speakers(std::unique_ptr<AudioOutput> software_mixing_output);
+        ~Speakers();
+        Speakers(const Speakers&) = delete;
+        Speakers& operator=(const Speakers&) = delete;
 
         // SOUND EFFECTS.
         void LoadSound(const RESOURCES::AssetId sound_id, const std::string& sound_binary_data);
         void AddSound(const RESOURCES::AssetId sound_id, const std::shared_ptr<sf::SoundBuffer>& audio_samples);
+        void SetSoundProperties(const RESOURCES::AssetId sound_id, const SoundProperties& sound_properties);
         bool SoundIsPlaying(const RESOURCES::AssetId sound_id);
         void PlaySoundEffect(const RESOURCES::AssetId sound_id);
+        void PlaySoundEffect(const RESOURCES::AssetId sound_id, const MATH::Vector2f& world_position);
+        void PlaySoundEffects(const std::span<const SoundEvent> sounds);
+        void SetListenerPosition(const MATH::Vector2f& world_position);
 
         // MUSIC.
-        void LoadMusic(const RESOURCES::AssetId music_id, const std::string& music_binary_data);
+        void LoadMusic(const RESOURCES::AssetId music_id, const FILESYSTEM::FileRegion& encoded_music_location, const MusicProperties& music_properties);
         void AddMusic(const RESOURCES::AssetId music_id, const std::shared_ptr<AUDIO::Music>& music);
         void PlayMusic(const RESOURCES::AssetId music_id);
         void PlayMusicIfNotAlready(const RESOURCES::AssetId music_id);
         void StopMusic(const RESOURCES::AssetId music_id);
+        void SetMusicVolume(const RESOURCES::AssetId music_id, const float volume_percent);
         std::shared_ptr<AUDIO::Music> GetMusic(const RESOURCES::AssetId music_id);
 
         // GENERAL.
+        std::size_t ResidentAudioMemoryInBytes();
         void StopAllAudio();
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// True if the speakers are enabled; false otherwise.
         /// Speakers may need to be disabled to allow the game to be played even if no audio devices are available.
-        bool Enabled = false;
+        std::atomic<bool> Enabled = false;
 
     private:
+        // DEVICE QUERYING.
+        static bool AudioDeviceAvailable();
+
+        // AUDIO THREAD.
+        void SendCommand(const AudioCommand& command);
+        void ProcessCommands();
+        void ExecuteCommand(const AudioCommand& command);
+        void PlaySoundInVoice(const RESOURCES::AssetId sound_id, const std::optional<MATH::Vector2f>& world_position);
+        void PublishSoundStatuses();
+        void MixAudio(const std::size_t frame_count);
+        void ReleaseFinishedMusicStreams();
+
         // MEMBER VARIABLES.
-        /// A mutex to provide thread-safety for this class.
-        std::recursive_mutex SpeakerMutex = {};
+        /// Commands from the game waiting to be executed by the audio thread.
+        CONTAINERS::SingleProducerSingleConsumerQueue<AudioCommand, MAX_PENDING_COMMAND_COUNT> PendingCommands = {};
+        /// Whether each sound (indexed by ID) was playing as of when the audio thread last checked.
+        std::array<std::atomic<bool>, MAX_AUDIO_ID_COUNT> SoundPlayingStatuses = {};
+        /// The number of commands to play each sound (indexed by ID) that the audio thread hasn't executed yet.
+        /// Sounds with pending commands are considered playing so that the game doesn't request them again.
+        std::array<std::atomic<unsigned int>, MAX_AUDIO_ID_COUNT> PendingSoundPlayCounts = {};
+        /// A mutex protecting the loaded sounds and music, which may be added from a background
+        /// loading thread while the audio thread is using them.  Never locked by the game thread
+        /// when playing audio.
+        std::mutex LoadedAudioMutex = {};
         /// The sound effects currently loaded into the speakers.
         std::unordered_map<RESOURCES::AssetId, AUDIO::SoundEffect> Sounds = {};
-        /// THe music currently loaded into the speakers.
+        /// Properties for sounds that shouldn't be played with the default properties.
+        std::unordered_map<RESOURCES::AssetId, SoundProperties> SoundPropertiesById = {};
+        /// Tracks which sound each voice is playing.  Only used by the audio thread.
+        SoundVoicePool VoicePool = {};
+        /// The underlying sounds for each voice in the pool.  Only created if the speakers are enabled and
+        /// sounds aren't mixed in software since creating them requires an audio device.  Only used by the audio thread.
+        std::unique_ptr<std::array<sf::Sound, SoundVoicePool::VOICE_COUNT>> VoiceSounds = nullptr;
+        /// The position in the world from which sounds are heard.  Only used by the audio thread.
+        MATH::Vector2f ListenerWorldPosition = MATH::Vector2f();
+        /// True if audio is played through OpenAL, in which case OpenAL errors are checked
+        /// and music may be played; false otherwise.
+        bool OpenAlUsed = true;
+        /// The output for sounds mixed in software, if sounds aren't played directly through the audio device.
+        std::unique_ptr<AudioOutput> SoftwareMixingOutput = nullptr;
+        /// The mixer for sounds, if mixed in software.  Only used by the audio thread.
+        std::unique_ptr<AudioMixer> Mixer = nullptr;
+        /// Scratch space for audio mixed in software, kept around to avoid allocating for each mix.
+        std::vector<float> MixedSamples = {};
+        /// The music currently loaded into the speakers.  Music is only streamed while playing.
         std::unordered_map<RESOURCES::AssetId, std::shared_ptr<AUDIO::Music>> Music = {};
+        /// True while the audio thread should keep running.
+        std::atomic<bool> AudioThreadRunning = false;
+        /// The thread on which audio commands are executed.
+        std::thread AudioThread = {};
     };
 }
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <optional>
 #include "Collision/CollisionDetectionAlgorithms.h"
 
 namespace COLLISION
@@ -15,7 +16,7 @@ namespace COLLISION
     MATH::Vector2f CollisionDetectionAlgorithms::MoveObject(
         const MATH::FloatRectangle& object_world_bounding_box,
         const MATH::Vector2f& move_vector,
-        const std::unordered_set<MAPS::TileType::Id>& tile_types_allowed_to_move_over,
+        const std::pmr::unordered_set<MAPS::TileType::Id>& tile_types_allowed_to_move_over,
         const bool allow_movement_over_solid_objects,
         MAPS::MultiTileMapGrid& tile_map_grid)
     {
@@ -42,7 +43,7 @@ namespace COLLISION
             object_new_bounding_box.SetCenterPosition(object_center_world_position.X, object_center_world_position.Y);
 
             // GET THE TILE AT THE OBJECT'S POTENTIAL NEW POSITION.
-            std::shared_ptr<MAPS::Tile> tile_at_new_object_position = tile_map_grid.GetTileAtWorldPosition(
+            const MAPS::Tile* tile_at_new_object_position = tile_map_grid.GetTileAtWorldPosition(
                 object_center_world_position.X, object_center_world_position.Y);
             if (!tile_at_new_object_position)
             {
@@ -331,16 +332,16 @@ namespace COLLISION
             float collision_box_width = object_current_bounding_box.Width();
             float horizontal_corner_tiles_adjustment_amount = collision_box_width / 4.0f;
             collision_box_left_x_position += horizontal_corner_tiles_adjustment_amount;
-            std::shared_ptr<MAPS::Tile> top_left_tile = tile_map_grid.GetTileAtWorldPosition(collision_box_left_x_position, collision_box_top_y_position);
+            const MAPS::Tile* top_left_tile = tile_map_grid.GetTileAtWorldPosition(collision_box_left_x_position, collision_box_top_y_position);
 
             // Get the tile right above the collision box's center.
             float collison_box_center_x_position = object_current_bounding_box.CenterX();
-            std::shared_ptr<MAPS::Tile> top_center_tile = tile_map_grid.GetTileAtWorldPosition(collison_box_center_x_position, collision_box_top_y_position);
+            const MAPS::Tile* top_center_tile = tile_map_grid.GetTileAtWorldPosition(collison_box_center_x_position, collision_box_top_y_position);
 
             // Get the tile for the top-right corner.
             float collision_box_right_x_position = object_current_bounding_box.RightBottom.X;
             collision_box_right_x_position -= horizontal_corner_tiles_adjustment_amount;
-            std::shared_ptr<MAPS::Tile> top_right_tile = tile_map_grid.GetTileAtWorldPosition(collision_box_right_x_position, collision_box_top_y_position);
+            const MAPS::Tile* top_right_tile = tile_map_grid.GetTileAtWorldPosition(collision_box_right_x_position, collision_box_top_y_position);
 
             // MAKE SURE THE TOP TILES EXIST.
             bool top_tiles_exist = (nullptr != top_left_tile) && (nullptr != top_center_tile) && (nullptr != top_right_tile);
@@ -470,16 +471,16 @@ namespace COLLISION
             // Get the tile for the bottom-left corner.
             float collision_box_left_x_position = object_current_bounding_box.LeftTop.X;
             collision_box_left_x_position += horizontal_corner_tiles_adjustment_amount;
-            std::shared_ptr<MAPS::Tile> bottom_left_tile = tile_map_grid.GetTileAtWorldPosition(collision_box_left_x_position, collision_box_bottom_y_position);
+            const MAPS::Tile* bottom_left_tile = tile_map_grid.GetTileAtWorldPosition(collision_box_left_x_position, collision_box_bottom_y_position);
 
             // Get the tile right below the collision box's center.
             float collison_box_center_x_position = object_current_bounding_box.CenterX();
-            std::shared_ptr<MAPS::Tile> bottom_center_tile = tile_map_grid.GetTileAtWorldPosition(collison_box_center_x_position, collision_box_bottom_y_position);
+            const MAPS::Tile* bottom_center_tile = tile_map_grid.GetTileAtWorldPosition(collison_box_center_x_position, collision_box_bottom_y_position);
 
             // Get the tile for the bottom-right corner.
             float collision_box_right_x_position = object_current_bounding_box.RightBottom.X;
             collision_box_right_x_position -= horizontal_corner_tiles_adjustment_amount;
-            std::shared_ptr<MAPS::Tile> bottom_right_tile = tile_map_grid.GetTileAtWorldPosition(collision_box_right_x_position, collision_box_bottom_y_position);
+            const MAPS::Tile* bottom_right_tile = tile_map_grid.GetTileAtWorldPosition(collision_box_right_x_position, collision_box_bottom_y_position);
 
             // MAKE SURE THE BOTTOM TILES EXIST.
             bool bottom_tiles_exist = (nullptr != bottom_left_tile) && (nullptr != bottom_center_tile) && (nullptr != bottom_right_tile);
@@ -609,16 +610,16 @@ namespace COLLISION
             // Get the tile for the top-left corner.
             float collision_box_top_y_position = object_current_bounding_box.LeftTop.Y;
             collision_box_top_y_position += vertical_corner_tiles_adjustment_amount;
-            std::shared_ptr<MAPS::Tile> top_left_tile = tile_map_grid.GetTileAtWorldPosition(collision_box_left_x_position, collision_box_top_y_position);
+            const MAPS::Tile* top_left_tile = tile_map_grid.GetTileAtWorldPosition(collision_box_left_x_position, collision_box_top_y_position);
 
             // Get the tile to the direct left of the collision box's center.
             float collision_box_center_y_position = object_current_bounding_box.CenterY();
-            std::shared_ptr<MAPS::Tile> center_left_tile = tile_map_grid.GetTileAtWorldPosition(collision_box_left_x_position, collision_box_center_y_position);
+            const MAPS::Tile* center_left_tile = tile_map_grid.GetTileAtWorldPosition(collision_box_left_x_position, collision_box_center_y_position);
 
             // Get the tile for the bottom-left corner.
             float collision_box_bottom_y_position = object_current_bounding_box.RightBottom.Y;
             collision_box_bottom_y_position -= vertical_corner_tiles_adjustment_amount;
-            std::shared_ptr<MAPS::Tile> bottom_left_tile = tile_map_grid.GetTileAtWorldPosition(collision_box_left_x_position, collision_box_bottom_y_position);
+            const MAPS::Tile* bottom_left_tile = tile_map_grid.GetTileAtWorldPosition(collision_box_left_x_position, collision_box_bottom_y_position);
 
             // MAKE SURE THE LEFT TILES EXIST.
             bool left_tiles_exist = (nullptr != top_left_tile) && (nullptr != center_left_tile) && (nullptr != bottom_left_tile);
@@ -746,16 +747,16 @@ namespace COLLISION
             // Get the tile for the top-right corner.
             float collision_box_top_y_position = object_current_bounding_box.LeftTop.Y;
             collision_box_top_y_position += vertical_corner_tiles_adjustment_amount;
-            std::shared_ptr<MAPS::Tile> top_right_tile = tile_map_grid.GetTileAtWorldPosition(collision_box_right_x_position, collision_box_top_y_position);
+            const MAPS::Tile* top_right_tile = tile_map_grid.GetTileAtWorldPosition(collision_box_right_x_position, collision_box_top_y_position);
 
             // Get the tile to the direct right of the collision box's center.
             float collision_box_center_y_position = object_current_bounding_box.CenterY();
-            std::shared_ptr<MAPS::Tile> center_right_tile = tile_map_grid.GetTileAtWorldPosition(collision_box_right_x_position, collision_box_center_y_position);
+            const MAPS::Tile* center_right_tile = tile_map_grid.GetTileAtWorldPosition(collision_box_right_x_position, collision_box_center_y_position);
 
             // Get the tile for the bottom-right corner.
             float collision_box_bottom_y_position = object_current_bounding_box.RightBottom.Y;
             collision_box_bottom_y_position -= vertical_corner_tiles_adjustment_amount;
-            std::shared_ptr<MAPS::Tile> bottom_right_tile = tile_map_grid.GetTileAtWorldPosition(collision_box_right_x_position, collision_box_bottom_y_position);
+            const MAPS::Tile* bottom_right_tile = tile_map_grid.GetTileAtWorldPosition(collision_box_right_x_position, collision_box_bottom_y_position);
 
             // MAKE SURE THE RIGHT TILES EXIST.
             bool right_tiles_exist = (nullptr != top_right_tile) && (nullptr != center_right_tile) && (nullptr != bottom_right_tile);
@@ -873,6 +874,9 @@ namespace COLLISION
             bool axe_hit_tree = axe_blade_bounds.Intersects(tree_bounds);
             if (axe_hit_tree)
             {
+                // TRACK THAT THE TILE MAP IS CHANGING.
+                tile_map->MarkChangedFromInitialState();
+
                 // PLAY THE SOUND EFFECT FOR THE AXE HITTING A TREE.
                 speakers.PlaySoundEffect(RESOURCES::AssetId::AXE_HIT_SOUND);
 
@@ -894,13 +898,16 @@ namespace COLLISION
                     food_destination_world_position.Y = tree_bottom_y_position + food_half_height_in_pixels;
 
                     // START MAKING THE FOOD FALL OFF THE TREE.
-                    OBJECTS::FallingFood falling_food;
-                    falling_food.FoodItem = *tree->Food;
-                    falling_food.DestinationWorldPosition = food_destination_world_position;
-                    
-                    // TRANSFER THE FOOD FROM THE TREE TO THE TILE MAP.
-                    tile_map->FallingFood.push_back(falling_food);
-                    tree->Food.reset();
+                    // The food is only transferred from the tree to the tile map if the tile map has room
+                    // for more falling food.  Otherwise, it stays on the tree to fall later.
+                    std::optional<CONTAINERS::ObjectPoolHandle> falling_food_handle = tile_map->FallingFood.Create();
+                    if (falling_food_handle)
+                    {
+                        OBJECTS::FallingFood* falling_food = tile_map->FallingFood.Get(*falling_food_handle);
+                        falling_food->FoodItem = *tree->Food;
+                        falling_food->DestinationWorldPosition = food_destination_world_position;
+                        tree->Food.reset();
+                    }
                 }
 
                 // CHECK IF THE TREE STILL HAS ANY HIT POINTS.
@@ -913,24 +920,13 @@ namespace COLLISION
                 else
                 {
                     // PLACE WOOD LOGS WHERE THE TREE WAS.
-                    OBJECTS::WoodLogs wood_logs;
-                    const MATH::FloatRectangle WOOD_LOG_TEXTURE_SUB_RECTANGLE = MATH::FloatRectangle::FromLeftTopAndDimensions(
-                        32.0f, 32.0f, 16.0f, 16.0f);
-                    wood_logs.Sprite = GRAPHICS::Sprite(RESOURCES::AssetId::WOOD_LOG_TEXTURE, WOOD_LOG_TEXTURE_SUB_RECTANGLE);
-                    MATH::Vector2f wood_log_center_world_position = tree->GetTrunkCenterWorldPosition();
-                    wood_logs.Sprite.WorldPosition = wood_log_center_world_position;
-                    tile_map->WoodLogs.push_back(wood_logs);
+                    MATH::Vector2f tree_trunk_center_world_position = tree->GetTrunkCenterWorldPosition();
+                    tile_map->Entities.AddWoodLogs(tree_trunk_center_world_position);
 
                     // PLACE A DUST CLOUD WHERE THE TREE WAS.
                     // This signifies the tree being chopped down and turning into wood.
-                    OBJECTS::DustCloud dust_cloud(RESOURCES::AssetId::DUST_CLOUD_TEXTURE);
                     // The dust cloud should be positioned to cover the base of the tree.
-                    MATH::Vector2f dust_cloud_center_world_position = tree->GetTrunkCenterWorldPosition();
-                    dust_cloud.Sprite.SetWorldPosition(dust_cloud_center_world_position);
-                    // The dust cloud should start animating immediately.
-                    dust_cloud.Sprite.Play();
-                    // The dust cloud needs to be added to the tile map so that it gets updated.
-                    tile_map->DustClouds.push_back(dust_cloud);
+                    tile_map->Entities.AddDustCloud(tree_trunk_center_world_position);
 
                     // REMOVE THE TREE SINCE IT NO LONGER HAS ANY HIT POINTS.
                     tree = tile_map->Trees.erase(tree);
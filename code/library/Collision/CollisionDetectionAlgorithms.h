@@ -24,7 +24,7 @@ namespace COLLISION
         static MATH::Vector2f MoveObject(
             const MATH::FloatRectangle& object_world_bounding_box,
             const MATH::Vector2f& move_vector,
-            const std::unordered_set<MAPS::TileType::Id>& tile_types_allowed_to_move_over,
+            const std::pmr::unordered_set<MAPS::TileType::Id>& tile_types_allowed_to_move_over,
             const bool allow_movement_over_solid_objects,
             MAPS::MultiTileMapGrid& tile_map_grid);
         static MATH::Vector2f MoveObject(
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <initializer_list>
 #include <stdexcept>
 #include <vector>
@@ -26,6 +27,7 @@ namespace CONTAINERS
         explicit Array2D(const unsigned int width, const unsigned int height);
         explicit Array2D(const unsigned int width, const unsigned int height, const std::initializer_list<T>& data);
         Array2D(const Array2D&) = default;
+        Array2D(Array2D&&) = default;
 
         // ASSIGNMENT OPERATORS.
         Array2D& operator=(const Array2D&) = default;
@@ -46,6 +48,8 @@ namespace CONTAINERS
         // ELEMENT ACCESS.
         T& operator()(const unsigned int x, const unsigned int y);
         const T& operator()(const unsigned int x, const unsigned int y) const;
+        T& GetUnchecked(const unsigned int x, const unsigned int y);
+        const T& GetUnchecked(const unsigned int x, const unsigned int y) const;
 
     private:
         // HELPER METHODS.
@@ -215,6 +219,34 @@ namespace CONTAINERS
         return Data.at(element_index);
     }
 
+    /// Retrieves a reference to the element at the specified 2D coordinates without any bounds-checking.
+    /// Only intended for frequently called code that has already checked the coordinates
+    /// (such as via IndicesInRange()).
+    /// @param[in]  x - The horizontal coordinate (or column) of the element to retrieve.
+    /// @param[in]  y - The vertical coordinate (or row) of the element to retrieve.
+    ///     Both coordinates must be within the array's bounds.
+    /// @return A reference to the element at the specified 2D position.
+    template <typename T>
+    T& Array2D<T>::GetUnchecked(const unsigned int x, const unsigned int y)
+    {
+        std::size_t element_index = static_cast<std::size_t>(y) * Width + x;
+        return Data[element_index];
+    }
+
+    /// Retrieves a constant reference to the element at the specified 2D coordinates without any bounds-checking.
+    /// Only intended for frequently called code that has already checked the coordinates
+    /// (such as via IndicesInRange()).
+    /// @param[in]  x - The horizontal coordinate (or column) of the element to retrieve.
+    /// @param[in]  y - The vertical coordinate (or row) of the element to retrieve.
+    ///     Both coordinates must be within the array's bounds.
+    /// @return A constant reference to the element at the specified 2D position.
+    template <typename T>
+    const T& Array2D<T>::GetUnchecked(const unsigned int x, const unsigned int y) const
+    {
+        std::size_t element_index = static_cast<std::size_t>(y) * Width + x;
+        return Data[element_index];
+    }
+
     /// Converts the provided 2D coordinates to a 1D array index.
     /// @param[in]  x - The horizontal coordinate (or column) of the element index.
     /// @param[in]  y - The vertical coordinate (or row) of the element index.
@@ -0,0 +1,324 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace CONTAINERS
+{
+    /// A handle to an object in an object pool.  Handles remain safe to use after the object
+    /// they refer to has been destroyed - the generation of the handle will no longer match
+    /// the pool's slot, so the handle simply won't retrieve anything (even if a new object
+    /// has since been created in the same slot).
+    class ObjectPoolHandle
+    {
+    public:
+        // OPERATORS.
+        bool operator==(const ObjectPoolHandle&) const = default;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The index of the slot in the pool holding the object.
+        std::uint32_t SlotIndex = 0;
+        /// The generation of the slot when the object was created.
+        std::uint32_t Generation = 0;
+    };
+
+    /// A fixed-capacity pool of objects that are frequently created and destroyed.
+    /// Objects are constructed directly within slots stored inline in the pool, so creating
+    /// and destroying objects never allocates memory (beyond any allocations by the objects themselves).
+    /// Each slot has a generation that changes whenever its object is destroyed so that
+    /// stale handles can be detected.
+    /// @tparam ObjectType - The type of object in the pool.
+    /// @tparam CAPACITY - The maximum number of objects that may be in the pool at once.
+    template <typename ObjectType, std::size_t CAPACITY>
+    class ObjectPool
+    {
+    public:
+        static_assert(CAPACITY > 0, "Capacity must be positive.");
+
+        /// An iterator over the objects currently in the pool, in slot order.
+        /// Objects may safely be destroyed while iterating, including the object currently pointed to.
+        /// @tparam IteratedObjectType - The type of object being iterated over (const or non-const).
+        template <typename IteratedObjectType>
+        class SlotIterator
+        {
+        public:
+            /// The type of pool being iterated over (const if the objects are const).
+            using PoolType = std::conditional_t<std::is_const_v<IteratedObjectType>, const ObjectPool, ObjectPool>;
+
+            /// Constructor.
+            /// @param[in]  pool - The pool being iterated over.
+            /// @param[in]  slot_index - The index of the slot at which to start iterating.
+            ///     Advanced to the next slot with an object if the slot is empty.
+            explicit SlotIterator(PoolType& pool, const std::size_t slot_index) :
+                Pool(&pool),
+                SlotIndex(slot_index)
+            {
+                SkipEmptySlots();
+            }
+
+            /// Gets the current object.
+            /// @return The current object.
+            IteratedObjectType& operator*() const
+            {
+                return *Pool->Objects[SlotIndex];
+            }
+
+            /// Accesses the current object.
+            /// @return The current object.
+            IteratedObjectType* operator->() const
+            {
+                return &*Pool->Objects[SlotIndex];
+            }
+
+            /// Moves to the next object in the pool.
+            /// @return This iterator.
+            SlotIterator& operator++()
+            {
+                ++SlotIndex;
+                SkipEmptySlots();
+                return *this;
+            }
+
+            /// Checks if two iterators are at the same position.
+            /// @param[in]  rhs - The iterator to compare with.
+            /// @return True if the iterators are at the same position; false otherwise.
+            bool operator==(const SlotIterator& rhs) const = default;
+
+            /// Gets a handle to the current object.
+            /// @return A handle to the current object.
+            ObjectPoolHandle GetHandle() const
+            {
+                ObjectPoolHandle handle =
+                {
+                    .SlotIndex = static_cast<std::uint32_t>(SlotIndex),
+                    .Generation = Pool->Generations[SlotIndex]
+                };
+                return handle;
+            }
+
+        private:
+            /// Advances to the next slot that has an object (or the end of the pool).
+            void SkipEmptySlots()
+            {
+                while (SlotIndex < CAPACITY && !Pool->Objects[SlotIndex])
+                {
+                    ++SlotIndex;
+                }
+            }
+
+            /// The pool being iterated over.
+            PoolType* Pool;
+            /// The index of the current slot.
+            std::size_t SlotIndex;
+        };
+
+        // CREATION.
+        template <typename... ConstructorArgumentTypes>
+        std::optional<ObjectPoolHandle> Create(ConstructorArgumentTypes&&... constructor_arguments);
+
+        // RETRIEVAL.
+        ObjectType* Get(const ObjectPoolHandle& handle);
+        const ObjectType* Get(const ObjectPoolHandle& handle) const;
+
+        // DESTRUCTION.
+        bool Destroy(const ObjectPoolHandle& handle);
+        void Clear();
+
+        // SIZE.
+        std::size_t Count() const;
+        bool Empty() const;
+        bool Full() const;
+
+        // ITERATION.
+        // These are lowercase to support range-based for loops.
+        SlotIterator<ObjectType> begin();
+        SlotIterator<ObjectType> end();
+        SlotIterator<const ObjectType> begin() const;
+        SlotIterator<const ObjectType> end() const;
+
+    private:
+        // MEMBER VARIABLES.
+        /// The slots for objects, which are empty if they don't currently have an object.
+        std::array<std::optional<ObjectType>, CAPACITY> Objects = {};
+        /// The current generation of each slot, which changes each time a slot's object is destroyed.
+        std::array<std::uint32_t, CAPACITY> Generations = {};
+        /// The number of objects currently in the pool.
+        std::size_t ObjectCount = 0;
+    };
+
+    /// Creates an object in the first free slot of the pool.
+    /// @tparam ConstructorArgumentTypes - The types of arguments for constructing the object.
+    /// @param[in]  constructor_arguments - The arguments for constructing the object.
+    /// @return A handle to the created object, if the pool had room; null otherwise.
+    template <typename ObjectType, std::size_t CAPACITY>
+    template <typename... ConstructorArgumentTypes>
+    std::optional<ObjectPoolHandle> ObjectPool<ObjectType, CAPACITY>::Create(ConstructorArgumentTypes&&... constructor_arguments)
+    {
+        // CHECK IF THE POOL HAS ROOM.
+        if (Full())
+        {
+            return std::nullopt;
+        }
+
+        // CREATE THE OBJECT IN THE FIRST FREE SLOT.
+        // Pools are small enough that simply searching for a free slot is cheap.
+        for (std::size_t slot_index = 0; slot_index < CAPACITY; ++slot_index)
+        {
+            std::optional<ObjectType>& slot = Objects[slot_index];
+            if (slot)
+            {
+                continue;
+            }
+
+            slot.emplace(std::forward<ConstructorArgumentTypes>(constructor_arguments)...);
+            ++ObjectCount;
+
+            ObjectPoolHandle handle =
+            {
+                .SlotIndex = static_cast<std::uint32_t>(slot_index),
+                .Generation = Generations[slot_index]
+            };
+            return handle;
+        }
+
+        // INDICATE THAT NO FREE SLOT WAS FOUND.
+        // This shouldn't happen given the count checked above.
+        return std::nullopt;
+    }
+
+    /// Gets the object referred to by a handle.
+    /// @param[in]  handle - The handle to the object.
+    /// @return The object, if it still exists; null otherwise.
+    template <typename ObjectType, std::size_t CAPACITY>
+    ObjectType* ObjectPool<ObjectType, CAPACITY>::Get(const ObjectPoolHandle& handle)
+    {
+        const ObjectType* object = std::as_const(*this).Get(handle);
+        return const_cast<ObjectType*>(object);
+    }
+
+    /// Gets the object referred to by a handle.
+    /// @param[in]  handle - The handle to the object.
+    /// @return The object, if it still exists; null otherwise.
+    template <typename ObjectType, std::size_t CAPACITY>
+    const ObjectType* ObjectPool<ObjectType, CAPACITY>::Get(const ObjectPoolHandle& handle) const
+    {
+        // MAKE SURE THE HANDLE STILL REFERS TO AN EXISTING OBJECT.
+        bool slot_exists = (handle.SlotIndex < CAPACITY);
+        if (!slot_exists)
+        {
+            return nullptr;
+        }
+        bool handle_current = (handle.Generation == Generations[handle.SlotIndex]);
+        if (!handle_current)
+        {
+            return nullptr;
+        }
+
+        const std::optional<ObjectType>& slot = Objects[handle.SlotIndex];
+        if (!slot)
+        {
+            return nullptr;
+        }
+
+        return &*slot;
+    }
+
+    /// Destroys the object referred to by a handle, freeing its slot.
+    /// @param[in]  handle - The handle to the object to destroy.
+    /// @return True if the object was destroyed; false if it no longer existed.
+    template <typename ObjectType, std::size_t CAPACITY>
+    bool ObjectPool<ObjectType, CAPACITY>::Destroy(const ObjectPoolHandle& handle)
+    {
+        // MAKE SURE THE OBJECT STILL EXISTS.
+        const ObjectType* object = Get(handle);
+        if (!object)
+        {
+            return false;
+        }
+
+        // DESTROY THE OBJECT.
+        // The slot's generation is changed so that any remaining handles to the object become stale.
+        Objects[handle.SlotIndex].reset();
+        ++Generations[handle.SlotIndex];
+        --ObjectCount;
+        return true;
+    }
+
+    /// Destroys all objects in the pool.
+    template <typename ObjectType, std::size_t CAPACITY>
+    void ObjectPool<ObjectType, CAPACITY>::Clear()
+    {
+        for (std::size_t slot_index = 0; slot_index < CAPACITY; ++slot_index)
+        {
+            std::optional<ObjectType>& slot = Objects[slot_index];
+            if (slot)
+            {
+                slot.reset();
+                ++Generations[slot_index];
+            }
+        }
+        ObjectCount = 0;
+    }
+
+    /// Gets the number of objects currently in the pool.
+    /// @return The number of objects in the pool.
+    template <typename ObjectType, std::size_t CAPACITY>
+    std::size_t ObjectPool<ObjectType, CAPACITY>::Count() const
+    {
+        return ObjectCount;
+    }
+
+    /// Checks if the pool has no objects.
+    /// @return True if the pool is empty; false otherwise.
+    template <typename ObjectType, std::size_t CAPACITY>
+    bool ObjectPool<ObjectType, CAPACITY>::Empty() const
+    {
+        bool empty = (0 == ObjectCount);
+        return empty;
+    }
+
+    /// Checks if the pool has no room for more objects.
+    /// @return True if the pool is full; false otherwise.
+    template <typename ObjectType, std::size_t CAPACITY>
+    bool ObjectPool<ObjectType, CAPACITY>::Full() const
+    {
+        bool full = (ObjectCount >= CAPACITY);
+        return full;
+    }
+
+    /// Gets an iterator to the first object in the pool.
+    /// @return An iterator to the first object in the pool.
+    template <typename ObjectType, std::size_t CAPACITY>
+    typename ObjectPool<ObjectType, CAPACITY>::template SlotIterator<ObjectType> ObjectPool<ObjectType, CAPACITY>::begin()
+    {
+        return SlotIterator<ObjectType>(*this, 0);
+    }
+
+    /// Gets an iterator past the last object in the pool.
+    /// @return An iterator past the last object in the pool.
+    template <typename ObjectType, std::size_t CAPACITY>
+    typename ObjectPool<ObjectType, CAPACITY>::template SlotIterator<ObjectType> ObjectPool<ObjectType, CAPACITY>::end()
+    {
+        return SlotIterator<ObjectType>(*this, CAPACITY);
+    }
+
+    /// Gets an iterator to the first object in the pool.
+    /// @return An iterator to the first object in the pool.
+    template <typename ObjectType, std::size_t CAPACITY>
+    typename ObjectPool<ObjectType, CAPACITY>::template SlotIterator<const ObjectType> ObjectPool<ObjectType, CAPACITY>::begin() const
+    {
+        return SlotIterator<const ObjectType>(*this, 0);
+    }
+
+    /// Gets an iterator past the last object in the pool.
+    /// @return An iterator past the last object in the pool.
+    template <typename ObjectType, std::size_t CAPACITY>
+    typename ObjectPool<ObjectType, CAPACITY>::template SlotIterator<const ObjectType> ObjectPool<ObjectType, CAPACITY>::end() const
+    {
+        return SlotIterator<const ObjectType>(*this, CAPACITY);
+    }
+}
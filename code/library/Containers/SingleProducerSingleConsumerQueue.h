@@ -0,0 +1,184 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <span>
+
+namespace CONTAINERS
+{
+    /// A fixed-capacity first-in-first-out queue that can safely be used by exactly two threads
+    /// without any locking - one thread pushing elements and another thread popping them.
+    /// Elements are stored in a ring buffer, with each thread only ever modifying its own index
+    /// into the buffer.  This allows a thread that needs to stay responsive (like the main game thread)
+    /// to hand off work to another thread without ever having to wait on it.
+    /// @tparam ElementType - The type of element in the queue.  Must be default-constructible and copyable.
+    /// @tparam CAPACITY - The maximum number of elements that may be in the queue at once.
+    ///     Must be a power of 2 to allow cheaply wrapping indices around the ring buffer.
+    template <typename ElementType, std::size_t CAPACITY>
+    class SingleProducerSingleConsumerQueue
+    {
+    public:
+        static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0, "Capacity must be a power of 2.");
+
+        // PRODUCER METHODS.
+        bool TryPush(const ElementType& element);
+        std::size_t TryPushMany(const std::span<const ElementType> elements, const std::size_t element_count_multiple = 1);
+
+        // CONSUMER METHODS.
+        bool TryPop(ElementType& element);
+        std::size_t TryPopMany(const std::span<ElementType> elements, const std::size_t element_count_multiple = 1);
+
+        // SIZE.
+        std::size_t Size() const;
+
+    private:
+        // CONSTANTS.
+        /// A typical size of a CPU cache line, in bytes.  Indices are kept on separate cache lines
+        /// so that the producer and consumer threads updating them don't slow each other down.
+        static constexpr std::size_t CACHE_LINE_SIZE_IN_BYTES = 64;
+
+        // MEMBER VARIABLES.
+        /// The total number of elements ever pushed.  Only modified by the producer.
+        alignas(CACHE_LINE_SIZE_IN_BYTES) std::atomic<std::size_t> PushedElementCount = 0;
+        /// The total number of elements ever popped.  Only modified by the consumer.
+        alignas(CACHE_LINE_SIZE_IN_BYTES) std::atomic<std::size_t> PoppedElementCount = 0;
+        /// The ring buffer of elements.
+        alignas(CACHE_LINE_SIZE_IN_BYTES) std::array<ElementType, CAPACITY> Elements = {};
+    };
+
+    /// Attempts to push an element onto the back of the queue.
+    /// Must only be called from the single producer thread.
+    /// @param[in]  element - The element to push.
+    /// @return True if the element was pushed; false if the queue was full.
+    template <typename ElementType, std::size_t CAPACITY>
+    bool SingleProducerSingleConsumerQueue<ElementType, CAPACITY>::TryPush(const ElementType& element)
+    {
+        // CHECK IF THE QUEUE HAS ROOM.
+        // The consumer's count must be acquired to ensure it has finished reading any element being overwritten.
+        std::size_t pushed_element_count = PushedElementCount.load(std::memory_order_relaxed);
+        std::size_t popped_element_count = PoppedElementCount.load(std::memory_order_acquire);
+        bool queue_full = (pushed_element_count - popped_element_count >= CAPACITY);
+        if (queue_full)
+        {
+            return false;
+        }
+
+        // PUSH THE ELEMENT.
+        // The element must be written before it is published to the consumer.
+        std::size_t element_index = pushed_element_count & (CAPACITY - 1);
+        Elements[element_index] = element;
+        PushedElementCount.store(pushed_element_count + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Attempts to push multiple elements onto the back of the queue at once.  Elements are only
+    /// pushed in groups of the specified size, and all pushed elements are published to the consumer
+    /// together, so the consumer never sees part of a group (like part of a frame of audio).
+    /// Must only be called from the single producer thread.
+    /// @param[in]  elements - The elements to push, in order.
+    /// @param[in]  element_count_multiple - The number of elements in each group.  Must be greater than 0.
+    /// @return The number of elements pushed, which is a multiple of the group size.
+    ///     Fewer elements than provided are pushed if the queue doesn't have room for all of them.
+    template <typename ElementType, std::size_t CAPACITY>
+    std::size_t SingleProducerSingleConsumerQueue<ElementType, CAPACITY>::TryPushMany(
+        const std::span<const ElementType> elements,
+        const std::size_t element_count_multiple)
+    {
+        // DETERMINE HOW MANY ELEMENTS THERE IS ROOM FOR.
+        // The consumer's count must be acquired to ensure it has finished reading any elements being overwritten.
+        std::size_t pushed_element_count = PushedElementCount.load(std::memory_order_relaxed);
+        std::size_t popped_element_count = PoppedElementCount.load(std::memory_order_acquire);
+        std::size_t free_element_count = CAPACITY - (pushed_element_count - popped_element_count);
+        std::size_t element_count = std::min(elements.size(), free_element_count);
+        element_count -= element_count % element_count_multiple;
+
+        // COPY THE ELEMENTS INTO THE RING BUFFER.
+        // The elements may wrap around from the end of the buffer to its beginning.
+        std::size_t first_element_index = pushed_element_count & (CAPACITY - 1);
+        std::size_t element_count_before_end = std::min(element_count, CAPACITY - first_element_index);
+        auto elements_before_end_end = elements.begin() + static_cast<std::ptrdiff_t>(element_count_before_end);
+        auto elements_end = elements.begin() + static_cast<std::ptrdiff_t>(element_count);
+        std::copy(elements.begin(), elements_before_end_end, Elements.begin() + static_cast<std::ptrdiff_t>(first_element_index));
+        std::copy(elements_before_end_end, elements_end, Elements.begin());
+
+        // PUBLISH ALL OF THE ELEMENTS TO THE CONSUMER AT ONCE.
+        PushedElementCount.store(pushed_element_count + element_count, std::memory_order_release);
+        return element_count;
+    }
+
+    /// Attempts to pop an element off the front of the queue.
+    /// Must only be called from the single consumer thread.
+    /// @param[out] element - The popped element, if one existed.
+    /// @return True if an element was popped; false if the queue was empty.
+    template <typename ElementType, std::size_t CAPACITY>
+    bool SingleProducerSingleConsumerQueue<ElementType, CAPACITY>::TryPop(ElementType& element)
+    {
+        // CHECK IF THE QUEUE HAS ANY ELEMENTS.
+        // The producer's count must be acquired to ensure the element being read has been fully written.
+        std::size_t popped_element_count = PoppedElementCount.load(std::memory_order_relaxed);
+        std::size_t pushed_element_count = PushedElementCount.load(std::memory_order_acquire);
+        bool queue_empty = (pushed_element_count == popped_element_count);
+        if (queue_empty)
+        {
+            return false;
+        }
+
+        // POP THE ELEMENT.
+        // The element must be read before its slot is released back to the producer.
+        std::size_t element_index = popped_element_count & (CAPACITY - 1);
+        element = Elements[element_index];
+        PoppedElementCount.store(popped_element_count + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Attempts to pop multiple elements off the front of the queue at once.
+    /// Elements are only popped in groups of the specified size.
+    /// Must only be called from the single consumer thread.
+    /// @param[out] elements - The popped elements.  As many elements are popped as will fit.
+    /// @param[in]  element_count_multiple - The number of elements in each group.  Must be greater than 0.
+    /// @return The number of elements popped, which is a multiple of the group size.
+    template <typename ElementType, std::size_t CAPACITY>
+    std::size_t SingleProducerSingleConsumerQueue<ElementType, CAPACITY>::TryPopMany(
+        const std::span<ElementType> elements,
+        const std::size_t element_count_multiple)
+    {
+        // DETERMINE HOW MANY ELEMENTS CAN BE POPPED.
+        // The producer's count must be acquired to ensure the elements being read have been fully written.
+        std::size_t popped_element_count = PoppedElementCount.load(std::memory_order_relaxed);
+        std::size_t pushed_element_count = PushedElementCount.load(std::memory_order_acquire);
+        std::size_t available_element_count = pushed_element_count - popped_element_count;
+        std::size_t element_count = std::min(elements.size(), available_element_count);
+        element_count -= element_count % element_count_multiple;
+
+        // COPY THE ELEMENTS OUT OF THE RING BUFFER.
+        // The elements may wrap around from the end of the buffer to its beginning.
+        std::size_t first_element_index = popped_element_count & (CAPACITY - 1);
+        std::size_t element_count_before_end = std::min(element_count, CAPACITY - first_element_index);
+        std::size_t element_count_after_wrapping = element_count - element_count_before_end;
+        auto first_element = Elements.begin() + static_cast<std::ptrdiff_t>(first_element_index);
+        std::copy(first_element, first_element + static_cast<std::ptrdiff_t>(element_count_before_end), elements.begin());
+        std::copy(
+            Elements.begin(),
+            Elements.begin() + static_cast<std::ptrdiff_t>(element_count_after_wrapping),
+            elements.begin() + static_cast<std::ptrdiff_t>(element_count_before_end));
+
+        // RELEASE THE ELEMENTS' SLOTS BACK TO THE PRODUCER AT ONCE.
+        // The elements must be read before their slots are released.
+        PoppedElementCount.store(popped_element_count + element_count, std::memory_order_release);
+        return element_count;
+    }
+
+    /// Gets the number of elements in the queue.  Since other threads may be modifying the queue,
+    /// this is only a snapshot that may already be out-of-date.
+    /// @return The number of elements in the queue.
+    template <typename ElementType, std::size_t CAPACITY>
+    std::size_t SingleProducerSingleConsumerQueue<ElementType, CAPACITY>::Size() const
+    {
+        std::size_t popped_element_count = PoppedElementCount.load(std::memory_order_acquire);
+        std::size_t pushed_element_count = PushedElementCount.load(std::memory_order_acquire);
+        std::size_t element_count = pushed_element_count - popped_element_count;
+        return element_count;
+    }
+}
@@ -0,0 +1,120 @@
+#include <bit>
+#include "Filesystem/BinaryReader.h"
+
+namespace FILESYSTEM
+{
+    /// Creates a reader for the specified bytes.
+    /// @param[in]  bytes - The bytes to read.  Must outlive the reader.
+    BinaryReader::BinaryReader(const std::string_view bytes) :
+        Bytes(bytes)
+    {}
+
+    /// Reads a single byte.
+    /// @return The byte read; 0 if no bytes remain.
+    std::uint8_t BinaryReader::ReadUInt8()
+    {
+        std::string_view value_bytes = ReadBytes(sizeof(std::uint8_t));
+        if (value_bytes.empty())
+        {
+            return 0;
+        }
+
+        return static_cast<std::uint8_t>(value_bytes[0]);
+    }
+
+    /// Reads a 4-byte unsigned integer stored in little-endian order.
+    /// @return The integer read; 0 if not enough bytes remain.
+    std::uint32_t BinaryReader::ReadUInt32()
+    {
+        std::uint32_t value = 0;
+        std::string_view value_bytes = ReadBytes(sizeof(value));
+        for (std::size_t byte_index = 0; byte_index < value_bytes.size(); ++byte_index)
+        {
+            constexpr unsigned int BITS_PER_BYTE = 8;
+            std::uint32_t current_byte = static_cast<std::uint8_t>(value_bytes[byte_index]);
+            value |= (current_byte << (byte_index * BITS_PER_BYTE));
+        }
+        return value;
+    }
+
+    /// Reads an 8-byte unsigned integer stored in little-endian order.
+    /// @return The integer read; 0 if not enough bytes remain.
+    std::uint64_t BinaryReader::ReadUInt64()
+    {
+        std::uint64_t value = 0;
+        std::string_view value_bytes = ReadBytes(sizeof(value));
+        for (std::size_t byte_index = 0; byte_index < value_bytes.size(); ++byte_index)
+        {
+            constexpr unsigned int BITS_PER_BYTE = 8;
+            std::uint64_t current_byte = static_cast<std::uint8_t>(value_bytes[byte_index]);
+            value |= (current_byte << (byte_index * BITS_PER_BYTE));
+        }
+        return value;
+    }
+
+    /// Reads a 4-byte IEEE-754 floating-point number stored in little-endian order.
+    /// @return The number read; 0 if not enough bytes remain.
+    float BinaryReader::ReadFloat()
+    {
+        float value = std::bit_cast<float>(ReadUInt32());
+        return value;
+    }
+
+    /// Reads a boolean stored as a single byte.
+    /// @return True if the byte was non-zero; false otherwise.
+    bool BinaryReader::ReadBool()
+    {
+        bool value = (0 != ReadUInt8());
+        return value;
+    }
+
+    /// Reads a string preceded by its 4-byte length.
+    /// @return The string read; empty if not enough bytes remain.
+    std::string BinaryReader::ReadString()
+    {
+        std::uint32_t text_length_in_bytes = ReadUInt32();
+        std::string_view text = ReadBytes(text_length_in_bytes);
+        return std::string(text);
+    }
+
+    /// Reads raw bytes without copying them.
+    /// @param[in]  size_in_bytes - The number of bytes to read.
+    /// @return The bytes read; empty if not enough bytes remain (in which case the reader fails).
+    std::string_view BinaryReader::ReadBytes(const std::size_t size_in_bytes)
+    {
+        // MAKE SURE ENOUGH BYTES REMAIN.
+        bool enough_bytes_remain = !ReadPastEnd && (size_in_bytes <= RemainingByteCount());
+        if (!enough_bytes_remain)
+        {
+            ReadPastEnd = true;
+            return {};
+        }
+
+        // READ THE BYTES.
+        std::string_view read_bytes = Bytes.substr(OffsetInBytes, size_in_bytes);
+        OffsetInBytes += size_in_bytes;
+        return read_bytes;
+    }
+
+    /// Skips over bytes without reading them.
+    /// @param[in]  size_in_bytes - The number of bytes to skip.
+    void BinaryReader::Skip(const std::size_t size_in_bytes)
+    {
+        ReadBytes(size_in_bytes);
+    }
+
+    /// Gets the number of bytes that haven't been read yet.
+    /// @return The number of remaining bytes.
+    std::size_t BinaryReader::RemainingByteCount() const
+    {
+        std::size_t remaining_byte_count = Bytes.size() - OffsetInBytes;
+        return remaining_byte_count;
+    }
+
+    /// Determines if any read has failed due to reading past the end of the bytes.
+    /// @return True if a read has failed; false otherwise.
+    bool BinaryReader::Failed() const
+    {
+        return ReadPastEnd;
+    }
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace FILESYSTEM
+{
+    /// Reads values from an in-memory buffer of bytes written by a BinaryWriter.
+    /// Like standard streams, any attempt to read past the end of the bytes puts the reader
+    /// into a failed state in which all further reads return default values, so many values
+    /// can be read before checking for errors once at the end.
+    class BinaryReader
+    {
+    public:
+        // CONSTRUCTION.
+        explicit BinaryReader(const std::string_view bytes);
+
+        // READING.
+        std::uint8_t ReadUInt8();
+        std::uint32_t ReadUInt32();
+        std::uint64_t ReadUInt64();
+        float ReadFloat();
+        bool ReadBool();
+        std::string ReadString();
+        std::string_view ReadBytes(const std::size_t size_in_bytes);
+        void Skip(const std::size_t size_in_bytes);
+
+        // STATUS.
+        std::size_t RemainingByteCount() const;
+        bool Failed() const;
+
+    private:
+        // MEMBER VARIABLES.
+        /// The bytes being read.  Must outlive the reader.
+        std::string_view Bytes = {};
+        /// The offset of the next byte to read.
+        std::size_t OffsetInBytes = 0;
+        /// True if an attempt was made to read past the end of the bytes.
+        bool ReadPastEnd = false;
+    };
+}
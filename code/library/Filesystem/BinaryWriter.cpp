@@ -0,0 +1,79 @@
+#include <bit>
+#include "Filesystem/BinaryWriter.h"
+
+namespace FILESYSTEM
+{
+    /// Writes a single byte.
+    /// @param[in]  value - The value to write.
+    void BinaryWriter::WriteUInt8(const std::uint8_t value)
+    {
+        Bytes.push_back(static_cast<char>(value));
+    }
+
+    /// Writes a 4-byte unsigned integer in little-endian order.
+    /// @param[in]  value - The value to write.
+    void BinaryWriter::WriteUInt32(const std::uint32_t value)
+    {
+        for (unsigned int byte_index = 0; byte_index < sizeof(value); ++byte_index)
+        {
+            constexpr unsigned int BITS_PER_BYTE = 8;
+            std::uint8_t current_byte = static_cast<std::uint8_t>(value >> (byte_index * BITS_PER_BYTE));
+            WriteUInt8(current_byte);
+        }
+    }
+
+    /// Writes an 8-byte unsigned integer in little-endian order.
+    /// @param[in]  value - The value to write.
+    void BinaryWriter::WriteUInt64(const std::uint64_t value)
+    {
+        for (unsigned int byte_index = 0; byte_index < sizeof(value); ++byte_index)
+        {
+            constexpr unsigned int BITS_PER_BYTE = 8;
+            std::uint8_t current_byte = static_cast<std::uint8_t>(value >> (byte_index * BITS_PER_BYTE));
+            WriteUInt8(current_byte);
+        }
+    }
+
+    /// Writes a 4-byte IEEE-754 floating-point number in little-endian order.
+    /// @param[in]  value - The value to write.
+    void BinaryWriter::WriteFloat(const float value)
+    {
+        static_assert(sizeof(float) == sizeof(std::uint32_t), "Floats must be 32-bit.");
+        WriteUInt32(std::bit_cast<std::uint32_t>(value));
+    }
+
+    /// Writes a boolean as a single byte (1 for true, 0 for false).
+    /// @param[in]  value - The value to write.
+    void BinaryWriter::WriteBool(const bool value)
+    {
+        WriteUInt8(value ? 1 : 0);
+    }
+
+    /// Writes a string, preceded by its 4-byte length, so that it can be read back without knowing its length.
+    /// @param[in]  text - The text to write.
+    void BinaryWriter::WriteString(const std::string_view text)
+    {
+        WriteUInt32(static_cast<std::uint32_t>(text.size()));
+        WriteBytes(text);
+    }
+
+    /// Writes raw bytes as-is, without any length.
+    /// @param[in]  bytes - The bytes to write.
+    void BinaryWriter::WriteBytes(const std::string_view bytes)
+    {
+        Bytes.append(bytes);
+    }
+
+    /// Overwrites a 4-byte unsigned integer previously written.  Useful for filling in
+    /// sizes that aren't known until after some other data has been written.
+    /// @param[in]  offset_in_bytes - The offset of the integer to overwrite from the start of the written bytes.
+    /// @param[in]  value - The new value to write.
+    void BinaryWriter::OverwriteUInt32(const std::size_t offset_in_bytes, const std::uint32_t value)
+    {
+        for (unsigned int byte_index = 0; byte_index < sizeof(value); ++byte_index)
+        {
+            constexpr unsigned int BITS_PER_BYTE = 8;
+            Bytes.at(offset_in_bytes + byte_index) = static_cast<char>(static_cast<std::uint8_t>(value >> (byte_index * BITS_PER_BYTE)));
+        }
+    }
+}
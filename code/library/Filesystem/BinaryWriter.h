@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace FILESYSTEM
+{
+    /// Writes values into an in-memory buffer of bytes with an explicit binary encoding.
+    /// All values are written with fixed widths in little-endian byte order,
+    /// so the bytes are the same regardless of the compiler or computer used.
+    class BinaryWriter
+    {
+    public:
+        // WRITING.
+        void WriteUInt8(const std::uint8_t value);
+        void WriteUInt32(const std::uint32_t value);
+        void WriteUInt64(const std::uint64_t value);
+        void WriteFloat(const float value);
+        void WriteBool(const bool value);
+        void WriteString(const std::string_view text);
+        void WriteBytes(const std::string_view bytes);
+
+        // OVERWRITING.
+        void OverwriteUInt32(const std::size_t offset_in_bytes, const std::uint32_t value);
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The bytes written so far.
+        std::string Bytes = "";
+    };
+}
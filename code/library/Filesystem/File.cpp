@@ -1,4 +1,11 @@
+#include <cstdio>
 #include <fstream>
+#if _WIN32
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 #include "Filesystem/File.h"
 
 namespace FILESYSTEM
@@ -14,4 +21,147 @@ namespace FILESYSTEM
         std::string binary_data(beginning_of_file, end_of_file);
         return binary_data;
     }
+
+    /// Attempts to write data in binary format to the specified file such that the file either
+    /// has all of the new data or is left unchanged (if, for example, the game crashes mid-write).
+    /// The data is first written to a temporary file next to the file, which is flushed to disk
+    /// before being renamed to replace the file.
+    /// @param[in]  path - The path of the file to write.
+    /// @param[in]  binary_data - The data to write.
+    /// @return True if all data was written; false otherwise.
+    bool File::WriteBinaryAtomically(const std::filesystem::path& path, const std::string_view binary_data)
+    {
+        // OPEN THE TEMPORARY FILE.
+        std::filesystem::path temporary_path = path;
+        temporary_path += ".tmp";
+        // Paths are opened in their native format so that non-ASCII paths work on Windows too.
+#if _WIN32
+        std::FILE* temporary_file = _wfopen(temporary_path.c_str(), L"wb");
+#else
+        std::FILE* temporary_file = std::fopen(temporary_path.c_str(), "wb");
+#endif
+        if (!temporary_file)
+        {
+            return false;
+        }
+
+        // WRITE ALL DATA TO THE TEMPORARY FILE.
+        std::size_t written_size_in_bytes = std::fwrite(binary_data.data(), sizeof(char), binary_data.size(), temporary_file);
+        bool all_data_written = (binary_data.size() == written_size_in_bytes);
+
+        // MAKE SURE THE DATA HAS REACHED THE DISK.
+        // Otherwise, the rename below could be on disk before the data being renamed.
+        bool data_flushed = (0 == std::fflush(temporary_file));
+#if _WIN32
+        bool data_synced = (0 == _commit(_fileno(temporary_file)));
+#else
+        bool data_synced = (0 == fsync(fileno(temporary_file)));
+#endif
+        bool file_closed = (0 == std::fclose(temporary_file));
+
+        bool temporary_file_written = (all_data_written && data_flushed && data_synced && file_closed);
+        if (!temporary_file_written)
+        {
+            // The original file is left alone to avoid losing any data in it.
+            std::error_code ignored_error;
+            std::filesystem::remove(temporary_path, ignored_error);
+            return false;
+        }
+
+        // REPLACE THE ORIGINAL FILE.
+        std::error_code rename_error;
+        std::filesystem::rename(temporary_path, path, rename_error);
+        bool file_replaced = !rename_error;
+        if (file_replaced)
+        {
+            SyncParentDirectory(path);
+        }
+        return file_replaced;
+    }
+
+    /// Attempts to append data in binary format to the end of the specified file (creating it if needed).
+    /// The data is flushed to disk before returning.  If not all data could be appended,
+    /// the file is restored to its original size so that it never ends with only part of the data.
+    /// @param[in]  path - The path of the file to append to.
+    /// @param[in]  binary_data - The data to append.
+    /// @return True if all data was appended; false otherwise.
+    bool File::AppendBinary(const std::filesystem::path& path, const std::string_view binary_data)
+    {
+        // REMEMBER THE ORIGINAL SIZE OF THE FILE.
+        // A missing file is treated as empty since it will be created.
+        std::error_code file_size_error;
+        std::uintmax_t original_file_size_in_bytes = std::filesystem::file_size(path, file_size_error);
+        bool file_being_created = static_cast<bool>(file_size_error);
+        if (file_being_created)
+        {
+            original_file_size_in_bytes = 0;
+        }
+
+        // OPEN THE FILE.
+#if _WIN32
+        std::FILE* file = _wfopen(path.c_str(), L"ab");
+#else
+        std::FILE* file = std::fopen(path.c_str(), "ab");
+#endif
+        if (!file)
+        {
+            return false;
+        }
+
+        // APPEND ALL DATA TO THE FILE.
+        std::size_t written_size_in_bytes = std::fwrite(binary_data.data(), sizeof(char), binary_data.size(), file);
+        bool all_data_written = (binary_data.size() == written_size_in_bytes);
+
+        // MAKE SURE THE DATA HAS REACHED THE DISK.
+        bool data_flushed = (0 == std::fflush(file));
+#if _WIN32
+        bool data_synced = (0 == _commit(_fileno(file)));
+#else
+        bool data_synced = (0 == fsync(fileno(file)));
+#endif
+        bool file_closed = (0 == std::fclose(file));
+
+        bool data_appended = (all_data_written && data_flushed && data_synced && file_closed);
+        if (!data_appended)
+        {
+            // REMOVE ANY PARTIALLY APPENDED DATA.
+            std::error_code ignored_error;
+            std::filesystem::resize_file(path, original_file_size_in_bytes, ignored_error);
+        }
+        else if (file_being_created)
+        {
+            // MAKE SURE THE NEW FILE ITSELF HAS REACHED THE DISK.
+            SyncParentDirectory(path);
+        }
+
+        return data_appended;
+    }
+
+    /// Attempts to flush changes to the directory containing a file (like the file being
+    /// created or renamed) to disk.  On POSIX systems, such changes may otherwise be lost
+    /// after a crash even if the file's data has been flushed.  Windows doesn't support
+    /// flushing directories, so nothing is done there.  Flushing is only done on a best-effort
+    /// basis since not all filesystems support it, and the file has already been changed.
+    /// @param[in]  path - The path of the file whose directory should be flushed.
+    void File::SyncParentDirectory([[maybe_unused]] const std::filesystem::path& path)
+    {
+#if !_WIN32
+        // OPEN THE DIRECTORY CONTAINING THE FILE.
+        // A relative path without any directory is within the current directory.
+        std::filesystem::path directory_path = path.parent_path();
+        if (directory_path.empty())
+        {
+            directory_path = ".";
+        }
+        int directory = open(directory_path.c_str(), O_RDONLY | O_DIRECTORY);
+        if (directory < 0)
+        {
+            return;
+        }
+
+        // FLUSH THE DIRECTORY TO DISK.
+        fsync(directory);
+        close(directory);
+#endif
+    }
 }
@@ -2,6 +2,7 @@
 
 #include <filesystem>
 #include <string>
+#include <string_view>
 
 /// Holds code for interacting with computer filesystems.
 namespace FILESYSTEM
@@ -11,5 +12,11 @@ namespace FILESYSTEM
     {
     public:
         static std::string ReadBinary(const std::filesystem::path& path);
+        static bool WriteBinaryAtomically(const std::filesystem::path& path, const std::string_view binary_data);
+        static bool AppendBinary(const std::filesystem::path& path, const std::string_view binary_data);
+
+    private:
+        // HELPERS.
+        static void SyncParentDirectory(const std::filesystem::path& path);
     };
 }
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+
+namespace FILESYSTEM
+{
+    /// A contiguous region of bytes within a file, allowing data to be read
+    /// directly from a larger file (like an asset package) only when needed.
+    struct FileRegion
+    {
+        /// The path of the file containing the region.
+        std::filesystem::path Filepath = "";
+        /// The offset of the start of the region from the start of the file.
+        std::uint64_t OffsetInBytes = 0;
+        /// The size of the region.
+        std::uint64_t SizeInBytes = 0;
+    };
+}
@@ -0,0 +1,88 @@
+#include <algorithm>
+#include "Filesystem/FileRegionStream.h"
+
+namespace FILESYSTEM
+{
+    /// Opens the stream for reading from the beginning of a region of a file.
+    /// @param[in]  file_region - The region of the file to read.
+    /// @return True if the file was opened; false otherwise.
+    bool FileRegionStream::Open(const FileRegion& file_region)
+    {
+        // OPEN THE FILE.
+        // The buffer must be provided before opening to be used.
+        File.rdbuf()->pubsetbuf(ReadBuffer.data(), static_cast<std::streamsize>(ReadBuffer.size()));
+        File.open(file_region.Filepath, std::ios::binary | std::ios::in);
+        bool file_opened = File.is_open();
+        if (!file_opened)
+        {
+            return false;
+        }
+
+        // START AT THE BEGINNING OF THE REGION.
+        Region = file_region;
+        PositionInBytes = 0;
+        File.seekg(static_cast<std::streamoff>(Region.OffsetInBytes));
+        bool region_found = !File.fail();
+        return region_found;
+    }
+
+    /// Reads data from the current position in the stream, without reading past the end of the region.
+    /// @param[out] data - The buffer to read data into.
+    /// @param[in]  size_in_bytes - The maximum number of bytes to read.
+    /// @return The number of bytes read; -1 on error.
+    sf::Int64 FileRegionStream::read(void* data, sf::Int64 size_in_bytes)
+    {
+        // MAKE SURE THE FILE CAN BE READ.
+        if (!File.is_open())
+        {
+            return -1;
+        }
+
+        // READ AS MUCH DATA AS REMAINS IN THE REGION.
+        sf::Int64 remaining_size_in_bytes = getSize() - PositionInBytes;
+        sf::Int64 read_size_in_bytes = std::clamp<sf::Int64>(size_in_bytes, 0, remaining_size_in_bytes);
+        File.read(static_cast<char*>(data), static_cast<std::streamsize>(read_size_in_bytes));
+        sf::Int64 actual_read_size_in_bytes = static_cast<sf::Int64>(File.gcount());
+        PositionInBytes += actual_read_size_in_bytes;
+        return actual_read_size_in_bytes;
+    }
+
+    /// Moves to a new position in the stream.
+    /// @param[in]  position_in_bytes - The new position, relative to the start of the region.
+    /// @return The new position; -1 on error.
+    sf::Int64 FileRegionStream::seek(sf::Int64 position_in_bytes)
+    {
+        // MAKE SURE THE POSITION IS WITHIN THE REGION.
+        bool position_within_region = (0 <= position_in_bytes) && (position_in_bytes <= getSize());
+        if (!File.is_open() || !position_within_region)
+        {
+            return -1;
+        }
+
+        // MOVE TO THE POSITION.
+        // Any errors from previously reading to the end of the file must be cleared first.
+        File.clear();
+        File.seekg(static_cast<std::streamoff>(Region.OffsetInBytes) + static_cast<std::streamoff>(position_in_bytes));
+        if (File.fail())
+        {
+            return -1;
+        }
+
+        PositionInBytes = position_in_bytes;
+        return PositionInBytes;
+    }
+
+    /// Gets the current position in the stream.
+    /// @return The current position, relative to the start of the region.
+    sf::Int64 FileRegionStream::tell()
+    {
+        return PositionInBytes;
+    }
+
+    /// Gets the size of the stream.
+    /// @return The size of the region, in bytes.
+    sf::Int64 FileRegionStream::getSize()
+    {
+        return static_cast<sf::Int64>(Region.SizeInBytes);
+    }
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <array>
+#include <fstream>
+#include <SFML/System/InputStream.hpp>
+#include "Filesystem/FileRegion.h"
+
+namespace FILESYSTEM
+{
+    /// A stream for reading a region of a file in small chunks, without ever reading the whole region
+    /// into memory.  Positions within the stream are relative to the start of the region, so the
+    /// region looks like an entire file to SFML classes reading from the stream.
+    class FileRegionStream : public sf::InputStream
+    {
+    public:
+        // CONSTANTS.
+        /// The size of each chunk read from the file at once.
+        static constexpr std::size_t READ_BUFFER_SIZE_IN_BYTES = 16 * 1024;
+
+        // OPENING.
+        bool Open(const FileRegion& file_region);
+
+        // READING.
+        sf::Int64 read(void* data, sf::Int64 size_in_bytes) override;
+        sf::Int64 seek(sf::Int64 position_in_bytes) override;
+        sf::Int64 tell() override;
+        sf::Int64 getSize() override;
+
+    private:
+        // MEMBER VARIABLES.
+        /// The region of the file being read.
+        FileRegion Region = {};
+        /// The current position within the region.
+        sf::Int64 PositionInBytes = 0;
+        /// The file being read.
+        std::ifstream File = {};
+        /// The buffer for chunks read from the file.  Provided explicitly so that
+        /// the memory used for reading is known and small.
+        std::array<char, READ_BUFFER_SIZE_IN_BYTES> ReadBuffer = {};
+    };
+}
@@ -233,6 +233,18 @@ namespace GRAPHICS
         }
     }
 
+    /// Gives the sprite its own copies of its animation sequences.  Animation sequences are shared
+    /// when an animated sprite is copied, so this should be called on a copy whose animations must
+    /// play (or stay still) independently of the sprite it was copied from.  Frames remain shared
+    /// since they never change.
+    void AnimatedSprite::CopyAnimationSequences()
+    {
+        for (auto& [animation_name, animation_sequence] : AnimationSequences)
+        {
+            animation_sequence = std::make_shared<AnimationSequence>(*animation_sequence);
+        }
+    }
+
     /// Sets the rotation of the sprite, relative to its origin.
     /// @param[in]  angle_in_degrees - The angle for the rotation.
     void AnimatedSprite::SetRotation(const float angle_in_degrees)
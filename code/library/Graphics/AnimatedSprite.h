@@ -48,6 +48,7 @@ namespace GRAPHICS
         void ResetAnimation();
         bool IsAnimating() const;
         std::shared_ptr<AnimationSequence> GetCurrentAnimationSequence() const;
+        void CopyAnimationSequences();
 
         // ROTATION.
         void SetRotation(const float angle_in_degrees);
@@ -1,3 +1,4 @@
+#include <stdexcept>
 #include "Graphics/AnimationSequence.h"
 
 namespace GRAPHICS
@@ -12,6 +13,20 @@ namespace GRAPHICS
         const bool is_looping,
         const sf::Time& total_duration,
         const std::vector<MATH::IntRectangle>& frames) :
+    AnimationSequence(name, is_looping, total_duration, std::make_shared<const std::vector<MATH::IntRectangle>>(frames))
+    {}
+
+    /// Constructor for an animation sequence sharing frames with other animation sequences.
+    /// @param[in]  name - The name to identify the animation sequence.
+    /// @param[in]  is_looping - Whether the animation sequence loops or not.
+    /// @param[in]  total_duration - The total duration of the animation sequence.
+    /// @param[in]  frames - The frames in the sequence.
+    /// @throws std::invalid_argument - Thrown if the frames are null.
+    AnimationSequence::AnimationSequence(
+        const std::string& name,
+        const bool is_looping,
+        const sf::Time& total_duration,
+        const std::shared_ptr<const std::vector<MATH::IntRectangle>>& frames) :
     AnimationName(name),
     Loops(is_looping),
     TotalDuration(total_duration),
@@ -19,13 +34,20 @@ namespace GRAPHICS
     CurrentlyPlaying(false),
     CurrentFrameIndex(0),
     ElapsedTimeForCurrentFrame(sf::Time::Zero)
-    {}
+    {
+        // MAKE SURE FRAMES WERE PROVIDED.
+        bool frames_exist = (nullptr != Frames);
+        if (!frames_exist)
+        {
+            throw std::invalid_argument("Cannot create animation sequence with null frames.");
+        }
+    }
 
     /// Gets the total number of frames in the animation sequence.
     /// @return The total number of frames.
     unsigned int AnimationSequence::GetFrameCount() const
     {
-        size_t frame_count = Frames.size();
+        size_t frame_count = Frames->size();
         return static_cast<unsigned int>(frame_count);
     }
 
@@ -37,7 +59,7 @@ namespace GRAPHICS
     {
         // at() is used over [] since at() will perform bounds checking
         // and throw an exception if the index is out-of-bounds.
-        MATH::IntRectangle frame = Frames.at(frame_index);
+        MATH::IntRectangle frame = Frames->at(frame_index);
         return frame;
     }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 #include <SFML/System.hpp>
@@ -11,6 +12,10 @@ namespace GRAPHICS
     /// It is not intended to be automatically rendered by
     /// the graphics system but instead much be attached
     /// to another graphics component that is rendered.
+    ///
+    /// Frames never change after construction, so they may be shared between
+    /// many animation sequences (like for every tree in the world) to avoid
+    /// copying them.  Playback state is separate for each animation sequence.
     class AnimationSequence
     {
     public:
@@ -20,6 +25,11 @@ namespace GRAPHICS
             const bool is_looping,
             const sf::Time& total_duration,
             const std::vector<MATH::IntRectangle>& frames);
+        explicit AnimationSequence(
+            const std::string& name,
+            const bool is_looping,
+            const sf::Time& total_duration,
+            const std::shared_ptr<const std::vector<MATH::IntRectangle>>& frames);
 
         // FRAME RETREIVAL.
         unsigned int GetFrameCount() const;
@@ -36,7 +46,7 @@ namespace GRAPHICS
         std::string AnimationName;    ///< The name of this animation.
         bool Loops;   ///< Whether or not this animation loops.
         sf::Time TotalDuration;   ///< The total duration of the animation sequence.
-        std::vector<MATH::IntRectangle> Frames;    ///< The underlying Thor animation resource.
+        std::shared_ptr<const std::vector<MATH::IntRectangle>> Frames;    ///< The frames in the sequence.  Never null.
 
     private:
         // HELPER METHODS.
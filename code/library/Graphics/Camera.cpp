@@ -75,4 +75,20 @@ namespace GRAPHICS
         float current_camera_center_y = ScrollStartPosition.Y + ((ScrollEndPosition.Y - ScrollStartPosition.Y) * scroll_percentage_so_far);
         SetCenter(current_camera_center_x, current_camera_center_y);
     }
+
+    /// Gets the world position on which the camera will be centered once any scrolling finishes.
+    /// Useful for preparing whatever the camera will be viewing before it gets there.
+    /// @return The center world position the camera is scrolling to, if scrolling;
+    ///     the current center world position otherwise.
+    MATH::Vector2f Camera::GetDestinationCenter() const
+    {
+        if (IsScrolling)
+        {
+            return ScrollEndPosition;
+        }
+        else
+        {
+            return ViewBounds.Center();
+        }
+    }
 }
@@ -22,6 +22,7 @@ namespace GRAPHICS
         // SCROLLING.
         void StartScrolling(const MATH::Vector2f& start_position, const MATH::Vector2f& end_position);
         void Scroll(const sf::Time& elapsed_time);
+        MATH::Vector2f GetDestinationCenter() const;
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The bounding rectangle (in world coordinates) of the camera's view.
@@ -32,6 +32,19 @@ namespace GRAPHICS
     Alpha(alpha)
     {}
 
+    /// Equality operator.
+    /// @param[in]  rhs_color - The color on the right-hand side of the operator.
+    /// @return True if all components of the colors are equal; false otherwise.
+    bool Color::operator== (const Color& rhs_color) const
+    {
+        bool colors_equal = (
+            (Red == rhs_color.Red) &&
+            (Green == rhs_color.Green) &&
+            (Blue == rhs_color.Blue) &&
+            (Alpha == rhs_color.Alpha));
+        return colors_equal;
+    }
+
     /// Scales the red, green, and blue color components down
     /// by multiplying by the provided scale factor.
     /// @param[in]  scale_factor - The amount to scale down
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 
 /// Holds code related to computer graphics.
 namespace GRAPHICS
@@ -49,6 +51,9 @@ namespace GRAPHICS
             const uint8_t blue = 0,
             const uint8_t alpha = MAX_COLOR_COMPONENT);
 
+        // OPERATORS.
+        bool operator== (const Color& rhs_color) const;
+
         // PUBLIC METHODS.
         void ScaleRgb(const float scale_factor);
         void ScaleRgbDown(const uint8_t scale_factor);
@@ -64,3 +69,27 @@ namespace GRAPHICS
         uint8_t Alpha;
     };
 }
+
+namespace std
+{
+    /// A hash operation for colors.
+    /// Required for use as a key in hashed containers.
+    template <>
+    struct hash<GRAPHICS::Color>
+    {
+        /// Computes a hash code for the color.
+        /// @param[in]  color - The color to hash.
+        /// @return A hash code for the color.
+        std::size_t operator()(const GRAPHICS::Color& color) const
+        {
+            // All components are packed together since they fit within a single hash value.
+            std::uint32_t packed_color = (
+                (static_cast<std::uint32_t>(color.Red) << 24) |
+                (static_cast<std::uint32_t>(color.Green) << 16) |
+                (static_cast<std::uint32_t>(color.Blue) << 8) |
+                static_cast<std::uint32_t>(color.Alpha));
+            std::size_t color_hash = std::hash<std::uint32_t>{}(packed_color);
+            return color_hash;
+        }
+    };
+}
@@ -0,0 +1,225 @@
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <tuple>
+#include "Graphics/DirtyRegionTracker.h"
+
+namespace GRAPHICS
+{
+    /// Orders records of drawings to allow them to be sorted and compared as sets.
+    /// @param[in]  rhs_record - The record on the right-hand side of the operator.
+    /// @return True if this record is ordered before the right-hand record; false otherwise.
+    bool ScreenDrawRecord::operator< (const ScreenDrawRecord& rhs_record) const
+    {
+        auto lhs_values = std::tie(
+            ContentHash,
+            ScreenRectangle.LeftTop.X,
+            ScreenRectangle.LeftTop.Y,
+            ScreenRectangle.RightBottom.X,
+            ScreenRectangle.RightBottom.Y);
+        auto rhs_values = std::tie(
+            rhs_record.ContentHash,
+            rhs_record.ScreenRectangle.LeftTop.X,
+            rhs_record.ScreenRectangle.LeftTop.Y,
+            rhs_record.ScreenRectangle.RightBottom.X,
+            rhs_record.ScreenRectangle.RightBottom.Y);
+        return lhs_values < rhs_values;
+    }
+
+    /// Begins tracking drawing for a new frame.  Anything recorded for the current frame
+    /// becomes the previous frame's drawing for comparison.
+    void DirtyRegionTracker::BeginFrame()
+    {
+        PreviousFrameRecords.swap(CurrentFrameRecords);
+        CurrentFrameRecords.clear();
+        DirtyRegions.clear();
+    }
+
+    /// Records something drawn to the screen during the current frame.
+    /// @param[in]  screen_rectangle - The rectangle of the screen covered by the drawing.
+    /// @param[in]  content_hash - A hash of everything else affecting how the drawing appears.
+    void DirtyRegionTracker::Record(const MATH::FloatRectangle& screen_rectangle, const std::size_t content_hash)
+    {
+        CurrentFrameRecords.push_back(ScreenDrawRecord
+        {
+            .ScreenRectangle = screen_rectangle,
+            .ContentHash = content_hash
+        });
+    }
+
+    /// Marks the entire screen as needing to be redrawn the next time dirty regions are computed.
+    void DirtyRegionTracker::MarkAllDirty()
+    {
+        AllDirty = true;
+    }
+
+    /// Computes the regions of the screen that need to be redrawn based on differences
+    /// between what was drawn in the previous and current frames.
+    /// @param[in]  screen_rectangle - The rectangle of the entire screen.
+    void DirtyRegionTracker::ComputeDirtyRegions(const MATH::FloatRectangle& screen_rectangle)
+    {
+        DirtyRegions.clear();
+
+        // CHECK IF THE ENTIRE SCREEN NEEDS TO BE REDRAWN.
+        if (AllDirty)
+        {
+            DirtyRegions.push_back(screen_rectangle);
+            AllDirty = false;
+            return;
+        }
+
+        // FIND ANYTHING THAT WAS ADDED, REMOVED, OR CHANGED SINCE THE PREVIOUS FRAME.
+        // Records are sorted so that the frames can be compared as sets.  The order of drawing
+        // doesn't matter here since anything overlapping a changed region gets redrawn in order.
+        std::sort(PreviousFrameRecords.begin(), PreviousFrameRecords.end());
+        std::sort(CurrentFrameRecords.begin(), CurrentFrameRecords.end());
+        ChangedRecords.clear();
+        std::set_symmetric_difference(
+            PreviousFrameRecords.cbegin(),
+            PreviousFrameRecords.cend(),
+            CurrentFrameRecords.cbegin(),
+            CurrentFrameRecords.cend(),
+            std::back_inserter(ChangedRecords));
+        for (const ScreenDrawRecord& changed_record : ChangedRecords)
+        {
+            AddDirtyRegion(changed_record.ScreenRectangle);
+        }
+
+        // EXPAND THE DIRTY REGIONS TO FULLY COVER ANYTHING OVERLAPPING THEM.
+        // Anything partially within a dirty region gets redrawn entirely, so the rest of it must
+        // also be cleared and redrawn to avoid it being drawn over things not being redrawn.
+        bool dirty_regions_expanded = true;
+        while (dirty_regions_expanded)
+        {
+            dirty_regions_expanded = false;
+            for (const ScreenDrawRecord& current_record : CurrentFrameRecords)
+            {
+                // Drawings without any area can't cover anything.
+                const MATH::FloatRectangle& record_rectangle = current_record.ScreenRectangle;
+                bool record_has_area = (record_rectangle.Width() > 0.0f) && (record_rectangle.Height() > 0.0f);
+                if (!record_has_area)
+                {
+                    continue;
+                }
+
+                bool record_needs_redrawing = IsDirty(record_rectangle);
+                bool record_already_covered = IsCoveredByDirtyRegion(record_rectangle);
+                if (record_needs_redrawing && !record_already_covered)
+                {
+                    AddDirtyRegion(record_rectangle);
+                    dirty_regions_expanded = true;
+                }
+            }
+        }
+
+        // LIMIT THE DIRTY REGIONS TO THE SCREEN.
+        for (std::size_t dirty_region_index = 0; dirty_region_index < DirtyRegions.size();)
+        {
+            MATH::FloatRectangle& dirty_region = DirtyRegions[dirty_region_index];
+            dirty_region.LeftTop.X = std::max(dirty_region.LeftTop.X, screen_rectangle.LeftTop.X);
+            dirty_region.LeftTop.Y = std::max(dirty_region.LeftTop.Y, screen_rectangle.LeftTop.Y);
+            dirty_region.RightBottom.X = std::min(dirty_region.RightBottom.X, screen_rectangle.RightBottom.X);
+            dirty_region.RightBottom.Y = std::min(dirty_region.RightBottom.Y, screen_rectangle.RightBottom.Y);
+
+            bool dirty_region_on_screen = (dirty_region.Width() > 0.0f) && (dirty_region.Height() > 0.0f);
+            if (dirty_region_on_screen)
+            {
+                ++dirty_region_index;
+            }
+            else
+            {
+                DirtyRegions.erase(DirtyRegions.begin() + dirty_region_index);
+            }
+        }
+    }
+
+    /// Determines if a region of the screen needs to be redrawn.
+    /// @param[in]  screen_rectangle - The region of the screen to check.
+    /// @return True if any part of the region is dirty; false otherwise.
+    bool DirtyRegionTracker::IsDirty(const MATH::FloatRectangle& screen_rectangle) const
+    {
+        for (const MATH::FloatRectangle& dirty_region : DirtyRegions)
+        {
+            if (dirty_region.Intersects(screen_rectangle))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /// Gets the total number of pixels in all dirty regions.
+    /// @return The number of pixels that need to be redrawn.
+    unsigned int DirtyRegionTracker::DirtyPixelCount() const
+    {
+        unsigned int dirty_pixel_count = 0;
+        for (const MATH::FloatRectangle& dirty_region : DirtyRegions)
+        {
+            dirty_pixel_count += static_cast<unsigned int>(dirty_region.Width() * dirty_region.Height());
+        }
+        return dirty_pixel_count;
+    }
+
+    /// Adds a dirty region, merging it with any overlapping dirty regions.
+    /// @param[in]  screen_rectangle - The region of the screen that needs to be redrawn.
+    void DirtyRegionTracker::AddDirtyRegion(const MATH::FloatRectangle& screen_rectangle)
+    {
+        // ALIGN THE REGION TO WHOLE PIXELS.
+        // Otherwise, partially covered pixels wouldn't be completely cleared.
+        MATH::FloatRectangle new_dirty_region = screen_rectangle;
+        new_dirty_region.LeftTop.X = std::floor(new_dirty_region.LeftTop.X);
+        new_dirty_region.LeftTop.Y = std::floor(new_dirty_region.LeftTop.Y);
+        new_dirty_region.RightBottom.X = std::ceil(new_dirty_region.RightBottom.X);
+        new_dirty_region.RightBottom.Y = std::ceil(new_dirty_region.RightBottom.Y);
+        bool region_empty = (new_dirty_region.Width() <= 0.0f) || (new_dirty_region.Height() <= 0.0f);
+        if (region_empty)
+        {
+            return;
+        }
+
+        // MERGE ANY OVERLAPPING DIRTY REGIONS.
+        // Merging may cause the new region to overlap regions that it previously didn't,
+        // so merging continues until no more overlapping regions are found.
+        bool overlapping_region_found = true;
+        while (overlapping_region_found)
+        {
+            auto overlapping_region = std::find_if(
+                DirtyRegions.begin(),
+                DirtyRegions.end(),
+                [&new_dirty_region](const MATH::FloatRectangle& dirty_region) { return dirty_region.Intersects(new_dirty_region); });
+            overlapping_region_found = (overlapping_region != DirtyRegions.end());
+            if (overlapping_region_found)
+            {
+                new_dirty_region.LeftTop.X = std::min(new_dirty_region.LeftTop.X, overlapping_region->LeftTop.X);
+                new_dirty_region.LeftTop.Y = std::min(new_dirty_region.LeftTop.Y, overlapping_region->LeftTop.Y);
+                new_dirty_region.RightBottom.X = std::max(new_dirty_region.RightBottom.X, overlapping_region->RightBottom.X);
+                new_dirty_region.RightBottom.Y = std::max(new_dirty_region.RightBottom.Y, overlapping_region->RightBottom.Y);
+                DirtyRegions.erase(overlapping_region);
+            }
+        }
+
+        DirtyRegions.push_back(new_dirty_region);
+    }
+
+    /// Determines if a region of the screen is completely covered by a single dirty region.
+    /// @param[in]  screen_rectangle - The region of the screen to check.
+    /// @return True if the region is completely covered by a dirty region; false otherwise.
+    bool DirtyRegionTracker::IsCoveredByDirtyRegion(const MATH::FloatRectangle& screen_rectangle) const
+    {
+        for (const MATH::FloatRectangle& dirty_region : DirtyRegions)
+        {
+            bool region_covered = (
+                dirty_region.LeftTop.X <= screen_rectangle.LeftTop.X &&
+                dirty_region.LeftTop.Y <= screen_rectangle.LeftTop.Y &&
+                screen_rectangle.RightBottom.X <= dirty_region.RightBottom.X &&
+                screen_rectangle.RightBottom.Y <= dirty_region.RightBottom.Y);
+            if (region_covered)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+#include "Math/Rectangle.h"
+
+namespace GRAPHICS
+{
+    /// Something drawn to the screen during a frame, as recorded for detecting
+    /// changes to the screen between frames.
+    struct ScreenDrawRecord
+    {
+        // OPERATORS.
+        bool operator< (const ScreenDrawRecord& rhs_record) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The rectangle of the screen covered by the drawing.
+        MATH::FloatRectangle ScreenRectangle = MATH::FloatRectangle();
+        /// A hash of everything else affecting how the drawing appears within its rectangle.
+        std::size_t ContentHash = 0;
+    };
+
+    /// Tracks which regions of a retained screen have changed between frames.
+    /// Mostly static screens (like menus) would otherwise need to be completely redrawn
+    /// each frame even if little or nothing changed.  By recording what gets drawn each frame
+    /// and comparing it against what was drawn in the previous frame, only regions of the
+    /// screen that actually changed need to be cleared and redrawn.
+    class DirtyRegionTracker
+    {
+    public:
+        // HASHING.
+        template <typename ValueType>
+        static void CombineHash(const ValueType& value, std::size_t& hash);
+
+        // RECORDING.
+        void BeginFrame();
+        void Record(const MATH::FloatRectangle& screen_rectangle, const std::size_t content_hash);
+        void MarkAllDirty();
+
+        // DIRTY REGIONS.
+        void ComputeDirtyRegions(const MATH::FloatRectangle& screen_rectangle);
+        bool IsDirty(const MATH::FloatRectangle& screen_rectangle) const;
+        unsigned int DirtyPixelCount() const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// True if the entire screen needs to be redrawn the next time dirty regions are computed,
+        /// regardless of what has been recorded (such as if the screen was last drawn without tracking).
+        bool AllDirty = true;
+        /// The regions of the screen that need to be redrawn for the current frame.
+        /// These never overlap and are aligned to whole pixels.
+        std::vector<MATH::FloatRectangle> DirtyRegions = {};
+
+    private:
+        // HELPER METHODS.
+        void AddDirtyRegion(const MATH::FloatRectangle& screen_rectangle);
+        bool IsCoveredByDirtyRegion(const MATH::FloatRectangle& screen_rectangle) const;
+
+        // MEMBER VARIABLES.
+        /// What was drawn to the screen during the previous frame.
+        std::vector<ScreenDrawRecord> PreviousFrameRecords = {};
+        /// What has been drawn to the screen so far during the current frame.
+        std::vector<ScreenDrawRecord> CurrentFrameRecords = {};
+        /// Scratch space for what changed between the previous and current frames.
+        /// Kept across frames so that its memory can be reused rather than reallocated each frame.
+        std::vector<ScreenDrawRecord> ChangedRecords = {};
+    };
+
+    /// Combines the hash of a value into an existing hash.
+    /// @tparam ValueType - The type of value to hash.  Must be hashable via std::hash.
+    /// @param[in]  value - The value to hash.
+    /// @param[in,out]  hash - The hash to combine the value's hash into.
+    template <typename ValueType>
+    void DirtyRegionTracker::CombineHash(const ValueType& value, std::size_t& hash)
+    {
+        // The constant and shifts help spread out bits so that similar values don't cancel each other out.
+        constexpr std::size_t GOLDEN_RATIO_BITS = 0x9e3779b9;
+        std::size_t value_hash = std::hash<ValueType>()(value);
+        hash ^= value_hash + GOLDEN_RATIO_BITS + (hash << 6) + (hash >> 2);
+    }
+}
@@ -1,6 +1,8 @@
 #include <cmath>
+#include <string>
 #include "Gameplay/FloodElapsedTime.h"
 #include "Graphics/Gui/DuringFloodHeadsUpDisplay.h"
+#include "Memory/AllocationTracker.h"
 
 namespace GRAPHICS::GUI
 {
@@ -21,11 +23,16 @@ namespace GRAPHICS::GUI
     /// Updates the HUD.
     /// @param[in]  current_game_data - The game data to display in the HUD.
     /// @param[in]  gaming_hardware - The gaming hardware supplying input.
+    /// @param[in,out]  saved_game_writer - The writer for saving the game in the background.
     /// @return The state the game should be in after updating the HUD and any food type that should be dropped.
     std::tuple<STATES::GameState, OBJECTS::Food::TypeId> DuringFloodHeadsUpDisplay::Update(
         const STATES::SavedGameData& current_game_data,
-        const HARDWARE::GamingHardware& gaming_hardware)
+        const HARDWARE::GamingHardware& gaming_hardware,
+        STATES::SavedGameWriter& saved_game_writer)
     {
+        // ATTRIBUTE ANY ALLOCATIONS TO THE GUI.
+        MEMORY::AllocationScope gui_allocation_scope(MEMORY::AllocationTag::GUI);
+
         OBJECTS::Food::TypeId selected_food_type_to_drop = OBJECTS::Food::NONE;
 
         // CHECK IF THE PAUSE MENU IS OPEN.
@@ -37,7 +44,7 @@ namespace GRAPHICS::GUI
             if (gaming_hardware.InputController.ButtonWasPressed(sf::Keyboard::Return))
             {
                 // SAVE THE GAME DATA.
-                current_game_data.Write(current_game_data.Filepath);
+                saved_game_writer.Save(current_game_data, STATES::SavedGameWriter::DisplayErrorIfNotSaved);
 
                 // CLOSE THE PAUSE MENU.
                 PauseMenuVisible = false;
@@ -107,17 +114,23 @@ namespace GRAPHICS::GUI
     /// Renders the HUD to the provided target.
     /// @param[in]  current_game_data - The game data being visualized in the HUD.
     /// @param[in,out]  renderer - The renderer to use for rendering.
+    /// @param[in,out]  frame_arena - The arena for any temporary memory needed only for this frame.
     void DuringFloodHeadsUpDisplay::Render(
         const STATES::SavedGameData& current_game_data,
-        GRAPHICS::Renderer& renderer)
+        GRAPHICS::Renderer& renderer,
+        MEMORY::FrameArena& frame_arena)
     {
+        // ATTRIBUTE ANY ALLOCATIONS TO THE GUI.
+        MEMORY::AllocationScope gui_allocation_scope(MEMORY::AllocationTag::GUI);
+
         // RENDER TEXT INDICATING THE CURRENT DAY/TIME.
         unsigned int flood_day_count = 0;
         unsigned int current_day_hour = 0;
         GAMEPLAY::FloodElapsedTime::GetCurrentDayAndHour(current_game_data.FloodElapsedGameplayTime, flood_day_count, current_day_hour);
-        std::string flood_day_and_time_text = 
-            "Day: " + std::to_string(flood_day_count) +
-            " Hour: " + std::to_string(current_day_hour);
+        std::pmr::string flood_day_and_time_text("Day: ", &frame_arena);
+        flood_day_and_time_text += std::to_string(flood_day_count);
+        flood_day_and_time_text += " Hour: ";
+        flood_day_and_time_text += std::to_string(current_day_hour);
 
         const MATH::Vector2f TOP_LEFT_SCREEN_POSITION_IN_PIXELS(0.0f, 0.0f);
         // The main HUD text is rendered white to make it stand out against the black border inside the ark.
@@ -216,7 +229,9 @@ namespace GRAPHICS::GUI
             // The saved game filename is included in the text to clarify for users
             // what game is being saved.
             std::string saved_game_filename = current_game_data.Filepath.filename().string();
-            std::string pause_menu_text = "[ENTER] - Save " + saved_game_filename + "\n[T] - Title\n\n[ESC] - Cancel";
+            std::pmr::string pause_menu_text("[ENTER] - Save ", &frame_arena);
+            pause_menu_text += saved_game_filename;
+            pause_menu_text += "\n[T] - Title\n\n[ESC] - Cancel";
             renderer.RenderCenteredText(
                 pause_menu_text,
                 RESOURCES::AssetId::FONT_TEXTURE,
@@ -8,9 +8,11 @@
 #include "Graphics/Renderer.h"
 #include "Hardware/GamingHardware.h"
 #include "Inventory/InventoryGui.h"
+#include "Memory/FrameArena.h"
 #include "Objects/Food.h"
 #include "States/GameState.h"
 #include "States/SavedGameData.h"
+#include "States/SavedGameWriter.h"
 
 namespace GRAPHICS::GUI
 {
@@ -28,11 +30,13 @@ namespace GRAPHICS::GUI
         // OTHER PUBLIC METHODS.
         std::tuple<STATES::GameState, OBJECTS::Food::TypeId> Update(
             const STATES::SavedGameData& current_game_data,
-            const HARDWARE::GamingHardware& gaming_hardware);
+            const HARDWARE::GamingHardware& gaming_hardware,
+            STATES::SavedGameWriter& saved_game_writer);
 
         void Render(
             const STATES::SavedGameData& current_game_data,
-            GRAPHICS::Renderer& renderer);
+            GRAPHICS::Renderer& renderer,
+            MEMORY::FrameArena& frame_arena);
 
         bool ModalComponentDisplayed() const;
 
@@ -3,6 +3,7 @@
 #include <memory>
 #include "Graphics/Texture.h"
 #include "Graphics/Gui/Glyph.h"
+#include "Graphics/Gui/GlyphMetrics.h"
 
 /// Holds code related to graphical user interfaces.
 namespace GRAPHICS::GUI
@@ -14,7 +15,8 @@ namespace GRAPHICS::GUI
     /// A font's bitmap is expected to have 16 rows and 16 columns of glyphs.
     /// The top-left glyph should be for ASCII character 0, and the bottom-right
     /// glyph should be for ASCII character 255.  Each glyph must be represented
-    /// in a 16x16 pixel rectangle.
+    /// in a 16x16 pixel rectangle.  Metrics for each glyph are generated ahead of time
+    /// by the font_metric_builder, which also packs all font bitmaps into a single texture.
     class Font
     {
     public:
@@ -29,7 +31,7 @@ namespace GRAPHICS::GUI
         static constexpr unsigned int FONT_BITMAP_DIMENSION_IN_PIXELS = GLYPH_MAX_DIMENSION_IN_PIXELS * GLYPH_MAX_COUNT_PER_ROW_OR_COLUMN;
 
         // CONSTRUCTION.
-        static std::shared_ptr<Font> LoadSystemDefaultFont(const int font_id);
+        static std::shared_ptr<Font> Create(const FontGlyphMetrics& glyph_metrics, const std::shared_ptr<GRAPHICS::Texture>& texture);
 
         // MEMBER VARIABLES.
         /// The glyphs as stored by regular unsigned ASCII character value.
@@ -0,0 +1,530 @@
+#pragma once
+
+// This file is generated by the font_metric_builder and should not be edited directly.
+
+#include "Graphics/Gui/GlyphMetrics.h"
+
+namespace GRAPHICS::GUI
+{
+    /// Glyph metrics for the main font texture, positioned within the packed font texture.
+    inline constexpr FontGlyphMetrics MAIN_FONT_GLYPH_METRICS =
+    {
+        GlyphMetrics { .LeftInPixels = 0, .TopInPixels = 0, .WidthInPixels = 16, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 17, .TopInPixels = 0, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 33, .TopInPixels = 0, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 49, .TopInPixels = 0, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 65, .TopInPixels = 0, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 81, .TopInPixels = 0, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 97, .TopInPixels = 0, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 114, .TopInPixels = 0, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 132, .TopInPixels = 0, .WidthInPixels = 6, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 144, .TopInPixels = 0, .WidthInPixels = 16, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 160, .TopInPixels = 0, .WidthInPixels = 16, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 176, .TopInPixels = 0, .WidthInPixels = 16, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 192, .TopInPixels = 0, .WidthInPixels = 16, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 208, .TopInPixels = 0, .WidthInPixels = 16, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 225, .TopInPixels = 0, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 241, .TopInPixels = 0, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 1, .TopInPixels = 16, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 17, .TopInPixels = 16, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 33, .TopInPixels = 16, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 49, .TopInPixels = 16, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 65, .TopInPixels = 16, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 81, .TopInPixels = 16, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 97, .TopInPixels = 16, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 113, .TopInPixels = 16, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 129, .TopInPixels = 16, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 145, .TopInPixels = 16, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 161, .TopInPixels = 16, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 177, .TopInPixels = 16, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 193, .TopInPixels = 16, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 209, .TopInPixels = 16, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 225, .TopInPixels = 16, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 241, .TopInPixels = 16, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 0, .TopInPixels = 32, .WidthInPixels = 16, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 22, .TopInPixels = 32, .WidthInPixels = 4, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 36, .TopInPixels = 32, .WidthInPixels = 8, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 51, .TopInPixels = 32, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 67, .TopInPixels = 32, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 82, .TopInPixels = 32, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 99, .TopInPixels = 32, .WidthInPixels = 11, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 119, .TopInPixels = 32, .WidthInPixels = 2, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 133, .TopInPixels = 32, .WidthInPixels = 4, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 151, .TopInPixels = 32, .WidthInPixels = 4, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 164, .TopInPixels = 32, .WidthInPixels = 8, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 181, .TopInPixels = 32, .WidthInPixels = 6, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 199, .TopInPixels = 32, .WidthInPixels = 2, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 213, .TopInPixels = 32, .WidthInPixels = 6, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 231, .TopInPixels = 32, .WidthInPixels = 2, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 245, .TopInPixels = 32, .WidthInPixels = 6, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 4, .TopInPixels = 48, .WidthInPixels = 8, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 21, .TopInPixels = 48, .WidthInPixels = 6, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 35, .TopInPixels = 48, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 51, .TopInPixels = 48, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 67, .TopInPixels = 48, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 83, .TopInPixels = 48, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 99, .TopInPixels = 48, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 115, .TopInPixels = 48, .WidthInPixels = 9, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 131, .TopInPixels = 48, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 147, .TopInPixels = 48, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 167, .TopInPixels = 48, .WidthInPixels = 2, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 183, .TopInPixels = 48, .WidthInPixels = 2, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 195, .TopInPixels = 48, .WidthInPixels = 7, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 213, .TopInPixels = 48, .WidthInPixels = 6, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 230, .TopInPixels = 48, .WidthInPixels = 7, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 244, .TopInPixels = 48, .WidthInPixels = 8, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 1, .TopInPixels = 64, .WidthInPixels = 13, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 18, .TopInPixels = 64, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 35, .TopInPixels = 64, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 51, .TopInPixels = 64, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 67, .TopInPixels = 64, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 83, .TopInPixels = 64, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 99, .TopInPixels = 64, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 115, .TopInPixels = 64, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 131, .TopInPixels = 64, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 149, .TopInPixels = 64, .WidthInPixels = 6, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 163, .TopInPixels = 64, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 179, .TopInPixels = 64, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 195, .TopInPixels = 64, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 210, .TopInPixels = 64, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 226, .TopInPixels = 64, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 243, .TopInPixels = 64, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 3, .TopInPixels = 80, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 19, .TopInPixels = 80, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 35, .TopInPixels = 80, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 51, .TopInPixels = 80, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 67, .TopInPixels = 80, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 83, .TopInPixels = 80, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 99, .TopInPixels = 80, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 114, .TopInPixels = 80, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 131, .TopInPixels = 80, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 147, .TopInPixels = 80, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 163, .TopInPixels = 80, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 182, .TopInPixels = 80, .WidthInPixels = 4, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 197, .TopInPixels = 80, .WidthInPixels = 6, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 214, .TopInPixels = 80, .WidthInPixels = 4, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 226, .TopInPixels = 80, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 243, .TopInPixels = 80, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 3, .TopInPixels = 96, .WidthInPixels = 3, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 19, .TopInPixels = 96, .WidthInPixels = 9, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 35, .TopInPixels = 96, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 51, .TopInPixels = 96, .WidthInPixels = 9, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 67, .TopInPixels = 96, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 83, .TopInPixels = 96, .WidthInPixels = 9, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 100, .TopInPixels = 96, .WidthInPixels = 8, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 116, .TopInPixels = 96, .WidthInPixels = 9, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 132, .TopInPixels = 96, .WidthInPixels = 8, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 151, .TopInPixels = 96, .WidthInPixels = 2, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 165, .TopInPixels = 96, .WidthInPixels = 5, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 180, .TopInPixels = 96, .WidthInPixels = 8, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 198, .TopInPixels = 96, .WidthInPixels = 5, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 211, .TopInPixels = 96, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 228, .TopInPixels = 96, .WidthInPixels = 7, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 243, .TopInPixels = 96, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 3, .TopInPixels = 112, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 19, .TopInPixels = 112, .WidthInPixels = 11, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 36, .TopInPixels = 112, .WidthInPixels = 8, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 52, .TopInPixels = 112, .WidthInPixels = 9, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 68, .TopInPixels = 112, .WidthInPixels = 7, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 84, .TopInPixels = 112, .WidthInPixels = 8, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 100, .TopInPixels = 112, .WidthInPixels = 8, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 114, .TopInPixels = 112, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 131, .TopInPixels = 112, .WidthInPixels = 9, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 147, .TopInPixels = 112, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 165, .TopInPixels = 112, .WidthInPixels = 7, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 181, .TopInPixels = 112, .WidthInPixels = 5, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 199, .TopInPixels = 112, .WidthInPixels = 2, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 214, .TopInPixels = 112, .WidthInPixels = 5, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 228, .TopInPixels = 112, .WidthInPixels = 8, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 241, .TopInPixels = 112, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 1, .TopInPixels = 128, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 17, .TopInPixels = 128, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 33, .TopInPixels = 128, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 49, .TopInPixels = 128, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 65, .TopInPixels = 128, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 81, .TopInPixels = 128, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 97, .TopInPixels = 128, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 113, .TopInPixels = 128, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 129, .TopInPixels = 128, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 145, .TopInPixels = 128, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 161, .TopInPixels = 128, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 177, .TopInPixels = 128, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 193, .TopInPixels = 128, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 209, .TopInPixels = 128, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 225, .TopInPixels = 128, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 241, .TopInPixels = 128, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 1, .TopInPixels = 144, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 17, .TopInPixels = 144, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 33, .TopInPixels = 144, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 49, .TopInPixels = 144, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 65, .TopInPixels = 144, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 81, .TopInPixels = 144, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 97, .TopInPixels = 144, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 113, .TopInPixels = 144, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 129, .TopInPixels = 144, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 145, .TopInPixels = 144, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 161, .TopInPixels = 144, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 177, .TopInPixels = 144, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 193, .TopInPixels = 144, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 209, .TopInPixels = 144, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 225, .TopInPixels = 144, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 241, .TopInPixels = 144, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 1, .TopInPixels = 160, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 17, .TopInPixels = 160, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 33, .TopInPixels = 160, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 49, .TopInPixels = 160, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 65, .TopInPixels = 160, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 81, .TopInPixels = 160, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 97, .TopInPixels = 160, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 113, .TopInPixels = 160, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 129, .TopInPixels = 160, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 145, .TopInPixels = 160, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 161, .TopInPixels = 160, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 177, .TopInPixels = 160, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 193, .TopInPixels = 160, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 209, .TopInPixels = 160, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 225, .TopInPixels = 160, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 241, .TopInPixels = 160, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 1, .TopInPixels = 176, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 17, .TopInPixels = 176, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 33, .TopInPixels = 176, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 49, .TopInPixels = 176, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 65, .TopInPixels = 176, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 81, .TopInPixels = 176, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 97, .TopInPixels = 176, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 113, .TopInPixels = 176, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 129, .TopInPixels = 176, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 145, .TopInPixels = 176, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 161, .TopInPixels = 176, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 177, .TopInPixels = 176, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 193, .TopInPixels = 176, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 209, .TopInPixels = 176, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 225, .TopInPixels = 176, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 241, .TopInPixels = 176, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 1, .TopInPixels = 192, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 17, .TopInPixels = 192, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 33, .TopInPixels = 192, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 49, .TopInPixels = 192, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 65, .TopInPixels = 192, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 81, .TopInPixels = 192, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 97, .TopInPixels = 192, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 113, .TopInPixels = 192, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 129, .TopInPixels = 192, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 145, .TopInPixels = 192, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 161, .TopInPixels = 192, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 177, .TopInPixels = 192, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 193, .TopInPixels = 192, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 209, .TopInPixels = 192, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 225, .TopInPixels = 192, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 241, .TopInPixels = 192, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 1, .TopInPixels = 208, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 17, .TopInPixels = 208, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 33, .TopInPixels = 208, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 49, .TopInPixels = 208, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 65, .TopInPixels = 208, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 81, .TopInPixels = 208, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 97, .TopInPixels = 208, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 113, .TopInPixels = 208, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 129, .TopInPixels = 208, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 145, .TopInPixels = 208, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 161, .TopInPixels = 208, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 177, .TopInPixels = 208, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 193, .TopInPixels = 208, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 209, .TopInPixels = 208, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 225, .TopInPixels = 208, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 241, .TopInPixels = 208, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 1, .TopInPixels = 224, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 17, .TopInPixels = 224, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 33, .TopInPixels = 224, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 49, .TopInPixels = 224, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 65, .TopInPixels = 224, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 81, .TopInPixels = 224, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 97, .TopInPixels = 224, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 113, .TopInPixels = 224, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 129, .TopInPixels = 224, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 145, .TopInPixels = 224, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 161, .TopInPixels = 224, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 177, .TopInPixels = 224, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 193, .TopInPixels = 224, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 209, .TopInPixels = 224, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 225, .TopInPixels = 224, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 241, .TopInPixels = 224, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 1, .TopInPixels = 240, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 17, .TopInPixels = 240, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 33, .TopInPixels = 240, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 49, .TopInPixels = 240, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 65, .TopInPixels = 240, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 81, .TopInPixels = 240, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 97, .TopInPixels = 240, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 113, .TopInPixels = 240, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 129, .TopInPixels = 240, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 145, .TopInPixels = 240, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 161, .TopInPixels = 240, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 177, .TopInPixels = 240, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 193, .TopInPixels = 240, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 209, .TopInPixels = 240, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 225, .TopInPixels = 240, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 241, .TopInPixels = 240, .WidthInPixels = 12, .HeightInPixels = 16 },
+    };
+
+    /// Glyph metrics for the serif font texture, positioned within the packed font texture.
+    inline constexpr FontGlyphMetrics SERIF_FONT_GLYPH_METRICS =
+    {
+        GlyphMetrics { .LeftInPixels = 0, .TopInPixels = 256, .WidthInPixels = 16, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 17, .TopInPixels = 256, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 33, .TopInPixels = 256, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 49, .TopInPixels = 256, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 65, .TopInPixels = 256, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 81, .TopInPixels = 256, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 97, .TopInPixels = 256, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 114, .TopInPixels = 256, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 132, .TopInPixels = 256, .WidthInPixels = 6, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 144, .TopInPixels = 256, .WidthInPixels = 16, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 160, .TopInPixels = 256, .WidthInPixels = 16, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 176, .TopInPixels = 256, .WidthInPixels = 16, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 192, .TopInPixels = 256, .WidthInPixels = 16, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 208, .TopInPixels = 256, .WidthInPixels = 16, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 225, .TopInPixels = 256, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 241, .TopInPixels = 256, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 1, .TopInPixels = 272, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 17, .TopInPixels = 272, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 33, .TopInPixels = 272, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 49, .TopInPixels = 272, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 65, .TopInPixels = 272, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 81, .TopInPixels = 272, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 97, .TopInPixels = 272, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 113, .TopInPixels = 272, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 129, .TopInPixels = 272, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 145, .TopInPixels = 272, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 161, .TopInPixels = 272, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 177, .TopInPixels = 272, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 193, .TopInPixels = 272, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 209, .TopInPixels = 272, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 225, .TopInPixels = 272, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 241, .TopInPixels = 272, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 0, .TopInPixels = 288, .WidthInPixels = 16, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 22, .TopInPixels = 288, .WidthInPixels = 4, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 36, .TopInPixels = 288, .WidthInPixels = 8, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 51, .TopInPixels = 288, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 67, .TopInPixels = 288, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 82, .TopInPixels = 288, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 99, .TopInPixels = 288, .WidthInPixels = 11, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 119, .TopInPixels = 288, .WidthInPixels = 2, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 133, .TopInPixels = 288, .WidthInPixels = 4, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 151, .TopInPixels = 288, .WidthInPixels = 4, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 164, .TopInPixels = 288, .WidthInPixels = 8, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 181, .TopInPixels = 288, .WidthInPixels = 6, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 199, .TopInPixels = 288, .WidthInPixels = 2, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 213, .TopInPixels = 288, .WidthInPixels = 6, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 231, .TopInPixels = 288, .WidthInPixels = 2, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 245, .TopInPixels = 288, .WidthInPixels = 6, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 4, .TopInPixels = 304, .WidthInPixels = 8, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 21, .TopInPixels = 304, .WidthInPixels = 6, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 35, .TopInPixels = 304, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 51, .TopInPixels = 304, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 67, .TopInPixels = 304, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 83, .TopInPixels = 304, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 99, .TopInPixels = 304, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 115, .TopInPixels = 304, .WidthInPixels = 9, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 131, .TopInPixels = 304, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 147, .TopInPixels = 304, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 167, .TopInPixels = 304, .WidthInPixels = 2, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 183, .TopInPixels = 304, .WidthInPixels = 2, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 195, .TopInPixels = 304, .WidthInPixels = 7, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 213, .TopInPixels = 304, .WidthInPixels = 6, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 230, .TopInPixels = 304, .WidthInPixels = 7, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 244, .TopInPixels = 304, .WidthInPixels = 8, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 1, .TopInPixels = 320, .WidthInPixels = 13, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 17, .TopInPixels = 320, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 34, .TopInPixels = 320, .WidthInPixels = 11, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 51, .TopInPixels = 320, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 66, .TopInPixels = 320, .WidthInPixels = 11, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 82, .TopInPixels = 320, .WidthInPixels = 11, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 98, .TopInPixels = 320, .WidthInPixels = 11, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 115, .TopInPixels = 320, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 130, .TopInPixels = 320, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 148, .TopInPixels = 320, .WidthInPixels = 8, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 163, .TopInPixels = 320, .WidthInPixels = 11, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 178, .TopInPixels = 320, .WidthInPixels = 11, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 194, .TopInPixels = 320, .WidthInPixels = 11, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 209, .TopInPixels = 320, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 225, .TopInPixels = 320, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 243, .TopInPixels = 320, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 2, .TopInPixels = 336, .WidthInPixels = 11, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 19, .TopInPixels = 336, .WidthInPixels = 11, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 34, .TopInPixels = 336, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 51, .TopInPixels = 336, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 67, .TopInPixels = 336, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 82, .TopInPixels = 336, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 98, .TopInPixels = 336, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 113, .TopInPixels = 336, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 130, .TopInPixels = 336, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 146, .TopInPixels = 336, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 163, .TopInPixels = 336, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 182, .TopInPixels = 336, .WidthInPixels = 4, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 197, .TopInPixels = 336, .WidthInPixels = 6, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 214, .TopInPixels = 336, .WidthInPixels = 4, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 226, .TopInPixels = 336, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 243, .TopInPixels = 336, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 3, .TopInPixels = 352, .WidthInPixels = 3, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 19, .TopInPixels = 352, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 34, .TopInPixels = 352, .WidthInPixels = 11, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 51, .TopInPixels = 352, .WidthInPixels = 9, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 67, .TopInPixels = 352, .WidthInPixels = 11, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 83, .TopInPixels = 352, .WidthInPixels = 9, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 100, .TopInPixels = 352, .WidthInPixels = 8, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 116, .TopInPixels = 352, .WidthInPixels = 9, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 131, .TopInPixels = 352, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 150, .TopInPixels = 352, .WidthInPixels = 4, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 165, .TopInPixels = 352, .WidthInPixels = 5, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 179, .TopInPixels = 352, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 198, .TopInPixels = 352, .WidthInPixels = 4, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 209, .TopInPixels = 352, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 227, .TopInPixels = 352, .WidthInPixels = 9, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 243, .TopInPixels = 352, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 2, .TopInPixels = 368, .WidthInPixels = 11, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 19, .TopInPixels = 368, .WidthInPixels = 11, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 35, .TopInPixels = 368, .WidthInPixels = 9, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 52, .TopInPixels = 368, .WidthInPixels = 9, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 68, .TopInPixels = 368, .WidthInPixels = 7, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 83, .TopInPixels = 368, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 99, .TopInPixels = 368, .WidthInPixels = 10, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 113, .TopInPixels = 368, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 130, .TopInPixels = 368, .WidthInPixels = 11, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 146, .TopInPixels = 368, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 165, .TopInPixels = 368, .WidthInPixels = 7, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 181, .TopInPixels = 368, .WidthInPixels = 5, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 199, .TopInPixels = 368, .WidthInPixels = 2, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 214, .TopInPixels = 368, .WidthInPixels = 5, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 228, .TopInPixels = 368, .WidthInPixels = 8, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 241, .TopInPixels = 368, .WidthInPixels = 14, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 1, .TopInPixels = 384, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 17, .TopInPixels = 384, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 33, .TopInPixels = 384, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 49, .TopInPixels = 384, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 65, .TopInPixels = 384, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 81, .TopInPixels = 384, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 97, .TopInPixels = 384, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 113, .TopInPixels = 384, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 129, .TopInPixels = 384, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 145, .TopInPixels = 384, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 161, .TopInPixels = 384, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 177, .TopInPixels = 384, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 193, .TopInPixels = 384, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 209, .TopInPixels = 384, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 225, .TopInPixels = 384, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 241, .TopInPixels = 384, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 1, .TopInPixels = 400, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 17, .TopInPixels = 400, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 33, .TopInPixels = 400, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 49, .TopInPixels = 400, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 65, .TopInPixels = 400, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 81, .TopInPixels = 400, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 97, .TopInPixels = 400, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 113, .TopInPixels = 400, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 129, .TopInPixels = 400, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 145, .TopInPixels = 400, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 161, .TopInPixels = 400, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 177, .TopInPixels = 400, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 193, .TopInPixels = 400, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 209, .TopInPixels = 400, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 225, .TopInPixels = 400, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 241, .TopInPixels = 400, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 1, .TopInPixels = 416, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 17, .TopInPixels = 416, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 33, .TopInPixels = 416, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 49, .TopInPixels = 416, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 65, .TopInPixels = 416, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 81, .TopInPixels = 416, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 97, .TopInPixels = 416, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 113, .TopInPixels = 416, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 129, .TopInPixels = 416, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 145, .TopInPixels = 416, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 161, .TopInPixels = 416, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 177, .TopInPixels = 416, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 193, .TopInPixels = 416, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 209, .TopInPixels = 416, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 225, .TopInPixels = 416, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 241, .TopInPixels = 416, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 1, .TopInPixels = 432, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 17, .TopInPixels = 432, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 33, .TopInPixels = 432, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 49, .TopInPixels = 432, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 65, .TopInPixels = 432, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 81, .TopInPixels = 432, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 97, .TopInPixels = 432, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 113, .TopInPixels = 432, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 129, .TopInPixels = 432, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 145, .TopInPixels = 432, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 161, .TopInPixels = 432, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 177, .TopInPixels = 432, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 193, .TopInPixels = 432, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 209, .TopInPixels = 432, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 225, .TopInPixels = 432, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 241, .TopInPixels = 432, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 1, .TopInPixels = 448, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 17, .TopInPixels = 448, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 33, .TopInPixels = 448, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 49, .TopInPixels = 448, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 65, .TopInPixels = 448, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 81, .TopInPixels = 448, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 97, .TopInPixels = 448, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 113, .TopInPixels = 448, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 129, .TopInPixels = 448, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 145, .TopInPixels = 448, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 161, .TopInPixels = 448, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 177, .TopInPixels = 448, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 193, .TopInPixels = 448, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 209, .TopInPixels = 448, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 225, .TopInPixels = 448, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 241, .TopInPixels = 448, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 1, .TopInPixels = 464, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 17, .TopInPixels = 464, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 33, .TopInPixels = 464, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 49, .TopInPixels = 464, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 65, .TopInPixels = 464, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 81, .TopInPixels = 464, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 97, .TopInPixels = 464, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 113, .TopInPixels = 464, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 129, .TopInPixels = 464, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 145, .TopInPixels = 464, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 161, .TopInPixels = 464, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 177, .TopInPixels = 464, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 193, .TopInPixels = 464, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 209, .TopInPixels = 464, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 225, .TopInPixels = 464, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 241, .TopInPixels = 464, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 1, .TopInPixels = 480, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 17, .TopInPixels = 480, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 33, .TopInPixels = 480, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 49, .TopInPixels = 480, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 65, .TopInPixels = 480, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 81, .TopInPixels = 480, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 97, .TopInPixels = 480, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 113, .TopInPixels = 480, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 129, .TopInPixels = 480, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 145, .TopInPixels = 480, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 161, .TopInPixels = 480, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 177, .TopInPixels = 480, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 193, .TopInPixels = 480, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 209, .TopInPixels = 480, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 225, .TopInPixels = 480, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 241, .TopInPixels = 480, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 1, .TopInPixels = 496, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 17, .TopInPixels = 496, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 33, .TopInPixels = 496, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 49, .TopInPixels = 496, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 65, .TopInPixels = 496, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 81, .TopInPixels = 496, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 97, .TopInPixels = 496, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 113, .TopInPixels = 496, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 129, .TopInPixels = 496, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 145, .TopInPixels = 496, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 161, .TopInPixels = 496, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 177, .TopInPixels = 496, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 193, .TopInPixels = 496, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 209, .TopInPixels = 496, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 225, .TopInPixels = 496, .WidthInPixels = 12, .HeightInPixels = 16 },
+        GlyphMetrics { .LeftInPixels = 241, .TopInPixels = 496, .WidthInPixels = 12, .HeightInPixels = 16 },
+    };
+}
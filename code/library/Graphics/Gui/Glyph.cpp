@@ -1,1293 +0,0 @@
-#include "Graphics/Gui/Glyph.h"
-
-namespace GRAPHICS
-{
-namespace GUI
-{
-#if 0
-    const std::array<MATH::FloatRectangle, Glyph::TOTAL_COUNT> Glyph::TEXTURE_SUB_RECTANGLES = 
-    {
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            0.0f,
-            0.0f,
-            16.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            17.0f,
-            0.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            33.0f,
-            0.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            49.0f,
-            0.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            65.0f,
-            0.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            81.0f,
-            0.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            97.0f,
-            0.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            114.0f,
-            0.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            132.0f,
-            0.0f,
-            6.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            144.0f,
-            0.0f,
-            16.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            160.0f,
-            0.0f,
-            16.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            176.0f,
-            0.0f,
-            16.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            192.0f,
-            0.0f,
-            16.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            208.0f,
-            0.0f,
-            16.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            225.0f,
-            0.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            241.0f,
-            0.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            1.0f,
-            16.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            17.0f,
-            16.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            33.0f,
-            16.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            49.0f,
-            16.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            65.0f,
-            16.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            81.0f,
-            16.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            97.0f,
-            16.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            113.0f,
-            16.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            129.0f,
-            16.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            145.0f,
-            16.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            161.0f,
-            16.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            177.0f,
-            16.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            193.0f,
-            16.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            209.0f,
-            16.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            225.0f,
-            16.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            241.0f,
-            16.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            0.0f,
-            32.0f,
-            16.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            22.0f,
-            32.0f,
-            4.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            36.0f,
-            32.0f,
-            8.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            51.0f,
-            32.0f,
-            10.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            67.0f,
-            32.0f,
-            10.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            82.0f,
-            32.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            99.0f,
-            32.0f,
-            11.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            119.0f,
-            32.0f,
-            2.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            133.0f,
-            32.0f,
-            4.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            151.0f,
-            32.0f,
-            4.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            164.0f,
-            32.0f,
-            8.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            181.0f,
-            32.0f,
-            6.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            199.0f,
-            32.0f,
-            2.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            213.0f,
-            32.0f,
-            6.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            231.0f,
-            32.0f,
-            2.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            245.0f,
-            32.0f,
-            6.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            4.0f,
-            48.0f,
-            8.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            21.0f,
-            48.0f,
-            6.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            35.0f,
-            48.0f,
-            10.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            51.0f,
-            48.0f,
-            10.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            67.0f,
-            48.0f,
-            10.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            83.0f,
-            48.0f,
-            10.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            99.0f,
-            48.0f,
-            10.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            115.0f,
-            48.0f,
-            9.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            131.0f,
-            48.0f,
-            10.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            147.0f,
-            48.0f,
-            10.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            167.0f,
-            48.0f,
-            2.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            183.0f,
-            48.0f,
-            2.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            195.0f,
-            48.0f,
-            7.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            213.0f,
-            48.0f,
-            6.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            230.0f,
-            48.0f,
-            7.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            244.0f,
-            48.0f,
-            8.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            1.0f,
-            64.0f,
-            13.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            17.0f,
-            64.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            34.0f,
-            64.0f,
-            11.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            51.0f,
-            64.0f,
-            10.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            66.0f,
-            64.0f,
-            11.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            82.0f,
-            64.0f,
-            11.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            98.0f,
-            64.0f,
-            11.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            115.0f,
-            64.0f,
-            10.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            130.0f,
-            64.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            148.0f,
-            64.0f,
-            8.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            163.0f,
-            64.0f,
-            11.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            178.0f,
-            64.0f,
-            11.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            194.0f,
-            64.0f,
-            11.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            209.0f,
-            64.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            225.0f,
-            64.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            243.0f,
-            64.0f,
-            10.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            2.0f,
-            80.0f,
-            11.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            19.0f,
-            80.0f,
-            11.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            34.0f,
-            80.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            51.0f,
-            80.0f,
-            10.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            67.0f,
-            80.0f,
-            10.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            82.0f,
-            80.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            98.0f,
-            80.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            113.0f,
-            80.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            130.0f,
-            80.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            146.0f,
-            80.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            163.0f,
-            80.0f,
-            10.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            182.0f,
-            80.0f,
-            4.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            197.0f,
-            80.0f,
-            6.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            214.0f,
-            80.0f,
-            4.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            226.0f,
-            80.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            243.0f,
-            80.0f,
-            10.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            3.0f,
-            96.0f,
-            3.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            19.0f,
-            96.0f,
-            10.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            34.0f,
-            96.0f,
-            11.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            51.0f,
-            96.0f,
-            9.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            67.0f,
-            96.0f,
-            11.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            83.0f,
-            96.0f,
-            9.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            100.0f,
-            96.0f,
-            8.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            116.0f,
-            96.0f,
-            9.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            131.0f,
-            96.0f,
-            10.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            150.0f,
-            96.0f,
-            4.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            165.0f,
-            96.0f,
-            5.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            179.0f,
-            96.0f,
-            10.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            198.0f,
-            96.0f,
-            4.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            209.0f,
-            96.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            227.0f,
-            96.0f,
-            9.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            243.0f,
-            96.0f,
-            10.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            2.0f,
-            112.0f,
-            11.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            19.0f,
-            112.0f,
-            11.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            35.0f,
-            112.0f,
-            9.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            52.0f,
-            112.0f,
-            9.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            68.0f,
-            112.0f,
-            7.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            83.0f,
-            112.0f,
-            10.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            99.0f,
-            112.0f,
-            10.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            113.0f,
-            112.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            130.0f,
-            112.0f,
-            11.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            146.0f,
-            112.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            165.0f,
-            112.0f,
-            7.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            181.0f,
-            112.0f,
-            5.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            199.0f,
-            112.0f,
-            2.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            214.0f,
-            112.0f,
-            5.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            228.0f,
-            112.0f,
-            8.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            241.0f,
-            112.0f,
-            14.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            1.0f,
-            128.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            17.0f,
-            128.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            33.0f,
-            128.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            49.0f,
-            128.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            65.0f,
-            128.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            81.0f,
-            128.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            97.0f,
-            128.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            113.0f,
-            128.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            129.0f,
-            128.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            145.0f,
-            128.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            161.0f,
-            128.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            177.0f,
-            128.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            193.0f,
-            128.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            209.0f,
-            128.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            225.0f,
-            128.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            241.0f,
-            128.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            1.0f,
-            144.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            17.0f,
-            144.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            33.0f,
-            144.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            49.0f,
-            144.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            65.0f,
-            144.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            81.0f,
-            144.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            97.0f,
-            144.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            113.0f,
-            144.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            129.0f,
-            144.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            145.0f,
-            144.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            161.0f,
-            144.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            177.0f,
-            144.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            193.0f,
-            144.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            209.0f,
-            144.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            225.0f,
-            144.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            241.0f,
-            144.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            1.0f,
-            160.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            17.0f,
-            160.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            33.0f,
-            160.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            49.0f,
-            160.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            65.0f,
-            160.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            81.0f,
-            160.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            97.0f,
-            160.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            113.0f,
-            160.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            129.0f,
-            160.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            145.0f,
-            160.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            161.0f,
-            160.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            177.0f,
-            160.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            193.0f,
-            160.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            209.0f,
-            160.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            225.0f,
-            160.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            241.0f,
-            160.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            1.0f,
-            176.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            17.0f,
-            176.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            33.0f,
-            176.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            49.0f,
-            176.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            65.0f,
-            176.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            81.0f,
-            176.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            97.0f,
-            176.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            113.0f,
-            176.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            129.0f,
-            176.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            145.0f,
-            176.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            161.0f,
-            176.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            177.0f,
-            176.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            193.0f,
-            176.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            209.0f,
-            176.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            225.0f,
-            176.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            241.0f,
-            176.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            1.0f,
-            192.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            17.0f,
-            192.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            33.0f,
-            192.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            49.0f,
-            192.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            65.0f,
-            192.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            81.0f,
-            192.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            97.0f,
-            192.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            113.0f,
-            192.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            129.0f,
-            192.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            145.0f,
-            192.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            161.0f,
-            192.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            177.0f,
-            192.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            193.0f,
-            192.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            209.0f,
-            192.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            225.0f,
-            192.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            241.0f,
-            192.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            1.0f,
-            208.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            17.0f,
-            208.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            33.0f,
-            208.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            49.0f,
-            208.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            65.0f,
-            208.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            81.0f,
-            208.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            97.0f,
-            208.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            113.0f,
-            208.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            129.0f,
-            208.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            145.0f,
-            208.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            161.0f,
-            208.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            177.0f,
-            208.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            193.0f,
-            208.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            209.0f,
-            208.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            225.0f,
-            208.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            241.0f,
-            208.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            1.0f,
-            224.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            17.0f,
-            224.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            33.0f,
-            224.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            49.0f,
-            224.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            65.0f,
-            224.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            81.0f,
-            224.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            97.0f,
-            224.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            113.0f,
-            224.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            129.0f,
-            224.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            145.0f,
-            224.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            161.0f,
-            224.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            177.0f,
-            224.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            193.0f,
-            224.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            209.0f,
-            224.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            225.0f,
-            224.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            241.0f,
-            224.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            1.0f,
-            240.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            17.0f,
-            240.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            33.0f,
-            240.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            49.0f,
-            240.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            65.0f,
-            240.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            81.0f,
-            240.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            97.0f,
-            240.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            113.0f,
-            240.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            129.0f,
-            240.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            145.0f,
-            240.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            161.0f,
-            240.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            177.0f,
-            240.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            193.0f,
-            240.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            209.0f,
-            240.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            225.0f,
-            240.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-        MATH::FloatRectangle::FromLeftTopAndDimensions(
-            241.0f,
-            240.0f,
-            12.0f,
-            static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS)),
-    };
-#endif
-}
-}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <array>
+
+namespace GRAPHICS::GUI
+{
+    /// The location and size of a single glyph within a font texture, in pixels.
+    /// Unlike a MATH::FloatRectangle, this is usable in constant expressions,
+    /// allowing font metrics to be generated ahead of time (see font_metric_builder)
+    /// and text to be measured at compile time.
+    struct GlyphMetrics
+    {
+        // CONSTANTS.
+        /// The total number of glyphs (characters) in a font.
+        static constexpr unsigned int CHARACTER_COUNT = 256;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The left position of the glyph within its texture.
+        unsigned int LeftInPixels = 0;
+        /// The top position of the glyph within its texture.
+        unsigned int TopInPixels = 0;
+        /// The width of the glyph.
+        unsigned int WidthInPixels = 0;
+        /// The height of the glyph.
+        unsigned int HeightInPixels = 0;
+    };
+
+    /// Metrics for all glyphs in a font, indexed by unsigned character value.
+    using FontGlyphMetrics = std::array<GlyphMetrics, GlyphMetrics::CHARACTER_COUNT>;
+}
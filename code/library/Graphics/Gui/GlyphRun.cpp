@@ -0,0 +1,137 @@
+#include <algorithm>
+#include "Graphics/Gui/GlyphRun.h"
+#include "Graphics/Gui/Text.h"
+
+namespace GRAPHICS::GUI
+{
+    /// Lays out the provided text into quads if the text or its style differs from
+    /// what was previously laid out.  If only the color differs, the existing quads
+    /// are simply recolored.
+    /// @param[in]  text - The text to lay out.
+    /// @param[in]  font - The font to use for the text.
+    /// @param[in]  scale_factor - The scale of the text, relative to the default size
+    ///     of the font's glyphs.  1.0f is normal scaling.
+    /// @param[in]  color - The color of the text.
+    /// @return True if the text was laid out again; false if the previous layout was reused.
+    bool GlyphRun::Layout(
+        const std::string_view text,
+        const std::shared_ptr<GRAPHICS::GUI::Font>& font,
+        const float scale_factor,
+        const GRAPHICS::Color& color)
+    {
+        // CHECK IF THE PREVIOUS LAYOUT CAN BE REUSED.
+        bool same_text = (String == text);
+        bool same_font = (Font == font);
+        bool same_scale = (ScaleFactor == scale_factor);
+        bool previous_layout_reusable = (same_text && same_font && same_scale);
+        if (previous_layout_reusable)
+        {
+            // The color isn't part of the quads' geometry, so it can be changed without a full layout.
+            Recolor(color);
+            return false;
+        }
+
+        // STORE THE NEW TEXT AND STYLE.
+        String = text;
+        Font = font;
+        ScaleFactor = scale_factor;
+        Color = color;
+        WidthInPixels = 0.0f;
+        HeightInPixels = 0.0f;
+        Vertices.clear();
+
+        // CHECK IF A FONT EXISTS.
+        if (!Font)
+        {
+            // Without a font, there are no glyphs to lay out.
+            return true;
+        }
+
+        // CREATE A QUAD FOR EACH CHARACTER OF THE TEXT.
+        Vertices.reserve(String.size() * VERTEX_COUNT_PER_CHARACTER);
+        sf::Color vertex_color(Color.Red, Color.Green, Color.Blue, Color.Alpha);
+        float current_character_left_position = 0.0f;
+        for (const char character : String)
+        {
+            // GET THE GLYPH FOR THE CURRENT CHARACTER.
+            const Glyph& glyph = Font->GlyphsByCharacter[static_cast<unsigned char>(character)];
+            float glyph_width = glyph.TextureSubRectangle.Width();
+            float glyph_height = glyph.TextureSubRectangle.Height();
+
+            // ADD THE QUAD FOR THE GLYPH.
+            // Vertices are ordered clockwise from the left-top corner, as expected for quads.
+            float scaled_glyph_width = ScaleFactor * glyph_width;
+            float scaled_glyph_height = ScaleFactor * glyph_height;
+            float current_character_right_position = current_character_left_position + scaled_glyph_width;
+            float texture_left = glyph.TextureSubRectangle.LeftTop.X;
+            float texture_top = glyph.TextureSubRectangle.LeftTop.Y;
+            float texture_right = texture_left + glyph_width;
+            float texture_bottom = texture_top + glyph_height;
+            Vertices.emplace_back(sf::Vector2f(current_character_left_position, 0.0f), vertex_color, sf::Vector2f(texture_left, texture_top));
+            Vertices.emplace_back(sf::Vector2f(current_character_right_position, 0.0f), vertex_color, sf::Vector2f(texture_right, texture_top));
+            Vertices.emplace_back(sf::Vector2f(current_character_right_position, scaled_glyph_height), vertex_color, sf::Vector2f(texture_right, texture_bottom));
+            Vertices.emplace_back(sf::Vector2f(current_character_left_position, scaled_glyph_height), vertex_color, sf::Vector2f(texture_left, texture_bottom));
+            HeightInPixels = std::max(HeightInPixels, scaled_glyph_height);
+
+            // CALCULATE THE LEFT POSITION OF THE NEXT CHARACTER.
+            current_character_left_position += Text::AdvanceWidthInPixels(*Font, character, ScaleFactor);
+        }
+        WidthInPixels = current_character_left_position;
+
+        return true;
+    }
+
+    /// Gets the number of characters in the run.
+    /// @return The number of characters in the run.
+    std::size_t GlyphRun::CharacterCount() const
+    {
+        std::size_t character_count = Vertices.size() / VERTEX_COUNT_PER_CHARACTER;
+        return character_count;
+    }
+
+    /// Clamps a character count so that a range starting at the specified character
+    /// does not extend past the end of the run.
+    /// @param[in]  first_character_index - The index of the first character in the range.
+    /// @param[in]  character_count - The requested number of characters in the range.
+    ///     May be ALL_CHARACTERS to request all characters after the first.
+    /// @return The number of characters in the range that actually exist in the run.
+    std::size_t GlyphRun::ClampCharacterCount(const std::size_t first_character_index, const std::size_t character_count) const
+    {
+        // MAKE SURE THE FIRST CHARACTER EXISTS.
+        std::size_t total_character_count = CharacterCount();
+        bool first_character_exists = (first_character_index < total_character_count);
+        if (!first_character_exists)
+        {
+            return 0;
+        }
+
+        // LIMIT THE COUNT TO THE REMAINING CHARACTERS.
+        std::size_t remaining_character_count = total_character_count - first_character_index;
+        std::size_t clamped_character_count = std::min(character_count, remaining_character_count);
+        return clamped_character_count;
+    }
+
+    /// Changes the color of all vertices in the run, if different from the current color.
+    /// @param[in]  color - The new color for the text.
+    void GlyphRun::Recolor(const GRAPHICS::Color& color)
+    {
+        // CHECK IF THE COLOR HAS CHANGED.
+        bool same_color = (
+            (Color.Red == color.Red) &&
+            (Color.Green == color.Green) &&
+            (Color.Blue == color.Blue) &&
+            (Color.Alpha == color.Alpha));
+        if (same_color)
+        {
+            return;
+        }
+
+        // UPDATE THE COLOR OF EACH VERTEX.
+        Color = color;
+        sf::Color vertex_color(Color.Red, Color.Green, Color.Blue, Color.Alpha);
+        for (sf::Vertex& vertex : Vertices)
+        {
+            vertex.color = vertex_color;
+        }
+    }
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <SFML/Graphics.hpp>
+#include "Graphics/Color.h"
+#include "Graphics/Gui/Font.h"
+
+namespace GRAPHICS::GUI
+{
+    /// A single line of text laid out as a cached list of textured quads (one per character).
+    /// Laying out text involves looking up a glyph for each character and computing positions,
+    /// which only needs to be done when the text or its style changes.  Once laid out, the
+    /// entire run can be rendered with a single draw call, and sub-ranges of characters
+    /// can be rendered (such as for text that is revealed one character at a time)
+    /// without needing to lay out the text again.
+    ///
+    /// Vertex positions are relative to the left-top of the run (0, 0), so the same run
+    /// can be rendered at any screen position.
+    class GlyphRun
+    {
+    public:
+        // CONSTANTS.
+        /// The number of vertices used for each character in the run (one quad per character).
+        static constexpr std::size_t VERTEX_COUNT_PER_CHARACTER = 4;
+        /// A character count indicating that all remaining characters in the run should be used.
+        static constexpr std::size_t ALL_CHARACTERS = std::numeric_limits<std::size_t>::max();
+
+        // LAYOUT.
+        bool Layout(
+            const std::string_view text,
+            const std::shared_ptr<Font>& font,
+            const float scale_factor,
+            const GRAPHICS::Color& color);
+
+        // CHARACTER RANGES.
+        std::size_t CharacterCount() const;
+        std::size_t ClampCharacterCount(const std::size_t first_character_index, const std::size_t character_count) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The string of characters that was laid out.
+        std::string String = "";
+        /// The font used for laying out the text.
+        std::shared_ptr<Font> Font = nullptr;
+        /// The scale of the text, relative to the default scale (its normal size of 1).
+        float ScaleFactor = 1.0f;
+        /// The color of the text.
+        GRAPHICS::Color Color = GRAPHICS::Color::BLACK;
+        /// The total width of the laid out text, in pixels.  Matches Text::Width().
+        float WidthInPixels = 0.0f;
+        /// The height of the laid out text, in pixels.
+        float HeightInPixels = 0.0f;
+        /// The vertices for the textured quads of each character, in character order.
+        std::vector<sf::Vertex> Vertices = {};
+
+    private:
+        // HELPER METHODS.
+        void Recolor(const GRAPHICS::Color& color);
+    };
+}
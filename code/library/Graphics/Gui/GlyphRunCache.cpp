@@ -0,0 +1,74 @@
+#include "Graphics/Gui/GlyphRunCache.h"
+
+namespace GRAPHICS::GUI
+{
+    /// Gets a glyph run for the specified text, laying it out only if not already cached.
+    /// @param[in]  text - The text of the glyph run.
+    /// @param[in]  font_id - The ID of the font for the text.
+    /// @param[in]  font - The font for the text.
+    /// @param[in]  scale_factor - The scale of the text, relative to the default size
+    ///     of the font's glyphs.  1.0f is normal scaling.
+    /// @param[in]  color - The color of the text.
+    /// @return The glyph run for the text.  Only valid until the end of the current frame.
+    const GlyphRun& GlyphRunCache::Get(
+        const std::string_view text,
+        const RESOURCES::AssetId font_id,
+        const std::shared_ptr<Font>& font,
+        const float scale_factor,
+        const GRAPHICS::Color& color)
+    {
+        // FIND THE CACHED GLYPH RUN.
+        // If it doesn't exist yet, an empty run will be created and laid out below.
+        TextStyle text_style(font_id, scale_factor);
+        GlyphRunsByString& glyph_runs_by_string = GlyphRunsByStyleThenString[text_style];
+        auto string_with_glyph_run = glyph_runs_by_string.find(text);
+        bool glyph_run_cached = (glyph_runs_by_string.end() != string_with_glyph_run);
+        if (!glyph_run_cached)
+        {
+            string_with_glyph_run = glyph_runs_by_string.emplace(std::string(text), CachedGlyphRun()).first;
+        }
+
+        // MAKE SURE THE GLYPH RUN IS UP-TO-DATE.
+        CachedGlyphRun& cached_glyph_run = string_with_glyph_run->second;
+        bool glyph_run_laid_out = cached_glyph_run.GlyphRun.Layout(text, font, scale_factor, color);
+        if (glyph_run_laid_out)
+        {
+            ++LayoutCount;
+        }
+        cached_glyph_run.LastUsedFrameNumber = CurrentFrameNumber;
+
+        return cached_glyph_run.GlyphRun;
+    }
+
+    /// Marks the end of a frame, evicting any glyph runs that haven't been used recently.
+    void GlyphRunCache::EndFrame()
+    {
+        // EVICT GLYPH RUNS THAT HAVEN'T BEEN USED RECENTLY.
+        for (auto& [text_style, glyph_runs_by_string] : GlyphRunsByStyleThenString)
+        {
+            std::erase_if(
+                glyph_runs_by_string,
+                [this](const auto& string_with_glyph_run)
+                {
+                    unsigned int unused_frame_count = CurrentFrameNumber - string_with_glyph_run.second.LastUsedFrameNumber;
+                    bool glyph_run_unused_for_too_long = (unused_frame_count > MAX_UNUSED_FRAME_COUNT_BEFORE_EVICTION);
+                    return glyph_run_unused_for_too_long;
+                });
+        }
+
+        // MOVE TO THE NEXT FRAME.
+        ++CurrentFrameNumber;
+    }
+
+    /// Gets the total number of glyph runs currently cached.
+    /// @return The number of cached glyph runs.
+    std::size_t GlyphRunCache::GlyphRunCount() const
+    {
+        std::size_t glyph_run_count = 0;
+        for (const auto& [text_style, glyph_runs_by_string] : GlyphRunsByStyleThenString)
+        {
+            glyph_run_count += glyph_runs_by_string.size();
+        }
+        return glyph_run_count;
+    }
+}
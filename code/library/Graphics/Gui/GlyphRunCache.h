@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include "Graphics/Color.h"
+#include "Graphics/Gui/Font.h"
+#include "Graphics/Gui/GlyphRun.h"
+#include "Resources/AssetId.h"
+
+namespace GRAPHICS::GUI
+{
+    /// A cache of laid out glyph runs so that text rendered every frame
+    /// only needs to be laid out once.  Runs that haven't been used for
+    /// a while are evicted to keep text that changes (like counters)
+    /// from growing the cache indefinitely.
+    class GlyphRunCache
+    {
+    public:
+        // CONSTANTS.
+        /// The number of frames a glyph run may go unused before being evicted from the cache.
+        /// This is long enough to keep blinking or intermittently displayed text cached.
+        static constexpr unsigned int MAX_UNUSED_FRAME_COUNT_BEFORE_EVICTION = 120;
+
+        // RETRIEVAL.
+        const GlyphRun& Get(
+            const std::string_view text,
+            const RESOURCES::AssetId font_id,
+            const std::shared_ptr<Font>& font,
+            const float scale_factor,
+            const GRAPHICS::Color& color);
+
+        // FRAME TRACKING.
+        void EndFrame();
+
+        // STATISTICS.
+        std::size_t GlyphRunCount() const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The total number of times glyph runs have been laid out (due to not being cached or changing).
+        std::size_t LayoutCount = 0;
+
+    private:
+        /// A glyph run along with when it was last used.
+        struct CachedGlyphRun
+        {
+            /// The cached glyph run.
+            GlyphRun GlyphRun = {};
+            /// The number of the frame in which the glyph run was last used.
+            unsigned int LastUsedFrameNumber = 0;
+        };
+
+        /// The style of text that, along with the string itself, identifies a glyph run.
+        using TextStyle = std::pair<RESOURCES::AssetId, float>;
+
+        /// A hash for strings that also supports views of strings, allowing
+        /// glyph runs to be looked up without needing to copy strings.
+        struct StringHash
+        {
+            /// Allows lookups with any type of string convertible to a string view.
+            using is_transparent = void;
+
+            /// Computes the hash of a string.
+            /// @param[in]  string - The string to hash.
+            /// @return The hash of the string.
+            std::size_t operator()(const std::string_view string) const
+            {
+                return std::hash<std::string_view>()(string);
+            }
+        };
+
+        /// Glyph runs mapped to the strings they were laid out for.
+        using GlyphRunsByString = std::unordered_map<std::string, CachedGlyphRun, StringHash, std::equal_to<>>;
+
+        /// The number of the current frame being rendered.
+        unsigned int CurrentFrameNumber = 0;
+        /// The cached glyph runs, organized first by style and then by string.
+        /// Splitting up the keys this way allows looking up runs without needing
+        /// to copy strings into a new key for every lookup.
+        std::map<TextStyle, GlyphRunsByString> GlyphRunsByStyleThenString = {};
+    };
+}
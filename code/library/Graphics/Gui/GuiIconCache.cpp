@@ -0,0 +1,188 @@
+#include <algorithm>
+#include <cmath>
+#include "Graphics/DirtyRegionTracker.h"
+#include "Graphics/Gui/Glyph.h"
+#include "Graphics/Gui/GuiIconCache.h"
+
+namespace GRAPHICS::GUI
+{
+    /// Creates an icon indicating that a specific key should be pressed.
+    /// @param[in]  key - The character of the key for the icon.
+    /// @param[in]  shape_type - The type of shape for the icon's background.
+    /// @param[in]  border_color - The color of the border for the icon.
+    /// @param[in]  background_color - The color for the background of the icon.
+    /// @param[in]  text_color - The color of the text for the icon.
+    /// @return The key icon.
+    GuiIcon GuiIcon::Key(
+        const char key,
+        const ShapeType shape_type,
+        const Color& border_color,
+        const Color& background_color,
+        const Color& text_color)
+    {
+        GuiIcon key_icon;
+        key_icon.Type = GuiIconType::KEY;
+        key_icon.KeyCharacter = key;
+        key_icon.Shape = shape_type;
+        key_icon.BorderColor = border_color;
+        key_icon.BackgroundColor = background_color;
+        key_icon.TextColor = text_color;
+        return key_icon;
+    }
+
+    /// Creates an icon from a region of a texture.
+    /// @param[in]  texture_id - The ID of the texture containing the icon.
+    /// @param[in]  texture_sub_rectangle - The region of the texture for the icon.
+    /// @return The texture region icon.
+    GuiIcon GuiIcon::TextureRegion(const RESOURCES::AssetId texture_id, const MATH::FloatRectangle& texture_sub_rectangle)
+    {
+        GuiIcon texture_region_icon;
+        texture_region_icon.Type = GuiIconType::TEXTURE_REGION;
+        texture_region_icon.TextureId = texture_id;
+        texture_region_icon.TextureSubRectangle = texture_sub_rectangle;
+        return texture_region_icon;
+    }
+
+    /// Creates a solid white icon.
+    /// @return The solid white icon.
+    GuiIcon GuiIcon::SolidWhite()
+    {
+        GuiIcon solid_white_icon;
+        solid_white_icon.Type = GuiIconType::SOLID_WHITE;
+        return solid_white_icon;
+    }
+
+    /// Equality operator.
+    /// @param[in]  rhs_icon - The icon on the right-hand side of the operator.
+    /// @return True if the icons appear the same; false otherwise.
+    bool GuiIcon::operator== (const GuiIcon& rhs_icon) const
+    {
+        bool icons_equal = (
+            (Type == rhs_icon.Type) &&
+            (KeyCharacter == rhs_icon.KeyCharacter) &&
+            (Shape == rhs_icon.Shape) &&
+            (BorderColor == rhs_icon.BorderColor) &&
+            (BackgroundColor == rhs_icon.BackgroundColor) &&
+            (TextColor == rhs_icon.TextColor) &&
+            (TextureId == rhs_icon.TextureId) &&
+            (TextureSubRectangle == rhs_icon.TextureSubRectangle));
+        return icons_equal;
+    }
+
+    /// Gets the dimensions of the icon, including anything (like outlines) extending beyond
+    /// the icon's normal boundaries.
+    /// @return The width and height of the icon, in whole pixels.
+    MATH::Vector2ui GuiIcon::DimensionsInPixels() const
+    {
+        switch (Type)
+        {
+            case GuiIconType::KEY:
+            {
+                // The outline extends beyond each side of the key.
+                constexpr unsigned int OUTLINE_THICKNESS_IN_PIXELS = static_cast<unsigned int>(KEY_OUTLINE_THICKNESS_IN_PIXELS);
+                return MATH::Vector2ui(
+                    Glyph::DEFAULT_WIDTH_IN_PIXELS + 2 * OUTLINE_THICKNESS_IN_PIXELS,
+                    Glyph::DEFAULT_HEIGHT_IN_PIXELS + 2 * OUTLINE_THICKNESS_IN_PIXELS);
+            }
+            case GuiIconType::TEXTURE_REGION:
+                return MATH::Vector2ui(
+                    static_cast<unsigned int>(std::ceil(TextureSubRectangle.Width())),
+                    static_cast<unsigned int>(std::ceil(TextureSubRectangle.Height())));
+            case GuiIconType::SOLID_WHITE:
+            default:
+                return MATH::Vector2ui(SOLID_WHITE_DIMENSION_IN_PIXELS, SOLID_WHITE_DIMENSION_IN_PIXELS);
+        }
+    }
+
+    /// Finds an icon within the atlas.
+    /// @param[in]  icon - The icon to find.
+    /// @return The rectangle of the icon within the atlas, if it has been added; null otherwise.
+    const MATH::FloatRectangle* GuiIconCache::Find(const GuiIcon& icon) const
+    {
+        auto icon_with_atlas_rectangle = AtlasRectanglesByIcon.find(icon);
+        bool icon_cached = (AtlasRectanglesByIcon.cend() != icon_with_atlas_rectangle);
+        if (!icon_cached)
+        {
+            return nullptr;
+        }
+
+        return &icon_with_atlas_rectangle->second;
+    }
+
+    /// Adds an icon to the atlas, reserving space for it.  The icon still needs to be rendered
+    /// into the reserved space of the atlas texture.
+    /// @param[in]  icon - The icon to add.  Should not already be in the atlas.
+    /// @return The rectangle reserved for the icon within the atlas; null if the atlas has no room.
+    const MATH::FloatRectangle* GuiIconCache::Add(const GuiIcon& icon)
+    {
+        // CHECK IF THE ICON COULD EVER FIT IN THE ATLAS.
+        // Such icons shouldn't cause any shelves to be skipped over.
+        MATH::Vector2ui icon_dimensions_in_pixels = icon.DimensionsInPixels();
+        bool icon_too_large_for_atlas = (
+            (icon_dimensions_in_pixels.X > ATLAS_DIMENSION_IN_PIXELS) ||
+            (icon_dimensions_in_pixels.Y > ATLAS_DIMENSION_IN_PIXELS));
+        if (icon_too_large_for_atlas)
+        {
+            return nullptr;
+        }
+
+        // MOVE TO A NEW SHELF IF THE ICON DOESN'T FIT IN THE CURRENT ONE.
+        unsigned int icon_right_in_pixels = CurrentShelfLeftInPixels + icon_dimensions_in_pixels.X;
+        bool icon_fits_in_current_shelf = (icon_right_in_pixels <= ATLAS_DIMENSION_IN_PIXELS);
+        if (!icon_fits_in_current_shelf)
+        {
+            CurrentShelfTopInPixels += CurrentShelfHeightInPixels + PADDING_BETWEEN_ICONS_IN_PIXELS;
+            CurrentShelfLeftInPixels = 0;
+            CurrentShelfHeightInPixels = 0;
+        }
+
+        // MAKE SURE THE ICON FITS IN THE REMAINING SPACE OF THE ATLAS.
+        bool icon_fits_in_atlas = (CurrentShelfTopInPixels + icon_dimensions_in_pixels.Y <= ATLAS_DIMENSION_IN_PIXELS);
+        if (!icon_fits_in_atlas)
+        {
+            return nullptr;
+        }
+
+        // RESERVE SPACE FOR THE ICON.
+        MATH::FloatRectangle atlas_rectangle = MATH::FloatRectangle::FromLeftTopAndDimensions(
+            static_cast<float>(CurrentShelfLeftInPixels),
+            static_cast<float>(CurrentShelfTopInPixels),
+            static_cast<float>(icon_dimensions_in_pixels.X),
+            static_cast<float>(icon_dimensions_in_pixels.Y));
+        CurrentShelfLeftInPixels += icon_dimensions_in_pixels.X + PADDING_BETWEEN_ICONS_IN_PIXELS;
+        CurrentShelfHeightInPixels = std::max(CurrentShelfHeightInPixels, icon_dimensions_in_pixels.Y);
+
+        auto icon_with_atlas_rectangle = AtlasRectanglesByIcon.emplace(icon, atlas_rectangle).first;
+        return &icon_with_atlas_rectangle->second;
+    }
+
+    /// Gets the number of icons in the atlas.
+    /// @return The number of icons in the atlas.
+    std::size_t GuiIconCache::IconCount() const
+    {
+        return AtlasRectanglesByIcon.size();
+    }
+}
+
+namespace std
+{
+    /// Computes a hash code for the GUI icon.
+    /// @param[in]  icon - The icon to hash.
+    /// @return A hash code for the icon.
+    std::size_t hash<GRAPHICS::GUI::GuiIcon>::operator()(const GRAPHICS::GUI::GuiIcon& icon) const
+    {
+        std::size_t icon_hash = 0;
+        GRAPHICS::DirtyRegionTracker::CombineHash(static_cast<int>(icon.Type), icon_hash);
+        GRAPHICS::DirtyRegionTracker::CombineHash(icon.KeyCharacter, icon_hash);
+        GRAPHICS::DirtyRegionTracker::CombineHash(static_cast<int>(icon.Shape), icon_hash);
+        GRAPHICS::DirtyRegionTracker::CombineHash(icon.BorderColor, icon_hash);
+        GRAPHICS::DirtyRegionTracker::CombineHash(icon.BackgroundColor, icon_hash);
+        GRAPHICS::DirtyRegionTracker::CombineHash(icon.TextColor, icon_hash);
+        GRAPHICS::DirtyRegionTracker::CombineHash(static_cast<int>(icon.TextureId), icon_hash);
+        GRAPHICS::DirtyRegionTracker::CombineHash(icon.TextureSubRectangle.LeftTop.X, icon_hash);
+        GRAPHICS::DirtyRegionTracker::CombineHash(icon.TextureSubRectangle.LeftTop.Y, icon_hash);
+        GRAPHICS::DirtyRegionTracker::CombineHash(icon.TextureSubRectangle.RightBottom.X, icon_hash);
+        GRAPHICS::DirtyRegionTracker::CombineHash(icon.TextureSubRectangle.RightBottom.Y, icon_hash);
+        return icon_hash;
+    }
+}
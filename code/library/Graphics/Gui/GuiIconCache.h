@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include "Graphics/Color.h"
+#include "Graphics/ShapeType.h"
+#include "Math/Rectangle.h"
+#include "Math/Vector2.h"
+#include "Resources/AssetId.h"
+
+namespace GRAPHICS::GUI
+{
+    /// The different types of GUI icons that may be cached.
+    enum class GuiIconType
+    {
+        /// An icon indicating a key that should be pressed.
+        KEY = 0,
+        /// An icon copied from a region of another texture.
+        TEXTURE_REGION,
+        /// A solid white region, which can be tinted to any color for drawing solid shapes
+        /// (like borders) using the same texture as other icons.
+        SOLID_WHITE
+    };
+
+    /// A description of a GUI icon, fully identifying how it appears.
+    /// Only fields relevant for the icon's type are used; others keep default values
+    /// so that icons can be compared and hashed the same regardless of type.
+    class GuiIcon
+    {
+    public:
+        // CONSTANTS.
+        /// The thickness of the outline around key icons.
+        static constexpr float KEY_OUTLINE_THICKNESS_IN_PIXELS = 2.0f;
+        /// The width and height of a solid white icon.  Multiple pixels are used so that
+        /// texture filtering around the center pixel never picks up neighboring icons.
+        static constexpr unsigned int SOLID_WHITE_DIMENSION_IN_PIXELS = 3;
+
+        // CONSTRUCTION.
+        static GuiIcon Key(
+            const char key,
+            const ShapeType shape_type,
+            const Color& border_color,
+            const Color& background_color,
+            const Color& text_color);
+        static GuiIcon TextureRegion(const RESOURCES::AssetId texture_id, const MATH::FloatRectangle& texture_sub_rectangle);
+        static GuiIcon SolidWhite();
+
+        // OPERATORS.
+        bool operator== (const GuiIcon& rhs_icon) const;
+
+        // DIMENSIONS.
+        MATH::Vector2ui DimensionsInPixels() const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The type of the icon.
+        GuiIconType Type = GuiIconType::SOLID_WHITE;
+        /// The character of the key for a key icon.
+        char KeyCharacter = 0;
+        /// The shape of the background of a key icon.
+        ShapeType Shape = ShapeType::RECTANGLE;
+        /// The color of the border of a key icon.
+        Color BorderColor = Color::WHITE;
+        /// The color of the background of a key icon.
+        Color BackgroundColor = Color::WHITE;
+        /// The color of the text of a key icon.
+        Color TextColor = Color::WHITE;
+        /// The ID of the texture for an icon copied from a texture region.
+        RESOURCES::AssetId TextureId = RESOURCES::AssetId::INVALID;
+        /// The region of the texture for an icon copied from a texture region.
+        MATH::FloatRectangle TextureSubRectangle = MATH::FloatRectangle();
+    };
+}
+
+namespace std
+{
+    /// A hash operation for GUI icons.
+    /// Required for use as a key in hashed containers.
+    template <>
+    struct hash<GRAPHICS::GUI::GuiIcon>
+    {
+        std::size_t operator()(const GRAPHICS::GUI::GuiIcon& icon) const;
+    };
+}
+
+namespace GRAPHICS::GUI
+{
+    /// A cache of GUI icons pre-rendered into a single texture atlas.  Icons like key icons
+    /// are otherwise built from multiple shapes and text each time they're rendered, which
+    /// happens every frame for heads-up displays.  By rendering each distinct icon into
+    /// the atlas only once, each icon can then be rendered as a single textured quad.
+    ///
+    /// This class only tracks where icons are within the atlas; the renderer owns the actual
+    /// texture and is responsible for rendering icons into it as they're added.  Icons are
+    /// packed in rows ("shelves") from left-to-right and top-to-bottom.  Once the atlas is full,
+    /// new icons can't be added and need to be rendered without the cache.
+    class GuiIconCache
+    {
+    public:
+        // CONSTANTS.
+        /// The width and height of the texture atlas, in pixels.
+        static constexpr unsigned int ATLAS_DIMENSION_IN_PIXELS = 512;
+        /// Empty space between icons in the atlas to avoid neighboring icons bleeding together.
+        static constexpr unsigned int PADDING_BETWEEN_ICONS_IN_PIXELS = 1;
+
+        // RETRIEVAL.
+        const MATH::FloatRectangle* Find(const GuiIcon& icon) const;
+        const MATH::FloatRectangle* Add(const GuiIcon& icon);
+
+        // STATISTICS.
+        std::size_t IconCount() const;
+
+    private:
+        // MEMBER VARIABLES.
+        /// The left position of the next icon to add in the current shelf of the atlas.
+        unsigned int CurrentShelfLeftInPixels = 0;
+        /// The top position of the current shelf of the atlas.
+        unsigned int CurrentShelfTopInPixels = 0;
+        /// The height of the tallest icon in the current shelf of the atlas.
+        unsigned int CurrentShelfHeightInPixels = 0;
+        /// The rectangles within the atlas for each icon that has been added.
+        std::unordered_map<GuiIcon, MATH::FloatRectangle> AtlasRectanglesByIcon = {};
+    };
+}
@@ -1,7 +1,9 @@
+#include <string>
 #include "Graphics/Gui/PreFloodHeadsUpDisplay.h"
 #include "Graphics/Renderer.h"
 #include "Graphics/Screen.h"
 #include "Graphics/Sprite.h"
+#include "Memory/AllocationTracker.h"
 #include "States/SavedGameData.h"
 
 namespace GRAPHICS::GUI
@@ -24,11 +26,16 @@ namespace GRAPHICS::GUI
     /// Updates the HUD.
     /// @param[in]  current_game_data - The game data to display in the HUD.
     /// @param[in]  gaming_hardware - The gaming hardware supplying input.
+    /// @param[in,out]  saved_game_writer - The writer for saving the game in the background.
     /// @return The state the game should be in after updating the HUD and any food type that should be dropped.
     std::tuple<STATES::GameState, OBJECTS::Food::TypeId> PreFloodHeadsUpDisplay::Update(
         const STATES::SavedGameData& current_game_data,
-        const HARDWARE::GamingHardware& gaming_hardware)
+        const HARDWARE::GamingHardware& gaming_hardware,
+        STATES::SavedGameWriter& saved_game_writer)
     {
+        // ATTRIBUTE ANY ALLOCATIONS TO THE GUI.
+        MEMORY::AllocationScope gui_allocation_scope(MEMORY::AllocationTag::GUI);
+
         OBJECTS::Food::TypeId selected_food_type_to_drop = OBJECTS::Food::NONE;
 
         // CHECK IF THE PAUSE MENU IS OPEN.
@@ -40,7 +47,7 @@ namespace GRAPHICS::GUI
             if (gaming_hardware.InputController.ButtonWasPressed(sf::Keyboard::Return))
             {
                 // SAVE THE GAME DATA.
-                current_game_data.Write(current_game_data.Filepath);
+                saved_game_writer.Save(current_game_data, STATES::SavedGameWriter::DisplayErrorIfNotSaved);
 
                 // CLOSE THE PAUSE MENU.
                 PauseMenuVisible = false;
@@ -113,11 +120,16 @@ namespace GRAPHICS::GUI
     ///     text displayed in the main text box or the inventory GUI but only other text
     ///     displayed directly by this HUD.
     /// @param[in,out]  renderer - The renderer to use for rendering.
+    /// @param[in,out]  frame_arena - The arena for any temporary memory needed only for this frame.
     void PreFloodHeadsUpDisplay::Render(
         const STATES::SavedGameData& current_game_data,
         const GRAPHICS::Color& main_text_color,
-        GRAPHICS::Renderer& renderer)
+        GRAPHICS::Renderer& renderer,
+        MEMORY::FrameArena& frame_arena)
     {
+        // ATTRIBUTE ANY ALLOCATIONS TO THE GUI.
+        MEMORY::AllocationScope gui_allocation_scope(MEMORY::AllocationTag::GUI);
+
         // RENDER COMPONENTS INDICATING HOW TO SWING THE AXE.
         // An icon is rendered to help players know which key to press.
         const char SWING_AXE_KEY = INPUT_CONTROL::InputController::PRIMARY_ACTION_KEY_TEXT;
@@ -250,7 +262,9 @@ namespace GRAPHICS::GUI
             // The saved game filename is included in the text to clarify for users
             // what game is being saved.
             std::string saved_game_filename = current_game_data.Filepath.filename().string();
-            std::string pause_menu_text = "[ENTER] - Save " + saved_game_filename + "\n[T] - Title\n\n[ESC] - Cancel";
+            std::pmr::string pause_menu_text("[ENTER] - Save ", &frame_arena);
+            pause_menu_text += saved_game_filename;
+            pause_menu_text += "\n[T] - Title\n\n[ESC] - Cancel";
             renderer.RenderCenteredText(
                 pause_menu_text,
                 RESOURCES::AssetId::FONT_TEXTURE,
@@ -10,10 +10,12 @@
 #include "Input/InputController.h"
 #include "Inventory/InventoryGui.h"
 #include "Maps/World.h"
+#include "Memory/FrameArena.h"
 #include "Objects/Food.h"
 #include "Objects/Noah.h"
 #include "States/GameState.h"
 #include "States/SavedGameData.h"
+#include "States/SavedGameWriter.h"
 
 namespace GRAPHICS::GUI
 {
@@ -33,13 +35,15 @@ namespace GRAPHICS::GUI
         // UPDATE.
         std::tuple<STATES::GameState, OBJECTS::Food::TypeId> Update(
             const STATES::SavedGameData& current_game_data,
-            const HARDWARE::GamingHardware& gaming_hardware);
+            const HARDWARE::GamingHardware& gaming_hardware,
+            STATES::SavedGameWriter& saved_game_writer);
 
         // RENDERING.
         void Render(
             const STATES::SavedGameData& current_game_data,
             const GRAPHICS::Color& main_text_color,
-            GRAPHICS::Renderer& renderer);
+            GRAPHICS::Renderer& renderer,
+            MEMORY::FrameArena& frame_arena);
 
         // OTHER METHODS.
         bool ModalComponentDisplayed() const;
@@ -4,6 +4,19 @@
 
 namespace GRAPHICS::GUI
 {
+    /// Calculates how far (in pixels) rendering a single character advances along a line of text.
+    /// @param[in]  font - The font to use for calculating the character's width.
+    /// @param[in]  character - The character to calculate the advance width of.
+    /// @param[in]  scale_factor - The scaling factor of the text.  1 is normal scaling.
+    /// @return The scaled width of the character's glyph plus spacing to the next character, in pixels.
+    float Text::AdvanceWidthInPixels(const Font& font, const char character, const float scale_factor)
+    {
+        const Glyph& glyph = font.GlyphsByCharacter[static_cast<unsigned char>(character)];
+        float glyph_width_in_pixels = glyph.TextureSubRectangle.Width();
+        float advance_width_in_pixels = AdvanceWidthInPixels(glyph_width_in_pixels, character, scale_factor);
+        return advance_width_in_pixels;
+    }
+
     /// Gets the x position of the right side of the text's bounding box.
     /// @return The right position of the text's bounding box.
     float Text::RightPosition() const
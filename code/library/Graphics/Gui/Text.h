@@ -1,8 +1,10 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include "Graphics/Color.h"
 #include "Graphics/Gui/Font.h"
+#include "Graphics/Gui/GlyphMetrics.h"
 #include "Math/Vector2.h"
 #include "Resources/AssetId.h"
 
@@ -19,6 +21,10 @@ namespace GRAPHICS::GUI
         static constexpr float HORIZONTAL_SPACING_IN_PIXELS_BETWEEN_EACH_CHARACTER = 2.0f;
 
         // DIMENSION METHODS.
+        static constexpr float AdvanceWidthInPixels(const float glyph_width_in_pixels, const char character, const float scale_factor);
+        static float AdvanceWidthInPixels(const Font& font, const char character, const float scale_factor);
+        template <typename NumericType>
+        static constexpr NumericType Width(const std::string_view text, const FontGlyphMetrics& glyph_metrics, const float scale_factor = 1.0f);
         template <typename NumericType>
         NumericType Width(const Font& font);
         template <typename NumericType>
@@ -43,6 +49,50 @@ namespace GRAPHICS::GUI
         GRAPHICS::Color Color = GRAPHICS::Color::BLACK;
     };
 
+    /// Calculates how far (in pixels) rendering a single character advances along a line of text.
+    /// @param[in]  glyph_width_in_pixels - The unscaled width of the character's glyph.
+    /// @param[in]  character - The character to calculate the advance width of.
+    /// @param[in]  scale_factor - The scaling factor of the text.  1 is normal scaling.
+    /// @return The scaled width of the character's glyph plus spacing to the next character, in pixels.
+    constexpr float Text::AdvanceWidthInPixels(const float glyph_width_in_pixels, const char character, const float scale_factor)
+    {
+        // If a space is being rendered, then the width is shortened for better readability.
+        // This isn't done for other kinds of whitespace to better preserve distance for those.
+        float glyph_default_width_in_pixels = glyph_width_in_pixels;
+        bool character_is_space = ' ' == character;
+        if (character_is_space)
+        {
+            glyph_default_width_in_pixels /= 2.0f;
+        }
+
+        float glyph_scaled_width_in_pixels = scale_factor * glyph_default_width_in_pixels;
+        float advance_width_in_pixels = glyph_scaled_width_in_pixels + HORIZONTAL_SPACING_IN_PIXELS_BETWEEN_EACH_CHARACTER;
+        return advance_width_in_pixels;
+    }
+
+    /// Calculates the width of some text, in pixels, based on pre-generated glyph metrics.
+    /// This allows measuring text at compile time, such as for string literals.
+    /// @tparam NumericType - The type of the returned value.  Will be directly casted.
+    /// @param[in]  text - The text to measure.
+    /// @param[in]  glyph_metrics - The metrics of the font to use for calculating the text's width.
+    /// @param[in]  scale_factor - The scaling factor of the text.  1 is normal scaling.
+    /// @return The width of the text, in pixels.
+    template <typename NumericType>
+    constexpr NumericType Text::Width(const std::string_view text, const FontGlyphMetrics& glyph_metrics, const float scale_factor)
+    {
+        float text_width_in_pixels = 0.0f;
+
+        // COUNT THE WIDTH OF EACH GLYPH.
+        for (const char character : text)
+        {
+            const GlyphMetrics& current_glyph_metrics = glyph_metrics[static_cast<unsigned char>(character)];
+            float glyph_width_in_pixels = static_cast<float>(current_glyph_metrics.WidthInPixels);
+            text_width_in_pixels += AdvanceWidthInPixels(glyph_width_in_pixels, character, scale_factor);
+        }
+
+        return static_cast<NumericType>(text_width_in_pixels);
+    }
+
     /// Calculates the width of some text, in pixels.
     /// @tparam NumericType - The type of the returned value.  Will be directly casted.
     /// @param[in]  font - The font to use for calculating the text's width.
@@ -55,19 +105,7 @@ namespace GRAPHICS::GUI
         // COUNT THE WIDTH OF EACH GLYPH.
         for (const char character : String)
         {
-            const Glyph& glyph = font.GlyphsByCharacter[static_cast<unsigned char>(character)];
-            float glyph_default_width_in_pixels = glyph.TextureSubRectangle.Width();
-
-            // If a space is being rendered, then the width is shortened for better readability.
-            // This isn't done for other kinds of whitespace to better preserve distance for those.
-            bool character_is_space = ' ' == character;
-            if (character_is_space)
-            {
-                glyph_default_width_in_pixels /= 2.0f;
-            }
-
-            float glyph_scaled_width_in_pixels = ScaleFactor * glyph_default_width_in_pixels;
-            text_width_in_pixels += glyph_scaled_width_in_pixels + HORIZONTAL_SPACING_IN_PIXELS_BETWEEN_EACH_CHARACTER;
+            text_width_in_pixels += AdvanceWidthInPixels(font, character, ScaleFactor);
         }
 
         return static_cast<NumericType>(text_width_in_pixels);
@@ -1,5 +1,6 @@
 #include "String/String.h"
 #include "Graphics/Gui/TextBox.h"
+#include "Graphics/Gui/TextLayout.h"
 
 namespace GRAPHICS::GUI
 {
@@ -36,53 +37,47 @@ namespace GRAPHICS::GUI
         // ADD EACH LINE OF TEXT TO APPROPRIATE PAGES IN THE TEXT BOX.
         for (const std::string& line : lines)
         {
-            // CALCULATE HOW MUCH TEXT CAN EXIST ON A SINGLE LINE.
-            TextPage new_page(WidthInPixels, HeightInPixels, Font);
-            unsigned int max_character_count_per_line = static_cast<unsigned int>(
-                static_cast<float>(new_page.MaxAvailableWidthForTextInPixels) / static_cast<float>(Glyph::DEFAULT_WIDTH_IN_PIXELS));
-
-            // SPLIT THE LINE INTO WORDS.
+            // WRAP THE LINE TO FIT WITHIN THE TEXT BOX.
             // In order to avoid having a word broken up onto multiple lines,
-            // word boundaries need to be determined.  Splitting the text
-            // into words is a simple way to do that.  This will discard
-            // multiple sequences of spaces, but that is acceptable
-            // since space in the text box is more efficiently used by
-            // only having one space between words.  There also is not
-            // a use case yet where having multiple sequential spaces
-            // is valuable.
-            std::deque<std::string> words = STRING::String::SplitIntoWords(line, max_character_count_per_line);
-
-            bool words_exist = !words.empty();
-            if (!words_exist)
+            // lines are only wrapped at word boundaries.  Whitespace at the
+            // boundaries of wrapped lines is discarded since space in the
+            // text box is more efficiently used without it.
+            TextPage new_page(WidthInPixels, HeightInPixels, Font);
+            TextLayout line_layout = TextLayout::WrapLines(
+                line,
+                *Font,
+                static_cast<float>(new_page.MaxAvailableWidthForTextInPixels),
+                TextPage::TEXT_SCALE_RATIO);
+
+            bool wrapped_lines_exist = !line_layout.Lines.empty();
+            if (!wrapped_lines_exist)
             {
                 // With no words, additional work doesn't need to be performed
                 // since there is nothing to display.
                 return;
             }
 
-            // DIVIDE THE WORDS INTO APPROPRIATE PAGES.
+            // DIVIDE THE WRAPPED LINES INTO APPROPRIATE PAGES.
             // The text might not all fit onto a single page, so multiple pages
             // of text might be needed.  At least one initial page will be needed.
             Pages.push_back(new_page);
             TextPage* current_page = &Pages.back();
             CurrentPageIndex = 0;
-            while (!words.empty())
+            std::size_t wrapped_line_count = line_layout.Lines.size();
+            for (std::size_t wrapped_line_index = 0; wrapped_line_index < wrapped_line_count; ++wrapped_line_index)
             {
-                // TRY TO ADD THE CURRENT WORD TO THE CURRENT PAGE.
-                const std::string& current_word = words.front();
-                bool word_added = current_page->Add(current_word);
+                // TRY TO ADD THE CURRENT LINE TO THE CURRENT PAGE.
+                std::string_view wrapped_line = line_layout.GetLine(line, wrapped_line_index);
+                bool line_added = current_page->AddLine(wrapped_line);
 
-                // ADD THE WORD TO A NEW PAGE IF IT WASN'T ADDED TO THE CURRENT PAGE.
+                // ADD THE LINE TO A NEW PAGE IF IT WASN'T ADDED TO THE CURRENT PAGE.
                 // If it wasn't added, there wasn't room on the current page.
-                if (!word_added)
+                if (!line_added)
                 {
                     Pages.push_back(TextPage(WidthInPixels, HeightInPixels, Font));
                     current_page = &Pages.back();
-                    word_added = current_page->Add(current_word);
+                    line_added = current_page->AddLine(wrapped_line);
                 }
-
-                // The current word has been added to a page, so it is no longer needed.
-                words.pop_front();
             }
         }
 
@@ -0,0 +1,191 @@
+#include <cctype>
+#include "Graphics/Gui/Text.h"
+#include "Graphics/Gui/TextLayout.h"
+
+namespace GRAPHICS::GUI
+{
+    /// Word-wraps the provided text into lines that fit within the specified width.
+    /// @param[in]  text - The text to wrap.  Returned line ranges are offsets into this text.
+    /// @param[in]  font - The font to use for measuring the text.
+    /// @param[in]  max_line_width_in_pixels - The maximum width of each line, in pixels.
+    /// @param[in]  scale_factor - The scale of the text, relative to the default size
+    ///     of the font's glyphs.  1.0f is normal scaling.
+    /// @return The layout of the wrapped lines.
+    TextLayout TextLayout::WrapLines(
+        const std::string_view text,
+        const Font& font,
+        const float max_line_width_in_pixels,
+        const float scale_factor)
+    {
+        TextLayout layout;
+
+        // WRAP EACH WORD OF TEXT ONTO LINES.
+        TextLineRange current_line;
+        bool current_line_exists = false;
+        std::size_t character_index = 0;
+        while (character_index < text.size())
+        {
+            // END THE CURRENT LINE IF A NEWLINE IS REACHED.
+            // Newlines aren't considered part of a line, and empty lines are discarded.
+            const char NEWLINE = '\n';
+            char character = text[character_index];
+            if (NEWLINE == character)
+            {
+                if (current_line_exists)
+                {
+                    layout.Lines.push_back(current_line);
+                    current_line_exists = false;
+                }
+
+                ++character_index;
+                continue;
+            }
+
+            // SKIP OVER WHITESPACE BETWEEN WORDS.
+            // Whitespace between words on the same line will be included once the next word is added.
+            const int NON_SPACE = 0;
+            bool is_space = (NON_SPACE != std::isspace(static_cast<unsigned char>(character)));
+            if (is_space)
+            {
+                ++character_index;
+                continue;
+            }
+
+            // FIND THE END OF THE CURRENT WORD.
+            std::size_t word_start_index = character_index;
+            std::size_t word_end_index = word_start_index;
+            while (word_end_index < text.size())
+            {
+                bool is_word_character = (NON_SPACE == std::isspace(static_cast<unsigned char>(text[word_end_index])));
+                if (!is_word_character)
+                {
+                    break;
+                }
+                ++word_end_index;
+            }
+            std::string_view word = text.substr(word_start_index, word_end_index - word_start_index);
+            float word_width_in_pixels = Width(word, font, scale_factor);
+
+            // TRY ADDING THE WORD TO THE CURRENT LINE.
+            if (current_line_exists)
+            {
+                // CHECK IF THE CURRENT LINE CAN HOLD THE WORD.
+                // Any whitespace between the end of the line and the word must also fit.
+                std::size_t current_line_end_index = current_line.FirstCharacterIndex + current_line.CharacterCount;
+                std::string_view whitespace_before_word = text.substr(current_line_end_index, word_start_index - current_line_end_index);
+                float line_width_with_word_in_pixels =
+                    current_line.WidthInPixels +
+                    Width(whitespace_before_word, font, scale_factor) +
+                    word_width_in_pixels;
+                bool current_line_can_hold_word = (line_width_with_word_in_pixels <= max_line_width_in_pixels);
+                if (current_line_can_hold_word)
+                {
+                    current_line.CharacterCount = word_end_index - current_line.FirstCharacterIndex;
+                    current_line.WidthInPixels = line_width_with_word_in_pixels;
+                    character_index = word_end_index;
+                    continue;
+                }
+
+                // FINISH THE CURRENT LINE SO THAT THE WORD CAN START A NEW ONE.
+                layout.Lines.push_back(current_line);
+                current_line_exists = false;
+            }
+
+            // START A NEW LINE WITH THE WORD IF IT FITS.
+            bool word_fits_on_line = (word_width_in_pixels <= max_line_width_in_pixels);
+            if (word_fits_on_line)
+            {
+                current_line = TextLineRange
+                {
+                    .FirstCharacterIndex = word_start_index,
+                    .CharacterCount = word.size(),
+                    .WidthInPixels = word_width_in_pixels
+                };
+                current_line_exists = true;
+                character_index = word_end_index;
+                continue;
+            }
+
+            // BREAK UP THE WORD ACROSS MULTIPLE LINES.
+            // Each line must hold at least one character to ensure progress is made.
+            // The final part of the word is left in the current line so that following
+            // words can be added after it.
+            while (character_index < word_end_index)
+            {
+                std::size_t word_part_start_index = character_index;
+                float word_part_width_in_pixels = 0.0f;
+                while (character_index < word_end_index)
+                {
+                    float advance_width_in_pixels = Text::AdvanceWidthInPixels(font, text[character_index], scale_factor);
+                    bool character_fits = (word_part_width_in_pixels + advance_width_in_pixels <= max_line_width_in_pixels);
+                    bool word_part_empty = (word_part_start_index == character_index);
+                    if (!character_fits && !word_part_empty)
+                    {
+                        break;
+                    }
+
+                    word_part_width_in_pixels += advance_width_in_pixels;
+                    ++character_index;
+                }
+
+                current_line = TextLineRange
+                {
+                    .FirstCharacterIndex = word_part_start_index,
+                    .CharacterCount = character_index - word_part_start_index,
+                    .WidthInPixels = word_part_width_in_pixels
+                };
+                current_line_exists = true;
+
+                bool more_of_word_remaining = (character_index < word_end_index);
+                if (more_of_word_remaining)
+                {
+                    layout.Lines.push_back(current_line);
+                    current_line_exists = false;
+                }
+            }
+        }
+
+        // ADD THE FINAL LINE IF ONE EXISTS.
+        if (current_line_exists)
+        {
+            layout.Lines.push_back(current_line);
+        }
+
+        return layout;
+    }
+
+    /// Gets a single wrapped line of text.
+    /// @param[in]  text - The text that was wrapped.  Must be the same text the layout was created for.
+    /// @param[in]  line_index - The index of the line to get.
+    /// @return A view of the line's characters within the text; empty if the line doesn't exist.
+    std::string_view TextLayout::GetLine(const std::string_view text, const std::size_t line_index) const
+    {
+        // MAKE SURE THE LINE EXISTS.
+        bool line_exists = (line_index < Lines.size());
+        if (!line_exists)
+        {
+            return std::string_view();
+        }
+
+        // GET THE LINE'S CHARACTERS.
+        const TextLineRange& line = Lines[line_index];
+        std::string_view line_text = text.substr(line.FirstCharacterIndex, line.CharacterCount);
+        return line_text;
+    }
+
+    /// Calculates the width of some text, in pixels.
+    /// @param[in]  text - The text to measure.
+    /// @param[in]  font - The font to use for measuring the text.
+    /// @param[in]  scale_factor - The scale of the text, relative to the default size
+    ///     of the font's glyphs.  1.0f is normal scaling.
+    /// @return The width of the text, in pixels.  Matches Text::Width().
+    float TextLayout::Width(const std::string_view text, const Font& font, const float scale_factor)
+    {
+        float text_width_in_pixels = 0.0f;
+        for (const char character : text)
+        {
+            text_width_in_pixels += Text::AdvanceWidthInPixels(font, character, scale_factor);
+        }
+        return text_width_in_pixels;
+    }
+}
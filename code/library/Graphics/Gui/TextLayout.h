@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+#include "Graphics/Gui/Font.h"
+
+namespace GRAPHICS::GUI
+{
+    /// A single line of word-wrapped text, stored as a range of characters
+    /// within the original text so that no strings need to be copied.
+    struct TextLineRange
+    {
+        /// The index of the first character of the line within the original text.
+        std::size_t FirstCharacterIndex = 0;
+        /// The number of characters in the line.
+        std::size_t CharacterCount = 0;
+        /// The width of the line when rendered, in pixels.
+        float WidthInPixels = 0.0f;
+    };
+
+    /// The layout of text word-wrapped into lines that fit within a specific width.
+    /// Line breaks are computed once as offsets into the original text, so a layout
+    /// remains valid for as long as the same text is used with it.
+    ///
+    /// Lines are broken at embedded newlines and between words (sequences of
+    /// non-whitespace characters).  Whitespace at the start or end of a wrapped line
+    /// is excluded from the line.  A single word too wide to fit on a line is broken
+    /// up across multiple lines.
+    class TextLayout
+    {
+    public:
+        // LAYOUT.
+        static TextLayout WrapLines(
+            const std::string_view text,
+            const Font& font,
+            const float max_line_width_in_pixels,
+            const float scale_factor);
+
+        // LINE RETRIEVAL.
+        std::string_view GetLine(const std::string_view text, const std::size_t line_index) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The wrapped lines of text, in order.
+        std::vector<TextLineRange> Lines = {};
+
+    private:
+        // HELPER METHODS.
+        static float Width(const std::string_view text, const Font& font, const float scale_factor);
+    };
+}
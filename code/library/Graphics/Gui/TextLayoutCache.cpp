@@ -0,0 +1,69 @@
+#include <functional>
+#include "Graphics/Gui/TextLayoutCache.h"
+
+namespace GRAPHICS::GUI
+{
+    /// Gets a layout for the specified text, wrapping it only if not already cached.
+    /// @param[in]  text - The text to wrap.
+    /// @param[in]  font_id - The ID of the font for the text.
+    /// @param[in]  font - The font for the text.
+    /// @param[in]  max_line_width_in_pixels - The maximum width of each line, in pixels.
+    /// @param[in]  scale_factor - The scale of the text, relative to the default size
+    ///     of the font's glyphs.  1.0f is normal scaling.
+    /// @return The layout for the text.  Only valid until the end of the current frame.
+    const TextLayout& TextLayoutCache::Get(
+        const std::string_view text,
+        const RESOURCES::AssetId font_id,
+        const Font& font,
+        const float max_line_width_in_pixels,
+        const float scale_factor)
+    {
+        // FIND THE CACHED LAYOUT.
+        std::size_t text_hash = std::hash<std::string_view>()(text);
+        TextLayoutKey layout_key(text_hash, font_id, max_line_width_in_pixels, scale_factor);
+        auto key_with_layout = LayoutsByKey.find(layout_key);
+        bool layout_cached = (LayoutsByKey.end() != key_with_layout);
+        if (!layout_cached)
+        {
+            key_with_layout = LayoutsByKey.emplace(layout_key, CachedTextLayout()).first;
+        }
+
+        // WRAP THE TEXT IF NOT ALREADY CACHED.
+        // Different text may have the same hash, so the text itself is also checked.
+        CachedTextLayout& cached_layout = key_with_layout->second;
+        bool cached_layout_for_same_text = layout_cached && (cached_layout.Text == text);
+        if (!cached_layout_for_same_text)
+        {
+            cached_layout.Text = text;
+            cached_layout.Layout = TextLayout::WrapLines(text, font, max_line_width_in_pixels, scale_factor);
+            ++WrapCount;
+        }
+        cached_layout.LastUsedFrameNumber = CurrentFrameNumber;
+
+        return cached_layout.Layout;
+    }
+
+    /// Marks the end of a frame, evicting any layouts that haven't been used recently.
+    void TextLayoutCache::EndFrame()
+    {
+        // EVICT LAYOUTS THAT HAVEN'T BEEN USED RECENTLY.
+        std::erase_if(
+            LayoutsByKey,
+            [this](const auto& key_with_layout)
+            {
+                unsigned int unused_frame_count = CurrentFrameNumber - key_with_layout.second.LastUsedFrameNumber;
+                bool layout_unused_for_too_long = (unused_frame_count > MAX_UNUSED_FRAME_COUNT_BEFORE_EVICTION);
+                return layout_unused_for_too_long;
+            });
+
+        // MOVE TO THE NEXT FRAME.
+        ++CurrentFrameNumber;
+    }
+
+    /// Gets the total number of layouts currently cached.
+    /// @return The number of cached layouts.
+    std::size_t TextLayoutCache::LayoutCount() const
+    {
+        return LayoutsByKey.size();
+    }
+}
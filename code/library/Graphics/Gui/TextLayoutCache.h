@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include "Graphics/Gui/Font.h"
+#include "Graphics/Gui/TextLayout.h"
+#include "Resources/AssetId.h"
+
+namespace GRAPHICS::GUI
+{
+    /// A cache of word-wrapped text layouts so that wrapped text rendered every
+    /// frame (like Bible verses or credits) only needs to be wrapped once.
+    /// Layouts that haven't been used for a while are evicted in the same
+    /// way as for the GlyphRunCache.
+    class TextLayoutCache
+    {
+    public:
+        // CONSTANTS.
+        /// The number of frames a layout may go unused before being evicted from the cache.
+        static constexpr unsigned int MAX_UNUSED_FRAME_COUNT_BEFORE_EVICTION = 120;
+
+        // RETRIEVAL.
+        const TextLayout& Get(
+            const std::string_view text,
+            const RESOURCES::AssetId font_id,
+            const Font& font,
+            const float max_line_width_in_pixels,
+            const float scale_factor);
+
+        // FRAME TRACKING.
+        void EndFrame();
+
+        // STATISTICS.
+        std::size_t LayoutCount() const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The total number of times text has been wrapped (due to not being cached).
+        std::size_t WrapCount = 0;
+
+    private:
+        /// A layout along with the text it was created for and when it was last used.
+        struct CachedTextLayout
+        {
+            /// The text that was wrapped.  Stored to distinguish between different
+            /// text that happens to have the same hash.
+            std::string Text = "";
+            /// The cached layout.
+            TextLayout Layout = {};
+            /// The number of the frame in which the layout was last used.
+            unsigned int LastUsedFrameNumber = 0;
+        };
+
+        /// The hash of the text, font ID, max line width, and scale factor identifying a layout.
+        using TextLayoutKey = std::tuple<std::size_t, RESOURCES::AssetId, float, float>;
+
+        /// The number of the current frame being rendered.
+        unsigned int CurrentFrameNumber = 0;
+        /// The cached layouts.
+        std::map<TextLayoutKey, CachedTextLayout> LayoutsByKey = {};
+    };
+}
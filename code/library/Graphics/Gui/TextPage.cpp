@@ -35,9 +35,9 @@ namespace GRAPHICS::GUI
         // Spaces should separate consecutive words, but putting a space before
         // the first word on a line would waste a character slot.
         const char SPACE = ' ';
-        std::vector<char>& first_unfilled_line_of_text = LinesOfText[LastUnfilledLineIndex];
-        std::vector<char>* current_line_of_text = &first_unfilled_line_of_text;
-        std::string current_line_as_string = std::string(current_line_of_text->cbegin(), current_line_of_text->cend());
+        std::string& first_unfilled_line_of_text = LinesOfText[LastUnfilledLineIndex];
+        std::string* current_line_of_text = &first_unfilled_line_of_text;
+        std::string current_line_as_string = *current_line_of_text;
         bool first_word = current_line_of_text->empty();
         if (!first_word)
         {
@@ -83,6 +83,36 @@ namespace GRAPHICS::GUI
         return true;
     }
 
+    /// Adds the provided line of text to the text page.  The line is assumed
+    /// to have already been wrapped to fit within the page's available width.
+    /// It will be placed on the first empty line of the page.
+    /// @param[in]  line - The line to add.
+    /// @return True if the line is added; false if the page has no more empty lines.
+    bool TextPage::AddLine(const std::string_view line)
+    {
+        // SKIP OVER THE LAST UNFILLED LINE IF IT ALREADY HAS TEXT.
+        bool last_unfilled_line_exists = (LastUnfilledLineIndex < LineCount);
+        if (last_unfilled_line_exists)
+        {
+            bool last_unfilled_line_has_text = !LinesOfText[LastUnfilledLineIndex].empty();
+            if (last_unfilled_line_has_text)
+            {
+                ++LastUnfilledLineIndex;
+            }
+        }
+
+        // MAKE SURE THERE IS ROOM FOR THE NEW LINE.
+        bool all_text_lines_full = (LastUnfilledLineIndex >= LineCount);
+        if (all_text_lines_full)
+        {
+            return false;
+        }
+
+        // ADD THE LINE.
+        LinesOfText[LastUnfilledLineIndex] = line;
+        return true;
+    }
+
     /// Checks if all text in this page has been displayed.
     /// @return True if all text in the page has been displayed; false otherwise.
     bool TextPage::AllTextDisplayed() const
@@ -129,21 +159,42 @@ namespace GRAPHICS::GUI
             static_cast<float>(top_left_screen_position_in_pixels.Y));
         for (unsigned int line_index = 0; line_index < LineCount; ++line_index)
         {
-            // GET THE CURRENT LINE OF TEXT.
-            std::string current_line_characters = GetTextLine(line_index);
-            bool line_exists = !current_line_characters.empty();
+            // CHECK IF ANY OF THE CURRENT LINE HAS BEEN DISPLAYED.
+            unsigned int displayed_character_count = GetDisplayedCharacterCount(line_index);
+            bool line_exists = (displayed_character_count > 0);
             if (!line_exists)
             {
                 // If no line exists, then there is nothing to render.
                 return;
             }
 
-            // RENDER THE CURRENT LINE.
-            renderer.RenderText(
-                current_line_characters, 
-                RESOURCES::AssetId::FONT_TEXTURE, 
-                current_line_top_left_screen_position_in_pixels, 
-                GRAPHICS::Color::BLACK);
+            // RENDER THE DISPLAYED PART OF THE CURRENT LINE.
+            // The entire line is laid out (and cached) even if only part of it is displayed
+            // so that the text doesn't need to be laid out again as each character is revealed.
+            const std::string& current_line_characters = LinesOfText[line_index];
+            const GlyphRun* current_line_glyph_run = renderer.GetGlyphRun(
+                current_line_characters,
+                RESOURCES::AssetId::FONT_TEXTURE,
+                GRAPHICS::Color::BLACK,
+                TEXT_SCALE_RATIO);
+            if (current_line_glyph_run)
+            {
+                constexpr std::size_t FIRST_CHARACTER_INDEX = 0;
+                renderer.Render(
+                    *current_line_glyph_run,
+                    current_line_top_left_screen_position_in_pixels,
+                    FIRST_CHARACTER_INDEX,
+                    displayed_character_count);
+            }
+            else
+            {
+                // The renderer will handle the lack of a font for the text.
+                renderer.RenderText(
+                    GetTextLine(line_index),
+                    RESOURCES::AssetId::FONT_TEXTURE,
+                    current_line_top_left_screen_position_in_pixels,
+                    GRAPHICS::Color::BLACK);
+            }
 
             // CALCULATE THE POSITION FOR THE NEXT LINE OF TEXT.
             current_line_top_left_screen_position_in_pixels.Y += Glyph::DEFAULT_HEIGHT_IN_PIXELS;
@@ -269,7 +320,7 @@ namespace GRAPHICS::GUI
         }
 
         // GET THE CURRENT LINE OF TEXT.
-        const std::vector<char>& current_line_characters = LinesOfText[line_index];
+        const std::string& current_line_characters = LinesOfText[line_index];
         unsigned int displayed_character_count = GetDisplayedCharacterCount(line_index);
 
         auto first_displayed_character = current_line_characters.cbegin();
@@ -3,6 +3,7 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <SFML/Graphics.hpp>
 #include <SFML/System.hpp>
@@ -35,6 +36,7 @@ namespace GRAPHICS::GUI
 
         // OTHER PUBLIC METHODS.
         bool Add(const std::string& word);
+        bool AddLine(const std::string_view line);
 
         bool AllTextDisplayed() const;
 
@@ -64,7 +66,8 @@ namespace GRAPHICS::GUI
         /// The font used for rendering text.
         std::shared_ptr<Font> Font;
         /// The sequence of characters displayed on each line in the page.
-        std::vector< std::vector<char> > LinesOfText;
+        /// Stored as strings so that lines can be rendered without needing to be copied.
+        std::vector<std::string> LinesOfText;
         /// The index of the last line of text that hasn't been completely filled.
         unsigned int LastUnfilledLineIndex;
         /// The total elapsed time (in seconds) that text in this page has been displayed.
@@ -1,16 +1,80 @@
+#include <algorithm>
 #include <array>
+#include <functional>
 #include "Debugging/DebugConsole.h"
 #include "Graphics/Renderer.h"
 #include "Graphics/TimeOfDayLighting.h"
-#include "String/String.h"
+#include "Memory/AllocationTracker.h"
 
 namespace GRAPHICS
 {
+    /// Begins a new frame by clearing the entire screen so that everything gets redrawn.
+    /// This is the normal way of rendering for screens that change a lot between frames.
+    void Renderer::BeginFullScreenRedraw()
+    {
+        // CLEAR THE ENTIRE SCREEN.
+        RedrawMode = ScreenRedrawMode::FULL_SCREEN;
+        Screen->Clear();
+
+        // TRACK THAT THE ENTIRE SCREEN IS BEING REDRAWN.
+        // Nothing drawn is being recorded, so the next frame with tracking of changes will need
+        // to redraw everything.
+        ScreenChanges.MarkAllDirty();
+        RedrawnPixelCount = Screen->WidthInPixels<unsigned int>() * Screen->HeightInPixels<unsigned int>();
+        TotalRedrawnPixelCount += RedrawnPixelCount;
+    }
+
+    /// Begins a new frame by recording what gets drawn without actually drawing anything.
+    /// Everything for the frame should be "drawn" in this mode before redrawing changed regions
+    /// (see BeginRedrawingChangedScreenRegions()), so that it can be determined what changed.
+    void Renderer::BeginRecordingScreenChanges()
+    {
+        RedrawMode = ScreenRedrawMode::RECORDING_CHANGES;
+        ScreenChanges.BeginFrame();
+    }
+
+    /// Clears regions of the screen that changed since the previous frame, based on what was recorded
+    /// (see BeginRecordingScreenChanges()), so that everything for the frame can be drawn again with
+    /// only drawing overlapping those regions actually being done.  The rest of the screen is retained
+    /// from the previous frame.
+    void Renderer::BeginRedrawingChangedScreenRegions()
+    {
+        // DETERMINE WHAT CHANGED ON THE SCREEN.
+        RedrawMode = ScreenRedrawMode::CHANGED_REGIONS_ONLY;
+        MATH::FloatRectangle screen_rectangle = Screen->GetBoundingRectangle<float>();
+        ScreenChanges.ComputeDirtyRegions(screen_rectangle);
+
+        // CLEAR THE CHANGED REGIONS OF THE SCREEN.
+        // Blending is disabled so that the regions are completely replaced with the clear color.
+        sf::View screen_space_view = Screen->RenderTarget.getDefaultView();
+        Screen->RenderTarget.setView(screen_space_view);
+        sf::RenderStates clear_render_states(sf::BlendNone);
+        for (const MATH::FloatRectangle& dirty_region : ScreenChanges.DirtyRegions)
+        {
+            sf::RectangleShape cleared_region(sf::Vector2f(dirty_region.Width(), dirty_region.Height()));
+            cleared_region.setPosition(dirty_region.LeftTop.X, dirty_region.LeftTop.Y);
+            cleared_region.setFillColor(sf::Color::Black);
+            Screen->RenderTarget.draw(cleared_region, clear_render_states);
+        }
+
+        // TRACK HOW MUCH OF THE SCREEN IS BEING REDRAWN.
+        RedrawnPixelCount = ScreenChanges.DirtyPixelCount();
+        TotalRedrawnPixelCount += RedrawnPixelCount;
+    }
+
     /// Renders the final screen based on the current state of rendering operations.
     /// @param[in]  render_settings - The settings to use for rendering.
     /// @return The rendered screen.
     sf::Sprite Renderer::RenderFinalScreen(const sf::RenderStates& render_settings)
     {
+        // CHECK IF ANYTHING WAS ACTUALLY DRAWN.
+        // When only recording changes, the frame will be drawn again afterward.
+        if (ScreenRedrawMode::RECORDING_CHANGES == RedrawMode)
+        {
+            sf::Sprite screen(Screen->RenderTarget.getTexture());
+            return screen;
+        }
+
         // RESET THE VIEW TO THE DEFAULT VIEW.
         // This is necessary for full-screen effects to take effect.
         sf::View screen_space_view = Screen->RenderTarget.getDefaultView();
@@ -21,9 +85,19 @@ namespace GRAPHICS
         sf::Sprite screen(Screen->RenderTarget.getTexture());
 
         // APPLY THE RENDER SETTINGS TO THE SCREEN.
-        Screen->RenderTarget.draw(screen, render_settings);
-        Screen->RenderTarget.display();
-        screen.setTexture(Screen->RenderTarget.getTexture());
+        // Screens that only redraw changed regions are retained across frames,
+        // so full-screen effects can't be applied to them without accumulating.
+        if (ScreenRedrawMode::FULL_SCREEN == RedrawMode)
+        {
+            Screen->RenderTarget.draw(screen, render_settings);
+            Screen->RenderTarget.display();
+            screen.setTexture(Screen->RenderTarget.getTexture());
+        }
+
+        // EVICT ANY CACHED TEXT THAT IS NO LONGER BEING RENDERED.
+        // The final screen is rendered once per frame, so this marks the end of the frame.
+        GlyphRuns.EndFrame();
+        TextLayouts.EndFrame();
 
         return screen;
     }
@@ -48,12 +122,42 @@ namespace GRAPHICS
         return screen;
     }
 
+    /// Gets the screen exactly as it was rendered for the previous frame, without drawing anything.
+    /// Only valid for retained screens that are known to not have changed since the previous frame
+    /// (see BeginRedrawingChangedScreenRegions()).  What was recorded for the previous frame is kept
+    /// so that later frames are still compared against what's actually on the screen.
+    /// @return The previously rendered screen.
+    sf::Sprite Renderer::RetainPreviousScreen()
+    {
+        // TRACK THAT NOTHING IS BEING REDRAWN.
+        RedrawnPixelCount = 0;
+
+        sf::Sprite screen(Screen->RenderTarget.getTexture());
+        return screen;
+    }
+
     /// Renders a line in screen coordinates.
     /// @param[in]  start_position - The starting point of the line.
     /// @param[in]  end_position - The ending point of the line.
     /// @param[in]  color - The color of the line to render.
     void Renderer::RenderLine(const MATH::Vector2f& start_position, const MATH::Vector2f& end_position, const GRAPHICS::Color& color)
     {
+        // CHECK IF THE LINE NEEDS TO BE DRAWN.
+        // Lines are single pixels wide, so the line's bounding rectangle is expanded by a pixel to fully cover it.
+        constexpr float LINE_THICKNESS_IN_PIXELS = 1.0f;
+        MATH::FloatRectangle line_screen_rectangle;
+        line_screen_rectangle.LeftTop.X = std::min(start_position.X, end_position.X);
+        line_screen_rectangle.LeftTop.Y = std::min(start_position.Y, end_position.Y);
+        line_screen_rectangle.RightBottom.X = std::max(start_position.X, end_position.X) + LINE_THICKNESS_IN_PIXELS;
+        line_screen_rectangle.RightBottom.Y = std::max(start_position.Y, end_position.Y) + LINE_THICKNESS_IN_PIXELS;
+        std::size_t line_content_hash = 0;
+        DirtyRegionTracker::CombineHash(color, line_content_hash);
+        bool line_needs_drawing = ScreenRegionNeedsDrawing(line_screen_rectangle, line_content_hash);
+        if (!line_needs_drawing)
+        {
+            return;
+        }
+
         // CONVERT THE COLOR TO SFML FORMAT.
         sf::Color line_color(color.Red, color.Green, color.Blue, color.Alpha);
 
@@ -76,6 +180,15 @@ namespace GRAPHICS
         const MATH::FloatRectangle& rectangle,
         const GRAPHICS::Color& color)
     {
+        // CHECK IF THE RECTANGLE NEEDS TO BE DRAWN.
+        std::size_t rectangle_content_hash = 0;
+        DirtyRegionTracker::CombineHash(color, rectangle_content_hash);
+        bool rectangle_needs_drawing = ScreenRegionNeedsDrawing(rectangle, rectangle_content_hash);
+        if (!rectangle_needs_drawing)
+        {
+            return;
+        }
+
         // CONVERT THE RECTANGLE POSITION TO A WORLD POSITION.
         // This is necessary so that the rectangle can be rendered
         // appropriately on the screen regardless of how the camera
@@ -116,88 +229,24 @@ namespace GRAPHICS
         const GRAPHICS::Color& background_color,
         const GRAPHICS::Color& text_color)
     {
-        // CONVERT THE SCREEN POSITION TO A WORLD POSITION.
-        // This is necessary so that the key icon can be rendered
-        // appropriately on the screen regardless of how the camera
-        // might move around the world.
-        sf::Vector2f left_top_world_position = Screen->RenderTarget.mapPixelToCoords(sf::Vector2i(
-            left_top_screen_position_in_pixels.X,
-            left_top_screen_position_in_pixels.Y));
-
-        // CREATE A RECTANGLE TO RESEMBLE A KEY ON A KEYBOARD.
-        switch (shape_type)
-        {
-            case ShapeType::RECTANGLE:
-            {
-                sf::RectangleShape key_background_icon;
-                key_background_icon.setFillColor(sf::Color(background_color.Red, background_color.Green, background_color.Blue, background_color.Alpha));
-                key_background_icon.setOutlineColor(sf::Color(border_color.Red, border_color.Green, border_color.Blue, border_color.Alpha));
-                key_background_icon.setOutlineThickness(2.0f);
-                key_background_icon.setSize(sf::Vector2f(
-                    static_cast<float>(GRAPHICS::GUI::Glyph::DEFAULT_WIDTH_IN_PIXELS),
-                    static_cast<float>(GRAPHICS::GUI::Glyph::DEFAULT_HEIGHT_IN_PIXELS)));
-                key_background_icon.setPosition(left_top_world_position);
-
-                // RENDER THE BACKGROUND RECTANGLE FOR THE KEY.
-                Screen->RenderTarget.draw(key_background_icon);
-                break;
-            }
-            case ShapeType::CIRCLE:
-            {
-                sf::CircleShape key_background_icon;
-                key_background_icon.setFillColor(sf::Color(background_color.Red, background_color.Green, background_color.Blue, background_color.Alpha));
-                key_background_icon.setOutlineColor(sf::Color(border_color.Red, border_color.Green, border_color.Blue, border_color.Alpha));
-                key_background_icon.setOutlineThickness(2.0f);
-                key_background_icon.setRadius(static_cast<float>(GRAPHICS::GUI::Glyph::DEFAULT_WIDTH_IN_PIXELS / 2));
-                key_background_icon.setPosition(left_top_world_position);
-
-                // RENDER THE BACKGROUND RECTANGLE FOR THE KEY.
-                Screen->RenderTarget.draw(key_background_icon);
-                break;
-            }
-        }
-
-        // GET THE DEFAULT FONT.
-        auto id_with_font = Fonts.find(RESOURCES::AssetId::FONT_TEXTURE);
-        bool font_exists = (id_with_font != Fonts.cend()) && (nullptr != id_with_font->second);
-        if (!font_exists)
+        // CHECK IF THE KEY ICON NEEDS TO BE DRAWN.
+        // The icon's outline extends beyond the icon's normal left-top position.
+        GUI::GuiIcon key_icon = GUI::GuiIcon::Key(key, shape_type, border_color, background_color, text_color);
+        MATH::Vector2ui key_icon_dimensions_in_pixels = key_icon.DimensionsInPixels();
+        MATH::FloatRectangle key_icon_screen_rectangle = MATH::FloatRectangle::FromLeftTopAndDimensions(
+            static_cast<float>(left_top_screen_position_in_pixels.X) - GUI::GuiIcon::KEY_OUTLINE_THICKNESS_IN_PIXELS,
+            static_cast<float>(left_top_screen_position_in_pixels.Y) - GUI::GuiIcon::KEY_OUTLINE_THICKNESS_IN_PIXELS,
+            static_cast<float>(key_icon_dimensions_in_pixels.X),
+            static_cast<float>(key_icon_dimensions_in_pixels.Y));
+        std::size_t key_icon_content_hash = std::hash<GUI::GuiIcon>()(key_icon);
+        bool key_icon_needs_drawing = ScreenRegionNeedsDrawing(key_icon_screen_rectangle, key_icon_content_hash);
+        if (!key_icon_needs_drawing)
         {
-            // The text can't be rendered without the font.
             return;
         }
 
-        // GET THE GLYPH FOR THE KEY.
-        auto font = id_with_font->second;
-        GRAPHICS::GUI::Glyph& glyph = font->GlyphsByCharacter[static_cast<unsigned int>(key)];
-
-        // GET THE LEFT POSITION OF THE KEY SPRITE.
-        // It should be offset based on the amount of space on the left of the glyph
-        // in order to center it.
-        float key_glyph_width_in_pixels = glyph.TextureSubRectangle.Width();
-        float space_around_glyph_in_pixels = static_cast<float>(GRAPHICS::GUI::Glyph::DEFAULT_WIDTH_IN_PIXELS) - key_glyph_width_in_pixels;
-        float space_on_left_of_glyph_in_pixels = space_around_glyph_in_pixels / 2.0f;
-        float key_character_sprite_left_screen_position_in_pixels =
-            static_cast<float>(left_top_screen_position_in_pixels.X) + space_on_left_of_glyph_in_pixels;
-
-        // CREATE A SPRITE FOR THE GLYPH.
-        sf::IntRect key_texture_sub_rectangle = glyph.TextureSubRectangle.ToSfmlRectangle<int>();
-        sf::Sprite key_character_sprite(glyph.Texture->TextureResource, key_texture_sub_rectangle);
-        key_character_sprite.setPosition(
-            key_character_sprite_left_screen_position_in_pixels,
-            static_cast<float>(left_top_screen_position_in_pixels.Y));
-
-        // CONFIGURE THE RENDER TARGET FOR SCREEN-SPACE RENDERING.
-        sf::View screen_space_view = Screen->RenderTarget.getDefaultView();
-        Screen->RenderTarget.setView(screen_space_view);
-
-        // RENDER THE GLYPH FOR THE KEY.
-        sf::RenderStates render_states = sf::RenderStates::Default;
-        std::shared_ptr<sf::Shader> colored_text_shader = GraphicsDevice->GetShader(RESOURCES::AssetId::COLORED_TEXTURE_SHADER);
-        if (colored_text_shader)
-        {
-            render_states = ConfigureColoredTextShader(text_color, *colored_text_shader);
-        }
-        Screen->RenderTarget.draw(key_character_sprite, render_states);
+        // RENDER THE KEY ICON.
+        RenderCachedGuiIcon(key_icon, key_icon_screen_rectangle.LeftTop);
     }
 
     /// Renders a GUI icon on the screen.
@@ -211,26 +260,22 @@ namespace GRAPHICS
         const MATH::FloatRectangle& texture_sub_rectangle,
         const MATH::Vector2ui& left_top_screen_position_in_pixels)
     {
-        // CREATE A SPRITE FOR THE ICON USING THE TEXTURE INFORMATION.
-        sf::IntRect texture_rectangle;
-        texture_rectangle.top = static_cast<int>(texture_sub_rectangle.LeftTop.Y);
-        texture_rectangle.left = static_cast<int>(texture_sub_rectangle.LeftTop.X);
-        texture_rectangle.width = static_cast<int>(texture_sub_rectangle.Width());
-        texture_rectangle.height = static_cast<int>(texture_sub_rectangle.Height());
-        MEMORY::NonNullSharedPointer<GRAPHICS::Texture> texture = GraphicsDevice->GetTexture(texture_id);
-        sf::Sprite gui_icon(texture->TextureResource, texture_rectangle);
-
-        // POSITION THE GUI ICON SPRITE.
-        // The screen position must be converted to a world position so that the GUI icon
-        // can be rendered appropriately on screen regardless of how the camera might
-        // move around the world.
-        sf::Vector2f left_top_world_position = Screen->RenderTarget.mapPixelToCoords(sf::Vector2i(
-            left_top_screen_position_in_pixels.X,
-            left_top_screen_position_in_pixels.Y));
-        gui_icon.setPosition(left_top_world_position);
+        // CHECK IF THE GUI ICON NEEDS TO BE DRAWN.
+        MATH::FloatRectangle gui_icon_screen_rectangle = MATH::FloatRectangle::FromLeftTopAndDimensions(
+            static_cast<float>(left_top_screen_position_in_pixels.X),
+            static_cast<float>(left_top_screen_position_in_pixels.Y),
+            texture_sub_rectangle.Width(),
+            texture_sub_rectangle.Height());
+        GUI::GuiIcon gui_icon = GUI::GuiIcon::TextureRegion(texture_id, texture_sub_rectangle);
+        std::size_t gui_icon_content_hash = std::hash<GUI::GuiIcon>()(gui_icon);
+        bool gui_icon_needs_drawing = ScreenRegionNeedsDrawing(gui_icon_screen_rectangle, gui_icon_content_hash);
+        if (!gui_icon_needs_drawing)
+        {
+            return;
+        }
 
         // RENDER THE GUI ICON.
-        Screen->RenderTarget.draw(gui_icon);
+        RenderCachedGuiIcon(gui_icon, gui_icon_screen_rectangle.LeftTop);
     }
 
     /// Renders a sprite as a GUI icon on the screen.
@@ -241,33 +286,55 @@ namespace GRAPHICS
         const GRAPHICS::Sprite& sprite,
         const MATH::Vector2f& left_top_screen_position_in_pixels)
     {
-        // CREATE A SPRITE FOR THE ICON USING THE TEXTURE INFORMATION.
-        // This allow repositioning of the icon to be in screen coordinates.
-        sf::IntRect texture_rectangle;
-        texture_rectangle.left = (int)sprite.TextureSubRectangle.LeftTop.X;
-        texture_rectangle.top = (int)sprite.TextureSubRectangle.LeftTop.Y;
-        texture_rectangle.width = (int)sprite.TextureSubRectangle.Width();
-        texture_rectangle.height = (int)sprite.TextureSubRectangle.Height();
-        MEMORY::NonNullSharedPointer<GRAPHICS::Texture> texture = GraphicsDevice->GetTexture(sprite.TextureId);
-        sf::Sprite gui_icon(texture->TextureResource, texture_rectangle);
-
-        // POSITION THE GUI ICON SPRITE.
-        // The screen position must be converted to a world position so that the GUI icon
-        // can be rendered appropriately on screen regardless of how the camera might
-        // move around the world.
-        sf::Vector2f left_top_world_position = Screen->RenderTarget.mapPixelToCoords(sf::Vector2i(
-            static_cast<int>(left_top_screen_position_in_pixels.X),
-            static_cast<int>(left_top_screen_position_in_pixels.Y)));
-        gui_icon.setPosition(left_top_world_position);
+        // CHECK IF THE GUI ICON NEEDS TO BE DRAWN.
+        MATH::FloatRectangle gui_icon_screen_rectangle = MATH::FloatRectangle::FromLeftTopAndDimensions(
+            left_top_screen_position_in_pixels.X,
+            left_top_screen_position_in_pixels.Y,
+            sprite.TextureSubRectangle.Width(),
+            sprite.TextureSubRectangle.Height());
+        GUI::GuiIcon gui_icon = GUI::GuiIcon::TextureRegion(sprite.TextureId, sprite.TextureSubRectangle);
+        std::size_t gui_icon_content_hash = std::hash<GUI::GuiIcon>()(gui_icon);
+        bool gui_icon_needs_drawing = ScreenRegionNeedsDrawing(gui_icon_screen_rectangle, gui_icon_content_hash);
+        if (!gui_icon_needs_drawing)
+        {
+            return;
+        }
 
         // RENDER THE GUI ICON.
-        Screen->RenderTarget.draw(gui_icon);
+        // This allows repositioning of the icon to be in screen coordinates.
+        RenderCachedGuiIcon(gui_icon, left_top_screen_position_in_pixels);
     }
 
     /// Renders a sprite to the screen.
     /// @param[in]  sprite - The sprite to render.
     void Renderer::Render(const Sprite& sprite)
     {
+        // CHECK IF THE SPRITE NEEDS TO BE DRAWN.
+        // Sprites are positioned in the world, so the entire screen is conservatively considered
+        // to be covered by them rather than transforming them into screen space.
+        MATH::FloatRectangle screen_rectangle = Screen->GetBoundingRectangle<float>();
+        std::size_t sprite_content_hash = 0;
+        DirtyRegionTracker::CombineHash(static_cast<int>(sprite.TextureId), sprite_content_hash);
+        DirtyRegionTracker::CombineHash(sprite.TextureSubRectangle.LeftTop.X, sprite_content_hash);
+        DirtyRegionTracker::CombineHash(sprite.TextureSubRectangle.LeftTop.Y, sprite_content_hash);
+        DirtyRegionTracker::CombineHash(sprite.TextureSubRectangle.RightBottom.X, sprite_content_hash);
+        DirtyRegionTracker::CombineHash(sprite.TextureSubRectangle.RightBottom.Y, sprite_content_hash);
+        DirtyRegionTracker::CombineHash(sprite.WorldPosition.X, sprite_content_hash);
+        DirtyRegionTracker::CombineHash(sprite.WorldPosition.Y, sprite_content_hash);
+        DirtyRegionTracker::CombineHash(sprite.Origin.X, sprite_content_hash);
+        DirtyRegionTracker::CombineHash(sprite.Origin.Y, sprite_content_hash);
+        DirtyRegionTracker::CombineHash(sprite.Scale.X, sprite_content_hash);
+        DirtyRegionTracker::CombineHash(sprite.Scale.Y, sprite_content_hash);
+        DirtyRegionTracker::CombineHash(sprite.RotationAngleInDegrees, sprite_content_hash);
+        DirtyRegionTracker::CombineHash(sprite.Color, sprite_content_hash);
+        DirtyRegionTracker::CombineHash(Camera.ViewBounds.LeftTop.X, sprite_content_hash);
+        DirtyRegionTracker::CombineHash(Camera.ViewBounds.LeftTop.Y, sprite_content_hash);
+        bool sprite_needs_drawing = ScreenRegionNeedsDrawing(screen_rectangle, sprite_content_hash);
+        if (!sprite_needs_drawing)
+        {
+            return;
+        }
+
         // CONVERT THE SPRITE TO SFML FORMAT.
         sf::Sprite sfml_sprite;
         sfml_sprite.setColor(sf::Color(sprite.Color.Red, sprite.Color.Green, sprite.Color.Blue, sprite.Color.Alpha));
@@ -294,52 +361,132 @@ namespace GRAPHICS
     /// @param[in]  text - The text to render.
     void Renderer::Render(const GUI::Text& text)
     {
-        // RENDER THE TEXT TO THE CONSOLE IF NO FONT EXISTS.
-        // This is intended primarily to provide debug support.
-        auto id_with_font = Fonts.find(text.FontId);
-        bool font_exists = (id_with_font != Fonts.cend()) && (nullptr != id_with_font->second);
-        if (!font_exists)
+        RenderText(text.String, text.FontId, text.LeftTopPosition, text.Color, text.ScaleFactor);
+    }
+
+    /// Renders a previously laid out run of glyphs to the screen in a single draw call.
+    /// Only a sub-range of the run's characters may be rendered to support things
+    /// like text being revealed one character at a time.
+    /// @param[in]  glyph_run - The glyph run to render.
+    /// @param[in]  left_top_screen_position_in_pixels - The left/top screen position
+    ///     at which to render the glyph run.
+    /// @param[in]  first_character_index - The index of the first character in the run to render.
+    /// @param[in]  character_count - The number of characters in the run to render.
+    void Renderer::Render(
+        const GUI::GlyphRun& glyph_run,
+        const MATH::Vector2f& left_top_screen_position_in_pixels,
+        const std::size_t first_character_index,
+        const std::size_t character_count)
+    {
+        // CHECK IF THERE ARE ANY CHARACTERS TO RENDER.
+        std::size_t rendered_character_count = glyph_run.ClampCharacterCount(first_character_index, character_count);
+        bool characters_exist_to_render = (rendered_character_count > 0) && (nullptr != glyph_run.Font);
+        if (!characters_exist_to_render)
         {
-            DEBUGGING::DebugConsole::WriteLine(text.String);
             return;
         }
 
-        // RENDER EACH CHARACTER OF THE TEXT.
-        auto font = id_with_font->second;
-        MATH::Vector2f current_character_left_top_screen_position = text.LeftTopPosition;
-        for (unsigned int character_index = 0; character_index < text.String.size(); ++character_index)
+        // CHECK IF THE TEXT IS ON-SCREEN.
+        // Text like scrolling credits can extend well beyond the bounds of the screen,
+        // and issuing draw calls for such text would be wasted work.
+        MATH::FloatRectangle glyph_run_screen_rectangle = MATH::FloatRectangle::FromLeftTopAndDimensions(
+            left_top_screen_position_in_pixels.X,
+            left_top_screen_position_in_pixels.Y,
+            glyph_run.WidthInPixels,
+            glyph_run.HeightInPixels);
+        MATH::FloatRectangle screen_rectangle = Screen->GetBoundingRectangle<float>();
+        bool glyph_run_on_screen = screen_rectangle.Intersects(glyph_run_screen_rectangle);
+        if (!glyph_run_on_screen)
         {
-            // GET THE GLYPH FOR THE CURRENT CHARACTER.
-            const char character = text.String.at(character_index);
-            GUI::Glyph& glyph = font->GlyphsByCharacter[static_cast<unsigned char>(character)];
+            return;
+        }
 
-            // CREATE A SPRITE FOR THE CURRENT GLYPH.
-            sf::IntRect texture_rectangle = glyph.TextureSubRectangle.ToSfmlRectangle<int>();
-            sf::Sprite current_character_sprite(glyph.Texture->TextureResource, texture_rectangle);
-            current_character_sprite.setPosition(
-                current_character_left_top_screen_position.X,
-                current_character_left_top_screen_position.Y);
-            current_character_sprite.setScale(text.ScaleFactor, text.ScaleFactor);
+        // CHECK IF THE TEXT NEEDS TO BE DRAWN.
+        std::size_t glyph_run_content_hash = std::hash<std::string>()(glyph_run.String);
+        DirtyRegionTracker::CombineHash(glyph_run.Font.get(), glyph_run_content_hash);
+        DirtyRegionTracker::CombineHash(glyph_run.ScaleFactor, glyph_run_content_hash);
+        DirtyRegionTracker::CombineHash(glyph_run.Color, glyph_run_content_hash);
+        DirtyRegionTracker::CombineHash(first_character_index, glyph_run_content_hash);
+        DirtyRegionTracker::CombineHash(rendered_character_count, glyph_run_content_hash);
+        bool glyph_run_needs_drawing = ScreenRegionNeedsDrawing(glyph_run_screen_rectangle, glyph_run_content_hash);
+        if (!glyph_run_needs_drawing)
+        {
+            return;
+        }
 
-            // CONFIGURE THE RENDER TARGET FOR SCREEN-SPACE RENDERING.
-            sf::View screen_space_view = Screen->RenderTarget.getDefaultView();
-            Screen->RenderTarget.setView(screen_space_view);
+        // CONFIGURE THE RENDER TARGET FOR SCREEN-SPACE RENDERING.
+        sf::View screen_space_view = Screen->RenderTarget.getDefaultView();
+        Screen->RenderTarget.setView(screen_space_view);
 
-            // RENDER THE CURRENT GLYPH.
-            sf::RenderStates render_states = sf::RenderStates::Default;
-            std::shared_ptr<sf::Shader> colored_text_shader = GraphicsDevice->GetShader(RESOURCES::AssetId::COLORED_TEXTURE_SHADER);
-            if (colored_text_shader)
-            {
-                render_states = ConfigureColoredTextShader(text.Color, *colored_text_shader);
-            }
-            Screen->RenderTarget.draw(current_character_sprite, render_states);
+        // CONFIGURE THE RENDER STATES FOR THE ENTIRE GLYPH RUN.
+        // The shader only needs to be configured once since all glyphs share the same color.
+        sf::RenderStates render_states = sf::RenderStates::Default;
+        std::shared_ptr<sf::Shader> colored_text_shader = GraphicsDevice->GetShader(RESOURCES::AssetId::COLORED_TEXTURE_SHADER);
+        if (colored_text_shader)
+        {
+            render_states = ConfigureColoredTextShader(glyph_run.Color, *colored_text_shader);
+        }
+        render_states.texture = &glyph_run.Font->Texture->TextureResource;
+        render_states.transform.translate(left_top_screen_position_in_pixels.X, left_top_screen_position_in_pixels.Y);
+
+        // RENDER ALL OF THE REQUESTED GLYPHS AT ONCE.
+        std::size_t first_vertex_index = first_character_index * GUI::GlyphRun::VERTEX_COUNT_PER_CHARACTER;
+        std::size_t vertex_count = rendered_character_count * GUI::GlyphRun::VERTEX_COUNT_PER_CHARACTER;
+        Screen->RenderTarget.draw(&glyph_run.Vertices[first_vertex_index], vertex_count, sf::Quads, render_states);
+    }
+
+    /// Gets a glyph run for the specified text, laying it out only if not already cached.
+    /// @param[in]  text - The text of the glyph run.
+    /// @param[in]  font_id - The ID of the font to use for the text.
+    /// @param[in]  text_color - The color of the text.
+    /// @param[in]  text_scale_ratio - The scaling of the text, relative to the default
+    ///     size of the font's glyphs.  1.0f is normal scaling.
+    /// @return The glyph run for the text, if the font exists; null otherwise.
+    ///     Only valid until the end of the current frame.
+    const GUI::GlyphRun* Renderer::GetGlyphRun(
+        const std::string_view text,
+        const RESOURCES::AssetId font_id,
+        const Color& text_color,
+        const float text_scale_ratio)
+    {
+        // MAKE SURE THE FONT EXISTS.
+        auto id_with_font = Fonts.find(font_id);
+        bool font_exists = (id_with_font != Fonts.cend()) && (nullptr != id_with_font->second);
+        if (!font_exists)
+        {
+            return nullptr;
+        }
 
-            // CALCULATE THE LEFT-TOP SCREEN POSITION OF THE NEXT CHARACTER.
-            
-            float glyph_width = glyph.TextureSubRectangle.Width();
-            float scaled_glyph_width = text.ScaleFactor * glyph_width;
-            current_character_left_top_screen_position.X += scaled_glyph_width + GUI::Text::HORIZONTAL_SPACING_IN_PIXELS_BETWEEN_EACH_CHARACTER;
+        // GET THE GLYPH RUN FOR THE TEXT.
+        const GUI::GlyphRun& glyph_run = GlyphRuns.Get(text, font_id, id_with_font->second, text_scale_ratio, text_color);
+        return &glyph_run;
+    }
+
+    /// Gets a word-wrapped layout for the specified text, wrapping it only if not already cached.
+    /// @param[in]  text - The text to wrap.
+    /// @param[in]  font_id - The ID of the font to use for the text.
+    /// @param[in]  max_line_width_in_pixels - The maximum width of each line, in pixels.
+    /// @param[in]  text_scale_ratio - The scaling of the text, relative to the default
+    ///     size of the font's glyphs.  1.0f is normal scaling.
+    /// @return The layout for the text, if the font exists; null otherwise.
+    ///     Only valid until the end of the current frame.
+    const GUI::TextLayout* Renderer::GetTextLayout(
+        const std::string_view text,
+        const RESOURCES::AssetId font_id,
+        const float max_line_width_in_pixels,
+        const float text_scale_ratio)
+    {
+        // MAKE SURE THE FONT EXISTS.
+        auto id_with_font = Fonts.find(font_id);
+        bool font_exists = (id_with_font != Fonts.cend()) && (nullptr != id_with_font->second);
+        if (!font_exists)
+        {
+            return nullptr;
         }
+
+        // GET THE LAYOUT FOR THE TEXT.
+        const GUI::TextLayout& text_layout = TextLayouts.Get(text, font_id, *id_with_font->second, max_line_width_in_pixels, text_scale_ratio);
+        return &text_layout;
     }
 
     /// Renders text to the screen at the specified position.
@@ -352,64 +499,26 @@ namespace GRAPHICS
     /// @param[in]  text_scale_ratio - The scaling of the text, relative to the default
     ///     size of the font's glyphs.  1.0f is normal scaling.
     void Renderer::RenderText(
-        const std::string& text, 
+        const std::string_view text,
         const RESOURCES::AssetId font_id,
         const MATH::Vector2f& left_top_screen_position_in_pixels,
         const Color& text_color,
         const float text_scale_ratio)
     {
+        // ATTRIBUTE ANY ALLOCATIONS TO THE GUI.
+        MEMORY::AllocationScope gui_allocation_scope(MEMORY::AllocationTag::GUI);
+
         // RENDER THE TEXT TO THE CONSOLE IF NO FONT EXISTS.
         // This is intended primarily to provide debug support.
-        auto id_with_font = Fonts.find(font_id);
-        bool font_exists = (id_with_font != Fonts.cend()) && (nullptr != id_with_font->second);
-        if (!font_exists)
+        const GUI::GlyphRun* glyph_run = GetGlyphRun(text, font_id, text_color, text_scale_ratio);
+        if (!glyph_run)
         {
-            DEBUGGING::DebugConsole::WriteLine(text);
+            DEBUGGING::DebugConsole::WriteLine(std::string(text));
             return;
         }
 
-        // RENDER EACH CHARACTER OF THE TEXT.
-        auto font = id_with_font->second;
-        MATH::Vector2f current_character_left_top_screen_position = left_top_screen_position_in_pixels;
-        for (unsigned int character_index = 0; character_index < text.size(); ++character_index)
-        {
-            // GET THE GLYPH FOR THE CURRENT CHARACTER.
-            const char character = text.at(character_index);
-            GUI::Glyph& glyph = font->GlyphsByCharacter[static_cast<unsigned char>(character)];
-
-            // CREATE A SPRITE FOR THE CURRENT GLYPH.
-            sf::IntRect texture_rectangle = glyph.TextureSubRectangle.ToSfmlRectangle<int>();
-            sf::Sprite current_character_sprite(glyph.Texture->TextureResource, texture_rectangle);
-            current_character_sprite.setPosition(
-                current_character_left_top_screen_position.X,
-                current_character_left_top_screen_position.Y);
-            current_character_sprite.setScale(text_scale_ratio, text_scale_ratio);
-
-            // CONFIGURE THE RENDER TARGET FOR SCREEN-SPACE RENDERING.
-            sf::View screen_space_view = Screen->RenderTarget.getDefaultView();
-            Screen->RenderTarget.setView(screen_space_view);
-
-            // RENDER THE CURRENT GLYPH.
-            sf::RenderStates render_states = sf::RenderStates::Default;
-            std::shared_ptr<sf::Shader> colored_text_shader = GraphicsDevice->GetShader(RESOURCES::AssetId::COLORED_TEXTURE_SHADER);
-            if (colored_text_shader)
-            {
-                render_states = ConfigureColoredTextShader(text_color, *colored_text_shader);
-            }
-            Screen->RenderTarget.draw(current_character_sprite, render_states);
-
-            // CALCULATE THE LEFT-TOP SCREEN POSITION OF THE NEXT CHARACTER.
-            float glyph_width = glyph.TextureSubRectangle.Width();
-            // If a space is being rendered, then the width is shortened for better readability.
-            // This isn't done for other kinds of whitespace to better preserve distance for those.
-            bool character_is_space = ' ' == character;
-            if (character_is_space)
-            {
-                glyph_width /= 2.0f;
-            }
-            float scaled_glyph_width = text_scale_ratio * glyph_width;
-            current_character_left_top_screen_position.X += scaled_glyph_width + GUI::Text::HORIZONTAL_SPACING_IN_PIXELS_BETWEEN_EACH_CHARACTER;
-        }
+        // RENDER THE TEXT.
+        Render(*glyph_run, left_top_screen_position_in_pixels);
     }
 
     /// Renders text to the screen within the specified rectangle.
@@ -425,103 +534,23 @@ namespace GRAPHICS
     /// @param[in]  text_scale_ratio - The scaling of the text, relative to the default
     ///     size of the font's glyphs.  1.0f is normal scaling.
     void Renderer::RenderText(
-        const std::string& text,
+        const std::string_view text,
         const RESOURCES::AssetId font_id,
         const MATH::FloatRectangle& bounding_screen_rectangle,
         const Color& text_color,
         const float text_scale_ratio)
     {
-        // SPLIT THE PROVIDED TEXT INTO LINES BASED ON EMBEDDED LINE BREAKS.
-        std::vector<std::string> original_lines_from_text = STRING::String::SplitIntoLines(text);
+        // ATTRIBUTE ANY ALLOCATIONS TO THE GUI.
+        MEMORY::AllocationScope gui_allocation_scope(MEMORY::AllocationTag::GUI);
 
-        // SPLIT EACH LINE BASED ON WORD BOUNDARIES.
-        // New lines will be created that ensure that words aren't broken up across
-        // lines (assuming that each word can fit on a single line).
-        std::vector<std::string> new_lines_of_text;
+        // WRAP THE TEXT INTO LINES THAT FIT WITHIN THE BOUNDING RECTANGLE.
+        // This is intended primarily to provide debug support if no font exists.
         float line_width_in_pixels = bounding_screen_rectangle.Width();
-        float glyph_width_in_pixels = text_scale_ratio * static_cast<float>(GUI::Glyph::DEFAULT_WIDTH_IN_PIXELS) / 2.0f;
-        unsigned int max_characters_per_line = static_cast<unsigned int>(line_width_in_pixels / glyph_width_in_pixels);
-        for (const auto& line : original_lines_from_text)
-        {
-            // SPLIT THE CURRENT LINE INTO INDIVIDUAL WORDS.
-            std::deque<std::string> words_in_current_line = STRING::String::SplitIntoWords(
-                line,
-                max_characters_per_line);
-
-            // CREATE NEW LINE(S) BASED ON THE CURRENT LINE'S WORDS.
-            std::string current_new_line;
-            while (!words_in_current_line.empty())
-            {
-                // GET THE NEXT WORD TO BE ADDED.
-                std::string next_word = words_in_current_line.front();
-                words_in_current_line.pop_front();
-
-                // CHECK IF THE CURRENT LINE IS EMPTY.
-                if (current_new_line.empty())
-                {
-                    // ADD THE CURRENT WORD TO THE NEW LINE.
-                    // An empty line should always be able to hold at least 1 word.
-                    current_new_line += next_word;
-                }
-                else
-                {
-                    // CHECK IF THE CURRENT LINE CAN HANDLE THE NEXT WORD.
-                    std::shared_ptr<GUI::Font>& font = Fonts[font_id];
-                    GUI::Text current_line_text =
-                    {
-                        .String = current_new_line,
-                        .FontId = font_id,
-                        .LeftTopPosition = MATH::Vector2f(0.0f, 0.0f),
-                        .ScaleFactor = text_scale_ratio,
-                        .Color = text_color
-                    };
-                    size_t current_line_width_in_pixels = current_line_text.Width<size_t>(*font);
-                    size_t space_character_width_in_pixels = GUI::Glyph::DEFAULT_WIDTH_IN_PIXELS / 2;
-                    GUI::Text next_word_text =
-                    {
-                        .String = next_word,
-                        .FontId = font_id,
-                        .LeftTopPosition = MATH::Vector2f(0.0f, 0.0f),
-                        .ScaleFactor = text_scale_ratio,
-                        .Color = text_color
-                    };
-                    size_t next_word_width_in_pixels = next_word_text.Width<size_t>(*font);
-                    size_t line_width_with_next_word_in_characters = 
-                        current_line_width_in_pixels + 
-                        space_character_width_in_pixels + 
-                        next_word_width_in_pixels;
-                    bool current_line_can_handle_next_word = (line_width_with_next_word_in_characters <= line_width_in_pixels);
-                    if (current_line_can_handle_next_word)
-                    {
-                        // ADD A SPACE BEFORE ADDING THE NEW WORD.
-                        const char SPACE_BETWEEN_WORDS = ' ';
-                        current_new_line += SPACE_BETWEEN_WORDS + next_word;
-                    }
-                    else
-                    {
-                        // ADD THE CURRENT NEW LINE TO THE LIST OF LINES.
-                        new_lines_of_text.push_back(current_new_line);
-                        
-                        // PREPARE FOR THE NEXT NEW LINE OF TEXT.
-                        current_new_line.clear();
-
-                        // ADD THE CURRENT WORD TO THE NEW LINE.
-                        current_new_line += next_word;
-                    }
-                }
-
-                // CHECK IF THERE ARE ANY MORE WORDS TO ADD.
-                bool more_words_left = !words_in_current_line.empty();
-                if (!more_words_left)
-                {
-                    // ADD THE CURRENT NEW LINE IF IT ISN'T EMPTY.
-                    if (!current_new_line.empty())
-                    {
-                        new_lines_of_text.push_back(current_new_line);
-                        current_new_line.clear();
-                    }
-                }
-            }
+        const GUI::TextLayout* text_layout = GetTextLayout(text, font_id, line_width_in_pixels, text_scale_ratio);
+        if (!text_layout)
+        {
+            DEBUGGING::DebugConsole::WriteLine(std::string(text));
+            return;
         }
 
         // RENDER EACH LINE OF TEXT.
@@ -530,10 +559,13 @@ namespace GRAPHICS
         MATH::Vector2f current_line_left_top_screen_position(
             bounding_rectangle_left_x_screen_position,
             bounding_rectangle_top_y_screen_position);
-        for (const auto& line : new_lines_of_text)
+        std::size_t line_count = text_layout->Lines.size();
+        for (std::size_t line_index = 0; line_index < line_count; ++line_index)
         {
             // RENDER THE CURRENT LINE.
-            RenderText(line, font_id, current_line_left_top_screen_position, text_color, text_scale_ratio);
+            std::string_view line = text_layout->GetLine(text, line_index);
+            const GUI::GlyphRun* glyph_run = GetGlyphRun(line, font_id, text_color, text_scale_ratio);
+            Render(*glyph_run, current_line_left_top_screen_position);
 
             // MOVE TO THE NEXT LINE.
             float glyph_height_in_pixels = text_scale_ratio * static_cast<float>(GUI::Glyph::DEFAULT_HEIGHT_IN_PIXELS);
@@ -554,103 +586,23 @@ namespace GRAPHICS
     /// @param[in]  text_scale_ratio - The scaling of the text, relative to the default
     ///     size of the font's glyphs.  1.0f is normal scaling.
     void Renderer::RenderCenteredText(
-        const std::string& text,
+        const std::string_view text,
         const RESOURCES::AssetId font_id,
         const MATH::FloatRectangle& bounding_screen_rectangle,
         const Color& text_color,
         const float text_scale_ratio)
     {
-        // SPLIT THE PROVIDED TEXT INTO LINES BASED ON EMBEDDED LINE BREAKS.
-        std::vector<std::string> original_lines_from_text = STRING::String::SplitIntoLines(text);
+        // ATTRIBUTE ANY ALLOCATIONS TO THE GUI.
+        MEMORY::AllocationScope gui_allocation_scope(MEMORY::AllocationTag::GUI);
 
-        // SPLIT EACH LINE BASED ON WORD BOUNDARIES.
-        // New lines will be created that ensure that words aren't broken up across
-        // lines (assuming that each word can fit on a single line).
-        std::vector<std::string> new_lines_of_text;
+        // WRAP THE TEXT INTO LINES THAT FIT WITHIN THE BOUNDING RECTANGLE.
+        // This is intended primarily to provide debug support if no font exists.
         float line_width_in_pixels = bounding_screen_rectangle.Width();
-        float glyph_width_in_pixels = text_scale_ratio * (static_cast<float>(GUI::Glyph::DEFAULT_WIDTH_IN_PIXELS) / 2.0f + GUI::Text::HORIZONTAL_SPACING_IN_PIXELS_BETWEEN_EACH_CHARACTER);
-        unsigned int max_characters_per_line = static_cast<unsigned int>(line_width_in_pixels / glyph_width_in_pixels);
-        for (const auto& line : original_lines_from_text)
-        {
-            // SPLIT THE CURRENT LINE INTO INDIVIDUAL WORDS.
-            std::deque<std::string> words_in_current_line = STRING::String::SplitIntoWords(
-                line,
-                max_characters_per_line);
-
-            // CREATE NEW LINE(S) BASED ON THE CURRENT LINE'S WORDS.
-            std::string current_new_line;
-            while (!words_in_current_line.empty())
-            {
-                // GET THE NEXT WORD TO BE ADDED.
-                std::string next_word = words_in_current_line.front();
-                words_in_current_line.pop_front();
-
-                // CHECK IF THE CURRENT LINE IS EMPTY.
-                if (current_new_line.empty())
-                {
-                    // ADD THE CURRENT WORD TO THE NEW LINE.
-                    // An empty line should always be able to hold at least 1 word.
-                    current_new_line += next_word;
-                }
-                else
-                {
-                    // CHECK IF THE CURRENT LINE CAN HANDLE THE NEXT WORD.
-                    std::shared_ptr<GUI::Font>& font = Fonts[font_id];
-                    GUI::Text current_line_text =
-                    {
-                        .String = current_new_line,
-                        .FontId = font_id,
-                        .LeftTopPosition = MATH::Vector2f(0.0f, 0.0f),
-                        .ScaleFactor = text_scale_ratio,
-                        .Color = text_color
-                    };
-                    size_t current_line_width_in_pixels = current_line_text.Width<size_t>(*font);
-                    size_t space_character_width_in_pixels = GUI::Glyph::DEFAULT_WIDTH_IN_PIXELS / 2;
-                    GUI::Text next_word_text =
-                    {
-                        .String = next_word,
-                        .FontId = font_id,
-                        .LeftTopPosition = MATH::Vector2f(0.0f, 0.0f),
-                        .ScaleFactor = text_scale_ratio,
-                        .Color = text_color
-                    };
-                    size_t next_word_width_in_pixels = next_word_text.Width<size_t>(*font);
-                    size_t line_width_with_next_word_in_characters = 
-                        current_line_width_in_pixels + 
-                        space_character_width_in_pixels + 
-                        next_word_width_in_pixels;
-                    bool current_line_can_handle_next_word = (line_width_with_next_word_in_characters <= line_width_in_pixels);
-                    if (current_line_can_handle_next_word)
-                    {
-                        // ADD A SPACE BEFORE ADDING THE NEW WORD.
-                        const char SPACE_BETWEEN_WORDS = ' ';
-                        current_new_line += SPACE_BETWEEN_WORDS + next_word;
-                    }
-                    else
-                    {
-                        // ADD THE CURRENT NEW LINE TO THE LIST OF LINES.
-                        new_lines_of_text.push_back(current_new_line);
-
-                        // PREPARE FOR THE NEXT NEW LINE OF TEXT.
-                        current_new_line.clear();
-
-                        // ADD THE CURRENT WORD TO THE NEW LINE.
-                        current_new_line += next_word;
-                    }
-                }
-
-                // CHECK IF THERE ARE ANY MORE WORDS TO ADD.
-                bool more_words_left = !words_in_current_line.empty();
-                if (!more_words_left)
-                {
-                    // ADD THE CURRENT NEW LINE IF IT ISN'T EMPTY.
-                    if (!current_new_line.empty())
-                    {
-                        new_lines_of_text.push_back(current_new_line);
-                        current_new_line.clear();
-                    }
-                }
-            }
+        const GUI::TextLayout* text_layout = GetTextLayout(text, font_id, line_width_in_pixels, text_scale_ratio);
+        if (!text_layout)
+        {
+            DEBUGGING::DebugConsole::WriteLine(std::string(text));
+            return;
         }
 
         // CALCULATE THE STARTING POSITION FOR THE FIRST LINE.
@@ -659,7 +611,7 @@ namespace GRAPHICS
         // The starting y-position for the first line is offset from the bounding rectangle's
         // top y-position such that half of the unused space appears before and after the text.
         unsigned int bounding_rectangle_height_in_pixels = static_cast<unsigned int>(bounding_screen_rectangle.Height());
-        size_t new_line_count = new_lines_of_text.size();
+        size_t new_line_count = text_layout->Lines.size();
         unsigned int glyph_height_in_pixels = static_cast<unsigned int>(text_scale_ratio * GUI::Glyph::DEFAULT_HEIGHT_IN_PIXELS);
         size_t total_text_height_in_pixels = new_line_count * glyph_height_in_pixels;
         size_t unused_vertical_space_in_pixels = bounding_rectangle_height_in_pixels - total_text_height_in_pixels;
@@ -672,21 +624,11 @@ namespace GRAPHICS
             first_line_top_y_screen_position);
 
         // RENDER EACH LINE OF TEXT.
-        std::shared_ptr<GUI::Font>& font = Fonts[font_id];
-        for (const auto& line : new_lines_of_text)
+        for (std::size_t line_index = 0; line_index < new_line_count; ++line_index)
         {
-            // CREATE THE GUI FORM OF THE TEXT.
-            GUI::Text current_line_of_text =
-            {
-                .String = line,
-                .FontId = font_id,
-                .LeftTopPosition = current_line_left_top_screen_position,
-                .ScaleFactor = text_scale_ratio,
-                .Color = text_color
-            };
-
             // CENTER THE CURRENT LINE HORIZONTALLY.
-            unsigned int current_line_width_in_pixels = current_line_of_text.Width<unsigned int>(*font);
+            const GUI::TextLineRange& line_range = text_layout->Lines[line_index];
+            unsigned int current_line_width_in_pixels = static_cast<unsigned int>(line_range.WidthInPixels);
             unsigned int bounding_rectangle_width_in_pixels = static_cast<unsigned int>(bounding_screen_rectangle.Width());
             unsigned int unused_space_on_current_line_in_pixels = bounding_rectangle_width_in_pixels - current_line_width_in_pixels;
             unsigned int half_of_unused_space_on_current_line_in_pixels = unused_space_on_current_line_in_pixels / 2;
@@ -694,7 +636,9 @@ namespace GRAPHICS
             current_line_left_top_screen_position.X += half_of_unused_space_on_current_line_in_pixels;
 
             // RENDER THE CURRENT LINE.
-            RenderText(line, font_id, current_line_left_top_screen_position, text_color, text_scale_ratio);
+            std::string_view line = text_layout->GetLine(text, line_index);
+            const GUI::GlyphRun* glyph_run = GetGlyphRun(line, font_id, text_color, text_scale_ratio);
+            Render(*glyph_run, current_line_left_top_screen_position);
 
             // MOVE TO THE NEXT LINE.
             current_line_left_top_screen_position.Y += glyph_height_in_pixels;
@@ -711,7 +655,7 @@ namespace GRAPHICS
     /// \param[in]  border_color - The color for the border.
     /// \param[in]  border_thickness_in_pixels - The thickness of the border in pixels.
     void Renderer::RenderTextInBorderedBox(
-        const std::string& text,
+        const std::string_view text,
         const RESOURCES::AssetId font_id,
         const Color& text_color,
         const MATH::Vector2f& text_padding_in_pixels_from_border,
@@ -719,28 +663,90 @@ namespace GRAPHICS
         const Color& border_color,
         const float border_thickness_in_pixels)
     {
-        // RENDER THE BORDER FOR THE BOX.
-        sf::RectangleShape border;
-
-        border.setFillColor(sf::Color::Transparent);
-        border.setOutlineColor(sf::Color(border_color.Red, border_color.Green, border_color.Blue));
-        border.setOutlineThickness(border_thickness_in_pixels);
-
-        float box_width_in_pixels = bounding_screen_rectangle.Width();
-        float box_height_in_pixels = bounding_screen_rectangle.Height();
-        border.setSize(sf::Vector2f(box_width_in_pixels, box_height_in_pixels));
+        // ATTRIBUTE ANY ALLOCATIONS TO THE GUI.
+        MEMORY::AllocationScope gui_allocation_scope(MEMORY::AllocationTag::GUI);
+
+        // CHECK IF THE BORDER NEEDS TO BE DRAWN.
+        // The border is drawn outside of the box, so it extends beyond the box's normal dimensions.
+        MATH::FloatRectangle border_screen_rectangle = MATH::FloatRectangle::FromLeftTopAndDimensions(
+            bounding_screen_rectangle.LeftTop.X - border_thickness_in_pixels,
+            bounding_screen_rectangle.LeftTop.Y - border_thickness_in_pixels,
+            bounding_screen_rectangle.Width() + 2.0f * border_thickness_in_pixels,
+            bounding_screen_rectangle.Height() + 2.0f * border_thickness_in_pixels);
+        std::size_t border_content_hash = 0;
+        DirtyRegionTracker::CombineHash(border_color, border_content_hash);
+        DirtyRegionTracker::CombineHash(border_thickness_in_pixels, border_content_hash);
+        bool border_needs_drawing = ScreenRegionNeedsDrawing(border_screen_rectangle, border_content_hash);
+        if (border_needs_drawing)
+        {
+            // DEFINE EACH SIDE OF THE BORDER.
+            const MATH::FloatRectangle& box = bounding_screen_rectangle;
+            const std::array<MATH::FloatRectangle, 4> BORDER_SIDES =
+            {
+                // TOP.
+                MATH::FloatRectangle::FromLeftTopAndDimensions(
+                    border_screen_rectangle.LeftTop.X,
+                    border_screen_rectangle.LeftTop.Y,
+                    border_screen_rectangle.Width(),
+                    border_thickness_in_pixels),
+                // BOTTOM.
+                MATH::FloatRectangle::FromLeftTopAndDimensions(
+                    border_screen_rectangle.LeftTop.X,
+                    box.RightBottom.Y,
+                    border_screen_rectangle.Width(),
+                    border_thickness_in_pixels),
+                // LEFT.
+                MATH::FloatRectangle::FromLeftTopAndDimensions(
+                    border_screen_rectangle.LeftTop.X,
+                    box.LeftTop.Y,
+                    border_thickness_in_pixels,
+                    box.Height()),
+                // RIGHT.
+                MATH::FloatRectangle::FromLeftTopAndDimensions(
+                    box.RightBottom.X,
+                    box.LeftTop.Y,
+                    border_thickness_in_pixels,
+                    box.Height()),
+            };
 
-        float box_left_x_position_in_pixels = bounding_screen_rectangle.LeftTop.X;
-        float box_top_y_position_in_pixels = bounding_screen_rectangle.LeftTop.Y;
-        border.setPosition(box_left_x_position_in_pixels, box_top_y_position_in_pixels);
+            // CREATE A QUAD FOR EACH SIDE OF THE BORDER.
+            // The sides are tinted from a solid white icon in the GUI icon atlas so that the border
+            // shares the same texture as other icons.  If the atlas isn't available, the vertex colors
+            // alone still produce the same border.
+            const MATH::FloatRectangle* solid_white_atlas_rectangle = GetCachedGuiIcon(GUI::GuiIcon::SolidWhite());
+            sf::Vector2f solid_white_texture_coordinates(0.0f, 0.0f);
+            if (solid_white_atlas_rectangle)
+            {
+                // The center of the icon is used to avoid sampling any neighboring icons.
+                solid_white_texture_coordinates = sf::Vector2f(solid_white_atlas_rectangle->CenterX(), solid_white_atlas_rectangle->CenterY());
+            }
+            sf::Color sfml_border_color(border_color.Red, border_color.Green, border_color.Blue);
+            constexpr std::size_t VERTEX_COUNT_PER_SIDE = 4;
+            std::array<sf::Vertex, BORDER_SIDES.size() * VERTEX_COUNT_PER_SIDE> border_vertices;
+            for (std::size_t side_index = 0; side_index < BORDER_SIDES.size(); ++side_index)
+            {
+                const MATH::FloatRectangle& side = BORDER_SIDES[side_index];
+                std::size_t first_vertex_index = side_index * VERTEX_COUNT_PER_SIDE;
+                border_vertices[first_vertex_index] = sf::Vertex(sf::Vector2f(side.LeftTop.X, side.LeftTop.Y), sfml_border_color, solid_white_texture_coordinates);
+                border_vertices[first_vertex_index + 1] = sf::Vertex(sf::Vector2f(side.RightBottom.X, side.LeftTop.Y), sfml_border_color, solid_white_texture_coordinates);
+                border_vertices[first_vertex_index + 2] = sf::Vertex(sf::Vector2f(side.RightBottom.X, side.RightBottom.Y), sfml_border_color, solid_white_texture_coordinates);
+                border_vertices[first_vertex_index + 3] = sf::Vertex(sf::Vector2f(side.LeftTop.X, side.RightBottom.Y), sfml_border_color, solid_white_texture_coordinates);
+            }
 
-        Screen->RenderTarget.draw(border);
+            // RENDER ALL SIDES OF THE BORDER AT ONCE.
+            sf::RenderStates border_render_states = sf::RenderStates::Default;
+            if (solid_white_atlas_rectangle)
+            {
+                border_render_states.texture = &GuiIconAtlas->getTexture();
+            }
+            Screen->RenderTarget.draw(border_vertices.data(), border_vertices.size(), sf::Quads, border_render_states);
+        }
 
         // RENDER THE TEXT.
-        float text_left_x_position_in_pixels = box_left_x_position_in_pixels + text_padding_in_pixels_from_border.X;
-        float text_top_y_position_in_pixels = box_top_y_position_in_pixels + text_padding_in_pixels_from_border.Y;
-        float text_box_width_in_pixels = box_width_in_pixels - text_padding_in_pixels_from_border.X;
-        float text_box_height_in_pixels = box_height_in_pixels - text_padding_in_pixels_from_border.Y;
+        float text_left_x_position_in_pixels = bounding_screen_rectangle.LeftTop.X + text_padding_in_pixels_from_border.X;
+        float text_top_y_position_in_pixels = bounding_screen_rectangle.LeftTop.Y + text_padding_in_pixels_from_border.Y;
+        float text_box_width_in_pixels = bounding_screen_rectangle.Width() - text_padding_in_pixels_from_border.X;
+        float text_box_height_in_pixels = bounding_screen_rectangle.Height() - text_padding_in_pixels_from_border.Y;
         MATH::FloatRectangle text_bounding_screen_rectangle = MATH::FloatRectangle::FromLeftTopAndDimensions(
             text_left_x_position_in_pixels,
             text_top_y_position_in_pixels,
@@ -841,10 +847,7 @@ namespace GRAPHICS
         }
 
         // RENDER THE CURRENT TILE MAP'S WOOD LOGS.
-        for (const auto& wood_log : tile_map.WoodLogs)
-        {
-            Render(wood_log.Sprite);
-        }
+        Render(tile_map.Entities, OBJECTS::EntityKind::WOOD_LOGS);
 
         // RENDER THE CURRENT TILE MAP'S TREES.
         for (const auto& tree : tile_map.Trees)
@@ -866,10 +869,7 @@ namespace GRAPHICS
         }
 
         // RENDER THE CURRENT TILE MAP'S FOOD ON THE GROUND.
-        for (const auto& food : tile_map.FoodOnGround)
-        {
-            Render(food.Sprite);
-        }
+        Render(tile_map.Entities, OBJECTS::EntityKind::FOOD);
 
         // RENDER ANY PRESENTS.
         for (const auto& present : tile_map.Presents)
@@ -905,19 +905,251 @@ namespace GRAPHICS
         }
 
         // RENDER THE CURRENT TILE MAP'S DUST CLOUDS.
-        for (const auto& dust_cloud : tile_map.DustClouds)
+        Render(tile_map.Entities, OBJECTS::EntityKind::DUST_CLOUD);
+
+        // RENDER ANY FLAMING SWORD.
+        if (tile_map.FlamingSword)
+        {
+            Render(tile_map.FlamingSword->Sprite);
+        }
+    }
+
+    /// Renders all entities of a specific kind.  Rendering is done one kind at a time
+    /// so that different kinds of entities can be layered properly with other objects.
+    /// @param[in]  entities - The entities to render.
+    /// @param[in]  kind - The kind of entities to render.
+    void Renderer::Render(const OBJECTS::EntityStorage& entities, const OBJECTS::EntityKind kind)
+    {
+        std::size_t entity_count = entities.Count();
+        for (std::size_t entity_index = 0; entity_index < entity_count; ++entity_index)
         {
-            bool dust_cloud_visible = !dust_cloud.HasDisappeared();
-            if (dust_cloud_visible)
+            bool entity_is_kind_to_render = (kind == entities.Kinds[entity_index]);
+            if (entity_is_kind_to_render)
             {
-                Render(dust_cloud.Sprite.CurrentFrameSprite);
+                Render(entities.GetSprite(entity_index));
             }
         }
+    }
 
-        // RENDER ANY FLAMING SWORD.
-        if (tile_map.FlamingSword)
+    /// Determines if something should actually be drawn to a region of the screen, based on how the screen
+    /// is currently being redrawn.  Drawing is recorded if changes to the screen are being recorded.
+    /// @param[in]  screen_rectangle - The rectangle of the screen that would be covered by the drawing.
+    /// @param[in]  content_hash - A hash of everything else affecting how the drawing appears.
+    /// @return True if the drawing should be done; false otherwise.
+    bool Renderer::ScreenRegionNeedsDrawing(const MATH::FloatRectangle& screen_rectangle, const std::size_t content_hash)
+    {
+        switch (RedrawMode)
         {
-            Render(tile_map.FlamingSword->Sprite);
+            case ScreenRedrawMode::RECORDING_CHANGES:
+                ScreenChanges.Record(screen_rectangle, content_hash);
+                return false;
+            case ScreenRedrawMode::CHANGED_REGIONS_ONLY:
+                return ScreenChanges.IsDirty(screen_rectangle);
+            case ScreenRedrawMode::FULL_SCREEN:
+            default:
+                return true;
+        }
+    }
+
+    /// Renders a GUI icon at a position on the screen, using the GUI icon atlas if possible.
+    /// @param[in]  icon - The icon to render.
+    /// @param[in]  left_top_screen_position_in_pixels - The left-top screen position of the icon,
+    ///     including anything (like outlines) extending beyond the icon's normal boundaries.
+    void Renderer::RenderCachedGuiIcon(const GUI::GuiIcon& icon, const MATH::Vector2f& left_top_screen_position_in_pixels)
+    {
+        // CONVERT THE SCREEN POSITION TO A WORLD POSITION.
+        // This is necessary so that the icon can be rendered appropriately on the screen
+        // regardless of how the camera might move around the world.
+        sf::Vector2f left_top_world_position = Screen->RenderTarget.mapPixelToCoords(sf::Vector2i(
+            static_cast<int>(left_top_screen_position_in_pixels.X),
+            static_cast<int>(left_top_screen_position_in_pixels.Y)));
+
+        // GET THE ICON FROM THE ATLAS.
+        const MATH::FloatRectangle* atlas_rectangle = GetCachedGuiIcon(icon);
+        if (!atlas_rectangle)
+        {
+            // RENDER THE ICON DIRECTLY SINCE IT ISN'T IN THE ATLAS.
+            DrawGuiIcon(icon, left_top_world_position, sf::RenderStates::Default, Screen->RenderTarget);
+            return;
+        }
+
+        // RENDER THE ICON AS A SINGLE TEXTURED QUAD FROM THE ATLAS.
+        sf::Sprite icon_sprite(GuiIconAtlas->getTexture(), atlas_rectangle->ToSfmlRectangle<int>());
+        icon_sprite.setPosition(left_top_world_position);
+        Screen->RenderTarget.draw(icon_sprite);
+    }
+
+    /// Gets a GUI icon from the GUI icon atlas, rendering it into the atlas if it hasn't been already.
+    /// @param[in]  icon - The icon to get.
+    /// @return The rectangle of the icon within the atlas, if the icon could be cached; null otherwise.
+    const MATH::FloatRectangle* Renderer::GetCachedGuiIcon(const GUI::GuiIcon& icon)
+    {
+        // CHECK IF THE ICON HAS ALREADY BEEN CACHED.
+        const MATH::FloatRectangle* atlas_rectangle = GuiIcons.Find(icon);
+        if (atlas_rectangle)
+        {
+            return atlas_rectangle;
+        }
+
+        // CREATE THE ATLAS TEXTURE IF IT DOESN'T EXIST YET.
+        if (!GuiIconAtlas)
+        {
+            GuiIconAtlas = std::make_unique<sf::RenderTexture>();
+            bool atlas_created = GuiIconAtlas->create(GUI::GuiIconCache::ATLAS_DIMENSION_IN_PIXELS, GUI::GuiIconCache::ATLAS_DIMENSION_IN_PIXELS);
+            if (atlas_created)
+            {
+                GuiIconAtlas->clear(sf::Color::Transparent);
+            }
+            else
+            {
+                DEBUGGING::DebugConsole::WriteErrorLine("Failed to create GUI icon atlas.");
+            }
+        }
+
+        // Icons can't be cached if the atlas couldn't be created.
+        bool atlas_exists = (GuiIconAtlas->getSize().x > 0);
+        if (!atlas_exists)
+        {
+            return nullptr;
+        }
+
+        // RESERVE SPACE FOR THE ICON IN THE ATLAS.
+        atlas_rectangle = GuiIcons.Add(icon);
+        if (!atlas_rectangle)
+        {
+            return nullptr;
+        }
+
+        // RENDER THE ICON INTO THE ATLAS.
+        // Icons copied from other textures replace the atlas's transparent pixels rather than
+        // blending with them so that partially transparent pixels keep their exact colors.
+        sf::RenderStates atlas_render_states = sf::RenderStates::Default;
+        if (GUI::GuiIconType::TEXTURE_REGION == icon.Type)
+        {
+            atlas_render_states.blendMode = sf::BlendNone;
+        }
+        sf::Vector2f atlas_left_top_position(atlas_rectangle->LeftTop.X, atlas_rectangle->LeftTop.Y);
+        DrawGuiIcon(icon, atlas_left_top_position, atlas_render_states, *GuiIconAtlas);
+        GuiIconAtlas->display();
+
+        return atlas_rectangle;
+    }
+
+    /// Draws a GUI icon to a render target, building it from all of its individual parts.
+    /// @param[in]  icon - The icon to draw.
+    /// @param[in]  left_top_position - The left-top position of the icon in the render target's coordinates,
+    ///     including anything (like outlines) extending beyond the icon's normal boundaries.
+    /// @param[in]  render_states - The render states to use for drawing the icon's shapes or texture.
+    /// @param[in,out]  render_target - The render target to draw to.
+    void Renderer::DrawGuiIcon(
+        const GUI::GuiIcon& icon,
+        const sf::Vector2f& left_top_position,
+        const sf::RenderStates& render_states,
+        sf::RenderTarget& render_target)
+    {
+        switch (icon.Type)
+        {
+            case GUI::GuiIconType::KEY:
+            {
+                // CREATE A SHAPE TO RESEMBLE A KEY ON A KEYBOARD.
+                // The outline is drawn outside of the shape, so the shape must be offset to fit within the icon.
+                sf::Vector2f key_left_top_position = left_top_position + sf::Vector2f(
+                    GUI::GuiIcon::KEY_OUTLINE_THICKNESS_IN_PIXELS,
+                    GUI::GuiIcon::KEY_OUTLINE_THICKNESS_IN_PIXELS);
+                sf::Color background_color(icon.BackgroundColor.Red, icon.BackgroundColor.Green, icon.BackgroundColor.Blue, icon.BackgroundColor.Alpha);
+                sf::Color border_color(icon.BorderColor.Red, icon.BorderColor.Green, icon.BorderColor.Blue, icon.BorderColor.Alpha);
+                switch (icon.Shape)
+                {
+                    case ShapeType::RECTANGLE:
+                    {
+                        sf::RectangleShape key_background_icon;
+                        key_background_icon.setFillColor(background_color);
+                        key_background_icon.setOutlineColor(border_color);
+                        key_background_icon.setOutlineThickness(GUI::GuiIcon::KEY_OUTLINE_THICKNESS_IN_PIXELS);
+                        key_background_icon.setSize(sf::Vector2f(
+                            static_cast<float>(GRAPHICS::GUI::Glyph::DEFAULT_WIDTH_IN_PIXELS),
+                            static_cast<float>(GRAPHICS::GUI::Glyph::DEFAULT_HEIGHT_IN_PIXELS)));
+                        key_background_icon.setPosition(key_left_top_position);
+
+                        // RENDER THE BACKGROUND RECTANGLE FOR THE KEY.
+                        render_target.draw(key_background_icon, render_states);
+                        break;
+                    }
+                    case ShapeType::CIRCLE:
+                    {
+                        sf::CircleShape key_background_icon;
+                        key_background_icon.setFillColor(background_color);
+                        key_background_icon.setOutlineColor(border_color);
+                        key_background_icon.setOutlineThickness(GUI::GuiIcon::KEY_OUTLINE_THICKNESS_IN_PIXELS);
+                        key_background_icon.setRadius(static_cast<float>(GRAPHICS::GUI::Glyph::DEFAULT_WIDTH_IN_PIXELS / 2));
+                        key_background_icon.setPosition(key_left_top_position);
+
+                        // RENDER THE BACKGROUND CIRCLE FOR THE KEY.
+                        render_target.draw(key_background_icon, render_states);
+                        break;
+                    }
+                }
+
+                // GET THE DEFAULT FONT.
+                auto id_with_font = Fonts.find(RESOURCES::AssetId::FONT_TEXTURE);
+                bool font_exists = (id_with_font != Fonts.cend()) && (nullptr != id_with_font->second);
+                if (!font_exists)
+                {
+                    // The text can't be rendered without the font.
+                    return;
+                }
+
+                // GET THE GLYPH FOR THE KEY.
+                auto font = id_with_font->second;
+                GRAPHICS::GUI::Glyph& glyph = font->GlyphsByCharacter[static_cast<unsigned char>(icon.KeyCharacter)];
+
+                // GET THE LEFT POSITION OF THE KEY SPRITE.
+                // It should be offset based on the amount of space on the left of the glyph
+                // in order to center it.
+                float key_glyph_width_in_pixels = glyph.TextureSubRectangle.Width();
+                float space_around_glyph_in_pixels = static_cast<float>(GRAPHICS::GUI::Glyph::DEFAULT_WIDTH_IN_PIXELS) - key_glyph_width_in_pixels;
+                float space_on_left_of_glyph_in_pixels = space_around_glyph_in_pixels / 2.0f;
+
+                // CREATE A SPRITE FOR THE GLYPH.
+                sf::IntRect key_texture_sub_rectangle = glyph.TextureSubRectangle.ToSfmlRectangle<int>();
+                sf::Sprite key_character_sprite(glyph.Texture->TextureResource, key_texture_sub_rectangle);
+                key_character_sprite.setPosition(
+                    key_left_top_position.x + space_on_left_of_glyph_in_pixels,
+                    key_left_top_position.y);
+
+                // RENDER THE GLYPH FOR THE KEY.
+                sf::RenderStates text_render_states = render_states;
+                std::shared_ptr<sf::Shader> colored_text_shader = GraphicsDevice->GetShader(RESOURCES::AssetId::COLORED_TEXTURE_SHADER);
+                if (colored_text_shader)
+                {
+                    text_render_states = ConfigureColoredTextShader(icon.TextColor, *colored_text_shader);
+                }
+                render_target.draw(key_character_sprite, text_render_states);
+                break;
+            }
+            case GUI::GuiIconType::TEXTURE_REGION:
+            {
+                // CREATE A SPRITE FOR THE ICON USING THE TEXTURE INFORMATION.
+                sf::IntRect texture_rectangle = icon.TextureSubRectangle.ToSfmlRectangle<int>();
+                MEMORY::NonNullSharedPointer<GRAPHICS::Texture> texture = GraphicsDevice->GetTexture(icon.TextureId);
+                sf::Sprite gui_icon(texture->TextureResource, texture_rectangle);
+                gui_icon.setPosition(left_top_position);
+
+                // RENDER THE GUI ICON.
+                render_target.draw(gui_icon, render_states);
+                break;
+            }
+            case GUI::GuiIconType::SOLID_WHITE:
+            {
+                MATH::Vector2ui dimensions_in_pixels = icon.DimensionsInPixels();
+                sf::RectangleShape solid_white_rectangle(sf::Vector2f(
+                    static_cast<float>(dimensions_in_pixels.X),
+                    static_cast<float>(dimensions_in_pixels.Y)));
+                solid_white_rectangle.setFillColor(sf::Color::White);
+                solid_white_rectangle.setPosition(left_top_position);
+                render_target.draw(solid_white_rectangle, render_states);
+                break;
+            }
         }
     }
 
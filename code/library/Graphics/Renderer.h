@@ -1,41 +1,62 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <SFML/Graphics.hpp>
 #include <SFML/System.hpp>
 #include "Graphics/AnimatedSprite.h"
 #include "Graphics/Camera.h"
 #include "Graphics/Color.h"
+#include "Graphics/DirtyRegionTracker.h"
 #include "Graphics/GraphicsDevice.h"
 #include "Graphics/Gui/Font.h"
+#include "Graphics/Gui/GlyphRun.h"
+#include "Graphics/Gui/GlyphRunCache.h"
+#include "Graphics/Gui/GuiIconCache.h"
 #include "Graphics/Gui/Text.h"
+#include "Graphics/Gui/TextLayout.h"
+#include "Graphics/Gui/TextLayoutCache.h"
 #include "Graphics/Screen.h"
+#include "Graphics/ShapeType.h"
 #include "Graphics/Sprite.h"
 #include "Graphics/Texture.h"
 #include "Maps/MultiTileMapGrid.h"
 #include "Maps/TileMap.h"
 #include "Math/Rectangle.h"
 #include "Math/Vector2.h"
+#include "Objects/EntityStorage.h"
 #include "Resources/AssetId.h"
 
 namespace GRAPHICS
 {
-    /// Different types of shapes that can be rendered.
-    enum class ShapeType
+    /// The different ways in which the screen may be redrawn each frame.
+    enum class ScreenRedrawMode
     {
-        RECTANGLE = 0,
-        CIRCLE
+        /// The entire screen is cleared, and everything is drawn.
+        FULL_SCREEN = 0,
+        /// Nothing is drawn; drawing is only recorded to detect which regions of the screen changed.
+        RECORDING_CHANGES,
+        /// Only regions of the screen that changed are cleared, and only drawing overlapping them is done.
+        CHANGED_REGIONS_ONLY
     };
 
     /// The main renderer for the game.
     class Renderer
     {
     public:
+        // FRAME SETUP.
+        void BeginFullScreenRedraw();
+        void BeginRecordingScreenChanges();
+        void BeginRedrawingChangedScreenRegions();
+
         // FINAL RENDER RETRIEVAL.
         sf::Sprite RenderFinalScreen(const sf::RenderStates& render_settings = sf::RenderStates::Default);
         sf::Sprite RenderFinalScreenWithTimeOfDayShading();
+        sf::Sprite RetainPreviousScreen();
 
         // LINE RENDERING.
         void RenderLine(const MATH::Vector2f& start_position, const MATH::Vector2f& end_position, const GRAPHICS::Color& color);
@@ -62,26 +83,41 @@ namespace GRAPHICS
         // TEXT RENDERING.
         void Render(const Sprite& sprite);
         void Render(const GUI::Text& text);
+        void Render(
+            const GUI::GlyphRun& glyph_run,
+            const MATH::Vector2f& left_top_screen_position_in_pixels,
+            const std::size_t first_character_index = 0,
+            const std::size_t character_count = GUI::GlyphRun::ALL_CHARACTERS);
+        const GUI::GlyphRun* GetGlyphRun(
+            const std::string_view text,
+            const RESOURCES::AssetId font_id,
+            const Color& text_color = GRAPHICS::Color::BLACK,
+            const float text_scale_ratio = 1.0f);
+        const GUI::TextLayout* GetTextLayout(
+            const std::string_view text,
+            const RESOURCES::AssetId font_id,
+            const float max_line_width_in_pixels,
+            const float text_scale_ratio = 1.0f);
         void RenderText(
-            const std::string& text, 
+            const std::string_view text,
             const RESOURCES::AssetId font_id,
             const MATH::Vector2f& left_top_screen_position_in_pixels,
             const Color& text_color = GRAPHICS::Color::BLACK,
             const float text_scale_ratio = 1.0f);
         void RenderText(
-            const std::string& text,
+            const std::string_view text,
             const RESOURCES::AssetId font_id,
             const MATH::FloatRectangle& bounding_screen_rectangle,
             const Color& text_color = GRAPHICS::Color::BLACK,
             const float text_scale_ratio = 1.0f);
         void RenderCenteredText(
-            const std::string& text,
+            const std::string_view text,
             const RESOURCES::AssetId font_id,
             const MATH::FloatRectangle& bounding_screen_rectangle,
             const Color& text_color = GRAPHICS::Color::BLACK,
             const float text_scale_ratio = 1.0f);
         void RenderTextInBorderedBox(
-            const std::string& text,
+            const std::string_view text,
             const RESOURCES::AssetId font_id,
             const Color& text_color,
             const MATH::Vector2f& text_padding_in_pixels_from_border,
@@ -92,6 +128,7 @@ namespace GRAPHICS
         // OTHER RENDERING.
         void Render(const MAPS::MultiTileMapGrid& tile_map_grid);
         void Render(const MAPS::TileMap& tile_map);
+        void Render(const OBJECTS::EntityStorage& entities, const OBJECTS::EntityKind kind);
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The graphics device to use for rendering.
@@ -102,9 +139,43 @@ namespace GRAPHICS
         GRAPHICS::Camera Camera = GRAPHICS::Camera(MATH::FloatRectangle());
         /// Fonts to use for rendering text.
         std::unordered_map<RESOURCES::AssetId, std::shared_ptr<GRAPHICS::GUI::Font>> Fonts = {};
+        /// Cached layouts of text that has been rendered so that text doesn't need
+        /// to be laid out again each frame.
+        GUI::GlyphRunCache GlyphRuns = {};
+        /// Cached word-wrapped layouts of text that has been rendered within bounding rectangles
+        /// so that text doesn't need to be wrapped again each frame.
+        GUI::TextLayoutCache TextLayouts = {};
+        /// Where pre-rendered GUI icons are within the GUI icon atlas.
+        GUI::GuiIconCache GuiIcons = {};
+        /// Tracks what has changed on the screen between frames so that mostly static
+        /// screens only need to redraw regions that changed.
+        DirtyRegionTracker ScreenChanges = {};
+        /// The number of pixels on the screen that were redrawn during the most recent frame.
+        unsigned int RedrawnPixelCount = 0;
+        /// The total number of pixels on the screen that have been redrawn across all frames.
+        std::uint64_t TotalRedrawnPixelCount = 0;
 
     private:
+        // DIRTY-REGION REDRAWING.
+        bool ScreenRegionNeedsDrawing(const MATH::FloatRectangle& screen_rectangle, const std::size_t content_hash);
+
+        // GUI ICONS.
+        void RenderCachedGuiIcon(const GUI::GuiIcon& icon, const MATH::Vector2f& left_top_screen_position_in_pixels);
+        const MATH::FloatRectangle* GetCachedGuiIcon(const GUI::GuiIcon& icon);
+        void DrawGuiIcon(
+            const GUI::GuiIcon& icon,
+            const sf::Vector2f& left_top_position,
+            const sf::RenderStates& render_states,
+            sf::RenderTarget& render_target);
+
         // SHADERS.
         sf::RenderStates ConfigureColoredTextShader(const Color& color, sf::Shader& colored_text_shader);
+
+        // MEMBER VARIABLES.
+        /// How the screen is currently being redrawn.
+        ScreenRedrawMode RedrawMode = ScreenRedrawMode::FULL_SCREEN;
+        /// The texture atlas holding pre-rendered GUI icons (see GuiIcons).
+        /// Created when the first icon is rendered.
+        std::unique_ptr<sf::RenderTexture> GuiIconAtlas = nullptr;
     };
 }
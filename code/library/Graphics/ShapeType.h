@@ -0,0 +1,11 @@
+#pragma once
+
+namespace GRAPHICS
+{
+    /// Different types of shapes that can be rendered.
+    enum class ShapeType
+    {
+        RECTANGLE = 0,
+        CIRCLE
+    };
+}
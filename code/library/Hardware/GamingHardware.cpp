@@ -11,5 +11,6 @@ namespace HARDWARE
         Screen = GRAPHICS::Screen::Create();
         GraphicsDevice = std::make_shared<GRAPHICS::GraphicsDevice>();
         Speakers = std::make_unique<AUDIO::Speakers>();
+        FrameArena = std::make_unique<MEMORY::FrameArena>();
     }
 }
@@ -1,12 +1,14 @@
 #pragma once
 
 #include <memory>
+#include "Audio/SoundEventScheduler.h"
 #include "Audio/Speakers.h"
 #include "Graphics/GraphicsDevice.h"
 #include "Graphics/Screen.h"
 #include "Hardware/Clock.h"
 #include "Input/InputController.h"
 #include "Math/RandomNumberGenerator.h"
+#include "Memory/FrameArena.h"
 
 /// Holds code related to generic computing hardware.
 /// Computing hardware specific to another subsystem may exist in a separate namespace.
@@ -34,5 +36,11 @@ namespace HARDWARE
         /// The speakers out of which audio can be played.
         /// Dynamically allocated since the speakers have a mutex that prevents copying/moving.
         std::unique_ptr<AUDIO::Speakers> Speakers = nullptr;
+        /// The scheduler for sounds coming from things in the world (like animals),
+        /// which are submitted to the speakers once per frame.
+        AUDIO::SoundEventScheduler SoundScheduler = {};
+        /// The arena for temporary memory that only needs to last for the current frame.
+        /// Dynamically allocated since the arena can't be copied/moved.
+        std::unique_ptr<MEMORY::FrameArena> FrameArena = nullptr;
     };
 }
@@ -1,37 +1,41 @@
+#include <cstddef>
+#include <cstdint>
+#include <utility>
 #include "ErrorHandling/Asserts.h"
 #include "Maps/Ark.h"
 #include "Maps/Tileset.h"
-#include "Maps/Data/ArkInteriorTileMapData.h"
 #include "Resources/AnimalGraphics.h"
 #include "Resources/AnimalSounds.h"
 
 namespace MAPS
 {
-    /// Constructor.  Populates the ark interior based on data read from in-memory assets.
-    /// @param[in]  world - The world this ark exists in.
-    Ark::Ark(MEMORY::NonNullRawPointer<World> world) :
+    /// Constructor.  Creates an empty ark.  The ark interior is only populated based on data
+    /// read from in-memory assets when reset to its initial state (which the world does once
+    /// it is fully constructed), so that tile maps aren't needlessly created multiple times.
+    Ark::Ark() :
         Interior()
-    {
-        ResetToInitialState(world);
-    }
+    {}
 
     /// Resets the ark to its initial state.  Useful for switching between different saved games.
     /// @param[in]  world - The world this ark exists in.
-    void Ark::ResetToInitialState(MEMORY::NonNullRawPointer<World> world)
+    /// @param[in]  interior_layer_map_data_from_bottom_to_top - The raw data for the tile maps in each layer of the interior.
+    void Ark::ResetToInitialState(
+        MEMORY::NonNullRawPointer<World> world,
+        const std::vector<CONTAINERS::Array2D<DATA::TileMapData>>& interior_layer_map_data_from_bottom_to_top)
     {
         // CLEAR ANY PREVIOUS INFORMATION IN THE INTERIOR.
         Interior.LayersFromBottomToTop.clear();
 
         // LOAD TILE MAPS FOR EACH LAYER INTO THE ARK INTERIOR.
         Tileset tileset;
-        std::size_t layer_count = DATA::ARK_INTERIOR_LAYER_DATA_FROM_BOTTOM_TO_TOP.size();
+        std::size_t layer_count = interior_layer_map_data_from_bottom_to_top.size();
         // Space for the layers must be reserved to avoid reallocations that would invalidate pointers.
         /// @todo   Maybe this means we should go with shared pointers?
         Interior.LayersFromBottomToTop.reserve(layer_count);
         for (std::size_t layer_index = 0; layer_index < layer_count; ++layer_index)
         {
             // CREATE AN EMPTY MAP GRID FOR THE CURRENT LAYER.
-            auto& current_layer_data = DATA::ARK_INTERIOR_LAYER_DATA_FROM_BOTTOM_TO_TOP[layer_index];
+            const auto& current_layer_data = interior_layer_map_data_from_bottom_to_top[layer_index];
             Interior.LayersFromBottomToTop.emplace_back(Ark::INTERIOR_WIDTH_IN_TILE_MAPS, Ark::INTERIOR_HEIGHT_IN_TILE_MAPS, world);
             auto& current_map_layer = Interior.LayersFromBottomToTop.back();
 
@@ -67,7 +71,24 @@ namespace MAPS
                         map_dimensions_in_tiles);
 
                     // GET THE CURRENT TILE MAP.
-                    const auto& tile_map_data = (*current_layer_data)(column, row);
+                    const CONTAINERS::Array2D<std::uint8_t>& tile_map_data = *current_layer_data(column, row).GroundLayer;
+
+                    // RESERVE SPACE FOR ANIMAL PENS IN THE TILE MAP.
+                    // Animal pens are counted up-front so that their container doesn't have to grow as pens are added.
+                    std::size_t animal_pen_count = 0;
+                    for (unsigned int current_tile_y = 0; current_tile_y < MAPS::TileMap::HEIGHT_IN_TILES; ++current_tile_y)
+                    {
+                        for (unsigned int current_tile_x = 0; current_tile_x < MAPS::TileMap::WIDTH_IN_TILES; ++current_tile_x)
+                        {
+                            MAPS::TileId tile_id = tile_map_data(current_tile_x, current_tile_y);
+                            bool is_animal_pen_entrance = (TileType::ANIMAL_PEN_ENTRANCE == static_cast<TileType::Id>(tile_id));
+                            if (is_animal_pen_entrance)
+                            {
+                                ++animal_pen_count;
+                            }
+                        }
+                    }
+                    tile_map->AnimalPens.reserve(animal_pen_count);
 
                     // CREATE TILES IN THE GROUND LAYER.
                     for (unsigned int current_tile_y = 0;
@@ -80,7 +101,7 @@ namespace MAPS
                             ++current_tile_x)
                         {
                             // CREATE THE CURRENT TILE.
-                            MAPS::TileId tile_id = (*tile_map_data)(current_tile_x, current_tile_y);
+                            MAPS::TileId tile_id = tile_map_data(current_tile_x, current_tile_y);
                             std::shared_ptr<MAPS::Tile> tile = tileset.CreateTile(tile_id);
                             bool tile_exists_in_tileset = (nullptr != tile);
                             if (!tile_exists_in_tileset)
@@ -98,37 +119,15 @@ namespace MAPS
                             if (is_animal_pen_entrance)
                             {
                                 // ADD AN ANIMAL PEN TO THE MAP.
-                                // For simplicity, all animal pens have the same structure, with the
-                                // entrance (marked by E below) and then an set of walls (W).
-                                // That means the interior bounds can be computed given the entrance.
-                                // W W W W W
-                                // W       W
-                                // W       W
-                                // W       W
-                                // W W E W W
-                                AnimalPen animal_pen;
-                                animal_pen.TileMapLayerIndex = static_cast<unsigned int>(layer_index);
-                                animal_pen.TileMapColumnIndex = column;
-                                animal_pen.TileMapRowIndex = row;
-                                animal_pen.AnimalPenIndex = static_cast<unsigned int>(tile_map->AnimalPens.size());
-                                constexpr float ANIMAL_PEN_INTERIOR_DIMENSION_IN_TILES = 3;
-                                constexpr float ANIMAL_PEN_INTERIOR_DIMENSION_IN_PIXELS = ANIMAL_PEN_INTERIOR_DIMENSION_IN_TILES * Tile::DIMENSION_IN_PIXELS<float>;
-                                constexpr float ANIMAL_PEN_HALF_INTERIOR_DIMENSION_IN_TILES = ANIMAL_PEN_INTERIOR_DIMENSION_IN_TILES / 2.0f;
-                                constexpr float ANIMAL_PEN_HALF_INTERIOR_DIMENSION_IN_PIXELS = ANIMAL_PEN_HALF_INTERIOR_DIMENSION_IN_TILES * Tile::DIMENSION_IN_PIXELS<float>;
-                                MATH::Vector2f entrance_center_world_position = tile->Sprite.GetWorldPosition();
-                                float animal_pen_interior_center_y_position = entrance_center_world_position.Y - ANIMAL_PEN_HALF_INTERIOR_DIMENSION_IN_PIXELS;
-                                animal_pen.InteriorBoundingBox = MATH::FloatRectangle::FromCenterAndDimensions(
-                                    entrance_center_world_position.X,
-                                    animal_pen_interior_center_y_position,
-                                    ANIMAL_PEN_INTERIOR_DIMENSION_IN_PIXELS,
-                                    ANIMAL_PEN_INTERIOR_DIMENSION_IN_PIXELS);
+                                unsigned int animal_pen_index = static_cast<unsigned int>(tile_map->AnimalPens.size());
+                                AnimalPen animal_pen = CreateAnimalPen(static_cast<unsigned int>(layer_index), column, row, animal_pen_index, *tile);
                                 tile_map->AnimalPens.emplace_back(animal_pen);
                             }
                         }
                     }
 
                     // STORE THE TILE MAP OF THE ARK INTERIOR.
-                    current_map_layer.TileMaps(column, row) = tile_map;
+                    current_map_layer.TileMaps(column, row) = std::move(tile_map);
                 }
             }
         }
@@ -163,7 +162,12 @@ namespace MAPS
                 for (unsigned int column = 0; column < Ark::INTERIOR_WIDTH_IN_TILE_MAPS; ++column)
                 {
                     // GET THE CURRENT TILE MAP.
-                    auto& current_tile_map = current_map_layer.TileMaps(column, row);
+                    // It's retrieved for changing since exit points may be added to it.
+                    TileMap* current_tile_map = current_map_layer.GetTileMapForChanging(row, column);
+                    ASSERT_THEN_IF_NOT(current_tile_map)
+                    {
+                        continue;
+                    }
 
                     // CHECK TILES ACROSS ALL ROWS.
                     for (unsigned int current_tile_y = 0;
@@ -190,13 +194,13 @@ namespace MAPS
                                 // ADD AN EXIT POINT TO THE ABOVE FLOOR IF ONE EXISTS.
                                 if (next_map_layer)
                                 {
-                                    auto& above_tile_map = next_map_layer->TileMaps(column, row);
+                                    TileMap* above_tile_map = next_map_layer->GetTileMap(row, column);
 
                                     MAPS::ExitPoint ark_floor_exit_point;
                                     MATH::FloatRectangle tile_bounding_box = current_tile->Sprite.GetWorldBoundingBox();
                                     ark_floor_exit_point.BoundingBox = tile_bounding_box;
                                     ark_floor_exit_point.NewMapGrid = next_map_layer;
-                                    ark_floor_exit_point.NewTileMap = &*above_tile_map.get();
+                                    ark_floor_exit_point.NewTileMap = above_tile_map;
                                     ark_floor_exit_point.NewPlayerWorldPosition = tile_bounding_box.Center();
 
                                     current_tile_map->ExitPoints.push_back(ark_floor_exit_point);
@@ -210,13 +214,13 @@ namespace MAPS
                                 // ADD AN EXIT POINT TO THE BELOW FLOOR IF ONE EXISTS.
                                 if (previous_map_layer)
                                 {
-                                    auto& below_tile_map = previous_map_layer->TileMaps(column, row);
+                                    TileMap* below_tile_map = previous_map_layer->GetTileMap(row, column);
 
                                     MAPS::ExitPoint ark_floor_exit_point;
                                     MATH::FloatRectangle tile_bounding_box = current_tile->Sprite.GetWorldBoundingBox();
                                     ark_floor_exit_point.BoundingBox = tile_bounding_box;
                                     ark_floor_exit_point.NewMapGrid = previous_map_layer;
-                                    ark_floor_exit_point.NewTileMap = &*below_tile_map.get();
+                                    ark_floor_exit_point.NewTileMap = below_tile_map;
                                     ark_floor_exit_point.NewPlayerWorldPosition = tile_bounding_box.Center();
 
                                     current_tile_map->ExitPoints.push_back(ark_floor_exit_point);
@@ -229,6 +233,47 @@ namespace MAPS
         }
     }
 
+    /// Creates an empty animal pen for an entrance tile.
+    /// @param[in]  tile_map_layer_index - The layer index of the tile map containing the pen.
+    /// @param[in]  tile_map_column_index - The column index of the tile map containing the pen.
+    /// @param[in]  tile_map_row_index - The row index of the tile map containing the pen.
+    /// @param[in]  animal_pen_index - The index of the animal pen within the tile map.
+    /// @param[in]  entrance_tile - The (positioned) tile for the entrance to the animal pen.
+    /// @return The animal pen.
+    AnimalPen Ark::CreateAnimalPen(
+        const unsigned int tile_map_layer_index,
+        const unsigned int tile_map_column_index,
+        const unsigned int tile_map_row_index,
+        const unsigned int animal_pen_index,
+        const Tile& entrance_tile)
+    {
+        // For simplicity, all animal pens have the same structure, with the
+        // entrance (marked by E below) and then an set of walls (W).
+        // That means the interior bounds can be computed given the entrance.
+        // W W W W W
+        // W       W
+        // W       W
+        // W       W
+        // W W E W W
+        AnimalPen animal_pen;
+        animal_pen.TileMapLayerIndex = tile_map_layer_index;
+        animal_pen.TileMapColumnIndex = tile_map_column_index;
+        animal_pen.TileMapRowIndex = tile_map_row_index;
+        animal_pen.AnimalPenIndex = animal_pen_index;
+        constexpr float ANIMAL_PEN_INTERIOR_DIMENSION_IN_TILES = 3;
+        constexpr float ANIMAL_PEN_INTERIOR_DIMENSION_IN_PIXELS = ANIMAL_PEN_INTERIOR_DIMENSION_IN_TILES * Tile::DIMENSION_IN_PIXELS<float>;
+        constexpr float ANIMAL_PEN_HALF_INTERIOR_DIMENSION_IN_TILES = ANIMAL_PEN_INTERIOR_DIMENSION_IN_TILES / 2.0f;
+        constexpr float ANIMAL_PEN_HALF_INTERIOR_DIMENSION_IN_PIXELS = ANIMAL_PEN_HALF_INTERIOR_DIMENSION_IN_TILES * Tile::DIMENSION_IN_PIXELS<float>;
+        MATH::Vector2f entrance_center_world_position = entrance_tile.Sprite.GetWorldPosition();
+        float animal_pen_interior_center_y_position = entrance_center_world_position.Y - ANIMAL_PEN_HALF_INTERIOR_DIMENSION_IN_PIXELS;
+        animal_pen.InteriorBoundingBox = MATH::FloatRectangle::FromCenterAndDimensions(
+            entrance_center_world_position.X,
+            animal_pen_interior_center_y_position,
+            ANIMAL_PEN_INTERIOR_DIMENSION_IN_PIXELS,
+            ANIMAL_PEN_INTERIOR_DIMENSION_IN_PIXELS);
+        return animal_pen;
+    }
+
     /// Initializes animal pens with appropriate animals based on the provided data.
     /// @param[in]  collected_animals_by_species_then_gender - The collected animal statistics.
     void Ark::InitializeAnimalPens(
@@ -251,7 +296,7 @@ namespace MAPS
                 
                 // GET THE APPROPRIATE ANIMAL PEN.
                 MAPS::MultiTileMapGrid& map_layer = Interior.LayersFromBottomToTop[animal_collection_statistics.AnimalPenTileMapLayerIndex];
-                MAPS::TileMap* tile_map = map_layer.GetTileMap(animal_collection_statistics.AnimalPenTileMapRowIndex, animal_collection_statistics.AnimalPenTileMapColumnIndex);
+                MAPS::TileMap* tile_map = map_layer.GetTileMapForChanging(animal_collection_statistics.AnimalPenTileMapRowIndex, animal_collection_statistics.AnimalPenTileMapColumnIndex);
                 ASSERT_THEN_IF(tile_map)
                 {
                     MAPS::AnimalPen& animal_pen = tile_map->AnimalPens[animal_collection_statistics.AnimalPenTileMapPenIndex];
@@ -285,14 +330,34 @@ namespace MAPS
         }
     }
 
-    /// Gets the entrance map into the ark.
-    /// @return The entrance map to the ark.
-    std::shared_ptr<TileMap> Ark::GetEntranceMap() const
+    /// Gets the entrance map into the ark for reading.
+    /// @return The entrance map to the ark, if the ark interior has been built.
+    const TileMap* Ark::GetEntranceMap() const
     {
+        // MAKE SURE THE ARK INTERIOR HAS BEEN BUILT.
+        if (Interior.LayersFromBottomToTop.empty())
+        {
+            return nullptr;
+        }
+
         const MultiTileMapGrid& lowest_layer = Interior.LayersFromBottomToTop[LOWEST_LAYER_INDEX];
-        constexpr unsigned int ENTRANCE_MAP_COLUMN_POSITION = 1;
-        constexpr unsigned int ENTRANCE_MAP_ROW_POSITION = 0;
-        const std::shared_ptr<TileMap>& entrance_map = lowest_layer.TileMaps(ENTRANCE_MAP_COLUMN_POSITION, ENTRANCE_MAP_ROW_POSITION);
+        const TileMap* entrance_map = lowest_layer.GetTileMap(ENTRANCE_MAP_ROW, ENTRANCE_MAP_COLUMN);
+        return entrance_map;
+    }
+
+    /// Gets the entrance map into the ark for changing it, which marks it as changed from its
+    /// initial state so that the changes are undone if the world is reset.
+    /// @return The entrance map to the ark, if the ark interior has been built.
+    TileMap* Ark::GetEntranceMapForChanging()
+    {
+        // MAKE SURE THE ARK INTERIOR HAS BEEN BUILT.
+        if (Interior.LayersFromBottomToTop.empty())
+        {
+            return nullptr;
+        }
+
+        MultiTileMapGrid& lowest_layer = Interior.LayersFromBottomToTop[LOWEST_LAYER_INDEX];
+        TileMap* entrance_map = lowest_layer.GetTileMapForChanging(ENTRANCE_MAP_ROW, ENTRANCE_MAP_COLUMN);
         return entrance_map;
     }
 
@@ -306,8 +371,11 @@ namespace MAPS
         // SEARCH FOR AN APPROPRIATE PEN.
         // If a pen already exists for the animal species, the animal should be placed in it.
         // Otherwise, the animal should go into first empty pen.
+        // The tile maps containing the pens are also tracked so that they can be marked as changed.
         MAPS::AnimalPen* animal_pen_for_species = nullptr;
+        MAPS::TileMap* animal_pen_for_species_tile_map = nullptr;
         MAPS::AnimalPen* first_empty_animal_pen = nullptr;
+        MAPS::TileMap* first_empty_animal_pen_tile_map = nullptr;
         for (auto& ark_interior_layer : Interior.LayersFromBottomToTop)
         {
             // CHECK EACH TILE MAP IN THE LAYER.
@@ -318,9 +386,7 @@ namespace MAPS
                 for (unsigned int tile_map_column_index = 0; tile_map_column_index < width_in_tile_maps; ++tile_map_column_index)
                 {
                     // MAKE SURE THE CURRENT TILE MAP EXISTS.
-                    std::shared_ptr<MAPS::TileMap>& current_tile_map = ark_interior_layer.TileMaps(
-                        tile_map_column_index, 
-                        tile_map_row_index);
+                    MAPS::TileMap* current_tile_map = ark_interior_layer.GetTileMap(tile_map_row_index, tile_map_column_index);
                     if (!current_tile_map)
                     {
                         continue;
@@ -337,6 +403,7 @@ namespace MAPS
                             if (animal_pen_matches_species)
                             {
                                 animal_pen_for_species = &animal_pen;
+                                animal_pen_for_species_tile_map = current_tile_map;
                             }
                         }
 
@@ -348,6 +415,7 @@ namespace MAPS
                             if (animal_pen_empty)
                             {
                                 first_empty_animal_pen = &animal_pen;
+                                first_empty_animal_pen_tile_map = current_tile_map;
                             }
                         }
                     }
@@ -359,6 +427,7 @@ namespace MAPS
         if (animal_pen_for_species)
         {
             // MOVE THE ANIMAL INTO THE PEN.
+            animal_pen_for_species_tile_map->MarkChangedFromInitialState();
             MATH::Vector2f animal_pen_center = animal_pen_for_species->InteriorBoundingBox.Center();
             animal->Sprite.SetWorldPosition(animal_pen_center);
             animal_pen_for_species->Animals.emplace_back(animal);
@@ -377,6 +446,7 @@ namespace MAPS
         if (first_empty_animal_pen)
         {
             // MOVE THE ANIMAL INTO THE PEN.
+            first_empty_animal_pen_tile_map->MarkChangedFromInitialState();
             MATH::Vector2f animal_pen_center = first_empty_animal_pen->InteriorBoundingBox.Center();
             animal->Sprite.SetWorldPosition(animal_pen_center);
             first_empty_animal_pen->Animals.emplace_back(animal);
@@ -1,8 +1,13 @@
 #pragma once
 
 #include <optional>
+#include <vector>
+#include "Containers/Array2D.h"
 #include "Containers/NestedArray.h"
+#include "Maps/AnimalPen.h"
+#include "Maps/Data/TileMapData.h"
 #include "Maps/LayeredMultiTileMapGrids.h"
+#include "Maps/Tile.h"
 #include "Maps/TileMap.h"
 #include "Memory/Pointers.h"
 #include "Objects/Animal.h"
@@ -28,17 +33,30 @@ namespace MAPS
         static constexpr unsigned int HIGHEST_LAYER_INDEX = 2;
         /// The number of layers in the ark.
         static constexpr unsigned int LAYER_COUNT = 3;
+        /// The row of the entrance map within the lowest map layer.
+        static constexpr unsigned int ENTRANCE_MAP_ROW = 0;
+        /// The column of the entrance map within the lowest map layer.
+        static constexpr unsigned int ENTRANCE_MAP_COLUMN = 1;
 
         // CONSTRUCTION.
-        explicit Ark(MEMORY::NonNullRawPointer<World> world);
+        explicit Ark();
 
         // INITIALIZATION.
-        void ResetToInitialState(MEMORY::NonNullRawPointer<World> world);
+        void ResetToInitialState(
+            MEMORY::NonNullRawPointer<World> world,
+            const std::vector<CONTAINERS::Array2D<DATA::TileMapData>>& interior_layer_map_data_from_bottom_to_top);
         void InitializeAnimalPens(
             const CONTAINERS::NestedEnumArray<INVENTORY::AnimalCollectionStatistics, OBJECTS::AnimalSpecies, OBJECTS::AnimalGender>& collected_animals_by_species_then_gender);
+        static AnimalPen CreateAnimalPen(
+            const unsigned int tile_map_layer_index,
+            const unsigned int tile_map_column_index,
+            const unsigned int tile_map_row_index,
+            const unsigned int animal_pen_index,
+            const Tile& entrance_tile);
 
         // OTHER PUBLIC METHODS.
-        std::shared_ptr<TileMap> GetEntranceMap() const;
+        const TileMap* GetEntranceMap() const;
+        TileMap* GetEntranceMapForChanging();
         void AddAnimalToPen(
             const MEMORY::NonNullSharedPointer<OBJECTS::Animal>& animal,
             STATES::SavedGameData& game_data);
@@ -1,68 +0,0 @@
-#include "Maps/Data/OverworldMapData.h"
-#include "Maps/Overworld.h"
-
-namespace MAPS
-{
-namespace DATA
-{
-    const CONTAINERS::Array2D<TileMapData> OVERWORLD_MAP_DATA(Overworld::WIDTH_IN_TILE_MAPS, Overworld::HEIGHT_IN_TILE_MAPS,
-    {
-        // ROW 0.
-        TileMapData(&TILE_MAP_0_0_GROUND_LAYER, NO_LAYER, &TILE_MAP_0_0_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_1_0_GROUND_LAYER, &TILE_MAP_1_0_ARK_LAYER, NO_LAYER),
-        TileMapData(&TILE_MAP_2_0_GROUND_LAYER, &TILE_MAP_2_0_ARK_LAYER, NO_LAYER),
-        TileMapData(&TILE_MAP_3_0_GROUND_LAYER, &TILE_MAP_3_0_ARK_LAYER, NO_LAYER),
-        TileMapData(&TILE_MAP_4_0_GROUND_LAYER, NO_LAYER, &TILE_MAP_4_0_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_5_0_GROUND_LAYER, NO_LAYER, &TILE_MAP_5_0_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_6_0_GROUND_LAYER, NO_LAYER, NO_LAYER),
-        // ROW 1.
-        TileMapData(&TILE_MAP_0_1_GROUND_LAYER, NO_LAYER, NO_LAYER),
-        TileMapData(&TILE_MAP_1_1_GROUND_LAYER, NO_LAYER, NO_LAYER),
-        TileMapData(&TILE_MAP_2_1_GROUND_LAYER, NO_LAYER, &TILE_MAP_2_1_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_3_1_GROUND_LAYER, NO_LAYER, &TILE_MAP_3_1_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_4_1_GROUND_LAYER, NO_LAYER, &TILE_MAP_4_1_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_5_1_GROUND_LAYER, NO_LAYER, &TILE_MAP_5_1_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_6_1_GROUND_LAYER, NO_LAYER, &TILE_MAP_6_1_OBJECT_LAYER),
-        // ROW 2.
-        TileMapData(&TILE_MAP_0_2_GROUND_LAYER, NO_LAYER, NO_LAYER),
-        TileMapData(&TILE_MAP_1_2_GROUND_LAYER, NO_LAYER, NO_LAYER),
-        TileMapData(&TILE_MAP_2_2_GROUND_LAYER, NO_LAYER, &TILE_MAP_2_2_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_3_2_GROUND_LAYER, NO_LAYER, &TILE_MAP_3_2_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_4_2_GROUND_LAYER, NO_LAYER, &TILE_MAP_4_2_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_5_2_GROUND_LAYER, NO_LAYER, &TILE_MAP_5_2_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_6_2_GROUND_LAYER, NO_LAYER, &TILE_MAP_6_2_OBJECT_LAYER),
-        // ROW 3.
-        TileMapData(&TILE_MAP_0_3_GROUND_LAYER, NO_LAYER, &TILE_MAP_0_3_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_1_3_GROUND_LAYER, NO_LAYER, &TILE_MAP_1_3_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_2_3_GROUND_LAYER, NO_LAYER, &TILE_MAP_2_3_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_3_3_GROUND_LAYER, NO_LAYER, &TILE_MAP_3_3_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_4_3_GROUND_LAYER, NO_LAYER, &TILE_MAP_4_3_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_5_3_GROUND_LAYER, NO_LAYER, NO_LAYER),
-        TileMapData(&TILE_MAP_6_3_GROUND_LAYER, NO_LAYER, &TILE_MAP_6_3_OBJECT_LAYER),
-        // ROW 4.
-        TileMapData(&TILE_MAP_0_4_GROUND_LAYER, NO_LAYER, &TILE_MAP_0_4_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_1_4_GROUND_LAYER, NO_LAYER, NO_LAYER),
-        TileMapData(&TILE_MAP_2_4_GROUND_LAYER, NO_LAYER, &TILE_MAP_2_4_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_3_4_GROUND_LAYER, NO_LAYER, &TILE_MAP_3_4_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_4_4_GROUND_LAYER, NO_LAYER, &TILE_MAP_4_4_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_5_4_GROUND_LAYER, NO_LAYER, NO_LAYER),
-        TileMapData(&TILE_MAP_6_4_GROUND_LAYER, NO_LAYER, &TILE_MAP_6_4_OBJECT_LAYER),
-        // ROW 5.
-        TileMapData(&TILE_MAP_0_5_GROUND_LAYER, NO_LAYER, &TILE_MAP_0_5_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_1_5_GROUND_LAYER, NO_LAYER, NO_LAYER),
-        TileMapData(&TILE_MAP_2_5_GROUND_LAYER, NO_LAYER, &TILE_MAP_2_5_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_3_5_GROUND_LAYER, NO_LAYER, &TILE_MAP_3_5_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_4_5_GROUND_LAYER, NO_LAYER, &TILE_MAP_4_5_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_5_5_GROUND_LAYER, NO_LAYER, &TILE_MAP_5_5_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_6_5_GROUND_LAYER, NO_LAYER, &TILE_MAP_6_5_OBJECT_LAYER),
-        // ROW 6.
-        TileMapData(&TILE_MAP_0_6_GROUND_LAYER, NO_LAYER, &TILE_MAP_0_6_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_1_6_GROUND_LAYER, NO_LAYER, &TILE_MAP_1_6_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_2_6_GROUND_LAYER, NO_LAYER, NO_LAYER),
-        TileMapData(&TILE_MAP_3_6_GROUND_LAYER, NO_LAYER, &TILE_MAP_3_6_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_4_6_GROUND_LAYER, NO_LAYER, &TILE_MAP_4_6_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_5_6_GROUND_LAYER, NO_LAYER, &TILE_MAP_5_6_OBJECT_LAYER),
-        TileMapData(&TILE_MAP_6_6_GROUND_LAYER, NO_LAYER, &TILE_MAP_6_6_OBJECT_LAYER),
-    });
-}
-}
@@ -1,13 +0,0 @@
-#pragma once
-
-#include "Containers/Array2D.h"
-#include "Maps/Data/TileMapData.h"
-
-namespace MAPS
-{
-/// Holds raw data related to maps.
-namespace DATA
-{
-    extern const CONTAINERS::Array2D<TileMapData> OVERWORLD_MAP_DATA;
-}
-}
@@ -1,130 +1,29 @@
 #pragma once
 
 #include <cstdint>
+#include <optional>
 #include "Containers/Array2D.h"
 
 namespace MAPS
 {
+/// Holds raw data related to maps.
 namespace DATA
 {
-    // COLUMN 0 MAP DATA.
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_0_0_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_0_0_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_0_1_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_0_2_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_0_3_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_0_3_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_0_4_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_0_4_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_0_5_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_0_5_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_0_6_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_0_6_OBJECT_LAYER;
-
-    // COLUMN 1 MAP DATA.
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_1_0_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_1_0_ARK_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_1_1_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_1_2_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_1_3_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_1_3_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_1_4_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_1_5_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_1_6_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_1_6_OBJECT_LAYER;
-
-    // COLUMN 2 MAP DATA.
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_2_0_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_2_0_ARK_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_2_1_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_2_1_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_2_2_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_2_2_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_2_3_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_2_3_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_2_4_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_2_4_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_2_5_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_2_5_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_2_6_GROUND_LAYER;
-
-    // COLUMN 3 MAP DATA.
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_3_0_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_3_0_ARK_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_3_1_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_3_1_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_3_2_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_3_2_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_3_3_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_3_3_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_3_4_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_3_4_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_3_5_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_3_5_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_3_6_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_3_6_OBJECT_LAYER;
-
-    // COLUMN 4 MAP DATA.
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_4_0_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_4_0_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_4_1_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_4_1_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_4_2_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_4_2_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_4_3_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_4_3_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_4_4_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_4_4_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_4_5_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_4_5_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_4_6_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_4_6_OBJECT_LAYER;
-
-    // COLUMN 5 MAP DATA.
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_5_0_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_5_0_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_5_1_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_5_1_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_5_2_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_5_2_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_5_3_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_5_4_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_5_5_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_5_5_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_5_6_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_5_6_OBJECT_LAYER;
-
-    // COLUMN 6 MAP DATA.
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_6_0_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_6_1_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_6_1_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_6_2_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_6_2_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_6_3_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_6_3_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_6_4_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_6_4_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_6_5_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_6_5_OBJECT_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_6_6_GROUND_LAYER;
-    extern const CONTAINERS::Array2D<uint8_t> TILE_MAP_6_6_OBJECT_LAYER;
-
-    extern const CONTAINERS::Array2D<uint8_t>* NO_LAYER;
-
+    /// The raw data for a single tile map, as read from a map file (see \ref MAPS::TileMapFile).
+    /// Each layer holds one ID per tile in the tile map.
     struct TileMapData
     {
-        const CONTAINERS::Array2D<uint8_t>* GroundLayer;
-        const CONTAINERS::Array2D<uint8_t>* ArkLayer;
-        const CONTAINERS::Array2D<uint8_t>* ObjectLayer;
-
-        explicit TileMapData(
-            const CONTAINERS::Array2D<uint8_t>* ground_layer,
-            const CONTAINERS::Array2D<uint8_t>* ark_layer,
-            const CONTAINERS::Array2D<uint8_t>* object_layer) :
-            GroundLayer(ground_layer),
-            ArkLayer(ark_layer),
-            ObjectLayer(object_layer)
-        {}
+        /// IDs of ground tiles.
+        std::optional<CONTAINERS::Array2D<std::uint8_t>> GroundLayer = std::nullopt;
+        /// IDs of ark pieces (0 if a tile has no ark piece).  Only present for tile maps with ark pieces.
+        std::optional<CONTAINERS::Array2D<std::uint8_t>> ArkLayer = std::nullopt;
+        /// IDs of other objects like trees (0 if a tile has no object).  Only present for tile maps with such objects.
+        std::optional<CONTAINERS::Array2D<std::uint8_t>> ObjectLayer = std::nullopt;
+
+        /// Equality operator.
+        /// @param[in]  rhs - The tile map data to compare with.
+        /// @return True if both tile maps have the same layers with the same data; false otherwise.
+        bool operator==(const TileMapData& rhs) const = default;
     };
 }
 }
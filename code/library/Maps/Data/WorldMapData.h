@@ -0,0 +1,26 @@
+#pragma once
+
+#include <vector>
+#include "Containers/Array2D.h"
+#include "Maps/Data/TileMapData.h"
+
+namespace MAPS
+{
+namespace DATA
+{
+    /// The raw data for all tile maps in the world, from which the world is built.
+    struct WorldMapData
+    {
+        /// Data for the tile maps in the overworld.
+        CONTAINERS::Array2D<TileMapData> Overworld = CONTAINERS::Array2D<TileMapData>();
+        /// Data for the tile maps in each layer of the ark interior, from the bottom layer to the top.
+        /// Ark interior tile maps only have ground layers.
+        std::vector<CONTAINERS::Array2D<TileMapData>> ArkInteriorLayersFromBottomToTop = {};
+
+        /// Equality operator.
+        /// @param[in]  rhs - The map data to compare with.
+        /// @return True if both sets of map data are the same; false otherwise.
+        bool operator==(const WorldMapData& rhs) const = default;
+    };
+}
+}
@@ -1,7 +1,13 @@
-#include <fstream>
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include "Containers/Array2D.h"
 #include "Debugging/DebugConsole.h"
+#include "Filesystem/File.h"
+#include "Maps/Data/TileMapData.h"
 #include "Maps/Gui/TileMapEditorGui.h"
+#include "Maps/TileMapFile.h"
+#include "Maps/World.h"
 
 namespace MAPS
 {
@@ -69,6 +75,7 @@ namespace GUI
                 std::shared_ptr<MAPS::Tile> new_tile = std::make_shared<MAPS::Tile>(
                     SelectedTile->Id,
                     SelectedTile->Sprite);
+                CurrentTileMap->MarkChangedFromInitialState();
                 CurrentTileMap->Ground.SetTile(
                     tile_x_offset_from_left_in_tiles,
                     tile_y_offset_from_top_in_tiles,
@@ -97,58 +104,74 @@ namespace GUI
         }
     }
 
-    /// Writes the basic tile data of the provided tile map out
-    /// to a file so that the updated map data can be copied into the
-    /// actual game code (and thus easily update the map).
+    /// Writes the map data for the entire world, updated with the ground tiles of the provided tile map,
+    /// out to a map file so that the updated map file can be copied over the game's map file
+    /// (and thus easily update the map).  Previously edited tile maps remain in the world's map data,
+    /// so multiple tile maps may be edited before copying the map file.
     /// @param[in]  tile_map - The tile map to write to file.
     void TileMapEditorGui::WriteTileMapFile(const MAPS::TileMap& tile_map)
     {
-        // OPEN THE OUTPUT FILE.
-        // The name is hardcoded since this is sufficient for now.
-        // Ideally, we'd have a way to automatically update the
-        // compiled-in map data without manual copying, but it
-        // hasn't yet been worth the effort to overcome that.
-        std::ofstream tile_map_file("edited_tile_map.txt");
-        if (!tile_map_file.is_open())
+        // FIND THE MAP DATA FOR THE TILE MAP'S GRID.
+        MAPS::World& world = *tile_map.MapGrid->World;
+        CONTAINERS::Array2D<MAPS::DATA::TileMapData>* map_grid_data = nullptr;
+        if (MAPS::TileMapType::OVERWORLD == tile_map.Type)
         {
-            // The file can't be written.
-            return;
+            map_grid_data = &world.MapData.Overworld;
+        }
+        else
+        {
+            // Ark interior layers have map data at the same indices.
+            std::size_t ark_interior_layer_count = world.Ark.Interior.LayersFromBottomToTop.size();
+            for (std::size_t layer_index = 0; layer_index < ark_interior_layer_count; ++layer_index)
+            {
+                bool is_tile_map_layer = (&world.Ark.Interior.LayersFromBottomToTop[layer_index] == tile_map.MapGrid.get());
+                bool layer_has_map_data = (layer_index < world.MapData.ArkInteriorLayersFromBottomToTop.size());
+                if (is_tile_map_layer && layer_has_map_data)
+                {
+                    map_grid_data = &world.MapData.ArkInteriorLayersFromBottomToTop[layer_index];
+                    break;
+                }
+            }
         }
 
-        // WRITE OUT THE BASIC GRID COORDINATES OF THE TILE MAP.
-        tile_map_file
-            << "Column: " << tile_map.GridColumnIndex
-            << "\n"
-            << "Row: " << tile_map.GridRowIndex
-            << "\n";
+        bool tile_map_data_found = map_grid_data && map_grid_data->IndicesInRange(tile_map.GridColumnIndex, tile_map.GridRowIndex);
+        if (!tile_map_data_found)
+        {
+            DEBUGGING::DebugConsole::WriteErrorLine("No map data found for edited tile map.");
+            return;
+        }
 
-        // WRITE OUT EACH TILE ID IN THE GROUND LAYER.
-        // Tile data is stored first by row.
+        // UPDATE THE GROUND LAYER OF THE TILE MAP DATA.
         unsigned int map_height_in_tiles = tile_map.Ground.Tiles.GetHeight();
         unsigned int map_width_in_tiles = tile_map.Ground.Tiles.GetWidth();
+        MAPS::DATA::TileMapData& tile_map_data = (*map_grid_data)(tile_map.GridColumnIndex, tile_map.GridRowIndex);
+        CONTAINERS::Array2D<std::uint8_t>& ground_layer = tile_map_data.GroundLayer.emplace(map_width_in_tiles, map_height_in_tiles);
         for (unsigned int tile_row_index = 0; tile_row_index < map_height_in_tiles; ++tile_row_index)
         {
             for (unsigned int tile_column_index = 0; tile_column_index < map_width_in_tiles; ++tile_column_index)
             {
-                // WRITE OUT THE CURRENT TILE.
+                // UPDATE THE CURRENT TILE.
                 std::shared_ptr<MAPS::Tile> tile = tile_map.Ground.Tiles(tile_column_index, tile_row_index);
                 if (tile)
                 {
                     // The ID is the only data that needs to be written.
-                    tile_map_file << tile->Id;
+                    ground_layer(tile_column_index, tile_row_index) = static_cast<std::uint8_t>(tile->Id);
                 }
                 else
                 {
                     // Default to black tile ID to ensure that some data gets written.
-                    tile_map_file << MAPS::TileType::BLACK_TEST;
+                    ground_layer(tile_column_index, tile_row_index) = static_cast<std::uint8_t>(MAPS::TileType::BLACK_TEST);
                 }
-
-                // WRITE OUT A SEPARATOR BEFORE THE NEXT TILE.
-                tile_map_file << ", ";
             }
+        }
 
-            // WRITE OUT A SEPARATOR BEFORE THE NEXT ROW.
-            tile_map_file << "\n";
+        // WRITE OUT THE MAP FILE.
+        // The name is hardcoded since this is sufficient for now.
+        std::string map_file_bytes = MAPS::TileMapFile::Write(world.MapData);
+        bool map_file_written = FILESYSTEM::File::WriteBinaryAtomically(EDITED_MAP_FILEPATH, map_file_bytes);
+        if (!map_file_written)
+        {
+            DEBUGGING::DebugConsole::WriteErrorLine("Failed to write edited map file.");
         }
     }
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <string_view>
 #include "Graphics/Renderer.h"
 #include "Graphics/Texture.h"
 #include "Input/InputController.h"
@@ -18,6 +19,10 @@ namespace GUI
     class TileMapEditorGui
     {
     public:
+        // CONSTANTS.
+        /// The path of the map file written out with edited tile maps.
+        static constexpr std::string_view EDITED_MAP_FILEPATH = "edited_world.map";
+
         // INPUT METHODS.
         void RespondToInput(const INPUT_CONTROL::InputController& input_controller);
 
@@ -1,3 +1,7 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <utility>
 #include "Maps/MultiTileMapGrid.h"
 
 namespace MAPS
@@ -12,7 +16,8 @@ namespace MAPS
         MEMORY::NonNullRawPointer<MAPS::World> world) :
         TileMaps(width_in_tile_maps, height_in_tile_maps),
         AxeSwings(),
-        World(world)
+        World(world),
+        ChangedEvictedTileMaps(width_in_tile_maps, height_in_tile_maps)
     {}
 
     /// Gets the tile map at the specified row and column indices.
@@ -20,6 +25,7 @@ namespace MAPS
     /// @param[in]  column - The 0-based index (from the left) of the tile map to retrieve.
     /// @return The tile map at the specified location, if one exists; null otherwise.
     ///     The pointer is only valid as long as this map grid remains in memory.
+    ///     If tile maps are being streamed, only resident tile maps are returned.
     const MAPS::TileMap* MultiTileMapGrid::GetTileMap(const unsigned int row, const unsigned int column) const
     {
         // MAKE SURE THE PROVIDED INDICES ARE IN RANGE.
@@ -31,16 +37,32 @@ namespace MAPS
         }
 
         // GET THE TILE MAP AT THE SPECIFIED LOCATION.
-        const auto& tile_map = TileMaps(column, row);
+        const auto& tile_map = TileMaps.GetUnchecked(column, row);
         return tile_map.get();
     }
 
-    /// Gets the tile map at the specified row and column indices.
+    /// Gets the tile map at the specified row and column indices.  Any changes made through the pointer
+    /// must be tracked by marking the tile map as changed (see GetTileMapForChanging).
     /// @param[in]  row - The 0-based index (from the top) of the tile map to retrieve.
     /// @param[in]  column - The 0-based index (from the left) of the tile map to retrieve.
     /// @return The tile map at the specified location, if one exists; null otherwise.
     ///     The pointer is only valid as long as this grid remains in memory.
+    ///     If tile maps are being streamed, only resident tile maps are returned.
     MAPS::TileMap* MultiTileMapGrid::GetTileMap(const unsigned int row, const unsigned int column)
+    {
+        const MAPS::TileMap* tile_map = std::as_const(*this).GetTileMap(row, column);
+        return const_cast<MAPS::TileMap*>(tile_map);
+    }
+
+    /// Gets the tile map at the specified row and column indices in order to change it.
+    /// @param[in]  row - The 0-based index (from the top) of the tile map to retrieve.
+    /// @param[in]  column - The 0-based index (from the left) of the tile map to retrieve.
+    /// @return The tile map at the specified location, if one exists; null otherwise.
+    ///     The pointer is only valid as long as this grid remains in memory.
+    ///     Since the tile map may be changed through the pointer, it is marked as possibly
+    ///     having changed from its initial state.  If tile maps are being streamed and the
+    ///     tile map isn't resident, it's loaded before returning.
+    MAPS::TileMap* MultiTileMapGrid::GetTileMapForChanging(const unsigned int row, const unsigned int column)
     {
         // MAKE SURE THE PROVIDED INDICES ARE IN RANGE.
         bool tile_map_indices_valid = TileMaps.IndicesInRange(column, row);
@@ -50,8 +72,20 @@ namespace MAPS
             return nullptr;
         }
 
+        // MAKE SURE THE TILE MAP IS RESIDENT IF TILE MAPS ARE BEING STREAMED.
+        // Since the tile map is needed now, it must be waited on to load.
+        bool tile_map_needs_loading = IsStreaming() && !TileMaps(column, row);
+        if (tile_map_needs_loading)
+        {
+            LoadTileMapImmediately(row, column);
+        }
+
         // GET THE TILE MAP AT THE SPECIFIED LOCATION.
-        const auto& tile_map = TileMaps(column, row);
+        const auto& tile_map = TileMaps.GetUnchecked(column, row);
+        if (tile_map)
+        {
+            tile_map->MarkChangedFromInitialState();
+        }
         return tile_map.get();
     }
     
@@ -60,13 +94,13 @@ namespace MAPS
     /// @param[in]  world_y_position - The world y position of the tile map to retrieve.
     /// @return The tile map at the specified location, if one exists; null otherwise.
     ///     The pointer is only valid as long as this grid remains in memory.
+    ///     If tile maps are being streamed, only resident tile maps are returned.
     const MAPS::TileMap* MultiTileMapGrid::GetTileMap(const float world_x_position, const float world_y_position) const
     {
         // CONVERT THE WORLD POSITIONS TO ROW/COLUMN INDICES.
-        float tile_map_width_in_pixels = static_cast<float>(TileMap::WIDTH_IN_TILES * Tile::DIMENSION_IN_PIXELS<unsigned int>);
-        float tile_map_height_in_pixels = static_cast<float>(TileMap::HEIGHT_IN_TILES * Tile::DIMENSION_IN_PIXELS<unsigned int>);
-        unsigned int column_index = static_cast<unsigned int>(world_x_position / tile_map_width_in_pixels);
-        unsigned int row_index = static_cast<unsigned int>(world_y_position / tile_map_height_in_pixels);
+        MATH::Vector2ui grid_tile_indices = GetGridTileIndices(world_x_position, world_y_position);
+        unsigned int column_index = grid_tile_indices.X / TileMap::WIDTH_IN_TILES;
+        unsigned int row_index = grid_tile_indices.Y / TileMap::HEIGHT_IN_TILES;
 
         // GET THE TILE MAP AT THE SPECIFIED LOCATION.
         const MAPS::TileMap* tile_map = GetTileMap(row_index, column_index);
@@ -78,36 +112,416 @@ namespace MAPS
     /// @param[in]  world_y_position - The world y position of the tile map to retrieve.
     /// @return The tile map at the specified location, if one exists; null otherwise.
     ///     The pointer is only valid as long as this grid remains in memory.
+    ///     If tile maps are being streamed, only resident tile maps are returned.
+    ///     Any changes made through the pointer must be tracked by marking the tile map as changed.
     MAPS::TileMap* MultiTileMapGrid::GetTileMap(const float world_x_position, const float world_y_position)
+    {
+        const MAPS::TileMap* tile_map = std::as_const(*this).GetTileMap(world_x_position, world_y_position);
+        return const_cast<MAPS::TileMap*>(tile_map);
+    }
+
+    /// Gets the tile map that includes the specified world coordinates in order to change it.
+    /// @param[in]  world_x_position - The world x position of the tile map to retrieve.
+    /// @param[in]  world_y_position - The world y position of the tile map to retrieve.
+    /// @return The tile map at the specified location, if one exists; null otherwise.
+    ///     The pointer is only valid as long as this grid remains in memory.
+    ///     The tile map is marked as possibly having changed from its initial state.
+    ///     If tile maps are being streamed and the tile map isn't resident, it's loaded before returning.
+    MAPS::TileMap* MultiTileMapGrid::GetTileMapForChanging(const float world_x_position, const float world_y_position)
     {
         // CONVERT THE WORLD POSITIONS TO ROW/COLUMN INDICES.
-        float tile_map_width_in_pixels = static_cast<float>(TileMap::WIDTH_IN_TILES * Tile::DIMENSION_IN_PIXELS<unsigned int>);
-        float tile_map_height_in_pixels = static_cast<float>(TileMap::HEIGHT_IN_TILES * Tile::DIMENSION_IN_PIXELS<unsigned int>);
-        unsigned int column_index = static_cast<unsigned int>(world_x_position / tile_map_width_in_pixels);
-        unsigned int row_index = static_cast<unsigned int>(world_y_position / tile_map_height_in_pixels);
+        MATH::Vector2ui grid_tile_indices = GetGridTileIndices(world_x_position, world_y_position);
+        unsigned int column_index = grid_tile_indices.X / TileMap::WIDTH_IN_TILES;
+        unsigned int row_index = grid_tile_indices.Y / TileMap::HEIGHT_IN_TILES;
 
         // GET THE TILE MAP AT THE SPECIFIED LOCATION.
-        MAPS::TileMap* tile_map = GetTileMap(row_index, column_index);
+        MAPS::TileMap* tile_map = GetTileMapForChanging(row_index, column_index);
         return tile_map;
     }
 
     /// Gets the tile that includes the specified world coordinates.
+    /// This is called many times per frame (for collision detection, etc.), so it avoids any division,
+    /// reference counting, or redundant bounds checking.
     /// @param[in]  world_x_position - The world x position of the tile to retrieve.
     /// @param[in]  world_y_position - The world y position of the tile to retrieve.
     /// @return The tile at the specified location, if one exists; null otherwise.
-    std::shared_ptr<MAPS::Tile> MultiTileMapGrid::GetTileAtWorldPosition(const float world_x_position, const float world_y_position) const
+    ///     The pointer is only valid as long as the tile's tile map remains resident.
+    ///     If tile maps are being streamed, only tiles in resident tile maps are returned.
+    const MAPS::Tile* MultiTileMapGrid::GetTileAtWorldPosition(const float world_x_position, const float world_y_position) const
     {
-        // GET THE TILE MAP AT THE SPECIFIED WORLD POSITION.
-        const MAPS::TileMap* tile_map = GetTileMap(world_x_position, world_y_position);
-        bool tile_map_exists = (nullptr != tile_map);
-        if (!tile_map_exists)
+        // MAKE SURE THE WORLD POSITION IS WITHIN THE GRID.
+        // Positions before the start of the grid have indices too large to be in range.
+        MATH::Vector2ui grid_tile_indices = GetGridTileIndices(world_x_position, world_y_position);
+        unsigned int column_index = grid_tile_indices.X / TileMap::WIDTH_IN_TILES;
+        unsigned int row_index = grid_tile_indices.Y / TileMap::HEIGHT_IN_TILES;
+        bool tile_map_indices_valid = TileMaps.IndicesInRange(column_index, row_index);
+        if (!tile_map_indices_valid)
+        {
+            return nullptr;
+        }
+
+        // MAKE SURE A TILE MAP EXISTS AT THE WORLD POSITION.
+        const MAPS::TileMap* tile_map = TileMaps.GetUnchecked(column_index, row_index).get();
+        if (!tile_map)
         {
-            // No tile map exists that could contain a tile at the specified world position.
             return nullptr;
         }
 
-        // GET THE TILE IN THE TILE MAP AT THE SPECIFIED WORLD POSITION.
-        std::shared_ptr<MAPS::Tile> tile = tile_map->GetTileAtWorldPosition(world_x_position, world_y_position);
+        // GET THE TILE IN THE TILE MAP.
+        // Tile maps normally always have a full layer of ground tiles, but this check is kept to be safe.
+        unsigned int tile_x_offset_from_left = grid_tile_indices.X - column_index * TileMap::WIDTH_IN_TILES;
+        unsigned int tile_y_offset_from_top = grid_tile_indices.Y - row_index * TileMap::HEIGHT_IN_TILES;
+        const CONTAINERS::Array2D<std::shared_ptr<MAPS::Tile>>& ground_tiles = tile_map->Ground.Tiles;
+        bool tile_offsets_valid = ground_tiles.IndicesInRange(tile_x_offset_from_left, tile_y_offset_from_top);
+        if (!tile_offsets_valid)
+        {
+            return nullptr;
+        }
+        const MAPS::Tile* tile = ground_tiles.GetUnchecked(tile_x_offset_from_left, tile_y_offset_from_top).get();
         return tile;
     }
+
+    /// Gets the tiles that include each of the specified world coordinates.
+    /// More efficient than retrieving tiles one at a time when many tiles are needed.
+    /// @param[in]  world_positions - The world positions of the tiles to retrieve.
+    /// @param[out]  tiles - The tiles at each corresponding world position (null if no tile exists there).
+    ///     Only as many tiles as there are world positions are populated.
+    void MultiTileMapGrid::GetTilesAtWorldPositions(const std::span<const MATH::Vector2f> world_positions, const std::span<const MAPS::Tile*> tiles) const
+    {
+        std::size_t tile_count = std::min(world_positions.size(), tiles.size());
+        for (std::size_t tile_index = 0; tile_index < tile_count; ++tile_index)
+        {
+            const MATH::Vector2f& world_position = world_positions[tile_index];
+            tiles[tile_index] = GetTileAtWorldPosition(world_position.X, world_position.Y);
+        }
+    }
+
+    /// Saves the current state of all tile maps in the grid as their initial state.
+    void MultiTileMapGrid::SaveInitialState()
+    {
+        unsigned int height_in_tile_maps = TileMaps.GetHeight();
+        unsigned int width_in_tile_maps = TileMaps.GetWidth();
+        for (unsigned int row = 0; row < height_in_tile_maps; ++row)
+        {
+            for (unsigned int column = 0; column < width_in_tile_maps; ++column)
+            {
+                const auto& tile_map = TileMaps(column, row);
+                if (tile_map)
+                {
+                    tile_map->SaveInitialState();
+                }
+            }
+        }
+    }
+
+    /// Resets all tile maps in the grid to their saved initial state.
+    /// Only tile maps that may have changed are actually restored.
+    /// If tile maps are being streamed, tile maps without a saved initial state (including any evicted tile maps)
+    /// are instead discarded since they'll be loaded in their initial state when next needed.
+    /// @return True if all tile maps were reset; false if any tile map lacks a saved initial state.
+    bool MultiTileMapGrid::ResetToInitialState()
+    {
+        // CLEAR ANY AXE SWINGS.
+        AxeSwings.clear();
+
+        // DISCARD ANY TILE MAPS THAT AREN'T RESIDENT.
+        // Tile maps being loaded are waited on (when their futures are destroyed) since they can't be cancelled.
+        TileMapsBeingLoaded.clear();
+        ChangedEvictedTileMaps.Resize(ChangedEvictedTileMaps.GetWidth(), ChangedEvictedTileMaps.GetHeight());
+
+        // RESET EACH TILE MAP.
+        // A tile map that doesn't exist (because the grid hasn't been populated) can't be reset.
+        bool all_tile_maps_reset = true;
+        unsigned int height_in_tile_maps = TileMaps.GetHeight();
+        unsigned int width_in_tile_maps = TileMaps.GetWidth();
+        for (unsigned int row = 0; row < height_in_tile_maps; ++row)
+        {
+            for (unsigned int column = 0; column < width_in_tile_maps; ++column)
+            {
+                auto& tile_map = TileMaps(column, row);
+                bool tile_map_reset = tile_map && tile_map->ResetToInitialState();
+                if (!tile_map_reset && IsStreaming())
+                {
+                    tile_map = nullptr;
+                    tile_map_reset = true;
+                }
+                all_tile_maps_reset = all_tile_maps_reset && tile_map_reset;
+            }
+        }
+
+        CountResidentTileMaps();
+        return all_tile_maps_reset;
+    }
+
+    /// Starts streaming tile maps in the grid, so that only tile maps near the camera are kept in memory.
+    /// Any tile maps already in the grid remain resident until evicted.
+    /// @param[in]  loader - The function for loading tile maps.
+    /// @param[in]  settings - The settings for streaming tile maps.
+    void MultiTileMapGrid::EnableStreaming(const TileMapLoader& loader, const TileMapStreamingSettings& settings)
+    {
+        Loader = loader;
+        StreamingSettings = settings;
+        CountResidentTileMaps();
+    }
+
+    /// Checks if tile maps in the grid are being streamed.
+    /// @return True if tile maps are being streamed; false if all tile maps are always in memory.
+    bool MultiTileMapGrid::IsStreaming() const
+    {
+        bool is_streaming = static_cast<bool>(Loader);
+        return is_streaming;
+    }
+
+    /// Updates which tile maps are resident based on where the camera is focused.  Should be called every frame
+    /// with the camera's destination so that tile maps are loaded in the background ahead of the camera scrolling to them.
+    /// Does nothing if tile maps aren't being streamed.
+    /// @param[in]  focus_world_position - The world position around which tile maps should be resident.
+    void MultiTileMapGrid::UpdateResidency(const MATH::Vector2f& focus_world_position)
+    {
+        // MAKE SURE TILE MAPS ARE BEING STREAMED.
+        if (!IsStreaming())
+        {
+            return;
+        }
+
+        // MAKE ANY TILE MAPS THAT FINISHED LOADING IN THE BACKGROUND RESIDENT.
+        for (auto tile_map_load = TileMapsBeingLoaded.begin(); tile_map_load != TileMapsBeingLoaded.end();)
+        {
+            bool tile_map_loaded = (std::future_status::ready == tile_map_load->LoadedTileMap.wait_for(std::chrono::seconds::zero()));
+            if (!tile_map_loaded)
+            {
+                ++tile_map_load;
+                continue;
+            }
+
+            MakeTileMapResident(tile_map_load->Row, tile_map_load->Column, tile_map_load->LoadedTileMap.get());
+            tile_map_load = TileMapsBeingLoaded.erase(tile_map_load);
+        }
+
+        // MAKE SURE THE FOCUS IS WITHIN THE GRID.
+        MATH::Vector2ui focus_grid_tile_indices = GetGridTileIndices(focus_world_position.X, focus_world_position.Y);
+        unsigned int focus_column_index = focus_grid_tile_indices.X / TileMap::WIDTH_IN_TILES;
+        unsigned int focus_row_index = focus_grid_tile_indices.Y / TileMap::HEIGHT_IN_TILES;
+        bool focus_within_grid = TileMaps.IndicesInRange(focus_column_index, focus_row_index);
+        if (!focus_within_grid)
+        {
+            return;
+        }
+
+        // START LOADING ANY TILE MAPS AROUND THE FOCUS THAT AREN'T RESIDENT.
+        unsigned int radius = StreamingSettings.ResidentRadiusInTileMaps;
+        unsigned int min_row = (focus_row_index > radius) ? (focus_row_index - radius) : 0;
+        unsigned int max_row = std::min(focus_row_index + radius, TileMaps.GetHeight() - 1);
+        unsigned int min_column = (focus_column_index > radius) ? (focus_column_index - radius) : 0;
+        unsigned int max_column = std::min(focus_column_index + radius, TileMaps.GetWidth() - 1);
+        for (unsigned int row = min_row; row <= max_row; ++row)
+        {
+            for (unsigned int column = min_column; column <= max_column; ++column)
+            {
+                // SKIP ANY TILE MAPS ALREADY RESIDENT OR BEING LOADED.
+                if (TileMaps(column, row))
+                {
+                    continue;
+                }
+                bool tile_map_being_loaded = std::any_of(
+                    TileMapsBeingLoaded.cbegin(),
+                    TileMapsBeingLoaded.cend(),
+                    [row, column](const TileMapLoad& tile_map_load) { return (row == tile_map_load.Row) && (column == tile_map_load.Column); });
+                if (tile_map_being_loaded)
+                {
+                    continue;
+                }
+
+                // LOAD THE TILE MAP IN THE BACKGROUND.
+                TileMapLoad& tile_map_load = TileMapsBeingLoaded.emplace_back();
+                tile_map_load.Row = row;
+                tile_map_load.Column = column;
+                tile_map_load.LoadedTileMap = std::async(std::launch::async, Loader, row, column);
+                ++StreamingMetrics.BackgroundLoadCount;
+            }
+        }
+
+        // EVICT TILE MAPS FAR FROM THE FOCUS IF TOO MANY ARE RESIDENT.
+        bool over_budget = (ResidentTileMapCount > StreamingSettings.MaxResidentTileMapCount);
+        if (over_budget)
+        {
+            EvictFarTileMaps(focus_row_index, focus_column_index);
+        }
+    }
+
+    /// Gets the number of tile maps currently resident in the grid.
+    /// @return The number of resident tile maps.
+    unsigned int MultiTileMapGrid::GetResidentTileMapCount() const
+    {
+        return ResidentTileMapCount;
+    }
+
+    /// Converts a world position to the indices of the tile at that position, counting tiles across the entire grid
+    /// rather than within a single tile map.  Since everything after converting to tiles is integer math,
+    /// tile maps and tiles found from these indices exactly match dividing world positions by their dimensions.
+    /// @param[in]  world_x_position - The world x position to convert.
+    /// @param[in]  world_y_position - The world y position to convert.
+    /// @return The column (x) and row (y) of the tile across the grid.  Positions left of or above the grid
+    ///     wrap around to indices too large to be within the grid.
+    MATH::Vector2ui MultiTileMapGrid::GetGridTileIndices(const float world_x_position, const float world_y_position)
+    {
+        // Flooring is needed so that positions slightly left of or above the grid don't truncate to the first tile.
+        int tile_x_index = static_cast<int>(std::floor(world_x_position * INVERSE_TILE_DIMENSION_IN_PIXELS));
+        int tile_y_index = static_cast<int>(std::floor(world_y_position * INVERSE_TILE_DIMENSION_IN_PIXELS));
+        MATH::Vector2ui grid_tile_indices(static_cast<unsigned int>(tile_x_index), static_cast<unsigned int>(tile_y_index));
+        return grid_tile_indices;
+    }
+
+    /// Loads a tile map that's being streamed immediately, waiting on any background load
+    /// of the tile map that's already started.
+    /// @param[in]  row - The row of the tile map to load.
+    /// @param[in]  column - The column of the tile map to load.
+    void MultiTileMapGrid::LoadTileMapImmediately(const unsigned int row, const unsigned int column)
+    {
+        // LOAD THE TILE MAP.
+        auto load_start_time = std::chrono::steady_clock::now();
+        std::shared_ptr<TileMap> loaded_tile_map = nullptr;
+        auto tile_map_load = std::find_if(
+            TileMapsBeingLoaded.begin(),
+            TileMapsBeingLoaded.end(),
+            [row, column](const TileMapLoad& current_tile_map_load) { return (row == current_tile_map_load.Row) && (column == current_tile_map_load.Column); });
+        if (TileMapsBeingLoaded.end() != tile_map_load)
+        {
+            loaded_tile_map = tile_map_load->LoadedTileMap.get();
+            TileMapsBeingLoaded.erase(tile_map_load);
+        }
+        else
+        {
+            loaded_tile_map = Loader(row, column);
+        }
+        MakeTileMapResident(row, column, std::move(loaded_tile_map));
+        auto load_end_time = std::chrono::steady_clock::now();
+
+        // RECORD THE LOAD STALL.
+        std::chrono::microseconds stall_time = std::chrono::duration_cast<std::chrono::microseconds>(load_end_time - load_start_time);
+        ++StreamingMetrics.LoadStallCount;
+        StreamingMetrics.TotalLoadStallTime += stall_time;
+        StreamingMetrics.LongestLoadStallTime = std::max(StreamingMetrics.LongestLoadStallTime, stall_time);
+        if (OnLoadStall)
+        {
+            OnLoadStall(row, column, stall_time);
+        }
+    }
+
+    /// Makes a loaded tile map resident in the grid.  If the tile map was previously evicted after
+    /// possibly having changed, the evicted tile map is made resident again with the loaded ground.
+    /// @param[in]  row - The row of the tile map.
+    /// @param[in]  column - The column of the tile map.
+    /// @param[in,out]  loaded_tile_map - The loaded tile map.  Nothing is made resident if null.
+    void MultiTileMapGrid::MakeTileMapResident(const unsigned int row, const unsigned int column, std::shared_ptr<TileMap>&& loaded_tile_map)
+    {
+        // MAKE SURE THE TILE MAP WAS LOADED AND ISN'T ALREADY RESIDENT.
+        std::shared_ptr<TileMap>& tile_map = TileMaps(column, row);
+        bool tile_map_can_be_made_resident = loaded_tile_map && !tile_map;
+        if (!tile_map_can_be_made_resident)
+        {
+            return;
+        }
+
+        // MAKE THE TILE MAP RESIDENT.
+        std::shared_ptr<TileMap>& changed_evicted_tile_map = ChangedEvictedTileMaps(column, row);
+        if (changed_evicted_tile_map)
+        {
+            changed_evicted_tile_map->Ground = std::move(loaded_tile_map->Ground);
+            tile_map = std::move(changed_evicted_tile_map);
+        }
+        else
+        {
+            tile_map = std::move(loaded_tile_map);
+        }
+        ++ResidentTileMapCount;
+
+        // LET ANY CHANGES MADE WHILE THE TILE MAP WASN'T RESIDENT BE APPLIED.
+        if (OnTileMapResident)
+        {
+            OnTileMapResident(*tile_map);
+        }
+    }
+
+    /// Evicts the tile maps farthest from the focus until the budget for resident tile maps is met.
+    /// Tile maps within the resident radius of the focus are never evicted, nor are tile maps with exit points
+    /// since other map grids refer directly to them.
+    /// @param[in]  focus_row - The row of the tile map being focused on.
+    /// @param[in]  focus_column - The column of the tile map being focused on.
+    void MultiTileMapGrid::EvictFarTileMaps(const unsigned int focus_row, const unsigned int focus_column)
+    {
+        // FIND TILE MAPS THAT CAN BE EVICTED.
+        // Each candidate is stored with its distance (in tile maps) from the focus to allow sorting by distance.
+        std::vector<std::pair<unsigned int, MATH::Vector2ui>> eviction_candidates;
+        unsigned int height_in_tile_maps = TileMaps.GetHeight();
+        unsigned int width_in_tile_maps = TileMaps.GetWidth();
+        for (unsigned int row = 0; row < height_in_tile_maps; ++row)
+        {
+            for (unsigned int column = 0; column < width_in_tile_maps; ++column)
+            {
+                const auto& tile_map = TileMaps(column, row);
+                bool tile_map_can_be_evicted = tile_map && tile_map->ExitPoints.empty();
+                if (!tile_map_can_be_evicted)
+                {
+                    continue;
+                }
+
+                unsigned int row_distance = static_cast<unsigned int>(std::abs(static_cast<int>(row) - static_cast<int>(focus_row)));
+                unsigned int column_distance = static_cast<unsigned int>(std::abs(static_cast<int>(column) - static_cast<int>(focus_column)));
+                unsigned int distance = std::max(row_distance, column_distance);
+                bool outside_resident_radius = (distance > StreamingSettings.ResidentRadiusInTileMaps);
+                if (outside_resident_radius)
+                {
+                    eviction_candidates.emplace_back(distance, MATH::Vector2ui(column, row));
+                }
+            }
+        }
+
+        // EVICT THE FARTHEST TILE MAPS FIRST.
+        std::sort(
+            eviction_candidates.begin(),
+            eviction_candidates.end(),
+            [](const auto& first_candidate, const auto& second_candidate) { return first_candidate.first > second_candidate.first; });
+        for (const auto& [distance, tile_map_indices] : eviction_candidates)
+        {
+            // STOP ONCE THE BUDGET IS MET.
+            bool within_budget = (ResidentTileMapCount <= StreamingSettings.MaxResidentTileMapCount);
+            if (within_budget)
+            {
+                break;
+            }
+
+            // EVICT THE TILE MAP.
+            // Tile maps that may have changed keep their objects so that changes aren't lost,
+            // but the rest can simply be reloaded in their initial state.
+            std::shared_ptr<TileMap>& tile_map = TileMaps(tile_map_indices.X, tile_map_indices.Y);
+            if (tile_map->HasChangedFromInitialState())
+            {
+                tile_map->ReleaseGround();
+                ChangedEvictedTileMaps(tile_map_indices.X, tile_map_indices.Y) = std::move(tile_map);
+                ++StreamingMetrics.ChangedEvictionCount;
+            }
+            tile_map = nullptr;
+            --ResidentTileMapCount;
+            ++StreamingMetrics.EvictionCount;
+        }
+    }
+
+    /// Counts the number of tile maps currently resident in the grid.
+    void MultiTileMapGrid::CountResidentTileMaps()
+    {
+        ResidentTileMapCount = 0;
+        unsigned int height_in_tile_maps = TileMaps.GetHeight();
+        unsigned int width_in_tile_maps = TileMaps.GetWidth();
+        for (unsigned int row = 0; row < height_in_tile_maps; ++row)
+        {
+            for (unsigned int column = 0; column < width_in_tile_maps; ++column)
+            {
+                if (TileMaps(column, row))
+                {
+                    ++ResidentTileMapCount;
+                }
+            }
+        }
+    }
 }
\ No newline at end of file
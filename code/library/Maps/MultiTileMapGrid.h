@@ -1,11 +1,17 @@
 #pragma once
 
+#include <chrono>
+#include <functional>
+#include <future>
 #include <memory>
+#include <span>
 #include <vector>
 #include <SFML/Audio.hpp>
 #include "Containers/Array2D.h"
 #include "Gameplay/AxeSwingEvent.h"
 #include "Maps/TileMap.h"
+#include "Maps/TileMapStreaming.h"
+#include "Math/Vector2.h"
 #include "Memory/Pointers.h"
 #include "Objects/Noah.h"
 
@@ -18,23 +24,61 @@ namespace MAPS
     /// A grid-based organizational mechanism for collecting a set of related tile maps
     /// that form a larger "map" (for example, an overworld map or interior area may
     /// be made of multiple individual tile maps).
+    ///
+    /// By default, all tile maps in the grid are always in memory.  For larger grids, tile maps may instead
+    /// be streamed, with only tile maps around the camera kept resident.  Tile maps around where the camera
+    /// is going are loaded in the background (see UpdateResidency), and tile maps far away are evicted
+    /// once more than a budgeted number of tile maps are resident.  Tile maps retrieved only for reading
+    /// are never loaded, but if a tile map that isn't resident is retrieved for changing, it's loaded immediately,
+    /// with the wait reported as a load stall.
+    /// Evicted tile maps that may have changed keep their objects (only their ground is released),
+    /// so changes made during gameplay aren't lost.
+    ///
+    /// Tile maps in a grid are all the standard tile map size, laid out starting from world position (0,0),
+    /// which allows looking up tile maps and tiles for world positions in constant time.
     class MultiTileMapGrid
     {
     public:
+        // TYPES.
+        /// A function for loading a tile map in its initial state from raw map data.
+        /// Called from background threads, so it must not change anything shared.
+        using TileMapLoader = std::function<std::shared_ptr<TileMap>(const unsigned int row, const unsigned int column)>;
+        /// A callback for when a tile map had to be waited on to load.
+        using LoadStallCallback = std::function<void(const unsigned int row, const unsigned int column, const std::chrono::microseconds stall_time)>;
+        /// A callback for when a tile map that's being streamed becomes resident.
+        using TileMapResidentCallback = std::function<void(TileMap& tile_map)>;
+
         // CONSTRUCTION.
         explicit MultiTileMapGrid(
             const unsigned int width_in_tile_maps, 
             const unsigned int height_in_tile_maps,
             MEMORY::NonNullRawPointer<World> world);
+        MultiTileMapGrid(const MultiTileMapGrid&) = delete;
+        MultiTileMapGrid& operator=(const MultiTileMapGrid&) = delete;
+        MultiTileMapGrid(MultiTileMapGrid&&) = default;
+        MultiTileMapGrid& operator=(MultiTileMapGrid&&) = default;
+
+        // INITIAL STATE.
+        void SaveInitialState();
+        bool ResetToInitialState();
 
         // TILE MAP RETRIEVAL.
         const MAPS::TileMap* GetTileMap(const unsigned int row, const unsigned int column) const;
         MAPS::TileMap* GetTileMap(const unsigned int row, const unsigned int column);
         const MAPS::TileMap* GetTileMap(const float world_x_position, const float world_y_position) const;
         MAPS::TileMap* GetTileMap(const float world_x_position, const float world_y_position);
+        MAPS::TileMap* GetTileMapForChanging(const unsigned int row, const unsigned int column);
+        MAPS::TileMap* GetTileMapForChanging(const float world_x_position, const float world_y_position);
 
         // TILE RETRIEVAL.
-        std::shared_ptr<MAPS::Tile> GetTileAtWorldPosition(const float world_x_position, const float world_y_position) const;
+        const MAPS::Tile* GetTileAtWorldPosition(const float world_x_position, const float world_y_position) const;
+        void GetTilesAtWorldPositions(const std::span<const MATH::Vector2f> world_positions, const std::span<const MAPS::Tile*> tiles) const;
+
+        // STREAMING.
+        void EnableStreaming(const TileMapLoader& loader, const TileMapStreamingSettings& settings);
+        bool IsStreaming() const;
+        void UpdateResidency(const MATH::Vector2f& focus_world_position);
+        unsigned int GetResidentTileMapCount() const;
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The larger world this map grid is part of.
@@ -44,5 +88,52 @@ namespace MAPS
         CONTAINERS::Array2D<std::shared_ptr<MAPS::TileMap>> TileMaps;
         /// Axe swings currently occurring in the map grid.
         std::vector<std::shared_ptr<GAMEPLAY::AxeSwingEvent>> AxeSwings;
+        /// Metrics for streaming tile maps, if tile maps are being streamed.
+        TileMapStreamingMetrics StreamingMetrics = {};
+        /// Called whenever a tile map that's being streamed had to be waited on to load.  Optional.
+        LoadStallCallback OnLoadStall = {};
+        /// Called whenever a tile map that's being streamed becomes resident, to allow applying
+        /// changes made to the grid as a whole while the tile map wasn't resident.  Optional.
+        TileMapResidentCallback OnTileMapResident = {};
+
+    private:
+        // CONSTANTS.
+        /// The inverse of the dimension of a tile in pixels, to allow converting world positions
+        /// to tiles by multiplying rather than dividing.  Exact since tile dimensions are a power of 2.
+        static constexpr float INVERSE_TILE_DIMENSION_IN_PIXELS = 1.0f / Tile::DIMENSION_IN_PIXELS<float>;
+
+        // POSITION CONVERSION HELPERS.
+        static MATH::Vector2ui GetGridTileIndices(const float world_x_position, const float world_y_position);
+
+        // STREAMING HELPERS.
+        void LoadTileMapImmediately(const unsigned int row, const unsigned int column);
+        void MakeTileMapResident(const unsigned int row, const unsigned int column, std::shared_ptr<TileMap>&& loaded_tile_map);
+        void EvictFarTileMaps(const unsigned int focus_row, const unsigned int focus_column);
+        void CountResidentTileMaps();
+
+        /// A tile map being loaded in the background.
+        class TileMapLoad
+        {
+        public:
+            /// The row of the tile map being loaded.
+            unsigned int Row = 0;
+            /// The column of the tile map being loaded.
+            unsigned int Column = 0;
+            /// The tile map, once loaded.
+            std::future<std::shared_ptr<TileMap>> LoadedTileMap = {};
+        };
+
+        // MEMBER VARIABLES.
+        /// The function for loading tile maps, if tile maps are being streamed.
+        TileMapLoader Loader = {};
+        /// The settings for streaming tile maps.
+        TileMapStreamingSettings StreamingSettings = {};
+        /// The number of tile maps currently resident in the grid.
+        unsigned int ResidentTileMapCount = 0;
+        /// Tile maps currently being loaded in the background.
+        std::vector<TileMapLoad> TileMapsBeingLoaded = {};
+        /// Evicted tile maps that may have changed, arranged like the resident tile maps.
+        /// Their ground is restored from newly loaded tile maps when they become resident again.
+        CONTAINERS::Array2D<std::shared_ptr<MAPS::TileMap>> ChangedEvictedTileMaps;
     };
 }
\ No newline at end of file
@@ -1,5 +1,11 @@
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
 #include "Debugging/DebugConsole.h"
-#include "Maps/Data/OverworldMapData.h"
 #include "Maps/Overworld.h"
 #include "Maps/Tileset.h"
 #include "Math/Number.h"
@@ -8,17 +14,19 @@
 
 namespace MAPS
 {
-    /// Constructor.  Creates the the overworld in its initial state.
+    /// Constructor.  Creates an empty overworld.  The overworld is only populated
+    /// when reset to its initial state (which the world does once it is fully constructed),
+    /// so that tile maps aren't needlessly created multiple times.
     /// @param[in]  world - The larger world this overworld is part of.
     Overworld::Overworld(MEMORY::NonNullRawPointer<World> world) :
         MapGrid(WIDTH_IN_TILE_MAPS, HEIGHT_IN_TILE_MAPS, world),
-        AnimalsGoingIntoArk()
-    {
-        ResetToInitialState();
-    }
+        AnimalsGoingIntoArk(),
+        TreeFoodRandomSeed(std::random_device()())
+    {}
 
     /// Resets the overworld to its initial state.  Useful for switching between different saved games.
-    void Overworld::ResetToInitialState()
+    /// @param[in]  map_data - The raw data for the tile maps in the overworld.
+    void Overworld::ResetToInitialState(const CONTAINERS::Array2D<DATA::TileMapData>& map_data)
     {
         // CLEAR ANY ANIMALS GOING INTO THE ARK.
         // If a saved game is being reloaded, the animals should re-appear behind Noah since
@@ -37,11 +45,8 @@ namespace MAPS
         // CREATE THE TILESET.
         Tileset tileset;
 
-        // CREATE A RANDOM NUMBER GENERATOR FOR CREATING FOOD.
-        MATH::RandomNumberGenerator random_number_generator;
-
-        unsigned int tree_count = 0;
-        unsigned int ark_piece_count = 0;
+        std::size_t tree_count = 0;
+        std::size_t ark_piece_count = 0;
 
         // LOAD TILE MAPS FOR EACH ROW.
         for (unsigned int row = 0; row < HEIGHT_IN_TILE_MAPS; ++row)
@@ -49,217 +54,374 @@ namespace MAPS
             // LOAD TILE MAPS FOR EACH COLUMN.
             for (unsigned int column = 0; column < WIDTH_IN_TILE_MAPS; ++column)
             {
-                // GET THE CURRENT TILE MAP DATA.
-                const auto& tile_map_data = DATA::OVERWORLD_MAP_DATA(column, row);
-
-                // CALCULATE THE POSITION OF THE CURRENT TILE MAP.
-                MATH::Vector2f map_center_world_position;
-
-                float map_width_in_pixels = static_cast<float>(TileMap::WIDTH_IN_TILES * Tile::DIMENSION_IN_PIXELS<unsigned int>);
-                float map_half_width_in_pixels = map_width_in_pixels / 2.0f;
-                float map_left_world_position = static_cast<float>(column * map_width_in_pixels);
-                map_center_world_position.X = map_left_world_position + map_half_width_in_pixels;
-
-                float map_height_in_pixels = static_cast<float>(TileMap::HEIGHT_IN_TILES * Tile::DIMENSION_IN_PIXELS<unsigned int>);
-                float map_half_height_in_pixels = map_height_in_pixels / 2.0f;
-                float map_top_world_position = static_cast<float>(row * map_height_in_pixels);
-                map_center_world_position.Y = map_top_world_position + map_half_height_in_pixels;
-
-                // CREATE AN EMPTY TILE MAP.
-                MATH::Vector2ui map_dimensions_in_tiles(TileMap::WIDTH_IN_TILES, TileMap::HEIGHT_IN_TILES);
-                auto tile_map = std::make_shared<TileMap>(
-                    TileMapType::OVERWORLD,
-                    MEMORY::NonNullRawPointer<MultiTileMapGrid>(&MapGrid),
+                // CREATE THE TILE MAP.
+                // The previous tile map is only looked at, so it shouldn't be loaded if tile maps are being streamed.
+                const TileMap* previous_tile_map = std::as_const(MapGrid).GetTileMap(row, column);
+                MATH::RandomNumberGenerator random_number_generator = CreateTreeFoodRandomNumberGenerator(row, column);
+                std::shared_ptr<TileMap> tile_map = CreateTileMap(
+                    MapGrid,
                     row,
                     column,
-                    map_center_world_position,
-                    map_dimensions_in_tiles);
+                    map_data(column, row),
+                    previous_tile_map,
+                    tileset,
+                    random_number_generator);
+                tree_count += tile_map->Trees.size();
+                ark_piece_count += tile_map->ArkPieces.size();
+
+                // SET THE TILE MAP IN THE OVERWORLD.
+                MapGrid.TileMaps(column, row) = std::move(tile_map);
+            }
+        }
+
+        // Ark pieces in the newly created tile maps are all unbuilt.
+        ArkPiecesBuiltStatus = std::nullopt;
+
+        DEBUGGING::DebugConsole::WriteLine("Created tree count: ", tree_count);
+        DEBUGGING::DebugConsole::WriteLine("Ark piece count: ", ark_piece_count);
+    }
 
-                // CREATE TILES IN THE GROUND LAYER.
-                for (unsigned int current_tile_y = 0; current_tile_y < TileMap::HEIGHT_IN_TILES; ++current_tile_y)
+    /// Creates a tile map in the overworld in its initial state.  Doesn't change anything shared,
+    /// so tile maps may be created on background threads when tile maps are being streamed.
+    /// @param[in]  map_grid - The map grid the tile map is part of.
+    /// @param[in]  row - The row of the tile map in the map grid.
+    /// @param[in]  column - The column of the tile map in the map grid.
+    /// @param[in]  tile_map_data - The raw data for the tile map.
+    /// @param[in]  previous_tile_map - The tile map previously at the same location, if any, from which to preserve food on trees.
+    /// @param[in]  tileset - The tileset for creating tiles.
+    /// @param[in,out]  random_number_generator - The random number generator for creating food on trees.
+    /// @return The tile map.
+    std::shared_ptr<TileMap> Overworld::CreateTileMap(
+        MultiTileMapGrid& map_grid,
+        const unsigned int row,
+        const unsigned int column,
+        const DATA::TileMapData& tile_map_data,
+        const TileMap* const previous_tile_map,
+        const Tileset& tileset,
+        MATH::RandomNumberGenerator& random_number_generator)
+    {
+        constexpr uint8_t TREE_OBJECT_ID = 1;
+
+        // CALCULATE THE POSITION OF THE CURRENT TILE MAP.
+        MATH::Vector2f map_center_world_position;
+
+        float map_width_in_pixels = static_cast<float>(TileMap::WIDTH_IN_TILES * Tile::DIMENSION_IN_PIXELS<unsigned int>);
+        float map_half_width_in_pixels = map_width_in_pixels / 2.0f;
+        float map_left_world_position = static_cast<float>(column * map_width_in_pixels);
+        map_center_world_position.X = map_left_world_position + map_half_width_in_pixels;
+
+        float map_height_in_pixels = static_cast<float>(TileMap::HEIGHT_IN_TILES * Tile::DIMENSION_IN_PIXELS<unsigned int>);
+        float map_half_height_in_pixels = map_height_in_pixels / 2.0f;
+        float map_top_world_position = static_cast<float>(row * map_height_in_pixels);
+        map_center_world_position.Y = map_top_world_position + map_half_height_in_pixels;
+        MATH::Vector2f map_left_top_world_position(map_left_world_position, map_top_world_position);
+
+        // CREATE AN EMPTY TILE MAP.
+        MATH::Vector2ui map_dimensions_in_tiles(TileMap::WIDTH_IN_TILES, TileMap::HEIGHT_IN_TILES);
+        auto tile_map = std::make_shared<TileMap>(
+            TileMapType::OVERWORLD,
+            MEMORY::NonNullRawPointer<MultiTileMapGrid>(&map_grid),
+            row,
+            column,
+            map_center_world_position,
+            map_dimensions_in_tiles);
+
+        // RESERVE SPACE FOR OBJECTS IN THE TILE MAP.
+        // Objects are counted up-front so that containers for them don't have to grow as objects are added.
+        std::size_t tile_map_ark_piece_count = 0;
+        std::size_t tile_map_tree_count = 0;
+        for (unsigned int current_tile_y = 0; current_tile_y < TileMap::HEIGHT_IN_TILES; ++current_tile_y)
+        {
+            for (unsigned int current_tile_x = 0; current_tile_x < TileMap::WIDTH_IN_TILES; ++current_tile_x)
+            {
+                bool is_ark_piece = tile_map_data.ArkLayer && ((*tile_map_data.ArkLayer)(current_tile_x, current_tile_y) > 0);
+                if (is_ark_piece)
                 {
-                    // CREATE TILES FOR THIS ROW.
-                    for (unsigned int current_tile_x = 0; current_tile_x < TileMap::WIDTH_IN_TILES; ++current_tile_x)
-                    {
-                        // CREATE THE CURRENT TILE.
-                        TileId tile_id = (*tile_map_data.GroundLayer)(current_tile_x, current_tile_y);
-                        std::shared_ptr<Tile> tile = tileset.CreateTile(tile_id);
-                        bool tile_exists_in_tileset = (nullptr != tile);
-                        if (!tile_exists_in_tileset)
-                        {
-                            // Skip to trying to create the next tile.  The layer
-                            // simply won't have any tile at this location.
-                            continue;
-                        }
-
-                        // SET THE TILE IN THE GROUND LAYER.
-                        tile_map->Ground.SetTile(current_tile_x, current_tile_y, tile);
-                    }
+                    ++tile_map_ark_piece_count;
+                }
+
+                bool is_tree = tile_map_data.ObjectLayer && (TREE_OBJECT_ID == (*tile_map_data.ObjectLayer)(current_tile_x, current_tile_y));
+                if (is_tree)
+                {
+                    ++tile_map_tree_count;
+                }
+            }
+        }
+        tile_map->ArkPieces.reserve(tile_map_ark_piece_count);
+        tile_map->Trees.reserve(tile_map_tree_count);
+
+        // CREATE TILES IN THE GROUND LAYER.
+        for (unsigned int current_tile_y = 0; current_tile_y < TileMap::HEIGHT_IN_TILES; ++current_tile_y)
+        {
+            // CREATE TILES FOR THIS ROW.
+            for (unsigned int current_tile_x = 0; current_tile_x < TileMap::WIDTH_IN_TILES; ++current_tile_x)
+            {
+                // CREATE THE CURRENT TILE.
+                TileId tile_id = (*tile_map_data.GroundLayer)(current_tile_x, current_tile_y);
+                std::shared_ptr<Tile> tile = tileset.CreateTile(tile_id);
+                bool tile_exists_in_tileset = (nullptr != tile);
+                if (!tile_exists_in_tileset)
+                {
+                    // Skip to trying to create the next tile.  The layer
+                    // simply won't have any tile at this location.
+                    continue;
                 }
 
-                // POPULATE THE ARK LAYER IF ONE EXISTS.
-                if (tile_map_data.ArkLayer)
+                // SET THE TILE IN THE GROUND LAYER.
+                tile_map->Ground.SetTile(current_tile_x, current_tile_y, tile);
+            }
+        }
+
+        // POPULATE THE ARK LAYER IF ONE EXISTS.
+        if (tile_map_data.ArkLayer)
+        {
+            // CREATE PIECES IN THE ARK LAYER.
+            for (unsigned int current_tile_y = 0; current_tile_y < TileMap::HEIGHT_IN_TILES; ++current_tile_y)
+            {
+                // CREATE ARK PIECES FOR THIS ROW.
+                for (unsigned int current_tile_x = 0; current_tile_x < TileMap::WIDTH_IN_TILES; ++current_tile_x)
                 {
-                    // CREATE PIECES IN THE ARK LAYER.
-                    for (unsigned int current_tile_y = 0; current_tile_y < TileMap::HEIGHT_IN_TILES; ++current_tile_y)
+                    // CHECK IF THE TILE ID IS VALID.
+                    // Some tiles in this layer may not be for valid ark pieces.
+                    TileId tile_id = (*tile_map_data.ArkLayer)(current_tile_x, current_tile_y);
+                    bool tild_id_valid = (tile_id > 0);
+                    if (!tild_id_valid)
                     {
-                        // CREATE ARK PIECES FOR THIS ROW.
-                        for (unsigned int current_tile_x = 0; current_tile_x < TileMap::WIDTH_IN_TILES; ++current_tile_x)
-                        {
-                            // CHECK IF THE TILE ID IS VALID.
-                            // Some tiles in this layer may not be for valid ark pieces.
-                            TileId tile_id = (*tile_map_data.ArkLayer)(current_tile_x, current_tile_y);
-                            bool tild_id_valid = (tile_id > 0);
-                            if (!tild_id_valid)
-                            {
-                                continue;
-                            }
-
-                            // CREATE THE ARK PIECE.
-                            OBJECTS::ArkPiece ark_piece(tile_id);
-                            MATH::Vector2f ark_piece_local_center = ark_piece.Sprite.Origin;
-                            float tile_left_x_position = static_cast<float>(current_tile_x * Tile::DIMENSION_IN_PIXELS<unsigned int>);
-                            float ark_piece_world_x_position = map_left_world_position + tile_left_x_position + ark_piece_local_center.X;
-                            float tile_top_y_position = static_cast<float>(current_tile_y * Tile::DIMENSION_IN_PIXELS<unsigned int>);
-                            float ark_piece_world_y_position = map_top_world_position + tile_top_y_position + ark_piece_local_center.Y;
-                            ark_piece.Sprite.WorldPosition.X = ark_piece_world_x_position;
-                            ark_piece.Sprite.WorldPosition.Y = ark_piece_world_y_position;
-
-                            // ADD THE ARK PIECE TO THE TILE MAP.
-                            tile_map->ArkPieces.push_back(ark_piece);
-
-                            ++ark_piece_count;
-                        }
+                        continue;
                     }
+
+                    // CREATE THE ARK PIECE.
+                    OBJECTS::ArkPiece ark_piece = CreateArkPiece(tile_id, map_left_top_world_position, current_tile_x, current_tile_y);
+
+                    // ADD THE ARK PIECE TO THE TILE MAP.
+                    tile_map->ArkPieces.push_back(ark_piece);
                 }
+            }
+        }
 
-                // POPULATE THE OBJECT LAYER IF ONE EXISTS.
-                if (tile_map_data.ObjectLayer)
+        // POPULATE THE OBJECT LAYER IF ONE EXISTS.
+        if (tile_map_data.ObjectLayer)
+        {
+            // CREATE ANY TREES IN THE LAYER.
+            for (unsigned int current_tile_y = 0; current_tile_y < TileMap::HEIGHT_IN_TILES; ++current_tile_y)
+            {
+                // CREATE ARK PIECES FOR THIS ROW.
+                for (unsigned int current_tile_x = 0; current_tile_x < TileMap::WIDTH_IN_TILES; ++current_tile_x)
                 {
-                    // CREATE ANY TREES IN THE LAYER.
-                    for (unsigned int current_tile_y = 0; current_tile_y < TileMap::HEIGHT_IN_TILES; ++current_tile_y)
+                    // CHECK IF THE TILE ID IS VALID.
+                    // Some tiles in this layer may not be for valid ark pieces.
+                    uint8_t object_id = (*tile_map_data.ObjectLayer)(current_tile_x, current_tile_y);
+                    bool is_tree = (TREE_OBJECT_ID == object_id);
+                    if (is_tree)
                     {
-                        // CREATE ARK PIECES FOR THIS ROW.
-                        for (unsigned int current_tile_x = 0; current_tile_x < TileMap::WIDTH_IN_TILES; ++current_tile_x)
-                        {
-                            // CHECK IF THE TILE ID IS VALID.
-                            // Some tiles in this layer may not be for valid ark pieces.
-                            uint8_t object_id = (*tile_map_data.ObjectLayer)(current_tile_x, current_tile_y);
-                            const uint8_t TREE_OBJECT_ID = 1;
-                            bool is_tree = (TREE_OBJECT_ID == object_id);
-                            if (is_tree)
-                            {
-                                ++tree_count;
-
-                                // DETERMINE THE SUB-RECTANGLE OF THE TEXTURE TO USE FOR THE TREE.
-                                MATH::FloatRectangle TALL_TREE_TEXTURE_SUB_RECTANGLE = MATH::FloatRectangle::FromLeftTopAndDimensions(32.0f, 0.0f, 16.0f, 32.0f);
-                                MATH::FloatRectangle tree_texture_sub_rectangle = TALL_TREE_TEXTURE_SUB_RECTANGLE;
-
-                                // CREATE THE TREE'S SPRITE.
-                                GRAPHICS::AnimatedSprite tree_sprite(GRAPHICS::Sprite(RESOURCES::AssetId::TREE_TEXTURE, tree_texture_sub_rectangle));
-                                MATH::Vector2f tree_local_center = tree_sprite.CurrentFrameSprite.Origin;
-                                auto tree_left_x = current_tile_x * Tile::DIMENSION_IN_PIXELS<unsigned int>;
-                                auto tree_top_y = current_tile_y * Tile::DIMENSION_IN_PIXELS<unsigned int>;
-                                float tree_left_world_x_position = map_left_world_position + static_cast<float>(tree_left_x);
-                                float tree_top_world_y_position = map_top_world_position + static_cast<float>(tree_top_y);
-                                float tree_world_x_position = tree_left_world_x_position + tree_local_center.X;
-                                float tree_world_y_position = tree_top_world_y_position + tree_local_center.Y;
-                                tree_sprite.SetWorldPosition(tree_world_x_position, tree_world_y_position);
-
-                                // ADD APPROPRIATE ANIMATIONS TO THE TREE.
-                                const std::string TREE_SHAKE_ANIMATION_NAME = "TreeShake";
-                                const bool NO_LOOPING = false;
-                                const sf::Time TREE_SHAKE_DURATION = sf::seconds(0.6f);
-                                const std::vector<MATH::IntRectangle> TREE_SHAKE_FRAMES =
-                                {
-                                    MATH::IntRectangle::FromLeftTopAndDimensions(32, 0, 16, 32),
-                                    MATH::IntRectangle::FromLeftTopAndDimensions(64, 0, 16, 32),
-                                    MATH::IntRectangle::FromLeftTopAndDimensions(32, 0, 16, 32),
-                                    MATH::IntRectangle::FromLeftTopAndDimensions(80, 0, 16, 32),
-                                    MATH::IntRectangle::FromLeftTopAndDimensions(32, 0, 16, 32),
-                                    MATH::IntRectangle::FromLeftTopAndDimensions(64, 0, 16, 32),
-                                    MATH::IntRectangle::FromLeftTopAndDimensions(32, 0, 16, 32),
-                                    MATH::IntRectangle::FromLeftTopAndDimensions(80, 0, 16, 32),
-                                    MATH::IntRectangle::FromLeftTopAndDimensions(32, 0, 16, 32)
-                                };
-                                std::shared_ptr<GRAPHICS::AnimationSequence> tree_shake_animation = std::make_shared<GRAPHICS::AnimationSequence>(
-                                    TREE_SHAKE_ANIMATION_NAME,
-                                    NO_LOOPING,
-                                    TREE_SHAKE_DURATION,
-                                    TREE_SHAKE_FRAMES);
-                                tree_sprite.AddAnimationSequence(tree_shake_animation);
-
-                                // CREATE ANY FOOD ON THE TREE.
-                                // Food will be randomly generated unless food already exists on the tree from a previous state.
-                                // This is to preserve the food that might exist from the new game intro sequence.
-                                std::optional<OBJECTS::Food> food = std::nullopt;
-
-                                bool previous_tree_exists = false;
-                                TileMap* previous_tile_map_at_current_location = MapGrid.GetTileMap(row, column);
-                                if (previous_tile_map_at_current_location)
-                                {
-                                    unsigned int previous_tile_map_tree_count = static_cast<unsigned int>(previous_tile_map_at_current_location->Trees.size());
-                                    previous_tree_exists = (previous_tile_map_tree_count >= tree_count);
-                                    if (previous_tree_exists)
-                                    {
-                                        unsigned int tree_index = tree_count - 1;
-                                        OBJECTS::Tree& previous_tree = previous_tile_map_at_current_location->Trees[tree_index];
-                                        food = previous_tree.Food;
-                                    }
-                                }
-
-                                // If a previous tree didn't exist, then randomly put some food on the tree.
-                                if (!previous_tree_exists)
-                                {
-                                    unsigned int random_number_for_food_existing = random_number_generator.RandomNumber<unsigned int>();
-                                    bool food_on_tree = MATH::Number::IsEven(random_number_for_food_existing);
-                                    if (food_on_tree)
-                                    {
-                                        // DETERMINE THE TYPE OF FOOD.
-                                        // It will be randomly determined.
-                                        OBJECTS::Food::TypeId food_type = random_number_generator.RandomEnum<OBJECTS::Food::TypeId>();
-
-                                        // GET THE SPRITE FOR THE FOOD.
-                                        // The food can only be created if the sprite was retrieved.
-                                        std::shared_ptr<GRAPHICS::Sprite> food_sprite = RESOURCES::FoodGraphics::GetSprite(food_type);
-                                        if (food_sprite)
-                                        {
-                                            // CREATE THE FOOD.
-                                            food = OBJECTS::Food();
-                                            food->Type = food_type;
-                                            food->Count = OBJECTS::Food::COUNT_PER_INSTANCE_FROM_TREES;
-                                            food->Sprite = GRAPHICS::Sprite(*food_sprite);
-
-                                            // The food should be positioned on the tree.
-                                            food->Sprite.WorldPosition = tree_sprite.GetWorldPosition();
-                                        }
-                                    }
-                                }
-
-                                // CREATE THE TREE.
-                                OBJECTS::Tree tree;
-                                tree.Sprite = tree_sprite;
-                                tree.Food = food;
-                                tile_map->Trees.push_back(tree);
-                            }
-                        }
+                        // CREATE THE TREE.
+                        OBJECTS::Tree tree = CreateTree(map_left_top_world_position, current_tile_x, current_tile_y);
+
+                        // CREATE ANY FOOD ON THE TREE.
+                        std::size_t tree_index = tile_map->Trees.size();
+                        tree.Food = CreateInitialTreeFood(previous_tile_map, tree_index, tree, random_number_generator);
+
+                        // ADD THE TREE TO THE TILE MAP.
+                        tile_map->Trees.push_back(std::move(tree));
                     }
                 }
-
-                // SET THE TILE MAP IN THE OVERWORLD.
-                MapGrid.TileMaps(column, row) = tile_map;
             }
         }
 
-        DEBUGGING::DebugConsole::WriteLine("Created tree count: ", tree_count);
-        DEBUGGING::DebugConsole::WriteLine("Ark piece count: ", ark_piece_count);
+        return tile_map;
+    }
+
+    /// Starts streaming tile maps in the overworld, so that only tile maps near the camera are kept in memory.
+    /// Evicted tile maps are reloaded from the raw map data.
+    /// @param[in]  map_data - The raw data for the tile maps in the overworld.  Must remain valid while streaming.
+    /// @param[in]  settings - The settings for streaming tile maps.
+    void Overworld::EnableStreaming(const CONTAINERS::Array2D<DATA::TileMapData>& map_data, const TileMapStreamingSettings& settings)
+    {
+        // LOAD TILE MAPS FROM THE RAW MAP DATA.
+        // Each load gets its own tileset and random number generator since loads may happen simultaneously.
+        // The random number generator is seeded the same as when the tile map was first created,
+        // so that reloaded tile maps have the same food on trees.
+        MultiTileMapGrid::TileMapLoader loader = [this, &map_data](const unsigned int row, const unsigned int column)
+        {
+            Tileset tileset;
+            MATH::RandomNumberGenerator random_number_generator = CreateTreeFoodRandomNumberGenerator(row, column);
+            constexpr const TileMap* NO_PREVIOUS_TILE_MAP = nullptr;
+            std::shared_ptr<TileMap> tile_map = CreateTileMap(
+                MapGrid,
+                row,
+                column,
+                map_data(column, row),
+                NO_PREVIOUS_TILE_MAP,
+                tileset,
+                random_number_generator);
+            return tile_map;
+        };
+        MapGrid.EnableStreaming(loader, settings);
+
+        // APPLY THE BUILT STATUS OF ARK PIECES TO TILE MAPS AS THEY'RE STREAMED IN.
+        MapGrid.OnTileMapResident = [this](TileMap& tile_map)
+        {
+            ApplyArkPiecesBuiltStatus(tile_map);
+        };
+    }
+
+    /// Creates the random number generator for creating food on trees in a tile map.  Each tile map gets its own
+    /// generator seeded from its position, so that the same food is created each time the tile map is created
+    /// (including when reloaded while streaming), regardless of the order in which tile maps are created.
+    /// @param[in]  row - The row of the tile map in the overworld.
+    /// @param[in]  column - The column of the tile map in the overworld.
+    /// @return The random number generator for creating food on trees in the tile map.
+    MATH::RandomNumberGenerator Overworld::CreateTreeFoodRandomNumberGenerator(const unsigned int row, const unsigned int column) const
+    {
+        unsigned int tile_map_index = row * WIDTH_IN_TILE_MAPS + column;
+        unsigned int tile_map_seed = TreeFoodRandomSeed + tile_map_index;
+        MATH::RandomNumberGenerator random_number_generator(tile_map_seed);
+        return random_number_generator;
+    }
+
+    /// Creates an unbuilt ark piece positioned on a tile in a tile map.
+    /// @param[in]  ark_piece_id - The ID of the ark piece to create.
+    /// @param[in]  tile_map_left_top_world_position - The world position of the left-top of the tile map.
+    /// @param[in]  tile_x - The x offset (in tiles) from the left of the tile map for the ark piece.
+    /// @param[in]  tile_y - The y offset (in tiles) from the top of the tile map for the ark piece.
+    /// @return The ark piece.
+    OBJECTS::ArkPiece Overworld::CreateArkPiece(
+        const TileId ark_piece_id,
+        const MATH::Vector2f& tile_map_left_top_world_position,
+        const unsigned int tile_x,
+        const unsigned int tile_y)
+    {
+        OBJECTS::ArkPiece ark_piece(ark_piece_id);
+        MATH::Vector2f ark_piece_local_center = ark_piece.Sprite.Origin;
+        float tile_left_x_position = static_cast<float>(tile_x * Tile::DIMENSION_IN_PIXELS<unsigned int>);
+        float ark_piece_world_x_position = tile_map_left_top_world_position.X + tile_left_x_position + ark_piece_local_center.X;
+        float tile_top_y_position = static_cast<float>(tile_y * Tile::DIMENSION_IN_PIXELS<unsigned int>);
+        float ark_piece_world_y_position = tile_map_left_top_world_position.Y + tile_top_y_position + ark_piece_local_center.Y;
+        ark_piece.Sprite.WorldPosition.X = ark_piece_world_x_position;
+        ark_piece.Sprite.WorldPosition.Y = ark_piece_world_y_position;
+        return ark_piece;
+    }
+
+    /// Creates a tree (without any food) positioned on a tile in a tile map.
+    /// @param[in]  tile_map_left_top_world_position - The world position of the left-top of the tile map.
+    /// @param[in]  tile_x - The x offset (in tiles) from the left of the tile map for the tree.
+    /// @param[in]  tile_y - The y offset (in tiles) from the top of the tile map for the tree.
+    /// @return The tree.
+    OBJECTS::Tree Overworld::CreateTree(
+        const MATH::Vector2f& tile_map_left_top_world_position,
+        const unsigned int tile_x,
+        const unsigned int tile_y)
+    {
+        // DEFINE THE TREE SHAKE ANIMATION FRAMES.
+        // The frames are shared by all trees since they never change.
+        static const std::shared_ptr<const std::vector<MATH::IntRectangle>> TREE_SHAKE_FRAMES =
+            std::make_shared<const std::vector<MATH::IntRectangle>>(std::vector<MATH::IntRectangle>
+            {
+                MATH::IntRectangle::FromLeftTopAndDimensions(32, 0, 16, 32),
+                MATH::IntRectangle::FromLeftTopAndDimensions(64, 0, 16, 32),
+                MATH::IntRectangle::FromLeftTopAndDimensions(32, 0, 16, 32),
+                MATH::IntRectangle::FromLeftTopAndDimensions(80, 0, 16, 32),
+                MATH::IntRectangle::FromLeftTopAndDimensions(32, 0, 16, 32),
+                MATH::IntRectangle::FromLeftTopAndDimensions(64, 0, 16, 32),
+                MATH::IntRectangle::FromLeftTopAndDimensions(32, 0, 16, 32),
+                MATH::IntRectangle::FromLeftTopAndDimensions(80, 0, 16, 32),
+                MATH::IntRectangle::FromLeftTopAndDimensions(32, 0, 16, 32)
+            });
+
+        // DETERMINE THE SUB-RECTANGLE OF THE TEXTURE TO USE FOR THE TREE.
+        MATH::FloatRectangle TALL_TREE_TEXTURE_SUB_RECTANGLE = MATH::FloatRectangle::FromLeftTopAndDimensions(32.0f, 0.0f, 16.0f, 32.0f);
+        MATH::FloatRectangle tree_texture_sub_rectangle = TALL_TREE_TEXTURE_SUB_RECTANGLE;
+
+        // CREATE THE TREE'S SPRITE.
+        GRAPHICS::AnimatedSprite tree_sprite(GRAPHICS::Sprite(RESOURCES::AssetId::TREE_TEXTURE, tree_texture_sub_rectangle));
+        MATH::Vector2f tree_local_center = tree_sprite.CurrentFrameSprite.Origin;
+        auto tree_left_x = tile_x * Tile::DIMENSION_IN_PIXELS<unsigned int>;
+        auto tree_top_y = tile_y * Tile::DIMENSION_IN_PIXELS<unsigned int>;
+        float tree_left_world_x_position = tile_map_left_top_world_position.X + static_cast<float>(tree_left_x);
+        float tree_top_world_y_position = tile_map_left_top_world_position.Y + static_cast<float>(tree_top_y);
+        float tree_world_x_position = tree_left_world_x_position + tree_local_center.X;
+        float tree_world_y_position = tree_top_world_y_position + tree_local_center.Y;
+        tree_sprite.SetWorldPosition(tree_world_x_position, tree_world_y_position);
+
+        // ADD APPROPRIATE ANIMATIONS TO THE TREE.
+        const std::string TREE_SHAKE_ANIMATION_NAME = "TreeShake";
+        const bool NO_LOOPING = false;
+        const sf::Time TREE_SHAKE_DURATION = sf::seconds(0.6f);
+        std::shared_ptr<GRAPHICS::AnimationSequence> tree_shake_animation = std::make_shared<GRAPHICS::AnimationSequence>(
+            TREE_SHAKE_ANIMATION_NAME,
+            NO_LOOPING,
+            TREE_SHAKE_DURATION,
+            TREE_SHAKE_FRAMES);
+        tree_sprite.AddAnimationSequence(tree_shake_animation);
+
+        // CREATE THE TREE.
+        OBJECTS::Tree tree;
+        tree.Sprite = std::move(tree_sprite);
+        return tree;
     }
 
-    /// Sets the built status of all ark pieces in the world.
+    /// Creates any food initially on a tree.
+    /// Food will be randomly generated unless food already exists on the tree from a previous state.
+    /// This is to preserve the food that might exist from the new game intro sequence.
+    /// @param[in]  previous_tile_map - The tile map previously at the tree's location, if any.
+    /// @param[in]  tree_index - The index of the tree within its tile map.
+    /// @param[in]  tree - The tree for which to create food.
+    /// @param[in,out]  random_number_generator - The random number generator for creating food.
+    /// @return Any food initially on the tree.
+    std::optional<OBJECTS::Food> Overworld::CreateInitialTreeFood(
+        const TileMap* const previous_tile_map,
+        const std::size_t tree_index,
+        const OBJECTS::Tree& tree,
+        MATH::RandomNumberGenerator& random_number_generator)
+    {
+        // USE ANY FOOD FROM A PREVIOUS TREE.
+        bool previous_tree_exists = previous_tile_map && (tree_index < previous_tile_map->Trees.size());
+        if (previous_tree_exists)
+        {
+            const OBJECTS::Tree& previous_tree = previous_tile_map->Trees[tree_index];
+            return previous_tree.Food;
+        }
+
+        // CHECK IF FOOD SHOULD RANDOMLY BE PUT ON THE TREE.
+        unsigned int random_number_for_food_existing = random_number_generator.RandomNumber<unsigned int>();
+        bool food_on_tree = MATH::Number::IsEven(random_number_for_food_existing);
+        if (!food_on_tree)
+        {
+            return std::nullopt;
+        }
+
+        // DETERMINE THE TYPE OF FOOD.
+        // It will be randomly determined.
+        OBJECTS::Food::TypeId food_type = random_number_generator.RandomEnum<OBJECTS::Food::TypeId>();
+
+        // GET THE SPRITE FOR THE FOOD.
+        // The food can only be created if the sprite was retrieved.
+        std::shared_ptr<GRAPHICS::Sprite> food_sprite = RESOURCES::FoodGraphics::GetSprite(food_type);
+        if (!food_sprite)
+        {
+            return std::nullopt;
+        }
+
+        // CREATE THE FOOD.
+        OBJECTS::Food food;
+        food.Type = food_type;
+        food.Count = OBJECTS::Food::COUNT_PER_INSTANCE_FROM_TREES;
+        food.Sprite = GRAPHICS::Sprite(*food_sprite);
+
+        // The food should be positioned on the tree.
+        food.Sprite.WorldPosition = tree.Sprite.GetWorldPosition();
+        return food;
+    }
+
+    /// Sets the built status of all ark pieces in the world.  If tile maps are being streamed,
+    /// tile maps that aren't resident aren't loaded; the status is instead applied once they're streamed in.
     /// @param[in]  built - True if ark pieces should be considered built; false if not.
     void Overworld::SetArkPiecesBuiltStatus(const bool built)
     {
-        // SET THE BUILD STATUS OF ALL ARK PIECES IN EACH TILE MAP.
+        // REMEMBER THE BUILT STATUS FOR ANY TILE MAPS STREAMED IN LATER.
+        ArkPiecesBuiltStatus = built;
+
+        // SET THE BUILD STATUS OF ALL ARK PIECES IN EACH RESIDENT TILE MAP.
         unsigned int tile_map_row_count = MapGrid.TileMaps.GetHeight();
         unsigned int tile_map_column_count = MapGrid.TileMaps.GetWidth();
         for (unsigned int tile_map_row_index = 0; tile_map_row_index < tile_map_row_count; ++tile_map_row_index)
@@ -274,10 +436,30 @@ namespace MAPS
                 }
 
                 // SET THE BUILT STATUS EACH ARK PIECE IN THE CURRENT TILE MAP.
-                for (OBJECTS::ArkPiece& ark_piece : current_tile_map->ArkPieces)
-                {
-                    ark_piece.Built = built;
-                }
+                ApplyArkPiecesBuiltStatus(*current_tile_map);
+            }
+        }
+    }
+
+    /// Applies the built status last set for all ark pieces to a single tile map.
+    /// The tile map is only marked as changed if any of its ark pieces actually change.
+    /// @param[in,out]  tile_map - The tile map whose ark pieces should be updated.
+    void Overworld::ApplyArkPiecesBuiltStatus(TileMap& tile_map) const
+    {
+        // MAKE SURE A BUILT STATUS HAS BEEN SET.
+        if (!ArkPiecesBuiltStatus)
+        {
+            return;
+        }
+
+        // SET THE BUILT STATUS OF EACH ARK PIECE IN THE TILE MAP.
+        for (OBJECTS::ArkPiece& ark_piece : tile_map.ArkPieces)
+        {
+            bool built_status_changing = (*ArkPiecesBuiltStatus != ark_piece.Built);
+            if (built_status_changing)
+            {
+                tile_map.MarkChangedFromInitialState();
+                ark_piece.Built = *ArkPiecesBuiltStatus;
             }
         }
     }
@@ -1,9 +1,23 @@
 #pragma once
 
+#include <cstddef>
+#include <memory>
+#include <optional>
 #include <vector>
+#include "Containers/Array2D.h"
+#include "Maps/Data/TileMapData.h"
 #include "Maps/MultiTileMapGrid.h"
+#include "Maps/Tile.h"
+#include "Maps/TileMap.h"
+#include "Maps/TileMapStreaming.h"
+#include "Maps/Tileset.h"
+#include "Math/RandomNumberGenerator.h"
+#include "Math/Vector2.h"
 #include "Memory/Pointers.h"
 #include "Objects/Animal.h"
+#include "Objects/ArkPiece.h"
+#include "Objects/Food.h"
+#include "Objects/Tree.h"
 
 namespace MAPS
 {
@@ -28,13 +42,50 @@ namespace MAPS
         explicit Overworld(MEMORY::NonNullRawPointer<World> world);
 
         // OTHER PUBLIC METHODS.
-        void ResetToInitialState();
+        void ResetToInitialState(const CONTAINERS::Array2D<DATA::TileMapData>& map_data);
         void SetArkPiecesBuiltStatus(const bool built);
+        void EnableStreaming(const CONTAINERS::Array2D<DATA::TileMapData>& map_data, const TileMapStreamingSettings& settings);
+        MATH::RandomNumberGenerator CreateTreeFoodRandomNumberGenerator(const unsigned int row, const unsigned int column) const;
+
+        // OBJECT CREATION.
+        static std::shared_ptr<TileMap> CreateTileMap(
+            MultiTileMapGrid& map_grid,
+            const unsigned int row,
+            const unsigned int column,
+            const DATA::TileMapData& tile_map_data,
+            const TileMap* const previous_tile_map,
+            const Tileset& tileset,
+            MATH::RandomNumberGenerator& random_number_generator);
+        static OBJECTS::ArkPiece CreateArkPiece(
+            const TileId ark_piece_id,
+            const MATH::Vector2f& tile_map_left_top_world_position,
+            const unsigned int tile_x,
+            const unsigned int tile_y);
+        static OBJECTS::Tree CreateTree(
+            const MATH::Vector2f& tile_map_left_top_world_position,
+            const unsigned int tile_x,
+            const unsigned int tile_y);
+        static std::optional<OBJECTS::Food> CreateInitialTreeFood(
+            const TileMap* const previous_tile_map,
+            const std::size_t tree_index,
+            const OBJECTS::Tree& tree,
+            MATH::RandomNumberGenerator& random_number_generator);
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The tile map grid for the overworld.
         MultiTileMapGrid MapGrid;
         /// Animals being transferred from following Noah into the ark.
         std::vector<MEMORY::NonNullSharedPointer<OBJECTS::Animal>> AnimalsGoingIntoArk;
+        /// The built status last set for all ark pieces, if any.  Applied to tile maps
+        /// that weren't resident at the time once they're streamed back in.
+        std::optional<bool> ArkPiecesBuiltStatus = std::nullopt;
+
+    private:
+        // HELPERS.
+        void ApplyArkPiecesBuiltStatus(TileMap& tile_map) const;
+
+        // MEMBER VARIABLES.
+        /// The seed from which random numbers for food on trees in each tile map are generated.
+        unsigned int TreeFoodRandomSeed = 0;
     };
 }
\ No newline at end of file
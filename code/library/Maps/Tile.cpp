@@ -1,5 +1,6 @@
 #include <array>
 #include <limits>
+#include <utility>
 #include "Debugging/DebugConsole.h"
 #include "Maps/Tile.h"
 
@@ -56,12 +57,13 @@ namespace MAPS
     /// Constructor accepting all of a tile's data.
     /// @param[in]  id - A numeric ID identifying the tile in a tileset.
     /// @param[in]  sprite - The sprite used for rendering the tile.
+    ///     Taken by value so that temporary sprites can be moved into the tile without copying.
     Tile::Tile(
         const TileId id,
-        const GRAPHICS::AnimatedSprite& sprite) :
+        GRAPHICS::AnimatedSprite sprite) :
     Id(id),
     Type(static_cast<TileType::Id>(id)),
-    Sprite(sprite)
+    Sprite(std::move(sprite))
     {}
 
     /// Sets the world position of the center of the tile.
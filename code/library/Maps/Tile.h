@@ -96,7 +96,7 @@ namespace MAPS
         explicit Tile();
         explicit Tile(
             const TileId id,
-            const GRAPHICS::AnimatedSprite& sprite);
+            GRAPHICS::AnimatedSprite sprite);
 
         // POSITIONING.
         void SetWorldPosition(const float world_x_position, const float world_y_position);
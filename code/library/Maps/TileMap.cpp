@@ -33,9 +33,7 @@ namespace MAPS
     Ground(center_world_position, dimensions_in_tiles, Tile::DIMENSION_IN_PIXELS<unsigned int>),
     Trees(),
     FallingFood(),
-    FoodOnGround(),
-    DustClouds(),
-    WoodLogs(),
+    Entities(),
     Presents(),
     FlamingSword(),
     OliveLeaf(),
@@ -207,52 +205,53 @@ namespace MAPS
             tree->Update(gaming_hardware.Clock.ElapsedTimeSinceLastFrame);
 
             // START PLAYING THE TREE SHAKING SOUND EFFECT IF APPROPRIATE.
+            // The speakers limit this sound to a single instance, so it won't restart while already playing.
             bool is_shaking = tree->IsShaking();
             if (is_shaking)
             {
-                // ONLY START PLAYING THE SOUND IF IT ISN'T ALREADY PLAYING.
-                // This results in a smoother sound experience.
-                bool tree_shake_sound_playing = gaming_hardware.Speakers->SoundIsPlaying(RESOURCES::AssetId::TREE_SHAKE_SOUND);
-                if (!tree_shake_sound_playing)
-                {
-                    gaming_hardware.Speakers->PlaySoundEffect(RESOURCES::AssetId::TREE_SHAKE_SOUND);
-                }
+                gaming_hardware.Speakers->PlaySoundEffect(RESOURCES::AssetId::TREE_SHAKE_SOUND, tree->Sprite.GetWorldPosition());
             }
         }
 
-        // UPDATE THE CURRENT TILE MAP'S DUST CLOUDS.
-        for (auto dust_cloud = DustClouds.begin(); dust_cloud != DustClouds.end();)
-        {
-            // UPDATE THE CURRENT DUST CLOUD.
-            dust_cloud->Update(gaming_hardware.Clock.ElapsedTimeSinceLastFrame);
+        // UPDATE THE CURRENT TILE MAP'S TRANSIENT OBJECTS.
+        UpdateTransientObjects(objects_can_move_across_space, gaming_hardware.Clock.ElapsedTimeSinceLastFrame);
 
-            // REMOVE THE DUST CLOUD IF IT HAS DISAPPEARED.
-            bool dust_cloud_disappeared = dust_cloud->HasDisappeared();
-            if (dust_cloud_disappeared)
-            {
-                // REMOVE THE DUST CLOUD.
-                dust_cloud = DustClouds.erase(dust_cloud);
-            }
-            else
-            {
-                // MOVE TO UPDATING THE NEXT DUST CLOUD.
-                ++dust_cloud;
-            }
+        // CHECK IF MOVABLE OBJECTS CAN BE UPDATED.
+        if (!objects_can_move_across_space)
+        {
+            // No more updates are needed.
+            return;
         }
 
+        // MOVE ANIMALS.
+        MoveAnimals(current_game_data, gaming_hardware);
+    }
+
+    /// Updates the transient objects (dust clouds, falling food, the flaming sword, etc.) in the tile map
+    /// based on elapsed time.  These objects are frequently created and destroyed, so they are stored in
+    /// fixed-capacity storage to avoid allocating memory each frame.
+    /// @param[in]  objects_can_move_across_space - True if objects are allowed to move across space;
+    ///     false if not.  Food only falls if objects can move.
+    /// @param[in]  elapsed_time - The elapsed time for which to update the objects.
+    void TileMap::UpdateTransientObjects(const bool objects_can_move_across_space, const sf::Time& elapsed_time)
+    {
+        // UPDATE THE CURRENT TILE MAP'S SIMPLE ENTITIES.
+        // This animates dust clouds and removes any that have disappeared.
+        Entities.Update(elapsed_time);
+
         // UPDATE ANY SMOKE ON THE ALTAR.
         if (Altar)
         {
             if (Altar->OfferingSmoke.Sprite.CurrentFrameSprite.IsVisible)
             {
-                Altar->OfferingSmoke.Update(gaming_hardware.Clock.ElapsedTimeSinceLastFrame);
+                Altar->OfferingSmoke.Update(elapsed_time);
             }
         }
 
         // UPDATE ANY FLAMING SWORD.
         if (FlamingSword)
         {
-            FlamingSword->Update(gaming_hardware.Clock.ElapsedTimeSinceLastFrame);
+            FlamingSword->Update(elapsed_time);
 
             // If the flaming sword has finished being updated, then it should be removed from this map.
             if (!FlamingSword->Sprite.IsVisible)
@@ -269,27 +268,129 @@ namespace MAPS
         }
 
         // UPDATE ANY FALLING FOOD.
-        for (auto food = FallingFood.begin(); food != FallingFood.end();)
+        for (auto food = FallingFood.begin(); food != FallingFood.end(); ++food)
         {
             // UPDATE THE CURRENT FOOD ITEM.
-            food->Fall(gaming_hardware.Clock.ElapsedTimeSinceLastFrame);
+            food->Fall(elapsed_time);
 
             // TRANSFER THE FOOD OVER IF IT HAS FINISHED FALLING.
+            // Destroying the food doesn't affect iterating to the next falling food item.
             bool food_finished_falling = food->FinishedFalling();
             if (food_finished_falling)
             {
-                FoodOnGround.push_back(food->FoodItem);
-                food = FallingFood.erase(food);
+                Entities.AddFood(food->FoodItem);
+                FallingFood.Destroy(food.GetHandle());
             }
-            else
+        }
+    }
+
+    /// Saves the current state of the tile map as its initial state, to which it can later be reset.
+    /// Should be called once the world has been fully built.
+    void TileMap::SaveInitialState()
+    {
+        // COPY THE TILE MAP AS ITS INITIAL STATE.
+        // The previous initial state is released first so that the copy doesn't refer to it.
+        InitialState = nullptr;
+        ChangedFromInitialState = false;
+        auto initial_state = std::make_shared<TileMap>(*this);
+        initial_state->CopySharedObjects();
+        InitialState = initial_state;
+    }
+
+    /// Marks the tile map as possibly having changed since its initial state,
+    /// so that it will be restored the next time it is reset.
+    void TileMap::MarkChangedFromInitialState()
+    {
+        ChangedFromInitialState = true;
+    }
+
+    /// Checks if the tile map may have changed since its initial state was saved.
+    /// @return True if the tile map may have changed; false if it definitely hasn't.
+    bool TileMap::HasChangedFromInitialState() const
+    {
+        return ChangedFromInitialState;
+    }
+
+    /// Resets the tile map to its saved initial state.  Tile maps that haven't changed since
+    /// their initial state are left alone, so the cost of resetting is proportional only to
+    /// the number of changed tile maps.  The tile map itself isn't recreated, so pointers
+    /// to it (such as from exit points) remain valid.
+    /// @return True if the tile map is in its initial state; false if no initial state has been saved.
+    bool TileMap::ResetToInitialState()
+    {
+        // MAKE SURE AN INITIAL STATE EXISTS.
+        if (!InitialState)
+        {
+            return false;
+        }
+
+        // CHECK IF THE TILE MAP NEEDS TO BE RESTORED.
+        if (!ChangedFromInitialState)
+        {
+            return true;
+        }
+
+        // RESTORE THE GROUND.
+        // Only pointers to tiles are copied since tiles are shared with the initial state,
+        // which undoes any tiles that were replaced (such as when the ark's exits are closed).
+        Ground.Tiles = InitialState->Ground.Tiles;
+
+        // RESTORE OBJECTS IN THE TILE MAP.
+        Trees = InitialState->Trees;
+        FallingFood = InitialState->FallingFood;
+        Entities = InitialState->Entities;
+        Presents = InitialState->Presents;
+        FlamingSword = InitialState->FlamingSword;
+        OliveLeaf = InitialState->OliveLeaf;
+        Altar = InitialState->Altar;
+        ArkPieces = InitialState->ArkPieces;
+        RoamingAnimals = InitialState->RoamingAnimals;
+        AnimalPens = InitialState->AnimalPens;
+        ExitPoints = InitialState->ExitPoints;
+        // Objects shared by pointer must be copied so that they can change again without changing the initial state.
+        CopySharedObjects();
+
+        ChangedFromInitialState = false;
+        return true;
+    }
+
+    /// Gives the tile map its own copies of any objects that are shared by pointer when a tile map
+    /// is copied (animals and the animation sequences for animals and trees), so that they can
+    /// change without changing any other copy of the tile map.
+    void TileMap::CopySharedObjects()
+    {
+        // COPY TREE ANIMATIONS.
+        for (auto& tree : Trees)
+        {
+            tree.Sprite.CopyAnimationSequences();
+        }
+
+        // COPY ROAMING ANIMALS.
+        for (auto& animal : RoamingAnimals)
+        {
+            animal = MEMORY::NonNullSharedPointer<OBJECTS::Animal>(std::make_shared<OBJECTS::Animal>(*animal));
+            animal->Sprite.CopyAnimationSequences();
+        }
+
+        // COPY ANIMALS IN PENS.
+        for (auto& animal_pen : AnimalPens)
+        {
+            for (auto& animal : animal_pen.Animals)
             {
-                // MOVE TO THE NEXT FALLING FOOD ITEM.
-                ++food;
+                animal = MEMORY::NonNullSharedPointer<OBJECTS::Animal>(std::make_shared<OBJECTS::Animal>(*animal));
+                animal->Sprite.CopyAnimationSequences();
             }
         }
+    }
 
-        // MOVE ANIMALS.
-        MoveAnimals(current_game_data, gaming_hardware);
+    /// Releases the tiles in the ground layer, along with any saved initial state sharing them,
+    /// so that they no longer take up memory while the tile map is evicted from its map grid.
+    /// Tiles in the ground layer only change on tile maps with exit points (which are never evicted),
+    /// so the ground can simply be recreated from the raw map data when the tile map is reloaded.
+    void TileMap::ReleaseGround()
+    {
+        Ground.Tiles = CONTAINERS::Array2D<std::shared_ptr<Tile>>();
+        InitialState = nullptr;
     }
 
     /// Moves animals in the tile map.
@@ -381,6 +482,13 @@ namespace MAPS
             }
         }
 
+        // TRACK THAT THE TILE MAP IS CHANGING IF ANY ANIMALS WILL MOVE IN IT.
+        // Other changes to the tile map are tracked where they're made, but animals move on their own.
+        if (!RoamingAnimals.empty())
+        {
+            MarkChangedFromInitialState();
+        }
+
         // MOVE EACH ANIMAL IN THE TILE MAP CLOSER TO NOAH IF THEY'RE OUTSIDE.
         for (auto& animal : RoamingAnimals)
         {
@@ -397,13 +505,15 @@ namespace MAPS
             MATH::Vector2f animal_move_vector = MATH::Vector2f::Scale(animal_move_distance_in_pixels, animal_to_noah_direction);
 
             // DETERMINE THE TYPES OF TILES THE ANIMAL IS ALLOWED TO MOVE OVER.
-            std::unordered_set<MAPS::TileType::Id> tile_types_allowed_to_move_over =
+            // The set is only needed for this frame, so it's allocated from the frame arena.
+            std::pmr::unordered_set<MAPS::TileType::Id> tile_types_allowed_to_move_over(gaming_hardware.FrameArena.get());
+            tile_types_allowed_to_move_over.insert(
             {
                 MAPS::TileType::SAND,
                 MAPS::TileType::GRASS,
                 MAPS::TileType::BROWN_DIRT,
                 MAPS::TileType::GRAY_STONE
-            };
+            });
             bool animal_can_fly = animal->Type.CanFly();
             bool animal_can_swim = animal->Type.CanSwim();
             bool animal_move_move_over_water = (animal_can_fly || animal_can_swim);
@@ -445,6 +555,7 @@ namespace MAPS
                 {
                     continue;
                 }
+                MarkChangedFromInitialState();
 
                 float elapsed_time_in_seconds = gaming_hardware.Clock.ElapsedTimeSinceLastFrame.asSeconds();
                 float normal_animal_move_speed_in_pixels_per_second = animal->Type.MoveSpeedInPixelsPerSecond;
@@ -462,10 +573,8 @@ namespace MAPS
                 MATH::Vector2f animal_move_vector = MATH::Vector2f::Scale(animal_move_distance_in_pixels, animal_direction_vector);
 
                 // MOVE THE ANIMAL.
-                std::unordered_set<MAPS::TileType::Id> tile_types_allowed_to_move_over =
-                {
-                    MAPS::TileType::ANIMAL_PEN_GROUND
-                };
+                std::pmr::unordered_set<MAPS::TileType::Id> tile_types_allowed_to_move_over(gaming_hardware.FrameArena.get());
+                tile_types_allowed_to_move_over.insert(MAPS::TileType::ANIMAL_PEN_GROUND);
                 MATH::FloatRectangle animal_world_bounding_box = animal->Sprite.GetWorldBoundingBox();
                 constexpr bool NO_MOVEMENT_OVER_SOLID_OBJECTS = false;
                 MATH::Vector2f new_animal_world_position = COLLISION::CollisionDetectionAlgorithms::MoveObject(
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <cstddef>
+#include <memory>
 #include <optional>
 #include <vector>
 #include <SFML/System.hpp>
 #include "Audio/Speakers.h"
+#include "Containers/ObjectPool.h"
 #include "Hardware/GamingHardware.h"
 #include "Maps/AnimalPen.h"
 #include "Maps/ExitPoint.h"
@@ -14,13 +17,12 @@
 #include "Objects/Animal.h"
 #include "Objects/Altar.h"
 #include "Objects/ArkPiece.h"
-#include "Objects/DustCloud.h"
+#include "Objects/EntityStorage.h"
 #include "Objects/FlamingSword.h"
 #include "Objects/Food.h"
 #include "Objects/Present.h"
 #include "Objects/OliveLeaf.h"
 #include "Objects/Tree.h"
-#include "Objects/WoodLogs.h"
 #include "States/SavedGameData.h"
 
 namespace MAPS
@@ -40,6 +42,12 @@ namespace MAPS
         /// The height of a tile map, in tiles.
         static const unsigned int HEIGHT_IN_TILES = 24;
 
+        // OBJECT CAPACITY CONSTANTS.
+        /// The maximum number of food items that may be falling at once in a tile map.
+        static constexpr std::size_t MAX_FALLING_FOOD_COUNT = 16;
+        /// The maximum number of presents that may be on the ground at once in a tile map.
+        static constexpr std::size_t MAX_PRESENT_COUNT = 16;
+
         // CONSTRUCTION.
         explicit TileMap(
             const TileMapType type,
@@ -64,6 +72,16 @@ namespace MAPS
             const bool objects_can_move_across_space,
             STATES::SavedGameData& current_game_data,
             HARDWARE::GamingHardware& gaming_hardware);
+        void UpdateTransientObjects(const bool objects_can_move_across_space, const sf::Time& elapsed_time);
+
+        // INITIAL STATE.
+        void SaveInitialState();
+        void MarkChangedFromInitialState();
+        bool HasChangedFromInitialState() const;
+        bool ResetToInitialState();
+
+        // RESIDENCY.
+        void ReleaseGround();
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The type of tile map.
@@ -80,16 +98,13 @@ namespace MAPS
         std::vector<OBJECTS::Tree> Trees;
         /// Food that is falling off a plant toward the ground.
         /// After food falls off of a plant, it should be transferred here.
-        std::vector<OBJECTS::FallingFood> FallingFood;
-        /// Food in the tile map that has fallen to the ground.
-        /// After food has finished falling, it should be transferred here.
-        std::vector<OBJECTS::Food> FoodOnGround;
-        /// Dust clouds within the tile map.
-        std::vector<OBJECTS::DustCloud> DustClouds;
-        /// Wooden logs that have appeared in the map from chopped down trees.
-        std::vector<OBJECTS::WoodLogs> WoodLogs;
+        CONTAINERS::ObjectPool<OBJECTS::FallingFood, MAX_FALLING_FOOD_COUNT> FallingFood;
+        /// Simple entities in the tile map:  wooden logs that have appeared from chopped down trees,
+        /// dust clouds, and food that has fallen to the ground.  After food has finished falling,
+        /// it should be transferred here.  Entities are reordered when any are removed.
+        OBJECTS::EntityStorage Entities;
         /// Presents on the ground (left by animals and containing Bible verses).
-        std::vector<OBJECTS::Present> Presents;
+        CONTAINERS::ObjectPool<OBJECTS::Present, MAX_PRESENT_COUNT> Presents;
         /// Any flaming sword in the map.  Randomly appears/disappears.
         std::optional<OBJECTS::FlamingSword> FlamingSword;
         /// An olive leaf that is broke back by the dove.
@@ -110,5 +125,20 @@ namespace MAPS
     private:
         // UPDATING HELPER METHODS.
         void MoveAnimals(STATES::SavedGameData& current_game_data, HARDWARE::GamingHardware& gaming_hardware);
+
+        // INITIAL STATE HELPER METHODS.
+        void CopySharedObjects();
+
+        // MEMBER VARIABLES.
+        /// An immutable copy of the tile map from when the world was first built, if saved.
+        /// Ground tiles are shared with this copy rather than duplicated, so only the objects
+        /// in the tile map (which are what may change during gameplay) take up additional memory.
+        /// Objects otherwise shared by pointer (animals and animation sequences) are copied so that
+        /// changing them during gameplay doesn't change this copy.
+        std::shared_ptr<const TileMap> InitialState = nullptr;
+        /// True if the tile map may have changed since its initial state was saved.
+        /// Set whenever the tile map is retrieved for changing or changed during gameplay,
+        /// so that only such tile maps need to be restored when resetting the world.
+        bool ChangedFromInitialState = false;
     };
 }
\ No newline at end of file
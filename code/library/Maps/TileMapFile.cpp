@@ -0,0 +1,292 @@
+#include <cstddef>
+#include "Maps/Ark.h"
+#include "Maps/Overworld.h"
+#include "Maps/TileMap.h"
+#include "Maps/TileMapFile.h"
+
+namespace MAPS
+{
+    /// Writes map data into the map file format.
+    /// @param[in]  map_data - The map data to write.
+    /// @return The bytes of the map file.
+    std::string TileMapFile::Write(const DATA::WorldMapData& map_data)
+    {
+        // WRITE THE HEADER.
+        FILESYSTEM::BinaryWriter writer;
+        writer.WriteBytes(FILE_MAGIC);
+        writer.WriteUInt32(FILE_FORMAT_VERSION);
+
+        // WRITE THE OVERWORLD.
+        WriteMapGrid(map_data.Overworld, writer);
+
+        // WRITE THE ARK INTERIOR.
+        writer.WriteUInt32(static_cast<std::uint32_t>(map_data.ArkInteriorLayersFromBottomToTop.size()));
+        for (const CONTAINERS::Array2D<DATA::TileMapData>& ark_interior_layer_data : map_data.ArkInteriorLayersFromBottomToTop)
+        {
+            WriteMapGrid(ark_interior_layer_data, writer);
+        }
+
+        return writer.Bytes;
+    }
+
+    /// Reads map data from the bytes of a map file.
+    /// @param[in]  file_bytes - The bytes of the map file.
+    /// @return The map data, if the file was valid and had the expected number of tile maps
+    ///     and tiles for the world; null otherwise.
+    std::optional<DATA::WorldMapData> TileMapFile::Read(const std::string_view file_bytes)
+    {
+        // VERIFY THE HEADER.
+        bool file_has_header = file_bytes.starts_with(FILE_MAGIC);
+        if (!file_has_header)
+        {
+            return std::nullopt;
+        }
+
+        FILESYSTEM::BinaryReader reader(file_bytes);
+        reader.Skip(FILE_MAGIC.size());
+        std::uint32_t file_format_version = reader.ReadUInt32();
+        bool file_format_supported = !reader.Failed() && (FILE_FORMAT_VERSION == file_format_version);
+        if (!file_format_supported)
+        {
+            return std::nullopt;
+        }
+
+        // READ THE OVERWORLD.
+        DATA::WorldMapData map_data;
+        bool overworld_read = ReadMapGrid(Overworld::WIDTH_IN_TILE_MAPS, Overworld::HEIGHT_IN_TILE_MAPS, reader, map_data.Overworld);
+        if (!overworld_read)
+        {
+            return std::nullopt;
+        }
+
+        // READ THE ARK INTERIOR.
+        std::uint32_t ark_interior_layer_count = reader.ReadUInt32();
+        if (Ark::LAYER_COUNT != ark_interior_layer_count)
+        {
+            return std::nullopt;
+        }
+
+        map_data.ArkInteriorLayersFromBottomToTop.resize(ark_interior_layer_count);
+        for (CONTAINERS::Array2D<DATA::TileMapData>& ark_interior_layer_data : map_data.ArkInteriorLayersFromBottomToTop)
+        {
+            bool ark_interior_layer_read = ReadMapGrid(
+                Ark::INTERIOR_WIDTH_IN_TILE_MAPS,
+                Ark::INTERIOR_HEIGHT_IN_TILE_MAPS,
+                reader,
+                ark_interior_layer_data);
+            if (!ark_interior_layer_read)
+            {
+                return std::nullopt;
+            }
+        }
+
+        // MAKE SURE THE ENTIRE FILE WAS VALID.
+        bool entire_file_read = !reader.Failed() && (0 == reader.RemainingByteCount());
+        if (!entire_file_read)
+        {
+            return std::nullopt;
+        }
+
+        return map_data;
+    }
+
+    /// Writes the data for a map grid.
+    /// @param[in]  map_grid_data - The data for the tile maps in the map grid.
+    /// @param[in,out]  writer - The writer to write to.
+    void TileMapFile::WriteMapGrid(const CONTAINERS::Array2D<DATA::TileMapData>& map_grid_data, FILESYSTEM::BinaryWriter& writer)
+    {
+        unsigned int width_in_tile_maps = map_grid_data.GetWidth();
+        unsigned int height_in_tile_maps = map_grid_data.GetHeight();
+        writer.WriteUInt32(width_in_tile_maps);
+        writer.WriteUInt32(height_in_tile_maps);
+        for (unsigned int row = 0; row < height_in_tile_maps; ++row)
+        {
+            for (unsigned int column = 0; column < width_in_tile_maps; ++column)
+            {
+                const DATA::TileMapData& tile_map_data = map_grid_data(column, row);
+                WriteLayer(tile_map_data.GroundLayer, writer);
+                WriteLayer(tile_map_data.ArkLayer, writer);
+                WriteLayer(tile_map_data.ObjectLayer, writer);
+            }
+        }
+    }
+
+    /// Writes a layer of a tile map, with tile IDs compressed into runs.
+    /// @param[in]  layer - The layer to write.  May be missing if a tile map doesn't have the layer.
+    /// @param[in,out]  writer - The writer to write to.
+    void TileMapFile::WriteLayer(const std::optional<CONTAINERS::Array2D<std::uint8_t>>& layer, FILESYSTEM::BinaryWriter& writer)
+    {
+        // WRITE WHETHER THE LAYER EXISTS.
+        bool layer_exists = layer.has_value();
+        writer.WriteBool(layer_exists);
+        if (!layer_exists)
+        {
+            return;
+        }
+
+        // WRITE THE DIMENSIONS OF THE LAYER.
+        unsigned int width_in_tiles = layer->GetWidth();
+        unsigned int height_in_tiles = layer->GetHeight();
+        writer.WriteUInt32(width_in_tiles);
+        writer.WriteUInt32(height_in_tiles);
+
+        // WRITE RUNS OF TILE IDS.
+        // Tiles are ordered by row like in memory, so runs may continue across rows.
+        std::size_t tile_count = static_cast<std::size_t>(width_in_tiles) * static_cast<std::size_t>(height_in_tiles);
+        std::size_t tile_index = 0;
+        while (tile_index < tile_count)
+        {
+            // FIND HOW MANY TILES IN A ROW HAVE THE SAME ID.
+            auto get_tile_id = [&layer, width_in_tiles](const std::size_t index)
+            {
+                unsigned int x = static_cast<unsigned int>(index % width_in_tiles);
+                unsigned int y = static_cast<unsigned int>(index / width_in_tiles);
+                return (*layer)(x, y);
+            };
+            std::uint8_t tile_id = get_tile_id(tile_index);
+            std::size_t run_length_in_tiles = 1;
+            while (true)
+            {
+                std::size_t next_tile_index = tile_index + run_length_in_tiles;
+                bool run_can_continue = (
+                    (run_length_in_tiles < MAX_RUN_LENGTH_IN_TILES) &&
+                    (next_tile_index < tile_count) &&
+                    (tile_id == get_tile_id(next_tile_index)));
+                if (!run_can_continue)
+                {
+                    break;
+                }
+
+                ++run_length_in_tiles;
+            }
+
+            // WRITE THE RUN.
+            writer.WriteUInt8(static_cast<std::uint8_t>(run_length_in_tiles));
+            writer.WriteUInt8(tile_id);
+            tile_index += run_length_in_tiles;
+        }
+    }
+
+    /// Reads the data for a map grid.
+    /// @param[in]  expected_width_in_tile_maps - The width the map grid must have.
+    /// @param[in]  expected_height_in_tile_maps - The height the map grid must have.
+    /// @param[in,out]  reader - The reader to read from.
+    /// @param[out] map_grid_data - The data for the tile maps in the map grid.
+    /// @return True if the map grid was read; false if the data was invalid.
+    bool TileMapFile::ReadMapGrid(
+        const unsigned int expected_width_in_tile_maps,
+        const unsigned int expected_height_in_tile_maps,
+        FILESYSTEM::BinaryReader& reader,
+        CONTAINERS::Array2D<DATA::TileMapData>& map_grid_data)
+    {
+        // VERIFY THE DIMENSIONS OF THE MAP GRID.
+        std::uint32_t width_in_tile_maps = reader.ReadUInt32();
+        std::uint32_t height_in_tile_maps = reader.ReadUInt32();
+        bool map_grid_dimensions_valid = (
+            !reader.Failed() &&
+            (expected_width_in_tile_maps == width_in_tile_maps) &&
+            (expected_height_in_tile_maps == height_in_tile_maps));
+        if (!map_grid_dimensions_valid)
+        {
+            return false;
+        }
+
+        // READ EACH TILE MAP.
+        map_grid_data.Resize(width_in_tile_maps, height_in_tile_maps);
+        for (unsigned int row = 0; row < height_in_tile_maps; ++row)
+        {
+            for (unsigned int column = 0; column < width_in_tile_maps; ++column)
+            {
+                // READ EACH LAYER OF THE TILE MAP.
+                DATA::TileMapData& tile_map_data = map_grid_data(column, row);
+                bool tile_map_read = (
+                    ReadLayer(reader, tile_map_data.GroundLayer) &&
+                    ReadLayer(reader, tile_map_data.ArkLayer) &&
+                    ReadLayer(reader, tile_map_data.ObjectLayer));
+                if (!tile_map_read)
+                {
+                    return false;
+                }
+
+                // MAKE SURE THE TILE MAP HAS GROUND.
+                // Every tile map is built from at least its ground layer.
+                if (!tile_map_data.GroundLayer)
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    /// Reads a layer of a tile map, decoding runs of tile IDs directly into the layer.
+    /// @param[in,out]  reader - The reader to read from.
+    /// @param[out] layer - The layer read.  Left missing if the tile map doesn't have the layer.
+    /// @return True if the layer was read; false if the data was invalid.
+    bool TileMapFile::ReadLayer(FILESYSTEM::BinaryReader& reader, std::optional<CONTAINERS::Array2D<std::uint8_t>>& layer)
+    {
+        // CHECK IF THE LAYER EXISTS.
+        bool layer_exists = reader.ReadBool();
+        if (reader.Failed())
+        {
+            return false;
+        }
+        if (!layer_exists)
+        {
+            layer.reset();
+            return true;
+        }
+
+        // VERIFY THE DIMENSIONS OF THE LAYER.
+        std::uint32_t width_in_tiles = reader.ReadUInt32();
+        std::uint32_t height_in_tiles = reader.ReadUInt32();
+        bool layer_dimensions_valid = (
+            !reader.Failed() &&
+            (TileMap::WIDTH_IN_TILES == width_in_tiles) &&
+            (TileMap::HEIGHT_IN_TILES == height_in_tiles));
+        if (!layer_dimensions_valid)
+        {
+            return false;
+        }
+
+        // READ RUNS OF TILE IDS.
+        // Tiles are filled in by row directly in the layer, so the position of the next tile is tracked
+        // as runs are read rather than recalculated for each tile.
+        CONTAINERS::Array2D<std::uint8_t>& layer_tiles = layer.emplace(width_in_tiles, height_in_tiles);
+        unsigned int x = 0;
+        unsigned int y = 0;
+        while (y < height_in_tiles)
+        {
+            // READ THE CURRENT RUN.
+            std::uint8_t run_length_in_tiles = reader.ReadUInt8();
+            std::uint8_t tile_id = reader.ReadUInt8();
+            std::size_t remaining_tile_count = static_cast<std::size_t>(height_in_tiles - y) * width_in_tiles - x;
+            bool run_valid = (
+                !reader.Failed() &&
+                (run_length_in_tiles > 0) &&
+                (run_length_in_tiles <= remaining_tile_count));
+            if (!run_valid)
+            {
+                return false;
+            }
+
+            // FILL IN THE TILES IN THE RUN.
+            for (unsigned int run_tile_index = 0; run_tile_index < run_length_in_tiles; ++run_tile_index)
+            {
+                layer_tiles(x, y) = tile_id;
+
+                // MOVE TO THE NEXT TILE.
+                ++x;
+                bool row_finished = (x >= width_in_tiles);
+                if (row_finished)
+                {
+                    x = 0;
+                    ++y;
+                }
+            }
+        }
+
+        return true;
+    }
+}
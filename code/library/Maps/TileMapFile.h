@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include "Containers/Array2D.h"
+#include "Filesystem/BinaryReader.h"
+#include "Filesystem/BinaryWriter.h"
+#include "Maps/Data/TileMapData.h"
+#include "Maps/Data/WorldMapData.h"
+
+namespace MAPS
+{
+    /// A compact binary file holding the raw data for all tile maps in the world.
+    ///
+    /// Map data used to be compiled into the game as large arrays, which slowed down compiling and
+    /// required rebuilding the game for any map change.  Map files are instead packed with the intro
+    /// sequence assets and decoded when the game starts.
+    ///
+    /// After a header (magic bytes and format version), a file has the overworld map grid, followed by
+    /// a count of ark interior layers and a map grid for each layer from bottom to top.  Each map grid has its
+    /// width and height in tile maps, followed by the ground, ark, and object layers for each tile map by row.
+    /// Each layer has a byte indicating if it exists, and if so, its width and height in tiles, followed by
+    /// its tile IDs (by row) compressed into runs of a single repeated ID.  Each run is a length byte and an ID byte.
+    class TileMapFile
+    {
+    public:
+        // CONSTANTS.
+        /// The bytes at the start of every map file.
+        static constexpr std::string_view FILE_MAGIC = "NOAM";
+        /// The current version of the map file format.
+        static constexpr std::uint32_t FILE_FORMAT_VERSION = 1;
+        /// The maximum number of tiles in a single run of tile IDs.
+        static constexpr unsigned int MAX_RUN_LENGTH_IN_TILES = 255;
+
+        // WRITING.
+        static std::string Write(const DATA::WorldMapData& map_data);
+
+        // READING.
+        static std::optional<DATA::WorldMapData> Read(const std::string_view file_bytes);
+
+    private:
+        // WRITING HELPERS.
+        static void WriteMapGrid(const CONTAINERS::Array2D<DATA::TileMapData>& map_grid_data, FILESYSTEM::BinaryWriter& writer);
+        static void WriteLayer(const std::optional<CONTAINERS::Array2D<std::uint8_t>>& layer, FILESYSTEM::BinaryWriter& writer);
+
+        // READING HELPERS.
+        static bool ReadMapGrid(
+            const unsigned int expected_width_in_tile_maps,
+            const unsigned int expected_height_in_tile_maps,
+            FILESYSTEM::BinaryReader& reader,
+            CONTAINERS::Array2D<DATA::TileMapData>& map_grid_data);
+        static bool ReadLayer(FILESYSTEM::BinaryReader& reader, std::optional<CONTAINERS::Array2D<std::uint8_t>>& layer);
+    };
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace MAPS
+{
+    /// Settings for streaming tile maps in a map grid, so that only tile maps
+    /// around the camera need to be in memory.
+    class TileMapStreamingSettings
+    {
+    public:
+        /// How far (in tile maps) from the tile map being focused on that tile maps are kept resident.
+        /// Must be at least 1 so that all tile maps the camera can see or scroll to are resident.
+        unsigned int ResidentRadiusInTileMaps = 1;
+        /// The maximum number of tile maps to keep resident.  Tile maps outside of the resident radius
+        /// are kept until this budget is exceeded, so that quickly returning to a tile map doesn't require
+        /// reloading it.  Tile maps within the resident radius and tile maps with exit points
+        /// are never evicted, so more tile maps may be resident if the budget is too small.
+        unsigned int MaxResidentTileMapCount = 16;
+    };
+
+    /// Metrics for tile map streaming to help tune streaming settings.
+    class TileMapStreamingMetrics
+    {
+    public:
+        /// The number of tile maps loaded in the background before they were needed.
+        std::size_t BackgroundLoadCount = 0;
+        /// The number of times a tile map was needed before it finished loading,
+        /// requiring waiting for the tile map to load.
+        std::size_t LoadStallCount = 0;
+        /// The total time spent waiting for tile maps to load.
+        std::chrono::microseconds TotalLoadStallTime = std::chrono::microseconds::zero();
+        /// The longest time spent waiting for a single tile map to load.
+        std::chrono::microseconds LongestLoadStallTime = std::chrono::microseconds::zero();
+        /// The number of tile maps evicted from memory.
+        std::size_t EvictionCount = 0;
+        /// The number of evicted tile maps that had changed, requiring their objects to be kept.
+        std::size_t ChangedEvictionCount = 0;
+    };
+}
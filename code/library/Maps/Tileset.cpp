@@ -1,3 +1,6 @@
+#include <memory>
+#include <optional>
+#include <utility>
 #include "Maps/Tileset.h"
 
 namespace MAPS
@@ -9,7 +12,7 @@ namespace MAPS
         const MAPS::TileId FIRST_TILE_ID = 1;
         MAPS::TileId current_tile_id = FIRST_TILE_ID;
         // This dimensions are hardcoded to avoid needing to have to pass the actual texture resource here.
-        MATH::Vector2ui tileset_texture_dimensions(128, 48);
+        MATH::Vector2ui tileset_texture_dimensions(TEXTURE_WIDTH_IN_PIXELS, TEXTURE_HEIGHT_IN_PIXELS);
         unsigned int row_count_of_tiles = tileset_texture_dimensions.Y / Tile::DIMENSION_IN_PIXELS<unsigned int>;
         unsigned int column_count_of_tiles = tileset_texture_dimensions.X / Tile::DIMENSION_IN_PIXELS<unsigned int>;
         for (unsigned int tile_row_index = 0;
@@ -41,13 +44,20 @@ namespace MAPS
     }
 
     /// Sets the data in the set for the tile with the specified ID.
-    /// @param[in]  tile_id - The unique ID of the tile.
+    /// @param[in]  tile_id - The unique ID of the tile.  Ignored if larger than the max tile ID.
     /// @param[in]  texture_sub_rectangle - The sub-rectangle within
     ///     the texture holding graphics for the tile.
     void Tileset::SetTile(
         const TileId tile_id,
         const MATH::FloatRectangle& texture_sub_rectangle)
     {
+        // MAKE SURE THE TILE ID IS VALID.
+        bool tile_id_valid = (tile_id <= MAX_TILE_ID);
+        if (!tile_id_valid)
+        {
+            return;
+        }
+
         TileTextureSubRectangles[tile_id] = texture_sub_rectangle;
     }
 
@@ -57,18 +67,38 @@ namespace MAPS
     /// @return The tile, if successfully created; null otherwise.
     std::shared_ptr<Tile> Tileset::CreateTile(const TileId tile_id) const
     {
-        // GET THE TEXTURE SUB-RECTANGLE FOR THE TILE.
-        auto id_with_sub_rectangle = TileTextureSubRectangles.find(tile_id);
-        bool sub_rectangle_exists = (TileTextureSubRectangles.cend() != id_with_sub_rectangle);
-        if (!sub_rectangle_exists)
+        // CREATE THE TILE.
+        std::optional<Tile> tile = CreateUnsharedTile(tile_id);
+        if (!tile)
         {
             return nullptr;
         }
 
+        return std::make_shared<Tile>(std::move(*tile));
+    }
+
+    /// Creates an unpositioned tile based on the data in the tileset identified by the given tile ID.
+    /// Useful for storing many tiles together rather than allocating each individually.
+    /// @param[in]  tile_id - The ID of the type of tile to create.
+    /// @return The tile, if successfully created; null otherwise.
+    std::optional<Tile> Tileset::CreateUnsharedTile(const TileId tile_id) const
+    {
+        // GET THE TEXTURE SUB-RECTANGLE FOR THE TILE.
+        bool tile_id_valid = (tile_id <= MAX_TILE_ID);
+        if (!tile_id_valid)
+        {
+            return std::nullopt;
+        }
+        const std::optional<MATH::FloatRectangle>& sub_rectangle = TileTextureSubRectangles[tile_id];
+        if (!sub_rectangle)
+        {
+            return std::nullopt;
+        }
+
         // CREATE A SPRITE FOR THE TILE.
         GRAPHICS::AnimatedSprite sprite(GRAPHICS::Sprite(
             RESOURCES::AssetId::MAIN_TILESET_TEXTURE,
-            id_with_sub_rectangle->second));
+            *sub_rectangle));
 
         // ADD ANIMATION SEQUENCES FOR WATER TILES.
         bool is_water_tile = TileType::IsForWater(static_cast<TileType::Id>(tile_id));
@@ -77,12 +107,14 @@ namespace MAPS
             const std::string WATER_ANIMATION_NAME = "WaterAnimation";
             const bool IS_LOOPING = true;
             const sf::Time ANIMATION_DURATION = sf::seconds(1.2f);
-            const std::vector<MATH::IntRectangle> ANIMATION_FRAMES = 
-            {
-                MATH::IntRectangle::FromLeftTopAndDimensions(64, 0, 16, 16),
-                MATH::IntRectangle::FromLeftTopAndDimensions(16, 32, 16, 16),
-                MATH::IntRectangle::FromLeftTopAndDimensions(32, 32, 16, 16)
-            };
+            // The frames are shared by all water tiles since they never change.
+            static const std::shared_ptr<const std::vector<MATH::IntRectangle>> ANIMATION_FRAMES =
+                std::make_shared<const std::vector<MATH::IntRectangle>>(std::vector<MATH::IntRectangle>
+                {
+                    MATH::IntRectangle::FromLeftTopAndDimensions(64, 0, 16, 16),
+                    MATH::IntRectangle::FromLeftTopAndDimensions(16, 32, 16, 16),
+                    MATH::IntRectangle::FromLeftTopAndDimensions(32, 32, 16, 16)
+                });
             auto water_animation_sequence = std::make_shared<GRAPHICS::AnimationSequence>(
                 WATER_ANIMATION_NAME,
                 IS_LOOPING,
@@ -93,7 +125,6 @@ namespace MAPS
         }
 
         // CREATE THE TILE.
-        std::shared_ptr<Tile> tile = std::make_shared<Tile>(tile_id, sprite);
-        return tile;
+        return Tile(tile_id, std::move(sprite));
     }
 }
\ No newline at end of file
@@ -1,7 +1,8 @@
 #pragma once
 
+#include <array>
 #include <memory>
-#include <unordered_map>
+#include <optional>
 #include <vector>
 #include "Graphics/Texture.h"
 #include "Maps/Tile.h"
@@ -10,9 +11,22 @@
 namespace MAPS
 {
     /// A collection of tile data from which tiles can be created.
+    /// Tile data is stored in a fixed-size array indexed by tile ID,
+    /// so creating a tileset doesn't require any dynamic allocations.
     class Tileset
     {
     public:
+        // CONSTANTS.
+        /// The width of the tileset texture, in pixels.
+        static constexpr unsigned int TEXTURE_WIDTH_IN_PIXELS = 128;
+        /// The height of the tileset texture, in pixels.
+        static constexpr unsigned int TEXTURE_HEIGHT_IN_PIXELS = 48;
+        /// The largest tile ID in the tileset.  Tile IDs start at 1.
+        static constexpr TileId MAX_TILE_ID =
+            (TEXTURE_WIDTH_IN_PIXELS / Tile::DIMENSION_IN_PIXELS<unsigned int>) *
+            (TEXTURE_HEIGHT_IN_PIXELS / Tile::DIMENSION_IN_PIXELS<unsigned int>);
+
+        // CONSTRUCTION.
         explicit Tileset();
 
         void SetTile(
@@ -20,9 +34,11 @@ namespace MAPS
             const MATH::FloatRectangle& texture_sub_rectangle);
 
         std::shared_ptr<Tile> CreateTile(const TileId tile_id) const;
+        std::optional<Tile> CreateUnsharedTile(const TileId tile_id) const;
 
     private:
-        /// Sub-rectangles within textures for tiles mapped by tile ID.
-        std::unordered_map<TileId, MATH::FloatRectangle> TileTextureSubRectangles = std::unordered_map<TileId, MATH::FloatRectangle>();
+        /// Sub-rectangles within textures for tiles indexed by tile ID.
+        /// Tile IDs without any sub-rectangle don't exist in the tileset.
+        std::array<std::optional<MATH::FloatRectangle>, MAX_TILE_ID + 1> TileTextureSubRectangles = {};
     };
 }
\ No newline at end of file
@@ -1,30 +1,44 @@
-#include "Maps/Data/ArkInteriorTileMapData.h"
-#include "Maps/Data/OverworldMapData.h"
+#include <optional>
+#include <string>
+#include <utility>
 #include "Maps/Tileset.h"
 #include "Maps/World.h"
+#include "Maps/WorldSnapshot.h"
 #include "Math/Number.h"
 #include "Resources/FoodGraphics.h"
 
 namespace MAPS
 {
     /// Creates the world in its initial state.
+    /// @param[in]  map_data - The raw map data from which to build the world.
     /// @return The world in its initial state.
     ///     The world is dynamically allocated to ensure that pointers between
     ///     parts of the world remain consistent, which would be harder to do
     ///     if a regular constructor were used due to the potential for copies.
-    MEMORY::NonNullSharedPointer<World> World::CreateInitial()
+    MEMORY::NonNullSharedPointer<World> World::CreateInitial(DATA::WorldMapData map_data)
     {
         // POPULATE THE WORLD.
-        MEMORY::NonNullSharedPointer<World> world = MEMORY::NonNullSharedPointer<World>(std::make_shared<World>());
+        MEMORY::NonNullSharedPointer<World> world = MEMORY::NonNullSharedPointer<World>(std::make_shared<World>(std::move(map_data)));
 
         // RETURN THE POPULATED WORLD.
         return world;
     }
 
-    /// Default constructor.
-    World::World() :
+    /// Constructor.  Builds the entire world in a single pass.
+    /// @param[in]  map_data - The raw map data from which to build the world.
+    World::World(DATA::WorldMapData map_data) :
+        World(std::move(map_data), std::string())
+    {}
+
+    /// Constructor.  Builds the entire world in a single pass, from a snapshot if possible.
+    /// @param[in]  map_data - The raw map data from which to build the world.
+    /// @param[in]  initial_snapshot - A snapshot of the world in its initial state.
+    ///     May be empty if the world should be built from the raw map data.
+    World::World(DATA::WorldMapData map_data, std::string initial_snapshot) :
+        MapData(std::move(map_data)),
+        InitialSnapshot(std::move(initial_snapshot)),
         Overworld(MEMORY::NonNullRawPointer<World>(this)),
-        Ark(MEMORY::NonNullRawPointer<World>(this)),
+        Ark(),
         NoahPlayer(std::make_shared<OBJECTS::Noah>()),
         FamilyMembers()
     {
@@ -32,20 +46,56 @@ namespace MAPS
     }
 
     /// Resets the world to its initial state.  Useful for switching between different saved games.
+    /// Once the world has been built, its initial state is kept so that later resets only need to
+    /// restore the tile maps that may have changed, with terrain tiles shared rather than recreated.
     void World::ResetToInitialState()
     {
+        // RESTORE ANY CHANGED TILE MAPS FROM THE WORLD'S SAVED INITIAL STATE IF POSSIBLE.
+        bool reset_from_initial_state = ResetMapGridsToInitialState();
+        if (reset_from_initial_state)
+        {
+            // CLEAR ANY ANIMALS GOING INTO THE ARK.
+            // If a saved game is being reloaded, the animals should re-appear behind Noah since
+            // they don't officially "transfer state" until they enter the ark.
+            Overworld.AnimalsGoingIntoArk.clear();
+            // Ark pieces in tile maps streamed in later should be left in their initial state.
+            Overworld.ArkPiecesBuiltStatus = std::nullopt;
+            return;
+        }
+
+        // BUILD THE WORLD.
+        BuildInitialState();
+
+        // SAVE THE INITIAL STATE OF THE WORLD FOR FUTURE RESETS.
+        Overworld.MapGrid.SaveInitialState();
+        for (MultiTileMapGrid& ark_interior_layer : Ark.Interior.LayersFromBottomToTop)
+        {
+            ark_interior_layer.SaveInitialState();
+        }
+    }
+
+    /// Builds the world in its initial state, from its initial snapshot if possible.
+    void World::BuildInitialState()
+    {
+        // RESTORE THE WORLD FROM ITS INITIAL SNAPSHOT IF POSSIBLE.
+        bool restored_from_snapshot = !InitialSnapshot.empty() && WorldSnapshot::Restore(InitialSnapshot, *this);
+        if (restored_from_snapshot)
+        {
+            return;
+        }
+
         // RESET THE OVERWORLD.
-        Overworld.ResetToInitialState();
+        Overworld.ResetToInitialState(MapData.Overworld);
 
         // RESET THE ARK.
-        Ark.ResetToInitialState(MEMORY::NonNullRawPointer<World>(this));
+        Ark.ResetToInitialState(MEMORY::NonNullRawPointer<World>(this), MapData.ArkInteriorLayersFromBottomToTop);
 
         // CREATE THE EXIT POINTS BETWEEN MAP GRIDS.
         // The ark interior data used for exit points is currently hard-coded to simplify
         // things since I'm not sure yet exactly how we want to structure this.
         // The ark should always be entered at the bottom layer.
         auto& starting_ark_map_grid = Ark.Interior.LayersFromBottomToTop.front();
-        TileMap* starting_ark_interior_tile_map = &*starting_ark_map_grid.TileMaps(1, 0);
+        TileMap* starting_ark_interior_tile_map = Ark.GetEntranceMapForChanging();
         // For now, this is hardcoded to an arbitrary place near the bottom of the starting tile map.
         MATH::FloatRectangle ark_interior_bounding_box = starting_ark_interior_tile_map->GetWorldBoundingBox();
         float ark_interior_center_x_position = ark_interior_bounding_box.CenterX();
@@ -110,7 +160,7 @@ namespace MAPS
         for (const auto& built_ark_piece : built_ark_pieces)
         {
             // GET THE TILE MAP FOR THE BUILT ARK PIECES.
-            TileMap* current_tile_map = Overworld.MapGrid.GetTileMap(built_ark_piece.Sprite.WorldPosition.X, built_ark_piece.Sprite.WorldPosition.Y);
+            TileMap* current_tile_map = Overworld.MapGrid.GetTileMapForChanging(built_ark_piece.Sprite.WorldPosition.X, built_ark_piece.Sprite.WorldPosition.Y);
             if (!current_tile_map)
             {
                 // Continue trying to initialize other ark pieces.
@@ -125,4 +175,27 @@ namespace MAPS
             }
         }
     }
+
+    /// Resets all map grids in the world to their saved initial state.
+    /// @return True if all map grids were reset; false if the world hasn't been fully built yet.
+    bool World::ResetMapGridsToInitialState()
+    {
+        // MAKE SURE THE ARK INTERIOR HAS BEEN BUILT.
+        if (Ark.Interior.LayersFromBottomToTop.empty())
+        {
+            return false;
+        }
+
+        // RESET THE OVERWORLD.
+        bool all_map_grids_reset = Overworld.MapGrid.ResetToInitialState();
+
+        // RESET THE ARK INTERIOR.
+        for (MultiTileMapGrid& ark_interior_layer : Ark.Interior.LayersFromBottomToTop)
+        {
+            bool ark_interior_layer_reset = ark_interior_layer.ResetToInitialState();
+            all_map_grids_reset = all_map_grids_reset && ark_interior_layer_reset;
+        }
+
+        return all_map_grids_reset;
+    }
 }
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <string>
 #include <vector>
 #include "Maps/Ark.h"
+#include "Maps/Data/WorldMapData.h"
 #include "Maps/MultiTileMapGrid.h"
 #include "Maps/Overworld.h"
 #include "Math/Vector2.h"
@@ -13,16 +15,26 @@
 namespace MAPS
 {
     /// The entire game world.
+    /// The world is built from raw map data (typically read from a map file - see TileMapFile).
+    /// The world may instead be built from a prebuilt snapshot of its initial state (see WorldSnapshot)
+    /// to avoid searching through all of the raw map data when the game starts.  Once built, the initial state
+    /// of each tile map is kept so that switching between saved games only restores tile maps that may have changed.
     class World
     {
     public:
         // CONSTRUCTION/INITIALIZATION.
-        static MEMORY::NonNullSharedPointer<World> CreateInitial();
-        explicit World();
+        static MEMORY::NonNullSharedPointer<World> CreateInitial(DATA::WorldMapData map_data);
+        explicit World(DATA::WorldMapData map_data);
+        explicit World(DATA::WorldMapData map_data, std::string initial_snapshot);
         void ResetToInitialState();
         void InitializeBuiltArkInOverworld(const std::vector<OBJECTS::ArkPiece>& built_ark_pieces);
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The raw map data from which the world is built.
+        DATA::WorldMapData MapData;
+        /// A snapshot of the world in its initial state from which the world is reset, if available.
+        /// The world is built from the raw map data if the snapshot is empty or out-of-date.
+        std::string InitialSnapshot;
         /// The overworld of the game.
         Overworld Overworld;
         /// The ark.
@@ -34,5 +46,10 @@ namespace MAPS
         /// They are stored in the world, rather than separately in the overworld or ark,
         /// to make them easier to access regardless of game state.
         std::vector<OBJECTS::FamilyMember> FamilyMembers;
+
+    private:
+        // INITIALIZATION HELPERS.
+        void BuildInitialState();
+        bool ResetMapGridsToInitialState();
     };
 }
@@ -0,0 +1,584 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+#include "Maps/Ark.h"
+#include "Maps/ExitPoint.h"
+#include "Maps/Overworld.h"
+#include "Maps/World.h"
+#include "Maps/WorldSnapshot.h"
+
+namespace MAPS
+{
+    /// Creates a snapshot of a world.
+    /// @param[in]  world - The world (in its initial state) for which to create a snapshot.
+    /// @return The bytes of the snapshot.
+    std::string WorldSnapshot::Create(const World& world)
+    {
+        // WRITE THE HEADER.
+        FILESYSTEM::BinaryWriter writer;
+        writer.WriteBytes(FILE_MAGIC);
+        writer.WriteUInt32(FILE_FORMAT_VERSION);
+        writer.WriteUInt64(HashMapData(world.MapData));
+
+        // GET ALL MAP GRIDS IN THE ORDER THEY'RE INDEXED.
+        std::vector<const MultiTileMapGrid*> map_grids = { &world.Overworld.MapGrid };
+        for (const MultiTileMapGrid& ark_interior_layer : world.Ark.Interior.LayersFromBottomToTop)
+        {
+            map_grids.push_back(&ark_interior_layer);
+        }
+
+        // WRITE EACH MAP GRID.
+        writer.WriteUInt32(static_cast<std::uint32_t>(map_grids.size()));
+        for (const MultiTileMapGrid* map_grid : map_grids)
+        {
+            unsigned int width_in_tile_maps = map_grid->TileMaps.GetWidth();
+            unsigned int height_in_tile_maps = map_grid->TileMaps.GetHeight();
+            writer.WriteUInt32(width_in_tile_maps);
+            writer.WriteUInt32(height_in_tile_maps);
+            for (unsigned int row = 0; row < height_in_tile_maps; ++row)
+            {
+                for (unsigned int column = 0; column < width_in_tile_maps; ++column)
+                {
+                    const TileMap* tile_map = map_grid->GetTileMap(row, column);
+                    WriteTileMap(tile_map, writer);
+                }
+            }
+        }
+
+        // FIND ALL EXIT POINTS.
+        // They're written after all map grids since they may lead to any map grid.
+        struct ExitPointSource
+        {
+            std::uint32_t MapGridIndex = 0;
+            const TileMap* SourceTileMap = nullptr;
+            const ExitPoint* SourceExitPoint = nullptr;
+        };
+        std::vector<ExitPointSource> exit_point_sources;
+        for (std::size_t map_grid_index = 0; map_grid_index < map_grids.size(); ++map_grid_index)
+        {
+            const MultiTileMapGrid& map_grid = *map_grids[map_grid_index];
+            for (unsigned int row = 0; row < map_grid.TileMaps.GetHeight(); ++row)
+            {
+                for (unsigned int column = 0; column < map_grid.TileMaps.GetWidth(); ++column)
+                {
+                    const TileMap* tile_map = map_grid.GetTileMap(row, column);
+                    if (!tile_map)
+                    {
+                        continue;
+                    }
+
+                    for (const ExitPoint& exit_point : tile_map->ExitPoints)
+                    {
+                        exit_point_sources.push_back(ExitPointSource
+                        {
+                            .MapGridIndex = static_cast<std::uint32_t>(map_grid_index),
+                            .SourceTileMap = tile_map,
+                            .SourceExitPoint = &exit_point
+                        });
+                    }
+                }
+            }
+        }
+
+        // WRITE ALL EXIT POINTS.
+        writer.WriteUInt32(static_cast<std::uint32_t>(exit_point_sources.size()));
+        for (const ExitPointSource& exit_point_source : exit_point_sources)
+        {
+            writer.WriteUInt32(exit_point_source.MapGridIndex);
+            writer.WriteUInt32(exit_point_source.SourceTileMap->GridRowIndex);
+            writer.WriteUInt32(exit_point_source.SourceTileMap->GridColumnIndex);
+
+            const ExitPoint& exit_point = *exit_point_source.SourceExitPoint;
+            writer.WriteFloat(exit_point.BoundingBox.LeftTop.X);
+            writer.WriteFloat(exit_point.BoundingBox.LeftTop.Y);
+            writer.WriteFloat(exit_point.BoundingBox.RightBottom.X);
+            writer.WriteFloat(exit_point.BoundingBox.RightBottom.Y);
+
+            // The new map grid is written by index since pointers can't be saved.
+            std::uint32_t new_map_grid_index = 0;
+            for (std::size_t map_grid_index = 0; map_grid_index < map_grids.size(); ++map_grid_index)
+            {
+                if (map_grids[map_grid_index] == exit_point.NewMapGrid)
+                {
+                    new_map_grid_index = static_cast<std::uint32_t>(map_grid_index);
+                }
+            }
+            writer.WriteUInt32(new_map_grid_index);
+            writer.WriteUInt32(exit_point.NewTileMap->GridRowIndex);
+            writer.WriteUInt32(exit_point.NewTileMap->GridColumnIndex);
+            writer.WriteFloat(exit_point.NewPlayerWorldPosition.X);
+            writer.WriteFloat(exit_point.NewPlayerWorldPosition.Y);
+        }
+
+        return writer.Bytes;
+    }
+
+    /// Restores a world to its initial state from a snapshot.  The world is left unchanged
+    /// if the snapshot is invalid or was created from different map data.
+    /// @param[in]  snapshot_bytes - The bytes of the snapshot.
+    /// @param[in,out]  world - The world to restore.  Any food on trees in the overworld is preserved.
+    /// @return True if the world was restored; false if not.
+    bool WorldSnapshot::Restore(const std::string_view snapshot_bytes, World& world)
+    {
+        // MAKE SURE THE SNAPSHOT IS FOR THE CURRENT MAP DATA.
+        bool snapshot_has_header = snapshot_bytes.starts_with(FILE_MAGIC);
+        if (!snapshot_has_header)
+        {
+            return false;
+        }
+
+        FILESYSTEM::BinaryReader reader(snapshot_bytes);
+        reader.Skip(FILE_MAGIC.size());
+        std::uint32_t file_format_version = reader.ReadUInt32();
+        std::uint64_t map_data_hash = reader.ReadUInt64();
+        bool snapshot_current = !reader.Failed() && (FILE_FORMAT_VERSION == file_format_version) && (HashMapData(world.MapData) == map_data_hash);
+        if (!snapshot_current)
+        {
+            return false;
+        }
+
+        std::size_t ark_interior_layer_count = world.MapData.ArkInteriorLayersFromBottomToTop.size();
+        std::size_t map_grid_count = FIRST_ARK_INTERIOR_MAP_GRID_INDEX + ark_interior_layer_count;
+        std::uint32_t snapshot_map_grid_count = reader.ReadUInt32();
+        if (map_grid_count != snapshot_map_grid_count)
+        {
+            return false;
+        }
+
+        // READ EACH MAP GRID.
+        // Tile maps are read into separate containers so that the world isn't changed until the entire snapshot is read.
+        CONTAINERS::Array2D<std::shared_ptr<TileMap>> overworld_tile_maps(Overworld::WIDTH_IN_TILE_MAPS, Overworld::HEIGHT_IN_TILE_MAPS);
+        std::vector<MultiTileMapGrid> ark_interior_layers;
+        // Space for the layers must be reserved to avoid reallocations that would invalidate pointers.
+        // Moving the layers into the ark later moves the whole buffer, so pointers remain valid after that.
+        ark_interior_layers.reserve(ark_interior_layer_count);
+        std::vector<MultiTileMapGrid*> map_grids;
+        std::vector<CONTAINERS::Array2D<std::shared_ptr<TileMap>>*> map_grid_tile_maps;
+        Tileset tileset;
+        for (std::uint32_t map_grid_index = 0; map_grid_index < map_grid_count; ++map_grid_index)
+        {
+            // MAKE SURE THE MAP GRID HAS THE EXPECTED DIMENSIONS.
+            bool is_overworld = (OVERWORLD_MAP_GRID_INDEX == map_grid_index);
+            unsigned int width_in_tile_maps = is_overworld ? Overworld::WIDTH_IN_TILE_MAPS : Ark::INTERIOR_WIDTH_IN_TILE_MAPS;
+            unsigned int height_in_tile_maps = is_overworld ? Overworld::HEIGHT_IN_TILE_MAPS : Ark::INTERIOR_HEIGHT_IN_TILE_MAPS;
+            std::uint32_t snapshot_width_in_tile_maps = reader.ReadUInt32();
+            std::uint32_t snapshot_height_in_tile_maps = reader.ReadUInt32();
+            bool dimensions_match = (width_in_tile_maps == snapshot_width_in_tile_maps) && (height_in_tile_maps == snapshot_height_in_tile_maps);
+            if (!dimensions_match)
+            {
+                return false;
+            }
+
+            // GET THE MAP GRID TO READ INTO.
+            MultiTileMapGrid* map_grid = &world.Overworld.MapGrid;
+            CONTAINERS::Array2D<std::shared_ptr<TileMap>>* tile_maps = &overworld_tile_maps;
+            TileMapType tile_map_type = TileMapType::OVERWORLD;
+            unsigned int ark_interior_layer_index = 0;
+            if (!is_overworld)
+            {
+                map_grid = &ark_interior_layers.emplace_back(width_in_tile_maps, height_in_tile_maps, MEMORY::NonNullRawPointer<World>(&world));
+                tile_maps = &map_grid->TileMaps;
+                tile_map_type = TileMapType::ARK_INTERIOR;
+                ark_interior_layer_index = map_grid_index - FIRST_ARK_INTERIOR_MAP_GRID_INDEX;
+            }
+            map_grids.push_back(map_grid);
+            map_grid_tile_maps.push_back(tile_maps);
+
+            // READ EACH TILE MAP.
+            for (unsigned int row = 0; row < height_in_tile_maps; ++row)
+            {
+                for (unsigned int column = 0; column < width_in_tile_maps; ++column)
+                {
+                    // Only the overworld has food that may need to be preserved.
+                    // Food is otherwise created the same as if the tile map were created from the raw map data.
+                    const TileMap* previous_tile_map = is_overworld ? world.Overworld.MapGrid.GetTileMap(row, column) : nullptr;
+                    MATH::RandomNumberGenerator random_number_generator = world.Overworld.CreateTreeFoodRandomNumberGenerator(row, column);
+                    std::shared_ptr<TileMap> tile_map = ReadTileMap(
+                        tile_map_type,
+                        *map_grid,
+                        ark_interior_layer_index,
+                        row,
+                        column,
+                        previous_tile_map,
+                        tileset,
+                        random_number_generator,
+                        reader);
+                    if (!tile_map)
+                    {
+                        return false;
+                    }
+
+                    (*tile_maps)(column, row) = std::move(tile_map);
+                }
+            }
+        }
+
+        // READ EACH EXIT POINT.
+        std::uint32_t exit_point_count = reader.ReadUInt32();
+        for (std::uint32_t exit_point_index = 0; exit_point_index < exit_point_count; ++exit_point_index)
+        {
+            std::uint32_t map_grid_index = reader.ReadUInt32();
+            std::uint32_t row = reader.ReadUInt32();
+            std::uint32_t column = reader.ReadUInt32();
+
+            ExitPoint exit_point;
+            exit_point.BoundingBox.LeftTop.X = reader.ReadFloat();
+            exit_point.BoundingBox.LeftTop.Y = reader.ReadFloat();
+            exit_point.BoundingBox.RightBottom.X = reader.ReadFloat();
+            exit_point.BoundingBox.RightBottom.Y = reader.ReadFloat();
+
+            std::uint32_t new_map_grid_index = reader.ReadUInt32();
+            std::uint32_t new_row = reader.ReadUInt32();
+            std::uint32_t new_column = reader.ReadUInt32();
+            exit_point.NewPlayerWorldPosition.X = reader.ReadFloat();
+            exit_point.NewPlayerWorldPosition.Y = reader.ReadFloat();
+
+            // FIX UP THE TILE MAPS FOR THE EXIT POINT.
+            bool tile_map_valid = (map_grid_index < map_grid_count) && map_grid_tile_maps[map_grid_index]->IndicesInRange(column, row);
+            bool new_tile_map_valid = (new_map_grid_index < map_grid_count) && map_grid_tile_maps[new_map_grid_index]->IndicesInRange(new_column, new_row);
+            bool exit_point_valid = !reader.Failed() && tile_map_valid && new_tile_map_valid;
+            if (!exit_point_valid)
+            {
+                return false;
+            }
+
+            exit_point.NewMapGrid = map_grids[new_map_grid_index];
+            exit_point.NewTileMap = (*map_grid_tile_maps[new_map_grid_index])(new_column, new_row).get();
+            (*map_grid_tile_maps[map_grid_index])(column, row)->ExitPoints.push_back(exit_point);
+        }
+
+        if (reader.Failed())
+        {
+            return false;
+        }
+
+        // REPLACE THE WORLD'S MAPS WITH THE RESTORED MAPS.
+        // If a saved game is being reloaded, animals going into the ark should re-appear behind Noah since
+        // they don't officially "transfer state" until they enter the ark.
+        world.Overworld.AnimalsGoingIntoArk.clear();
+        world.Overworld.ArkPiecesBuiltStatus = std::nullopt;
+        world.Overworld.MapGrid.TileMaps = std::move(overworld_tile_maps);
+        world.Ark.Interior.LayersFromBottomToTop = std::move(ark_interior_layers);
+        return true;
+    }
+
+    /// Writes a tile map to a snapshot.
+    /// @param[in]  tile_map - The tile map to write.  An empty tile map is written if null.
+    /// @param[in,out]  writer - The writer for the snapshot.
+    void WorldSnapshot::WriteTileMap(const TileMap* const tile_map, FILESYSTEM::BinaryWriter& writer)
+    {
+        // WRITE THE IDS OF ALL TILES IN THE GROUND LAYER.
+        // Missing tiles are written as 0, which isn't a valid tile ID.
+        std::string tile_ids(static_cast<std::size_t>(TileMap::WIDTH_IN_TILES) * TileMap::HEIGHT_IN_TILES, '\0');
+        if (tile_map)
+        {
+            for (unsigned int tile_y = 0; tile_y < TileMap::HEIGHT_IN_TILES; ++tile_y)
+            {
+                for (unsigned int tile_x = 0; tile_x < TileMap::WIDTH_IN_TILES; ++tile_x)
+                {
+                    const std::shared_ptr<Tile>& tile = tile_map->Ground.Tiles(tile_x, tile_y);
+                    if (tile)
+                    {
+                        std::size_t tile_index = static_cast<std::size_t>(tile_y) * TileMap::WIDTH_IN_TILES + tile_x;
+                        tile_ids[tile_index] = static_cast<char>(tile->Id);
+                    }
+                }
+            }
+        }
+        writer.WriteBytes(tile_ids);
+
+        if (!tile_map)
+        {
+            constexpr std::uint32_t NO_OBJECTS = 0;
+            writer.WriteUInt32(NO_OBJECTS);
+            writer.WriteUInt32(NO_OBJECTS);
+            writer.WriteUInt32(NO_OBJECTS);
+            return;
+        }
+
+        // WRITE THE TILES ON WHICH EACH OBJECT IS LOCATED.
+        writer.WriteUInt32(static_cast<std::uint32_t>(tile_map->ArkPieces.size()));
+        for (const OBJECTS::ArkPiece& ark_piece : tile_map->ArkPieces)
+        {
+            // Ark pieces are positioned by their origins relative to the left-top of their tiles.
+            MATH::Vector2f ark_piece_tile_left_top_world_position = ark_piece.Sprite.WorldPosition - ark_piece.Sprite.Origin;
+            MATH::Vector2ui tile_indices = GetTileIndices(*tile_map, ark_piece_tile_left_top_world_position);
+            writer.WriteUInt32(ark_piece.Id);
+            writer.WriteUInt8(static_cast<std::uint8_t>(tile_indices.X));
+            writer.WriteUInt8(static_cast<std::uint8_t>(tile_indices.Y));
+        }
+
+        writer.WriteUInt32(static_cast<std::uint32_t>(tile_map->Trees.size()));
+        for (const OBJECTS::Tree& tree : tile_map->Trees)
+        {
+            // Trees are positioned by their origins relative to the left-top of their tiles.
+            MATH::Vector2f tree_tile_left_top_world_position = tree.Sprite.GetWorldPosition() - tree.Sprite.CurrentFrameSprite.Origin;
+            MATH::Vector2ui tile_indices = GetTileIndices(*tile_map, tree_tile_left_top_world_position);
+            writer.WriteUInt8(static_cast<std::uint8_t>(tile_indices.X));
+            writer.WriteUInt8(static_cast<std::uint8_t>(tile_indices.Y));
+        }
+
+        writer.WriteUInt32(static_cast<std::uint32_t>(tile_map->AnimalPens.size()));
+        for (const AnimalPen& animal_pen : tile_map->AnimalPens)
+        {
+            // The entrance to an animal pen is centered along the bottom of its interior.
+            constexpr float HALF_TILE_DIMENSION_IN_PIXELS = Tile::DIMENSION_IN_PIXELS<float> / 2.0f;
+            MATH::Vector2f entrance_left_top_world_position(
+                animal_pen.InteriorBoundingBox.CenterX() - HALF_TILE_DIMENSION_IN_PIXELS,
+                animal_pen.InteriorBoundingBox.RightBottom.Y - HALF_TILE_DIMENSION_IN_PIXELS);
+            MATH::Vector2ui tile_indices = GetTileIndices(*tile_map, entrance_left_top_world_position);
+            writer.WriteUInt8(static_cast<std::uint8_t>(tile_indices.X));
+            writer.WriteUInt8(static_cast<std::uint8_t>(tile_indices.Y));
+        }
+    }
+
+    /// Gets the indices of a tile within a tile map.
+    /// @param[in]  tile_map - The tile map containing the tile.
+    /// @param[in]  tile_left_top_world_position - The world position of the left-top of the tile.
+    /// @return The x (from the left) and y (from the top) indices of the tile.
+    MATH::Vector2ui WorldSnapshot::GetTileIndices(const TileMap& tile_map, const MATH::Vector2f& tile_left_top_world_position)
+    {
+        // Positions are rounded to the nearest tile in case of any floating-point imprecision.
+        MATH::Vector2f tile_map_left_top_world_position = tile_map.GetWorldBoundingBox().LeftTop;
+        float tile_x = (tile_left_top_world_position.X - tile_map_left_top_world_position.X) / Tile::DIMENSION_IN_PIXELS<float>;
+        float tile_y = (tile_left_top_world_position.Y - tile_map_left_top_world_position.Y) / Tile::DIMENSION_IN_PIXELS<float>;
+        MATH::Vector2ui tile_indices(
+            static_cast<unsigned int>(std::lround(tile_x)),
+            static_cast<unsigned int>(std::lround(tile_y)));
+        return tile_indices;
+    }
+
+    /// Reads a tile map from a snapshot.
+    /// @param[in]  tile_map_type - The type of tile map.
+    /// @param[in]  map_grid - The map grid containing the tile map.
+    /// @param[in]  ark_interior_layer_index - The index of the ark interior layer containing the tile map, if in the ark.
+    /// @param[in]  row - The row of the tile map in its map grid.
+    /// @param[in]  column - The column of the tile map in its map grid.
+    /// @param[in]  previous_tile_map - The tile map previously at the same location, if any, from which to preserve food on trees.
+    /// @param[in]  tileset - The tileset for creating tiles.
+    /// @param[in,out]  random_number_generator - The random number generator for creating food on trees.
+    /// @param[in,out]  reader - The reader for the snapshot.
+    /// @return The tile map; null if it couldn't be read.
+    std::shared_ptr<TileMap> WorldSnapshot::ReadTileMap(
+        const TileMapType tile_map_type,
+        MultiTileMapGrid& map_grid,
+        const unsigned int ark_interior_layer_index,
+        const unsigned int row,
+        const unsigned int column,
+        const TileMap* const previous_tile_map,
+        const Tileset& tileset,
+        MATH::RandomNumberGenerator& random_number_generator,
+        FILESYSTEM::BinaryReader& reader)
+    {
+        // READ THE IDS OF ALL TILES IN THE GROUND LAYER.
+        constexpr std::size_t TILE_COUNT = static_cast<std::size_t>(TileMap::WIDTH_IN_TILES) * TileMap::HEIGHT_IN_TILES;
+        std::string_view tile_ids = reader.ReadBytes(TILE_COUNT);
+        bool all_tile_ids_read = (TILE_COUNT == tile_ids.size());
+        if (!all_tile_ids_read)
+        {
+            return nullptr;
+        }
+
+        // CREATE AN EMPTY TILE MAP.
+        MATH::Vector2ui map_dimensions_in_tiles(TileMap::WIDTH_IN_TILES, TileMap::HEIGHT_IN_TILES);
+        auto tile_map = std::make_shared<TileMap>(
+            tile_map_type,
+            MEMORY::NonNullRawPointer<MultiTileMapGrid>(&map_grid),
+            row,
+            column,
+            GetTileMapCenterWorldPosition(row, column),
+            map_dimensions_in_tiles);
+        MATH::Vector2f map_left_top_world_position = tile_map->GetWorldBoundingBox().LeftTop;
+
+        // CREATE TILES IN THE GROUND LAYER.
+        // All tiles in the tile map are stored together rather than allocated individually,
+        // with each tile in the ground layer sharing ownership of all of the tiles.
+        constexpr char NO_TILE_ID = '\0';
+        std::size_t existing_tile_count = TILE_COUNT - static_cast<std::size_t>(std::count(tile_ids.cbegin(), tile_ids.cend(), NO_TILE_ID));
+        auto tiles = std::make_shared<std::vector<Tile>>();
+        // Space for the tiles must be reserved to avoid reallocations that would invalidate pointers.
+        tiles->reserve(existing_tile_count);
+        for (unsigned int tile_y = 0; tile_y < TileMap::HEIGHT_IN_TILES; ++tile_y)
+        {
+            for (unsigned int tile_x = 0; tile_x < TileMap::WIDTH_IN_TILES; ++tile_x)
+            {
+                std::size_t tile_index = static_cast<std::size_t>(tile_y) * TileMap::WIDTH_IN_TILES + tile_x;
+                TileId tile_id = static_cast<std::uint8_t>(tile_ids[tile_index]);
+                std::optional<Tile> tile = tileset.CreateUnsharedTile(tile_id);
+                if (!tile)
+                {
+                    continue;
+                }
+
+                Tile& stored_tile = tiles->emplace_back(std::move(*tile));
+                tile_map->Ground.SetTile(tile_x, tile_y, std::shared_ptr<Tile>(tiles, &stored_tile));
+            }
+        }
+
+        // CREATE ANY ARK PIECES.
+        std::uint32_t ark_piece_count = reader.ReadUInt32();
+        bool ark_piece_count_valid = (ark_piece_count <= TILE_COUNT);
+        if (!ark_piece_count_valid)
+        {
+            return nullptr;
+        }
+        tile_map->ArkPieces.reserve(ark_piece_count);
+        for (std::uint32_t ark_piece_index = 0; ark_piece_index < ark_piece_count; ++ark_piece_index)
+        {
+            TileId ark_piece_id = reader.ReadUInt32();
+            unsigned int tile_x = reader.ReadUInt8();
+            unsigned int tile_y = reader.ReadUInt8();
+            bool tile_in_map = tile_map->Ground.Tiles.IndicesInRange(tile_x, tile_y);
+            if (!tile_in_map)
+            {
+                return nullptr;
+            }
+
+            tile_map->ArkPieces.push_back(Overworld::CreateArkPiece(ark_piece_id, map_left_top_world_position, tile_x, tile_y));
+        }
+
+        // CREATE ANY TREES.
+        std::uint32_t tree_count = reader.ReadUInt32();
+        bool tree_count_valid = (tree_count <= TILE_COUNT);
+        if (!tree_count_valid)
+        {
+            return nullptr;
+        }
+        tile_map->Trees.reserve(tree_count);
+        for (std::uint32_t tree_index = 0; tree_index < tree_count; ++tree_index)
+        {
+            unsigned int tile_x = reader.ReadUInt8();
+            unsigned int tile_y = reader.ReadUInt8();
+            bool tile_in_map = tile_map->Ground.Tiles.IndicesInRange(tile_x, tile_y);
+            if (!tile_in_map)
+            {
+                return nullptr;
+            }
+
+            OBJECTS::Tree tree = Overworld::CreateTree(map_left_top_world_position, tile_x, tile_y);
+            tree.Food = Overworld::CreateInitialTreeFood(previous_tile_map, tree_index, tree, random_number_generator);
+            tile_map->Trees.push_back(std::move(tree));
+        }
+
+        // CREATE ANY ANIMAL PENS.
+        std::uint32_t animal_pen_count = reader.ReadUInt32();
+        bool animal_pen_count_valid = (animal_pen_count <= TILE_COUNT);
+        if (!animal_pen_count_valid)
+        {
+            return nullptr;
+        }
+        tile_map->AnimalPens.reserve(animal_pen_count);
+        for (std::uint32_t animal_pen_index = 0; animal_pen_index < animal_pen_count; ++animal_pen_index)
+        {
+            // Animal pens are positioned based on their entrance tiles.
+            unsigned int tile_x = reader.ReadUInt8();
+            unsigned int tile_y = reader.ReadUInt8();
+            bool tile_in_map = tile_map->Ground.Tiles.IndicesInRange(tile_x, tile_y);
+            if (!tile_in_map)
+            {
+                return nullptr;
+            }
+            const std::shared_ptr<Tile>& entrance_tile = tile_map->Ground.Tiles(tile_x, tile_y);
+            if (!entrance_tile)
+            {
+                return nullptr;
+            }
+
+            AnimalPen animal_pen = Ark::CreateAnimalPen(ark_interior_layer_index, column, row, animal_pen_index, *entrance_tile);
+            tile_map->AnimalPens.emplace_back(animal_pen);
+        }
+
+        if (reader.Failed())
+        {
+            return nullptr;
+        }
+
+        return tile_map;
+    }
+
+    /// Gets the center world position of a tile map in a map grid.
+    /// @param[in]  row - The row of the tile map in its map grid.
+    /// @param[in]  column - The column of the tile map in its map grid.
+    /// @return The center world position of the tile map.
+    MATH::Vector2f WorldSnapshot::GetTileMapCenterWorldPosition(const unsigned int row, const unsigned int column)
+    {
+        MATH::Vector2f map_center_world_position;
+
+        float map_width_in_pixels = static_cast<float>(TileMap::WIDTH_IN_TILES * Tile::DIMENSION_IN_PIXELS<unsigned int>);
+        float map_half_width_in_pixels = map_width_in_pixels / 2.0f;
+        float map_left_world_position = static_cast<float>(column) * map_width_in_pixels;
+        map_center_world_position.X = map_left_world_position + map_half_width_in_pixels;
+
+        float map_height_in_pixels = static_cast<float>(TileMap::HEIGHT_IN_TILES * Tile::DIMENSION_IN_PIXELS<unsigned int>);
+        float map_half_height_in_pixels = map_height_in_pixels / 2.0f;
+        float map_top_world_position = static_cast<float>(row) * map_height_in_pixels;
+        map_center_world_position.Y = map_top_world_position + map_half_height_in_pixels;
+
+        return map_center_world_position;
+    }
+
+    /// Computes a hash of all raw map data from which the world is built (64-bit FNV-1a).
+    /// @param[in]  map_data - The map data to hash.
+    /// @return The hash of the map data.
+    std::uint64_t WorldSnapshot::HashMapData(const DATA::WorldMapData& map_data)
+    {
+        constexpr std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+        std::uint64_t hash = FNV_OFFSET_BASIS;
+
+        // HASH THE OVERWORLD MAP DATA.
+        for (unsigned int row = 0; row < map_data.Overworld.GetHeight(); ++row)
+        {
+            for (unsigned int column = 0; column < map_data.Overworld.GetWidth(); ++column)
+            {
+                const DATA::TileMapData& tile_map_data = map_data.Overworld(column, row);
+                HashLayer(tile_map_data.GroundLayer, hash);
+                HashLayer(tile_map_data.ArkLayer, hash);
+                HashLayer(tile_map_data.ObjectLayer, hash);
+            }
+        }
+
+        // HASH THE ARK INTERIOR MAP DATA.
+        // Only ground layers are used for the ark interior.
+        for (const CONTAINERS::Array2D<DATA::TileMapData>& ark_interior_layer_data : map_data.ArkInteriorLayersFromBottomToTop)
+        {
+            for (unsigned int row = 0; row < ark_interior_layer_data.GetHeight(); ++row)
+            {
+                for (unsigned int column = 0; column < ark_interior_layer_data.GetWidth(); ++column)
+                {
+                    HashLayer(ark_interior_layer_data(column, row).GroundLayer, hash);
+                }
+            }
+        }
+
+        return hash;
+    }
+
+    /// Adds a layer of raw map data to a hash.
+    /// @param[in]  layer - The layer to hash.  May be missing if a tile map doesn't have the layer.
+    /// @param[in,out]  hash - The hash to add the layer to.
+    void WorldSnapshot::HashLayer(const std::optional<CONTAINERS::Array2D<std::uint8_t>>& layer, std::uint64_t& hash)
+    {
+        constexpr std::uint64_t FNV_PRIME = 1099511628211ull;
+
+        // Missing layers are hashed differently than empty layers.
+        bool layer_exists = layer.has_value();
+        hash ^= static_cast<std::uint8_t>(layer_exists);
+        hash *= FNV_PRIME;
+        if (!layer_exists)
+        {
+            return;
+        }
+
+        for (unsigned int y = 0; y < layer->GetHeight(); ++y)
+        {
+            for (unsigned int x = 0; x < layer->GetWidth(); ++x)
+            {
+                hash ^= (*layer)(x, y);
+                hash *= FNV_PRIME;
+            }
+        }
+    }
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include "Containers/Array2D.h"
+#include "Filesystem/BinaryReader.h"
+#include "Filesystem/BinaryWriter.h"
+#include "Maps/Data/WorldMapData.h"
+#include "Maps/MultiTileMapGrid.h"
+#include "Maps/TileMap.h"
+#include "Maps/TileMapType.h"
+#include "Maps/Tileset.h"
+#include "Math/RandomNumberGenerator.h"
+#include "Math/Vector2.h"
+
+namespace MAPS
+{
+    // Forward declarations.
+    class World;
+
+    /// A prebuilt binary image of the world in its initial state.
+    ///
+    /// Building the initial world requires scanning all of the raw map data to find tiles, ark pieces,
+    /// trees, animal pens, and exit points between map grids.  Since the result is always the same,
+    /// the asset packer builds the world once and saves only what was found (tile IDs and the tiles
+    /// on which each object is located, with exit points referring to map grids and tile maps by index)
+    /// into a snapshot that's packed with the intro sequence assets.  Restoring the world from a snapshot
+    /// then just recreates objects in a single pass over the snapshot without any searching.
+    ///
+    /// Snapshots start with a hash of the raw map data they were built from, so a snapshot left over
+    /// from before the maps were changed is rejected, and the world can be built from the raw map data instead.
+    ///
+    /// Map grids in a snapshot are indexed with the overworld first, followed by the ark interior layers
+    /// from bottom to top.
+    class WorldSnapshot
+    {
+    public:
+        // CONSTANTS.
+        /// The bytes at the start of every world snapshot.
+        static constexpr std::string_view FILE_MAGIC = "NOAW";
+        /// The current version of the world snapshot format.  Must be changed whenever
+        /// the way objects are placed in the world changes.
+        static constexpr std::uint32_t FILE_FORMAT_VERSION = 1;
+        /// The index of the overworld map grid in snapshots.
+        static constexpr std::uint32_t OVERWORLD_MAP_GRID_INDEX = 0;
+        /// The index of the lowest ark interior layer in snapshots.
+        static constexpr std::uint32_t FIRST_ARK_INTERIOR_MAP_GRID_INDEX = 1;
+
+        // CREATION.
+        static std::string Create(const World& world);
+
+        // RESTORATION.
+        static bool Restore(const std::string_view snapshot_bytes, World& world);
+
+    private:
+        // CREATION HELPERS.
+        static void WriteTileMap(const TileMap* const tile_map, FILESYSTEM::BinaryWriter& writer);
+        static MATH::Vector2ui GetTileIndices(const TileMap& tile_map, const MATH::Vector2f& tile_left_top_world_position);
+
+        // RESTORATION HELPERS.
+        static std::shared_ptr<TileMap> ReadTileMap(
+            const TileMapType tile_map_type,
+            MultiTileMapGrid& map_grid,
+            const unsigned int ark_interior_layer_index,
+            const unsigned int row,
+            const unsigned int column,
+            const TileMap* const previous_tile_map,
+            const Tileset& tileset,
+            MATH::RandomNumberGenerator& random_number_generator,
+            FILESYSTEM::BinaryReader& reader);
+        static MATH::Vector2f GetTileMapCenterWorldPosition(const unsigned int row, const unsigned int column);
+
+        // HELPERS.
+        static std::uint64_t HashMapData(const DATA::WorldMapData& map_data);
+        static void HashLayer(const std::optional<CONTAINERS::Array2D<std::uint8_t>>& layer, std::uint64_t& hash);
+    };
+}
@@ -11,9 +11,16 @@ namespace MATH
     /// Many methods are templated to let them adapt to different data types,
     /// but no special logic exists for these types (they're basically just
     /// casted directly to from unsigned integers).
+    ///
+    /// Generators are randomly seeded by default, but a specific seed may be provided
+    /// when the same sequence of random numbers needs to be generated each time.
     class RandomNumberGenerator
     {
     public:
+        // CONSTRUCTION.
+        RandomNumberGenerator();
+        explicit RandomNumberGenerator(const unsigned int seed);
+
         // RANDOM NUMBERS.
         template <typename NumberType>
         NumberType RandomNumber();
@@ -27,16 +34,27 @@ namespace MATH
         EnumType RandomEnum();
 
     private:
-        /// The underlying random device.
-        std::random_device RandomDevice;
+        /// The underlying engine for generating random numbers.
+        std::mt19937 RandomNumberEngine;
     };
 
+    /// Constructor.  The generator is randomly seeded so that different numbers are generated each time.
+    inline RandomNumberGenerator::RandomNumberGenerator() :
+        RandomNumberEngine(std::random_device()())
+    {}
+
+    /// Constructor.  The same sequence of numbers is generated for the same seed.
+    /// @param[in]  seed - The seed for generating random numbers.
+    inline RandomNumberGenerator::RandomNumberGenerator(const unsigned int seed) :
+        RandomNumberEngine(seed)
+    {}
+
     /// Generates a random number of the specified type.
     /// @return A random number.
     template <typename NumberType>
     NumberType RandomNumberGenerator::RandomNumber()
     {
-        unsigned int random_number = RandomDevice();
+        unsigned int random_number = static_cast<unsigned int>(RandomNumberEngine());
         return static_cast<NumberType>(random_number);
     }
 
@@ -0,0 +1,304 @@
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <sstream>
+#if _WIN32
+#include <Windows.h>
+#else
+#include <execinfo.h>
+#endif
+#include "Memory/AllocationTracker.h"
+
+namespace MEMORY
+{
+    // STATIC MEMBER VARIABLES.
+    // These only have constant initialization so that they may be safely used
+    // by allocations made before any other static initialization.
+    AllocationTracker::AtomicAllocationCounts AllocationTracker::TotalCounts;
+    std::array<AllocationTracker::AtomicAllocationCounts, static_cast<std::size_t>(AllocationTag::COUNT)> AllocationTracker::CurrentFrameCountsByTag;
+    std::atomic<bool> AllocationTracker::CallSiteTrackingEnabled = false;
+    std::mutex AllocationTracker::CallSiteMutex;
+    std::array<AllocationCallSite, AllocationTracker::MAX_CALL_SITE_COUNT> AllocationTracker::CallSites;
+    AllocationCounts AllocationTracker::UnrecordedCallSiteCounts;
+    thread_local AllocationTag AllocationTracker::CurrentTag = AllocationTag::OTHER;
+    thread_local bool AllocationTracker::CallSiteRecordingSuspended = false;
+
+    /// Records a dynamic memory allocation.  Called from the global allocation functions,
+    /// so this must not allocate memory itself.
+    /// @param[in]  size_in_bytes - The size of the allocation.
+    void AllocationTracker::RecordAllocation(const std::size_t size_in_bytes)
+    {
+        // UPDATE THE COUNTS.
+        TotalCounts.AllocationCount.fetch_add(1, std::memory_order_relaxed);
+        TotalCounts.AllocatedByteCount.fetch_add(size_in_bytes, std::memory_order_relaxed);
+
+        AtomicAllocationCounts& current_frame_counts = CurrentFrameCountsByTag[static_cast<std::size_t>(CurrentTag)];
+        current_frame_counts.AllocationCount.fetch_add(1, std::memory_order_relaxed);
+        current_frame_counts.AllocatedByteCount.fetch_add(size_in_bytes, std::memory_order_relaxed);
+
+        // RECORD THE CALL SITE IF APPROPRIATE.
+        bool record_call_site = CallSiteTrackingEnabled.load(std::memory_order_relaxed) && !CallSiteRecordingSuspended;
+        if (record_call_site)
+        {
+            RecordCallSite(size_in_bytes);
+        }
+    }
+
+    /// Gets the number of allocations ever made.
+    /// @return The total number of allocations.
+    std::size_t AllocationTracker::GetTotalAllocationCount()
+    {
+        return TotalCounts.AllocationCount.load(std::memory_order_relaxed);
+    }
+
+    /// Gets the number of bytes ever allocated.
+    /// @return The total number of bytes allocated.
+    std::size_t AllocationTracker::GetTotalAllocatedByteCount()
+    {
+        return TotalCounts.AllocatedByteCount.load(std::memory_order_relaxed);
+    }
+
+    /// Gets the statistics for allocations made so far during the current frame.
+    /// @return The statistics for the current frame.
+    FrameAllocationStatistics AllocationTracker::GetCurrentFrameStatistics()
+    {
+        FrameAllocationStatistics statistics;
+        for (std::size_t tag_index = 0; tag_index < CurrentFrameCountsByTag.size(); ++tag_index)
+        {
+            AllocationCounts& tag_counts = statistics.CountsByTag[tag_index];
+            tag_counts.AllocationCount = CurrentFrameCountsByTag[tag_index].AllocationCount.load(std::memory_order_relaxed);
+            tag_counts.AllocatedByteCount = CurrentFrameCountsByTag[tag_index].AllocatedByteCount.load(std::memory_order_relaxed);
+
+            statistics.Total.AllocationCount += tag_counts.AllocationCount;
+            statistics.Total.AllocatedByteCount += tag_counts.AllocatedByteCount;
+        }
+        return statistics;
+    }
+
+    /// Ends the current frame, starting a new frame with counts reset.
+    /// Should be called once at the end of each frame of the game loop.
+    /// @return The statistics for the frame that ended.
+    FrameAllocationStatistics AllocationTracker::EndFrame()
+    {
+        FrameAllocationStatistics statistics;
+        for (std::size_t tag_index = 0; tag_index < CurrentFrameCountsByTag.size(); ++tag_index)
+        {
+            AllocationCounts& tag_counts = statistics.CountsByTag[tag_index];
+            tag_counts.AllocationCount = CurrentFrameCountsByTag[tag_index].AllocationCount.exchange(0, std::memory_order_relaxed);
+            tag_counts.AllocatedByteCount = CurrentFrameCountsByTag[tag_index].AllocatedByteCount.exchange(0, std::memory_order_relaxed);
+
+            statistics.Total.AllocationCount += tag_counts.AllocationCount;
+            statistics.Total.AllocatedByteCount += tag_counts.AllocatedByteCount;
+        }
+        return statistics;
+    }
+
+    /// Enables or disables recording call sites of allocations.
+    /// @param[in]  enabled - True to record call sites; false to stop recording them.
+    void AllocationTracker::EnableCallSiteTracking(const bool enabled)
+    {
+        CallSiteTrackingEnabled = enabled;
+    }
+
+    /// Clears all recorded call sites.
+    void AllocationTracker::ClearCallSites()
+    {
+        std::lock_guard<std::mutex> lock(CallSiteMutex);
+        CallSites.fill(AllocationCallSite());
+        UnrecordedCallSiteCounts = AllocationCounts();
+    }
+
+    /// Gets the recorded call sites that have made the most allocations.
+    /// @param[in]  max_call_site_count - The maximum number of call sites to get.
+    /// @return The call sites, ordered from the most allocations to the least.
+    std::vector<AllocationCallSite> AllocationTracker::GetTopCallSites(const std::size_t max_call_site_count)
+    {
+        // PREVENT ALLOCATIONS FOR THE CALL SITES FROM BEING RECORDED.
+        // Otherwise, this thread would wait on itself for the call sites.
+        CallSiteRecordingSuspended = true;
+
+        // COPY THE RECORDED CALL SITES.
+        std::vector<AllocationCallSite> top_call_sites;
+        {
+            std::lock_guard<std::mutex> lock(CallSiteMutex);
+            for (const AllocationCallSite& call_site : CallSites)
+            {
+                bool call_site_recorded = (call_site.Counts.AllocationCount > 0);
+                if (call_site_recorded)
+                {
+                    top_call_sites.push_back(call_site);
+                }
+            }
+        }
+
+        // KEEP ONLY THE CALL SITES WITH THE MOST ALLOCATIONS.
+        std::sort(
+            top_call_sites.begin(),
+            top_call_sites.end(),
+            [](const AllocationCallSite& left_call_site, const AllocationCallSite& right_call_site)
+            {
+                return left_call_site.Counts.AllocationCount > right_call_site.Counts.AllocationCount;
+            });
+        if (top_call_sites.size() > max_call_site_count)
+        {
+            top_call_sites.resize(max_call_site_count);
+        }
+
+        CallSiteRecordingSuspended = false;
+        return top_call_sites;
+    }
+
+    /// Gets a human-readable report of the recorded call sites that have made the most allocations.
+    /// On Linux, functions in the call stacks are named where possible (linking with -rdynamic
+    /// provides more names, or addresses can be resolved with addr2line).  On Windows, only
+    /// addresses are listed, which can be resolved with a debugger.
+    /// @param[in]  max_call_site_count - The maximum number of call sites to include in the report.
+    /// @return The report.
+    std::string AllocationTracker::GetTopCallSitesReport(const std::size_t max_call_site_count)
+    {
+        std::vector<AllocationCallSite> top_call_sites = GetTopCallSites(max_call_site_count);
+
+        // PREVENT ALLOCATIONS FOR THE REPORT FROM BEING RECORDED.
+        // This keeps the report from affecting call sites it reports on.
+        CallSiteRecordingSuspended = true;
+
+        std::ostringstream report;
+        report << "Top " << top_call_sites.size() << " allocation call sites:\n";
+        for (const AllocationCallSite& call_site : top_call_sites)
+        {
+            // DESCRIBE THE COUNTS FOR THE CALL SITE.
+            report << call_site.Counts.AllocationCount << " allocations, " << call_site.Counts.AllocatedByteCount << " bytes:\n";
+
+            // DESCRIBE THE CALL STACK.
+            int call_stack_depth = static_cast<int>(std::count_if(
+                call_site.ReturnAddresses.cbegin(),
+                call_site.ReturnAddresses.cend(),
+                [](const void* const return_address) { return nullptr != return_address; }));
+#if _WIN32
+            for (int call_index = 0; call_index < call_stack_depth; ++call_index)
+            {
+                report << "    " << call_site.ReturnAddresses[call_index] << "\n";
+            }
+#else
+            char** function_names = backtrace_symbols(call_site.ReturnAddresses.data(), call_stack_depth);
+            for (int call_index = 0; call_index < call_stack_depth; ++call_index)
+            {
+                report << "    ";
+                if (function_names)
+                {
+                    report << function_names[call_index];
+                }
+                else
+                {
+                    report << call_site.ReturnAddresses[call_index];
+                }
+                report << "\n";
+            }
+            std::free(function_names);
+#endif
+        }
+
+        // DESCRIBE ANY ALLOCATIONS WHOSE CALL SITES COULDN'T BE RECORDED.
+        AllocationCounts unrecorded_call_site_counts;
+        {
+            std::lock_guard<std::mutex> lock(CallSiteMutex);
+            unrecorded_call_site_counts = UnrecordedCallSiteCounts;
+        }
+        if (unrecorded_call_site_counts.AllocationCount > 0)
+        {
+            report << unrecorded_call_site_counts.AllocationCount << " allocations (" << unrecorded_call_site_counts.AllocatedByteCount << " bytes) from unrecorded call sites.\n";
+        }
+
+        std::string report_text = report.str();
+        CallSiteRecordingSuspended = false;
+        return report_text;
+    }
+
+    /// Gets the tag to which allocations on the current thread are attributed.
+    /// @return The current thread's allocation tag.
+    AllocationTag AllocationTracker::GetCurrentTag()
+    {
+        return CurrentTag;
+    }
+
+    /// Records the call site of an allocation being made on the current thread.
+    /// @param[in]  size_in_bytes - The size of the allocation.
+    void AllocationTracker::RecordCallSite(const std::size_t size_in_bytes)
+    {
+        // PREVENT RECURSIVELY RECORDING ALLOCATIONS.
+        // Capturing the call stack may allocate memory the first time it's done.
+        CallSiteRecordingSuspended = true;
+
+        // CAPTURE THE CALL STACK.
+        // This function and the functions that called it from the global allocation function are skipped.
+        constexpr std::size_t SKIPPED_CALL_COUNT = 3;
+        constexpr std::size_t CAPTURED_CALL_COUNT = SKIPPED_CALL_COUNT + AllocationCallSite::MAX_CALL_STACK_DEPTH;
+        std::array<void*, CAPTURED_CALL_COUNT> captured_return_addresses = {};
+#if _WIN32
+        std::size_t captured_call_count = RtlCaptureStackBackTrace(0, static_cast<DWORD>(CAPTURED_CALL_COUNT), captured_return_addresses.data(), nullptr);
+#else
+        std::size_t captured_call_count = static_cast<std::size_t>(backtrace(captured_return_addresses.data(), static_cast<int>(CAPTURED_CALL_COUNT)));
+#endif
+        std::array<void*, AllocationCallSite::MAX_CALL_STACK_DEPTH> return_addresses = {};
+        if (captured_call_count > SKIPPED_CALL_COUNT)
+        {
+            std::copy(
+                captured_return_addresses.cbegin() + SKIPPED_CALL_COUNT,
+                captured_return_addresses.cbegin() + captured_call_count,
+                return_addresses.begin());
+        }
+
+        // HASH THE CALL STACK.
+        std::size_t call_stack_hash = 0;
+        for (const void* const return_address : return_addresses)
+        {
+            // This is the same way Boost combines hashes.
+            constexpr std::size_t HASH_COMBINATION_CONSTANT = 0x9e3779b9;
+            call_stack_hash ^= std::hash<const void*>()(return_address) + HASH_COMBINATION_CONSTANT + (call_stack_hash << 6) + (call_stack_hash >> 2);
+        }
+
+        // FIND THE CALL SITE IN THE HASH TABLE.
+        // Linear probing is used to find either the call site's existing entry or an empty one.
+        std::lock_guard<std::mutex> lock(CallSiteMutex);
+        AllocationCallSite* call_site = nullptr;
+        for (std::size_t probe_count = 0; probe_count < MAX_CALL_SITE_COUNT; ++probe_count)
+        {
+            AllocationCallSite& candidate_call_site = CallSites[(call_stack_hash + probe_count) % MAX_CALL_SITE_COUNT];
+            bool candidate_empty = (0 == candidate_call_site.Counts.AllocationCount);
+            if (candidate_empty)
+            {
+                candidate_call_site.ReturnAddresses = return_addresses;
+                call_site = &candidate_call_site;
+                break;
+            }
+
+            bool candidate_matches = (return_addresses == candidate_call_site.ReturnAddresses);
+            if (candidate_matches)
+            {
+                call_site = &candidate_call_site;
+                break;
+            }
+        }
+
+        // UPDATE THE CALL SITE'S COUNTS.
+        AllocationCounts& call_site_counts = call_site ? call_site->Counts : UnrecordedCallSiteCounts;
+        ++call_site_counts.AllocationCount;
+        call_site_counts.AllocatedByteCount += size_in_bytes;
+
+        CallSiteRecordingSuspended = false;
+    }
+
+    /// Starts attributing allocations on the current thread to the specified tag.
+    /// @param[in]  tag - The tag to which to attribute allocations.
+    AllocationScope::AllocationScope(const AllocationTag tag) :
+        PreviousTag(AllocationTracker::CurrentTag)
+    {
+        AllocationTracker::CurrentTag = tag;
+    }
+
+    /// Restores attributing allocations on the current thread to the tag from before this scope.
+    AllocationScope::~AllocationScope()
+    {
+        AllocationTracker::CurrentTag = PreviousTag;
+    }
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace MEMORY
+{
+    /// The kinds of work to which dynamic memory allocations can be attributed.
+    enum class AllocationTag : std::uint8_t
+    {
+        /// Any allocations not within a more specific scope.
+        OTHER = 0,
+        /// Updating the game's state.
+        UPDATE,
+        /// Rendering the game (excluding any GUI rendering).
+        RENDER,
+        /// Scheduling, mixing, or playing audio.
+        AUDIO,
+        /// Updating or rendering the GUI (text, HUDs, etc.).
+        GUI,
+        /// The number of allocation tags.  Not an actual tag.
+        COUNT
+    };
+
+    /// Counts of dynamic memory allocations.
+    class AllocationCounts
+    {
+    public:
+        /// The number of allocations.
+        std::size_t AllocationCount = 0;
+        /// The total number of bytes allocated.
+        std::size_t AllocatedByteCount = 0;
+    };
+
+    /// Statistics for the dynamic memory allocations made during a single frame.
+    class FrameAllocationStatistics
+    {
+    public:
+        /// The counts for all allocations made during the frame.
+        AllocationCounts Total = {};
+        /// The counts for allocations made during the frame, indexed by allocation tag.
+        std::array<AllocationCounts, static_cast<std::size_t>(AllocationTag::COUNT)> CountsByTag = {};
+    };
+
+    /// A location in code from which dynamic memory is allocated, identified by its call stack.
+    class AllocationCallSite
+    {
+    public:
+        // CONSTANTS.
+        /// The maximum number of calls recorded in the call stack of a call site.
+        static constexpr std::size_t MAX_CALL_STACK_DEPTH = 8;
+
+        /// The return addresses in the call stack, starting with the caller of the allocation function.
+        /// Unused entries at the end are null.
+        std::array<void*, MAX_CALL_STACK_DEPTH> ReturnAddresses = {};
+        /// The counts of allocations made from the call site.
+        AllocationCounts Counts = {};
+    };
+
+    /// Tracks dynamic memory allocations made anywhere in a program, to provide visibility into
+    /// how much is allocated each frame and from where.  Allocations are only tracked if the
+    /// program opts in by including "Memory/GlobalAllocationHooks.h" in exactly one translation unit,
+    /// which replaces the global allocation functions to report allocations here.
+    ///
+    /// Counts are always kept once the hooks are included.  Recording call stacks for call sites
+    /// is much slower, so it must additionally be enabled at runtime.
+    class AllocationTracker
+    {
+    public:
+        // CONSTANTS.
+        /// The maximum number of distinct call sites that may be recorded.
+        static constexpr std::size_t MAX_CALL_SITE_COUNT = 1024;
+
+        // RECORDING.
+        static void RecordAllocation(const std::size_t size_in_bytes);
+
+        // TOTAL COUNTS.
+        static std::size_t GetTotalAllocationCount();
+        static std::size_t GetTotalAllocatedByteCount();
+
+        // FRAME COUNTS.
+        static FrameAllocationStatistics GetCurrentFrameStatistics();
+        static FrameAllocationStatistics EndFrame();
+
+        // CALL SITES.
+        static void EnableCallSiteTracking(const bool enabled);
+        static void ClearCallSites();
+        static std::vector<AllocationCallSite> GetTopCallSites(const std::size_t max_call_site_count);
+        static std::string GetTopCallSitesReport(const std::size_t max_call_site_count);
+
+        // TAGGING.
+        static AllocationTag GetCurrentTag();
+
+    private:
+        friend class AllocationScope;
+
+        /// Atomic counts of allocations, since allocations may be made from any thread.
+        class AtomicAllocationCounts
+        {
+        public:
+            /// The number of allocations.
+            std::atomic<std::size_t> AllocationCount = 0;
+            /// The total number of bytes allocated.
+            std::atomic<std::size_t> AllocatedByteCount = 0;
+        };
+
+        // HELPER METHODS.
+        static void RecordCallSite(const std::size_t size_in_bytes);
+
+        // MEMBER VARIABLES.
+        /// The counts for all allocations ever made.
+        static AtomicAllocationCounts TotalCounts;
+        /// The counts for allocations made during the current frame, indexed by allocation tag.
+        static std::array<AtomicAllocationCounts, static_cast<std::size_t>(AllocationTag::COUNT)> CurrentFrameCountsByTag;
+        /// True if call sites are being recorded; false otherwise.
+        static std::atomic<bool> CallSiteTrackingEnabled;
+        /// A mutex protecting the call sites, since allocations may be made from any thread.
+        static std::mutex CallSiteMutex;
+        /// Recorded call sites, stored as a hash table (by call stack) to avoid allocating while recording.
+        static std::array<AllocationCallSite, MAX_CALL_SITE_COUNT> CallSites;
+        /// The counts for allocations whose call sites couldn't be recorded since the table of call sites was full.
+        static AllocationCounts UnrecordedCallSiteCounts;
+        /// The tag to which allocations on the current thread are attributed.
+        static thread_local AllocationTag CurrentTag;
+        /// True if call sites shouldn't be recorded on the current thread, to avoid recursively
+        /// recording allocations made while recording or reporting call sites.
+        static thread_local bool CallSiteRecordingSuspended;
+    };
+
+    /// Attributes allocations made on the current thread to a specific tag for as long as the scope exists.
+    /// Scopes may be nested, with allocations being attributed to the innermost scope.
+    class AllocationScope
+    {
+    public:
+        // CONSTRUCTION/DESTRUCTION.
+        explicit AllocationScope(const AllocationTag tag);
+        ~AllocationScope();
+        AllocationScope(const AllocationScope&) = delete;
+        AllocationScope& operator=(const AllocationScope&) = delete;
+
+    private:
+        // MEMBER VARIABLES.
+        /// The tag that was current before this scope, to be restored once the scope ends.
+        AllocationTag PreviousTag = AllocationTag::OTHER;
+    };
+}
@@ -0,0 +1,125 @@
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include "Memory/FrameArena.h"
+
+namespace MEMORY
+{
+    /// Constructor.  All memory for the arena is allocated up-front.
+    /// @param[in]  capacity_in_bytes - The number of bytes that may be allocated from the arena each frame.
+    FrameArena::FrameArena(const std::size_t capacity_in_bytes) :
+        Memory(capacity_in_bytes)
+    {}
+
+    /// Begins a new frame, reclaiming all memory allocated from the arena during the previous frame.
+    /// Anything allocated from the arena must no longer be in use once this is called.
+    void FrameArena::BeginFrame()
+    {
+        PreviousFrameStatistics = CurrentFrameStatistics;
+        CurrentFrameStatistics = FrameArenaStatistics();
+        UsedByteCountInMemory = 0;
+    }
+
+    /// Gets the number of bytes that may be allocated from the arena each frame.
+    /// @return The capacity of the arena, in bytes.
+    std::size_t FrameArena::CapacityInBytes() const
+    {
+        return Memory.size();
+    }
+
+    /// Gets the number of bytes currently in use from the arena, including any padding for alignment.
+    /// @return The number of bytes in use from the arena.
+    std::size_t FrameArena::UsedByteCount() const
+    {
+        return UsedByteCountInMemory;
+    }
+
+    /// Gets statistics for how the arena has been used so far in the current frame.
+    /// @return Statistics for the current frame.
+    const FrameArenaStatistics& FrameArena::GetCurrentFrameStatistics() const
+    {
+        return CurrentFrameStatistics;
+    }
+
+    /// Gets statistics for how the arena was used in the previous frame.
+    /// @return Statistics for the previous frame.
+    const FrameArenaStatistics& FrameArena::GetPreviousFrameStatistics() const
+    {
+        return PreviousFrameStatistics;
+    }
+
+    /// Gets the highest high-water mark of any frame, which is helpful for tuning the capacity of the arena.
+    /// @return The most bytes ever in use from the arena at once.
+    std::size_t FrameArena::PeakHighWaterMarkInBytes() const
+    {
+        return PeakHighWaterMarkInBytesOverAllFrames;
+    }
+
+    /// Allocates memory from the arena, falling back to the general heap if the arena doesn't have enough space.
+    /// @param[in]  size_in_bytes - The size of the memory to allocate.
+    /// @param[in]  alignment - The alignment required for the memory.
+    /// @return The allocated memory.
+    /// @throws std::bad_alloc - Thrown if the memory couldn't be allocated.
+    void* FrameArena::do_allocate(const std::size_t size_in_bytes, const std::size_t alignment)
+    {
+        // TRY ALLOCATING FROM THE ARENA.
+        // Every allocation takes up at least a byte so that each one is at a unique address within the arena.
+        std::size_t allocated_size_in_bytes = std::max<std::size_t>(size_in_bytes, 1);
+        void* next_free_memory = Memory.data() + UsedByteCountInMemory;
+        std::size_t free_byte_count = Memory.size() - UsedByteCountInMemory;
+        void* aligned_memory = std::align(alignment, allocated_size_in_bytes, next_free_memory, free_byte_count);
+        if (aligned_memory)
+        {
+            // UPDATE HOW MUCH OF THE ARENA IS IN USE.
+            std::byte* allocation_end = static_cast<std::byte*>(aligned_memory) + allocated_size_in_bytes;
+            UsedByteCountInMemory = static_cast<std::size_t>(allocation_end - Memory.data());
+            CurrentFrameStatistics.HighWaterMarkInBytes = std::max(CurrentFrameStatistics.HighWaterMarkInBytes, UsedByteCountInMemory);
+            PeakHighWaterMarkInBytesOverAllFrames = std::max(PeakHighWaterMarkInBytesOverAllFrames, UsedByteCountInMemory);
+            return aligned_memory;
+        }
+
+        // FALL BACK TO ALLOCATING FROM THE GENERAL HEAP.
+        ++CurrentFrameStatistics.OverflowAllocationCount;
+        CurrentFrameStatistics.OverflowAllocatedByteCount += size_in_bytes;
+        return std::pmr::new_delete_resource()->allocate(size_in_bytes, alignment);
+    }
+
+    /// Deallocates memory allocated from the arena.  Memory within the arena is normally only reclaimed
+    /// once the next frame begins, but the most recent allocation is reclaimed immediately so that
+    /// temporaries created and destroyed within a loop don't use up the arena.
+    /// @param[in]  memory - The memory to deallocate.
+    /// @param[in]  size_in_bytes - The size of the memory that was allocated.
+    /// @param[in]  alignment - The alignment of the memory that was allocated.
+    void FrameArena::do_deallocate(void* const memory, const std::size_t size_in_bytes, const std::size_t alignment)
+    {
+        // CHECK IF THE MEMORY CAME FROM THE ARENA.
+        // Pointers to separate allocations can't be compared directly with the normal operators.
+        std::byte* memory_bytes = static_cast<std::byte*>(memory);
+        std::byte* arena_start = Memory.data();
+        std::byte* arena_end = arena_start + Memory.size();
+        bool memory_from_arena = std::less_equal<std::byte*>()(arena_start, memory_bytes) && std::less<std::byte*>()(memory_bytes, arena_end);
+        if (!memory_from_arena)
+        {
+            std::pmr::new_delete_resource()->deallocate(memory, size_in_bytes, alignment);
+            return;
+        }
+
+        // RECLAIM THE MEMORY IF IT WAS THE MOST RECENT ALLOCATION.
+        std::size_t allocated_size_in_bytes = std::max<std::size_t>(size_in_bytes, 1);
+        std::size_t allocation_start_offset_in_bytes = static_cast<std::size_t>(memory_bytes - arena_start);
+        bool most_recent_allocation = (allocation_start_offset_in_bytes + allocated_size_in_bytes == UsedByteCountInMemory);
+        if (most_recent_allocation)
+        {
+            UsedByteCountInMemory = allocation_start_offset_in_bytes;
+        }
+    }
+
+    /// Checks if memory allocated from this arena can be deallocated from another memory resource.
+    /// @param[in]  other - The other memory resource to compare with.
+    /// @return True only if the other memory resource is this arena.
+    bool FrameArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+    {
+        bool same_arena = (this == &other);
+        return same_arena;
+    }
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace MEMORY
+{
+    /// Statistics for how much of a frame arena was used during a single frame.
+    class FrameArenaStatistics
+    {
+    public:
+        /// The most bytes in use from the arena at once during the frame.
+        std::size_t HighWaterMarkInBytes = 0;
+        /// The number of allocations that didn't fit in the arena and were instead made from the general heap.
+        std::size_t OverflowAllocationCount = 0;
+        /// The total number of bytes for allocations that didn't fit in the arena.
+        std::size_t OverflowAllocatedByteCount = 0;
+    };
+
+    /// A linear arena of memory for temporary data that only needs to last for a single frame.
+    /// Allocating from the arena just moves an offset forward in a block of memory reserved up-front,
+    /// and all memory is reclaimed at once when the next frame begins, avoiding the cost of going to
+    /// the general heap for short-lived containers created every frame.
+    ///
+    /// The arena is a standard polymorphic memory resource, so it can be used for any std::pmr container
+    /// (std::pmr::vector, std::pmr::string, std::pmr::unordered_set, etc.) by passing the arena to
+    /// the container's constructor.  Anything allocated from the arena is only valid until the
+    /// next frame begins.  Allocations that don't fit in the arena are made from the general heap
+    /// instead (and freed normally), so running out of space is only a performance problem.
+    ///
+    /// The arena isn't thread-safe and is only intended to be used from the main thread.
+    class FrameArena : public std::pmr::memory_resource
+    {
+    public:
+        // CONSTANTS.
+        /// The default capacity of an arena, in bytes.
+        static constexpr std::size_t DEFAULT_CAPACITY_IN_BYTES = 256 * 1024;
+
+        // CONSTRUCTION.
+        explicit FrameArena(const std::size_t capacity_in_bytes = DEFAULT_CAPACITY_IN_BYTES);
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        // FRAMES.
+        void BeginFrame();
+
+        // STATISTICS.
+        std::size_t CapacityInBytes() const;
+        std::size_t UsedByteCount() const;
+        const FrameArenaStatistics& GetCurrentFrameStatistics() const;
+        const FrameArenaStatistics& GetPreviousFrameStatistics() const;
+        std::size_t PeakHighWaterMarkInBytes() const;
+
+    private:
+        // MEMORY RESOURCE IMPLEMENTATION.
+        void* do_allocate(const std::size_t size_in_bytes, const std::size_t alignment) override;
+        void do_deallocate(void* const memory, const std::size_t size_in_bytes, const std::size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+        // MEMBER VARIABLES.
+        /// The block of memory from which allocations are made.
+        std::vector<std::byte> Memory = {};
+        /// The number of bytes at the start of the memory block that are in use.
+        std::size_t UsedByteCountInMemory = 0;
+        /// Statistics for the current frame.
+        FrameArenaStatistics CurrentFrameStatistics = {};
+        /// Statistics for the previous frame.
+        FrameArenaStatistics PreviousFrameStatistics = {};
+        /// The highest high-water mark over all frames, in bytes.
+        std::size_t PeakHighWaterMarkInBytesOverAllFrames = 0;
+    };
+}
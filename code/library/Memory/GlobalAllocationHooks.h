@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include "Memory/AllocationTracker.h"
+
+/// Replaces the global allocation functions so that all dynamic memory allocations made anywhere
+/// in a program are reported to the allocation tracker.  Including this header is how a program
+/// opts into tracking allocations, and it must be included in exactly one translation unit of the
+/// program (such as the one with the program's main function), since the global allocation
+/// functions may only be replaced once.
+
+/// Allocates memory, tracking the allocation.
+/// @param[in]  size_in_bytes - The size of the memory to allocate.
+/// @return The allocated memory.
+/// @throws std::bad_alloc - Thrown if the memory couldn't be allocated.
+void* operator new(const std::size_t size_in_bytes)
+{
+    MEMORY::AllocationTracker::RecordAllocation(size_in_bytes);
+
+    // Even zero-byte allocations must return unique memory.
+    std::size_t allocated_size_in_bytes = (size_in_bytes > 0) ? size_in_bytes : 1;
+    void* memory = std::malloc(allocated_size_in_bytes);
+    if (!memory)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+/// Allocates memory for an array, tracking the allocation.
+/// @param[in]  size_in_bytes - The size of the memory to allocate.
+/// @return The allocated memory.
+/// @throws std::bad_alloc - Thrown if the memory couldn't be allocated.
+void* operator new[](const std::size_t size_in_bytes)
+{
+    return operator new(size_in_bytes);
+}
+
+/// Frees memory allocated by the tracking operator new.
+/// @param[in]  memory - The memory to free.
+void operator delete(void* const memory) noexcept
+{
+    std::free(memory);
+}
+
+/// Frees memory allocated by the tracking operator new[].
+/// @param[in]  memory - The memory to free.
+void operator delete[](void* const memory) noexcept
+{
+    std::free(memory);
+}
+
+/// Frees memory allocated by the tracking operator new.
+/// @param[in]  memory - The memory to free.
+void operator delete(void* const memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+/// Frees memory allocated by the tracking operator new[].
+/// @param[in]  memory - The memory to free.
+void operator delete[](void* const memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
@@ -0,0 +1,259 @@
+#include <algorithm>
+#include <cstdint>
+#include "Objects/EntityStorage.h"
+
+namespace OBJECTS
+{
+    /// Adds wood logs to the storage.
+    /// @param[in]  center_world_position - The center world position of the wood logs.
+    /// @return The index of the added wood logs.
+    std::size_t EntityStorage::AddWoodLogs(const MATH::Vector2f& center_world_position)
+    {
+        // DEFINE THE WOOD LOGS' GRAPHICS.
+        SpriteFrame sprite_frame;
+        sprite_frame.TextureId = RESOURCES::AssetId::WOOD_LOG_TEXTURE;
+        sprite_frame.TextureSubRectangle = MATH::FloatRectangle::FromLeftTopAndDimensions(32.0f, 32.0f, 16.0f, 16.0f);
+
+        // DETERMINE THE WOOD LOGS' BOUNDING BOX.
+        // The bounding box is shrunk some from its visible representation.
+        // This helps avoid an issue where the wood logs already disappear
+        // when Noah is too close to them when chopping down a tree.
+        const float BOX_DIMENSION_SCALE_FACTOR = 0.3f;
+        MATH::FloatRectangle world_bounding_box = MATH::FloatRectangle::FromCenterAndDimensions(
+            center_world_position.X,
+            center_world_position.Y,
+            sprite_frame.TextureSubRectangle.Width() * BOX_DIMENSION_SCALE_FACTOR,
+            sprite_frame.TextureSubRectangle.Height() * BOX_DIMENSION_SCALE_FACTOR);
+
+        std::size_t entity_index = Add(EntityKind::WOOD_LOGS, center_world_position, world_bounding_box, sprite_frame);
+        return entity_index;
+    }
+
+    /// Adds a dust cloud to the storage.  The dust cloud starts animating immediately.
+    /// @param[in]  center_world_position - The center world position of the dust cloud.
+    /// @return The index of the added dust cloud.
+    std::size_t EntityStorage::AddDustCloud(const MATH::Vector2f& center_world_position)
+    {
+        SpriteFrame sprite_frame;
+        sprite_frame.TextureId = RESOURCES::AssetId::DUST_CLOUD_TEXTURE;
+        sprite_frame.TextureSubRectangle = MATH::FloatRectangle::FromLeftTopAndDimensions(
+            DUST_CLOUD_TEXTURE_LEFT_X_POSITION,
+            0.0f,
+            DUST_CLOUD_FRAME_DIMENSION_IN_PIXELS,
+            DUST_CLOUD_FRAME_DIMENSION_IN_PIXELS);
+        MATH::FloatRectangle world_bounding_box = MATH::FloatRectangle::FromCenterAndDimensions(
+            center_world_position.X,
+            center_world_position.Y,
+            DUST_CLOUD_FRAME_DIMENSION_IN_PIXELS,
+            DUST_CLOUD_FRAME_DIMENSION_IN_PIXELS);
+
+        std::size_t entity_index = Add(EntityKind::DUST_CLOUD, center_world_position, world_bounding_box, sprite_frame);
+        return entity_index;
+    }
+
+    /// Adds food to the storage.
+    /// @param[in]  food - The food to add.  Its sprite should be centered on its world position.
+    /// @return The index of the added food.
+    std::size_t EntityStorage::AddFood(const Food& food)
+    {
+        SpriteFrame sprite_frame;
+        sprite_frame.TextureId = food.Sprite.TextureId;
+        sprite_frame.TextureSubRectangle = food.Sprite.TextureSubRectangle;
+        MATH::FloatRectangle world_bounding_box = food.Sprite.GetWorldBoundingBox();
+
+        std::size_t entity_index = Add(EntityKind::FOOD, food.Sprite.WorldPosition, world_bounding_box, sprite_frame);
+        FoodTypes[entity_index] = food.Type;
+        FoodCounts[entity_index] = food.Count;
+        return entity_index;
+    }
+
+    /// Removes an entity from the storage.  The last entity is moved into the removed entity's index,
+    /// so when removing entities while iterating, the same index should be visited again.
+    /// @param[in]  entity_index - The index of the entity to remove.  Nothing happens if invalid.
+    void EntityStorage::Remove(const std::size_t entity_index)
+    {
+        // MAKE SURE THE ENTITY EXISTS.
+        bool entity_exists = (entity_index < Kinds.size());
+        if (!entity_exists)
+        {
+            return;
+        }
+
+        // REMOVE EACH OF THE ENTITY'S COMPONENTS.
+        RemoveComponent(entity_index, Kinds);
+        RemoveComponent(entity_index, WorldPositions);
+        RemoveComponent(entity_index, WorldBoundingBoxes);
+        RemoveComponent(entity_index, SpriteFrames);
+        RemoveComponent(entity_index, AnimationTimesInSeconds);
+        RemoveComponent(entity_index, FoodTypes);
+        RemoveComponent(entity_index, FoodCounts);
+    }
+
+    /// Removes all entities of a specific kind from the storage.
+    /// @param[in]  kind - The kind of entities to remove.
+    void EntityStorage::RemoveAll(const EntityKind kind)
+    {
+        for (std::size_t entity_index = 0; entity_index < Kinds.size();)
+        {
+            if (kind == Kinds[entity_index])
+            {
+                // The next entity to check was moved into this entity's index.
+                Remove(entity_index);
+            }
+            else
+            {
+                ++entity_index;
+            }
+        }
+    }
+
+    /// Removes all entities from the storage.
+    void EntityStorage::Clear()
+    {
+        Kinds.clear();
+        WorldPositions.clear();
+        WorldBoundingBoxes.clear();
+        SpriteFrames.clear();
+        AnimationTimesInSeconds.clear();
+        FoodTypes.clear();
+        FoodCounts.clear();
+    }
+
+    /// Gets the number of entities in the storage.
+    /// @return The number of entities.
+    std::size_t EntityStorage::Count() const
+    {
+        return Kinds.size();
+    }
+
+    /// Gets the number of entities of a specific kind in the storage.
+    /// @param[in]  kind - The kind of entities to count.
+    /// @return The number of entities of the specified kind.
+    std::size_t EntityStorage::Count(const EntityKind kind) const
+    {
+        std::size_t entity_count = static_cast<std::size_t>(std::count(Kinds.cbegin(), Kinds.cend(), kind));
+        return entity_count;
+    }
+
+    /// Gets a sprite for rendering an entity.
+    /// @param[in]  entity_index - The index of the entity.  Must be valid.
+    /// @return The sprite for the entity, as it currently appears.
+    GRAPHICS::Sprite EntityStorage::GetSprite(const std::size_t entity_index) const
+    {
+        // CREATE A SPRITE FOR THE ENTITY'S CURRENT FRAME.
+        const SpriteFrame& sprite_frame = SpriteFrames[entity_index];
+        GRAPHICS::Sprite sprite(sprite_frame.TextureId, sprite_frame.TextureSubRectangle);
+        sprite.WorldPosition = WorldPositions[entity_index];
+        sprite.IsVisible = true;
+
+        // ADD ADDITIONAL EFFECTS FOR DUST CLOUDS.
+        // The rotation, scaling, and opacity effects below just make the cloud more visually appealing.
+        bool is_dust_cloud = (EntityKind::DUST_CLOUD == Kinds[entity_index]);
+        if (is_dust_cloud)
+        {
+            // DETERMINE HOW FAR THE ANIMATION HAS PROGRESSED.
+            // This is needed to scale certain effects to the appropriate range based on elapsed time.
+            float animation_progress_ratio = std::min(AnimationTimesInSeconds[entity_index] / DUST_CLOUD_DURATION_IN_SECONDS, 1.0f);
+
+            // ROTATE THE CLOUD BASED ON HOW LONG IT HAS BEEN ANIMATING.
+            // It will rotate in about a full circle by the time the cloud disappears.
+            const float DEGREES_IN_FULL_CIRCLE = 360.0f;
+            sprite.RotationAngleInDegrees = animation_progress_ratio * DEGREES_IN_FULL_CIRCLE;
+
+            // SCALE THE SPRITE BASED ON HOW FAR THE ANIMATION HAS PROGRESSED.
+            // It should get smaller over time.
+            const float MAX_SCALE = 1.5f;
+            float scale = MAX_SCALE - animation_progress_ratio;
+            sprite.Scale = MATH::Vector2f(scale, scale);
+
+            // FADE THE SPRITE OUT AS THE ANIMATION PROGRESSES.
+            sprite.Color.Alpha = GRAPHICS::Color::MAX_COLOR_COMPONENT - static_cast<std::uint8_t>(animation_progress_ratio * GRAPHICS::Color::MAX_COLOR_COMPONENT);
+        }
+
+        return sprite;
+    }
+
+    /// Gets a food entity as a food item (such as for adding to an inventory).
+    /// @param[in]  entity_index - The index of the food entity.  Must be valid.
+    /// @return The food item.
+    Food EntityStorage::GetFood(const std::size_t entity_index) const
+    {
+        Food food =
+        {
+            .Type = FoodTypes[entity_index],
+            .Count = FoodCounts[entity_index],
+            .Sprite = GetSprite(entity_index)
+        };
+        return food;
+    }
+
+    /// Updates all entities in the storage based on the elapsed time.
+    /// Dust clouds animate and are removed once they've disappeared.
+    /// @param[in]  elapsed_time - The elapsed time for which to update the entities.
+    void EntityStorage::Update(const sf::Time& elapsed_time)
+    {
+        // ADVANCE THE ANIMATION TIMERS FOR ALL ENTITIES.
+        float elapsed_time_in_seconds = elapsed_time.asSeconds();
+        for (float& animation_time_in_seconds : AnimationTimesInSeconds)
+        {
+            animation_time_in_seconds += elapsed_time_in_seconds;
+        }
+
+        // UPDATE THE DUST CLOUDS.
+        constexpr float DUST_CLOUD_FRAME_DURATION_IN_SECONDS = DUST_CLOUD_DURATION_IN_SECONDS / static_cast<float>(DUST_CLOUD_FRAME_COUNT);
+        for (std::size_t entity_index = 0; entity_index < Kinds.size();)
+        {
+            // SKIP ANY ENTITIES THAT AREN'T DUST CLOUDS.
+            bool is_dust_cloud = (EntityKind::DUST_CLOUD == Kinds[entity_index]);
+            if (!is_dust_cloud)
+            {
+                ++entity_index;
+                continue;
+            }
+
+            // REMOVE THE DUST CLOUD IF IT HAS DISAPPEARED.
+            // The next entity to update is moved into this entity's index.
+            float animation_time_in_seconds = AnimationTimesInSeconds[entity_index];
+            bool dust_cloud_disappeared = (animation_time_in_seconds >= DUST_CLOUD_DURATION_IN_SECONDS);
+            if (dust_cloud_disappeared)
+            {
+                Remove(entity_index);
+                continue;
+            }
+
+            // SHOW THE CURRENT FRAME OF THE DUST CLOUD'S ANIMATION.
+            // Frames alternate between the top and bottom images in the texture.
+            unsigned int frame_index = static_cast<unsigned int>(animation_time_in_seconds / DUST_CLOUD_FRAME_DURATION_IN_SECONDS);
+            float frame_top_y_position = static_cast<float>(frame_index % 2) * DUST_CLOUD_FRAME_DIMENSION_IN_PIXELS;
+            SpriteFrames[entity_index].TextureSubRectangle = MATH::FloatRectangle::FromLeftTopAndDimensions(
+                DUST_CLOUD_TEXTURE_LEFT_X_POSITION,
+                frame_top_y_position,
+                DUST_CLOUD_FRAME_DIMENSION_IN_PIXELS,
+                DUST_CLOUD_FRAME_DIMENSION_IN_PIXELS);
+            ++entity_index;
+        }
+    }
+
+    /// Adds an entity with the common components for all entities.  Any remaining components are defaulted.
+    /// @param[in]  kind - The kind of entity.
+    /// @param[in]  center_world_position - The center world position of the entity.
+    /// @param[in]  world_bounding_box - The world bounding box of the entity.
+    /// @param[in]  sprite_frame - The initial sprite frame for the entity.
+    /// @return The index of the added entity.
+    std::size_t EntityStorage::Add(
+        const EntityKind kind,
+        const MATH::Vector2f& center_world_position,
+        const MATH::FloatRectangle& world_bounding_box,
+        const SpriteFrame& sprite_frame)
+    {
+        std::size_t entity_index = Kinds.size();
+        Kinds.push_back(kind);
+        WorldPositions.push_back(center_world_position);
+        WorldBoundingBoxes.push_back(world_bounding_box);
+        SpriteFrames.push_back(sprite_frame);
+        AnimationTimesInSeconds.push_back(0.0f);
+        FoodTypes.push_back(Food::TypeId::NONE);
+        FoodCounts.push_back(0);
+        return entity_index;
+    }
+}
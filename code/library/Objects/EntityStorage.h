@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <SFML/System.hpp>
+#include "Graphics/Sprite.h"
+#include "Math/Rectangle.h"
+#include "Math/Vector2.h"
+#include "Objects/Food.h"
+#include "Resources/AssetId.h"
+
+namespace OBJECTS
+{
+    /// The different kinds of simple entities that can be stored in entity storage.
+    enum class EntityKind : std::uint8_t
+    {
+        /// Logs that supply wood, which appear after a tree has been chopped down
+        /// and the dust cloud has cleared.
+        WOOD_LOGS = 0,
+        /// A cloud of dust that briefly appears (such as when a tree is chopped down or something is built).
+        /// Dust clouds animate and are removed once they've disappeared.
+        DUST_CLOUD,
+        /// Food lying on the ground.
+        FOOD
+    };
+
+    /// The portion of a texture currently displayed for an entity.
+    class SpriteFrame
+    {
+    public:
+        /// The ID of the texture with graphics for the entity.
+        RESOURCES::AssetId TextureId = RESOURCES::AssetId::INVALID;
+        /// The sub-rectangle of the texture currently displayed.
+        MATH::FloatRectangle TextureSubRectangle = MATH::FloatRectangle();
+    };
+
+    /// Storage for many simple entities (wood logs, dust clouds, food, etc.) in an area of the world.
+    ///
+    /// Rather than storing each entity as a separate object with its own full sprite, each component of
+    /// entities is stored in its own densely packed array (structure-of-arrays), with the entity at a given
+    /// index having its components at that same index in each array.  This allows updating and rendering
+    /// entities to stream through contiguous memory.  Entities are removed by moving the last entity into
+    /// the removed entity's place, so removal is constant time but doesn't preserve the order of entities.
+    class EntityStorage
+    {
+    public:
+        // CONSTANTS.
+        /// The total time a dust cloud exists before disappearing, in seconds.
+        static constexpr float DUST_CLOUD_DURATION_IN_SECONDS = 2.0f;
+        /// The number of frames in a dust cloud's animation.
+        /// Frames alternate between two images so that things appear to loop a few times.
+        static constexpr unsigned int DUST_CLOUD_FRAME_COUNT = 4;
+        /// The dimension (both width and height) of each dust cloud frame, in pixels.
+        static constexpr float DUST_CLOUD_FRAME_DIMENSION_IN_PIXELS = 16.0f;
+        /// The left position of dust cloud frames within the dust cloud texture, in pixels.
+        static constexpr float DUST_CLOUD_TEXTURE_LEFT_X_POSITION = 48.0f;
+
+        // ENTITY CREATION.
+        std::size_t AddWoodLogs(const MATH::Vector2f& center_world_position);
+        std::size_t AddDustCloud(const MATH::Vector2f& center_world_position);
+        std::size_t AddFood(const Food& food);
+
+        // ENTITY REMOVAL.
+        void Remove(const std::size_t entity_index);
+        void RemoveAll(const EntityKind kind);
+        void Clear();
+
+        // COUNTING.
+        std::size_t Count() const;
+        std::size_t Count(const EntityKind kind) const;
+
+        // RETRIEVAL.
+        GRAPHICS::Sprite GetSprite(const std::size_t entity_index) const;
+        Food GetFood(const std::size_t entity_index) const;
+
+        // UPDATING.
+        void Update(const sf::Time& elapsed_time);
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        // Each of these arrays always has one element per entity.
+        /// The kind of each entity.
+        std::vector<EntityKind> Kinds = {};
+        /// The center world position of each entity.
+        std::vector<MATH::Vector2f> WorldPositions = {};
+        /// The world bounding box of each entity, used for collision detection.
+        std::vector<MATH::FloatRectangle> WorldBoundingBoxes = {};
+        /// The sprite frame currently displayed for each entity.
+        std::vector<SpriteFrame> SpriteFrames = {};
+        /// How long each entity has been animating, in seconds.
+        std::vector<float> AnimationTimesInSeconds = {};
+        /// The type of food for each entity.  Only meaningful for food.
+        std::vector<Food::TypeId> FoodTypes = {};
+        /// The amount of food in each entity.  Only meaningful for food.
+        std::vector<unsigned int> FoodCounts = {};
+
+    private:
+        // HELPER METHODS.
+        std::size_t Add(
+            const EntityKind kind,
+            const MATH::Vector2f& center_world_position,
+            const MATH::FloatRectangle& world_bounding_box,
+            const SpriteFrame& sprite_frame);
+        template <typename Component>
+        static void RemoveComponent(const std::size_t entity_index, std::vector<Component>& components);
+    };
+
+    /// Removes a single entity's component by moving the last entity's component into its place.
+    /// @tparam Component - The type of component to remove.
+    /// @param[in]  entity_index - The index of the entity whose component to remove.  Must be valid.
+    /// @param[in,out]  components - The components from which to remove the entity's component.
+    template <typename Component>
+    void EntityStorage::RemoveComponent(const std::size_t entity_index, std::vector<Component>& components)
+    {
+        components[entity_index] = std::move(components.back());
+        components.pop_back();
+    }
+}
@@ -1,3 +1,4 @@
+#include <utility>
 #include "Objects/Present.h"
 #include "Resources/AssetId.h"
 
@@ -6,9 +7,10 @@ namespace OBJECTS
     /// Creates a present.
     /// @param[in]  center_world_position - The center world position of the present.
     /// @param[in]  bible_verse - The Bible verse contained within the present.
-    Present::Present(const MATH::Vector2f& center_world_position, const BIBLE::BibleVerse& bible_verse) :
+    ///     Taken by value so that verses no longer needed elsewhere can be moved in without copying their text.
+    Present::Present(const MATH::Vector2f& center_world_position, BIBLE::BibleVerse bible_verse) :
         Sprite(),
-        BibleVerse(bible_verse)
+        BibleVerse(std::move(bible_verse))
     {
         // FINISH CREATING THE SPRITE.
         const MATH::FloatRectangle TEXTURE_SUB_RECTANGLE = MATH::FloatRectangle::FromLeftTopAndDimensions(0, 0, 16, 16);
@@ -12,7 +12,7 @@ namespace OBJECTS
     {
     public:
         // CONSTRUCTION.
-        explicit Present(const MATH::Vector2f& center_world_position, const BIBLE::BibleVerse& bible_verse);
+        explicit Present(const MATH::Vector2f& center_world_position, BIBLE::BibleVerse bible_verse);
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The graphical sprite for the present.
@@ -1,9 +1,12 @@
+#include <cstdint>
+#include <utility>
 #include "Resources/Asset.h"
 
 namespace RESOURCES
 {
     /// Attempts to read the asset data from the provided binary data stream.
     /// @param[in]  data_stream - The data stream from which to read the asset's binary data.
+    ///     The location of the asset's data is recorded relative to the start of the stream.
     /// @return The asset, if successfully read; none otherwise.
     std::optional<Asset> Asset::Read(std::istream& data_stream)
     {
@@ -15,13 +18,47 @@ namespace RESOURCES
         AssetId asset_id = AssetId::INVALID;
         data_stream.read(reinterpret_cast<char*>(&asset_id), sizeof(Id));
 
+        // READ IN ANY PLAYBACK PROPERTIES FOR AUDIO.
+        // Each property is stored individually in the order declared.
+        AUDIO::SoundProperties sound_properties;
+        AUDIO::MusicProperties music_properties;
+        switch (asset_type)
+        {
+            case AssetType::SOUND_EFFECT:
+                data_stream.read(reinterpret_cast<char*>(&sound_properties.Priority), sizeof(sound_properties.Priority));
+                data_stream.read(reinterpret_cast<char*>(&sound_properties.MaxInstanceCount), sizeof(sound_properties.MaxInstanceCount));
+                data_stream.read(reinterpret_cast<char*>(&sound_properties.FullVolumeDistanceInPixels), sizeof(sound_properties.FullVolumeDistanceInPixels));
+                data_stream.read(reinterpret_cast<char*>(&sound_properties.MaxAudibleDistanceInPixels), sizeof(sound_properties.MaxAudibleDistanceInPixels));
+                break;
+            case AssetType::MUSIC:
+                data_stream.read(reinterpret_cast<char*>(&music_properties.Pitch), sizeof(music_properties.Pitch));
+                data_stream.read(reinterpret_cast<char*>(&music_properties.VolumePercent), sizeof(music_properties.VolumePercent));
+                data_stream.read(reinterpret_cast<char*>(&music_properties.Looping), sizeof(music_properties.Looping));
+                break;
+            default:
+                // Other types of assets don't have any additional properties.
+                break;
+        }
+
         // READ IN THE ASSET DATA.
         std::string::size_type asset_size_in_bytes = 0;
         data_stream.read(reinterpret_cast<char*>(&asset_size_in_bytes), sizeof(asset_size_in_bytes));
 
-        constexpr char EMPTY_DATA = '\0';
-        std::string asset_data(asset_size_in_bytes, EMPTY_DATA);
-        data_stream.read(asset_data.data(), asset_size_in_bytes);
+        std::streamoff asset_data_offset_in_bytes = data_stream.tellg();
+        std::string asset_data;
+        bool asset_streamed_when_used = (AssetType::MUSIC == asset_type);
+        if (asset_streamed_when_used)
+        {
+            // Music is large and only needs small parts of its data at a time,
+            // so it is streamed from its location when played instead.
+            data_stream.seekg(static_cast<std::streamoff>(asset_size_in_bytes), std::ios::cur);
+        }
+        else
+        {
+            constexpr char EMPTY_DATA = '\0';
+            asset_data.assign(asset_size_in_bytes, EMPTY_DATA);
+            data_stream.read(asset_data.data(), asset_size_in_bytes);
+        }
 
         // RETURN THE ASSET IF SUCCESSFULLY READ.
         bool asset_read_successfully = !data_stream.bad() && !data_stream.fail();
@@ -30,7 +67,11 @@ namespace RESOURCES
             Asset asset;
             asset.Type = asset_type;
             asset.Id = asset_id;
-            asset.BinaryData = asset_data;
+            asset.BinaryData = std::move(asset_data);
+            asset.DataLocation.OffsetInBytes = static_cast<std::uint64_t>(asset_data_offset_in_bytes);
+            asset.DataLocation.SizeInBytes = asset_size_in_bytes;
+            asset.SoundProperties = sound_properties;
+            asset.MusicProperties = music_properties;
             return asset;
         }
         else
@@ -3,6 +3,9 @@
 #include <istream>
 #include <optional>
 #include <string>
+#include "Audio/MusicProperties.h"
+#include "Audio/SoundProperties.h"
+#include "Filesystem/FileRegion.h"
 #include "Resources/AssetId.h"
 #include "Resources/AssetType.h"
 
@@ -20,7 +23,14 @@ namespace RESOURCES
         AssetType Type = AssetType::INVALID;
         /// The unique ID of the asset.
         AssetId Id = AssetId::INVALID;
-        /// The binary data of the asset.
+        /// The binary data of the asset.  Empty for assets streamed from their location
+        /// in the package file when used (like music), rather than being read in up-front.
         std::string BinaryData = "";
+        /// Where the binary data of the asset is stored.
+        FILESYSTEM::FileRegion DataLocation = {};
+        /// How the asset is played, if it is a sound effect.
+        AUDIO::SoundProperties SoundProperties = {};
+        /// How the asset is played, if it is music.
+        AUDIO::MusicProperties MusicProperties = {};
     };
 }
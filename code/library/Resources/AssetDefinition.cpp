@@ -11,4 +11,36 @@ namespace RESOURCES
         Id(id),
         Filepath(filepath)
     {}
+
+    /// Constructor for sound effects that shouldn't be played with default properties.
+    /// @param[in]  type - See \ref Type.
+    /// @param[in]  id - See \ref Id.
+    /// @param[in]  filepath - See \ref Filepath.
+    /// @param[in]  sound_properties - See \ref SoundProperties.
+    AssetDefinition::AssetDefinition(
+        const AssetType type,
+        const AssetId id,
+        const std::filesystem::path& filepath,
+        const AUDIO::SoundProperties& sound_properties) :
+        Type(type),
+        Id(id),
+        Filepath(filepath),
+        SoundProperties(sound_properties)
+    {}
+
+    /// Constructor for music that shouldn't be played with default properties.
+    /// @param[in]  type - See \ref Type.
+    /// @param[in]  id - See \ref Id.
+    /// @param[in]  filepath - See \ref Filepath.
+    /// @param[in]  music_properties - See \ref MusicProperties.
+    AssetDefinition::AssetDefinition(
+        const AssetType type,
+        const AssetId id,
+        const std::filesystem::path& filepath,
+        const AUDIO::MusicProperties& music_properties) :
+        Type(type),
+        Id(id),
+        Filepath(filepath),
+        MusicProperties(music_properties)
+    {}
 }
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <filesystem>
+#include "Audio/MusicProperties.h"
+#include "Audio/SoundProperties.h"
 #include "Resources/AssetId.h"
 #include "Resources/AssetType.h"
 
@@ -12,6 +14,16 @@ namespace RESOURCES
     public:
         // CONSTRUCTION.
         explicit AssetDefinition(const AssetType type, const AssetId id, const std::filesystem::path& filepath);
+        explicit AssetDefinition(
+            const AssetType type,
+            const AssetId id,
+            const std::filesystem::path& filepath,
+            const AUDIO::SoundProperties& sound_properties);
+        explicit AssetDefinition(
+            const AssetType type,
+            const AssetId id,
+            const std::filesystem::path& filepath,
+            const AUDIO::MusicProperties& music_properties);
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The type of the asset.
@@ -20,5 +32,9 @@ namespace RESOURCES
         AssetId Id;
         /// The path (relative or absolute) to the asset file.
         std::filesystem::path Filepath;
+        /// How the asset is played, if it is a sound effect.
+        AUDIO::SoundProperties SoundProperties = {};
+        /// How the asset is played, if it is music.
+        AUDIO::MusicProperties MusicProperties = {};
     };
 }
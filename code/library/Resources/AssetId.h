@@ -16,6 +16,8 @@ namespace RESOURCES
         FONT_TEXTURE,
         /// A serif font texture.
         SERIF_FONT_TEXTURE,
+        /// The texture with glyphs for all fonts packed together (see font_metric_builder).
+        PACKED_FONT_TEXTURE,
 
         // OTHER TEXTURES.
         /// The texture with animal sprites.
@@ -147,7 +149,11 @@ namespace RESOURCES
         /// Brightness after rain background sounds.
         AFTER_RAIN_BACKGROUND_SOUNDS,
         /// The music for the final credits.
-        FINAL_CREDITS_MUSIC
+        FINAL_CREDITS_MUSIC,
+        /// A prebuilt snapshot of the world in its initial state.
+        INITIAL_WORLD_SNAPSHOT,
+        /// The raw data for all tile maps in the world.
+        WORLD_MAP_DATA
     };
 
     /// A mapping of asset IDs to filepaths.
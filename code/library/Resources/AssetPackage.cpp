@@ -1,6 +1,7 @@
 #include <cstdint>
 #include <fstream>
 #include <string>
+#include <utility>
 #include "Filesystem/File.h"
 #include "Resources/AssetPackage.h"
 
@@ -22,6 +23,15 @@ namespace RESOURCES
             return {};
         }
 
+        // MAKE SURE THE FILE IS IN THE CURRENT FORMAT.
+        std::uint32_t file_format_version = 0;
+        asset_package_file.read(reinterpret_cast<char*>(&file_format_version), sizeof(file_format_version));
+        bool file_format_supported = (FILE_FORMAT_VERSION == file_format_version);
+        if (!file_format_supported)
+        {
+            return {};
+        }
+
         // READ IN ALL ASSETS FROM THE FILE.
         std::unordered_map<AssetId, Asset> assets;
 
@@ -36,7 +46,8 @@ namespace RESOURCES
             std::optional<Asset> asset = Asset::Read(asset_package_file);
             if (asset)
             {
-                assets[asset->Id] = *asset;
+                asset->DataLocation.Filepath = filepath;
+                assets[asset->Id] = std::move(*asset);
             }
         }
 
@@ -60,6 +71,9 @@ namespace RESOURCES
             return false;
         }
 
+        // WRITE THE VERSION OF THE FILE FORMAT.
+        asset_package_file.write(reinterpret_cast<const char*>(&FILE_FORMAT_VERSION), sizeof(FILE_FORMAT_VERSION));
+
         // WRITE EACH ASSET TO THE PACKAGE FILE.
         for (const auto& asset : asset_package_definition.Assets)
         {
@@ -77,6 +91,23 @@ namespace RESOURCES
             // and make it usable for the game.
             asset_package_file.write(reinterpret_cast<const char*>(&asset.Type), sizeof(asset.Type));
             asset_package_file.write(reinterpret_cast<const char*>(&asset.Id), sizeof(asset.Id));
+            switch (asset.Type)
+            {
+                case AssetType::SOUND_EFFECT:
+                    asset_package_file.write(reinterpret_cast<const char*>(&asset.SoundProperties.Priority), sizeof(asset.SoundProperties.Priority));
+                    asset_package_file.write(reinterpret_cast<const char*>(&asset.SoundProperties.MaxInstanceCount), sizeof(asset.SoundProperties.MaxInstanceCount));
+                    asset_package_file.write(reinterpret_cast<const char*>(&asset.SoundProperties.FullVolumeDistanceInPixels), sizeof(asset.SoundProperties.FullVolumeDistanceInPixels));
+                    asset_package_file.write(reinterpret_cast<const char*>(&asset.SoundProperties.MaxAudibleDistanceInPixels), sizeof(asset.SoundProperties.MaxAudibleDistanceInPixels));
+                    break;
+                case AssetType::MUSIC:
+                    asset_package_file.write(reinterpret_cast<const char*>(&asset.MusicProperties.Pitch), sizeof(asset.MusicProperties.Pitch));
+                    asset_package_file.write(reinterpret_cast<const char*>(&asset.MusicProperties.VolumePercent), sizeof(asset.MusicProperties.VolumePercent));
+                    asset_package_file.write(reinterpret_cast<const char*>(&asset.MusicProperties.Looping), sizeof(asset.MusicProperties.Looping));
+                    break;
+                default:
+                    // Other types of assets don't have any additional properties.
+                    break;
+            }
             std::string::size_type asset_size_in_bytes = asset_data.size();
             asset_package_file.write(reinterpret_cast<const char*>(&asset_size_in_bytes), sizeof(asset_size_in_bytes));
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <filesystem>
 #include <unordered_map>
 #include "Resources/Asset.h"
@@ -14,11 +15,16 @@ namespace RESOURCES
     /// assets so that different ones can be loaded at different
     /// times to reduce overall loading time for users.
     ///
-    /// This class doesn't currently corresponding to any kind
-    /// of asset package file, but that may be a future option.
+    /// Asset package files start with a version number for their format, followed by each asset's
+    /// metadata (including any properties for how audio is played) and binary data.
     class AssetPackage
     {
     public:
+        // CONSTANTS.
+        /// The version of the asset package file format.  Must be changed whenever the format changes
+        /// so that packages built with older versions of the asset packer are rejected rather than misread.
+        static constexpr std::uint32_t FILE_FORMAT_VERSION = 2;
+
         // FILE ACCESS.
         static std::unordered_map<AssetId, Asset> ReadFile(const std::filesystem::path& filepath);
         static bool WriteFile(const AssetPackageDefinition& asset_package_definition, const std::filesystem::path& filepath);
@@ -16,6 +16,10 @@ namespace RESOURCES
         /// A piece of music.
         MUSIC,
         /// A shader.
-        SHADER
+        SHADER,
+        /// A prebuilt snapshot of the world (see \ref MAPS::WorldSnapshot).
+        WORLD_SNAPSHOT,
+        /// Raw data for tile maps in the world (see \ref MAPS::TileMapFile).
+        MAP_DATA
     };
 }
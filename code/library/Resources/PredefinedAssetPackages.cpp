@@ -7,10 +7,17 @@ namespace RESOURCES
     const AssetPackageDefinition INTRO_SEQUENCE_ASSET_PACKAGE_DEFINITION({
         AssetDefinition(AssetType::MUSIC, AssetId::INTRO_MUSIC, "res/sounds/NoahsArkIntro1_80PercentSpeedWithFadeout.wav"),
         AssetDefinition(AssetType::SHADER, AssetId::COLORED_TEXTURE_SHADER, "res/shaders/ColoredTexture.frag"),
+        AssetDefinition(AssetType::TEXTURE, AssetId::PACKED_FONT_TEXTURE, "res/images/packed_fonts.png"),
+        AssetDefinition(AssetType::MAP_DATA, AssetId::WORLD_MAP_DATA, "res/maps/world.map"),
+        // Generated by the asset packer before packing.
+        AssetDefinition(AssetType::WORLD_SNAPSHOT, AssetId::INITIAL_WORLD_SNAPSHOT, "generated_assets/initial_world.snapshot"),
     });
 
     const std::string MAIN_ASSET_PACKAGE_FILENAME = "MainAssets.package";
 
+    /// Properties for sounds directly resulting from the player's actions.
+    static constexpr AUDIO::SoundProperties PLAYER_ACTION_SOUND_PROPERTIES = { .Priority = AUDIO::SoundProperties::PLAYER_ACTION_PRIORITY };
+
     const AssetPackageDefinition MAIN_ASSET_PACKAGE_DEFINITION({
         // OTHER TEXTURES.
         AssetDefinition(AssetType::TEXTURE, AssetId::ANIMAL_TEXTURE, "res/images/animal_sprites.png"),
@@ -36,11 +43,18 @@ namespace RESOURCES
         AssetDefinition(AssetType::TEXTURE, AssetId::FLOOD_CUTSCENE_ARK, "res/images/flood_scene_ark.png"),
 
         // GENERAL SOUND EFFECTS.
-        AssetDefinition(AssetType::SOUND_EFFECT, AssetId::ARK_BUILDING_SOUND, "res/sounds/ark_build_sound1.wav"),
-        AssetDefinition(AssetType::SOUND_EFFECT, AssetId::AXE_HIT_SOUND, "res/sounds/axe_tree_hit1.wav"),
-        AssetDefinition(AssetType::SOUND_EFFECT, AssetId::COLLECT_BIBLE_VERSE_SOUND, "res/sounds/collect_bible_verse1.wav"),
-        AssetDefinition(AssetType::SOUND_EFFECT, AssetId::FOOD_PICKUP_SOUND, "res/sounds/food_pickup_sound.wav"),
-        AssetDefinition(AssetType::SOUND_EFFECT, AssetId::TREE_SHAKE_SOUND, "res/sounds/tree_shake4.wav"),
+        // Sounds directly resulting from the player's actions are more important than animal sounds.
+        AssetDefinition(AssetType::SOUND_EFFECT, AssetId::ARK_BUILDING_SOUND, "res/sounds/ark_build_sound1.wav", PLAYER_ACTION_SOUND_PROPERTIES),
+        AssetDefinition(AssetType::SOUND_EFFECT, AssetId::AXE_HIT_SOUND, "res/sounds/axe_tree_hit1.wav", PLAYER_ACTION_SOUND_PROPERTIES),
+        AssetDefinition(AssetType::SOUND_EFFECT, AssetId::COLLECT_BIBLE_VERSE_SOUND, "res/sounds/collect_bible_verse1.wav", PLAYER_ACTION_SOUND_PROPERTIES),
+        AssetDefinition(AssetType::SOUND_EFFECT, AssetId::FOOD_PICKUP_SOUND, "res/sounds/food_pickup_sound.wav", PLAYER_ACTION_SOUND_PROPERTIES),
+        // Only a single tree shaking sound is played at once, which results in a smoother sound
+        // experience while a tree keeps shaking.
+        AssetDefinition(AssetType::SOUND_EFFECT, AssetId::TREE_SHAKE_SOUND, "res/sounds/tree_shake4.wav", AUDIO::SoundProperties
+        {
+            .Priority = AUDIO::SoundProperties::PLAYER_ACTION_PRIORITY,
+            .MaxInstanceCount = 1
+        }),
 
         // ANIMAL SOUND EFFECTS.
         AssetDefinition(AssetType::SOUND_EFFECT, AssetId::ALLIGATOR_SOUND, "res/sounds/animals/alligator.wav"),
@@ -94,11 +108,16 @@ namespace RESOURCES
 
         // MUSIC.
         AssetDefinition(AssetType::MUSIC, AssetId::NEW_GAME_INTRO_MUSIC, "res/sounds/Intro1.wav"),
-        AssetDefinition(AssetType::MUSIC, AssetId::OVERWORLD_BACKGROUND_MUSIC, "res/sounds/overworld_music.wav"),
-        AssetDefinition(AssetType::MUSIC, AssetId::BASIC_RAIN_BACKGROUND_SOUNDS, "res/sounds/Rain Ending-SoundBible.com-1043019515.wav"),
-        AssetDefinition(AssetType::MUSIC, AssetId::THUNDERSTORM_BACKGROUND_SOUNDS, "res/sounds/2_Minute_Thunderstorm-Mike_Koenig-574654058.wav"),
-        AssetDefinition(AssetType::MUSIC, AssetId::AFTER_RAIN_BACKGROUND_SOUNDS, "res/sounds/rainforest_ambience-GlorySunz-1938133500.wav"),
-        AssetDefinition(AssetType::MUSIC, AssetId::FINAL_CREDITS_MUSIC, "res/sounds/NoahsArkIntro1_PaulstretchPlusMore.wav"),
+        // The pitch is lowered to give the background music a more somber, ambient tone.
+        // It might be possible to make it go lower to achieve more of an ambient effect,
+        // at the expense of sounding more "scary".
+        AssetDefinition(AssetType::MUSIC, AssetId::OVERWORLD_BACKGROUND_MUSIC, "res/sounds/overworld_music.wav", AUDIO::MusicProperties { .Pitch = 0.5f, .Looping = true }),
+        // Slower pitch to better match the duration of the cutscene.
+        AssetDefinition(AssetType::MUSIC, AssetId::BASIC_RAIN_BACKGROUND_SOUNDS, "res/sounds/Rain Ending-SoundBible.com-1043019515.wav", AUDIO::MusicProperties { .Pitch = 0.4f }),
+        // Lowered volume for greater subtleness.
+        AssetDefinition(AssetType::MUSIC, AssetId::THUNDERSTORM_BACKGROUND_SOUNDS, "res/sounds/2_Minute_Thunderstorm-Mike_Koenig-574654058.wav", AUDIO::MusicProperties { .VolumePercent = 60.0f, .Looping = true }),
+        AssetDefinition(AssetType::MUSIC, AssetId::AFTER_RAIN_BACKGROUND_SOUNDS, "res/sounds/rainforest_ambience-GlorySunz-1938133500.wav", AUDIO::MusicProperties { .VolumePercent = 40.0f, .Looping = true }),
+        AssetDefinition(AssetType::MUSIC, AssetId::FINAL_CREDITS_MUSIC, "res/sounds/NoahsArkIntro1_PaulstretchPlusMore.wav", AUDIO::MusicProperties { .Looping = true }),
 
         // SHADERS.
         AssetDefinition(AssetType::SHADER, AssetId::TIME_OF_DAY_SHADER, "res/shaders/TimeOfDay.frag"),
@@ -8,6 +8,7 @@ namespace STATES
     {
         // RESET THE ELAPSED TIME FOR THE CREDITS SCREEN.
         ElapsedTime = sf::Time::Zero;
+        ScreenChanged = true;
     }
 
     /// Updates the credits screen based on elapsed time and user input.
@@ -25,7 +26,15 @@ namespace STATES
         else
         {
             // TRACK THE ELAPSED TIME.
+            // The credits only need to be redrawn once they've scrolled by a whole pixel.
+            float previous_credits_text_top_offset_in_pixels = CreditsTextTopOffsetInPixels();
             ElapsedTime += gaming_hardware.Clock.ElapsedTimeSinceLastFrame;
+            float current_credits_text_top_offset_in_pixels = CreditsTextTopOffsetInPixels();
+            bool credits_scrolled = (previous_credits_text_top_offset_in_pixels != current_credits_text_top_offset_in_pixels);
+            if (credits_scrolled)
+            {
+                ScreenChanged = true;
+            }
 
             // INDICATE THE GAME SHOULD REMAIN ON THE CREDITS SCREEN.
             return GameState::CREDITS_SCREEN;
@@ -38,11 +47,7 @@ namespace STATES
     sf::Sprite CreditsScreen::Render(GRAPHICS::Renderer& renderer) const
     {
         // CALCULATE THE OFFSET OF THE TOP OF THE CREDITS BASED ON THE ELAPSED TIME.
-        // This helps implement scrolling of the credits text upward.
-        constexpr float SCROLL_RATE_IN_PIXELS_PER_SECOND = -4.0f;
-        float elapsed_time_in_seconds = ElapsedTime.asSeconds();
-        // The result needs to be rounded to an integer to avoid flickering due to sub-pixel values.
-        float credits_text_top_offset_in_pixels = std::round(SCROLL_RATE_IN_PIXELS_PER_SECOND * elapsed_time_in_seconds);
+        float credits_text_top_offset_in_pixels = CreditsTextTopOffsetInPixels();
 
         // RENDER TEXT INDICATING THE PURPOSE OF THIS SCREEN.
         const GRAPHICS::Color CREDITS_TEXT_COLOR = GRAPHICS::Color::WHITE;
@@ -349,4 +354,16 @@ namespace STATES
         sf::Sprite screen = renderer.RenderFinalScreen();
         return screen;
     }
-}
\ No newline at end of file
+
+    /// Calculates the offset of the top of the credits text based on the elapsed time.
+    /// This helps implement scrolling of the credits text upward.
+    /// @return The vertical offset of the credits text, in whole pixels.
+    float CreditsScreen::CreditsTextTopOffsetInPixels() const
+    {
+        constexpr float SCROLL_RATE_IN_PIXELS_PER_SECOND = -4.0f;
+        float elapsed_time_in_seconds = ElapsedTime.asSeconds();
+        // The result needs to be rounded to an integer to avoid flickering due to sub-pixel values.
+        float credits_text_top_offset_in_pixels = std::round(SCROLL_RATE_IN_PIXELS_PER_SECOND * elapsed_time_in_seconds);
+        return credits_text_top_offset_in_pixels;
+    }
+}
@@ -16,9 +16,13 @@ namespace STATES
         void Load();
         GameState Update(const HARDWARE::GamingHardware& gaming_hardware);
         sf::Sprite Render(GRAPHICS::Renderer& renderer) const;
+        float CreditsTextTopOffsetInPixels() const;
 
         // MEMBER VARIABLES.
         /// The total time that the credits screen has been shown.
         sf::Time ElapsedTime = sf::Time::Zero;
+        /// True if anything shown on the credits screen has changed since it was last rendered.
+        /// Cleared once the screen has been rendered.
+        bool ScreenChanged = true;
     };
 }
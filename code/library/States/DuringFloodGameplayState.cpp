@@ -1,3 +1,4 @@
+#include <utility>
 #include "Collision/CollisionDetectionAlgorithms.h"
 #include "Debugging/DebugConsole.h"
 #include "ErrorHandling/Asserts.h"
@@ -63,7 +64,7 @@ namespace STATES
                 // CHECK IF A WALKABLE TILE EXISTS AT THAT RANDOM LOCATION.
                 // If a walkable tile doesn't exist, we'll just continue trying a different location.
                 MAPS::MultiTileMapGrid& ark_layer = world.Ark.Interior.LayersFromBottomToTop[ark_layer_index];
-                std::shared_ptr<MAPS::Tile> tile = ark_layer.GetTileAtWorldPosition(
+                const MAPS::Tile* tile = ark_layer.GetTileAtWorldPosition(
                     family_member_x_position,
                     family_member_y_position);
                 bool tile_is_walkable = (tile && tile->IsWalkable());
@@ -92,11 +93,11 @@ namespace STATES
         // used for other things (i.e. "personal space").
         constexpr unsigned int SINGLE_ARK_TILE_MAP_ROW_INDEX = 0;
         constexpr unsigned int ARK_LEFT_TILE_MAP_COLUMN_INDEX = 0;
-        MAPS::TileMap* left_tile_map_for_food = world.Ark.Interior.LayersFromBottomToTop[MAPS::Ark::HIGHEST_LAYER_INDEX].GetTileMap(SINGLE_ARK_TILE_MAP_ROW_INDEX, ARK_LEFT_TILE_MAP_COLUMN_INDEX);
-        left_tile_map_for_food->FoodOnGround.clear();
+        MAPS::TileMap* left_tile_map_for_food = world.Ark.Interior.LayersFromBottomToTop[MAPS::Ark::HIGHEST_LAYER_INDEX].GetTileMapForChanging(SINGLE_ARK_TILE_MAP_ROW_INDEX, ARK_LEFT_TILE_MAP_COLUMN_INDEX);
+        left_tile_map_for_food->Entities.RemoveAll(OBJECTS::EntityKind::FOOD);
         constexpr unsigned int ARK_RIGHT_TILE_MAP_COLUMN_INDEX = 2;
-        MAPS::TileMap* right_tile_map_for_food = world.Ark.Interior.LayersFromBottomToTop[MAPS::Ark::HIGHEST_LAYER_INDEX].GetTileMap(SINGLE_ARK_TILE_MAP_ROW_INDEX, ARK_RIGHT_TILE_MAP_COLUMN_INDEX);
-        right_tile_map_for_food->FoodOnGround.clear();
+        MAPS::TileMap* right_tile_map_for_food = world.Ark.Interior.LayersFromBottomToTop[MAPS::Ark::HIGHEST_LAYER_INDEX].GetTileMapForChanging(SINGLE_ARK_TILE_MAP_ROW_INDEX, ARK_RIGHT_TILE_MAP_COLUMN_INDEX);
+        right_tile_map_for_food->Entities.RemoveAll(OBJECTS::EntityKind::FOOD);
 
         constexpr unsigned int FIRST_VALID_FOOD_ID = OBJECTS::Food::TypeId::NONE + 1;
         for (unsigned int food_id = FIRST_VALID_FOOD_ID; food_id < OBJECTS::Food::COUNT; ++food_id)
@@ -171,7 +172,7 @@ namespace STATES
                     .Count = current_food_collected_count,
                     .Sprite = *food_sprite
                 };
-                tile_map_for_food->FoodOnGround.push_back(food);
+                tile_map_for_food->Entities.AddFood(food);
 
                 // REMOVE THE FOOD FROM THE PLAYER'S INVENTORY SINCE IT IS NOW ON THE GROUND IN THE ARK.
                 world.NoahPlayer->Inventory.FoodCounts[food_id] = 0;
@@ -180,7 +181,8 @@ namespace STATES
         }
 
         // MOVE THE PLAYER INTO THE ENTRANCE.
-        std::shared_ptr<MAPS::TileMap> entrance_map = world.Ark.GetEntranceMap();
+        // The entrance map is retrieved for changing so that the exitway is re-opened if the world is reset.
+        MAPS::TileMap* entrance_map = world.Ark.GetEntranceMapForChanging();
         MATH::Vector2f entrance_map_center_position = entrance_map->GetCenterWorldPosition();
         world.NoahPlayer->SetWorldPosition(entrance_map_center_position);
         renderer.Camera.SetCenter(entrance_map_center_position);
@@ -254,12 +256,15 @@ namespace STATES
     /// @param[in,out]  gaming_hardware - The gaming hardware supplying input and output for the update.
     /// @param[in,out]  world - The world to update based on gameplay.
     /// @param[in,out]  camera - The camera to be updated based on player actions during this frame.
+    /// @param[in,out]  current_game_data - The current game data to use and update.
+    /// @param[in,out]  saved_game_writer - The writer for saving the game in the background.
     /// @return The next game state after updating.
     GameState DuringFloodGameplayState::Update(
         HARDWARE::GamingHardware& gaming_hardware,
         MAPS::World& world,
         GRAPHICS::Camera& camera,
-        STATES::SavedGameData& current_game_data)
+        STATES::SavedGameData& current_game_data,
+        STATES::SavedGameWriter& saved_game_writer)
     {
         // PLAY BACKGROUND MUSIC IF NOT ALREADY PLAYING.
         gaming_hardware.Speakers->PlayMusicIfNotAlready(RESOURCES::AssetId::THUNDERSTORM_BACKGROUND_SOUNDS);
@@ -294,7 +299,7 @@ namespace STATES
 
         // UPDATE THE HUD.
         // As of now, the HUD is capable of altering the gameplay state.
-        auto [next_game_state, dropped_food_type] = Hud.Update(current_game_data, gaming_hardware);
+        auto [next_game_state, dropped_food_type] = Hud.Update(current_game_data, gaming_hardware, saved_game_writer);
 
         // CHECK IF A TYPE OF FOOD WAS SELECTED FOR DROPPING.
         bool food_selected_for_dropping = (OBJECTS::Food::NONE != dropped_food_type);
@@ -332,10 +337,10 @@ namespace STATES
                 .Count = 1,
                 .Sprite = *food_sprite
             };
-            MAPS::TileMap* current_tile_map = CurrentMapGrid->GetTileMap(food_sprite->WorldPosition.X, food_sprite->WorldPosition.Y);
+            MAPS::TileMap* current_tile_map = CurrentMapGrid->GetTileMapForChanging(food_sprite->WorldPosition.X, food_sprite->WorldPosition.Y);
             ASSERT_THEN_IF(current_tile_map)
             {
-                current_tile_map->FoodOnGround.push_back(food);
+                current_tile_map->Entities.AddFood(food);
             }
 
             // REMOVE THE FOOD FROM THE PLAYER'S INVENTORY SINCE IT IS NOW ON THE GROUND.
@@ -428,11 +433,13 @@ namespace STATES
     /// Renders the current frame of the gameplay state.
     /// @param[in]  world - The world to render.
     /// @param[in,out]  renderer - The renderer to use for rendering.
+    /// @param[in]  gaming_hardware - The gaming hardware.
     /// @return The rendered gameplay state.
     sf::Sprite DuringFloodGameplayState::Render(
         MAPS::World& world,
         STATES::SavedGameData& current_game_data,
-        GRAPHICS::Renderer& renderer)
+        GRAPHICS::Renderer& renderer,
+        HARDWARE::GamingHardware& gaming_hardware)
     {
         // RENDER CONTENT SPECIFIC TO THE CURRENT MAP.
         renderer.Render(*CurrentMapGrid);
@@ -470,12 +477,18 @@ namespace STATES
         MAPS::TileMap* current_tile_map = CurrentMapGrid->GetTileMap(camera_view_center.X, camera_view_center.Y);
         ASSERT_THEN_IF(current_tile_map)
         {
-            for (auto food = current_tile_map->FoodOnGround.cbegin();
-                food != current_tile_map->FoodOnGround.cend();
-                ++food)
+            const OBJECTS::EntityStorage& entities = current_tile_map->Entities;
+            for (std::size_t entity_index = 0; entity_index < entities.Count(); ++entity_index)
             {
+                // SKIP ANY ENTITIES THAT AREN'T FOOD.
+                bool is_food = (OBJECTS::EntityKind::FOOD == entities.Kinds[entity_index]);
+                if (!is_food)
+                {
+                    continue;
+                }
+
                 // CHECK IF THE CURRENT FOOD ITEM INTERSECTS WITH THE PLAYER.
-                MATH::FloatRectangle food_bounding_box = food->Sprite.GetWorldBoundingBox();
+                const MATH::FloatRectangle& food_bounding_box = entities.WorldBoundingBoxes[entity_index];
                 MATH::FloatRectangle noah_bounding_box = world.NoahPlayer->GetWorldBoundingBox();
                 bool food_intersects_with_noah = food_bounding_box.Intersects(noah_bounding_box);
                 if (food_intersects_with_noah)
@@ -517,7 +530,7 @@ namespace STATES
         }
 
         // RENDER THE HUD.
-        Hud.Render(current_game_data, renderer);
+        Hud.Render(current_game_data, renderer, *gaming_hardware.FrameArena);
 
         // RENDER THE BIBLE VERSE MINI-GAME IF OPEN.
         if (BibleVerseMiniGame.IsOpen)
@@ -627,11 +640,22 @@ namespace STATES
             }
 
             // CHECK FOR COLLISIONS WITH FOOD.
-            for (auto food = current_tile_map->FoodOnGround.begin();
-                food != current_tile_map->FoodOnGround.end();)
+            OBJECTS::EntityStorage& entities = current_tile_map->Entities;
+            for (std::size_t entity_index = 0; entity_index < entities.Count();)
             {
+                // SKIP ANY ENTITIES THAT AREN'T FOOD.
+                bool is_food = (OBJECTS::EntityKind::FOOD == entities.Kinds[entity_index]);
+                if (!is_food)
+                {
+                    ++entity_index;
+                    continue;
+                }
+
                 // CHECK IF THE CURRENT FOOD ITEM INTERSECTS WITH THE PLAYER.
-                MATH::FloatRectangle food_bounding_box = food->Sprite.GetWorldBoundingBox();
+                // The bounding box is copied since the food may be removed below.
+                MATH::FloatRectangle food_bounding_box = entities.WorldBoundingBoxes[entity_index];
+                OBJECTS::Food::TypeId& food_type = entities.FoodTypes[entity_index];
+                unsigned int& food_count = entities.FoodCounts[entity_index];
                 // Food for the player only needs to be collected if the player is pressing the appropriate button,
                 // so there is no need to check for this otherwise.
                 bool collect_food_button_pressed = gaming_hardware.InputController.ButtonWasPressed(INPUT_CONTROL::InputController::PRIMARY_ACTION_KEY);
@@ -641,35 +665,38 @@ namespace STATES
                     bool food_intersects_with_noah = food_bounding_box.Intersects(noah_bounding_box);
                     if (food_intersects_with_noah)
                     {
+                        // TRACK THAT THE TILE MAP IS CHANGING.
+                        current_tile_map->MarkChangedFromInitialState();
+
                         // PLAY THE SOUND EFFECT FOR COLLECTING FOOD.
                         gaming_hardware.Speakers->PlaySoundEffect(RESOURCES::AssetId::FOOD_PICKUP_SOUND);
 
                         // ADD ONE ITEM OF FOOD TO THE PLAYER'S INVENTORY.
                         // This is done one at a time for a more interesting experience
-                        DEBUGGING::DebugConsole::WriteLine("Collected 1 food: ", static_cast<int>(food->Type));
-                        ++world.NoahPlayer->Inventory.FoodCounts[food->Type];
-                        --current_game_data.FoodCountsOnArk[food->Type];
-                        --food->Count;
+                        DEBUGGING::DebugConsole::WriteLine("Collected 1 food: ", static_cast<int>(food_type));
+                        ++world.NoahPlayer->Inventory.FoodCounts[food_type];
+                        --current_game_data.FoodCountsOnArk[food_type];
+                        --food_count;
 
                         // REMOVE THE FOOD ITEM FROM THOSE IN THE CURRENT TILE MAP IF IT HAS BEEN COMPLETELY COLLECTED.
-                        // This should move to the next food item.
-                        bool food_completely_collected = (food->Count <= 0);
+                        // The next food item is moved into the same index.
+                        bool food_completely_collected = (food_count <= 0);
                         if (food_completely_collected)
                         {
-                            food = current_tile_map->FoodOnGround.erase(food);
+                            entities.Remove(entity_index);
                             continue;
                         }
                         else
                         {
                             // MOVE TO CHECKING COLLISIONS FOR THE NEXT FOOD ITEM.
-                            ++food;
+                            ++entity_index;
                             continue;
                         }
                     }
                     else
                     {
                         // MOVE TO CHECKING COLLISIONS FOR THE NEXT FOOD ITEM.
-                        ++food;
+                        ++entity_index;
                         continue;
                     }
                 }
@@ -694,17 +721,21 @@ namespace STATES
                         if (food_intersects_animal)
                         {
                             current_food_eaten_by_animal = true;
+                            current_tile_map->MarkChangedFromInitialState();
 
                             // ADD A PRESENT WITH A BIBLE VERSE IF SOME BIBLE VERSES STILL NEED TO BE COLLECTED.
+                            // If the tile map already has too many presents, the animal just eats the food.
                             bool all_bible_verses_collected = current_game_data.BibleVersesLeftToFind.empty();
-                            if (!all_bible_verses_collected)
+                            bool room_for_present = !current_tile_map->Presents.Full();
+                            if (!all_bible_verses_collected && room_for_present)
                             {
                                 size_t remaining_bible_verse_count = current_game_data.BibleVersesLeftToFind.size();
                                 size_t random_bible_verse_index = gaming_hardware.RandomNumberGenerator.RandomNumberLessThan(remaining_bible_verse_count);
                                 auto random_bible_verse = current_game_data.BibleVersesLeftToFind.begin() + random_bible_verse_index;
 
+                                // The Bible verse is moved into the present to avoid copying its text since it's removed below anyway.
                                 MATH::Vector2f present_center_position = food_bounding_box.Center();
-                                current_tile_map->Presents.emplace_back(present_center_position, *random_bible_verse);
+                                current_tile_map->Presents.Create(present_center_position, std::move(*random_bible_verse));
 
                                 // The Bible verse is pre-emptively removed so that it does not have to be refound for removing later.
                                 current_game_data.BibleVersesLeftToFind.erase(random_bible_verse);
@@ -727,14 +758,15 @@ namespace STATES
                 if (current_food_eaten_by_animal)
                 {
                     // ERASE THE CURRENT FOOD FROM THE GROUND.
-                    current_game_data.FoodCountsOnArk[food->Type] -= food->Count;
-                    food = current_tile_map->FoodOnGround.erase(food);
+                    // The next food item is moved into the same index.
+                    current_game_data.FoodCountsOnArk[food_type] -= food_count;
+                    entities.Remove(entity_index);
                     continue;
                 }
                 else
                 {
                     // MOVE TO CHECKING COLLISIONS FOR THE NEXT FOOD ITEM.
-                    ++food;
+                    ++entity_index;
                     continue;
                 }
             }
@@ -754,7 +786,7 @@ namespace STATES
                     BirdSentFromArk = OBJECTS::BirdSentFromArk(Hud.CurrentSpecialDayAction, OBJECTS::AnimalSpecies::RAVEN);
                     BirdSentFromArk->Sprite.SetWorldPosition(world.NoahPlayer->GetWorldPosition());
                     BirdSentFromArk->Sprite.Play();
-                    gaming_hardware.Speakers->PlaySoundEffect(BirdSentFromArk->SoundId);
+                    gaming_hardware.SoundScheduler.Schedule(BirdSentFromArk->SoundId, BirdSentFromArk->Sprite.GetWorldPosition());
 
                     // MOVE TO THE NEXT SPECIAL ACTION.
                     Hud.CurrentSpecialDayAction = GAMEPLAY::FloodSpecialDayAction::CURRENT_DAY_ACTION_COMPLETED;
@@ -772,7 +804,7 @@ namespace STATES
                         BirdSentFromArk = OBJECTS::BirdSentFromArk(Hud.CurrentSpecialDayAction, OBJECTS::AnimalSpecies::DOVE);
                         BirdSentFromArk->Sprite.SetWorldPosition(world.NoahPlayer->GetWorldPosition());
                         BirdSentFromArk->Sprite.Play();
-                        gaming_hardware.Speakers->PlaySoundEffect(BirdSentFromArk->SoundId);
+                        gaming_hardware.SoundScheduler.Schedule(BirdSentFromArk->SoundId, BirdSentFromArk->Sprite.GetWorldPosition());
 
                         // CLEAR THE SPECIAL ACTION UNTIL THE NEXT DAY.
                         Hud.CurrentSpecialDayAction = GAMEPLAY::FloodSpecialDayAction::CURRENT_DAY_ACTION_COMPLETED;
@@ -787,7 +819,7 @@ namespace STATES
                     BirdSentFromArk = OBJECTS::BirdSentFromArk(Hud.CurrentSpecialDayAction, OBJECTS::AnimalSpecies::DOVE);
                     BirdSentFromArk->Sprite.SetWorldPosition(world.NoahPlayer->GetWorldPosition());
                     BirdSentFromArk->Sprite.Play();
-                    gaming_hardware.Speakers->PlaySoundEffect(BirdSentFromArk->SoundId);
+                    gaming_hardware.SoundScheduler.Schedule(BirdSentFromArk->SoundId, BirdSentFromArk->Sprite.GetWorldPosition());
 
                     // CLEAR THE SPECIAL ACTION UNTIL THE NEXT DAY.
                     Hud.CurrentSpecialDayAction = GAMEPLAY::FloodSpecialDayAction::CURRENT_DAY_ACTION_COMPLETED;
@@ -801,7 +833,7 @@ namespace STATES
                     BirdSentFromArk = OBJECTS::BirdSentFromArk(Hud.CurrentSpecialDayAction, OBJECTS::AnimalSpecies::DOVE);
                     BirdSentFromArk->Sprite.SetWorldPosition(world.NoahPlayer->GetWorldPosition());
                     BirdSentFromArk->Sprite.Play();
-                    gaming_hardware.Speakers->PlaySoundEffect(BirdSentFromArk->SoundId);
+                    gaming_hardware.SoundScheduler.Schedule(BirdSentFromArk->SoundId, BirdSentFromArk->Sprite.GetWorldPosition());
 
                     // CLEAR THE SPECIAL ACTION SINCE ALL SPECIAL ACTIONS HAVE BEEN COMPLETED.
                     Hud.CurrentSpecialDayAction = GAMEPLAY::FloodSpecialDayAction::CURRENT_DAY_ACTION_COMPLETED;
@@ -865,12 +897,13 @@ namespace STATES
                         if (bird_intersects_noah)
                         {
                             // The bird's sound effect is replayed first.
-                            gaming_hardware.Speakers->PlaySoundEffect(BirdSentFromArk->SoundId);
+                            gaming_hardware.SoundScheduler.Schedule(BirdSentFromArk->SoundId, BirdSentFromArk->Sprite.GetWorldPosition());
 
                             // If this is the 2nd time the dove was sent out, an olive leaf should be placed underneath Noah.
                             bool bird_returned_with_olive_leaf = (GAMEPLAY::FloodSpecialDayAction::SEND_OUT_DOVE_SECOND_TIME == BirdSentFromArk->ActionThatSentOutBird);
                             if (bird_returned_with_olive_leaf)
                             {
+                                current_tile_map->MarkChangedFromInitialState();
                                 current_tile_map->OliveLeaf = OBJECTS::OliveLeaf(noah_world_position);
                             }
 
@@ -1187,7 +1220,8 @@ namespace STATES
             // CHECK IF THE PLAYER STEPPED ON A PRESENT.
             MATH::FloatRectangle noah_bounding_box = world.NoahPlayer->GetWorldBoundingBox();
             for (auto present = current_tile_map.Presents.begin();
-                present != current_tile_map.Presents.end();)
+                present != current_tile_map.Presents.end();
+                ++present)
             {
                 // CHECK IF THE PLAYER STEPPED ON THE CURRENT PRESENT.
                 MATH::FloatRectangle present_bounding_box = present->Sprite.GetWorldBoundingBox();
@@ -1204,12 +1238,9 @@ namespace STATES
                     message_for_text_box = "You got a Bible verse!\n" + present->BibleVerse.ToString();
 
                     // REMOVE THE PRESENT FROM THE TILE MAP.
-                    present = current_tile_map.Presents.erase(present);
-                }
-                else
-                {
-                    // MOVE TO THE NEXT PRESENT.
-                    ++present;
+                    // Destroying the present doesn't affect iterating to the next present.
+                    current_tile_map.MarkChangedFromInitialState();
+                    current_tile_map.Presents.Destroy(present.GetHandle());
                 }
             }
 
@@ -12,6 +12,7 @@
 #include "States/BibleVerseMiniGame.h"
 #include "States/GameState.h"
 #include "States/SavedGameData.h"
+#include "States/SavedGameWriter.h"
 
 namespace STATES
 {
@@ -31,13 +32,15 @@ namespace STATES
             HARDWARE::GamingHardware& gaming_hardware,
             MAPS::World& world,
             GRAPHICS::Camera& camera,
-            STATES::SavedGameData& current_game_data);
+            STATES::SavedGameData& current_game_data,
+            STATES::SavedGameWriter& saved_game_writer);
 
         // RENDERING.
         sf::Sprite Render(
             MAPS::World& world, 
             STATES::SavedGameData& current_game_data,
-            GRAPHICS::Renderer& renderer);
+            GRAPHICS::Renderer& renderer,
+            HARDWARE::GamingHardware& gaming_hardware);
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The current map being displayed within the world.
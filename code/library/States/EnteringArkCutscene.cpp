@@ -32,7 +32,8 @@ namespace STATES
         }
 
         // SET THE GAME TO FOCUS ON THE ARK ENTRANCE.
-        ArkEntranceTileMap = world.Overworld.MapGrid.GetTileMap(MAPS::Overworld::ARK_ENTRANCE_TILE_MAP_ROW, MAPS::Overworld::ARK_ENTRANCE_TILE_MAP_COLUMN);
+        // Ark pieces will be built in the tile map, so it's retrieved in a way that tracks changes.
+        ArkEntranceTileMap = world.Overworld.MapGrid.GetTileMapForChanging(MAPS::Overworld::ARK_ENTRANCE_TILE_MAP_ROW, MAPS::Overworld::ARK_ENTRANCE_TILE_MAP_COLUMN);
         ASSERT_THEN_IF(ArkEntranceTileMap)
         {
             // SET THE CAMERA TO FOCUS ON THIS TILE MAP.
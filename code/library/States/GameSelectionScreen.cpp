@@ -1,6 +1,8 @@
 #include <algorithm>
 #include <cmath>
 #include <filesystem>
+#include <future>
+#include <optional>
 #include "Debugging/DebugConsole.h"
 #include "ErrorHandling/Asserts.h"
 #include "Graphics/Gui/Text.h"
@@ -8,6 +10,7 @@
 #include "Math/Rectangle.h"
 #include "Resources/AssetId.h"
 #include "States/GameSelectionScreen.h"
+#include "States/SavedGameJournal.h"
 
 namespace STATES
 {
@@ -18,9 +21,11 @@ namespace STATES
     {
         LoadSavedGames();
         CurrentSubState = GameSelectionScreen::SubState::LISTING_GAMES;
+        ScreenChanged = true;
     }
 
-    /// Loads any available saved games into the current state.
+    /// Loads summaries of any available saved games into the current state.
+    /// Summaries are loaded in parallel since each requires waiting on a separate file.
     void GameSelectionScreen::LoadSavedGames()
     {
         // CHECK IF THE SAVED GAMES FOLDER EXISTS.
@@ -31,37 +36,79 @@ namespace STATES
             return;
         }
 
-        // TRY LOADING SAVED GAMES FROM EACH FILE IN THE SAVED GAMES FOLDER.
-        // To avoid having saved games getting duplicated, the list of games should be cleared
-        // each time the saved games are newly loaded.
-        SavedGames.clear();
+        // START LOADING SUMMARIES FROM EACH FILE IN THE SAVED GAMES FOLDER.
+        std::vector<std::future<std::optional<SavedGameSummary>>> saved_game_summaries_being_loaded;
         for (const auto& file : std::filesystem::directory_iterator(SAVED_GAMES_FOLDER_PATH))
         {
             DEBUGGING::DebugConsole::WriteLine(file.path().string());
 
             // SKIP OVER ANY NON-FILES.
+            // Temporary files from saves in progress and journals are also skipped since they aren't complete saved games.
             const bool is_file = file.is_regular_file();
-            if (!is_file)
+            const bool is_temporary_file = (".tmp" == file.path().extension());
+            const bool is_journal_file = (SavedGameJournal::FILE_EXTENSION == file.path().extension().string());
+            if (!is_file || is_temporary_file || is_journal_file)
             {
                 continue;
             }
 
-            // TRY LOADING A SAVED GAME FROM THE FILE.
-            std::shared_ptr<SavedGameData> saved_game = SavedGameData::Load(file.path().string());
-            if (saved_game)
+            // START LOADING THE SUMMARY FROM THE FILE.
+            saved_game_summaries_being_loaded.emplace_back(std::async(std::launch::async, SavedGameData::LoadSummary, file.path()));
+        }
+
+        // COLLECT THE LOADED SUMMARIES.
+        // To avoid having saved games getting duplicated, the list of games should be cleared
+        // each time the saved games are newly loaded.  Summaries are kept in directory order.
+        SavedGames.clear();
+        for (std::future<std::optional<SavedGameSummary>>& saved_game_summary_being_loaded : saved_game_summaries_being_loaded)
+        {
+            std::optional<SavedGameSummary> saved_game_summary = saved_game_summary_being_loaded.get();
+            if (saved_game_summary)
             {
-                SavedGames.emplace_back(MEMORY::NonNullSharedPointer<SavedGameData>(saved_game));
+                SavedGames.emplace_back(*saved_game_summary);
             }
         }
     }
 
+    /// Fully loads the currently selected saved game.
+    /// @return The selected saved game; new saved game data if a new game (or a game that failed to load) is selected.
+    SavedGameData GameSelectionScreen::LoadSelectedGame() const
+    {
+        // CREATE NEW SAVED GAME DATA FOR NEW GAMES.
+        const SavedGameSummary& selected_game = SavedGames.at(SelectedGameIndex);
+        SavedGameData new_saved_game = SavedGameData::DefaultSavedGameData();
+        new_saved_game.Filepath = selected_game.Filepath;
+        if (selected_game.NewGame)
+        {
+            return new_saved_game;
+        }
+
+        // LOAD THE SAVED GAME.
+        std::unique_ptr<SavedGameData> saved_game = SavedGameData::Load(selected_game.Filepath);
+        if (!saved_game)
+        {
+            return new_saved_game;
+        }
+
+        return *saved_game;
+    }
+
     /// Updates the game selection screen based on elapsed time and user input.
     /// @param[in]  gaming_hardware - The hardware supplying input and output for the upate.
     /// @return The state the game should be after updating the game selection screen.
     GameState GameSelectionScreen::Update(const HARDWARE::GamingHardware& gaming_hardware)
     {
         // TRACK THE ELAPSED TIME.
+        // The placeholder for the next character of a new game's filename blinks over time.
+        bool next_character_placeholder_previously_blinked_on = NextCharacterPlaceholderBlinkedOn();
         ElapsedTime += gaming_hardware.Clock.ElapsedTimeSinceLastFrame;
+        bool next_character_placeholder_currently_blinked_on = NextCharacterPlaceholderBlinkedOn();
+        bool next_character_placeholder_blinked = (next_character_placeholder_previously_blinked_on != next_character_placeholder_currently_blinked_on);
+        bool user_entering_filename = (SubState::ENTERING_NEW_GAME == CurrentSubState);
+        if (user_entering_filename && next_character_placeholder_blinked)
+        {
+            ScreenChanged = true;
+        }
 
         // RESPOND TO INPUT BASED ON THE CURRENT STATE.
         switch (CurrentSubState)
@@ -89,6 +136,7 @@ namespace STATES
                         SelectedGameIndex,
                         MIN_SELECTED_GAME_INDEX,
                         max_selected_game_index);
+                    ScreenChanged = true;
                 }
 
                 bool down_button_pressed = gaming_hardware.InputController.ButtonWasPressed(sf::Keyboard::Down);
@@ -99,6 +147,7 @@ namespace STATES
                         SelectedGameIndex,
                         MIN_SELECTED_GAME_INDEX,
                         max_selected_game_index);
+                    ScreenChanged = true;
                 }
 
                 // CHECK IF THE MAIN 'START' BUTTON WAS PRESSED.
@@ -113,13 +162,14 @@ namespace STATES
                         // SWITCH TO ENTERING A NEW GAME NAME.
                         CurrentNewGameFilenameText.clear();
                         CurrentSubState = SubState::ENTERING_NEW_GAME;
+                        ScreenChanged = true;
                         return GameState::GAME_SELECTION_SCREEN;
                     }
                     else
                     {
                         // TRANSITION TO THE APPROPRIATE STATE FOR THE GAME.
-                        MEMORY::NonNullSharedPointer<SavedGameData>& selected_game = SavedGames[SelectedGameIndex];
-                        return selected_game->CurrentGameState;
+                        const SavedGameSummary& selected_game = SavedGames[SelectedGameIndex];
+                        return selected_game.CurrentGameState;
                     }
                 }
                 else
@@ -142,9 +192,13 @@ namespace STATES
                     }
                     else
                     {
-                        // CREATE THE NEW SAVED GAME DATA.
-                        auto new_saved_game = MEMORY::NonNullSharedPointer<SavedGameData>(std::make_shared<SavedGameData>(SavedGameData::DefaultSavedGameData()));
-                        new_saved_game->Filepath = SAVED_GAMES_FOLDER_PATH / CurrentNewGameFilenameText;
+                        // CREATE THE NEW SAVED GAME.
+                        // Its data is created once the game starts.
+                        SavedGameSummary new_saved_game =
+                        {
+                            .Filepath = SAVED_GAMES_FOLDER_PATH / CurrentNewGameFilenameText,
+                            .NewGame = true,
+                        };
                         SavedGames.push_back(new_saved_game);
 
                         // START THE INTRO SEQUENCE FOR A NEW GAME.
@@ -158,6 +212,7 @@ namespace STATES
                 {
                     // SWITCH BACK TO LISTING OTHER SAVED GAMES.
                     CurrentSubState = SubState::LISTING_GAMES;
+                    ScreenChanged = true;
                     return GameState::GAME_SELECTION_SCREEN;
                 }
 
@@ -170,6 +225,7 @@ namespace STATES
                     if (new_game_filename_populated)
                     {
                         CurrentNewGameFilenameText.pop_back();
+                        ScreenChanged = true;
                     }
                 }
                 // GET ANY VALID FILENAME CHARACTERS THAT HAVE BEEN PRESSED.
@@ -360,6 +416,7 @@ namespace STATES
                     if (filename_has_more_room)
                     {
                         CurrentNewGameFilenameText += current_key_character;
+                        ScreenChanged = true;
                     }
                 }
 
@@ -439,10 +496,11 @@ namespace STATES
             // RENDER AN OPTION FOR THE CURRENT SAVED GAME.
             /// @todo   Once standard C++ library with Visual Studio has appropriate last modified time/to-string
             ///     functionality, add last modified time here.
-            const std::shared_ptr<SavedGameData>& saved_game = SavedGames.at(saved_game_index);
-            std::string saved_game_filename = saved_game->Filepath.filename().string();
+            // The summary of the game is shown on the line below the filename.
+            const SavedGameSummary& saved_game = SavedGames.at(saved_game_index);
+            std::string saved_game_text = saved_game.Filepath.filename().string() + "\n" + saved_game.ToString();
             renderer.RenderTextInBorderedBox(
-                saved_game_filename,
+                saved_game_text,
                 RESOURCES::AssetId::FONT_TEXTURE,
                 GAME_OPTION_TEXT_COLOR,
                 TEXT_OFFSET_FROM_BORDER_IN_PIXELS,
@@ -502,14 +560,7 @@ namespace STATES
         if (user_can_type_more_characters_for_new_game)
         {
             // SEE IF AN UNDERSCORE SHOULD BE RENDERED.
-            // It blinks based on a sine curve for a smooth indication of interactivity.
-            constexpr float PI = 3.14159f;
-            constexpr float SINE_WAVE_PERIOD = 2.0f * PI;
-            constexpr float CURSOR_PERIOD_IN_SECONDS = 1.0f;
-            float elapsed_time_ratio = static_cast<float>(ElapsedTime.asSeconds()) / CURSOR_PERIOD_IN_SECONDS;
-            float elapsed_time_converted_to_angle_range_within_one_circle = elapsed_time_ratio * SINE_WAVE_PERIOD;
-            float sine_of_elapsed_time = std::sinf(elapsed_time_converted_to_angle_range_within_one_circle);
-            bool next_character_placeholder_visible = (sine_of_elapsed_time < 0.0f);
+            bool next_character_placeholder_visible = NextCharacterPlaceholderBlinkedOn();
             if (next_character_placeholder_visible)
             {
                 // GET THE FONT FOR COMPUTING TEXT WIDTH.
@@ -564,4 +615,19 @@ namespace STATES
         sf::Sprite screen = renderer.RenderFinalScreen();
         return screen;
     }
+
+    /// Determines if the placeholder for the next character of a new game's filename is currently blinked on.
+    /// It blinks based on a sine curve for a smooth indication of interactivity.
+    /// @return True if the placeholder should be visible based on the elapsed time; false otherwise.
+    bool GameSelectionScreen::NextCharacterPlaceholderBlinkedOn() const
+    {
+        constexpr float PI = 3.14159f;
+        constexpr float SINE_WAVE_PERIOD = 2.0f * PI;
+        constexpr float CURSOR_PERIOD_IN_SECONDS = 1.0f;
+        float elapsed_time_ratio = static_cast<float>(ElapsedTime.asSeconds()) / CURSOR_PERIOD_IN_SECONDS;
+        float elapsed_time_converted_to_angle_range_within_one_circle = elapsed_time_ratio * SINE_WAVE_PERIOD;
+        float sine_of_elapsed_time = std::sinf(elapsed_time_converted_to_angle_range_within_one_circle);
+        bool next_character_placeholder_blinked_on = (sine_of_elapsed_time < 0.0f);
+        return next_character_placeholder_blinked_on;
+    }
 }
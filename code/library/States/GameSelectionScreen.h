@@ -6,9 +6,9 @@
 #include <SFML/System.hpp>
 #include "Graphics/Renderer.h"
 #include "Hardware/GamingHardware.h"
-#include "Memory/Pointers.h"
 #include "States/GameState.h"
 #include "States/SavedGameData.h"
+#include "States/SavedGameSummary.h"
 
 namespace STATES
 {
@@ -38,6 +38,7 @@ namespace STATES
 
         void Load();
         void LoadSavedGames();
+        SavedGameData LoadSelectedGame() const;
 
         GameState Update(const HARDWARE::GamingHardware& gaming_hardware);
         sf::Sprite Render(GRAPHICS::Renderer& renderer) const;
@@ -50,7 +51,15 @@ namespace STATES
         std::string CurrentNewGameFilenameText = "";
         /// The index of the saved game that is currently selected.
         std::size_t SelectedGameIndex = 0;
-        /// The saved games available for the player to select.
-        std::vector<MEMORY::NonNullSharedPointer<SavedGameData>> SavedGames = {};
+        /// Summaries of the saved games available for the player to select.
+        /// Only summaries are loaded for listing games; the full saved game is only loaded once selected.
+        std::vector<SavedGameSummary> SavedGames = {};
+        /// True if anything shown on the game selection screen has changed since it was last rendered.
+        /// Cleared once the screen has been rendered.
+        bool ScreenChanged = true;
+
+    private:
+        // HELPERS.
+        bool NextCharacterPlaceholderBlinkedOn() const;
     };
 }
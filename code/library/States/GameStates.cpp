@@ -51,14 +51,16 @@ namespace STATES
                     gaming_hardware,
                     world,
                     camera,
-                    CurrentSavedGame);
+                    CurrentSavedGame,
+                    SavedGameWriter);
                 break;
             case GameState::DURING_FLOOD_GAMEPLAY:
                 next_game_state = DuringFloodGameplayState.Update(
                     gaming_hardware,
                     world,
                     camera,
-                    CurrentSavedGame);
+                    CurrentSavedGame,
+                    SavedGameWriter);
                 break;
             case GameState::POST_FLOOD_GAMEPLAY:
                 next_game_state = PostFloodGameplayState.Update(
@@ -72,6 +74,17 @@ namespace STATES
                 break;
         }
 
+        // AUTOSAVE DURING GAMEPLAY.
+        // Only gameplay states where the player can save are autosaved.
+        bool game_can_be_saved = (
+            GameState::PRE_FLOOD_GAMEPLAY == CurrentSavedGame.CurrentGameState ||
+            GameState::DURING_FLOOD_GAMEPLAY == CurrentSavedGame.CurrentGameState);
+        if (game_can_be_saved)
+        {
+            SavedGameWriter.UpdateAutosave(gaming_hardware.Clock.ElapsedTimeSinceLastFrame, CurrentSavedGame);
+        }
+        SavedGameWriter.DispatchCompletedSaves();
+
         // RETURN THE NEXT STATE THE GAME SHOULD BE IN.
         return next_game_state;
     }
@@ -86,53 +99,57 @@ namespace STATES
         GRAPHICS::Renderer& renderer,
         HARDWARE::GamingHardware& gaming_hardware)
     {
-        // CLEAR THE SCREEN OF THE PREVIOUSLY RENDERED FRAME.
-        renderer.Screen->Clear();
-
-        // RENDER THE CURRENT GAME STATE.
-        sf::Sprite screen_sprite;
+        // CHECK IF THE CURRENT STATE IS A MOSTLY STATIC SCREEN.
+        // Such screens typically only change in small regions between frames (like when a menu option
+        // is selected), so only regions that changed need to be redrawn.  Rendering these screens
+        // doesn't change them, so they can be rendered once to record what changed on the screen
+        // and then rendered again to only redraw changed regions.  These screens also track when
+        // anything shown on them changes so that they don't need to be rendered at all otherwise.
+        bool* static_screen_changed = nullptr;
         switch (CurrentSavedGame.CurrentGameState)
         {
-            case GameState::INTRO_SEQUENCE:
-                screen_sprite = IntroSequence.Render(renderer);
-                break;
             case GameState::TITLE_SCREEN:
-                screen_sprite = TitleScreen.Render(renderer);
+                static_screen_changed = &TitleScreen.ScreenChanged;
                 break;
             case GameState::CREDITS_SCREEN:
-                screen_sprite = CreditsScreen.Render(renderer);
+                static_screen_changed = &CreditsScreen.ScreenChanged;
                 break;
             case GameState::NOTICE_SCREEN:
-                screen_sprite = NoticeScreen.Render(renderer);
+                static_screen_changed = &NoticeScreen.ScreenChanged;
                 break;
             case GameState::GAME_SELECTION_SCREEN:
-                screen_sprite = GameSelectionScreen.Render(renderer);
+                static_screen_changed = &GameSelectionScreen.ScreenChanged;
                 break;
-            case GameState::NEW_GAME_INTRO_SEQUENCE:
-                screen_sprite = NewGameIntroSequence.Render(renderer);
-                break;
-            case GameState::NEW_GAME_INSTRUCTION_SEQUENCE:
-                screen_sprite = NewGameInstructionSequence.Render(world, renderer, gaming_hardware);
-                break;
-            case GameState::ENTER_ARK_CUTSCENE:
-                screen_sprite = EnteringArkCutscene.Render(world, renderer);
-                break;
-            case GameState::FLOOD_CUTSCENE:
-                screen_sprite = FloodCutscene.Render(renderer, gaming_hardware);
-                break;
-            case GameState::PRE_FLOOD_GAMEPLAY:
-                screen_sprite = PreFloodGameplayState.Render(world, CurrentSavedGame, renderer);
-                break;
-            case GameState::DURING_FLOOD_GAMEPLAY:
-                screen_sprite = DuringFloodGameplayState.Render(world, CurrentSavedGame, renderer);
-                break;
-            case GameState::POST_FLOOD_GAMEPLAY:
-                screen_sprite = PostFloodGameplayState.Render(world, renderer, gaming_hardware);
-                break;
-            case GameState::ENDING_CREDITS_SCREEN:
-                screen_sprite = EndingCreditsScreen.Render(renderer);
+            default:
+                // Other states change too much between frames to track changes.
                 break;
         }
+        bool current_state_mostly_static = (nullptr != static_screen_changed);
+        if (current_state_mostly_static)
+        {
+            // KEEP THE PREVIOUS SCREEN IF NOTHING CHANGED.
+            // The screen still needs to be rendered if it was last drawn without tracking changes.
+            bool screen_needs_rendering = (*static_screen_changed || renderer.ScreenChanges.AllDirty);
+            if (!screen_needs_rendering)
+            {
+                sf::Sprite retained_screen_sprite = renderer.RetainPreviousScreen();
+                return retained_screen_sprite;
+            }
+            *static_screen_changed = false;
+
+            // CLEAR ONLY THE REGIONS OF THE SCREEN THAT CHANGED.
+            renderer.BeginRecordingScreenChanges();
+            RenderCurrentState(world, renderer, gaming_hardware);
+            renderer.BeginRedrawingChangedScreenRegions();
+        }
+        else
+        {
+            // CLEAR THE SCREEN OF THE PREVIOUSLY RENDERED FRAME.
+            renderer.BeginFullScreenRedraw();
+        }
+
+        // RENDER THE CURRENT GAME STATE.
+        sf::Sprite screen_sprite = RenderCurrentState(world, renderer, gaming_hardware);
         return screen_sprite;
     }
 
@@ -167,7 +184,7 @@ namespace STATES
             // switching between states in debug mode.
             if (!GameSelectionScreen.SavedGames.empty())
             {
-                CurrentSavedGame = *GameSelectionScreen.SavedGames.at(GameSelectionScreen.SelectedGameIndex);
+                CurrentSavedGame = GameSelectionScreen.LoadSelectedGame();
             }
 
             // UPDATE NOAH PLAYER INFORMATION.
@@ -185,10 +202,15 @@ namespace STATES
             case GameState::CREDITS_SCREEN:
                 CreditsScreen.Load();
                 break;
+            case GameState::TITLE_SCREEN:
+                TitleScreen.ScreenChanged = true;
+                break;
             case GameState::NOTICE_SCREEN:
-                // Nothing needs to be done when switching to this state.
+                NoticeScreen.ScreenChanged = true;
                 break;
             case GameState::GAME_SELECTION_SCREEN:
+                // Any saves still being written need to finish for the latest saved games to be listed.
+                SavedGameWriter.WaitForPendingSaves();
                 GameSelectionScreen.Load();
                 break;
             case GameState::NEW_GAME_INTRO_SEQUENCE:
@@ -221,4 +243,60 @@ namespace STATES
                 break;
         }
     }
+
+    /// Renders the current state of the game, without any setup of the screen.
+    /// @param[in,out]  world - The game world to potentially render.
+    /// @param[in,out]  renderer - The renderer to use for rendering.
+    /// @param[in,out]  gaming_hardware - The gaming hardware supplying input and output devices.
+    /// @return The rendered state of the game.
+    sf::Sprite GameStates::RenderCurrentState(
+        MAPS::World& world,
+        GRAPHICS::Renderer& renderer,
+        HARDWARE::GamingHardware& gaming_hardware)
+    {
+        sf::Sprite screen_sprite;
+        switch (CurrentSavedGame.CurrentGameState)
+        {
+            case GameState::INTRO_SEQUENCE:
+                screen_sprite = IntroSequence.Render(renderer);
+                break;
+            case GameState::TITLE_SCREEN:
+                screen_sprite = TitleScreen.Render(renderer);
+                break;
+            case GameState::CREDITS_SCREEN:
+                screen_sprite = CreditsScreen.Render(renderer);
+                break;
+            case GameState::NOTICE_SCREEN:
+                screen_sprite = NoticeScreen.Render(renderer);
+                break;
+            case GameState::GAME_SELECTION_SCREEN:
+                screen_sprite = GameSelectionScreen.Render(renderer);
+                break;
+            case GameState::NEW_GAME_INTRO_SEQUENCE:
+                screen_sprite = NewGameIntroSequence.Render(renderer);
+                break;
+            case GameState::NEW_GAME_INSTRUCTION_SEQUENCE:
+                screen_sprite = NewGameInstructionSequence.Render(world, renderer, gaming_hardware);
+                break;
+            case GameState::ENTER_ARK_CUTSCENE:
+                screen_sprite = EnteringArkCutscene.Render(world, renderer);
+                break;
+            case GameState::FLOOD_CUTSCENE:
+                screen_sprite = FloodCutscene.Render(renderer, gaming_hardware);
+                break;
+            case GameState::PRE_FLOOD_GAMEPLAY:
+                screen_sprite = PreFloodGameplayState.Render(world, CurrentSavedGame, renderer, gaming_hardware);
+                break;
+            case GameState::DURING_FLOOD_GAMEPLAY:
+                screen_sprite = DuringFloodGameplayState.Render(world, CurrentSavedGame, renderer, gaming_hardware);
+                break;
+            case GameState::POST_FLOOD_GAMEPLAY:
+                screen_sprite = PostFloodGameplayState.Render(world, renderer, gaming_hardware);
+                break;
+            case GameState::ENDING_CREDITS_SCREEN:
+                screen_sprite = EndingCreditsScreen.Render(renderer);
+                break;
+        }
+        return screen_sprite;
+    }
 }
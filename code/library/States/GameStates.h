@@ -19,6 +19,7 @@
 #include "States/NoticeScreen.h"
 #include "States/PostFloodGameplayState.h"
 #include "States/PreFloodGameplayState.h"
+#include "States/SavedGameWriter.h"
 #include "States/TitleScreen.h"
 
 namespace STATES
@@ -44,6 +45,8 @@ namespace STATES
 
         /// The current saved game being used.
         SavedGameData CurrentSavedGame = SavedGameData::DefaultSavedGameData();
+        /// The writer for saving games in the background, including periodic autosaves during gameplay.
+        SavedGameWriter SavedGameWriter;
         /// The intro sequence for the game.
         IntroSequence IntroSequence = {};
         /// The title screen for the game.
@@ -70,5 +73,12 @@ namespace STATES
         PostFloodGameplayState PostFloodGameplayState = {};
         /// The ending credits screen.
         EndingCreditsScreen EndingCreditsScreen = {};
+
+    private:
+        // RENDERING.
+        sf::Sprite RenderCurrentState(
+            MAPS::World& world,
+            GRAPHICS::Renderer& renderer,
+            HARDWARE::GamingHardware& gaming_hardware);
     };
 }
@@ -14,5 +14,9 @@ namespace STATES
     public:
         GameState Update(const HARDWARE::GamingHardware& gaming_hardware);
         sf::Sprite Render(GRAPHICS::Renderer& renderer) const;
+
+        /// True if anything shown on the notice screen has changed since it was last rendered.
+        /// Nothing on the screen changes while it's shown, so this only needs to be set when switching to it.
+        bool ScreenChanged = true;
     };
 }
@@ -35,7 +35,8 @@ namespace STATES
         CurrentMapGrid = &world.Overworld.MapGrid;
 
         // SET THE GAME TO FOCUS ON THE ARK ENTRANCE.
-        MAPS::TileMap* ark_entrace_tile_map = world.Overworld.MapGrid.GetTileMap(MAPS::Overworld::ARK_ENTRANCE_TILE_MAP_ROW, MAPS::Overworld::ARK_ENTRANCE_TILE_MAP_COLUMN);
+        // Animals will be added to the tile map, so it's retrieved in a way that tracks changes.
+        MAPS::TileMap* ark_entrace_tile_map = world.Overworld.MapGrid.GetTileMapForChanging(MAPS::Overworld::ARK_ENTRANCE_TILE_MAP_ROW, MAPS::Overworld::ARK_ENTRANCE_TILE_MAP_COLUMN);
         ASSERT_THEN_IF(ark_entrace_tile_map)
         {
             // SET THE CAMERA TO FOCUS ON THIS TILE MAP.
@@ -133,7 +134,7 @@ namespace STATES
                             // RANDOMLY POSITION THE ANIMAL.
                             float random_animal_x_position = gaming_hardware.RandomNumberGenerator.RandomInRange<float>(min_animal_world_x_position, max_animal_world_x_position);
                             float random_animal_y_position = gaming_hardware.RandomNumberGenerator.RandomInRange<float>(min_animal_world_y_position, max_animal_world_y_position);
-                            std::shared_ptr<MAPS::Tile> tile = world.Overworld.MapGrid.GetTileAtWorldPosition(
+                            const MAPS::Tile* tile = world.Overworld.MapGrid.GetTileAtWorldPosition(
                                 random_animal_x_position,
                                 random_animal_y_position);
                             // If the tile is not walkable, then the animal just won't be placed.
@@ -293,10 +294,7 @@ namespace STATES
                     }
 
                     // Dust clouds should be animated too.
-                    for (auto& dust_cloud : current_tile_map->DustClouds)
-                    {
-                        dust_cloud.Update(gaming_hardware.Clock.ElapsedTimeSinceLastFrame);
-                    }
+                    current_tile_map->Entities.Update(gaming_hardware.Clock.ElapsedTimeSinceLastFrame);
                 }
 
                 // DISPLAY GOD'S WORDS, ALLOWING THE USER TO MOVE TO DIFFERENT PAGES OF TEXT.
@@ -376,10 +374,7 @@ namespace STATES
                     }
 
                     // Dust clouds should be animated too.
-                    for (auto& dust_cloud : current_tile_map->DustClouds)
-                    {
-                        dust_cloud.Update(gaming_hardware.Clock.ElapsedTimeSinceLastFrame);
-                    }
+                    current_tile_map->Entities.Update(gaming_hardware.Clock.ElapsedTimeSinceLastFrame);
                 }
 
                 // DISPLAY GOD'S WORDS, ALLOWING THE USER TO MOVE TO DIFFERENT PAGES OF TEXT.
@@ -480,14 +475,7 @@ namespace STATES
                 }
 
                 // RENDER THE CURRENT TILE MAP'S DUST CLOUDS.
-                for (auto& dust_cloud : current_tile_map->DustClouds)
-                {
-                    bool dust_cloud_visible = !dust_cloud.HasDisappeared();
-                    if (dust_cloud_visible)
-                    {
-                        renderer.Render(dust_cloud.Sprite.CurrentFrameSprite);
-                    }
-                }
+                renderer.Render(current_tile_map->Entities, OBJECTS::EntityKind::DUST_CLOUD);
             }
         }
 
@@ -688,6 +676,10 @@ namespace STATES
         GRAPHICS::Camera& camera,
         STATES::SavedGameData& current_game_data)
     {
+        // KEEP TILE MAPS AROUND WHERE THE CAMERA IS GOING RESIDENT.
+        // If the camera is scrolling, this starts loading tile maps around the new tile map before the camera gets there.
+        map_grid.UpdateResidency(camera.GetDestinationCenter());
+
         // GET THE CURRENT TILE MAP.
         MATH::FloatRectangle camera_bounds = camera.ViewBounds;
         MATH::Vector2f camera_view_center = camera_bounds.Center();
@@ -766,6 +758,7 @@ namespace STATES
                     if (ark_can_be_built_on_tile)
                     {
                         // BUILD THE ALTAR.
+                        current_tile_map.MarkChangedFromInitialState();
                         current_tile_map.Altar = OBJECTS::Altar(altar_center_world_position);
 
                         // ADD SOME DUST CLOUDS FOR THE ALTAR BEING BUILT.
@@ -773,8 +766,6 @@ namespace STATES
                         for (unsigned int dust_cloud_index = 0; dust_cloud_index < DUST_CLOUD_COUNT; ++dust_cloud_index)
                         {
                             // RANDOMLY ADD THE DUST CLOUD NEAR THE ALTAR.
-                            OBJECTS::DustCloud dust_cloud(RESOURCES::AssetId::DUST_CLOUD_TEXTURE);
-
                             constexpr float DUST_CLOUD_POSITION_MAX_OFFSET = 16.0f;
                             float dust_cloud_x_offset = gaming_hardware.RandomNumberGenerator.RandomInRange<float>(-DUST_CLOUD_POSITION_MAX_OFFSET, DUST_CLOUD_POSITION_MAX_OFFSET);
                             float dust_cloud_y_offset = gaming_hardware.RandomNumberGenerator.RandomInRange<float>(-DUST_CLOUD_POSITION_MAX_OFFSET, DUST_CLOUD_POSITION_MAX_OFFSET);
@@ -782,12 +773,9 @@ namespace STATES
                             MATH::Vector2f dust_cloud_world_position = altar_center_world_position;
                             dust_cloud_world_position.X += dust_cloud_x_offset;
                             dust_cloud_world_position.Y += dust_cloud_y_offset;
-                            dust_cloud.Sprite.SetWorldPosition(dust_cloud_world_position);
-
-                            // The dust cloud should start animating immediately.
-                            dust_cloud.Sprite.Play();
 
-                            current_tile_map.DustClouds.push_back(dust_cloud);
+                            // The dust cloud starts animating immediately.
+                            current_tile_map.Entities.AddDustCloud(dust_cloud_world_position);
                         }
                     }
                 }
@@ -804,6 +792,7 @@ namespace STATES
                 if (player_facing_altar)
                 {
                     // MAKE OFFERINGS.
+                    current_tile_map.MarkChangedFromInitialState();
                     current_tile_map.Altar->OfferingSmoke.Sprite.CurrentFrameSprite.IsVisible = true;
                     current_tile_map.Altar->OfferingSmoke.Sprite.Play();
                 }
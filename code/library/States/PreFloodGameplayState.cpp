@@ -76,7 +76,7 @@ namespace STATES
                 
                 // CHECK IF A WALKABLE TILE EXISTS AT THAT RANDOM LOCATION.
                 // If a walkable tile doesn't exist, we'll just continue trying a different location.
-                std::shared_ptr<MAPS::Tile> tile = world.Overworld.MapGrid.GetTileAtWorldPosition(
+                const MAPS::Tile* tile = world.Overworld.MapGrid.GetTileAtWorldPosition(
                     family_member_x_position,
                     family_member_y_position);
                 bool tile_is_walkable = (tile && tile->IsWalkable());
@@ -112,12 +112,15 @@ namespace STATES
     /// @param[in,out]  gaming_hardware - The gaming hardware supplying input and output for the update.
     /// @param[in,out]  world - The world to update based on gameplay.
     /// @param[in,out]  camera - The camera to be updated based on player actions during this frame.
+    /// @param[in,out]  current_game_data - The current game data to use and update.
+    /// @param[in,out]  saved_game_writer - The writer for saving the game in the background.
     /// @return The next game state after updating.
     GameState PreFloodGameplayState::Update(
         HARDWARE::GamingHardware& gaming_hardware,
         MAPS::World& world,
         GRAPHICS::Camera& camera,
-        STATES::SavedGameData& current_game_data)
+        STATES::SavedGameData& current_game_data,
+        STATES::SavedGameWriter& saved_game_writer)
     {
 #ifdef _DEBUG
         // UPDATE THE TILE MAP EDITOR IN RESPONSE TO USER INPUT.
@@ -145,7 +148,7 @@ namespace STATES
 
         // UPDATE THE HUD.
         // As of now, the HUD is capable of altering the gameplay state.
-        auto [next_game_state, dropped_food_type] = Hud.Update(current_game_data, gaming_hardware);
+        auto [next_game_state, dropped_food_type] = Hud.Update(current_game_data, gaming_hardware, saved_game_writer);
 
         // CHECK IF A TYPE OF FOOD WAS SELECTED FOR DROPPING.
         bool food_selected_for_dropping = (OBJECTS::Food::NONE != dropped_food_type);
@@ -183,10 +186,10 @@ namespace STATES
                 .Count = 1,
                 .Sprite = *food_sprite
             };
-            MAPS::TileMap* current_tile_map = CurrentMapGrid->GetTileMap(food_sprite->WorldPosition.X, food_sprite->WorldPosition.Y);
+            MAPS::TileMap* current_tile_map = CurrentMapGrid->GetTileMapForChanging(food_sprite->WorldPosition.X, food_sprite->WorldPosition.Y);
             ASSERT_THEN_IF(current_tile_map)
             {
-                current_tile_map->FoodOnGround.push_back(food);
+                current_tile_map->Entities.AddFood(food);
             }
 
             // REMOVE THE FOOD FROM THE PLAYER'S INVENTORY SINCE IT IS NOW ON THE GROUND.
@@ -241,11 +244,13 @@ namespace STATES
     /// Renders the current frame of the gameplay state.
     /// @param[in]  world - The world to render.
     /// @param[in,out]  renderer - The renderer to use for rendering.
+    /// @param[in]  gaming_hardware - The gaming hardware.
     /// @return The rendered gameplay state.
     sf::Sprite PreFloodGameplayState::Render(
         MAPS::World& world, 
         STATES::SavedGameData& current_game_data,
-        GRAPHICS::Renderer& renderer)
+        GRAPHICS::Renderer& renderer,
+        HARDWARE::GamingHardware& gaming_hardware)
     {
         // RENDER CONTENT SPECIFIC TO THE CURRENT MAP.
         renderer.Render(*CurrentMapGrid);
@@ -336,7 +341,7 @@ namespace STATES
                 // White is more readable on-top of the black borders around the ark interior.
                 hud_text_color = GRAPHICS::Color::WHITE;
             }
-            Hud.Render(current_game_data, hud_text_color, renderer);
+            Hud.Render(current_game_data, hud_text_color, renderer, *gaming_hardware.FrameArena);
         }
 
         // RENDER THE FINAL SCREEN WITH TIME-OF-DAY LIGHTING.
@@ -357,6 +362,10 @@ namespace STATES
         GRAPHICS::Camera& camera,
         STATES::SavedGameData& current_game_data)
     {
+        // KEEP TILE MAPS AROUND WHERE THE CAMERA IS GOING RESIDENT.
+        // If the camera is scrolling, this starts loading tile maps around the new tile map before the camera gets there.
+        map_grid.UpdateResidency(camera.GetDestinationCenter());
+
         // GET THE CURRENT TILE MAP.
         MATH::FloatRectangle camera_bounds = camera.ViewBounds;
         MATH::Vector2f camera_view_center = camera_bounds.Center();
@@ -432,7 +441,7 @@ namespace STATES
                 std::string message_for_text_box;
                 CollectWoodAndBibleVersesCollidingWithPlayer(*current_tile_map, map_grid, world, *gaming_hardware.Speakers, current_game_data, message_for_text_box);
                 CollectFoodCollidingWithPlayer(world, *current_tile_map, *gaming_hardware.Speakers);
-                CollectAnimalsCollidingWithPlayer(world, *current_tile_map, *gaming_hardware.Speakers, current_game_data);
+                CollectAnimalsCollidingWithPlayer(world, *current_tile_map, gaming_hardware.SoundScheduler, current_game_data);
 
                 // Family members exist outside of a map grid and need to be updated separately.
                 // Noah's bounding box is retrieved before the loop below to avoid repeated calculations.
@@ -499,7 +508,7 @@ namespace STATES
             gaming_hardware.Clock.ElapsedTimeSinceLastFrame,
             world,
             camera,
-            *gaming_hardware.Speakers,
+            gaming_hardware.SoundScheduler,
             gaming_hardware.InputController,
             *current_tile_map,
             current_game_data);
@@ -856,23 +865,17 @@ namespace STATES
                 --world.NoahPlayer->Inventory.WoodCount;
 
                 // BUILD THE ARK PIECE.
+                tile_map_underneath_noah->MarkChangedFromInitialState();
                 ark_piece->Built = true;
 
                 // The ark piece needs to be tracked in the saved game data.
                 game_data.BuiltArkPieces.emplace_back(*ark_piece);
 
                 // When building an ark piece, a dust cloud should appear.
-                OBJECTS::DustCloud dust_cloud(RESOURCES::AssetId::DUST_CLOUD_TEXTURE);
-
-                // The dust cloud should be positioned over the ark piece.
+                // The dust cloud should be positioned over the ark piece and start animating immediately.
+                // It needs to be added to the tile map so that it gets updated.
                 MATH::Vector2f dust_cloud_center_world_position = ark_piece->Sprite.WorldPosition;
-                dust_cloud.Sprite.SetWorldPosition(dust_cloud_center_world_position);
-
-                // The dust cloud should start animating immediately.
-                dust_cloud.Sprite.Play();
-
-                // The dust cloud needs to be added to the tile map so that it gets updated.
-                tile_map_underneath_noah->DustClouds.push_back(dust_cloud);
+                tile_map_underneath_noah->Entities.AddDustCloud(dust_cloud_center_world_position);
 
                 // Play a sound to indicate a piece of the ark is being built.
                 speakers.PlaySoundEffect(RESOURCES::AssetId::ARK_BUILDING_SOUND);
@@ -928,10 +931,18 @@ namespace STATES
 
         // HANDLE PLAYER COLLISIONS WITH WOOD LOGS.
         COLLISION::CollisionDetectionAlgorithms::HandleAxeSwings(map_grid, map_grid.AxeSwings, speakers);
-        for (auto wood_logs = tile_map.WoodLogs.begin(); wood_logs != tile_map.WoodLogs.end();)
+        for (std::size_t entity_index = 0; entity_index < tile_map.Entities.Count();)
         {
+            // SKIP ANY ENTITIES THAT AREN'T WOOD LOGS.
+            bool is_wood_logs = (OBJECTS::EntityKind::WOOD_LOGS == tile_map.Entities.Kinds[entity_index]);
+            if (!is_wood_logs)
+            {
+                ++entity_index;
+                continue;
+            }
+
             // CHECK IF THE WOOD LOGS INTERSECT WITH NOAH.
-            MATH::FloatRectangle wood_log_bounding_box = wood_logs->GetWorldBoundingBox();
+            const MATH::FloatRectangle& wood_log_bounding_box = tile_map.Entities.WorldBoundingBoxes[entity_index];
             MATH::FloatRectangle noah_bounding_box = world.NoahPlayer->GetWorldBoundingBox();
             bool noah_collided_with_wood_logs = noah_bounding_box.Contains(
                 wood_log_bounding_box.CenterX(),
@@ -945,7 +956,9 @@ namespace STATES
                 world.NoahPlayer->Inventory.AddWood(WOOD_COUNT);
 
                 // REMOVE THE WOOD LOGS SINCE THEY'VE BEEN COLLECTED BY NOAH.
-                wood_logs = tile_map.WoodLogs.erase(wood_logs);
+                // The next entity to check is moved into the same index.
+                tile_map.MarkChangedFromInitialState();
+                tile_map.Entities.Remove(entity_index);
 
                 // SEE IF A BIBLE VERSE SHOULD BE COLLECTED ALONG WITH THE WOOD.
                 // There should be a random chance that a Bible verse can be collected.
@@ -982,7 +995,7 @@ namespace STATES
             else
             {
                 // MOVE TO CHECKING COLLISIONS WITH THE NEXT SET OF WOOD LOGS.
-                ++wood_logs;
+                ++entity_index;
             }
         }
     }
@@ -998,11 +1011,18 @@ namespace STATES
         AUDIO::Speakers& speakers)
     {
         // HANDLE PLAYER COLLISIONS WITH FOOD.
-        for (auto food = tile_map.FoodOnGround.cbegin();
-            food != tile_map.FoodOnGround.cend();)
+        for (std::size_t entity_index = 0; entity_index < tile_map.Entities.Count();)
         {
+            // SKIP ANY ENTITIES THAT AREN'T FOOD.
+            bool is_food = (OBJECTS::EntityKind::FOOD == tile_map.Entities.Kinds[entity_index]);
+            if (!is_food)
+            {
+                ++entity_index;
+                continue;
+            }
+
             // CHECK IF THE CURRENT FOOD ITEM INTERSECTS WITH THE PLAYER.
-            MATH::FloatRectangle food_bounding_box = food->Sprite.GetWorldBoundingBox();
+            const MATH::FloatRectangle& food_bounding_box = tile_map.Entities.WorldBoundingBoxes[entity_index];
             MATH::FloatRectangle noah_bounding_box = world.NoahPlayer->GetWorldBoundingBox();
             bool food_intersects_with_noah = food_bounding_box.Intersects(noah_bounding_box);
             if (food_intersects_with_noah)
@@ -1011,17 +1031,18 @@ namespace STATES
                 speakers.PlaySoundEffect(RESOURCES::AssetId::FOOD_PICKUP_SOUND);
 
                 // ADD THE FOOD TO THE PLAYER'S INVENTORY.
-                DEBUGGING::DebugConsole::WriteLine("Collected food: ", static_cast<int>(food->Type));
-                world.NoahPlayer->Inventory.AddFood(*food);
+                DEBUGGING::DebugConsole::WriteLine("Collected food: ", static_cast<int>(tile_map.Entities.FoodTypes[entity_index]));
+                world.NoahPlayer->Inventory.AddFood(tile_map.Entities.GetFood(entity_index));
 
                 // REMOVE THE FOOD ITEM FROM THOSE IN THE CURRENT TILE MAP.
-                // This should move to the next food ITEM.
-                food = tile_map.FoodOnGround.erase(food);
+                // The next entity to check is moved into the same index.
+                tile_map.MarkChangedFromInitialState();
+                tile_map.Entities.Remove(entity_index);
             }
             else
             {
                 // MOVE TO CHECKING COLLISIONS FOR THE NEXT FOOD ITEM.
-                ++food;
+                ++entity_index;
             }
         }
     }
@@ -1030,11 +1051,11 @@ namespace STATES
     /// If so, the animals are added to the player's inventory.
     /// @param[in,out]  world - The world containing the tile map.
     /// @param[in,out]  tile_map - The tile map to examine animals in.
-    /// @param[in,out]  speakers - The speakers from which to play any audio.
+    /// @param[in,out]  sound_scheduler - The scheduler for any animal sounds.
     void PreFloodGameplayState::CollectAnimalsCollidingWithPlayer(
         MAPS::World& world, 
         MAPS::TileMap& tile_map, 
-        AUDIO::Speakers& speakers,
+        AUDIO::SoundEventScheduler& sound_scheduler,
         STATES::SavedGameData& current_game_data)
     {
         // HANDLE PLAYER COLLISIONS WITH ANIMALS.
@@ -1048,7 +1069,7 @@ namespace STATES
             if (animal_intersects_with_noah)
             {
                 // PLAY THE ANIMAL'S SOUND EFFECT, IF ONE EXISTS.
-                speakers.PlaySoundEffect((*animal)->SoundId);
+                sound_scheduler.Schedule((*animal)->SoundId, (*animal)->Sprite.GetWorldPosition());
 
                 // ADD THE ANIMAL TO THE PLAYER'S INVENTORY.
                 DEBUGGING::DebugConsole::WriteLine("Collected animal.");
@@ -1060,6 +1081,7 @@ namespace STATES
 
                 // REMOVE THE ANIMAL FROM THOSE IN THE CURRENT TILE MAP.
                 // This should move to the next animal.
+                tile_map.MarkChangedFromInitialState();
                 animal = tile_map.RoamingAnimals.erase(animal);
             }
             else
@@ -1075,7 +1097,7 @@ namespace STATES
     /// @param[in]  elapsed_time - The elapsed time by which to update the camera.
     /// @param[in,out]  world - The world being viewed.
     /// @param[in,out]  camera - The camera to update.
-    /// @param[in,out]  speakers - The speakers from which to play any audio.
+    /// @param[in,out]  sound_scheduler - The scheduler for any animal sounds.
     /// @param[in,out]  input_controller - The input controller that might
     ///     be tweaked based on camera movement.
     /// @param[in,out]  current_tile_map - The current tile map in view by the camera.
@@ -1083,7 +1105,7 @@ namespace STATES
         const sf::Time& elapsed_time,
         MAPS::World& world,
         GRAPHICS::Camera& camera,
-        AUDIO::Speakers& speakers,
+        AUDIO::SoundEventScheduler& sound_scheduler,
         INPUT_CONTROL::InputController& input_controller,
         MAPS::TileMap& current_tile_map,
         STATES::SavedGameData& current_game_data)
@@ -1141,12 +1163,13 @@ namespace STATES
                             DEBUGGING::DebugConsole::WriteLine("Random animal generated: ", static_cast<unsigned int>(animal->Type.Species));
 
                             // PLAY THE ANIMAL'S SOUND EFFECT, IF ONE EXISTS.
-                            speakers.PlaySoundEffect(animal->SoundId);
+                            sound_scheduler.Schedule(animal->SoundId, animal->Sprite.GetWorldPosition());
 
                             // START ANIMATING THE ANIMAL.
                             animal->Sprite.Play();
 
                             // STORE THE ANIMAL IN THE CURRENT TILE MAP.
+                            current_tile_map.MarkChangedFromInitialState();
                             current_tile_map.RoamingAnimals.emplace_back(animal);
                         }
                     }
@@ -1160,6 +1183,7 @@ namespace STATES
                         MATH::FloatRectangle new_map_bounding_box = current_tile_map.GetWorldBoundingBox();
                         float flaming_sword_x_position = RandomNumberGenerator.RandomInRange(new_map_bounding_box.LeftTop.X, new_map_bounding_box.RightBottom.X);
                         float flaming_sword_y_position = RandomNumberGenerator.RandomInRange(new_map_bounding_box.LeftTop.Y, new_map_bounding_box.RightBottom.Y);
+                        current_tile_map.MarkChangedFromInitialState();
                         current_tile_map.FlamingSword = OBJECTS::FlamingSword(flaming_sword_x_position, flaming_sword_y_position);
                     }
                 }
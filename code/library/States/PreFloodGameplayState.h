@@ -4,6 +4,7 @@
 #include <vector>
 #include <SFML/Graphics.hpp>
 #include <SFML/System.hpp>
+#include "Audio/SoundEventScheduler.h"
 #include "Audio/Speakers.h"
 #include "Bible/BibleVerse.h"
 #include "Graphics/Camera.h"
@@ -19,6 +20,7 @@
 #include "Objects/Animal.h"
 #include "States/GameState.h"
 #include "States/SavedGameData.h"
+#include "States/SavedGameWriter.h"
 
 namespace STATES
 {
@@ -39,13 +41,15 @@ namespace STATES
             HARDWARE::GamingHardware& gaming_hardware,
             MAPS::World& world,
             GRAPHICS::Camera& camera,
-            STATES::SavedGameData& current_game_data);
+            STATES::SavedGameData& current_game_data,
+            STATES::SavedGameWriter& saved_game_writer);
 
         // RENDERING.
         sf::Sprite Render(
             MAPS::World& world, 
             STATES::SavedGameData& current_game_data,
-            GRAPHICS::Renderer& renderer);
+            GRAPHICS::Renderer& renderer,
+            HARDWARE::GamingHardware& gaming_hardware);
 
     private:
         // WORLD UPDATING.
@@ -80,7 +84,7 @@ namespace STATES
         void CollectAnimalsCollidingWithPlayer(
             MAPS::World& world, 
             MAPS::TileMap& tile_map, 
-            AUDIO::Speakers& speakers,
+            AUDIO::SoundEventScheduler& sound_scheduler,
             STATES::SavedGameData& current_game_data);
 
         // CAMERA UPDATING.
@@ -88,7 +92,7 @@ namespace STATES
             const sf::Time& elapsed_time,
             MAPS::World& world,
             GRAPHICS::Camera& camera,
-            AUDIO::Speakers& speakers,
+            AUDIO::SoundEventScheduler& sound_scheduler,
             INPUT_CONTROL::InputController& input_controller,
             MAPS::TileMap& current_tile_map,
             STATES::SavedGameData& current_game_data);
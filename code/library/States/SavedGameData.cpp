@@ -1,12 +1,17 @@
 #include <cassert>
+#include <chrono>
 #include <fstream>
+#include <numeric>
 #include <sstream>
 #include "ErrorHandling/Asserts.h"
 #include "ErrorHandling/ErrorMessageBox.h"
+#include "Filesystem/File.h"
+#include "Gameplay/FloodElapsedTime.h"
 #include "Resources/AnimalGraphics.h"
 #include "Resources/AnimalSounds.h"
 #include "States/IntroSequence.h"
 #include "States/SavedGameData.h"
+#include "States/SavedGameJournal.h"
 
 namespace STATES
 {
@@ -44,6 +49,8 @@ namespace STATES
     }
 
     /// Attempts to load saved game data from the specified file.
+    /// The entire file is read at once and then parsed in memory.
+    /// Any changes journaled since the file was written are also applied.
     /// @param[in]  filepath - The path to the file with saved game data to load.
     /// @return The saved game data loaded from the file, if successful; null otherwise.
     std::unique_ptr<SavedGameData> SavedGameData::Load(const std::filesystem::path& filepath)
@@ -54,146 +61,147 @@ namespace STATES
             std::filesystem::path parent_directory_path = filepath.parent_path();
             std::filesystem::create_directories(parent_directory_path);
 
-            // OPEN THE FILE.
-            std::ifstream saved_game_data_file(filepath, std::ios::binary | std::ios::in);
-            bool file_opened = saved_game_data_file.is_open();
-            if (!file_opened)
+            // READ THE ENTIRE FILE.
+            std::string saved_game_bytes = FILESYSTEM::File::ReadBinary(filepath);
+            bool file_read = !saved_game_bytes.empty();
+            if (!file_read)
             {
                 // The saved game data cannot be loaded.
                 return nullptr;
             }
 
-            // CREATE THE SAVED GAME DATA TO BE POPULATED FROM THE FILE.
-            auto saved_game_data = std::make_unique<SavedGameData>();
+            // PARSE THE SAVED GAME DATA.
+            std::unique_ptr<SavedGameData> saved_game_data = Deserialize(saved_game_bytes);
+            if (!saved_game_data)
+            {
+                return nullptr;
+            }
             saved_game_data->Filepath = filepath;
 
-            // READ IN  THE CURRENT GAME STATE.
-            saved_game_data_file.read(reinterpret_cast<char*>(&saved_game_data->CurrentGameState), sizeof(saved_game_data->CurrentGameState));
-
-            // READ IN  THE PLAYER'S POSITION.
-            MATH::Vector2f player_world_position;
-            saved_game_data_file.read(reinterpret_cast<char*>(&player_world_position.X), sizeof(player_world_position.X));
-            saved_game_data_file.read(reinterpret_cast<char*>(&player_world_position.Y), sizeof(player_world_position.Y));
-            saved_game_data->Player->SetWorldPosition(player_world_position);
+            // APPLY ANY CHANGES JOURNALED SINCE THE FILE WAS WRITTEN.
+            std::string journal_bytes = FILESYSTEM::File::ReadBinary(SavedGameJournal::GetFilepath(filepath));
+            SavedGameJournal::Apply(saved_game_bytes, journal_bytes, *saved_game_data);
 
-            // READ IN PLAYER'S WOOD COUNT.
-            saved_game_data_file.read(reinterpret_cast<char*>(&saved_game_data->Player->Inventory.WoodCount), sizeof(saved_game_data->Player->Inventory.WoodCount));
+            return saved_game_data;
+        }
+        catch (const std::exception& exception)
+        {
+            // INDICATE THAT THE DATA COULD NOT BE SUCCESSFULLY READ.
+            ERROR_HANDLING::ErrorMessageBox::Display(exception.what());
+            return nullptr;
+        }
+    }
 
-            // READ IN OUT THE COLLECTED BIBLE VERSES.
-            std::size_t collected_bible_verse_count = 0;
-            saved_game_data_file.read(reinterpret_cast<char*>(&collected_bible_verse_count), sizeof(collected_bible_verse_count));
-            for (std::size_t bible_verse_index = 0; bible_verse_index < collected_bible_verse_count; ++bible_verse_index)
-            {
-                // READ IN THE CURRENT BIBLE VERSE.
-                BIBLE::BibleVerse bible_verse;
-                saved_game_data_file.read(reinterpret_cast<char*>(&bible_verse.Book), sizeof(bible_verse.Book));
-                saved_game_data_file.read(reinterpret_cast<char*>(&bible_verse.Chapter), sizeof(bible_verse.Chapter));
-                saved_game_data_file.read(reinterpret_cast<char*>(&bible_verse.Verse), sizeof(bible_verse.Verse));
-
-                // The length of the verse text needs to be read first to know how big the verse text is.
-                std::size_t verse_text_length_in_bytes = 0;
-                saved_game_data_file.read(reinterpret_cast<char*>(&verse_text_length_in_bytes), sizeof(verse_text_length_in_bytes));
-                bible_verse.Text.resize(verse_text_length_in_bytes);
-                saved_game_data_file.read(bible_verse.Text.data(), verse_text_length_in_bytes);
-
-                saved_game_data->Player->Inventory.BibleVerses.insert(bible_verse);
-            }
+    /// Parses saved game data from bytes in memory, in either the chunked format or the older legacy layout.
+    /// @param[in]  saved_game_bytes - The bytes of the saved game data, as written to a file.
+    /// @return The parsed saved game data.
+    std::unique_ptr<SavedGameData> SavedGameData::Deserialize(const std::string_view saved_game_bytes)
+    {
+        // MIGRATE FILES IN THE LEGACY LAYOUT.
+        // Such files start directly with a small game state value, so they never start with the magic identifier.
+        bool chunked_format = saved_game_bytes.starts_with(FILE_MAGIC);
+        if (!chunked_format)
+        {
+            return DeserializeLegacyLayout(saved_game_bytes);
+        }
 
-            // READ IN THE FOOD COUNTS.
-            std::size_t food_counts_total_size_in_bytes = sizeof(unsigned int) * static_cast<std::size_t>(OBJECTS::Food::TypeId::COUNT);
-            saved_game_data_file.read(reinterpret_cast<char*>(saved_game_data->Player->Inventory.FoodCounts.data()), food_counts_total_size_in_bytes);
+        // READ THE HEADER.
+        FILESYSTEM::BinaryReader reader(saved_game_bytes);
+        reader.Skip(FILE_MAGIC.size());
+        // Files from newer versions are still read as well as possible since unknown chunks are skipped.
+        // The version is available for migrating any chunks whose meaning has changed.
+        [[maybe_unused]] std::uint32_t file_format_version = reader.ReadUInt32();
+
+        // READ EACH CHUNK.
+        auto saved_game_data = std::make_unique<SavedGameData>();
+        bool error_reading_data = reader.Failed();
+        constexpr std::size_t CHUNK_HEADER_SIZE_IN_BYTES = 2 * sizeof(std::uint32_t);
+        while (!error_reading_data && reader.RemainingByteCount() >= CHUNK_HEADER_SIZE_IN_BYTES)
+        {
+            ChunkId chunk_id = static_cast<ChunkId>(reader.ReadUInt32());
+            std::uint32_t chunk_size_in_bytes = reader.ReadUInt32();
+            std::string_view chunk_bytes = reader.ReadBytes(chunk_size_in_bytes);
 
-            // READ IN THE FOLLOWING ANIMAL INFORMATION.
-            saved_game_data_file.read(reinterpret_cast<char*>(&saved_game_data->Player->Inventory.FollowingAnimals.CurrentCenterWorldPosition.X), sizeof(saved_game_data->Player->Inventory.FollowingAnimals.CurrentCenterWorldPosition.X));
-            saved_game_data_file.read(reinterpret_cast<char*>(&saved_game_data->Player->Inventory.FollowingAnimals.CurrentCenterWorldPosition.Y), sizeof(saved_game_data->Player->Inventory.FollowingAnimals.CurrentCenterWorldPosition.Y));
+            FILESYSTEM::BinaryReader chunk_reader(chunk_bytes);
+            saved_game_data->ReadChunk(chunk_id, chunk_reader);
 
-            std::size_t following_animal_count = 0;
-            saved_game_data_file.read(reinterpret_cast<char*>(&following_animal_count), sizeof(following_animal_count));
-            saved_game_data->Player->Inventory.FollowingAnimals.Animals.reserve(following_animal_count);
+            error_reading_data = reader.Failed() || chunk_reader.Failed();
+        }
 
-            for (std::size_t animal_index = 0; animal_index < following_animal_count; ++animal_index)
-            {
-                OBJECTS::AnimalSpecies::Value animal_species;
-                OBJECTS::AnimalGender::Value animal_gender;
-                saved_game_data_file.read(reinterpret_cast<char*>(&animal_species), sizeof(animal_species));
-                saved_game_data_file.read(reinterpret_cast<char*>(&animal_gender), sizeof(animal_gender));
-                OBJECTS::AnimalType animal_type(animal_species, animal_gender);
-                
-                RESOURCES::AssetId animal_sound_id = RESOURCES::AnimalSounds::GetSound(animal_type.Species);
-
-                std::shared_ptr<GRAPHICS::AnimatedSprite> animal_sprite = RESOURCES::AnimalGraphics::GetSprite(animal_type);
-                ASSERT_THEN_IF(animal_sprite)
-                {
-                    auto animal = MEMORY::NonNullSharedPointer<OBJECTS::Animal>(std::make_shared<OBJECTS::Animal>(
-                        animal_type,
-                        *animal_sprite,
-                        animal_sound_id));
-                    saved_game_data->Player->Inventory.FollowingAnimals.Add(animal);
-                }
-            }
+        // INITIALIZE THE BIBLE VERSES LEFT TO FIND.
+        saved_game_data->InitializeBibleVersesLeftToFind();
 
-            // READ IN THE BUILT ARK PIECES.
-            std::size_t built_ark_piece_count = 0;
-            saved_game_data_file.read(reinterpret_cast<char*>(&built_ark_piece_count), sizeof(built_ark_piece_count));
-            saved_game_data->BuiltArkPieces.reserve(built_ark_piece_count);
-            for (std::size_t ark_piece_index = 0; ark_piece_index < built_ark_piece_count; ++ark_piece_index)
-            {
-                unsigned int ark_piece_id = 0;
-                saved_game_data_file.read(reinterpret_cast<char*>(&ark_piece_id), sizeof(ark_piece_id));
+        // PROVIDE VISIBILITY INTO ANY ERRORS.
+        if (error_reading_data)
+        {
+            ERROR_HANDLING::ErrorMessageBox::Display("Error reading saved game data file.");
+        }
 
-                OBJECTS::ArkPiece ark_piece(ark_piece_id);
-                saved_game_data_file.read(reinterpret_cast<char*>(&ark_piece.Sprite.WorldPosition.X), sizeof(ark_piece.Sprite.WorldPosition.X));
-                saved_game_data_file.read(reinterpret_cast<char*>(&ark_piece.Sprite.WorldPosition.Y), sizeof(ark_piece.Sprite.WorldPosition.Y));
-                saved_game_data_file.read(reinterpret_cast<char*>(&ark_piece.Built), sizeof(ark_piece.Built));
-                saved_game_data_file.read(reinterpret_cast<char*>(&ark_piece.IsExternalDoorway), sizeof(ark_piece.IsExternalDoorway));
+        return saved_game_data;
+    }
 
-                saved_game_data->BuiltArkPieces.emplace_back(ark_piece);
-            }
+    /// Attempts to load just the summary of a saved game from the specified file.
+    /// Only the start of the file is read for saved games with summaries.
+    /// Older saved games without summaries, or those with journaled changes not reflected in
+    /// their summaries, are fully loaded to compute their summaries.
+    /// @param[in]  filepath - The path to the file with saved game data.
+    /// @return The summary of the saved game, if successfully loaded; null otherwise.
+    std::optional<SavedGameSummary> SavedGameData::LoadSummary(const std::filesystem::path& filepath)
+    {
+        // READ ONLY THE START OF THE FILE CONTAINING THE SUMMARY.
+        constexpr std::size_t HEADER_SIZE_IN_BYTES = FILE_MAGIC.size() + sizeof(FILE_FORMAT_VERSION);
+        constexpr std::size_t CHUNK_HEADER_SIZE_IN_BYTES = 2 * sizeof(std::uint32_t);
+        constexpr std::size_t SUMMARY_END_OFFSET_IN_BYTES = HEADER_SIZE_IN_BYTES + CHUNK_HEADER_SIZE_IN_BYTES + SavedGameSummary::SIZE_IN_BYTES;
+        std::string summary_bytes(SUMMARY_END_OFFSET_IN_BYTES, '\0');
+        {
+            std::ifstream saved_game_data_file(filepath, std::ios::binary | std::ios::in);
+            saved_game_data_file.read(summary_bytes.data(), static_cast<std::streamsize>(summary_bytes.size()));
+            summary_bytes.resize(static_cast<std::size_t>(saved_game_data_file.gcount()));
+        }
 
-            // READ IN THE COLLECTED ANIMAL STATISTICS.
-            std::size_t animal_statistics_total_count = static_cast<std::size_t>(OBJECTS::AnimalSpecies::COUNT) * static_cast<std::size_t>(OBJECTS::AnimalGender::COUNT);
-            std::size_t collected_animal_statistics_total_size_in_bytes = sizeof(INVENTORY::AnimalCollectionStatistics) * animal_statistics_total_count;
-            saved_game_data_file.read(reinterpret_cast<char*>(saved_game_data->CollectedAnimalsBySpeciesThenGender.data()), collected_animal_statistics_total_size_in_bytes);
-
-            // INITIALIZE THE BIBLE VERSES LEFT TO FIND.
-            std::set_difference(
-                BIBLE::BIBLE_VERSES.cbegin(),
-                BIBLE::BIBLE_VERSES.cend(),
-                saved_game_data->Player->Inventory.BibleVerses.cbegin(),
-                saved_game_data->Player->Inventory.BibleVerses.cend(),
-                std::inserter(saved_game_data->BibleVersesLeftToFind, saved_game_data->BibleVersesLeftToFind.begin()));
-
-            // READ IN FAMILY COLLECTION STATISTICS.
-            std::size_t family_member_statistics_total_size_in_bytes = sizeof(bool) * saved_game_data->FamilyMembersGathered.size();
-            saved_game_data_file.read(reinterpret_cast<char*>(&saved_game_data->FamilyMembersGathered), family_member_statistics_total_size_in_bytes);
-
-            // READ IN FOOD COUNTS ON THE ARK.
-            saved_game_data_file.read(reinterpret_cast<char*>(saved_game_data->FoodCountsOnArk.data()), food_counts_total_size_in_bytes);
-
-            // READ IN THE FLOOD DAY/TIME INFORMATION.
-            float flood_elapsed_time_in_seconds = 0.0f;
-            saved_game_data_file.read(reinterpret_cast<char*>(&flood_elapsed_time_in_seconds), sizeof(flood_elapsed_time_in_seconds));
-            saved_game_data->FloodElapsedGameplayTime = sf::seconds(flood_elapsed_time_in_seconds);
-
-            // PROVIDE VISIBILITY INTO ANY ERRORS.
-            bool error_reading_data = saved_game_data_file.bad() || saved_game_data_file.fail();
-            if (error_reading_data)
+        // READ THE SUMMARY IF THE FILE HAS AN UP-TO-DATE ONE.
+        std::error_code journal_size_error;
+        std::uintmax_t journal_size_in_bytes = std::filesystem::file_size(SavedGameJournal::GetFilepath(filepath), journal_size_error);
+        bool changes_journaled = !journal_size_error && (journal_size_in_bytes > 0);
+        bool chunked_format = summary_bytes.starts_with(FILE_MAGIC);
+        if (chunked_format && !changes_journaled)
+        {
+            FILESYSTEM::BinaryReader reader(summary_bytes);
+            reader.Skip(FILE_MAGIC.size());
+            std::uint32_t file_format_version = reader.ReadUInt32();
+            ChunkId first_chunk_id = static_cast<ChunkId>(reader.ReadUInt32());
+            std::uint32_t first_chunk_size_in_bytes = reader.ReadUInt32();
+
+            constexpr std::uint32_t FIRST_FILE_FORMAT_VERSION_WITH_SUMMARY = 2;
+            bool file_has_summary = (
+                file_format_version >= FIRST_FILE_FORMAT_VERSION_WITH_SUMMARY &&
+                ChunkId::SUMMARY == first_chunk_id &&
+                first_chunk_size_in_bytes >= SavedGameSummary::SIZE_IN_BYTES);
+            if (file_has_summary)
             {
-                ERROR_HANDLING::ErrorMessageBox::Display("Error reading saved game data file.");
+                SavedGameSummary summary = SavedGameSummary::Read(reader);
+                if (!reader.Failed())
+                {
+                    summary.Filepath = filepath;
+                    return summary;
+                }
             }
-
-            // RETURN THE LOADED SAVED GAME DATA.
-            return saved_game_data;
         }
-        catch (const std::exception& exception)
+
+        // FALL BACK TO LOADING THE ENTIRE SAVED GAME.
+        std::unique_ptr<SavedGameData> saved_game_data = Load(filepath);
+        if (!saved_game_data)
         {
-            // INDICATE THAT THE DATA COULD NOT BE SUCCESSFULLY READ.
-            ERROR_HANDLING::ErrorMessageBox::Display(exception.what());
-            return nullptr;
+            return std::nullopt;
         }
+
+        SavedGameSummary summary = saved_game_data->Summarize();
+        return summary;
     }
 
     /// Attempts to write saved game data to the specified file.
+    /// The data is serialized in memory first and then written all at once, replacing the file
+    /// only once all data has been written so that a failed write never corrupts an existing save.
     /// @param[in]  filepath - The path to the file to write the saved game data.
     void SavedGameData::Write(const std::filesystem::path& filepath) const
     {
@@ -201,93 +209,457 @@ namespace STATES
         std::filesystem::path parent_directory_path = std::filesystem::path(filepath).parent_path();
         std::filesystem::create_directories(parent_directory_path);
 
-        // OPEN THE FILE.
-        // See https://en.cppreference.com/w/cpp/io/basic_filebuf/open for flags.
-        std::ofstream saved_game_data_file(filepath, std::ios::binary | std::ios::out);
-        bool file_opened = saved_game_data_file.is_open();
-        if (!file_opened)
+        // WRITE THE SAVED GAME DATA.
+        std::string saved_game_bytes = Serialize();
+        bool saved_game_data_written = FILESYSTEM::File::WriteBinaryAtomically(filepath, saved_game_bytes);
+
+        // PROVIDE VISIBILITY INTO ANY ERRORS.
+        if (!saved_game_data_written)
         {
-            // The saved game data cannot be written.
-            return;
+            ERROR_HANDLING::ErrorMessageBox::Display("Error writing saved game data file.");
         }
+    }
+
+    /// Serializes the saved game data into bytes in the chunked format.
+    /// @return The bytes of the saved game data, suitable for writing to a file.
+    std::string SavedGameData::Serialize() const
+    {
+        FILESYSTEM::BinaryWriter writer;
+
+        // WRITE THE HEADER.
+        writer.WriteBytes(FILE_MAGIC);
+        writer.WriteUInt32(FILE_FORMAT_VERSION);
+
+        // WRITE THE SUMMARY.
+        // It must be first so that it can be read without reading the rest of the file.
+        SavedGameSummary summary = Summarize();
+        auto current_time_since_epoch = std::chrono::system_clock::now().time_since_epoch();
+        summary.SavedTimeInSecondsSinceEpoch = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::seconds>(current_time_since_epoch).count());
+        std::size_t chunk_start_offset_in_bytes = BeginChunk(ChunkId::SUMMARY, writer);
+        summary.Write(writer);
+        EndChunk(chunk_start_offset_in_bytes, writer);
 
         // WRITE THE CURRENT GAME STATE.
-        saved_game_data_file.write(reinterpret_cast<const char*>(&CurrentGameState), sizeof(CurrentGameState));
+        chunk_start_offset_in_bytes = BeginChunk(ChunkId::GAME_STATE, writer);
+        writer.WriteUInt32(static_cast<std::uint32_t>(CurrentGameState));
+        EndChunk(chunk_start_offset_in_bytes, writer);
 
-        // WRITE THE PLAYER'S POSITION.
+        // WRITE THE PLAYER'S POSITION AND WOOD COUNT.
+        chunk_start_offset_in_bytes = BeginChunk(ChunkId::PLAYER, writer);
         MATH::Vector2f player_world_position = Player->GetWorldPosition();
-        saved_game_data_file.write(reinterpret_cast<const char*>(&player_world_position.X), sizeof(player_world_position.X));
-        saved_game_data_file.write(reinterpret_cast<const char*>(&player_world_position.Y), sizeof(player_world_position.Y));
-
-        // WRITE THE PLAYER'S WOOD COUNT.
-        saved_game_data_file.write(reinterpret_cast<const char*>(&Player->Inventory.WoodCount), sizeof(Player->Inventory.WoodCount));
+        writer.WriteFloat(player_world_position.X);
+        writer.WriteFloat(player_world_position.Y);
+        writer.WriteUInt32(Player->Inventory.WoodCount);
+        EndChunk(chunk_start_offset_in_bytes, writer);
 
         // WRITE OUT THE COLLECTED BIBLE VERSES.
-        std::size_t collected_bible_verse_count = Player->Inventory.BibleVerses.size();
-        saved_game_data_file.write(reinterpret_cast<const char*>(&collected_bible_verse_count), sizeof(collected_bible_verse_count));
+        chunk_start_offset_in_bytes = BeginChunk(ChunkId::COLLECTED_BIBLE_VERSES, writer);
+        writer.WriteUInt32(static_cast<std::uint32_t>(Player->Inventory.BibleVerses.size()));
         for (const auto& bible_verse : Player->Inventory.BibleVerses)
         {
-            // WRITE OUT THE CURRENT BIBLE VERSE.
-            saved_game_data_file.write(reinterpret_cast<const char*>(&bible_verse.Book), sizeof(bible_verse.Book));
-            saved_game_data_file.write(reinterpret_cast<const char*>(&bible_verse.Chapter), sizeof(bible_verse.Chapter));
-            saved_game_data_file.write(reinterpret_cast<const char*>(&bible_verse.Verse), sizeof(bible_verse.Verse));
-
-            // The length of the verse text needs to be written out to know where the verse text ends.
-            std::size_t verse_text_length_in_bytes = bible_verse.Text.length();
-            saved_game_data_file.write(reinterpret_cast<const char*>(&verse_text_length_in_bytes), sizeof(verse_text_length_in_bytes));
-            saved_game_data_file.write(bible_verse.Text.data(), verse_text_length_in_bytes);
+            writer.WriteUInt32(static_cast<std::uint32_t>(bible_verse.Book));
+            writer.WriteUInt32(bible_verse.Chapter);
+            writer.WriteUInt32(bible_verse.Verse);
+            writer.WriteString(bible_verse.Text);
         }
+        EndChunk(chunk_start_offset_in_bytes, writer);
 
-        // WRITE OUT THE FOOD COUNTS.
-        std::size_t food_counts_total_size_in_bytes = sizeof(unsigned int) * static_cast<std::size_t>(OBJECTS::Food::TypeId::COUNT);
-        saved_game_data_file.write(reinterpret_cast<const char*>(Player->Inventory.FoodCounts.data()), food_counts_total_size_in_bytes);
+        // WRITE OUT THE PLAYER'S FOOD COUNTS.
+        // Counts are preceded by the number of food types in case more types are added later.
+        chunk_start_offset_in_bytes = BeginChunk(ChunkId::PLAYER_FOOD_COUNTS, writer);
+        writer.WriteUInt32(static_cast<std::uint32_t>(Player->Inventory.FoodCounts.size()));
+        for (unsigned int food_count : Player->Inventory.FoodCounts)
+        {
+            writer.WriteUInt32(food_count);
+        }
+        EndChunk(chunk_start_offset_in_bytes, writer);
 
         // WRITE OUT THE FOLLOWING ANIMAL INFORMATION.
-        saved_game_data_file.write(reinterpret_cast<const char*>(&Player->Inventory.FollowingAnimals.CurrentCenterWorldPosition.X), sizeof(Player->Inventory.FollowingAnimals.CurrentCenterWorldPosition.X));
-        saved_game_data_file.write(reinterpret_cast<const char*>(&Player->Inventory.FollowingAnimals.CurrentCenterWorldPosition.Y), sizeof(Player->Inventory.FollowingAnimals.CurrentCenterWorldPosition.Y));
-
-        std::size_t following_animal_count = Player->Inventory.FollowingAnimals.Animals.size();
-        saved_game_data_file.write(reinterpret_cast<const char*>(&following_animal_count), sizeof(following_animal_count));
+        chunk_start_offset_in_bytes = BeginChunk(ChunkId::FOLLOWING_ANIMALS, writer);
+        writer.WriteFloat(Player->Inventory.FollowingAnimals.CurrentCenterWorldPosition.X);
+        writer.WriteFloat(Player->Inventory.FollowingAnimals.CurrentCenterWorldPosition.Y);
+        writer.WriteUInt32(static_cast<std::uint32_t>(Player->Inventory.FollowingAnimals.Animals.size()));
         for (const auto& animal : Player->Inventory.FollowingAnimals.Animals)
         {
-            saved_game_data_file.write(reinterpret_cast<const char*>(&animal->Type.Species), sizeof(animal->Type.Species));
-            saved_game_data_file.write(reinterpret_cast<const char*>(&animal->Type.Gender), sizeof(animal->Type.Gender));
+            writer.WriteUInt32(static_cast<std::uint32_t>(animal->Type.Species));
+            writer.WriteUInt32(static_cast<std::uint32_t>(animal->Type.Gender));
         }
+        EndChunk(chunk_start_offset_in_bytes, writer);
 
         // WRITE OUT THE BUILT ARK PIECES.
-        std::size_t built_ark_piece_count = BuiltArkPieces.size();
-        saved_game_data_file.write(reinterpret_cast<const char*>(&built_ark_piece_count), sizeof(built_ark_piece_count));
+        chunk_start_offset_in_bytes = BeginChunk(ChunkId::BUILT_ARK_PIECES, writer);
+        writer.WriteUInt32(static_cast<std::uint32_t>(BuiltArkPieces.size()));
         for (const auto& ark_piece : BuiltArkPieces)
         {
-            saved_game_data_file.write(reinterpret_cast<const char*>(&ark_piece.Id), sizeof(ark_piece.Id));
-            saved_game_data_file.write(reinterpret_cast<const char*>(&ark_piece.Sprite.WorldPosition.X), sizeof(ark_piece.Sprite.WorldPosition.X));
-            saved_game_data_file.write(reinterpret_cast<const char*>(&ark_piece.Sprite.WorldPosition.Y), sizeof(ark_piece.Sprite.WorldPosition.Y));
-            saved_game_data_file.write(reinterpret_cast<const char*>(&ark_piece.Built), sizeof(ark_piece.Built));
-            saved_game_data_file.write(reinterpret_cast<const char*>(&ark_piece.IsExternalDoorway), sizeof(ark_piece.IsExternalDoorway));
+            writer.WriteUInt32(ark_piece.Id);
+            writer.WriteFloat(ark_piece.Sprite.WorldPosition.X);
+            writer.WriteFloat(ark_piece.Sprite.WorldPosition.Y);
+            writer.WriteBool(ark_piece.Built);
+            writer.WriteBool(ark_piece.IsExternalDoorway);
         }
+        EndChunk(chunk_start_offset_in_bytes, writer);
 
         // WRITE OUT THE COLLECTED ANIMAL STATISTICS.
-        std::size_t animal_statistics_total_count = static_cast<std::size_t>(OBJECTS::AnimalSpecies::COUNT) * static_cast<std::size_t>(OBJECTS::AnimalGender::COUNT);
-        std::size_t collected_animal_statistics_total_size_in_bytes = sizeof(INVENTORY::AnimalCollectionStatistics) * animal_statistics_total_count;
-        saved_game_data_file.write(reinterpret_cast<const char*>(CollectedAnimalsBySpeciesThenGender.data()), collected_animal_statistics_total_size_in_bytes);
+        // The dimensions are written first in case more species or genders are added later.
+        chunk_start_offset_in_bytes = BeginChunk(ChunkId::COLLECTED_ANIMALS, writer);
+        writer.WriteUInt32(static_cast<std::uint32_t>(OBJECTS::AnimalSpecies::COUNT));
+        writer.WriteUInt32(static_cast<std::uint32_t>(OBJECTS::AnimalGender::COUNT));
+        for (const auto& collected_animals_by_gender : CollectedAnimalsBySpeciesThenGender)
+        {
+            for (const INVENTORY::AnimalCollectionStatistics& animal_statistics : collected_animals_by_gender)
+            {
+                writer.WriteUInt32(animal_statistics.FollowingPlayerCount);
+                writer.WriteUInt32(animal_statistics.InArkCount);
+                writer.WriteUInt32(animal_statistics.AnimalPenTileMapLayerIndex);
+                writer.WriteUInt32(animal_statistics.AnimalPenTileMapColumnIndex);
+                writer.WriteUInt32(animal_statistics.AnimalPenTileMapRowIndex);
+                writer.WriteUInt32(animal_statistics.AnimalPenTileMapPenIndex);
+            }
+        }
+        EndChunk(chunk_start_offset_in_bytes, writer);
 
         // WRITE OUT FAMILY COLLECTION STATISTICS.
-        std::size_t family_member_statistics_total_size_in_bytes = sizeof(bool) * FamilyMembersGathered.size();
-        saved_game_data_file.write(reinterpret_cast<const char*>(&FamilyMembersGathered), family_member_statistics_total_size_in_bytes);
+        chunk_start_offset_in_bytes = BeginChunk(ChunkId::GATHERED_FAMILY_MEMBERS, writer);
+        writer.WriteUInt32(static_cast<std::uint32_t>(FamilyMembersGathered.size()));
+        for (bool family_member_gathered : FamilyMembersGathered)
+        {
+            writer.WriteBool(family_member_gathered);
+        }
+        EndChunk(chunk_start_offset_in_bytes, writer);
 
         // WRITE OUT FOOD COUNTS ON THE ARK.
-        saved_game_data_file.write(reinterpret_cast<const char*>(FoodCountsOnArk.data()), food_counts_total_size_in_bytes);
+        chunk_start_offset_in_bytes = BeginChunk(ChunkId::ARK_FOOD_COUNTS, writer);
+        writer.WriteUInt32(static_cast<std::uint32_t>(FoodCountsOnArk.size()));
+        for (unsigned int food_count : FoodCountsOnArk)
+        {
+            writer.WriteUInt32(food_count);
+        }
+        EndChunk(chunk_start_offset_in_bytes, writer);
 
         // WRITE OUT THE FLOOD DAY/TIME INFORMATION.
-        float flood_elapsed_time_in_seconds = FloodElapsedGameplayTime.asSeconds();
-        saved_game_data_file.write(reinterpret_cast<const char*>(&flood_elapsed_time_in_seconds), sizeof(flood_elapsed_time_in_seconds));
+        chunk_start_offset_in_bytes = BeginChunk(ChunkId::FLOOD_ELAPSED_TIME, writer);
+        writer.WriteFloat(FloodElapsedGameplayTime.asSeconds());
+        EndChunk(chunk_start_offset_in_bytes, writer);
+
+        return writer.Bytes;
+    }
+
+    /// Begins writing a chunk by writing its header.  The size of the chunk is filled in once the chunk is ended.
+    /// @param[in]  chunk_id - The ID of the chunk.
+    /// @param[in,out]  writer - The writer to write the chunk header to.
+    /// @return The offset of the start of the chunk, needed for ending it.
+    std::size_t SavedGameData::BeginChunk(const ChunkId chunk_id, FILESYSTEM::BinaryWriter& writer)
+    {
+        std::size_t chunk_start_offset_in_bytes = writer.Bytes.size();
+        writer.WriteUInt32(static_cast<std::uint32_t>(chunk_id));
+        // A placeholder size is written until the real size is known.
+        writer.WriteUInt32(0);
+        return chunk_start_offset_in_bytes;
+    }
+
+    /// Ends writing a chunk by filling in its size in its header.
+    /// @param[in]  chunk_start_offset_in_bytes - The offset of the start of the chunk, as returned when it was begun.
+    /// @param[in,out]  writer - The writer to which the chunk was written.
+    void SavedGameData::EndChunk(const std::size_t chunk_start_offset_in_bytes, FILESYSTEM::BinaryWriter& writer)
+    {
+        std::size_t chunk_size_offset_in_bytes = chunk_start_offset_in_bytes + sizeof(std::uint32_t);
+        std::size_t chunk_data_offset_in_bytes = chunk_size_offset_in_bytes + sizeof(std::uint32_t);
+        std::size_t chunk_size_in_bytes = writer.Bytes.size() - chunk_data_offset_in_bytes;
+        writer.OverwriteUInt32(chunk_size_offset_in_bytes, static_cast<std::uint32_t>(chunk_size_in_bytes));
+    }
+
+    /// Reads the data for a single chunk into this saved game data.  Unknown chunks are ignored,
+    /// as is any extra data at the end of known chunks, so that files from newer versions of the game can be read.
+    /// @param[in]  chunk_id - The ID of the chunk.
+    /// @param[in,out]  chunk_reader - A reader for just the data of the chunk.
+    void SavedGameData::ReadChunk(const ChunkId chunk_id, FILESYSTEM::BinaryReader& chunk_reader)
+    {
+        switch (chunk_id)
+        {
+            case ChunkId::GAME_STATE:
+                CurrentGameState = static_cast<GameState>(chunk_reader.ReadUInt32());
+                break;
+            case ChunkId::PLAYER:
+            {
+                MATH::Vector2f player_world_position;
+                player_world_position.X = chunk_reader.ReadFloat();
+                player_world_position.Y = chunk_reader.ReadFloat();
+                Player->SetWorldPosition(player_world_position);
+                Player->Inventory.WoodCount = chunk_reader.ReadUInt32();
+                break;
+            }
+            case ChunkId::COLLECTED_BIBLE_VERSES:
+            {
+                std::uint32_t collected_bible_verse_count = chunk_reader.ReadUInt32();
+                for (std::uint32_t bible_verse_index = 0; bible_verse_index < collected_bible_verse_count && !chunk_reader.Failed(); ++bible_verse_index)
+                {
+                    BIBLE::BibleVerse bible_verse;
+                    bible_verse.Book = static_cast<BIBLE::BibleBook>(chunk_reader.ReadUInt32());
+                    bible_verse.Chapter = chunk_reader.ReadUInt32();
+                    bible_verse.Verse = chunk_reader.ReadUInt32();
+                    bible_verse.Text = chunk_reader.ReadString();
+                    Player->Inventory.BibleVerses.insert(bible_verse);
+                }
+                break;
+            }
+            case ChunkId::PLAYER_FOOD_COUNTS:
+            {
+                // Counts for any food types not known about are skipped.
+                std::uint32_t food_type_count = chunk_reader.ReadUInt32();
+                for (std::uint32_t food_id = 0; food_id < food_type_count && food_id < Player->Inventory.FoodCounts.size(); ++food_id)
+                {
+                    Player->Inventory.FoodCounts[food_id] = chunk_reader.ReadUInt32();
+                }
+                break;
+            }
+            case ChunkId::FOLLOWING_ANIMALS:
+            {
+                Player->Inventory.FollowingAnimals.CurrentCenterWorldPosition.X = chunk_reader.ReadFloat();
+                Player->Inventory.FollowingAnimals.CurrentCenterWorldPosition.Y = chunk_reader.ReadFloat();
+
+                std::uint32_t following_animal_count = chunk_reader.ReadUInt32();
+                for (std::uint32_t animal_index = 0; animal_index < following_animal_count && !chunk_reader.Failed(); ++animal_index)
+                {
+                    OBJECTS::AnimalSpecies::Value animal_species = static_cast<OBJECTS::AnimalSpecies::Value>(chunk_reader.ReadUInt32());
+                    OBJECTS::AnimalGender::Value animal_gender = static_cast<OBJECTS::AnimalGender::Value>(chunk_reader.ReadUInt32());
+                    AddFollowingAnimal(OBJECTS::AnimalType(animal_species, animal_gender));
+                }
+                break;
+            }
+            case ChunkId::BUILT_ARK_PIECES:
+            {
+                std::uint32_t built_ark_piece_count = chunk_reader.ReadUInt32();
+                for (std::uint32_t ark_piece_index = 0; ark_piece_index < built_ark_piece_count && !chunk_reader.Failed(); ++ark_piece_index)
+                {
+                    OBJECTS::ArkPiece ark_piece(chunk_reader.ReadUInt32());
+                    ark_piece.Sprite.WorldPosition.X = chunk_reader.ReadFloat();
+                    ark_piece.Sprite.WorldPosition.Y = chunk_reader.ReadFloat();
+                    ark_piece.Built = chunk_reader.ReadBool();
+                    ark_piece.IsExternalDoorway = chunk_reader.ReadBool();
+                    BuiltArkPieces.emplace_back(ark_piece);
+                }
+                break;
+            }
+            case ChunkId::COLLECTED_ANIMALS:
+            {
+                // Statistics for any species or genders not known about are skipped.
+                std::uint32_t species_count = chunk_reader.ReadUInt32();
+                std::uint32_t gender_count = chunk_reader.ReadUInt32();
+                for (std::uint32_t species_id = 0; species_id < species_count && !chunk_reader.Failed(); ++species_id)
+                {
+                    for (std::uint32_t gender_id = 0; gender_id < gender_count && !chunk_reader.Failed(); ++gender_id)
+                    {
+                        INVENTORY::AnimalCollectionStatistics animal_statistics;
+                        animal_statistics.FollowingPlayerCount = chunk_reader.ReadUInt32();
+                        animal_statistics.InArkCount = chunk_reader.ReadUInt32();
+                        animal_statistics.AnimalPenTileMapLayerIndex = chunk_reader.ReadUInt32();
+                        animal_statistics.AnimalPenTileMapColumnIndex = chunk_reader.ReadUInt32();
+                        animal_statistics.AnimalPenTileMapRowIndex = chunk_reader.ReadUInt32();
+                        animal_statistics.AnimalPenTileMapPenIndex = chunk_reader.ReadUInt32();
+
+                        bool animal_type_known = (species_id < OBJECTS::AnimalSpecies::COUNT) && (gender_id < OBJECTS::AnimalGender::COUNT);
+                        if (animal_type_known)
+                        {
+                            CollectedAnimalsBySpeciesThenGender[species_id][gender_id] = animal_statistics;
+                        }
+                    }
+                }
+                break;
+            }
+            case ChunkId::GATHERED_FAMILY_MEMBERS:
+            {
+                std::uint32_t family_member_count = chunk_reader.ReadUInt32();
+                for (std::uint32_t family_member_id = 0; family_member_id < family_member_count && family_member_id < FamilyMembersGathered.size(); ++family_member_id)
+                {
+                    FamilyMembersGathered[family_member_id] = chunk_reader.ReadBool();
+                }
+                break;
+            }
+            case ChunkId::ARK_FOOD_COUNTS:
+            {
+                std::uint32_t food_type_count = chunk_reader.ReadUInt32();
+                for (std::uint32_t food_id = 0; food_id < food_type_count && food_id < FoodCountsOnArk.size(); ++food_id)
+                {
+                    FoodCountsOnArk[food_id] = chunk_reader.ReadUInt32();
+                }
+                break;
+            }
+            case ChunkId::FLOOD_ELAPSED_TIME:
+                FloodElapsedGameplayTime = sf::seconds(chunk_reader.ReadFloat());
+                break;
+            case ChunkId::SUMMARY:
+                // The summary is only needed when not loading the full saved game data.
+                break;
+            default:
+                // Chunks from newer versions of the game are skipped.
+                break;
+        }
+    }
+
+    /// Parses saved game data from bytes in the legacy layout used before the chunked format.
+    /// The legacy layout directly contained the in-memory representation of each value
+    /// from the 64-bit Windows builds of the game (4-byte enums and integers, 8-byte sizes, and 1-byte booleans).
+    /// @param[in]  saved_game_bytes - The bytes of the saved game data in the legacy layout.
+    /// @return The parsed saved game data.
+    std::unique_ptr<SavedGameData> SavedGameData::DeserializeLegacyLayout(const std::string_view saved_game_bytes)
+    {
+        auto saved_game_data = std::make_unique<SavedGameData>();
+        FILESYSTEM::BinaryReader reader(saved_game_bytes);
+
+        // READ IN  THE CURRENT GAME STATE.
+        saved_game_data->CurrentGameState = static_cast<GameState>(reader.ReadUInt32());
+
+        // READ IN  THE PLAYER'S POSITION.
+        MATH::Vector2f player_world_position;
+        player_world_position.X = reader.ReadFloat();
+        player_world_position.Y = reader.ReadFloat();
+        saved_game_data->Player->SetWorldPosition(player_world_position);
+
+        // READ IN PLAYER'S WOOD COUNT.
+        saved_game_data->Player->Inventory.WoodCount = reader.ReadUInt32();
+
+        // READ IN OUT THE COLLECTED BIBLE VERSES.
+        std::uint64_t collected_bible_verse_count = reader.ReadUInt64();
+        for (std::uint64_t bible_verse_index = 0; bible_verse_index < collected_bible_verse_count && !reader.Failed(); ++bible_verse_index)
+        {
+            BIBLE::BibleVerse bible_verse;
+            bible_verse.Book = static_cast<BIBLE::BibleBook>(reader.ReadUInt32());
+            bible_verse.Chapter = reader.ReadUInt32();
+            bible_verse.Verse = reader.ReadUInt32();
+            std::uint64_t verse_text_length_in_bytes = reader.ReadUInt64();
+            bible_verse.Text = std::string(reader.ReadBytes(static_cast<std::size_t>(verse_text_length_in_bytes)));
+            saved_game_data->Player->Inventory.BibleVerses.insert(bible_verse);
+        }
+
+        // READ IN THE FOOD COUNTS.
+        for (unsigned int& food_count : saved_game_data->Player->Inventory.FoodCounts)
+        {
+            food_count = reader.ReadUInt32();
+        }
+
+        // READ IN THE FOLLOWING ANIMAL INFORMATION.
+        saved_game_data->Player->Inventory.FollowingAnimals.CurrentCenterWorldPosition.X = reader.ReadFloat();
+        saved_game_data->Player->Inventory.FollowingAnimals.CurrentCenterWorldPosition.Y = reader.ReadFloat();
+        std::uint64_t following_animal_count = reader.ReadUInt64();
+        for (std::uint64_t animal_index = 0; animal_index < following_animal_count && !reader.Failed(); ++animal_index)
+        {
+            OBJECTS::AnimalSpecies::Value animal_species = static_cast<OBJECTS::AnimalSpecies::Value>(reader.ReadUInt32());
+            OBJECTS::AnimalGender::Value animal_gender = static_cast<OBJECTS::AnimalGender::Value>(reader.ReadUInt32());
+            saved_game_data->AddFollowingAnimal(OBJECTS::AnimalType(animal_species, animal_gender));
+        }
+
+        // READ IN THE BUILT ARK PIECES.
+        std::uint64_t built_ark_piece_count = reader.ReadUInt64();
+        for (std::uint64_t ark_piece_index = 0; ark_piece_index < built_ark_piece_count && !reader.Failed(); ++ark_piece_index)
+        {
+            OBJECTS::ArkPiece ark_piece(reader.ReadUInt32());
+            ark_piece.Sprite.WorldPosition.X = reader.ReadFloat();
+            ark_piece.Sprite.WorldPosition.Y = reader.ReadFloat();
+            ark_piece.Built = reader.ReadBool();
+            ark_piece.IsExternalDoorway = reader.ReadBool();
+            saved_game_data->BuiltArkPieces.emplace_back(ark_piece);
+        }
+
+        // READ IN THE COLLECTED ANIMAL STATISTICS.
+        for (auto& collected_animals_by_gender : saved_game_data->CollectedAnimalsBySpeciesThenGender)
+        {
+            for (INVENTORY::AnimalCollectionStatistics& animal_statistics : collected_animals_by_gender)
+            {
+                animal_statistics.FollowingPlayerCount = reader.ReadUInt32();
+                animal_statistics.InArkCount = reader.ReadUInt32();
+                animal_statistics.AnimalPenTileMapLayerIndex = reader.ReadUInt32();
+                animal_statistics.AnimalPenTileMapColumnIndex = reader.ReadUInt32();
+                animal_statistics.AnimalPenTileMapRowIndex = reader.ReadUInt32();
+                animal_statistics.AnimalPenTileMapPenIndex = reader.ReadUInt32();
+            }
+        }
+
+        // INITIALIZE THE BIBLE VERSES LEFT TO FIND.
+        saved_game_data->InitializeBibleVersesLeftToFind();
+
+        // READ IN FAMILY COLLECTION STATISTICS.
+        for (bool& family_member_gathered : saved_game_data->FamilyMembersGathered)
+        {
+            family_member_gathered = reader.ReadBool();
+        }
+
+        // READ IN FOOD COUNTS ON THE ARK.
+        for (unsigned int& food_count : saved_game_data->FoodCountsOnArk)
+        {
+            food_count = reader.ReadUInt32();
+        }
+
+        // READ IN THE FLOOD DAY/TIME INFORMATION.
+        saved_game_data->FloodElapsedGameplayTime = sf::seconds(reader.ReadFloat());
 
         // PROVIDE VISIBILITY INTO ANY ERRORS.
-        bool error_writing_data = saved_game_data_file.bad() || saved_game_data_file.fail();
-        if (error_writing_data)
+        if (reader.Failed())
         {
-            ERROR_HANDLING::ErrorMessageBox::Display("Error writing saved game data file.");
+            ERROR_HANDLING::ErrorMessageBox::Display("Error reading saved game data file.");
         }
+
+        return saved_game_data;
+    }
+
+    /// Adds an animal of the specified type to those following the player.
+    /// @param[in]  animal_type - The type of animal to add.
+    void SavedGameData::AddFollowingAnimal(const OBJECTS::AnimalType& animal_type)
+    {
+        RESOURCES::AssetId animal_sound_id = RESOURCES::AnimalSounds::GetSound(animal_type.Species);
+
+        std::shared_ptr<GRAPHICS::AnimatedSprite> animal_sprite = RESOURCES::AnimalGraphics::GetSprite(animal_type);
+        ASSERT_THEN_IF(animal_sprite)
+        {
+            auto animal = MEMORY::NonNullSharedPointer<OBJECTS::Animal>(std::make_shared<OBJECTS::Animal>(
+                animal_type,
+                *animal_sprite,
+                animal_sound_id));
+            Player->Inventory.FollowingAnimals.Add(animal);
+        }
+    }
+
+    /// Initializes the Bible verses left to find based on those the player has collected.
+    void SavedGameData::InitializeBibleVersesLeftToFind()
+    {
+        BibleVersesLeftToFind.clear();
+        std::set_difference(
+            BIBLE::BIBLE_VERSES.cbegin(),
+            BIBLE::BIBLE_VERSES.cend(),
+            Player->Inventory.BibleVerses.cbegin(),
+            Player->Inventory.BibleVerses.cend(),
+            std::inserter(BibleVersesLeftToFind, BibleVersesLeftToFind.begin()));
+    }
+
+    /// Summarizes the saved game data.  The time the game was saved isn't filled in.
+    /// @return The summary of the saved game.
+    SavedGameSummary SavedGameData::Summarize() const
+    {
+        // COUNT THE COLLECTED ANIMALS.
+        unsigned int collected_animal_count = 0;
+        for (unsigned int animal_species_id = 0; animal_species_id < OBJECTS::AnimalSpecies::COUNT; ++animal_species_id)
+        {
+            collected_animal_count += GetCollectedAnimalCount(static_cast<OBJECTS::AnimalSpecies::Value>(animal_species_id));
+        }
+
+        // COUNT THE COLLECTED FOOD.
+        unsigned int collected_food_count = std::accumulate(Player->Inventory.FoodCounts.cbegin(), Player->Inventory.FoodCounts.cend(), 0u);
+        collected_food_count = std::accumulate(FoodCountsOnArk.cbegin(), FoodCountsOnArk.cend(), collected_food_count);
+
+        // DETERMINE THE CURRENT FLOOD DAY.
+        unsigned int flood_day = 0;
+        unsigned int flood_hour = 0;
+        GAMEPLAY::FloodElapsedTime::GetCurrentDayAndHour(FloodElapsedGameplayTime, flood_day, flood_hour);
+
+        SavedGameSummary summary =
+        {
+            .Filepath = Filepath,
+            .CurrentGameState = CurrentGameState,
+            .FloodDay = flood_day,
+            .CollectedAnimalCount = collected_animal_count,
+            .CollectedBibleVerseCount = static_cast<unsigned int>(Player->Inventory.BibleVerses.size()),
+            .CollectedFoodCount = collected_food_count,
+        };
+        return summary;
     }
 
     /// Gets the total number of animals collected for the given species.
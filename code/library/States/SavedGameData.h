@@ -1,14 +1,19 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <filesystem>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 #include <SFML/System.hpp>
 #include "Bible/BibleVerse.h"
 #include "Containers/NestedArray.h"
+#include "Filesystem/BinaryReader.h"
+#include "Filesystem/BinaryWriter.h"
 #include "Inventory/AnimalCollectionStatistics.h"
 #include "Inventory/Inventory.h"
 #include "Math/Vector2.h"
@@ -18,25 +23,46 @@
 #include "Objects/FamilyMember.h"
 #include "Objects/Noah.h"
 #include "States/GameState.h"
+#include "States/SavedGameSummary.h"
 
 namespace STATES
 {
     /// The data for the saved state of a game.
+    ///
+    /// Saved game files start with a small header (a magic identifier followed by the file format version),
+    /// followed by a sequence of chunks.  Each chunk has a tag identifying its contents and the size of its data,
+    /// so readers can skip over any chunks they don't know about (like those added by newer versions of the game).
+    /// The first chunk is always a fixed-size summary of the game, so that the summary can be read on its own.
+    /// All values are written with explicit fixed-width little-endian encodings (see FILESYSTEM::BinaryWriter),
+    /// so files don't depend on the compiler that built the game.  Files written in the older layout
+    /// (raw memory of each value with no header) are still loaded and are migrated when next written.
+    /// Changes since a saved game file was last written may be in a separate journal (see SavedGameJournal),
+    /// which is applied when the saved game is loaded.
     class SavedGameData
     {
     public:
         // STATIC CONSTANTS.
         /// The default filepath for a saved game file.
         static const std::string DEFAULT_FILEPATH;
+        /// The bytes at the start of every saved game file in the chunked format.
+        static constexpr std::string_view FILE_MAGIC = "NOAH";
+        /// The current version of the saved game file format.
+        /// Only needs to be incremented if the meaning or order of existing chunks changes.
+        /// Version 2 added the summary as the first chunk.
+        static constexpr std::uint32_t FILE_FORMAT_VERSION = 2;
 
         // CONSTRUCTION.
         static SavedGameData DefaultSavedGameData();
         static std::unique_ptr<SavedGameData> Load(const std::filesystem::path& filepath);
+        static std::unique_ptr<SavedGameData> Deserialize(const std::string_view saved_game_bytes);
+        static std::optional<SavedGameSummary> LoadSummary(const std::filesystem::path& filepath);
 
         // WRITING.
         void Write(const std::filesystem::path& filepath) const;
+        std::string Serialize() const;
 
         // OTHER PUBLIC METHODS.
+        SavedGameSummary Summarize() const;
         unsigned int GetCollectedAnimalCount(const OBJECTS::AnimalSpecies::Value species) const;
         bool AnimalSpeciesCollectedAtAll(const OBJECTS::AnimalSpecies::Value species) const;
         bool AnimalTypeFullyCollected(const OBJECTS::AnimalType& animal_type) const;
@@ -47,6 +73,8 @@ namespace STATES
         bool ArkFullyBuilt() const;
         bool CollectedAllItemsRequiredBeforeFlood() const;
 
+        void AddFollowingAnimal(const OBJECTS::AnimalType& animal_type);
+
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The path to the file for this saved game.
         std::filesystem::path Filepath = "";
@@ -70,5 +98,45 @@ namespace STATES
         /// The amount of time that's elapsed during the flood, in terms of gameplay time.
         /// 1 year + 10 days are required for the flood to subside, though gameplay time is "sped up".
         sf::Time FloodElapsedGameplayTime = sf::Time::Zero;
+
+    private:
+        // CHUNKS.
+        /// Tags identifying the contents of each chunk in a saved game file.
+        /// Existing values must never be changed so that older files remain readable.
+        enum class ChunkId : std::uint32_t
+        {
+            /// The current game state.
+            GAME_STATE = 1,
+            /// The player's position and wood count.
+            PLAYER = 2,
+            /// Bible verses collected by the player.
+            COLLECTED_BIBLE_VERSES = 3,
+            /// Counts of food collected by the player.
+            PLAYER_FOOD_COUNTS = 4,
+            /// Animals currently following the player.
+            FOLLOWING_ANIMALS = 5,
+            /// Ark pieces built by the player.
+            BUILT_ARK_PIECES = 6,
+            /// Statistics for animals collected by the player.
+            COLLECTED_ANIMALS = 7,
+            /// Family members gathered by the player.
+            GATHERED_FAMILY_MEMBERS = 8,
+            /// Counts of food stored on the ark.
+            ARK_FOOD_COUNTS = 9,
+            /// The amount of time elapsed during the flood.
+            FLOOD_ELAPSED_TIME = 10,
+            /// A summary of the game, always written first.
+            SUMMARY = 11
+        };
+
+        static std::size_t BeginChunk(const ChunkId chunk_id, FILESYSTEM::BinaryWriter& writer);
+        static void EndChunk(const std::size_t chunk_start_offset_in_bytes, FILESYSTEM::BinaryWriter& writer);
+        void ReadChunk(const ChunkId chunk_id, FILESYSTEM::BinaryReader& chunk_reader);
+
+        // MIGRATION.
+        static std::unique_ptr<SavedGameData> DeserializeLegacyLayout(const std::string_view saved_game_bytes);
+
+        // HELPERS.
+        void InitializeBibleVersesLeftToFind();
     };
 }
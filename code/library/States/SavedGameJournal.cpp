@@ -0,0 +1,433 @@
+#include <algorithm>
+#include <set>
+#include "Bible/BibleVerses.h"
+#include "Objects/ArkPiece.h"
+#include "States/SavedGameJournal.h"
+
+namespace STATES
+{
+    /// Gets the path of the journal file for a saved game.
+    /// @param[in]  saved_game_filepath - The path to the saved game file.
+    /// @return The path to the journal file for the saved game.
+    std::filesystem::path SavedGameJournal::GetFilepath(const std::filesystem::path& saved_game_filepath)
+    {
+        std::filesystem::path journal_filepath = saved_game_filepath;
+        journal_filepath += FILE_EXTENSION;
+        return journal_filepath;
+    }
+
+    /// Applies changes in a journal to saved game data.  Nothing is applied if the journal
+    /// is for a different version of the saved game file.
+    /// @param[in]  saved_game_bytes - The bytes of the saved game file from which the saved game data was read.
+    /// @param[in]  journal_bytes - The bytes of the journal file for the saved game.
+    /// @param[in,out]  saved_game_data - The saved game data to which to apply the journaled changes.
+    void SavedGameJournal::Apply(const std::string_view saved_game_bytes, const std::string_view journal_bytes, SavedGameData& saved_game_data)
+    {
+        // MAKE SURE THE JOURNAL IS FOR THE SAVED GAME.
+        bool journal_has_header = journal_bytes.starts_with(FILE_MAGIC);
+        if (!journal_has_header)
+        {
+            return;
+        }
+
+        FILESYSTEM::BinaryReader reader(journal_bytes);
+        reader.Skip(FILE_MAGIC.size());
+        // The version is available for migrating any records whose meaning has changed.
+        [[maybe_unused]] std::uint32_t file_format_version = reader.ReadUInt32();
+        std::uint64_t journaled_saved_game_hash = reader.ReadUInt64();
+        bool journal_for_saved_game = !reader.Failed() && (Hash(saved_game_bytes) == journaled_saved_game_hash);
+        if (!journal_for_saved_game)
+        {
+            return;
+        }
+
+        // APPLY EACH RECORD IN THE ORDER JOURNALED.
+        constexpr std::size_t RECORD_HEADER_SIZE_IN_BYTES = 2 * sizeof(std::uint32_t);
+        while (reader.RemainingByteCount() >= RECORD_HEADER_SIZE_IN_BYTES)
+        {
+            RecordId record_id = static_cast<RecordId>(reader.ReadUInt32());
+            std::uint32_t record_size_in_bytes = reader.ReadUInt32();
+
+            // STOP AT ANY INCOMPLETE RECORD.
+            // The game may have stopped while the last record was being written.
+            bool record_complete = (record_size_in_bytes <= reader.RemainingByteCount());
+            if (!record_complete)
+            {
+                break;
+            }
+
+            FILESYSTEM::BinaryReader record_reader(reader.ReadBytes(record_size_in_bytes));
+            ApplyRecord(record_id, record_reader, saved_game_data);
+        }
+    }
+
+    /// Starts a new journal for saved game data that has just been fully serialized.
+    /// @param[in]  saved_game_data - The saved game data that was serialized.
+    /// @param[in]  saved_game_bytes - The serialized bytes of the saved game data, as written to its file.
+    void SavedGameJournal::Reset(const SavedGameData& saved_game_data, const std::string_view saved_game_bytes)
+    {
+        // START A NEW JOURNAL FOR THE SAVED GAME FILE.
+        SavedGameFilepath = saved_game_data.Filepath;
+        SizeInBytes = 0;
+        SavedGameHash = Hash(saved_game_bytes);
+
+        // TRACK WHICH BIBLE VERSES HAVE BEEN COLLECTED.
+        const std::set<BIBLE::BibleVerse>& collected_bible_verses = saved_game_data.Player->Inventory.BibleVerses;
+        BibleVersesCollected.assign(BIBLE::BIBLE_VERSES.size(), false);
+        for (const BIBLE::BibleVerse& collected_bible_verse : collected_bible_verses)
+        {
+            auto matching_bible_verse = std::lower_bound(BIBLE::BIBLE_VERSES.cbegin(), BIBLE::BIBLE_VERSES.cend(), collected_bible_verse);
+            bool bible_verse_known = (BIBLE::BIBLE_VERSES.cend() != matching_bible_verse) && (*matching_bible_verse == collected_bible_verse);
+            if (bible_verse_known)
+            {
+                std::size_t bible_verse_index = static_cast<std::size_t>(matching_bible_verse - BIBLE::BIBLE_VERSES.cbegin());
+                BibleVersesCollected[bible_verse_index] = true;
+            }
+        }
+        CollectedBibleVerseCount = collected_bible_verses.size();
+
+        // TRACK THE REST OF THE SAVED GAME DATA THAT MAY BE JOURNALED.
+        BuiltArkPieceCount = saved_game_data.BuiltArkPieces.size();
+        CollectedAnimalsBySpeciesThenGender = saved_game_data.CollectedAnimalsBySpeciesThenGender;
+        PlayerFoodCounts = saved_game_data.Player->Inventory.FoodCounts;
+        FoodCountsOnArk = saved_game_data.FoodCountsOnArk;
+        FollowingAnimalTypes = GetFollowingAnimalTypes(saved_game_data);
+    }
+
+    /// Records changes to saved game data since the last time changes were recorded (or the journal was reset).
+    /// @param[in]  saved_game_data - The saved game data whose changes to record.  Should be for the saved game file being journaled.
+    /// @param[in,out]  writer - The writer to which to write the records, to be appended to the journal file.
+    ///     If the journal is new, its header is written first.
+    /// @return True if the changes were recorded; false if they can't be journaled, in which case
+    ///     the saved game must be fully written and the journal reset (and anything written discarded).
+    bool SavedGameJournal::RecordChanges(const SavedGameData& saved_game_data, FILESYSTEM::BinaryWriter& writer)
+    {
+        // MAKE SURE THE CHANGES CAN BE JOURNALED.
+        // Collected Bible verses and built ark pieces are only ever added to during a game, so only additions
+        // are journaled.  Removals would mean a different game is being saved to the same file.
+        const std::set<BIBLE::BibleVerse>& collected_bible_verses = saved_game_data.Player->Inventory.BibleVerses;
+        bool bible_verses_removed = (collected_bible_verses.size() < CollectedBibleVerseCount);
+        bool ark_pieces_removed = (saved_game_data.BuiltArkPieces.size() < BuiltArkPieceCount);
+        if (bible_verses_removed || ark_pieces_removed)
+        {
+            return false;
+        }
+
+        std::size_t journal_start_offset_in_bytes = writer.Bytes.size();
+
+        // WRITE THE HEADER FOR A NEW JOURNAL.
+        bool journal_new = (0 == SizeInBytes);
+        if (journal_new)
+        {
+            writer.WriteBytes(FILE_MAGIC);
+            writer.WriteUInt32(FILE_FORMAT_VERSION);
+            writer.WriteUInt64(SavedGameHash);
+        }
+
+        // RECORD THE PLAYER'S OVERALL PROGRESS.
+        std::size_t record_start_offset_in_bytes = BeginRecord(RecordId::GAME_PROGRESS, writer);
+        writer.WriteUInt32(static_cast<std::uint32_t>(saved_game_data.CurrentGameState));
+        MATH::Vector2f player_world_position = saved_game_data.Player->GetWorldPosition();
+        writer.WriteFloat(player_world_position.X);
+        writer.WriteFloat(player_world_position.Y);
+        writer.WriteUInt32(saved_game_data.Player->Inventory.WoodCount);
+        writer.WriteFloat(saved_game_data.Player->Inventory.FollowingAnimals.CurrentCenterWorldPosition.X);
+        writer.WriteFloat(saved_game_data.Player->Inventory.FollowingAnimals.CurrentCenterWorldPosition.Y);
+        writer.WriteFloat(saved_game_data.FloodElapsedGameplayTime.asSeconds());
+        writer.WriteUInt32(static_cast<std::uint32_t>(saved_game_data.FamilyMembersGathered.size()));
+        for (bool family_member_gathered : saved_game_data.FamilyMembersGathered)
+        {
+            writer.WriteBool(family_member_gathered);
+        }
+        EndRecord(record_start_offset_in_bytes, writer);
+
+        // RECORD ANY CHANGE IN WHICH ANIMALS ARE FOLLOWING THE PLAYER.
+        std::vector<OBJECTS::AnimalType> following_animal_types = GetFollowingAnimalTypes(saved_game_data);
+        bool following_animals_changed = (FollowingAnimalTypes != following_animal_types);
+        if (following_animals_changed)
+        {
+            record_start_offset_in_bytes = BeginRecord(RecordId::FOLLOWING_ANIMALS, writer);
+            writer.WriteUInt32(static_cast<std::uint32_t>(following_animal_types.size()));
+            for (const OBJECTS::AnimalType& animal_type : following_animal_types)
+            {
+                writer.WriteUInt32(static_cast<std::uint32_t>(animal_type.Species));
+                writer.WriteUInt32(static_cast<std::uint32_t>(animal_type.Gender));
+            }
+            EndRecord(record_start_offset_in_bytes, writer);
+
+            FollowingAnimalTypes = std::move(following_animal_types);
+        }
+
+        // RECORD ANY NEWLY COLLECTED BIBLE VERSES.
+        // Only the index of each verse is needed since the text of every verse is already known.
+        bool bible_verses_collected = (collected_bible_verses.size() != CollectedBibleVerseCount);
+        if (bible_verses_collected)
+        {
+            for (const BIBLE::BibleVerse& collected_bible_verse : collected_bible_verses)
+            {
+                auto matching_bible_verse = std::lower_bound(BIBLE::BIBLE_VERSES.cbegin(), BIBLE::BIBLE_VERSES.cend(), collected_bible_verse);
+                bool bible_verse_known = (BIBLE::BIBLE_VERSES.cend() != matching_bible_verse) && (*matching_bible_verse == collected_bible_verse);
+                if (!bible_verse_known)
+                {
+                    return false;
+                }
+
+                std::size_t bible_verse_index = static_cast<std::size_t>(matching_bible_verse - BIBLE::BIBLE_VERSES.cbegin());
+                bool bible_verse_already_journaled = BibleVersesCollected[bible_verse_index];
+                if (bible_verse_already_journaled)
+                {
+                    continue;
+                }
+
+                record_start_offset_in_bytes = BeginRecord(RecordId::BIBLE_VERSE_COLLECTED, writer);
+                writer.WriteUInt32(static_cast<std::uint32_t>(bible_verse_index));
+                EndRecord(record_start_offset_in_bytes, writer);
+
+                BibleVersesCollected[bible_verse_index] = true;
+            }
+            CollectedBibleVerseCount = collected_bible_verses.size();
+        }
+
+        // RECORD ANY NEWLY BUILT ARK PIECES.
+        // Ark pieces are only ever added to the end of those built.
+        for (std::size_t ark_piece_index = BuiltArkPieceCount; ark_piece_index < saved_game_data.BuiltArkPieces.size(); ++ark_piece_index)
+        {
+            const OBJECTS::ArkPiece& ark_piece = saved_game_data.BuiltArkPieces[ark_piece_index];
+            record_start_offset_in_bytes = BeginRecord(RecordId::ARK_PIECE_BUILT, writer);
+            writer.WriteUInt32(ark_piece.Id);
+            writer.WriteFloat(ark_piece.Sprite.WorldPosition.X);
+            writer.WriteFloat(ark_piece.Sprite.WorldPosition.Y);
+            writer.WriteBool(ark_piece.Built);
+            writer.WriteBool(ark_piece.IsExternalDoorway);
+            EndRecord(record_start_offset_in_bytes, writer);
+        }
+        BuiltArkPieceCount = saved_game_data.BuiltArkPieces.size();
+
+        // RECORD ANY CHANGES TO COLLECTED ANIMALS.
+        for (unsigned int species_id = 0; species_id < OBJECTS::AnimalSpecies::COUNT; ++species_id)
+        {
+            for (unsigned int gender_id = 0; gender_id < OBJECTS::AnimalGender::COUNT; ++gender_id)
+            {
+                const INVENTORY::AnimalCollectionStatistics& animal_statistics = saved_game_data.CollectedAnimalsBySpeciesThenGender[species_id][gender_id];
+                INVENTORY::AnimalCollectionStatistics& journaled_animal_statistics = CollectedAnimalsBySpeciesThenGender[species_id][gender_id];
+                bool animal_statistics_changed = (journaled_animal_statistics != animal_statistics);
+                if (!animal_statistics_changed)
+                {
+                    continue;
+                }
+
+                record_start_offset_in_bytes = BeginRecord(RecordId::ANIMAL_COLLECTION_CHANGED, writer);
+                writer.WriteUInt32(species_id);
+                writer.WriteUInt32(gender_id);
+                writer.WriteUInt32(animal_statistics.FollowingPlayerCount);
+                writer.WriteUInt32(animal_statistics.InArkCount);
+                writer.WriteUInt32(animal_statistics.AnimalPenTileMapLayerIndex);
+                writer.WriteUInt32(animal_statistics.AnimalPenTileMapColumnIndex);
+                writer.WriteUInt32(animal_statistics.AnimalPenTileMapRowIndex);
+                writer.WriteUInt32(animal_statistics.AnimalPenTileMapPenIndex);
+                EndRecord(record_start_offset_in_bytes, writer);
+
+                journaled_animal_statistics = animal_statistics;
+            }
+        }
+
+        // RECORD ANY CHANGES TO FOOD COUNTS.
+        for (unsigned int food_id = 0; food_id < OBJECTS::Food::TypeId::COUNT; ++food_id)
+        {
+            unsigned int player_food_count = saved_game_data.Player->Inventory.FoodCounts[food_id];
+            bool player_food_count_changed = (PlayerFoodCounts[food_id] != player_food_count);
+            if (player_food_count_changed)
+            {
+                record_start_offset_in_bytes = BeginRecord(RecordId::PLAYER_FOOD_COUNT_CHANGED, writer);
+                writer.WriteUInt32(food_id);
+                writer.WriteUInt32(player_food_count);
+                EndRecord(record_start_offset_in_bytes, writer);
+
+                PlayerFoodCounts[food_id] = player_food_count;
+            }
+
+            unsigned int ark_food_count = saved_game_data.FoodCountsOnArk[food_id];
+            bool ark_food_count_changed = (FoodCountsOnArk[food_id] != ark_food_count);
+            if (ark_food_count_changed)
+            {
+                record_start_offset_in_bytes = BeginRecord(RecordId::ARK_FOOD_COUNT_CHANGED, writer);
+                writer.WriteUInt32(food_id);
+                writer.WriteUInt32(ark_food_count);
+                EndRecord(record_start_offset_in_bytes, writer);
+
+                FoodCountsOnArk[food_id] = ark_food_count;
+            }
+        }
+
+        // TRACK HOW LARGE THE JOURNAL HAS GROWN.
+        SizeInBytes += writer.Bytes.size() - journal_start_offset_in_bytes;
+        return true;
+    }
+
+    /// Begins writing a record by writing its header.  The size of the record is filled in once the record is ended.
+    /// @param[in]  record_id - The ID of the record.
+    /// @param[in,out]  writer - The writer to write the record header to.
+    /// @return The offset of the start of the record, needed for ending it.
+    std::size_t SavedGameJournal::BeginRecord(const RecordId record_id, FILESYSTEM::BinaryWriter& writer)
+    {
+        std::size_t record_start_offset_in_bytes = writer.Bytes.size();
+        writer.WriteUInt32(static_cast<std::uint32_t>(record_id));
+        // A placeholder size is written until the real size is known.
+        writer.WriteUInt32(0);
+        return record_start_offset_in_bytes;
+    }
+
+    /// Ends writing a record by filling in its size in its header.
+    /// @param[in]  record_start_offset_in_bytes - The offset of the start of the record, as returned when it was begun.
+    /// @param[in,out]  writer - The writer to which the record was written.
+    void SavedGameJournal::EndRecord(const std::size_t record_start_offset_in_bytes, FILESYSTEM::BinaryWriter& writer)
+    {
+        std::size_t record_size_offset_in_bytes = record_start_offset_in_bytes + sizeof(std::uint32_t);
+        std::size_t record_data_offset_in_bytes = record_size_offset_in_bytes + sizeof(std::uint32_t);
+        std::size_t record_size_in_bytes = writer.Bytes.size() - record_data_offset_in_bytes;
+        writer.OverwriteUInt32(record_size_offset_in_bytes, static_cast<std::uint32_t>(record_size_in_bytes));
+    }
+
+    /// Applies a single record to saved game data.  Unknown records and invalid values are ignored.
+    /// @param[in]  record_id - The ID of the record.
+    /// @param[in,out]  record_reader - A reader for just the data of the record.
+    /// @param[in,out]  saved_game_data - The saved game data to which to apply the record.
+    void SavedGameJournal::ApplyRecord(const RecordId record_id, FILESYSTEM::BinaryReader& record_reader, SavedGameData& saved_game_data)
+    {
+        switch (record_id)
+        {
+            case RecordId::GAME_PROGRESS:
+            {
+                saved_game_data.CurrentGameState = static_cast<GameState>(record_reader.ReadUInt32());
+                MATH::Vector2f player_world_position;
+                player_world_position.X = record_reader.ReadFloat();
+                player_world_position.Y = record_reader.ReadFloat();
+                saved_game_data.Player->SetWorldPosition(player_world_position);
+                saved_game_data.Player->Inventory.WoodCount = record_reader.ReadUInt32();
+                saved_game_data.Player->Inventory.FollowingAnimals.CurrentCenterWorldPosition.X = record_reader.ReadFloat();
+                saved_game_data.Player->Inventory.FollowingAnimals.CurrentCenterWorldPosition.Y = record_reader.ReadFloat();
+                saved_game_data.FloodElapsedGameplayTime = sf::seconds(record_reader.ReadFloat());
+
+                std::uint32_t family_member_count = record_reader.ReadUInt32();
+                for (std::uint32_t family_member_id = 0; family_member_id < family_member_count && family_member_id < saved_game_data.FamilyMembersGathered.size(); ++family_member_id)
+                {
+                    saved_game_data.FamilyMembersGathered[family_member_id] = record_reader.ReadBool();
+                }
+                break;
+            }
+            case RecordId::FOLLOWING_ANIMALS:
+            {
+                saved_game_data.Player->Inventory.FollowingAnimals.Animals.clear();
+                std::uint32_t following_animal_count = record_reader.ReadUInt32();
+                for (std::uint32_t animal_index = 0; animal_index < following_animal_count && !record_reader.Failed(); ++animal_index)
+                {
+                    OBJECTS::AnimalSpecies::Value animal_species = static_cast<OBJECTS::AnimalSpecies::Value>(record_reader.ReadUInt32());
+                    OBJECTS::AnimalGender::Value animal_gender = static_cast<OBJECTS::AnimalGender::Value>(record_reader.ReadUInt32());
+                    saved_game_data.AddFollowingAnimal(OBJECTS::AnimalType(animal_species, animal_gender));
+                }
+                break;
+            }
+            case RecordId::BIBLE_VERSE_COLLECTED:
+            {
+                std::uint32_t bible_verse_index = record_reader.ReadUInt32();
+                bool bible_verse_known = !record_reader.Failed() && (bible_verse_index < BIBLE::BIBLE_VERSES.size());
+                if (bible_verse_known)
+                {
+                    const BIBLE::BibleVerse& collected_bible_verse = BIBLE::BIBLE_VERSES[bible_verse_index];
+                    saved_game_data.Player->Inventory.BibleVerses.insert(collected_bible_verse);
+
+                    // The verse no longer needs to be found.
+                    std::erase(saved_game_data.BibleVersesLeftToFind, collected_bible_verse);
+                }
+                break;
+            }
+            case RecordId::ARK_PIECE_BUILT:
+            {
+                OBJECTS::ArkPiece ark_piece(record_reader.ReadUInt32());
+                ark_piece.Sprite.WorldPosition.X = record_reader.ReadFloat();
+                ark_piece.Sprite.WorldPosition.Y = record_reader.ReadFloat();
+                ark_piece.Built = record_reader.ReadBool();
+                ark_piece.IsExternalDoorway = record_reader.ReadBool();
+                if (!record_reader.Failed())
+                {
+                    saved_game_data.BuiltArkPieces.emplace_back(ark_piece);
+                }
+                break;
+            }
+            case RecordId::ANIMAL_COLLECTION_CHANGED:
+            {
+                std::uint32_t species_id = record_reader.ReadUInt32();
+                std::uint32_t gender_id = record_reader.ReadUInt32();
+                INVENTORY::AnimalCollectionStatistics animal_statistics;
+                animal_statistics.FollowingPlayerCount = record_reader.ReadUInt32();
+                animal_statistics.InArkCount = record_reader.ReadUInt32();
+                animal_statistics.AnimalPenTileMapLayerIndex = record_reader.ReadUInt32();
+                animal_statistics.AnimalPenTileMapColumnIndex = record_reader.ReadUInt32();
+                animal_statistics.AnimalPenTileMapRowIndex = record_reader.ReadUInt32();
+                animal_statistics.AnimalPenTileMapPenIndex = record_reader.ReadUInt32();
+
+                bool animal_type_known = (species_id < OBJECTS::AnimalSpecies::COUNT) && (gender_id < OBJECTS::AnimalGender::COUNT);
+                if (animal_type_known && !record_reader.Failed())
+                {
+                    saved_game_data.CollectedAnimalsBySpeciesThenGender[species_id][gender_id] = animal_statistics;
+                }
+                break;
+            }
+            case RecordId::PLAYER_FOOD_COUNT_CHANGED:
+            {
+                std::uint32_t food_id = record_reader.ReadUInt32();
+                unsigned int food_count = record_reader.ReadUInt32();
+                bool food_known = !record_reader.Failed() && (food_id < saved_game_data.Player->Inventory.FoodCounts.size());
+                if (food_known)
+                {
+                    saved_game_data.Player->Inventory.FoodCounts[food_id] = food_count;
+                }
+                break;
+            }
+            case RecordId::ARK_FOOD_COUNT_CHANGED:
+            {
+                std::uint32_t food_id = record_reader.ReadUInt32();
+                unsigned int food_count = record_reader.ReadUInt32();
+                bool food_known = !record_reader.Failed() && (food_id < saved_game_data.FoodCountsOnArk.size());
+                if (food_known)
+                {
+                    saved_game_data.FoodCountsOnArk[food_id] = food_count;
+                }
+                break;
+            }
+            default:
+                // Records from newer versions of the game are skipped.
+                break;
+        }
+    }
+
+    /// Computes a hash of bytes that is the same across all builds of the game (64-bit FNV-1a).
+    /// @param[in]  bytes - The bytes to hash.
+    /// @return The hash of the bytes.
+    std::uint64_t SavedGameJournal::Hash(const std::string_view bytes)
+    {
+        constexpr std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+        constexpr std::uint64_t FNV_PRIME = 1099511628211ull;
+
+        std::uint64_t hash = FNV_OFFSET_BASIS;
+        for (char byte : bytes)
+        {
+            hash ^= static_cast<std::uint8_t>(byte);
+            hash *= FNV_PRIME;
+        }
+        return hash;
+    }
+
+    /// Gets the types of animals following the player, in the order they're following.
+    /// @param[in]  saved_game_data - The saved game data with the following animals.
+    /// @return The types of animals following the player.
+    std::vector<OBJECTS::AnimalType> SavedGameJournal::GetFollowingAnimalTypes(const SavedGameData& saved_game_data)
+    {
+        std::vector<OBJECTS::AnimalType> following_animal_types;
+        for (const auto& animal : saved_game_data.Player->Inventory.FollowingAnimals.Animals)
+        {
+            following_animal_types.push_back(animal->Type);
+        }
+        return following_animal_types;
+    }
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+#include <vector>
+#include "Containers/NestedArray.h"
+#include "Filesystem/BinaryReader.h"
+#include "Filesystem/BinaryWriter.h"
+#include "Inventory/AnimalCollectionStatistics.h"
+#include "Objects/Animal.h"
+#include "Objects/Food.h"
+#include "States/SavedGameData.h"
+
+namespace STATES
+{
+    /// A journal of changes to a saved game since the saved game file was last fully written.
+    ///
+    /// Fully writing a saved game rewrites everything (including the text of every collected Bible verse),
+    /// so the cost of saving grows as the player progresses.  Instead, most saves just append small records
+    /// of what changed since the previous save (Bible verses collected, ark pieces built, animals collected,
+    /// food counts, and the player's overall progress) to a journal file next to the saved game file.
+    /// The journal is periodically compacted by fully writing the saved game again and removing the journal.
+    ///
+    /// Changes are found by comparing saved game data against compact copies of what has already been journaled,
+    /// so gameplay code doesn't need to report changes as they happen.  Records hold new values (rather than
+    /// amounts of change) and use the same tagged, sized layout as saved game chunks, so unknown or incomplete
+    /// records at the end of a journal can be skipped.  Journals start with a hash of the saved game file they
+    /// apply to, so a journal left over from before a saved game was fully written again is ignored.
+    class SavedGameJournal
+    {
+    public:
+        // CONSTANTS.
+        /// The bytes at the start of every journal file.
+        static constexpr std::string_view FILE_MAGIC = "NOAJ";
+        /// The current version of the journal file format.
+        static constexpr std::uint32_t FILE_FORMAT_VERSION = 1;
+        /// The extension added to a saved game's filepath for its journal.
+        static constexpr std::string_view FILE_EXTENSION = ".journal";
+
+        // FILEPATHS.
+        static std::filesystem::path GetFilepath(const std::filesystem::path& saved_game_filepath);
+
+        // READING.
+        static void Apply(const std::string_view saved_game_bytes, const std::string_view journal_bytes, SavedGameData& saved_game_data);
+
+        // RECORDING.
+        void Reset(const SavedGameData& saved_game_data, const std::string_view saved_game_bytes);
+        bool RecordChanges(const SavedGameData& saved_game_data, FILESYSTEM::BinaryWriter& writer);
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The path to the saved game file whose changes are being journaled.  Empty if nothing is being journaled yet.
+        std::filesystem::path SavedGameFilepath = "";
+        /// The size of the journal (including its header) recorded since the saved game was last fully written.
+        std::size_t SizeInBytes = 0;
+
+    private:
+        // RECORDS.
+        /// Tags identifying the contents of each record in a journal.
+        /// Existing values must never be changed so that older journals remain readable.
+        enum class RecordId : std::uint32_t
+        {
+            /// The game state, player position, wood count, family members gathered, and flood elapsed time.
+            /// Small enough to be recorded on every save.
+            GAME_PROGRESS = 1,
+            /// The types of animals following the player.
+            FOLLOWING_ANIMALS = 2,
+            /// A Bible verse collected by the player, by index into all Bible verses.
+            BIBLE_VERSE_COLLECTED = 3,
+            /// An ark piece built by the player.
+            ARK_PIECE_BUILT = 4,
+            /// New statistics for a single type of animal.
+            ANIMAL_COLLECTION_CHANGED = 5,
+            /// A new count for a single type of food carried by the player.
+            PLAYER_FOOD_COUNT_CHANGED = 6,
+            /// A new count for a single type of food stored on the ark.
+            ARK_FOOD_COUNT_CHANGED = 7
+        };
+
+        static std::size_t BeginRecord(const RecordId record_id, FILESYSTEM::BinaryWriter& writer);
+        static void EndRecord(const std::size_t record_start_offset_in_bytes, FILESYSTEM::BinaryWriter& writer);
+        static void ApplyRecord(const RecordId record_id, FILESYSTEM::BinaryReader& record_reader, SavedGameData& saved_game_data);
+
+        // HELPERS.
+        static std::uint64_t Hash(const std::string_view bytes);
+        static std::vector<OBJECTS::AnimalType> GetFollowingAnimalTypes(const SavedGameData& saved_game_data);
+
+        // MEMBER VARIABLES.
+        /// The hash of the saved game file to which the journal applies.
+        std::uint64_t SavedGameHash = 0;
+        /// Whether each Bible verse (indexed the same as all Bible verses) has been journaled as collected.
+        std::vector<bool> BibleVersesCollected = {};
+        /// The number of Bible verses collected as of the last journaled save.
+        std::size_t CollectedBibleVerseCount = 0;
+        /// The number of ark pieces built as of the last journaled save.
+        std::size_t BuiltArkPieceCount = 0;
+        /// Statistics for animals collected as of the last journaled save.
+        CONTAINERS::NestedEnumArray<INVENTORY::AnimalCollectionStatistics, OBJECTS::AnimalSpecies, OBJECTS::AnimalGender>
+            CollectedAnimalsBySpeciesThenGender = {};
+        /// Counts of food carried by the player as of the last journaled save.
+        std::array<unsigned int, OBJECTS::Food::TypeId::COUNT> PlayerFoodCounts = {};
+        /// Counts of food stored on the ark as of the last journaled save.
+        std::array<unsigned int, OBJECTS::Food::TypeId::COUNT> FoodCountsOnArk = {};
+        /// The types of animals following the player as of the last journaled save.
+        std::vector<OBJECTS::AnimalType> FollowingAnimalTypes = {};
+    };
+}
@@ -0,0 +1,58 @@
+#include "States/SavedGameSummary.h"
+
+namespace STATES
+{
+    /// Reads a summary as written to a saved game file.
+    /// @param[in,out]  reader - The reader from which to read the summary.
+    /// @return The summary read.
+    SavedGameSummary SavedGameSummary::Read(FILESYSTEM::BinaryReader& reader)
+    {
+        SavedGameSummary summary;
+        summary.CurrentGameState = static_cast<GameState>(reader.ReadUInt32());
+        summary.FloodDay = reader.ReadUInt32();
+        summary.CollectedAnimalCount = reader.ReadUInt32();
+        summary.CollectedBibleVerseCount = reader.ReadUInt32();
+        summary.CollectedFoodCount = reader.ReadUInt32();
+        summary.SavedTimeInSecondsSinceEpoch = reader.ReadUInt64();
+        return summary;
+    }
+
+    /// Writes the summary to be stored in a saved game file.
+    /// Exactly SIZE_IN_BYTES will be written.
+    /// @param[in,out]  writer - The writer to which to write the summary.
+    void SavedGameSummary::Write(FILESYSTEM::BinaryWriter& writer) const
+    {
+        writer.WriteUInt32(static_cast<std::uint32_t>(CurrentGameState));
+        writer.WriteUInt32(FloodDay);
+        writer.WriteUInt32(CollectedAnimalCount);
+        writer.WriteUInt32(CollectedBibleVerseCount);
+        writer.WriteUInt32(CollectedFoodCount);
+        writer.WriteUInt64(SavedTimeInSecondsSinceEpoch);
+    }
+
+    /// Gets a short description of the progress in the saved game for displaying to the player.
+    /// @return A single line describing the progress in the game.
+    std::string SavedGameSummary::ToString() const
+    {
+        // DESCRIBE A NEW GAME.
+        if (NewGame)
+        {
+            return "New game";
+        }
+
+        // DESCRIBE THE FLOOD DAY IF THE FLOOD HAS STARTED.
+        std::string summary_text;
+        bool flood_started = (CurrentGameState >= GameState::DURING_FLOOD_GAMEPLAY);
+        if (flood_started)
+        {
+            summary_text += "Day " + std::to_string(FloodDay) + "  ";
+        }
+
+        // DESCRIBE THE COLLECTED ITEMS.
+        summary_text +=
+            "Animals: " + std::to_string(CollectedAnimalCount) +
+            "  Verses: " + std::to_string(CollectedBibleVerseCount) +
+            "  Food: " + std::to_string(CollectedFoodCount);
+        return summary_text;
+    }
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include "Filesystem/BinaryReader.h"
+#include "Filesystem/BinaryWriter.h"
+#include "States/GameState.h"
+
+namespace STATES
+{
+    /// A small summary of a saved game, suitable for showing the player which game they might want to play.
+    /// Summaries are stored at the start of saved game files with a fixed size so that they can be read
+    /// without loading (or even reading) the rest of the saved game.
+    class SavedGameSummary
+    {
+    public:
+        // CONSTANTS.
+        /// The size of a summary when written to a saved game file.
+        static constexpr std::size_t SIZE_IN_BYTES = 5 * sizeof(std::uint32_t) + sizeof(std::uint64_t);
+
+        // SERIALIZATION.
+        static SavedGameSummary Read(FILESYSTEM::BinaryReader& reader);
+        void Write(FILESYSTEM::BinaryWriter& writer) const;
+
+        // OTHER METHODS.
+        std::string ToString() const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The path to the file for the saved game.  Not written to saved game files.
+        std::filesystem::path Filepath = "";
+        /// True if the summary is for a new game that doesn't have any saved data yet.  Not written to saved game files.
+        bool NewGame = false;
+        /// The state the game was in when saved.
+        GameState CurrentGameState = GameState::INTRO_SEQUENCE;
+        /// The current day of the flood (0 if the flood hasn't started).
+        unsigned int FloodDay = 0;
+        /// The total number of animals collected.
+        unsigned int CollectedAnimalCount = 0;
+        /// The number of Bible verses collected.
+        unsigned int CollectedBibleVerseCount = 0;
+        /// The total amount of food collected (including food stored on the ark).
+        unsigned int CollectedFoodCount = 0;
+        /// When the game was saved, in seconds since the start of 1970 (UTC).
+        std::uint64_t SavedTimeInSecondsSinceEpoch = 0;
+    };
+}
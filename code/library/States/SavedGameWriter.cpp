@@ -0,0 +1,217 @@
+#include <string>
+#include "ErrorHandling/ErrorMessageBox.h"
+#include "Filesystem/File.h"
+#include "States/SavedGameWriter.h"
+
+namespace STATES
+{
+    /// Creates the writer, starting its background thread.
+    SavedGameWriter::SavedGameWriter()
+    {
+        WriterThread = std::thread(&SavedGameWriter::WriteSaves, this);
+    }
+
+    /// Stops the background thread, after finishing any pending saves so that they aren't lost.
+    SavedGameWriter::~SavedGameWriter()
+    {
+        // STOP THE BACKGROUND THREAD.
+        {
+            std::lock_guard<std::mutex> lock(SavesMutex);
+            Stopping = true;
+        }
+        SaveRequestedOrStopping.notify_one();
+
+        // WAIT FOR THE BACKGROUND THREAD TO FINISH.
+        if (WriterThread.joinable())
+        {
+            WriterThread.join();
+        }
+    }
+
+    /// A completion callback that lets the player know if a save failed.
+    /// @param[in]  filepath - The path of the file that was being saved.
+    /// @param[in]  saved - True if the save succeeded; false otherwise.
+    void SavedGameWriter::DisplayErrorIfNotSaved(const std::filesystem::path& filepath, const bool saved)
+    {
+        if (!saved)
+        {
+            std::string error_message = "Error writing saved game data file: " + filepath.string();
+            ERROR_HANDLING::ErrorMessageBox::Display(error_message.c_str());
+        }
+    }
+
+    /// Requests that saved game data be written to its file on the background thread.
+    /// The data is captured as of when this method is called, so it can keep changing during the save.
+    /// Only changes since the previous save are captured if they can be journaled.
+    /// @param[in]  saved_game_data - The saved game data to write.
+    /// @param[in]  completion_callback - The callback to call (when dispatched) once the save completes.
+    void SavedGameWriter::Save(const SavedGameData& saved_game_data, const CompletionCallback& completion_callback)
+    {
+        // CAPTURE ONLY THE CHANGES TO THE SAVED GAME DATA IF POSSIBLE.
+        // This is done outside of the lock to avoid holding up the background thread.
+        // Changes can only be journaled if this writer has fully written the saved game before.
+        PendingSave pending_save =
+        {
+            .Filepath = saved_game_data.Filepath,
+            .Callback = completion_callback,
+        };
+        bool previous_save_failed = SaveFailed.exchange(false);
+        bool journal_for_saved_game = (Journal.SavedGameFilepath == saved_game_data.Filepath) && !previous_save_failed;
+        bool journal_needs_compacting = (Journal.SizeInBytes >= MaxJournalSizeInBytes);
+        bool changes_journaled = false;
+        if (journal_for_saved_game && !journal_needs_compacting)
+        {
+            // A new journal replaces any old one left over from an earlier failed save.
+            pending_save.Type = (0 == Journal.SizeInBytes) ? SaveType::NEW_JOURNAL : SaveType::JOURNAL_ENTRY;
+
+            FILESYSTEM::BinaryWriter journal_writer;
+            changes_journaled = Journal.RecordChanges(saved_game_data, journal_writer);
+            pending_save.Bytes = std::move(journal_writer.Bytes);
+        }
+
+        // CAPTURE ALL OF THE SAVED GAME DATA IF NEEDED.
+        if (!changes_journaled)
+        {
+            pending_save.Type = SaveType::FULL_SAVED_GAME;
+            pending_save.Bytes = saved_game_data.Serialize();
+            Journal.Reset(saved_game_data, pending_save.Bytes);
+        }
+
+        // HAND OFF THE SAVE TO THE BACKGROUND THREAD.
+        {
+            std::lock_guard<std::mutex> lock(SavesMutex);
+            PendingSaves.emplace_back(std::move(pending_save));
+        }
+        SaveRequestedOrStopping.notify_one();
+
+        // RESTART THE AUTOSAVE TIMER.
+        // There's no need to autosave right after any other save.
+        TimeSinceLastSave = sf::Time::Zero;
+    }
+
+    /// Automatically saves the game if enough time has passed since the last save.
+    /// Should be called every frame during gameplay.
+    /// @param[in]  elapsed_time - The time elapsed since this method was last called.
+    /// @param[in]  saved_game_data - The saved game data to potentially save.
+    void SavedGameWriter::UpdateAutosave(const sf::Time& elapsed_time, const SavedGameData& saved_game_data)
+    {
+        // CHECK IF IT'S TIME TO AUTOSAVE.
+        TimeSinceLastSave += elapsed_time;
+        bool autosave_due = (TimeSinceLastSave >= AutosaveInterval);
+        if (!autosave_due)
+        {
+            return;
+        }
+
+        // AUTOSAVE THE GAME.
+        Save(saved_game_data, AutosaveCompletionCallback);
+    }
+
+    /// Calls the callbacks for any saves that have completed since this method was last called.
+    /// Should be called every frame so that callbacks happen shortly after saves complete.
+    void SavedGameWriter::DispatchCompletedSaves()
+    {
+        // TAKE THE COMPLETED SAVES.
+        // Callbacks are called outside of the lock in case they request more saves.
+        std::vector<CompletedSave> completed_saves;
+        {
+            std::lock_guard<std::mutex> lock(SavesMutex);
+            completed_saves.swap(CompletedSaves);
+        }
+
+        // CALL THE CALLBACK FOR EACH COMPLETED SAVE.
+        for (const CompletedSave& completed_save : completed_saves)
+        {
+            if (completed_save.Callback)
+            {
+                completed_save.Callback(completed_save.Filepath, completed_save.Saved);
+            }
+        }
+    }
+
+    /// Waits until all pending saves have been written.  Normally only needed when the game is exiting
+    /// or when saved game files need to be read, since waiting blocks the game thread.
+    void SavedGameWriter::WaitForPendingSaves()
+    {
+        std::unique_lock<std::mutex> lock(SavesMutex);
+        SavesFinished.wait(lock, [this]() { return PendingSaves.empty() && !WritingSave; });
+    }
+
+    /// Gets the number of saves that haven't finished being written.
+    /// @return The number of pending saves.
+    std::size_t SavedGameWriter::PendingSaveCount()
+    {
+        std::lock_guard<std::mutex> lock(SavesMutex);
+        std::size_t pending_save_count = PendingSaves.size();
+        if (WritingSave)
+        {
+            ++pending_save_count;
+        }
+        return pending_save_count;
+    }
+
+    /// Writes saves as they're requested until the writer is stopped.  Runs on the background thread.
+    void SavedGameWriter::WriteSaves()
+    {
+        std::unique_lock<std::mutex> lock(SavesMutex);
+        while (true)
+        {
+            // WAIT FOR A SAVE TO BE REQUESTED.
+            SaveRequestedOrStopping.wait(lock, [this]() { return Stopping || !PendingSaves.empty(); });
+
+            // STOP ONCE ALL SAVES HAVE BEEN WRITTEN.
+            if (PendingSaves.empty())
+            {
+                return;
+            }
+
+            // TAKE THE NEXT SAVE.
+            PendingSave pending_save = std::move(PendingSaves.front());
+            PendingSaves.pop_front();
+            WritingSave = true;
+
+            // WRITE THE SAVE WITHOUT HOLDING UP THE GAME THREAD.
+            lock.unlock();
+            std::error_code directory_error;
+            std::filesystem::create_directories(pending_save.Filepath.parent_path(), directory_error);
+            std::filesystem::path journal_filepath = SavedGameJournal::GetFilepath(pending_save.Filepath);
+            bool saved = false;
+            switch (pending_save.Type)
+            {
+                case SaveType::FULL_SAVED_GAME:
+                {
+                    saved = FILESYSTEM::File::WriteBinaryAtomically(pending_save.Filepath, pending_save.Bytes);
+                    if (saved)
+                    {
+                        // The journal is no longer needed since the saved game file has all of its changes.
+                        // If the game stops before the journal is removed, the journal is ignored since it's for the old file.
+                        std::error_code journal_removal_error;
+                        std::filesystem::remove(journal_filepath, journal_removal_error);
+                    }
+                    break;
+                }
+                case SaveType::NEW_JOURNAL:
+                    saved = FILESYSTEM::File::WriteBinaryAtomically(journal_filepath, pending_save.Bytes);
+                    break;
+                case SaveType::JOURNAL_ENTRY:
+                    saved = FILESYSTEM::File::AppendBinary(journal_filepath, pending_save.Bytes);
+                    break;
+            }
+            if (!saved)
+            {
+                SaveFailed = true;
+            }
+            lock.lock();
+
+            // RECORD THE COMPLETED SAVE.
+            CompletedSaves.emplace_back(CompletedSave
+            {
+                .Filepath = std::move(pending_save.Filepath),
+                .Saved = saved,
+                .Callback = std::move(pending_save.Callback),
+            });
+            WritingSave = false;
+            SavesFinished.notify_all();
+        }
+    }
+}
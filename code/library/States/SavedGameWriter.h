@@ -0,0 +1,132 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <SFML/System.hpp>
+#include "States/SavedGameData.h"
+#include "States/SavedGameJournal.h"
+
+namespace STATES
+{
+    /// Writes saved games to files on a background thread so that saving never stalls the game.
+    ///
+    /// When a save is requested, the saved game data is serialized into bytes on the game thread.
+    /// Serializing into memory is cheap, and copying the data itself wouldn't be a true snapshot
+    /// since the player is shared with the world.  The slow parts of saving (opening files and waiting
+    /// on the disk) happen on a background thread, which writes to a temporary file and only
+    /// replaces the saved game file once the data is on disk, so a crash mid-save never corrupts a save.
+    ///
+    /// After a saved game has been fully written once, later saves of it only append the changes
+    /// since the previous save to its journal (see SavedGameJournal), so saving stays cheap however far
+    /// the player has progressed.  Once the journal grows large enough, the next save fully writes
+    /// the saved game again and removes the journal.
+    ///
+    /// Games are also periodically autosaved during gameplay.  Callbacks for completed saves
+    /// are only called from the game thread when dispatched, so they can safely access game state.
+    /// All methods must be called from the same (game) thread.
+    class SavedGameWriter
+    {
+    public:
+        // TYPES.
+        /// A callback for when a save has finished, indicating if the save succeeded.
+        using CompletionCallback = std::function<void(const std::filesystem::path& filepath, const bool saved)>;
+
+        // CONSTRUCTION/DESTRUCTION.
+        explicit SavedGameWriter();
+        ~SavedGameWriter();
+        SavedGameWriter(const SavedGameWriter&) = delete;
+        SavedGameWriter& operator=(const SavedGameWriter&) = delete;
+
+        // COMPLETION CALLBACKS.
+        static void DisplayErrorIfNotSaved(const std::filesystem::path& filepath, const bool saved);
+
+        // SAVING.
+        void Save(const SavedGameData& saved_game_data, const CompletionCallback& completion_callback = {});
+        void UpdateAutosave(const sf::Time& elapsed_time, const SavedGameData& saved_game_data);
+        void DispatchCompletedSaves();
+        void WaitForPendingSaves();
+        std::size_t PendingSaveCount();
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// How often games are automatically saved during gameplay.
+        /// Since most saves only journal changes, games can be saved frequently.
+        sf::Time AutosaveInterval = sf::seconds(5.0f);
+        /// The size the journal can grow to before a saved game is fully written again.
+        std::size_t MaxJournalSizeInBytes = 64 * 1024;
+        /// The callback for when automatic saves complete.
+        CompletionCallback AutosaveCompletionCallback = DisplayErrorIfNotSaved;
+
+    private:
+        // TYPES.
+        /// The different ways a save may be written.
+        enum class SaveType
+        {
+            /// The entire saved game is written, replacing any journal.
+            FULL_SAVED_GAME = 0,
+            /// A new journal is written, replacing any previous journal.
+            NEW_JOURNAL,
+            /// Changes are appended to the existing journal.
+            JOURNAL_ENTRY
+        };
+
+        /// A save waiting to be written by the background thread.
+        struct PendingSave
+        {
+            /// The path of the saved game file.
+            std::filesystem::path Filepath = {};
+            /// How the save is written.
+            SaveType Type = SaveType::FULL_SAVED_GAME;
+            /// The serialized saved game data or journal records to write.
+            std::string Bytes = {};
+            /// The callback for once the save completes.
+            CompletionCallback Callback = {};
+        };
+
+        /// A save that has been written (or failed to be written) by the background thread.
+        struct CompletedSave
+        {
+            /// The path of the file written.
+            std::filesystem::path Filepath = {};
+            /// True if the saved game data was written; false otherwise.
+            bool Saved = false;
+            /// The callback for the save.
+            CompletionCallback Callback = {};
+        };
+
+        // BACKGROUND THREAD.
+        void WriteSaves();
+
+        // MEMBER VARIABLES.
+        /// The time since the game was last saved, for determining when to autosave.
+        sf::Time TimeSinceLastSave = sf::Time::Zero;
+        /// The journal of changes since the saved game was last fully written.  Only used by the game thread.
+        SavedGameJournal Journal = {};
+        /// True if a save failed to be written since the last save was requested.  The next save then
+        /// fully writes the saved game since the journal (or the file it applies to) may be missing changes.
+        std::atomic<bool> SaveFailed = false;
+        /// A mutex protecting the pending and completed saves.  Only held briefly to move saves in or out.
+        std::mutex SavesMutex = {};
+        /// Signaled when a save is requested or the background thread should stop.
+        std::condition_variable SaveRequestedOrStopping = {};
+        /// Signaled when the background thread has finished all pending saves.
+        std::condition_variable SavesFinished = {};
+        /// Saves waiting to be written, in the order requested.
+        std::deque<PendingSave> PendingSaves = {};
+        /// True while the background thread is writing a save it has taken from the pending saves.
+        bool WritingSave = false;
+        /// Saves that have completed but whose callbacks haven't been called yet.
+        std::vector<CompletedSave> CompletedSaves = {};
+        /// True once the background thread should stop.
+        bool Stopping = false;
+        /// The background thread on which saves are written.
+        std::thread WriterThread = {};
+    };
+}
@@ -3,12 +3,20 @@
 
 namespace STATES
 {
+    const sf::Time TitleScreen::TITLE_TOTAL_SCROLL_IN_TIME = sf::seconds(1);
+
     /// Updates the title screen based on elapsed time and user input.
     /// @param[in]  gaming_hardware - The hardware supplying input for the update.
     /// @return The state the game after updating the title screen.
     GameState TitleScreen::Update(const HARDWARE::GamingHardware& gaming_hardware)
     {
         // UPDATE THE ELAPSED TIME FOR THE TITLE SCREEN.
+        // The title moves for every update while it's still scrolling in.
+        bool title_was_scrolling_in = (ElapsedTime < TITLE_TOTAL_SCROLL_IN_TIME);
+        if (title_was_scrolling_in)
+        {
+            ScreenChanged = true;
+        }
         ElapsedTime += gaming_hardware.Clock.ElapsedTimeSinceLastFrame;
 
         // CHECK IF THE MAIN 'START' BUTTON WAS PRESSED.
@@ -32,6 +40,7 @@ namespace STATES
                 if (previous_menu_option_exists)
                 {
                     --SelectedMenuOptionIndex;
+                    ScreenChanged = true;
                 }
                 
             }
@@ -45,6 +54,7 @@ namespace STATES
                 if (next_menu_option_exists)
                 {
                     ++SelectedMenuOptionIndex;
+                    ScreenChanged = true;
                 }
             }
             
@@ -71,7 +81,6 @@ namespace STATES
 
         // CALCULATE THE OFFSET OF THE TITLE BASED ON ELAPSED TIME.
         // It should scroll in from the top.
-        const sf::Time TITLE_TOTAL_SCROLL_IN_TIME = sf::seconds(1);
         float title_y_scroll_offset_in_pixels = 0.0f;
         bool title_still_scrolling_in = (ElapsedTime < TITLE_TOTAL_SCROLL_IN_TIME);
         if (title_still_scrolling_in)
@@ -18,7 +18,16 @@ namespace STATES
         GameState Update(const HARDWARE::GamingHardware& gaming_hardware);
         sf::Sprite Render(GRAPHICS::Renderer& renderer) const;
 
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// True if anything shown on the title screen has changed since it was last rendered.
+        /// Cleared once the screen has been rendered.
+        bool ScreenChanged = true;
+
     private:
+        // CONSTANTS.
+        /// How long the game's title takes to scroll in from the top of the screen.
+        static const sf::Time TITLE_TOTAL_SCROLL_IN_TIME;
+
         // MEMBER VARIABLES.
         /// The total time that the title screen has been shown.
         sf::Time ElapsedTime = sf::Time::Zero;
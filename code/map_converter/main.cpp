@@ -0,0 +1,247 @@
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <sstream>
+#include <string>
+#include "Containers/Array2D.h"
+#include "Filesystem/File.h"
+#include "Maps/Data/TileMapData.h"
+#include "Maps/Data/WorldMapData.h"
+#include "Maps/TileMap.h"
+#include "Maps/TileMapFile.h"
+
+/// Writes a single layer of a tile map in text format.
+/// @param[in]  layer_name - The name of the layer.
+/// @param[in]  layer - The layer to write.  Nothing is written if the layer is missing.
+/// @param[in,out]  text_file - The text file to write to.
+void WriteTextLayer(
+    const std::string& layer_name,
+    const std::optional<CONTAINERS::Array2D<std::uint8_t>>& layer,
+    std::ostream& text_file)
+{
+    // SKIP ANY MISSING LAYER.
+    if (!layer)
+    {
+        return;
+    }
+
+    // WRITE EACH TILE ID IN THE LAYER.
+    // Tile data is written by row, just like it was when map data was compiled into the game.
+    text_file << layer_name << "\n";
+    for (unsigned int y = 0; y < layer->GetHeight(); ++y)
+    {
+        for (unsigned int x = 0; x < layer->GetWidth(); ++x)
+        {
+            text_file << static_cast<unsigned int>((*layer)(x, y)) << ", ";
+        }
+        text_file << "\n";
+    }
+}
+
+/// Writes all tile maps in a map grid in text format.
+/// @param[in]  map_grid_name - The name of the map grid.
+/// @param[in]  map_grid_data - The data for the tile maps in the map grid.
+/// @param[in,out]  text_file - The text file to write to.
+void WriteTextMapGrid(
+    const std::string& map_grid_name,
+    const CONTAINERS::Array2D<MAPS::DATA::TileMapData>& map_grid_data,
+    std::ostream& text_file)
+{
+    text_file << map_grid_name << " " << map_grid_data.GetWidth() << " " << map_grid_data.GetHeight() << "\n";
+    for (unsigned int row = 0; row < map_grid_data.GetHeight(); ++row)
+    {
+        for (unsigned int column = 0; column < map_grid_data.GetWidth(); ++column)
+        {
+            const MAPS::DATA::TileMapData& tile_map_data = map_grid_data(column, row);
+            text_file << "TILE_MAP " << column << " " << row << "\n";
+            WriteTextLayer("GROUND_LAYER", tile_map_data.GroundLayer, text_file);
+            WriteTextLayer("ARK_LAYER", tile_map_data.ArkLayer, text_file);
+            WriteTextLayer("OBJECT_LAYER", tile_map_data.ObjectLayer, text_file);
+        }
+    }
+}
+
+/// Reads map data from text format.
+/// @param[in,out]  text_file - The text file to read from.
+/// @return The map data, if the text was valid; null otherwise.
+std::optional<MAPS::DATA::WorldMapData> ReadTextMapData(std::istream& text_file)
+{
+    // TREAT SEPARATORS BETWEEN TILE IDS AS WHITESPACE.
+    std::string text((std::istreambuf_iterator<char>(text_file)), std::istreambuf_iterator<char>());
+    for (char& character : text)
+    {
+        if (',' == character)
+        {
+            character = ' ';
+        }
+    }
+    std::istringstream tokens(text);
+
+    // READ EACH SECTION OF THE TEXT.
+    MAPS::DATA::WorldMapData map_data;
+    CONTAINERS::Array2D<MAPS::DATA::TileMapData>* current_map_grid_data = nullptr;
+    MAPS::DATA::TileMapData* current_tile_map_data = nullptr;
+    std::string section_name;
+    while (tokens >> section_name)
+    {
+        if ("OVERWORLD" == section_name || "ARK_INTERIOR_LAYER" == section_name)
+        {
+            // START READING A NEW MAP GRID.
+            unsigned int width_in_tile_maps = 0;
+            unsigned int height_in_tile_maps = 0;
+            tokens >> width_in_tile_maps >> height_in_tile_maps;
+            if ("OVERWORLD" == section_name)
+            {
+                current_map_grid_data = &map_data.Overworld;
+            }
+            else
+            {
+                current_map_grid_data = &map_data.ArkInteriorLayersFromBottomToTop.emplace_back();
+            }
+            current_map_grid_data->Resize(width_in_tile_maps, height_in_tile_maps);
+            current_tile_map_data = nullptr;
+        }
+        else if ("TILE_MAP" == section_name)
+        {
+            // START READING A NEW TILE MAP IN THE CURRENT MAP GRID.
+            unsigned int column = 0;
+            unsigned int row = 0;
+            tokens >> column >> row;
+            bool tile_map_valid = current_map_grid_data && current_map_grid_data->IndicesInRange(column, row);
+            if (!tile_map_valid)
+            {
+                std::cerr << "Invalid tile map " << column << ", " << row << std::endl;
+                return std::nullopt;
+            }
+            current_tile_map_data = &(*current_map_grid_data)(column, row);
+        }
+        else if ("GROUND_LAYER" == section_name || "ARK_LAYER" == section_name || "OBJECT_LAYER" == section_name)
+        {
+            // MAKE SURE THE LAYER IS FOR A TILE MAP.
+            if (!current_tile_map_data)
+            {
+                std::cerr << section_name << " found outside of a tile map" << std::endl;
+                return std::nullopt;
+            }
+
+            // READ EACH TILE ID IN THE LAYER.
+            std::optional<CONTAINERS::Array2D<std::uint8_t>>* layer = &current_tile_map_data->ObjectLayer;
+            if ("GROUND_LAYER" == section_name)
+            {
+                layer = &current_tile_map_data->GroundLayer;
+            }
+            else if ("ARK_LAYER" == section_name)
+            {
+                layer = &current_tile_map_data->ArkLayer;
+            }
+            CONTAINERS::Array2D<std::uint8_t>& layer_tiles = layer->emplace(MAPS::TileMap::WIDTH_IN_TILES, MAPS::TileMap::HEIGHT_IN_TILES);
+            for (unsigned int y = 0; y < layer_tiles.GetHeight(); ++y)
+            {
+                for (unsigned int x = 0; x < layer_tiles.GetWidth(); ++x)
+                {
+                    unsigned int tile_id = 0;
+                    tokens >> tile_id;
+                    layer_tiles(x, y) = static_cast<std::uint8_t>(tile_id);
+                }
+            }
+        }
+        else
+        {
+            std::cerr << "Unknown section " << section_name << std::endl;
+            return std::nullopt;
+        }
+
+        // MAKE SURE THE SECTION WAS COMPLETE.
+        if (tokens.fail())
+        {
+            std::cerr << "Incomplete section " << section_name << std::endl;
+            return std::nullopt;
+        }
+    }
+
+    return map_data;
+}
+
+/// A basic converter between map files for the Noah's Ark game and a text format
+/// that's easier to diff or edit by hand.
+/// @param[in]  argument_count - The number of command line arguments.
+/// @param[in]  arguments - The command line arguments.  Either "--to-text <map_file> <text_file>"
+///     or "--to-map <text_file> <map_file>".
+/// @return 0 for success; non-zero for failure.
+int main(int argument_count, char* arguments[])
+{
+    // READ THE COMMAND LINE ARGUMENTS.
+    constexpr int EXPECTED_ARGUMENT_COUNT = 4;
+    if (EXPECTED_ARGUMENT_COUNT != argument_count)
+    {
+        std::cerr << "Usage: map_converter --to-text <map_file> <text_file>" << std::endl;
+        std::cerr << "       map_converter --to-map <text_file> <map_file>" << std::endl;
+        return EXIT_FAILURE;
+    }
+    const std::string conversion = arguments[1];
+    const std::string input_filepath = arguments[2];
+    const std::string output_filepath = arguments[3];
+
+    if ("--to-text" == conversion)
+    {
+        // READ THE MAP FILE.
+        std::optional<MAPS::DATA::WorldMapData> map_data = MAPS::TileMapFile::Read(FILESYSTEM::File::ReadBinary(input_filepath));
+        if (!map_data)
+        {
+            std::cerr << "Failed to read map file " << input_filepath << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        // WRITE THE MAP DATA AS TEXT.
+        std::ofstream text_file(output_filepath);
+        WriteTextMapGrid("OVERWORLD", map_data->Overworld, text_file);
+        for (const CONTAINERS::Array2D<MAPS::DATA::TileMapData>& ark_interior_layer_data : map_data->ArkInteriorLayersFromBottomToTop)
+        {
+            WriteTextMapGrid("ARK_INTERIOR_LAYER", ark_interior_layer_data, text_file);
+        }
+        if (!text_file)
+        {
+            std::cerr << "Failed to write text file " << output_filepath << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    else if ("--to-map" == conversion)
+    {
+        // READ THE MAP DATA FROM TEXT.
+        std::ifstream text_file(input_filepath);
+        std::optional<MAPS::DATA::WorldMapData> map_data = ReadTextMapData(text_file);
+        if (!map_data)
+        {
+            std::cerr << "Failed to read text file " << input_filepath << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        // MAKE SURE THE GAME WILL BE ABLE TO READ THE MAP FILE.
+        // This catches any missing tile maps or layers.
+        std::string map_file_bytes = MAPS::TileMapFile::Write(*map_data);
+        bool map_file_valid = MAPS::TileMapFile::Read(map_file_bytes).has_value();
+        if (!map_file_valid)
+        {
+            std::cerr << "Invalid map data in " << input_filepath << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        // WRITE THE MAP FILE.
+        bool map_file_written = FILESYSTEM::File::WriteBinaryAtomically(output_filepath, map_file_bytes);
+        if (!map_file_written)
+        {
+            std::cerr << "Failed to write map file " << output_filepath << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    else
+    {
+        std::cerr << "Unknown conversion " << conversion << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,210 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Audio/AudioClip.h"
+#include "Audio/AudioMixer.h"
+
+/// A namespace for testing the AudioMixer class.
+namespace TEST_AUDIO_MIXER
+{
+    using namespace AUDIO;
+
+    /// The amount a 16-bit sample is scaled by when mixed.
+    constexpr float INTEGER_SAMPLE_SCALE = 1.0f / 32768.0f;
+
+    /// Creates a clip owning the provided samples.
+    /// @param[in]  samples - The samples for the clip.
+    /// @param[in]  channel_count - The number of channels in the clip.
+    /// @param[in]  sample_rate - The sample rate of the clip.
+    /// @return The clip.
+    AudioClip CreateClip(const std::vector<std::int16_t>& samples, const unsigned int channel_count, const unsigned int sample_rate = AudioMixer::OUTPUT_SAMPLE_RATE)
+    {
+        auto owned_samples = std::make_shared<const std::vector<std::int16_t>>(samples);
+        AudioClip clip =
+        {
+            .SampleOwner = owned_samples,
+            .Samples = *owned_samples,
+            .ChannelCount = channel_count,
+            .SampleRate = sample_rate
+        };
+        return clip;
+    }
+
+    TEST_CASE("Clips in the same format as the output are mixed unchanged at full volume.", "[AudioMixer]")
+    {
+        // PLAY A STEREO CLIP.
+        // The clip is long enough to exercise any vectorized mixing loops.
+        constexpr std::size_t FRAME_COUNT = 21;
+        std::vector<std::int16_t> samples;
+        for (std::size_t sample_index = 0; sample_index < FRAME_COUNT * AudioMixer::OUTPUT_CHANNEL_COUNT; ++sample_index)
+        {
+            samples.push_back(static_cast<std::int16_t>(sample_index * 100) - 2000);
+        }
+        AudioMixer mixer;
+        mixer.Play(0, CreateClip(samples, AudioMixer::OUTPUT_CHANNEL_COUNT), 100.0f);
+
+        // MIX THE CLIP.
+        std::vector<float> mixed_samples(samples.size());
+        mixer.Mix(mixed_samples);
+
+        // VERIFY THE MIXED SAMPLES MATCH THE CLIP.
+        for (std::size_t sample_index = 0; sample_index < samples.size(); ++sample_index)
+        {
+            REQUIRE(Approx(samples[sample_index] * INTEGER_SAMPLE_SCALE) == mixed_samples[sample_index]);
+        }
+        REQUIRE_FALSE(mixer.VoiceIsPlaying(0));
+    }
+
+    TEST_CASE("Voices are scaled by volume and added together.", "[AudioMixer]")
+    {
+        // PLAY TWO CLIPS AT DIFFERENT VOLUMES.
+        std::vector<std::int16_t> first_samples(32, 8192);
+        std::vector<std::int16_t> second_samples(32, -4096);
+        AudioMixer mixer;
+        mixer.Play(0, CreateClip(first_samples, AudioMixer::OUTPUT_CHANNEL_COUNT), 50.0f);
+        mixer.Play(5, CreateClip(second_samples, AudioMixer::OUTPUT_CHANNEL_COUNT), 25.0f);
+
+        // VERIFY THE CLIPS ARE MIXED TOGETHER.
+        std::vector<float> mixed_samples(32);
+        mixer.Mix(mixed_samples);
+        const float EXPECTED_SAMPLE = (8192 * 0.5f - 4096 * 0.25f) * INTEGER_SAMPLE_SCALE;
+        for (float mixed_sample : mixed_samples)
+        {
+            REQUIRE(Approx(EXPECTED_SAMPLE) == mixed_sample);
+        }
+
+        // VERIFY THE PER-VOICE MIXING COST IS TRACKED.
+        REQUIRE(32 == mixer.MixedVoiceFrameCount);
+    }
+
+    TEST_CASE("Mono clips are played in both output channels.", "[AudioMixer]")
+    {
+        AudioMixer mixer;
+        mixer.Play(0, CreateClip({ 1000, 2000, 3000 }, 1), 100.0f);
+
+        std::array<float, 8> mixed_samples;
+        mixer.Mix(mixed_samples);
+        REQUIRE(Approx(1000 * INTEGER_SAMPLE_SCALE) == mixed_samples[0]);
+        REQUIRE(Approx(1000 * INTEGER_SAMPLE_SCALE) == mixed_samples[1]);
+        REQUIRE(Approx(2000 * INTEGER_SAMPLE_SCALE) == mixed_samples[2]);
+        REQUIRE(Approx(2000 * INTEGER_SAMPLE_SCALE) == mixed_samples[3]);
+        REQUIRE(Approx(3000 * INTEGER_SAMPLE_SCALE) == mixed_samples[4]);
+        REQUIRE(Approx(3000 * INTEGER_SAMPLE_SCALE) == mixed_samples[5]);
+        REQUIRE(0.0f == mixed_samples[6]);
+        REQUIRE(0.0f == mixed_samples[7]);
+    }
+
+    TEST_CASE("Clips are resampled when played at a different pitch or sample rate.", "[AudioMixer]")
+    {
+        // The same output is expected from half-speed playback and a clip with half the output's sample rate.
+        const std::vector<float> EXPECTED_SAMPLES = { 0.0f, 500.0f, 1000.0f, 1500.0f, 2000.0f, 2500.0f, 3000.0f, 3000.0f, 0.0f, 0.0f };
+        const AudioClip HALF_PITCH_CLIP = CreateClip({ 0, 1000, 2000, 3000 }, 1);
+        const AudioClip HALF_SAMPLE_RATE_CLIP = CreateClip({ 0, 1000, 2000, 3000 }, 1, AudioMixer::OUTPUT_SAMPLE_RATE / 2);
+        for (const float pitch : { 0.5f, 1.0f })
+        {
+            AudioMixer mixer;
+            const AudioClip& clip = (0.5f == pitch) ? HALF_PITCH_CLIP : HALF_SAMPLE_RATE_CLIP;
+            mixer.Play(0, clip, 100.0f, pitch);
+
+            std::vector<float> mixed_samples(EXPECTED_SAMPLES.size() * AudioMixer::OUTPUT_CHANNEL_COUNT);
+            mixer.Mix(mixed_samples);
+            for (std::size_t frame_index = 0; frame_index < EXPECTED_SAMPLES.size(); ++frame_index)
+            {
+                REQUIRE(Approx(EXPECTED_SAMPLES[frame_index] * INTEGER_SAMPLE_SCALE) == mixed_samples[frame_index * 2]);
+                REQUIRE(Approx(EXPECTED_SAMPLES[frame_index] * INTEGER_SAMPLE_SCALE) == mixed_samples[frame_index * 2 + 1]);
+            }
+            REQUIRE_FALSE(mixer.VoiceIsPlaying(0));
+        }
+    }
+
+    TEST_CASE("Looping voices start over while other voices stop at the end of their clips.", "[AudioMixer]")
+    {
+        // PLAY THE SAME CLIP WITH AND WITHOUT LOOPING.
+        const AudioClip CLIP = CreateClip({ 100, 100, 200, 200 }, AudioMixer::OUTPUT_CHANNEL_COUNT);
+        AudioMixer looping_mixer;
+        looping_mixer.Play(0, CLIP, 100.0f, 1.0f, true);
+        AudioMixer non_looping_mixer;
+        non_looping_mixer.Play(0, CLIP, 100.0f);
+
+        // MIX ACROSS MULTIPLE CHUNKS.
+        std::array<float, 6> looping_samples;
+        looping_mixer.Mix(looping_samples);
+        REQUIRE(Approx(100 * INTEGER_SAMPLE_SCALE) == looping_samples[4]);
+        looping_mixer.Mix(looping_samples);
+        REQUIRE(Approx(200 * INTEGER_SAMPLE_SCALE) == looping_samples[0]);
+        REQUIRE(Approx(100 * INTEGER_SAMPLE_SCALE) == looping_samples[2]);
+        REQUIRE(looping_mixer.VoiceIsPlaying(0));
+
+        std::array<float, 6> non_looping_samples;
+        non_looping_mixer.Mix(non_looping_samples);
+        REQUIRE(Approx(200 * INTEGER_SAMPLE_SCALE) == non_looping_samples[2]);
+        REQUIRE(0.0f == non_looping_samples[4]);
+        REQUIRE_FALSE(non_looping_mixer.VoiceIsPlaying(0));
+
+        // VERIFY THAT STOPPING THE LOOPING VOICE SILENCES IT.
+        looping_mixer.StopAll();
+        looping_mixer.Mix(looping_samples);
+        for (float sample : looping_samples)
+        {
+            REQUIRE(0.0f == sample);
+        }
+    }
+
+    TEST_CASE("Mixed audio is clamped to the valid range of samples.", "[AudioMixer]")
+    {
+        AudioMixer mixer;
+        std::vector<std::int16_t> loud_samples(16, 30000);
+        std::vector<std::int16_t> quiet_samples(16, -30000);
+        mixer.Play(0, CreateClip(loud_samples, AudioMixer::OUTPUT_CHANNEL_COUNT), 100.0f);
+        mixer.Play(1, CreateClip(loud_samples, AudioMixer::OUTPUT_CHANNEL_COUNT), 100.0f);
+
+        std::array<float, 16> mixed_samples;
+        mixer.Mix(mixed_samples);
+        for (float sample : mixed_samples)
+        {
+            REQUIRE(1.0f == sample);
+        }
+
+        mixer.Play(0, CreateClip(quiet_samples, AudioMixer::OUTPUT_CHANNEL_COUNT), 100.0f);
+        mixer.Play(1, CreateClip(quiet_samples, 1), 100.0f);
+        mixer.Mix(mixed_samples);
+        for (float sample : mixed_samples)
+        {
+            REQUIRE(-1.0f == sample);
+        }
+    }
+
+    TEST_CASE("Panned clips are quieter only in the opposite channel.", "[AudioMixer]")
+    {
+        // PLAY A CONSTANT STEREO CLIP HALFWAY TO THE RIGHT.
+        // The clip is long enough to exercise any vectorized mixing loops.
+        constexpr std::size_t FRAME_COUNT = 21;
+        std::vector<std::int16_t> samples(FRAME_COUNT * AudioMixer::OUTPUT_CHANNEL_COUNT, 1000);
+        AudioMixer mixer;
+        mixer.Play(0, CreateClip(samples, AudioMixer::OUTPUT_CHANNEL_COUNT), 100.0f, 1.0f, false, 0.5f);
+
+        // MIX THE CLIP.
+        std::vector<float> mixed_samples(samples.size());
+        mixer.Mix(mixed_samples);
+
+        // VERIFY THAT ONLY THE LEFT CHANNEL IS QUIETER.
+        for (std::size_t frame_index = 0; frame_index < FRAME_COUNT; ++frame_index)
+        {
+            REQUIRE(Approx(500 * INTEGER_SAMPLE_SCALE) == mixed_samples[frame_index * AudioMixer::OUTPUT_CHANNEL_COUNT]);
+            REQUIRE(Approx(1000 * INTEGER_SAMPLE_SCALE) == mixed_samples[frame_index * AudioMixer::OUTPUT_CHANNEL_COUNT + 1]);
+        }
+
+        // VERIFY THAT RESAMPLED CLIPS ARE PANNED THE SAME WAY.
+        std::vector<std::int16_t> mono_samples(FRAME_COUNT, 1000);
+        mixer.Play(0, CreateClip(mono_samples, 1), 100.0f, 1.0f, false, -1.0f);
+        mixer.Mix(mixed_samples);
+        for (std::size_t frame_index = 0; frame_index < FRAME_COUNT; ++frame_index)
+        {
+            REQUIRE(Approx(1000 * INTEGER_SAMPLE_SCALE) == mixed_samples[frame_index * AudioMixer::OUTPUT_CHANNEL_COUNT]);
+            REQUIRE(0.0f == mixed_samples[frame_index * AudioMixer::OUTPUT_CHANNEL_COUNT + 1]);
+        }
+    }
+}
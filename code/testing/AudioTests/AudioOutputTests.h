@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include "Audio/AudioMixer.h"
+#include "Audio/AudioOutput.h"
+
+/// A namespace for testing the AudioOutput class.
+namespace TEST_AUDIO_OUTPUT
+{
+    using namespace AUDIO;
+
+    TEST_CASE("Null audio output discards audio while counting frames.", "[AudioOutput]")
+    {
+        std::unique_ptr<AudioOutput> null_output = AudioOutput::NullDevice();
+        REQUIRE(AudioOutputType::NULL_DEVICE == null_output->Type);
+
+        std::array<float, 20> mixed_samples = {};
+        null_output->Write(mixed_samples);
+        null_output->Write(mixed_samples);
+        REQUIRE(20 == null_output->WrittenFrameCount);
+    }
+
+    TEST_CASE("WAV file audio output writes a playable WAV file.", "[AudioOutput]")
+    {
+        // WRITE SOME AUDIO TO A WAV FILE.
+        const std::filesystem::path WAV_FILEPATH = std::filesystem::temp_directory_path() / "noah_ark_audio_output_test.wav";
+        {
+            std::unique_ptr<AudioOutput> wav_file_output = AudioOutput::WavFile(WAV_FILEPATH);
+            REQUIRE(wav_file_output);
+            const std::array<float, 4> MIXED_SAMPLES = { 0.0f, 0.5f, -0.5f, 2.0f };
+            wav_file_output->Write(MIXED_SAMPLES);
+            wav_file_output->Write(MIXED_SAMPLES);
+        }
+
+        // READ THE WAV FILE.
+        std::ifstream wav_file(WAV_FILEPATH, std::ios::binary);
+        std::string wav_file_data((std::istreambuf_iterator<char>(wav_file)), std::istreambuf_iterator<char>());
+        wav_file.close();
+        std::filesystem::remove(WAV_FILEPATH);
+
+        // VERIFY THE HEADER.
+        constexpr std::size_t HEADER_SIZE_IN_BYTES = 44;
+        constexpr std::size_t AUDIO_DATA_SIZE_IN_BYTES = 8 * sizeof(std::int16_t);
+        REQUIRE(HEADER_SIZE_IN_BYTES + AUDIO_DATA_SIZE_IN_BYTES == wav_file_data.size());
+        REQUIRE("RIFF" == wav_file_data.substr(0, 4));
+        REQUIRE("WAVE" == wav_file_data.substr(8, 4));
+        REQUIRE("fmt " == wav_file_data.substr(12, 4));
+        REQUIRE("data" == wav_file_data.substr(36, 4));
+
+        std::uint16_t channel_count = 0;
+        std::memcpy(&channel_count, &wav_file_data[22], sizeof(channel_count));
+        REQUIRE(AudioMixer::OUTPUT_CHANNEL_COUNT == channel_count);
+        std::uint32_t sample_rate = 0;
+        std::memcpy(&sample_rate, &wav_file_data[24], sizeof(sample_rate));
+        REQUIRE(AudioMixer::OUTPUT_SAMPLE_RATE == sample_rate);
+        std::uint32_t audio_data_size_in_bytes = 0;
+        std::memcpy(&audio_data_size_in_bytes, &wav_file_data[40], sizeof(audio_data_size_in_bytes));
+        REQUIRE(AUDIO_DATA_SIZE_IN_BYTES == audio_data_size_in_bytes);
+
+        // VERIFY THE AUDIO DATA.
+        // Out-of-range samples should be clamped.
+        std::array<std::int16_t, 8> samples = {};
+        std::memcpy(samples.data(), &wav_file_data[HEADER_SIZE_IN_BYTES], AUDIO_DATA_SIZE_IN_BYTES);
+        const std::array<std::int16_t, 8> EXPECTED_SAMPLES = { 0, 16384, -16384, 32767, 0, 16384, -16384, 32767 };
+        REQUIRE(EXPECTED_SAMPLES == samples);
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include "Audio/AudioMixer.h"
+#include "Audio/AudioPrerenderer.h"
+
+/// A namespace for testing the AudioPrerenderer class.
+namespace TEST_AUDIO_PRERENDERER
+{
+    using namespace AUDIO;
+
+    TEST_CASE("Audio pre-rendered at half pitch is twice as long without trailing silence.", "[AudioPrerenderer]")
+    {
+        // RENDER A SHORT MONO CLIP AT HALF PITCH.
+        const std::filesystem::path WAV_FILEPATH = std::filesystem::temp_directory_path() / "noah_ark_audio_prerenderer_test.wav";
+        const std::array<std::int16_t, 4> SAMPLES = { 16384, 16384, 16384, 16384 };
+        AudioClip clip = { .Samples = SAMPLES, .ChannelCount = 1, .SampleRate = AudioMixer::OUTPUT_SAMPLE_RATE };
+        REQUIRE(AudioPrerenderer::RenderPitchShiftedWavFile(clip, 0.5f, WAV_FILEPATH));
+
+        // READ THE WAV FILE.
+        std::ifstream wav_file(WAV_FILEPATH, std::ios::binary);
+        std::string wav_file_data((std::istreambuf_iterator<char>(wav_file)), std::istreambuf_iterator<char>());
+        wav_file.close();
+        std::filesystem::remove(WAV_FILEPATH);
+
+        // VERIFY THE LENGTH OF THE RENDERED AUDIO.
+        constexpr std::size_t HEADER_SIZE_IN_BYTES = 44;
+        constexpr std::size_t EXPECTED_FRAME_COUNT = 8;
+        constexpr std::size_t EXPECTED_SAMPLE_COUNT = EXPECTED_FRAME_COUNT * AudioMixer::OUTPUT_CHANNEL_COUNT;
+        REQUIRE(HEADER_SIZE_IN_BYTES + EXPECTED_SAMPLE_COUNT * sizeof(std::int16_t) == wav_file_data.size());
+
+        // VERIFY THAT NONE OF THE RENDERED AUDIO IS SILENT.
+        std::array<std::int16_t, EXPECTED_SAMPLE_COUNT> rendered_samples = {};
+        std::memcpy(rendered_samples.data(), &wav_file_data[HEADER_SIZE_IN_BYTES], sizeof(rendered_samples));
+        for (std::int16_t rendered_sample : rendered_samples)
+        {
+            REQUIRE(16384 == rendered_sample);
+        }
+    }
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <span>
+#include "Audio/SoundEventScheduler.h"
+#include "Math/Rectangle.h"
+#include "Resources/AssetId.h"
+
+/// A namespace for testing the SoundEventScheduler class.
+namespace TEST_SOUND_EVENT_SCHEDULER
+{
+    using namespace AUDIO;
+
+    /// The camera's view for tests, matching the size of a tile map.
+    const MATH::FloatRectangle CAMERA_VIEW_BOUNDS = MATH::FloatRectangle::FromLeftTopAndDimensions(0.0f, 0.0f, 512.0f, 384.0f);
+
+    TEST_CASE("Sounds outside of the camera's neighborhood are culled.", "[SoundEventScheduler]")
+    {
+        // SCHEDULE SOUNDS IN AND BEYOND NEIGHBORING TILE MAPS.
+        SoundEventScheduler sound_scheduler;
+        sound_scheduler.Schedule(RESOURCES::AssetId::BEAR_SOUND, MATH::Vector2f(-500.0f, 100.0f));
+        sound_scheduler.Schedule(RESOURCES::AssetId::CAT_SOUND, MATH::Vector2f(1100.0f, 100.0f));
+        sound_scheduler.Schedule(RESOURCES::AssetId::DOG_SOUND, MATH::Vector2f(200.0f, -800.0f));
+        REQUIRE(3 == sound_scheduler.PendingSoundCount());
+
+        // ONLY THE SOUND IN A NEIGHBORING TILE MAP SHOULD BE KEPT.
+        std::span<const SoundEvent> sounds_to_play = sound_scheduler.TakeFrameSounds(sf::seconds(0.1f), CAMERA_VIEW_BOUNDS);
+        REQUIRE(1 == sounds_to_play.size());
+        REQUIRE(RESOURCES::AssetId::BEAR_SOUND == sounds_to_play[0].SoundId);
+        REQUIRE(0 == sound_scheduler.PendingSoundCount());
+    }
+
+    TEST_CASE("The same sound is limited to its closest instance and isn't repeated too quickly.", "[SoundEventScheduler]")
+    {
+        // SCHEDULE THE SAME SOUND MULTIPLE TIMES.
+        SoundEventScheduler sound_scheduler;
+        sound_scheduler.Schedule(RESOURCES::AssetId::SHEEP_SOUND, MATH::Vector2f(0.0f, 0.0f));
+        sound_scheduler.Schedule(RESOURCES::AssetId::SHEEP_SOUND, MATH::Vector2f(250.0f, 200.0f));
+        std::span<const SoundEvent> sounds_to_play = sound_scheduler.TakeFrameSounds(sf::seconds(0.1f), CAMERA_VIEW_BOUNDS);
+        REQUIRE(1 == sounds_to_play.size());
+        REQUIRE(MATH::Vector2f(250.0f, 200.0f) == sounds_to_play[0].WorldPosition);
+
+        // THE SOUND SHOULDN'T BE PLAYED AGAIN RIGHT AWAY.
+        sound_scheduler.Schedule(RESOURCES::AssetId::SHEEP_SOUND, MATH::Vector2f(250.0f, 200.0f));
+        REQUIRE(sound_scheduler.TakeFrameSounds(sf::seconds(0.1f), CAMERA_VIEW_BOUNDS).empty());
+
+        // THE SOUND SHOULD BE PLAYED AGAIN ONCE ENOUGH TIME HAS PASSED.
+        sound_scheduler.Schedule(RESOURCES::AssetId::SHEEP_SOUND, MATH::Vector2f(250.0f, 200.0f));
+        sounds_to_play = sound_scheduler.TakeFrameSounds(sf::seconds(SoundEventScheduler::MIN_SECONDS_BETWEEN_SAME_SOUND), CAMERA_VIEW_BOUNDS);
+        REQUIRE(1 == sounds_to_play.size());
+    }
+
+    TEST_CASE("Only the closest sounds are played during a single frame.", "[SoundEventScheduler]")
+    {
+        // SCHEDULE MORE SOUNDS THAN CAN BE PLAYED IN A FRAME.
+        // Sounds are scheduled from furthest to closest to make sure they're reordered.
+        SoundEventScheduler sound_scheduler;
+        const RESOURCES::AssetId SOUND_IDS[] =
+        {
+            RESOURCES::AssetId::BEAR_SOUND,
+            RESOURCES::AssetId::CAT_SOUND,
+            RESOURCES::AssetId::DOG_SOUND,
+            RESOURCES::AssetId::DUCK_SOUND,
+            RESOURCES::AssetId::GOAT_SOUND,
+            RESOURCES::AssetId::HORSE_SOUND,
+        };
+        float distance_from_camera_center = 300.0f;
+        for (RESOURCES::AssetId sound_id : SOUND_IDS)
+        {
+            sound_scheduler.Schedule(sound_id, MATH::Vector2f(256.0f + distance_from_camera_center, 192.0f));
+            distance_from_camera_center -= 50.0f;
+        }
+
+        // VERIFY THAT ONLY THE CLOSEST SOUNDS ARE KEPT, CLOSEST FIRST.
+        std::span<const SoundEvent> sounds_to_play = sound_scheduler.TakeFrameSounds(sf::seconds(0.1f), CAMERA_VIEW_BOUNDS);
+        REQUIRE(SoundEventScheduler::MAX_SOUNDS_PER_FRAME == sounds_to_play.size());
+        REQUIRE(RESOURCES::AssetId::HORSE_SOUND == sounds_to_play[0].SoundId);
+        REQUIRE(RESOURCES::AssetId::GOAT_SOUND == sounds_to_play[1].SoundId);
+        REQUIRE(RESOURCES::AssetId::DUCK_SOUND == sounds_to_play[2].SoundId);
+        REQUIRE(RESOURCES::AssetId::DOG_SOUND == sounds_to_play[3].SoundId);
+    }
+}
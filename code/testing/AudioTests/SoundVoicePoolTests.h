@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include "Audio/SoundProperties.h"
+#include "Audio/SoundVoicePool.h"
+#include "Resources/AssetId.h"
+
+/// A namespace for testing the SoundVoicePool class.
+namespace TEST_SOUND_VOICE_POOL
+{
+    using namespace AUDIO;
+
+    TEST_CASE("The same sound can play in multiple voices up to its instance limit.", "[SoundVoicePool]")
+    {
+        // PLAY THE SOUND UP TO ITS LIMIT.
+        SoundVoicePool voice_pool;
+        SoundProperties sound_properties = { .MaxInstanceCount = 3 };
+        std::optional<std::size_t> first_voice_index = voice_pool.AllocateVoice(RESOURCES::AssetId::DOG_SOUND, sound_properties);
+        std::optional<std::size_t> second_voice_index = voice_pool.AllocateVoice(RESOURCES::AssetId::DOG_SOUND, sound_properties);
+        std::optional<std::size_t> third_voice_index = voice_pool.AllocateVoice(RESOURCES::AssetId::DOG_SOUND, sound_properties);
+        REQUIRE(first_voice_index);
+        REQUIRE(second_voice_index);
+        REQUIRE(third_voice_index);
+        REQUIRE(*first_voice_index != *second_voice_index);
+        REQUIRE(*second_voice_index != *third_voice_index);
+        REQUIRE(3 == voice_pool.PlayingInstanceCount(RESOURCES::AssetId::DOG_SOUND));
+
+        // VERIFY THAT NO MORE INSTANCES OF THE SOUND CAN BE PLAYED.
+        REQUIRE_FALSE(voice_pool.AllocateVoice(RESOURCES::AssetId::DOG_SOUND, sound_properties));
+        REQUIRE(3 == voice_pool.PlayingInstanceCount(RESOURCES::AssetId::DOG_SOUND));
+
+        // VERIFY THAT OTHER SOUNDS CAN STILL BE PLAYED.
+        REQUIRE(voice_pool.AllocateVoice(RESOURCES::AssetId::CAT_SOUND, sound_properties));
+
+        // VERIFY THAT THE SOUND CAN BE PLAYED AGAIN ONCE AN INSTANCE FINISHES.
+        voice_pool.Voices[*second_voice_index].Playing = false;
+        std::optional<std::size_t> reused_voice_index = voice_pool.AllocateVoice(RESOURCES::AssetId::DOG_SOUND, sound_properties);
+        REQUIRE(reused_voice_index);
+        REQUIRE(*second_voice_index == *reused_voice_index);
+    }
+
+    TEST_CASE("The oldest lowest priority voice is stolen when all voices are in use.", "[SoundVoicePool]")
+    {
+        // FILL ALL VOICES WITH DIFFERENT PRIORITY SOUNDS.
+        // Every other voice gets a higher priority sound.
+        SoundVoicePool voice_pool;
+        const SoundProperties LOW_PRIORITY_SOUND_PROPERTIES = { .Priority = 1, .MaxInstanceCount = SoundVoicePool::VOICE_COUNT };
+        const SoundProperties HIGH_PRIORITY_SOUND_PROPERTIES = { .Priority = 2, .MaxInstanceCount = SoundVoicePool::VOICE_COUNT };
+        for (std::size_t voice_index = 0; voice_index < SoundVoicePool::VOICE_COUNT; ++voice_index)
+        {
+            bool high_priority = (voice_index % 2 == 0);
+            if (high_priority)
+            {
+                REQUIRE(voice_pool.AllocateVoice(RESOURCES::AssetId::AXE_HIT_SOUND, HIGH_PRIORITY_SOUND_PROPERTIES));
+            }
+            else
+            {
+                REQUIRE(voice_pool.AllocateVoice(RESOURCES::AssetId::DOG_SOUND, LOW_PRIORITY_SOUND_PROPERTIES));
+            }
+        }
+
+        // VERIFY THAT THE OLDEST LOW PRIORITY VOICE IS STOLEN.
+        std::optional<std::size_t> first_stolen_voice_index = voice_pool.AllocateVoice(RESOURCES::AssetId::CAT_SOUND, LOW_PRIORITY_SOUND_PROPERTIES);
+        REQUIRE(first_stolen_voice_index);
+        REQUIRE(1 == *first_stolen_voice_index);
+        REQUIRE(RESOURCES::AssetId::CAT_SOUND == voice_pool.Voices[1].SoundId);
+
+        // VERIFY THAT THE NEXT OLDEST LOW PRIORITY VOICE IS STOLEN NEXT.
+        std::optional<std::size_t> second_stolen_voice_index = voice_pool.AllocateVoice(RESOURCES::AssetId::CAT_SOUND, LOW_PRIORITY_SOUND_PROPERTIES);
+        REQUIRE(second_stolen_voice_index);
+        REQUIRE(3 == *second_stolen_voice_index);
+
+        // VERIFY THAT A HIGH PRIORITY SOUND ALSO STEALS FROM LOW PRIORITY SOUNDS FIRST.
+        std::optional<std::size_t> high_priority_voice_index = voice_pool.AllocateVoice(RESOURCES::AssetId::FOOD_PICKUP_SOUND, HIGH_PRIORITY_SOUND_PROPERTIES);
+        REQUIRE(high_priority_voice_index);
+        REQUIRE(5 == *high_priority_voice_index);
+    }
+
+    TEST_CASE("Lower priority sounds can't steal voices from higher priority sounds.", "[SoundVoicePool]")
+    {
+        // FILL ALL VOICES WITH HIGH PRIORITY SOUNDS.
+        SoundVoicePool voice_pool;
+        const SoundProperties HIGH_PRIORITY_SOUND_PROPERTIES = { .Priority = 2, .MaxInstanceCount = SoundVoicePool::VOICE_COUNT };
+        for (std::size_t voice_index = 0; voice_index < SoundVoicePool::VOICE_COUNT; ++voice_index)
+        {
+            REQUIRE(voice_pool.AllocateVoice(RESOURCES::AssetId::AXE_HIT_SOUND, HIGH_PRIORITY_SOUND_PROPERTIES));
+        }
+
+        // VERIFY THAT A LOW PRIORITY SOUND ISN'T PLAYED.
+        const SoundProperties LOW_PRIORITY_SOUND_PROPERTIES = { .Priority = 1 };
+        REQUIRE_FALSE(voice_pool.AllocateVoice(RESOURCES::AssetId::DOG_SOUND, LOW_PRIORITY_SOUND_PROPERTIES));
+        REQUIRE(0 == voice_pool.PlayingInstanceCount(RESOURCES::AssetId::DOG_SOUND));
+
+        // VERIFY THAT STOPPING ALL VOICES FREES THEM UP.
+        voice_pool.StopAll();
+        REQUIRE(0 == voice_pool.PlayingInstanceCount(RESOURCES::AssetId::AXE_HIT_SOUND));
+        REQUIRE(voice_pool.AllocateVoice(RESOURCES::AssetId::DOG_SOUND, LOW_PRIORITY_SOUND_PROPERTIES));
+    }
+
+    TEST_CASE("Sound volume fades with distance from the listener.", "[SoundProperties]")
+    {
+        SoundProperties sound_properties = { .FullVolumeDistanceInPixels = 100.0f, .MaxAudibleDistanceInPixels = 300.0f };
+        REQUIRE(100.0f == sound_properties.VolumePercentAtDistance(0.0f));
+        REQUIRE(100.0f == sound_properties.VolumePercentAtDistance(100.0f));
+        REQUIRE(Approx(75.0f) == sound_properties.VolumePercentAtDistance(150.0f));
+        REQUIRE(Approx(50.0f) == sound_properties.VolumePercentAtDistance(200.0f));
+        REQUIRE(0.0f == sound_properties.VolumePercentAtDistance(300.0f));
+        REQUIRE(0.0f == sound_properties.VolumePercentAtDistance(1000.0f));
+    }
+}
@@ -318,4 +318,23 @@ namespace ARRAY_2D_TESTS
         // VALIDATE THAT AN EXCEPTION WAS THROWN.
         REQUIRE(exception_thrown);
     }
-}
\ No newline at end of file
+
+    TEST_CASE("Unchecked element access retrieves the same elements as checked access.", "[Array2D]")
+    {
+        // CREATE A 2D ARRAY.
+        const unsigned int WIDTH = 3;
+        const unsigned int HEIGHT = 2;
+        CONTAINERS::Array2D<int> array_2d(WIDTH, HEIGHT, {
+            1, 2, 3,
+            4, 5, 6 } );
+
+        // VALIDATE THAT EACH ELEMENT IS THE SAME.
+        for (unsigned int y = 0; y < HEIGHT; ++y)
+        {
+            for (unsigned int x = 0; x < WIDTH; ++x)
+            {
+                REQUIRE(&array_2d(x, y) == &array_2d.GetUnchecked(x, y));
+            }
+        }
+    }
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+#include "Containers/ObjectPool.h"
+
+/// A namespace for testing the ObjectPool class.
+namespace OBJECT_POOL_TESTS
+{
+    TEST_CASE("Objects can't be created in a full pool until others are destroyed.", "[ObjectPool]")
+    {
+        // FILL THE POOL.
+        CONTAINERS::ObjectPool<int, 2> pool;
+        std::optional<CONTAINERS::ObjectPoolHandle> first_handle = pool.Create(1);
+        std::optional<CONTAINERS::ObjectPoolHandle> second_handle = pool.Create(2);
+        REQUIRE(first_handle);
+        REQUIRE(second_handle);
+        REQUIRE(pool.Full());
+        REQUIRE_FALSE(pool.Create(3));
+
+        // VERIFY THAT DESTROYING AN OBJECT MAKES ROOM FOR ANOTHER.
+        REQUIRE(pool.Destroy(*first_handle));
+        REQUIRE(1 == pool.Count());
+        std::optional<CONTAINERS::ObjectPoolHandle> third_handle = pool.Create(3);
+        REQUIRE(third_handle);
+        REQUIRE(3 == *pool.Get(*third_handle));
+        REQUIRE(2 == *pool.Get(*second_handle));
+    }
+
+    TEST_CASE("Handles to destroyed objects don't refer to new objects in the same slot.", "[ObjectPool]")
+    {
+        // CREATE AND DESTROY AN OBJECT.
+        CONTAINERS::ObjectPool<int, 1> pool;
+        std::optional<CONTAINERS::ObjectPoolHandle> stale_handle = pool.Create(1);
+        REQUIRE(stale_handle);
+        REQUIRE(pool.Destroy(*stale_handle));
+        REQUIRE_FALSE(pool.Get(*stale_handle));
+
+        // CREATE A NEW OBJECT IN THE SAME SLOT.
+        std::optional<CONTAINERS::ObjectPoolHandle> new_handle = pool.Create(2);
+        REQUIRE(new_handle);
+        REQUIRE(stale_handle->SlotIndex == new_handle->SlotIndex);
+
+        // VERIFY THAT THE STALE HANDLE DOESN'T REFER TO THE NEW OBJECT.
+        REQUIRE_FALSE(pool.Get(*stale_handle));
+        REQUIRE_FALSE(pool.Destroy(*stale_handle));
+        REQUIRE(2 == *pool.Get(*new_handle));
+    }
+
+    TEST_CASE("Objects can be destroyed while iterating over a pool.", "[ObjectPool]")
+    {
+        // CREATE SEVERAL OBJECTS.
+        CONTAINERS::ObjectPool<int, 8> pool;
+        for (int object = 0; object < 5; ++object)
+        {
+            REQUIRE(pool.Create(object));
+        }
+
+        // DESTROY THE EVEN OBJECTS WHILE ITERATING.
+        std::vector<int> visited_objects;
+        for (auto object = pool.begin(); object != pool.end(); ++object)
+        {
+            visited_objects.push_back(*object);
+            bool is_even = (0 == *object % 2);
+            if (is_even)
+            {
+                REQUIRE(pool.Destroy(object.GetHandle()));
+            }
+        }
+
+        // VERIFY THAT ALL OBJECTS WERE VISITED AND ONLY THE ODD OBJECTS REMAIN.
+        REQUIRE(std::vector<int>({ 0, 1, 2, 3, 4 }) == visited_objects);
+        std::vector<int> remaining_objects;
+        for (const int object : pool)
+        {
+            remaining_objects.push_back(object);
+        }
+        REQUIRE(std::vector<int>({ 1, 3 }) == remaining_objects);
+        REQUIRE(2 == pool.Count());
+    }
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <numeric>
+#include <thread>
+#include <vector>
+#include "Containers/SingleProducerSingleConsumerQueue.h"
+
+/// A namespace for testing the SingleProducerSingleConsumerQueue class.
+namespace SINGLE_PRODUCER_SINGLE_CONSUMER_QUEUE_TESTS
+{
+    TEST_CASE("Elements are popped in the order they were pushed.", "[SingleProducerSingleConsumerQueue]")
+    {
+        // PUSH SOME ELEMENTS.
+        CONTAINERS::SingleProducerSingleConsumerQueue<int, 4> queue;
+        REQUIRE(queue.TryPush(1));
+        REQUIRE(queue.TryPush(2));
+        REQUIRE(queue.TryPush(3));
+        REQUIRE(3 == queue.Size());
+
+        // VERIFY THE ELEMENTS ARE POPPED IN ORDER.
+        int element = 0;
+        REQUIRE(queue.TryPop(element));
+        REQUIRE(1 == element);
+        REQUIRE(queue.TryPop(element));
+        REQUIRE(2 == element);
+        REQUIRE(queue.TryPop(element));
+        REQUIRE(3 == element);
+        REQUIRE_FALSE(queue.TryPop(element));
+        REQUIRE(0 == queue.Size());
+    }
+
+    TEST_CASE("Elements can't be pushed onto a full queue.", "[SingleProducerSingleConsumerQueue]")
+    {
+        // FILL THE QUEUE.
+        CONTAINERS::SingleProducerSingleConsumerQueue<int, 2> queue;
+        REQUIRE(queue.TryPush(1));
+        REQUIRE(queue.TryPush(2));
+        REQUIRE_FALSE(queue.TryPush(3));
+
+        // VERIFY THAT POPPING MAKES ROOM, EVEN AFTER WRAPPING AROUND.
+        int element = 0;
+        REQUIRE(queue.TryPop(element));
+        REQUIRE(1 == element);
+        REQUIRE(queue.TryPush(3));
+        REQUIRE(queue.TryPop(element));
+        REQUIRE(2 == element);
+        REQUIRE(queue.TryPop(element));
+        REQUIRE(3 == element);
+    }
+
+    TEST_CASE("Elements pushed from one thread are all popped in order from another thread.", "[SingleProducerSingleConsumerQueue]")
+    {
+        // PUSH ELEMENTS FROM A SEPARATE THREAD.
+        // A small queue is used to ensure both threads frequently wait on each other.
+        constexpr std::size_t ELEMENT_COUNT = 100000;
+        CONTAINERS::SingleProducerSingleConsumerQueue<std::size_t, 16> queue;
+        std::thread producer_thread([&queue]()
+        {
+            for (std::size_t element = 0; element < ELEMENT_COUNT; ++element)
+            {
+                while (!queue.TryPush(element))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        // POP ALL ELEMENTS ON THIS THREAD.
+        std::vector<std::size_t> popped_elements;
+        while (popped_elements.size() < ELEMENT_COUNT)
+        {
+            std::size_t element = 0;
+            if (queue.TryPop(element))
+            {
+                popped_elements.push_back(element);
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+        producer_thread.join();
+
+        // VERIFY THAT ALL ELEMENTS WERE POPPED IN ORDER.
+        std::vector<std::size_t> expected_elements(ELEMENT_COUNT);
+        std::iota(expected_elements.begin(), expected_elements.end(), 0);
+        REQUIRE(expected_elements == popped_elements);
+    }
+
+    TEST_CASE("Multiple elements are pushed and popped only in whole groups.", "[SingleProducerSingleConsumerQueue]")
+    {
+        // PUSH GROUPS OF ELEMENTS UNTIL THE QUEUE IS NEARLY FULL.
+        // Groups of 2 elements are used, like frames of stereo audio.
+        constexpr std::size_t GROUP_SIZE = 2;
+        CONTAINERS::SingleProducerSingleConsumerQueue<int, 8> queue;
+        const std::array<int, 6> FIRST_ELEMENTS = { 1, 2, 3, 4, 5, 6 };
+        REQUIRE(6 == queue.TryPushMany(FIRST_ELEMENTS, GROUP_SIZE));
+
+        // VERIFY THAT ONLY WHOLE GROUPS ARE POPPED.
+        std::array<int, 3> popped_elements = {};
+        REQUIRE(2 == queue.TryPopMany(popped_elements, GROUP_SIZE));
+        REQUIRE(1 == popped_elements[0]);
+        REQUIRE(2 == popped_elements[1]);
+
+        // VERIFY THAT ONLY WHOLE GROUPS ARE PUSHED WHEN THE QUEUE LACKS ROOM FOR ALL ELEMENTS, EVEN AFTER WRAPPING AROUND.
+        const std::array<int, 6> SECOND_ELEMENTS = { 7, 8, 9, 10, 11, 12 };
+        REQUIRE(4 == queue.TryPushMany(SECOND_ELEMENTS, GROUP_SIZE));
+        REQUIRE(8 == queue.Size());
+
+        // VERIFY THAT ALL PUSHED ELEMENTS ARE POPPED IN ORDER.
+        std::array<int, 8> remaining_elements = {};
+        REQUIRE(8 == queue.TryPopMany(remaining_elements, GROUP_SIZE));
+        const std::array<int, 8> EXPECTED_ELEMENTS = { 3, 4, 5, 6, 7, 8, 9, 10 };
+        REQUIRE(EXPECTED_ELEMENTS == remaining_elements);
+        REQUIRE(0 == queue.TryPopMany(remaining_elements, GROUP_SIZE));
+    }
+}
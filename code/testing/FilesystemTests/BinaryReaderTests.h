@@ -0,0 +1,71 @@
+#pragma once
+
+#include <string>
+#include "Filesystem/BinaryReader.h"
+#include "Filesystem/BinaryWriter.h"
+
+/// A namespace for testing the BinaryReader class.
+namespace TEST_BINARY_READER
+{
+    using namespace FILESYSTEM;
+
+    TEST_CASE("Values are written with fixed-width little-endian encodings.", "[BinaryReader]")
+    {
+        // WRITE SOME VALUES.
+        BinaryWriter writer;
+        writer.WriteUInt32(0x04030201);
+        writer.WriteUInt64(0x0807060504030201);
+        writer.WriteBool(true);
+        writer.WriteFloat(1.0f);
+        writer.WriteString("ark");
+
+        // VERIFY THE EXACT BYTES.
+        const std::string EXPECTED_BYTES(
+            "\x01\x02\x03\x04"
+            "\x01\x02\x03\x04\x05\x06\x07\x08"
+            "\x01"
+            "\x00\x00\x80\x3F"
+            "\x03\x00\x00\x00" "ark",
+            24);
+        REQUIRE(EXPECTED_BYTES == writer.Bytes);
+    }
+
+    TEST_CASE("Values written by a binary writer can be read back.", "[BinaryReader]")
+    {
+        // WRITE SOME VALUES.
+        BinaryWriter writer;
+        writer.WriteUInt8(200);
+        writer.WriteUInt32(0xFFFFFFF0);
+        writer.WriteUInt64(0x123456789ABCDEF0);
+        writer.WriteFloat(-2.5f);
+        writer.WriteBool(false);
+        writer.WriteString("Genesis 6:14");
+        writer.WriteUInt32(0);
+        writer.OverwriteUInt32(writer.Bytes.size() - sizeof(std::uint32_t), 7);
+
+        // READ THE VALUES BACK.
+        BinaryReader reader(writer.Bytes);
+        REQUIRE(200 == reader.ReadUInt8());
+        REQUIRE(0xFFFFFFF0 == reader.ReadUInt32());
+        REQUIRE(0x123456789ABCDEF0 == reader.ReadUInt64());
+        REQUIRE(-2.5f == reader.ReadFloat());
+        REQUIRE_FALSE(reader.ReadBool());
+        REQUIRE("Genesis 6:14" == reader.ReadString());
+        REQUIRE(7 == reader.ReadUInt32());
+        REQUIRE(0 == reader.RemainingByteCount());
+        REQUIRE_FALSE(reader.Failed());
+    }
+
+    TEST_CASE("Reading past the end of the bytes fails.", "[BinaryReader]")
+    {
+        // READ MORE BYTES THAN EXIST.
+        const std::string BYTES("\x01\x02\x03", 3);
+        BinaryReader reader(BYTES);
+        REQUIRE(0 == reader.ReadUInt32());
+        REQUIRE(reader.Failed());
+
+        // VERIFY THAT THE READER REMAINS FAILED.
+        REQUIRE(0 == reader.ReadUInt8());
+        REQUIRE(reader.Failed());
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include "Filesystem/FileRegionStream.h"
+
+/// A namespace for testing the FileRegionStream class.
+namespace TEST_FILE_REGION_STREAM
+{
+    using namespace FILESYSTEM;
+
+    TEST_CASE("A file region stream only reads within its region.", "[FileRegionStream]")
+    {
+        // WRITE A FILE WITH A REGION IN THE MIDDLE.
+        const std::filesystem::path FILEPATH = std::filesystem::temp_directory_path() / "noah_ark_file_region_stream_test.bin";
+        {
+            std::ofstream file(FILEPATH, std::ios::binary);
+            file << "before|region data|after";
+        }
+
+        // The file must be closed before it can be removed.
+        {
+            // OPEN THE REGION.
+            FileRegion region = { .Filepath = FILEPATH, .OffsetInBytes = 7, .SizeInBytes = 11 };
+            FileRegionStream stream;
+            REQUIRE(stream.Open(region));
+            REQUIRE(11 == stream.getSize());
+            REQUIRE(0 == stream.tell());
+
+            // READ PAST THE END OF THE REGION.
+            std::array<char, 32> data = {};
+            REQUIRE(11 == stream.read(data.data(), static_cast<sf::Int64>(data.size())));
+            REQUIRE("region data" == std::string(data.data(), 11));
+            REQUIRE(11 == stream.tell());
+            REQUIRE(0 == stream.read(data.data(), static_cast<sf::Int64>(data.size())));
+
+            // SEEK WITHIN THE REGION.
+            REQUIRE(7 == stream.seek(7));
+            REQUIRE(4 == stream.read(data.data(), static_cast<sf::Int64>(data.size())));
+            REQUIRE("data" == std::string(data.data(), 4));
+
+            // SEEKING BEYOND THE REGION SHOULD FAIL.
+            REQUIRE(-1 == stream.seek(12));
+        }
+
+        std::filesystem::remove(FILEPATH);
+    }
+
+    TEST_CASE("A file region stream can't be opened for a missing file.", "[FileRegionStream]")
+    {
+        FileRegion region = { .Filepath = std::filesystem::temp_directory_path() / "noah_ark_missing_file.bin", .OffsetInBytes = 0, .SizeInBytes = 1 };
+        FileRegionStream stream;
+        REQUIRE_FALSE(stream.Open(region));
+    }
+}
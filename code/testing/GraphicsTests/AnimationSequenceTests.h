@@ -32,7 +32,7 @@ namespace TEST_ANIMATION_SEQUENCE
         REQUIRE( TEST_DURATION == animationSequence.TotalDuration );
 
         // Verify the frames.
-        REQUIRE( TEST_FRAMES == animationSequence.Frames );
+        REQUIRE( TEST_FRAMES == *animationSequence.Frames );
     }
 
     TEST_CASE( "Constructor.  Not looping.", "[AnimationSequence][Constructor][NotLooping]" )
@@ -62,6 +62,32 @@ namespace TEST_ANIMATION_SEQUENCE
         REQUIRE( TEST_DURATION == animationSequence.TotalDuration );
 
         // Verify the frames.
-        REQUIRE( TEST_FRAMES == animationSequence.Frames );
+        REQUIRE( TEST_FRAMES == *animationSequence.Frames );
+    }
+
+    TEST_CASE( "Frames can be shared between animation sequences.", "[AnimationSequence][Constructor][SharedFrames]" )
+    {
+        // CONSTRUCT ANIMATION SEQUENCES WITH SHARED FRAMES.
+        const auto SHARED_FRAMES = std::make_shared<const std::vector<MATH::IntRectangle>>(std::vector<MATH::IntRectangle>
+        {
+            MATH::IntRectangle::FromLeftTopAndDimensions(0, 0, 16, 16),
+            MATH::IntRectangle::FromLeftTopAndDimensions(16, 0, 16, 16)
+        });
+        const bool IS_NOT_LOOPING = false;
+        const sf::Time TEST_DURATION = sf::seconds(1.0f);
+        GRAPHICS::AnimationSequence first_animation_sequence("TestAnimationSequence", IS_NOT_LOOPING, TEST_DURATION, SHARED_FRAMES);
+        GRAPHICS::AnimationSequence second_animation_sequence("TestAnimationSequence", IS_NOT_LOOPING, TEST_DURATION, SHARED_FRAMES);
+
+        // VERIFY THAT THE FRAMES AREN'T COPIED.
+        REQUIRE( SHARED_FRAMES == first_animation_sequence.Frames );
+        REQUIRE( SHARED_FRAMES == second_animation_sequence.Frames );
+
+        // VERIFY THAT PLAYBACK IS STILL SEPARATE FOR EACH ANIMATION SEQUENCE.
+        first_animation_sequence.Start();
+        first_animation_sequence.Progress(sf::seconds(0.5f));
+        REQUIRE( first_animation_sequence.IsPlaying() );
+        REQUIRE( SHARED_FRAMES->at(1) == first_animation_sequence.GetCurrentFrame() );
+        REQUIRE_FALSE( second_animation_sequence.IsPlaying() );
+        REQUIRE( SHARED_FRAMES->at(0) == second_animation_sequence.GetCurrentFrame() );
     }
 }
\ No newline at end of file
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "Graphics/DirtyRegionTracker.h"
+#include "Math/Rectangle.h"
+#include "Memory/AllocationTracker.h"
+
+/// A namespace for testing the DirtyRegionTracker class.
+namespace DIRTY_REGION_TRACKER_TESTS
+{
+    using namespace GRAPHICS;
+
+    /// The rectangle of the entire screen for testing.
+    const MATH::FloatRectangle SCREEN_RECTANGLE = MATH::FloatRectangle::FromLeftTopAndDimensions(0.0f, 0.0f, 512.0f, 384.0f);
+    /// A rectangle for a title drawn on the screen.
+    const MATH::FloatRectangle TITLE_RECTANGLE = MATH::FloatRectangle::FromLeftTopAndDimensions(64.0f, 32.0f, 384.0f, 32.0f);
+    /// A rectangle for a menu option drawn on the screen, not overlapping the title.
+    const MATH::FloatRectangle MENU_OPTION_RECTANGLE = MATH::FloatRectangle::FromLeftTopAndDimensions(128.0f, 200.0f, 128.0f, 16.0f);
+
+    /// Records a frame with a title and menu option, and computes its dirty regions.
+    /// @param[in]  menu_option_hash - The content hash for the menu option.
+    /// @param[in,out]  tracker - The tracker to record the frame in.
+    void RecordMenuFrame(const std::size_t menu_option_hash, DirtyRegionTracker& tracker)
+    {
+        constexpr std::size_t TITLE_HASH = 1;
+        tracker.BeginFrame();
+        tracker.Record(TITLE_RECTANGLE, TITLE_HASH);
+        tracker.Record(MENU_OPTION_RECTANGLE, menu_option_hash);
+        tracker.ComputeDirtyRegions(SCREEN_RECTANGLE);
+    }
+
+    TEST_CASE("The entire screen is dirty for the first frame.", "[DirtyRegionTracker]")
+    {
+        DirtyRegionTracker tracker;
+        RecordMenuFrame(2, tracker);
+
+        REQUIRE(1 == tracker.DirtyRegions.size());
+        REQUIRE(static_cast<unsigned int>(512 * 384) == tracker.DirtyPixelCount());
+        REQUIRE(tracker.IsDirty(TITLE_RECTANGLE));
+        REQUIRE(tracker.IsDirty(MENU_OPTION_RECTANGLE));
+    }
+
+    TEST_CASE("Nothing is dirty if nothing changed since the previous frame.", "[DirtyRegionTracker]")
+    {
+        DirtyRegionTracker tracker;
+        RecordMenuFrame(2, tracker);
+        RecordMenuFrame(2, tracker);
+
+        REQUIRE(tracker.DirtyRegions.empty());
+        REQUIRE(0 == tracker.DirtyPixelCount());
+        REQUIRE_FALSE(tracker.IsDirty(TITLE_RECTANGLE));
+        REQUIRE_FALSE(tracker.IsDirty(MENU_OPTION_RECTANGLE));
+    }
+
+    TEST_CASE("Only changed regions are dirty.", "[DirtyRegionTracker]")
+    {
+        DirtyRegionTracker tracker;
+        RecordMenuFrame(2, tracker);
+        RecordMenuFrame(3, tracker);
+
+        REQUIRE(1 == tracker.DirtyRegions.size());
+        REQUIRE(static_cast<unsigned int>(128 * 16) == tracker.DirtyPixelCount());
+        REQUIRE_FALSE(tracker.IsDirty(TITLE_RECTANGLE));
+        REQUIRE(tracker.IsDirty(MENU_OPTION_RECTANGLE));
+    }
+
+    TEST_CASE("Removed drawings are dirty.", "[DirtyRegionTracker]")
+    {
+        DirtyRegionTracker tracker;
+        RecordMenuFrame(2, tracker);
+
+        constexpr std::size_t TITLE_HASH = 1;
+        tracker.BeginFrame();
+        tracker.Record(TITLE_RECTANGLE, TITLE_HASH);
+        tracker.ComputeDirtyRegions(SCREEN_RECTANGLE);
+
+        REQUIRE(static_cast<unsigned int>(128 * 16) == tracker.DirtyPixelCount());
+        REQUIRE(tracker.IsDirty(MENU_OPTION_RECTANGLE));
+    }
+
+    TEST_CASE("Dirty regions expand to cover overlapping drawings.", "[DirtyRegionTracker]")
+    {
+        // RECORD A BACKGROUND BEHIND THE MENU OPTION.
+        const MATH::FloatRectangle BACKGROUND_RECTANGLE = MATH::FloatRectangle::FromLeftTopAndDimensions(96.0f, 192.0f, 256.0f, 64.0f);
+        constexpr std::size_t BACKGROUND_HASH = 4;
+        DirtyRegionTracker tracker;
+        tracker.BeginFrame();
+        tracker.Record(BACKGROUND_RECTANGLE, BACKGROUND_HASH);
+        tracker.Record(MENU_OPTION_RECTANGLE, 2);
+        tracker.ComputeDirtyRegions(SCREEN_RECTANGLE);
+
+        // CHANGE ONLY THE MENU OPTION.
+        tracker.BeginFrame();
+        tracker.Record(BACKGROUND_RECTANGLE, BACKGROUND_HASH);
+        tracker.Record(MENU_OPTION_RECTANGLE, 3);
+        tracker.ComputeDirtyRegions(SCREEN_RECTANGLE);
+
+        // VERIFY THAT THE ENTIRE BACKGROUND IS REDRAWN.
+        REQUIRE(1 == tracker.DirtyRegions.size());
+        REQUIRE(static_cast<unsigned int>(256 * 64) == tracker.DirtyPixelCount());
+        REQUIRE_FALSE(tracker.IsDirty(TITLE_RECTANGLE));
+    }
+
+    TEST_CASE("Dirty regions are aligned to whole pixels and limited to the screen.", "[DirtyRegionTracker]")
+    {
+        DirtyRegionTracker tracker;
+        RecordMenuFrame(2, tracker);
+
+        const MATH::FloatRectangle PARTIALLY_OFF_SCREEN_RECTANGLE = MATH::FloatRectangle::FromLeftTopAndDimensions(500.5f, 10.25f, 32.0f, 4.5f);
+        tracker.BeginFrame();
+        tracker.Record(TITLE_RECTANGLE, 1);
+        tracker.Record(MENU_OPTION_RECTANGLE, 2);
+        tracker.Record(PARTIALLY_OFF_SCREEN_RECTANGLE, 5);
+        tracker.ComputeDirtyRegions(SCREEN_RECTANGLE);
+
+        REQUIRE(1 == tracker.DirtyRegions.size());
+        REQUIRE(500.0f == tracker.DirtyRegions[0].LeftTop.X);
+        REQUIRE(10.0f == tracker.DirtyRegions[0].LeftTop.Y);
+        REQUIRE(512.0f == tracker.DirtyRegions[0].RightBottom.X);
+        REQUIRE(15.0f == tracker.DirtyRegions[0].RightBottom.Y);
+    }
+
+    TEST_CASE("Marking everything dirty redraws the entire screen.", "[DirtyRegionTracker]")
+    {
+        DirtyRegionTracker tracker;
+        RecordMenuFrame(2, tracker);
+        tracker.MarkAllDirty();
+        RecordMenuFrame(2, tracker);
+
+        REQUIRE(static_cast<unsigned int>(512 * 384) == tracker.DirtyPixelCount());
+    }
+
+    TEST_CASE("Computing dirty regions for changing frames doesn't allocate memory once warmed up.", "[DirtyRegionTracker]")
+    {
+        // WARM UP THE TRACKER WITH FRAMES THAT CHANGE.
+        DirtyRegionTracker tracker;
+        RecordMenuFrame(2, tracker);
+        RecordMenuFrame(3, tracker);
+        RecordMenuFrame(2, tracker);
+
+        // VERIFY THAT FURTHER CHANGING FRAMES DON'T ALLOCATE MEMORY.
+        constexpr std::size_t MEASURED_FRAME_COUNT = 60;
+        std::size_t allocation_count_before_frames = MEMORY::AllocationTracker::GetTotalAllocationCount();
+        for (std::size_t frame_index = 0; frame_index < MEASURED_FRAME_COUNT; ++frame_index)
+        {
+            std::size_t menu_option_hash = 2 + (frame_index % 2);
+            RecordMenuFrame(menu_option_hash, tracker);
+        }
+        std::size_t allocation_count = MEMORY::AllocationTracker::GetTotalAllocationCount() - allocation_count_before_frames;
+        REQUIRE(0 == allocation_count);
+        REQUIRE(tracker.IsDirty(MENU_OPTION_RECTANGLE));
+    }
+}
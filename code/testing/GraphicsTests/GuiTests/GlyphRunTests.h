@@ -0,0 +1,112 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include "Graphics/Gui/Font.h"
+#include "Graphics/Gui/GlyphRun.h"
+#include "Graphics/Gui/GlyphRunCache.h"
+#include "Graphics/Gui/Text.h"
+
+/// A namespace for testing the GlyphRun class.
+namespace TEST_GLYPH_RUN
+{
+    using namespace GRAPHICS::GUI;
+
+    /// Creates a simple font where each glyph is a different width for testing.
+    /// @return A font for testing.
+    std::shared_ptr<Font> CreateTestFont()
+    {
+        std::shared_ptr<Font> font = std::make_shared<Font>();
+        for (unsigned int character_value = 0; character_value < Font::CHARACTER_COUNT; ++character_value)
+        {
+            // Widths vary between glyphs to help catch layout errors.
+            float glyph_width = static_cast<float>((character_value % Font::GLYPH_MAX_DIMENSION_IN_PIXELS) + 1);
+            font->GlyphsByCharacter[character_value] = Glyph
+            {
+                .Character = static_cast<char>(character_value),
+                .Texture = font->Texture,
+                .TextureSubRectangle = MATH::FloatRectangle::FromLeftTopAndDimensions(
+                    static_cast<float>((character_value % Font::GLYPH_MAX_COUNT_PER_ROW_OR_COLUMN) * Font::GLYPH_MAX_DIMENSION_IN_PIXELS),
+                    static_cast<float>((character_value / Font::GLYPH_MAX_COUNT_PER_ROW_OR_COLUMN) * Font::GLYPH_MAX_DIMENSION_IN_PIXELS),
+                    glyph_width,
+                    static_cast<float>(Glyph::DEFAULT_HEIGHT_IN_PIXELS))
+            };
+        }
+        return font;
+    }
+
+    TEST_CASE("A glyph run has the same width as equivalent text.", "[GlyphRun]")
+    {
+        // LAY OUT A GLYPH RUN.
+        std::shared_ptr<Font> font = CreateTestFont();
+        const std::string TEXT = "And Noah did according unto all that the LORD commanded him.";
+        const float SCALE_FACTOR = 2.0f;
+        GlyphRun glyph_run;
+        bool laid_out = glyph_run.Layout(TEXT, font, SCALE_FACTOR, GRAPHICS::Color::WHITE);
+        REQUIRE(laid_out);
+
+        // VERIFY THE GLYPH RUN MATCHES THE TEXT.
+        Text text = { .String = TEXT, .ScaleFactor = SCALE_FACTOR };
+        float expected_width_in_pixels = text.Width<float>(*font);
+        REQUIRE(expected_width_in_pixels == glyph_run.WidthInPixels);
+        REQUIRE(TEXT.size() == glyph_run.CharacterCount());
+        REQUIRE(TEXT.size() * GlyphRun::VERTEX_COUNT_PER_CHARACTER == glyph_run.Vertices.size());
+    }
+
+    TEST_CASE("A glyph run is only laid out again if the text or style changes.", "[GlyphRun]")
+    {
+        // LAY OUT A GLYPH RUN.
+        std::shared_ptr<Font> font = CreateTestFont();
+        GlyphRun glyph_run;
+        REQUIRE(glyph_run.Layout("Noah", font, 1.0f, GRAPHICS::Color::BLACK));
+
+        // VERIFY THAT THE SAME TEXT DOESN'T REQUIRE A NEW LAYOUT.
+        REQUIRE_FALSE(glyph_run.Layout("Noah", font, 1.0f, GRAPHICS::Color::BLACK));
+
+        // VERIFY THAT A DIFFERENT COLOR ONLY RECOLORS THE TEXT.
+        REQUIRE_FALSE(glyph_run.Layout("Noah", font, 1.0f, GRAPHICS::Color::RED));
+        REQUIRE(GRAPHICS::Color::RED.Red == glyph_run.Vertices.front().color.r);
+
+        // VERIFY THAT DIFFERENT TEXT OR SCALING REQUIRES A NEW LAYOUT.
+        REQUIRE(glyph_run.Layout("Noah's ark", font, 1.0f, GRAPHICS::Color::RED));
+        REQUIRE(glyph_run.Layout("Noah's ark", font, 2.0f, GRAPHICS::Color::RED));
+    }
+
+    TEST_CASE("Character ranges are clamped to the glyph run.", "[GlyphRun]")
+    {
+        std::shared_ptr<Font> font = CreateTestFont();
+        GlyphRun glyph_run;
+        glyph_run.Layout("Shem", font, 1.0f, GRAPHICS::Color::BLACK);
+
+        REQUIRE(4 == glyph_run.ClampCharacterCount(0, GlyphRun::ALL_CHARACTERS));
+        REQUIRE(2 == glyph_run.ClampCharacterCount(0, 2));
+        REQUIRE(1 == glyph_run.ClampCharacterCount(3, 2));
+        REQUIRE(0 == glyph_run.ClampCharacterCount(4, 1));
+    }
+
+    TEST_CASE("Unused glyph runs are evicted from the cache.", "[GlyphRunCache]")
+    {
+        // CACHE A GLYPH RUN.
+        std::shared_ptr<Font> font = CreateTestFont();
+        GlyphRunCache glyph_run_cache;
+        glyph_run_cache.Get("Ham", RESOURCES::AssetId::FONT_TEXTURE, font, 1.0f, GRAPHICS::Color::BLACK);
+        REQUIRE(1 == glyph_run_cache.GlyphRunCount());
+        REQUIRE(1 == glyph_run_cache.LayoutCount);
+
+        // VERIFY THAT THE GLYPH RUN REMAINS CACHED WHILE USED.
+        for (unsigned int frame_index = 0; frame_index <= GlyphRunCache::MAX_UNUSED_FRAME_COUNT_BEFORE_EVICTION; ++frame_index)
+        {
+            glyph_run_cache.Get("Ham", RESOURCES::AssetId::FONT_TEXTURE, font, 1.0f, GRAPHICS::Color::BLACK);
+            glyph_run_cache.EndFrame();
+        }
+        REQUIRE(1 == glyph_run_cache.GlyphRunCount());
+        REQUIRE(1 == glyph_run_cache.LayoutCount);
+
+        // VERIFY THAT THE GLYPH RUN IS EVICTED ONCE UNUSED.
+        for (unsigned int frame_index = 0; frame_index <= GlyphRunCache::MAX_UNUSED_FRAME_COUNT_BEFORE_EVICTION + 1; ++frame_index)
+        {
+            glyph_run_cache.EndFrame();
+        }
+        REQUIRE(0 == glyph_run_cache.GlyphRunCount());
+    }
+}
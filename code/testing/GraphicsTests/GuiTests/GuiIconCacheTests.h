@@ -0,0 +1,110 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+#include "Graphics/Color.h"
+#include "Graphics/Gui/GuiIconCache.h"
+#include "Graphics/ShapeType.h"
+#include "Math/Rectangle.h"
+#include "Resources/AssetId.h"
+
+/// A namespace for testing the GuiIconCache class.
+namespace TEST_GUI_ICON_CACHE
+{
+    using namespace GRAPHICS::GUI;
+
+    TEST_CASE("The same GUI icon is only added to the atlas once.", "[GuiIconCache]")
+    {
+        // ADD A KEY ICON.
+        GuiIconCache gui_icon_cache;
+        GuiIcon key_icon = GuiIcon::Key('I', GRAPHICS::ShapeType::RECTANGLE, GRAPHICS::Color::GRAY, GRAPHICS::Color::LIGHT_GRAY, GRAPHICS::Color::BLACK);
+        REQUIRE(nullptr == gui_icon_cache.Find(key_icon));
+        const MATH::FloatRectangle* added_atlas_rectangle = gui_icon_cache.Add(key_icon);
+        REQUIRE(nullptr != added_atlas_rectangle);
+
+        // VERIFY THAT AN IDENTICAL ICON IS FOUND IN THE SAME PLACE.
+        GuiIcon same_key_icon = GuiIcon::Key('I', GRAPHICS::ShapeType::RECTANGLE, GRAPHICS::Color::GRAY, GRAPHICS::Color::LIGHT_GRAY, GRAPHICS::Color::BLACK);
+        REQUIRE(key_icon == same_key_icon);
+        REQUIRE(std::hash<GuiIcon>()(key_icon) == std::hash<GuiIcon>()(same_key_icon));
+        REQUIRE(added_atlas_rectangle == gui_icon_cache.Find(same_key_icon));
+        REQUIRE(1 == gui_icon_cache.IconCount());
+
+        // VERIFY THAT ICONS DIFFERING IN ANY WAY ARE NOT FOUND.
+        REQUIRE(nullptr == gui_icon_cache.Find(GuiIcon::Key('E', GRAPHICS::ShapeType::RECTANGLE, GRAPHICS::Color::GRAY, GRAPHICS::Color::LIGHT_GRAY, GRAPHICS::Color::BLACK)));
+        REQUIRE(nullptr == gui_icon_cache.Find(GuiIcon::Key('I', GRAPHICS::ShapeType::CIRCLE, GRAPHICS::Color::GRAY, GRAPHICS::Color::LIGHT_GRAY, GRAPHICS::Color::BLACK)));
+        REQUIRE(nullptr == gui_icon_cache.Find(GuiIcon::Key('I', GRAPHICS::ShapeType::RECTANGLE, GRAPHICS::Color::GRAY, GRAPHICS::Color::LIGHT_GRAY, GRAPHICS::Color::RED)));
+        REQUIRE(nullptr == gui_icon_cache.Find(GuiIcon::SolidWhite()));
+    }
+
+    TEST_CASE("GUI icons in the atlas don't overlap.", "[GuiIconCache]")
+    {
+        // ADD ENOUGH ICONS TO SPAN MULTIPLE SHELVES.
+        GuiIconCache gui_icon_cache;
+        std::vector<MATH::FloatRectangle> atlas_rectangles;
+        for (unsigned int icon_index = 0; icon_index < 64; ++icon_index)
+        {
+            // Icons of varying sizes are used to exercise how icons are packed.
+            float icon_dimension_in_pixels = static_cast<float>(8 + (icon_index % 5) * 8);
+            MATH::FloatRectangle texture_sub_rectangle = MATH::FloatRectangle::FromLeftTopAndDimensions(
+                static_cast<float>(icon_index),
+                0.0f,
+                icon_dimension_in_pixels,
+                icon_dimension_in_pixels);
+            GuiIcon icon = GuiIcon::TextureRegion(RESOURCES::AssetId::AXE_TEXTURE, texture_sub_rectangle);
+            const MATH::FloatRectangle* atlas_rectangle = gui_icon_cache.Add(icon);
+            REQUIRE(nullptr != atlas_rectangle);
+            REQUIRE(icon_dimension_in_pixels == atlas_rectangle->Width());
+            REQUIRE(icon_dimension_in_pixels == atlas_rectangle->Height());
+            atlas_rectangles.push_back(*atlas_rectangle);
+        }
+
+        // VERIFY THAT ALL ICONS ARE WITHIN THE ATLAS WITHOUT OVERLAPPING.
+        const MATH::FloatRectangle ATLAS_RECTANGLE = MATH::FloatRectangle::FromLeftTopAndDimensions(
+            0.0f,
+            0.0f,
+            static_cast<float>(GuiIconCache::ATLAS_DIMENSION_IN_PIXELS),
+            static_cast<float>(GuiIconCache::ATLAS_DIMENSION_IN_PIXELS));
+        for (std::size_t icon_index = 0; icon_index < atlas_rectangles.size(); ++icon_index)
+        {
+            const MATH::FloatRectangle& atlas_rectangle = atlas_rectangles[icon_index];
+            REQUIRE(ATLAS_RECTANGLE.Contains(atlas_rectangle.LeftTop.X, atlas_rectangle.LeftTop.Y));
+            REQUIRE(atlas_rectangle.RightBottom.X <= ATLAS_RECTANGLE.RightBottom.X);
+            REQUIRE(atlas_rectangle.RightBottom.Y <= ATLAS_RECTANGLE.RightBottom.Y);
+
+            for (std::size_t other_icon_index = icon_index + 1; other_icon_index < atlas_rectangles.size(); ++other_icon_index)
+            {
+                REQUIRE_FALSE(atlas_rectangle.Intersects(atlas_rectangles[other_icon_index]));
+            }
+        }
+    }
+
+    TEST_CASE("GUI icons can't be added once the atlas is full.", "[GuiIconCache]")
+    {
+        // FILL THE ATLAS WITH ICONS.
+        GuiIconCache gui_icon_cache;
+        const float ICON_DIMENSION_IN_PIXELS = static_cast<float>(GuiIconCache::ATLAS_DIMENSION_IN_PIXELS / 2);
+        for (unsigned int icon_index = 0; icon_index < 4; ++icon_index)
+        {
+            MATH::FloatRectangle texture_sub_rectangle = MATH::FloatRectangle::FromLeftTopAndDimensions(
+                static_cast<float>(icon_index),
+                0.0f,
+                ICON_DIMENSION_IN_PIXELS - 1.0f,
+                ICON_DIMENSION_IN_PIXELS - 1.0f);
+            REQUIRE(nullptr != gui_icon_cache.Add(GuiIcon::TextureRegion(RESOURCES::AssetId::AXE_TEXTURE, texture_sub_rectangle)));
+        }
+
+        // VERIFY THAT NO MORE ICONS CAN BE ADDED.
+        REQUIRE(nullptr == gui_icon_cache.Add(GuiIcon::SolidWhite()));
+        REQUIRE(4 == gui_icon_cache.IconCount());
+
+        // VERIFY THAT ICONS TOO LARGE FOR ANY ATLAS CAN'T BE ADDED.
+        GuiIconCache empty_gui_icon_cache;
+        MATH::FloatRectangle too_large_texture_sub_rectangle = MATH::FloatRectangle::FromLeftTopAndDimensions(
+            0.0f,
+            0.0f,
+            static_cast<float>(GuiIconCache::ATLAS_DIMENSION_IN_PIXELS + 1),
+            1.0f);
+        REQUIRE(nullptr == empty_gui_icon_cache.Add(GuiIcon::TextureRegion(RESOURCES::AssetId::AXE_TEXTURE, too_large_texture_sub_rectangle)));
+        REQUIRE(nullptr != empty_gui_icon_cache.Add(GuiIcon::SolidWhite()));
+    }
+}
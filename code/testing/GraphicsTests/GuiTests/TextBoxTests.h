@@ -1,11 +1,12 @@
 #pragma once
 
 #include <iterator>
+#include <memory>
 #include <queue>
 #include <sstream>
 #include <string>
 #include <vector>
-#include <Windows.h>
+#include "Graphics/Gui/FontMetrics.h"
 #include "String/String.h"
 #include "Graphics/Gui/TextBox.h"
 
@@ -28,7 +29,7 @@ namespace TEST_TEXT_BOX
         // CREATE A TEXT BOX.
         const unsigned int WIDTH_IN_PIXELS = 512;
         const unsigned int HEIGHT_IN_PIXELS = 32;
-        std::shared_ptr<Font> font = Font::LoadSystemDefaultFont(SYSTEM_FIXED_FONT);
+        std::shared_ptr<Font> font = Font::Create(MAIN_FONT_GLYPH_METRICS, std::make_shared<GRAPHICS::Texture>());
         TextBox text_box(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, font);
 
         // DEFINE THE MESSAGE TO START DISPLAYING.
@@ -0,0 +1,237 @@
+#pragma once
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Bible/BibleVerses.h"
+#include "Graphics/Gui/Font.h"
+#include "Graphics/Gui/FontMetrics.h"
+#include "Graphics/Gui/Text.h"
+#include "Graphics/Gui/TextLayout.h"
+#include "Graphics/Gui/TextLayoutCache.h"
+#include "String/String.h"
+
+/// A namespace for testing the TextLayout class.
+namespace TEST_TEXT_LAYOUT
+{
+    using namespace GRAPHICS::GUI;
+
+    /// Creates the main font for testing.  Only its metrics are needed, not a loaded texture.
+    /// @return The main font.
+    std::shared_ptr<Font> CreateMainFont()
+    {
+        std::shared_ptr<Font> font = Font::Create(MAIN_FONT_GLYPH_METRICS, std::make_shared<GRAPHICS::Texture>());
+        return font;
+    }
+
+    /// Gets all wrapped lines of text as separate strings.
+    /// @param[in]  layout - The layout of the text.
+    /// @param[in]  text - The text that was wrapped.
+    /// @return The wrapped lines of text.
+    std::vector<std::string> GetLines(const TextLayout& layout, const std::string& text)
+    {
+        std::vector<std::string> lines;
+        for (std::size_t line_index = 0; line_index < layout.Lines.size(); ++line_index)
+        {
+            lines.emplace_back(layout.GetLine(text, line_index));
+        }
+        return lines;
+    }
+
+    /// Word-wraps text the way the renderer did prior to having text layouts,
+    /// by splitting text into copies of lines and words and measuring them as they are joined.
+    /// Used as a baseline for benchmarking.
+    /// @param[in]  text - The text to wrap.
+    /// @param[in]  font - The font for measuring the text.
+    /// @param[in]  line_width_in_pixels - The maximum width of each line.
+    /// @return The wrapped lines of text.
+    std::vector<std::string> WrapLinesBySplittingWords(const std::string& text, const Font& font, const float line_width_in_pixels)
+    {
+        std::vector<std::string> new_lines_of_text;
+        std::vector<std::string> original_lines_from_text = STRING::String::SplitIntoLines(text);
+        unsigned int max_characters_per_line = static_cast<unsigned int>(line_width_in_pixels / (Glyph::DEFAULT_WIDTH_IN_PIXELS / 2.0f));
+        for (const auto& line : original_lines_from_text)
+        {
+            std::deque<std::string> words_in_current_line = STRING::String::SplitIntoWords(line, max_characters_per_line);
+            std::string current_new_line;
+            for (const std::string& next_word : words_in_current_line)
+            {
+                Text current_line_text = { .String = current_new_line };
+                Text next_word_text = { .String = next_word };
+                float line_width_with_next_word_in_pixels =
+                    current_line_text.Width<float>(font) +
+                    Text::AdvanceWidthInPixels(font, ' ', 1.0f) +
+                    next_word_text.Width<float>(font);
+                if (current_new_line.empty())
+                {
+                    current_new_line = next_word;
+                }
+                else if (line_width_with_next_word_in_pixels <= line_width_in_pixels)
+                {
+                    current_new_line += ' ' + next_word;
+                }
+                else
+                {
+                    new_lines_of_text.push_back(current_new_line);
+                    current_new_line = next_word;
+                }
+            }
+
+            if (!current_new_line.empty())
+            {
+                new_lines_of_text.push_back(current_new_line);
+            }
+        }
+        return new_lines_of_text;
+    }
+
+    TEST_CASE("Text is wrapped at word boundaries.", "[TextLayout]")
+    {
+        // WRAP SOME TEXT.
+        std::shared_ptr<Font> font = CreateMainFont();
+        const std::string TEXT = "And Noah did according unto all that the LORD commanded him.";
+        const float LINE_WIDTH_IN_PIXELS = 200.0f;
+        TextLayout layout = TextLayout::WrapLines(TEXT, *font, LINE_WIDTH_IN_PIXELS, 1.0f);
+
+        // VERIFY EACH LINE FITS AND THAT NO WORDS WERE LOST.
+        std::vector<std::string> lines = GetLines(layout, TEXT);
+        REQUIRE(lines.size() > 1);
+        std::string rejoined_text;
+        for (std::size_t line_index = 0; line_index < lines.size(); ++line_index)
+        {
+            Text line_text = { .String = lines[line_index] };
+            float line_width_in_pixels = line_text.Width<float>(*font);
+            REQUIRE(line_width_in_pixels == layout.Lines[line_index].WidthInPixels);
+            REQUIRE(line_width_in_pixels <= LINE_WIDTH_IN_PIXELS);
+            REQUIRE(' ' != lines[line_index].front());
+            REQUIRE(' ' != lines[line_index].back());
+
+            if (!rejoined_text.empty())
+            {
+                rejoined_text += ' ';
+            }
+            rejoined_text += lines[line_index];
+        }
+        REQUIRE(TEXT == rejoined_text);
+    }
+
+    TEST_CASE("Text is wrapped the same as when splitting words.", "[TextLayout]")
+    {
+        std::shared_ptr<Font> font = CreateMainFont();
+        const float LINE_WIDTH_IN_PIXELS = 256.0f;
+        for (const BIBLE::BibleVerse& bible_verse : BIBLE::BIBLE_VERSES)
+        {
+            TextLayout layout = TextLayout::WrapLines(bible_verse.Text, *font, LINE_WIDTH_IN_PIXELS, 1.0f);
+            std::vector<std::string> expected_lines = WrapLinesBySplittingWords(bible_verse.Text, *font, LINE_WIDTH_IN_PIXELS);
+            std::vector<std::string> actual_lines = GetLines(layout, bible_verse.Text);
+            REQUIRE(expected_lines == actual_lines);
+        }
+    }
+
+    TEST_CASE("Newlines in text start new lines.", "[TextLayout]")
+    {
+        std::shared_ptr<Font> font = CreateMainFont();
+        const std::string TEXT = "You got a Bible verse!\n\nGenesis 6:22";
+        TextLayout layout = TextLayout::WrapLines(TEXT, *font, 512.0f, 1.0f);
+
+        std::vector<std::string> EXPECTED_LINES = { "You got a Bible verse!", "Genesis 6:22" };
+        std::vector<std::string> actual_lines = GetLines(layout, TEXT);
+        REQUIRE(EXPECTED_LINES == actual_lines);
+    }
+
+    TEST_CASE("A word too wide for a line is broken up across lines.", "[TextLayout]")
+    {
+        // WRAP A WORD WIDER THAN A LINE.
+        std::shared_ptr<Font> font = CreateMainFont();
+        const std::string TEXT = "Mahalaleel begat Jared";
+        Text first_word_text = { .String = "Mahalaleel" };
+        // Slightly more than half the word is allowed per line to account for spacing between characters.
+        float line_width_in_pixels = first_word_text.Width<float>(*font) * 0.6f;
+        TextLayout layout = TextLayout::WrapLines(TEXT, *font, line_width_in_pixels, 1.0f);
+
+        // VERIFY THAT THE WORD WAS BROKEN UP WITHOUT ANY LINES BEING TOO WIDE.
+        std::vector<std::string> lines = GetLines(layout, TEXT);
+        REQUIRE(lines.size() > 3);
+        REQUIRE("Mahalaleel" == lines[0] + lines[1]);
+        for (const TextLineRange& line : layout.Lines)
+        {
+            REQUIRE(line.WidthInPixels <= line_width_in_pixels);
+        }
+    }
+
+    TEST_CASE("Text layouts are only wrapped once while cached.", "[TextLayoutCache]")
+    {
+        // GET THE SAME LAYOUT REPEATEDLY.
+        std::shared_ptr<Font> font = CreateMainFont();
+        TextLayoutCache text_layout_cache;
+        const std::string TEXT = BIBLE::BIBLE_VERSES.front().Text;
+        const TextLayout* first_layout = &text_layout_cache.Get(TEXT, RESOURCES::AssetId::FONT_TEXTURE, *font, 256.0f, 1.0f);
+        for (unsigned int frame_index = 0; frame_index <= TextLayoutCache::MAX_UNUSED_FRAME_COUNT_BEFORE_EVICTION; ++frame_index)
+        {
+            const TextLayout* current_layout = &text_layout_cache.Get(TEXT, RESOURCES::AssetId::FONT_TEXTURE, *font, 256.0f, 1.0f);
+            REQUIRE(first_layout == current_layout);
+            text_layout_cache.EndFrame();
+        }
+        REQUIRE(1 == text_layout_cache.WrapCount);
+
+        // VERIFY THAT A DIFFERENT WIDTH REQUIRES A DIFFERENT LAYOUT.
+        text_layout_cache.Get(TEXT, RESOURCES::AssetId::FONT_TEXTURE, *font, 128.0f, 1.0f);
+        REQUIRE(2 == text_layout_cache.WrapCount);
+        REQUIRE(2 == text_layout_cache.LayoutCount());
+
+        // VERIFY THAT UNUSED LAYOUTS ARE EVICTED.
+        for (unsigned int frame_index = 0; frame_index <= TextLayoutCache::MAX_UNUSED_FRAME_COUNT_BEFORE_EVICTION + 1; ++frame_index)
+        {
+            text_layout_cache.EndFrame();
+        }
+        REQUIRE(0 == text_layout_cache.LayoutCount());
+    }
+
+    TEST_CASE("Benchmark wrapping the longest Bible verses.", "[.][benchmark][TextLayout]")
+    {
+        // FIND THE LONGEST BIBLE VERSES.
+        const std::size_t LONGEST_VERSE_COUNT = 10;
+        std::vector<std::string> longest_verse_texts;
+        for (const BIBLE::BibleVerse& bible_verse : BIBLE::BIBLE_VERSES)
+        {
+            longest_verse_texts.push_back(bible_verse.Text);
+        }
+        std::sort(
+            longest_verse_texts.begin(),
+            longest_verse_texts.end(),
+            [](const std::string& left, const std::string& right) { return left.size() > right.size(); });
+        longest_verse_texts.resize(std::min(LONGEST_VERSE_COUNT, longest_verse_texts.size()));
+
+        // BENCHMARK EACH WAY OF WRAPPING THE VERSES.
+        // This mirrors rendering the verses in the inventory, which happens every frame.
+        std::shared_ptr<Font> font = CreateMainFont();
+        const float LINE_WIDTH_IN_PIXELS = 480.0f;
+        std::size_t line_count = 0;
+        BENCHMARK("Splitting into words")
+        {
+            for (const std::string& verse_text : longest_verse_texts)
+            {
+                line_count += WrapLinesBySplittingWords(verse_text, *font, LINE_WIDTH_IN_PIXELS).size();
+            }
+        }
+        BENCHMARK("Wrapping into a text layout")
+        {
+            for (const std::string& verse_text : longest_verse_texts)
+            {
+                line_count += TextLayout::WrapLines(verse_text, *font, LINE_WIDTH_IN_PIXELS, 1.0f).Lines.size();
+            }
+        }
+        TextLayoutCache text_layout_cache;
+        BENCHMARK("Getting a cached text layout")
+        {
+            for (const std::string& verse_text : longest_verse_texts)
+            {
+                line_count += text_layout_cache.Get(verse_text, RESOURCES::AssetId::FONT_TEXTURE, *font, LINE_WIDTH_IN_PIXELS, 1.0f).Lines.size();
+            }
+        }
+        REQUIRE(line_count > 0);
+    }
+}
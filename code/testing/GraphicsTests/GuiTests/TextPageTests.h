@@ -1,11 +1,12 @@
 #pragma once
 
 #include <iterator>
+#include <memory>
 #include <queue>
 #include <sstream>
 #include <string>
 #include <vector>
-#include <Windows.h>
+#include "Graphics/Gui/FontMetrics.h"
 #include "String/String.h"
 #include "Graphics/Gui/Text.h"
 #include "Graphics/Gui/TextPage.h"
@@ -20,7 +21,7 @@ namespace TEST_TEXT_PAGE
         // ADD AN EMPTY STRING TO A TEXT PAGE.
         const unsigned int WIDTH_IN_PIXELS = 512;
         const unsigned int HEIGHT_IN_PIXELS = 32;
-        std::shared_ptr<Font> font = Font::LoadSystemDefaultFont(SYSTEM_FIXED_FONT);
+        std::shared_ptr<Font> font = Font::Create(MAIN_FONT_GLYPH_METRICS, std::make_shared<GRAPHICS::Texture>());
         TextPage text_page(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, font);
 
         const std::string EMPTY_STRING = "";
@@ -44,7 +45,7 @@ namespace TEST_TEXT_PAGE
         // ADD A SINGLE CHARACTER TO A TEXT PAGE.
         const unsigned int WIDTH_IN_PIXELS = 512;
         const unsigned int HEIGHT_IN_PIXELS = 32;
-        std::shared_ptr<Font> font = Font::LoadSystemDefaultFont(SYSTEM_FIXED_FONT);
+        std::shared_ptr<Font> font = Font::Create(MAIN_FONT_GLYPH_METRICS, std::make_shared<GRAPHICS::Texture>());
         TextPage text_page(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, font);
 
         const std::string SINGLE_CHARACTER = "a";
@@ -66,7 +67,7 @@ namespace TEST_TEXT_PAGE
         // ADD A SINGLE CHARACTER TO A TEXT PAGE.
         const unsigned int WIDTH_IN_PIXELS = 512;
         const unsigned int HEIGHT_IN_PIXELS = 32;
-        std::shared_ptr<Font> font = Font::LoadSystemDefaultFont(SYSTEM_FIXED_FONT);
+        std::shared_ptr<Font> font = Font::Create(MAIN_FONT_GLYPH_METRICS, std::make_shared<GRAPHICS::Texture>());
         TextPage text_page(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, font);
 
         const std::string SINGLE_CHARACTER = "a";
@@ -92,7 +93,7 @@ namespace TEST_TEXT_PAGE
         // ADD A SINGLE WORD TO A TEXT PAGE.
         const unsigned int WIDTH_IN_PIXELS = 512;
         const unsigned int HEIGHT_IN_PIXELS = 32;
-        std::shared_ptr<Font> font = Font::LoadSystemDefaultFont(SYSTEM_FIXED_FONT);
+        std::shared_ptr<Font> font = Font::Create(MAIN_FONT_GLYPH_METRICS, std::make_shared<GRAPHICS::Texture>());
         TextPage text_page(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, font);
 
         const std::string SINGLE_WORD = "word";
@@ -124,7 +125,7 @@ namespace TEST_TEXT_PAGE
         // ADD MULTIPLE WORDS TO A TEXT PAGE.
         const unsigned int WIDTH_IN_PIXELS = 512;
         const unsigned int HEIGHT_IN_PIXELS = 32;
-        std::shared_ptr<Font> font = Font::LoadSystemDefaultFont(SYSTEM_FIXED_FONT);
+        std::shared_ptr<Font> font = Font::Create(MAIN_FONT_GLYPH_METRICS, std::make_shared<GRAPHICS::Texture>());
         TextPage text_page(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, font);
 
         const std::vector<std::string> WORDS =
@@ -196,7 +197,7 @@ namespace TEST_TEXT_PAGE
         // ADD A FULL LINE OF TEXT TO A TEXT PAGE.
         const unsigned int WIDTH_IN_PIXELS = 512;
         const unsigned int HEIGHT_IN_PIXELS = 32;
-        std::shared_ptr<Font> font = Font::LoadSystemDefaultFont(SYSTEM_FIXED_FONT);
+        std::shared_ptr<Font> font = Font::Create(MAIN_FONT_GLYPH_METRICS, std::make_shared<GRAPHICS::Texture>());
         TextPage text_page(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, font);
 
         unsigned int max_character_count_per_line = static_cast<unsigned int>(
@@ -236,7 +237,7 @@ namespace TEST_TEXT_PAGE
         // ADD 2 FULL LINES OF TEXT TO A TEXT PAGE.
         const unsigned int WIDTH_IN_PIXELS = 512;
         const unsigned int HEIGHT_IN_PIXELS = 32;
-        std::shared_ptr<Font> font = Font::LoadSystemDefaultFont(SYSTEM_FIXED_FONT);
+        std::shared_ptr<Font> font = Font::Create(MAIN_FONT_GLYPH_METRICS, std::make_shared<GRAPHICS::Texture>());
         TextPage text_page(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, font);
 
         unsigned int max_character_count_per_line = static_cast<unsigned int>(
@@ -301,7 +302,7 @@ namespace TEST_TEXT_PAGE
         // ADD WORDS FROM A BIBLE VERSE TO A TEXT PAGE.
         const unsigned int WIDTH_IN_PIXELS = 512;
         const unsigned int HEIGHT_IN_PIXELS = 32;
-        std::shared_ptr<Font> font = Font::LoadSystemDefaultFont(SYSTEM_FIXED_FONT);
+        std::shared_ptr<Font> font = Font::Create(MAIN_FONT_GLYPH_METRICS, std::make_shared<GRAPHICS::Texture>());
         TextPage text_page(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, font);
 
         // The Bible verse was chosen to fit within a single text page.
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include "Graphics/Gui/Font.h"
+#include "Graphics/Gui/FontMetrics.h"
+#include "Graphics/Gui/Text.h"
+
+/// A namespace for testing the Text class.
+namespace TEST_TEXT
+{
+    using namespace GRAPHICS::GUI;
+
+    // Text widths for literals can be calculated at compile time.
+    static_assert(0 == Text::Width<unsigned int>("", MAIN_FONT_GLYPH_METRICS));
+    static_assert(Text::Width<unsigned int>("Noah", MAIN_FONT_GLYPH_METRICS) < Text::Width<unsigned int>("Noah's ark", MAIN_FONT_GLYPH_METRICS));
+    static_assert(Text::Width<unsigned int>("Noah", SERIF_FONT_GLYPH_METRICS) < Text::Width<unsigned int>("Noah", SERIF_FONT_GLYPH_METRICS, 2.0f));
+
+    TEST_CASE("Text width at compile time matches a font created from the same metrics.", "[Text]")
+    {
+        // CREATE FONTS FROM THE GENERATED METRICS.
+        // Textures aren't needed for measuring text.
+        std::shared_ptr<GRAPHICS::Texture> texture = std::make_shared<GRAPHICS::Texture>();
+        std::shared_ptr<Font> main_font = Font::Create(MAIN_FONT_GLYPH_METRICS, texture);
+        std::shared_ptr<Font> serif_font = Font::Create(SERIF_FONT_GLYPH_METRICS, texture);
+
+        // VERIFY THE WIDTHS OF SOME TEXT MATCH.
+        constexpr float MAIN_FONT_TEXT_WIDTH_IN_PIXELS = Text::Width<float>("Press ENTER to continue.", MAIN_FONT_GLYPH_METRICS);
+        Text main_font_text = { .String = "Press ENTER to continue." };
+        REQUIRE(MAIN_FONT_TEXT_WIDTH_IN_PIXELS == main_font_text.Width<float>(*main_font));
+
+        constexpr float SERIF_FONT_TEXT_WIDTH_IN_PIXELS = Text::Width<float>("Bible Games - Noah's Ark", SERIF_FONT_GLYPH_METRICS, 2.0f);
+        Text serif_font_text = { .String = "Bible Games - Noah's Ark", .FontId = RESOURCES::AssetId::SERIF_FONT_TEXTURE, .ScaleFactor = 2.0f };
+        REQUIRE(SERIF_FONT_TEXT_WIDTH_IN_PIXELS == serif_font_text.Width<float>(*serif_font));
+    }
+
+    TEST_CASE("Spaces are half the width of their glyph.", "[Text]")
+    {
+        constexpr float SPACE_WIDTH_IN_PIXELS = Text::Width<float>(" ", MAIN_FONT_GLYPH_METRICS);
+        float expected_space_width_in_pixels =
+            static_cast<float>(MAIN_FONT_GLYPH_METRICS[' '].WidthInPixels) / 2.0f +
+            Text::HORIZONTAL_SPACING_IN_PIXELS_BETWEEN_EACH_CHARACTER;
+        REQUIRE(expected_space_width_in_pixels == SPACE_WIDTH_IN_PIXELS);
+    }
+
+    TEST_CASE("Fonts created from metrics share a single texture.", "[Font]")
+    {
+        std::shared_ptr<GRAPHICS::Texture> texture = std::make_shared<GRAPHICS::Texture>();
+        std::shared_ptr<Font> font = Font::Create(SERIF_FONT_GLYPH_METRICS, texture);
+
+        REQUIRE(texture == font->Texture);
+        for (unsigned int character_value = 0; character_value < Font::CHARACTER_COUNT; ++character_value)
+        {
+            const Glyph& glyph = font->GlyphsByCharacter[character_value];
+            const GlyphMetrics& glyph_metrics = SERIF_FONT_GLYPH_METRICS[character_value];
+            REQUIRE(static_cast<char>(character_value) == glyph.Character);
+            REQUIRE(texture == glyph.Texture);
+            REQUIRE(static_cast<float>(glyph_metrics.LeftInPixels) == glyph.TextureSubRectangle.LeftTop.X);
+            REQUIRE(static_cast<float>(glyph_metrics.TopInPixels) == glyph.TextureSubRectangle.LeftTop.Y);
+            REQUIRE(static_cast<float>(glyph_metrics.WidthInPixels) == glyph.TextureSubRectangle.Width());
+        }
+    }
+}
@@ -0,0 +1,559 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "Maps/MultiTileMapGrid.h"
+#include "Maps/Overworld.h"
+#include "Maps/TileMapStreaming.h"
+#include "Maps/Tileset.h"
+#include "Maps/World.h"
+#include "Math/RandomNumberGenerator.h"
+#include "Math/Vector2.h"
+#include "Memory/AllocationTracker.h"
+#include "Memory/Pointers.h"
+#include "TestWorldMapData.h"
+
+/// A namespace for testing the MultiTileMapGrid class.
+namespace TEST_MULTI_TILE_MAP_GRID
+{
+    using namespace MAPS;
+
+    /// Gets the center world position of a tile map in a map grid.
+    /// @param[in]  row - The row of the tile map.
+    /// @param[in]  column - The column of the tile map.
+    /// @return The center world position of the tile map.
+    MATH::Vector2f GetTileMapCenterWorldPosition(const unsigned int row, const unsigned int column)
+    {
+        constexpr float TILE_MAP_WIDTH_IN_PIXELS = static_cast<float>(TileMap::WIDTH_IN_TILES * Tile::DIMENSION_IN_PIXELS<unsigned int>);
+        constexpr float TILE_MAP_HEIGHT_IN_PIXELS = static_cast<float>(TileMap::HEIGHT_IN_TILES * Tile::DIMENSION_IN_PIXELS<unsigned int>);
+        MATH::Vector2f center_world_position(
+            (static_cast<float>(column) + 0.5f) * TILE_MAP_WIDTH_IN_PIXELS,
+            (static_cast<float>(row) + 0.5f) * TILE_MAP_HEIGHT_IN_PIXELS);
+        return center_world_position;
+    }
+
+    /// Gets the distance (in tile maps) between two tile maps, counting diagonal steps as a single tile map.
+    /// @param[in]  first_row - The row of the first tile map.
+    /// @param[in]  first_column - The column of the first tile map.
+    /// @param[in]  second_row - The row of the second tile map.
+    /// @param[in]  second_column - The column of the second tile map.
+    /// @return The distance between the tile maps.
+    unsigned int GetTileMapDistance(
+        const unsigned int first_row,
+        const unsigned int first_column,
+        const unsigned int second_row,
+        const unsigned int second_column)
+    {
+        unsigned int row_distance = std::max(first_row, second_row) - std::min(first_row, second_row);
+        unsigned int column_distance = std::max(first_column, second_column) - std::min(first_column, second_column);
+        return std::max(row_distance, column_distance);
+    }
+
+    /// Updates residency of a map grid until all tile maps near the focus have been loaded in the background.
+    /// @param[in]  focus_row - The row of the tile map being focused on.
+    /// @param[in]  focus_column - The column of the tile map being focused on.
+    /// @param[in]  resident_radius_in_tile_maps - How far from the focus tile maps should be resident.
+    /// @param[in,out]  map_grid - The map grid to update.
+    void UpdateResidencyUntilLoaded(
+        const unsigned int focus_row,
+        const unsigned int focus_column,
+        const unsigned int resident_radius_in_tile_maps,
+        MultiTileMapGrid& map_grid)
+    {
+        constexpr unsigned int MAX_UPDATE_COUNT = 1000;
+        for (unsigned int update_count = 0; update_count < MAX_UPDATE_COUNT; ++update_count)
+        {
+            // UPDATE WHICH TILE MAPS ARE RESIDENT.
+            map_grid.UpdateResidency(GetTileMapCenterWorldPosition(focus_row, focus_column));
+
+            // CHECK IF ALL TILE MAPS NEAR THE FOCUS ARE RESIDENT.
+            bool all_tile_maps_near_focus_resident = true;
+            for (unsigned int row = 0; row < map_grid.TileMaps.GetHeight(); ++row)
+            {
+                for (unsigned int column = 0; column < map_grid.TileMaps.GetWidth(); ++column)
+                {
+                    bool near_focus = (GetTileMapDistance(row, column, focus_row, focus_column) <= resident_radius_in_tile_maps);
+                    bool resident = (nullptr != std::as_const(map_grid).GetTileMap(row, column));
+                    all_tile_maps_near_focus_resident = all_tile_maps_near_focus_resident && (resident || !near_focus);
+                }
+            }
+            if (all_tile_maps_near_focus_resident)
+            {
+                return;
+            }
+
+            // GIVE BACKGROUND LOADS TIME TO FINISH.
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    /// Verifies that only tile maps near the focus or with exit points are resident in a map grid.
+    /// @param[in]  focus_row - The row of the tile map being focused on.
+    /// @param[in]  focus_column - The column of the tile map being focused on.
+    /// @param[in]  resident_radius_in_tile_maps - How far from the focus tile maps should be resident.
+    /// @param[in]  map_grid - The map grid to verify.
+    void VerifyOnlyTileMapsNearFocusResident(
+        const unsigned int focus_row,
+        const unsigned int focus_column,
+        const unsigned int resident_radius_in_tile_maps,
+        const MultiTileMapGrid& map_grid)
+    {
+        unsigned int resident_tile_map_count = 0;
+        for (unsigned int row = 0; row < map_grid.TileMaps.GetHeight(); ++row)
+        {
+            for (unsigned int column = 0; column < map_grid.TileMaps.GetWidth(); ++column)
+            {
+                const TileMap* tile_map = map_grid.GetTileMap(row, column);
+                bool near_focus = (GetTileMapDistance(row, column, focus_row, focus_column) <= resident_radius_in_tile_maps);
+                bool has_exit_points = (tile_map && !tile_map->ExitPoints.empty());
+                REQUIRE(static_cast<bool>(tile_map) == (near_focus || has_exit_points));
+                resident_tile_map_count += static_cast<bool>(tile_map);
+            }
+        }
+        REQUIRE(resident_tile_map_count == map_grid.GetResidentTileMapCount());
+    }
+
+    /// Gets world positions spread across (and slightly beyond) a map grid, including positions on tile boundaries.
+    /// @param[in]  map_grid - The map grid to get world positions for.
+    /// @return The world positions.
+    std::vector<MATH::Vector2f> GetWorldPositionsAcrossGrid(const MultiTileMapGrid& map_grid)
+    {
+        constexpr float POSITION_STEP_IN_PIXELS = Tile::DIMENSION_IN_PIXELS<float> / 2.0f;
+        constexpr float BEYOND_GRID_DISTANCE_IN_PIXELS = 2.0f * Tile::DIMENSION_IN_PIXELS<float>;
+        float grid_width_in_pixels = static_cast<float>(map_grid.TileMaps.GetWidth() * TileMap::WIDTH_IN_TILES) * Tile::DIMENSION_IN_PIXELS<float>;
+        float grid_height_in_pixels = static_cast<float>(map_grid.TileMaps.GetHeight() * TileMap::HEIGHT_IN_TILES) * Tile::DIMENSION_IN_PIXELS<float>;
+
+        std::vector<MATH::Vector2f> world_positions;
+        for (float y = -BEYOND_GRID_DISTANCE_IN_PIXELS; y <= grid_height_in_pixels + BEYOND_GRID_DISTANCE_IN_PIXELS; y += POSITION_STEP_IN_PIXELS)
+        {
+            for (float x = -BEYOND_GRID_DISTANCE_IN_PIXELS; x <= grid_width_in_pixels + BEYOND_GRID_DISTANCE_IN_PIXELS; x += POSITION_STEP_IN_PIXELS)
+            {
+                world_positions.emplace_back(x, y);
+            }
+        }
+        return world_positions;
+    }
+
+    /// Gets the tile at a world position in a map grid by searching every tile map for one whose ground contains it.
+    /// This is much slower than looking up tiles directly but doesn't make any assumptions about layout of tile maps.
+    /// @param[in]  world_position - The world position of the tile to find.
+    /// @param[in]  map_grid - The map grid to search.
+    /// @return The tile at the world position, if one exists; null otherwise.
+    const Tile* FindTileAtWorldPosition(const MATH::Vector2f& world_position, const MultiTileMapGrid& map_grid)
+    {
+        for (unsigned int row = 0; row < map_grid.TileMaps.GetHeight(); ++row)
+        {
+            for (unsigned int column = 0; column < map_grid.TileMaps.GetWidth(); ++column)
+            {
+                const TileMap* tile_map = map_grid.GetTileMap(row, column);
+                bool tile_map_contains_position = tile_map && tile_map->GetWorldBoundingBox().Contains(world_position.X, world_position.Y);
+                if (!tile_map_contains_position)
+                {
+                    continue;
+                }
+
+                std::shared_ptr<Tile> tile = tile_map->GetTileAtWorldPosition(world_position.X, world_position.Y);
+                if (tile)
+                {
+                    return tile.get();
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    TEST_CASE("Tiles are found at world positions across the entire grid.", "[MultiTileMapGrid]")
+    {
+        MEMORY::NonNullSharedPointer<World> world = World::CreateInitial(TEST_WORLD_MAP_DATA::GetWorldMapData());
+        const MultiTileMapGrid& map_grid = world->Overworld.MapGrid;
+        std::vector<MATH::Vector2f> world_positions = GetWorldPositionsAcrossGrid(map_grid);
+
+        // VERIFY THAT EACH TILE IS THE TILE CONTAINING ITS WORLD POSITION.
+        std::vector<const Tile*> tiles(world_positions.size());
+        map_grid.GetTilesAtWorldPositions(world_positions, tiles);
+        std::size_t found_tile_count = 0;
+        for (std::size_t position_index = 0; position_index < world_positions.size(); ++position_index)
+        {
+            const MATH::Vector2f& world_position = world_positions[position_index];
+            const Tile* expected_tile = FindTileAtWorldPosition(world_position, map_grid);
+            const Tile* tile = map_grid.GetTileAtWorldPosition(world_position.X, world_position.Y);
+            REQUIRE(expected_tile == tile);
+            REQUIRE(expected_tile == tiles[position_index]);
+
+            // VERIFY THAT THE TILE MAP CONTAINING THE WORLD POSITION IS CONSISTENT.
+            const TileMap* tile_map = map_grid.GetTileMap(world_position.X, world_position.Y);
+            REQUIRE(static_cast<bool>(tile) == static_cast<bool>(tile_map));
+            found_tile_count += static_cast<bool>(tile);
+        }
+        REQUIRE(found_tile_count > 0);
+        REQUIRE(found_tile_count < world_positions.size());
+
+        // VERIFY THAT POSITIONS JUST BEFORE THE GRID DON'T HAVE TILES.
+        REQUIRE_FALSE(map_grid.GetTileAtWorldPosition(-0.5f, 0.0f));
+        REQUIRE_FALSE(map_grid.GetTileAtWorldPosition(0.0f, -0.5f));
+        REQUIRE_FALSE(map_grid.GetTileMap(-0.5f, 0.0f));
+        REQUIRE(map_grid.GetTileAtWorldPosition(0.0f, 0.0f));
+    }
+
+    TEST_CASE("Streaming keeps only tile maps near the focus resident.", "[MultiTileMapGrid]")
+    {
+        // START STREAMING THE OVERWORLD.
+        // The budget is smaller than the number of tile maps around the focus, so only tile maps
+        // that can't be evicted should remain resident.
+        MEMORY::NonNullSharedPointer<World> world = World::CreateInitial(TEST_WORLD_MAP_DATA::GetWorldMapData());
+        MultiTileMapGrid& map_grid = world->Overworld.MapGrid;
+        TileMapStreamingSettings settings;
+        settings.ResidentRadiusInTileMaps = 1;
+        settings.MaxResidentTileMapCount = 1;
+        world->Overworld.EnableStreaming(world->MapData.Overworld, settings);
+        REQUIRE(map_grid.IsStreaming());
+        REQUIRE(Overworld::WIDTH_IN_TILE_MAPS * Overworld::HEIGHT_IN_TILE_MAPS == map_grid.GetResidentTileMapCount());
+
+        // FOCUS ON THE BOTTOM-RIGHT TILE MAP.
+        constexpr unsigned int BOTTOM_ROW = Overworld::HEIGHT_IN_TILE_MAPS - 1;
+        constexpr unsigned int RIGHT_COLUMN = Overworld::WIDTH_IN_TILE_MAPS - 1;
+        map_grid.UpdateResidency(GetTileMapCenterWorldPosition(BOTTOM_ROW, RIGHT_COLUMN));
+
+        // VERIFY THAT FAR TILE MAPS WERE EVICTED.
+        VerifyOnlyTileMapsNearFocusResident(BOTTOM_ROW, RIGHT_COLUMN, settings.ResidentRadiusInTileMaps, map_grid);
+        REQUIRE(map_grid.StreamingMetrics.EvictionCount == Overworld::WIDTH_IN_TILE_MAPS * Overworld::HEIGHT_IN_TILE_MAPS - map_grid.GetResidentTileMapCount());
+        REQUIRE(0 == map_grid.StreamingMetrics.BackgroundLoadCount);
+
+        // FOCUS ON THE TOP-LEFT TILE MAP.
+        std::size_t evicted_tile_map_count = map_grid.StreamingMetrics.EvictionCount;
+        UpdateResidencyUntilLoaded(0, 0, settings.ResidentRadiusInTileMaps, map_grid);
+
+        // VERIFY THAT TILE MAPS AROUND THE NEW FOCUS WERE LOADED IN THE BACKGROUND.
+        VerifyOnlyTileMapsNearFocusResident(0, 0, settings.ResidentRadiusInTileMaps, map_grid);
+        REQUIRE(map_grid.StreamingMetrics.BackgroundLoadCount > 0);
+        REQUIRE(map_grid.StreamingMetrics.EvictionCount > evicted_tile_map_count);
+        REQUIRE(0 == map_grid.StreamingMetrics.LoadStallCount);
+    }
+
+    TEST_CASE("Evicted tile maps keep any changes.", "[MultiTileMapGrid]")
+    {
+        // START STREAMING THE OVERWORLD.
+        MEMORY::NonNullSharedPointer<World> world = World::CreateInitial(TEST_WORLD_MAP_DATA::GetWorldMapData());
+        MultiTileMapGrid& map_grid = world->Overworld.MapGrid;
+        TileMapStreamingSettings settings;
+        settings.ResidentRadiusInTileMaps = 1;
+        settings.MaxResidentTileMapCount = 1;
+        world->Overworld.EnableStreaming(world->MapData.Overworld, settings);
+
+        std::size_t load_stall_callback_count = 0;
+        map_grid.OnLoadStall = [&load_stall_callback_count](const unsigned int, const unsigned int, const std::chrono::microseconds)
+        {
+            ++load_stall_callback_count;
+        };
+
+        // CHANGE A TILE MAP WITH TREES FAR FROM THE BOTTOM-RIGHT TILE MAP.
+        constexpr unsigned int FOCUS_ROW = Overworld::HEIGHT_IN_TILE_MAPS - 1;
+        constexpr unsigned int FOCUS_COLUMN = Overworld::WIDTH_IN_TILE_MAPS - 1;
+        TileMap* changed_tile_map = nullptr;
+        for (unsigned int row = 0; row < Overworld::HEIGHT_IN_TILE_MAPS && !changed_tile_map; ++row)
+        {
+            for (unsigned int column = 0; column < Overworld::WIDTH_IN_TILE_MAPS && !changed_tile_map; ++column)
+            {
+                const TileMap* tile_map = std::as_const(map_grid).GetTileMap(row, column);
+                bool tile_map_can_be_evicted = (
+                    tile_map->ExitPoints.empty() &&
+                    !tile_map->Trees.empty() &&
+                    GetTileMapDistance(row, column, FOCUS_ROW, FOCUS_COLUMN) > settings.ResidentRadiusInTileMaps);
+                if (tile_map_can_be_evicted)
+                {
+                    changed_tile_map = map_grid.GetTileMapForChanging(row, column);
+                }
+            }
+        }
+        REQUIRE(changed_tile_map);
+        unsigned int changed_row = changed_tile_map->GridRowIndex;
+        unsigned int changed_column = changed_tile_map->GridColumnIndex;
+        std::size_t original_tree_count = changed_tile_map->Trees.size();
+        changed_tile_map->Trees.pop_back();
+
+        // EVICT THE CHANGED TILE MAP.
+        map_grid.UpdateResidency(GetTileMapCenterWorldPosition(FOCUS_ROW, FOCUS_COLUMN));
+        REQUIRE_FALSE(std::as_const(map_grid).GetTileMap(changed_row, changed_column));
+        REQUIRE(map_grid.StreamingMetrics.ChangedEvictionCount > 0);
+
+        // VERIFY THAT THE CHANGED TILE MAP IS RELOADED WITH ITS CHANGES WHEN NEEDED.
+        TileMap* reloaded_tile_map = map_grid.GetTileMapForChanging(changed_row, changed_column);
+        REQUIRE(changed_tile_map == reloaded_tile_map);
+        REQUIRE(original_tree_count - 1 == reloaded_tile_map->Trees.size());
+        bool ground_restored = (
+            TileMap::WIDTH_IN_TILES == reloaded_tile_map->Ground.Tiles.GetWidth() &&
+            TileMap::HEIGHT_IN_TILES == reloaded_tile_map->Ground.Tiles.GetHeight());
+        REQUIRE(ground_restored);
+        REQUIRE(1 == map_grid.StreamingMetrics.LoadStallCount);
+        REQUIRE(1 == load_stall_callback_count);
+
+        // VERIFY THAT RESETTING THE WORLD UNDOES THE CHANGES.
+        world->ResetToInitialState();
+        UpdateResidencyUntilLoaded(changed_row, changed_column, settings.ResidentRadiusInTileMaps, map_grid);
+        const TileMap* reset_tile_map = map_grid.GetTileMap(changed_row, changed_column);
+        REQUIRE(reset_tile_map);
+        REQUIRE(original_tree_count == reset_tile_map->Trees.size());
+    }
+
+    TEST_CASE("Evicted tile maps are reloaded with the same trees and food.", "[MultiTileMapGrid]")
+    {
+        // START STREAMING THE OVERWORLD.
+        MEMORY::NonNullSharedPointer<World> world = World::CreateInitial(TEST_WORLD_MAP_DATA::GetWorldMapData());
+        MultiTileMapGrid& map_grid = world->Overworld.MapGrid;
+        TileMapStreamingSettings settings;
+        settings.ResidentRadiusInTileMaps = 1;
+        settings.MaxResidentTileMapCount = 1;
+        world->Overworld.EnableStreaming(world->MapData.Overworld, settings);
+
+        // FIND A TILE MAP WITH FOOD ON TREES THAT WILL BE EVICTED FAR FROM THE BOTTOM-RIGHT TILE MAP.
+        constexpr unsigned int FOCUS_ROW = Overworld::HEIGHT_IN_TILE_MAPS - 1;
+        constexpr unsigned int FOCUS_COLUMN = Overworld::WIDTH_IN_TILE_MAPS - 1;
+        const TileMap* original_tile_map = nullptr;
+        for (unsigned int row = 0; row < Overworld::HEIGHT_IN_TILE_MAPS && !original_tile_map; ++row)
+        {
+            for (unsigned int column = 0; column < Overworld::WIDTH_IN_TILE_MAPS && !original_tile_map; ++column)
+            {
+                const TileMap* tile_map = std::as_const(map_grid).GetTileMap(row, column);
+                bool tree_has_food = std::any_of(
+                    tile_map->Trees.cbegin(),
+                    tile_map->Trees.cend(),
+                    [](const OBJECTS::Tree& tree) { return tree.Food.has_value(); });
+                bool tile_map_can_be_evicted = (
+                    tile_map->ExitPoints.empty() &&
+                    tree_has_food &&
+                    GetTileMapDistance(row, column, FOCUS_ROW, FOCUS_COLUMN) > settings.ResidentRadiusInTileMaps);
+                if (tile_map_can_be_evicted)
+                {
+                    original_tile_map = tile_map;
+                }
+            }
+        }
+        REQUIRE(original_tile_map);
+        unsigned int row = original_tile_map->GridRowIndex;
+        unsigned int column = original_tile_map->GridColumnIndex;
+        std::vector<OBJECTS::Tree> original_trees = original_tile_map->Trees;
+
+        // EVICT THE TILE MAP.
+        map_grid.UpdateResidency(GetTileMapCenterWorldPosition(FOCUS_ROW, FOCUS_COLUMN));
+        REQUIRE_FALSE(std::as_const(map_grid).GetTileMap(row, column));
+
+        // RELOAD THE TILE MAP.
+        UpdateResidencyUntilLoaded(row, column, settings.ResidentRadiusInTileMaps, map_grid);
+        const TileMap* reloaded_tile_map = std::as_const(map_grid).GetTileMap(row, column);
+        REQUIRE(reloaded_tile_map);
+
+        // VERIFY THAT THE TREES AND THEIR FOOD ARE THE SAME.
+        REQUIRE(original_trees.size() == reloaded_tile_map->Trees.size());
+        for (std::size_t tree_index = 0; tree_index < original_trees.size(); ++tree_index)
+        {
+            const OBJECTS::Tree& original_tree = original_trees[tree_index];
+            const OBJECTS::Tree& reloaded_tree = reloaded_tile_map->Trees[tree_index];
+            REQUIRE(original_tree.Sprite.GetWorldPosition() == reloaded_tree.Sprite.GetWorldPosition());
+            REQUIRE(original_tree.Food.has_value() == reloaded_tree.Food.has_value());
+            if (original_tree.Food)
+            {
+                REQUIRE(original_tree.Food->Type == reloaded_tree.Food->Type);
+                REQUIRE(original_tree.Food->Count == reloaded_tree.Food->Count);
+            }
+        }
+    }
+
+    TEST_CASE("Ark pieces built while tile maps aren't resident are built once the tile maps are streamed in.", "[MultiTileMapGrid]")
+    {
+        // START STREAMING THE OVERWORLD.
+        MEMORY::NonNullSharedPointer<World> world = World::CreateInitial(TEST_WORLD_MAP_DATA::GetWorldMapData());
+        MultiTileMapGrid& map_grid = world->Overworld.MapGrid;
+        TileMapStreamingSettings settings;
+        settings.ResidentRadiusInTileMaps = 1;
+        settings.MaxResidentTileMapCount = 1;
+        world->Overworld.EnableStreaming(world->MapData.Overworld, settings);
+
+        // FIND A TILE MAP WITH ARK PIECES THAT WILL BE EVICTED FAR FROM THE BOTTOM-RIGHT TILE MAP.
+        constexpr unsigned int FOCUS_ROW = Overworld::HEIGHT_IN_TILE_MAPS - 1;
+        constexpr unsigned int FOCUS_COLUMN = Overworld::WIDTH_IN_TILE_MAPS - 1;
+        const TileMap* ark_tile_map = nullptr;
+        for (unsigned int row = 0; row < Overworld::HEIGHT_IN_TILE_MAPS && !ark_tile_map; ++row)
+        {
+            for (unsigned int column = 0; column < Overworld::WIDTH_IN_TILE_MAPS && !ark_tile_map; ++column)
+            {
+                const TileMap* tile_map = std::as_const(map_grid).GetTileMap(row, column);
+                bool tile_map_can_be_evicted = (
+                    tile_map->ExitPoints.empty() &&
+                    !tile_map->ArkPieces.empty() &&
+                    GetTileMapDistance(row, column, FOCUS_ROW, FOCUS_COLUMN) > settings.ResidentRadiusInTileMaps);
+                if (tile_map_can_be_evicted)
+                {
+                    ark_tile_map = tile_map;
+                }
+            }
+        }
+        REQUIRE(ark_tile_map);
+        unsigned int ark_row = ark_tile_map->GridRowIndex;
+        unsigned int ark_column = ark_tile_map->GridColumnIndex;
+
+        // EVICT THE TILE MAP.
+        map_grid.UpdateResidency(GetTileMapCenterWorldPosition(FOCUS_ROW, FOCUS_COLUMN));
+        REQUIRE_FALSE(std::as_const(map_grid).GetTileMap(ark_row, ark_column));
+
+        // VERIFY THAT RETRIEVING TILE MAPS ONLY FOR READING DOESN'T LOAD OR CHANGE THEM.
+        REQUIRE_FALSE(map_grid.GetTileMap(ark_row, ark_column));
+        TileMap* focus_tile_map = map_grid.GetTileMap(FOCUS_ROW, FOCUS_COLUMN);
+        REQUIRE(focus_tile_map);
+        REQUIRE_FALSE(focus_tile_map->HasChangedFromInitialState());
+
+        // BUILD ALL ARK PIECES.
+        constexpr bool BUILT = true;
+        world->Overworld.SetArkPiecesBuiltStatus(BUILT);
+        REQUIRE_FALSE(std::as_const(map_grid).GetTileMap(ark_row, ark_column));
+        REQUIRE(0 == map_grid.StreamingMetrics.LoadStallCount);
+
+        // VERIFY THAT THE ARK PIECES ARE BUILT ONCE THE TILE MAP IS STREAMED IN.
+        UpdateResidencyUntilLoaded(ark_row, ark_column, settings.ResidentRadiusInTileMaps, map_grid);
+        const TileMap* streamed_ark_tile_map = std::as_const(map_grid).GetTileMap(ark_row, ark_column);
+        REQUIRE(streamed_ark_tile_map);
+        REQUIRE_FALSE(streamed_ark_tile_map->ArkPieces.empty());
+        bool all_ark_pieces_built = std::all_of(
+            streamed_ark_tile_map->ArkPieces.cbegin(),
+            streamed_ark_tile_map->ArkPieces.cend(),
+            [](const OBJECTS::ArkPiece& ark_piece) { return ark_piece.Built; });
+        REQUIRE(all_ark_pieces_built);
+        REQUIRE(0 == map_grid.StreamingMetrics.LoadStallCount);
+    }
+
+    TEST_CASE("Benchmark loading a streamed tile map.", "[.][benchmark][MultiTileMapGrid]")
+    {
+        // FIND THE OVERWORLD TILE MAP WITH THE MOST TREES.
+        const DATA::WorldMapData& map_data = TEST_WORLD_MAP_DATA::GetWorldMapData();
+        MEMORY::NonNullSharedPointer<World> world = World::CreateInitial(map_data);
+        unsigned int most_trees_row = 0;
+        unsigned int most_trees_column = 0;
+        for (unsigned int row = 0; row < Overworld::HEIGHT_IN_TILE_MAPS; ++row)
+        {
+            for (unsigned int column = 0; column < Overworld::WIDTH_IN_TILE_MAPS; ++column)
+            {
+                std::size_t tree_count = std::as_const(world->Overworld.MapGrid).GetTileMap(row, column)->Trees.size();
+                std::size_t most_tree_count = std::as_const(world->Overworld.MapGrid).GetTileMap(most_trees_row, most_trees_column)->Trees.size();
+                if (tree_count > most_tree_count)
+                {
+                    most_trees_row = row;
+                    most_trees_column = column;
+                }
+            }
+        }
+
+        // MEASURE A SINGLE LOAD OF THE TILE MAP.
+        // This is how long gameplay would stall if the tile map weren't loaded in the background.
+        const DATA::TileMapData& tile_map_data = map_data.Overworld(most_trees_column, most_trees_row);
+        Tileset tileset;
+        MATH::RandomNumberGenerator random_number_generator;
+        std::size_t allocation_count_before_loading = MEMORY::AllocationTracker::GetTotalAllocationCount();
+        auto start_time = std::chrono::steady_clock::now();
+        std::shared_ptr<TileMap> tile_map = Overworld::CreateTileMap(
+            world->Overworld.MapGrid,
+            most_trees_row,
+            most_trees_column,
+            tile_map_data,
+            nullptr,
+            tileset,
+            random_number_generator);
+        auto end_time = std::chrono::steady_clock::now();
+        std::size_t allocation_count = MEMORY::AllocationTracker::GetTotalAllocationCount() - allocation_count_before_loading;
+        auto load_time_in_microseconds = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time).count();
+        WARN("Loading a tile map with " << tile_map->Trees.size() << " trees took " << load_time_in_microseconds << " microseconds and " << allocation_count << " allocations.");
+
+        // BENCHMARK LOADING THE TILE MAP REPEATEDLY.
+        std::size_t loaded_tile_map_count = 0;
+        BENCHMARK("Loading a streamed tile map")
+        {
+            std::shared_ptr<TileMap> benchmarked_tile_map = Overworld::CreateTileMap(
+                world->Overworld.MapGrid,
+                most_trees_row,
+                most_trees_column,
+                tile_map_data,
+                nullptr,
+                tileset,
+                random_number_generator);
+            loaded_tile_map_count += static_cast<bool>(benchmarked_tile_map);
+        }
+        REQUIRE(loaded_tile_map_count > 0);
+    }
+
+    TEST_CASE("Benchmark looking up tiles at world positions.", "[.][benchmark][MultiTileMapGrid]")
+    {
+        MEMORY::NonNullSharedPointer<World> world = World::CreateInitial(TEST_WORLD_MAP_DATA::GetWorldMapData());
+        const MultiTileMapGrid& map_grid = world->Overworld.MapGrid;
+        std::vector<MATH::Vector2f> world_positions = GetWorldPositionsAcrossGrid(map_grid);
+        std::vector<const Tile*> tiles(world_positions.size());
+
+        // MEASURE LOOKUPS PER SECOND FOR EACH WAY OF LOOKING UP TILES.
+        // Looking up the tile map and then the tile through the tile map's ground is how tiles were previously looked up.
+        auto tile_map_ground_lookup = [&]()
+        {
+            std::size_t found_tile_count = 0;
+            for (const MATH::Vector2f& world_position : world_positions)
+            {
+                const TileMap* tile_map = map_grid.GetTileMap(world_position.X, world_position.Y);
+                std::shared_ptr<Tile> tile = tile_map ? tile_map->GetTileAtWorldPosition(world_position.X, world_position.Y) : nullptr;
+                found_tile_count += static_cast<bool>(tile);
+            }
+            return found_tile_count;
+        };
+        auto single_lookup = [&]()
+        {
+            std::size_t found_tile_count = 0;
+            for (const MATH::Vector2f& world_position : world_positions)
+            {
+                found_tile_count += (nullptr != map_grid.GetTileAtWorldPosition(world_position.X, world_position.Y));
+            }
+            return found_tile_count;
+        };
+        auto batch_lookup = [&]()
+        {
+            map_grid.GetTilesAtWorldPositions(world_positions, tiles);
+            return static_cast<std::size_t>(std::count_if(tiles.cbegin(), tiles.cend(), [](const Tile* tile) { return nullptr != tile; }));
+        };
+        auto measure_lookups_per_second = [&](const auto& lookup)
+        {
+            constexpr unsigned int REPETITION_COUNT = 20;
+            std::size_t found_tile_count = 0;
+            auto start_time = std::chrono::steady_clock::now();
+            for (unsigned int repetition = 0; repetition < REPETITION_COUNT; ++repetition)
+            {
+                found_tile_count += lookup();
+            }
+            auto end_time = std::chrono::steady_clock::now();
+            REQUIRE(found_tile_count > 0);
+
+            std::chrono::duration<double> lookup_time_in_seconds = end_time - start_time;
+            double lookup_count = static_cast<double>(REPETITION_COUNT * world_positions.size());
+            return lookup_count / lookup_time_in_seconds.count();
+        };
+        REQUIRE(tile_map_ground_lookup() == single_lookup());
+        REQUIRE(single_lookup() == batch_lookup());
+        WARN("Looking up tiles through tile map ground: " << measure_lookups_per_second(tile_map_ground_lookup) << " lookups/second.");
+        WARN("Looking up single tiles: " << measure_lookups_per_second(single_lookup) << " lookups/second.");
+        WARN("Looking up tiles in batches: " << measure_lookups_per_second(batch_lookup) << " lookups/second.");
+
+        // BENCHMARK EACH WAY OF LOOKING UP TILES.
+        std::size_t found_tile_count = 0;
+        BENCHMARK("Looking up tiles through tile map ground")
+        {
+            found_tile_count += tile_map_ground_lookup();
+        }
+        BENCHMARK("Looking up single tiles")
+        {
+            found_tile_count += single_lookup();
+        }
+        BENCHMARK("Looking up tiles in batches")
+        {
+            found_tile_count += batch_lookup();
+        }
+        REQUIRE(found_tile_count > 0);
+    }
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Filesystem/File.h"
+#include "Maps/Data/WorldMapData.h"
+#include "Maps/TileMapFile.h"
+
+/// A namespace for map data shared between tests of the world.
+namespace TEST_WORLD_MAP_DATA
+{
+    /// The path of the game's map file, relative to the directory from which tests are run.
+    constexpr const char* const WORLD_MAP_FILEPATH = "res/maps/world.map";
+
+    /// Gets the map data for the world, which is only read from the game's map file once.
+    /// @return The map data for the world.
+    /// @throws std::bad_optional_access - Thrown if the map file couldn't be read.
+    inline const MAPS::DATA::WorldMapData& GetWorldMapData()
+    {
+        static const MAPS::DATA::WorldMapData WORLD_MAP_DATA = MAPS::TileMapFile::Read(FILESYSTEM::File::ReadBinary(WORLD_MAP_FILEPATH)).value();
+        return WORLD_MAP_DATA;
+    }
+}
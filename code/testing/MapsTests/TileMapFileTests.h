@@ -0,0 +1,166 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include "Containers/Array2D.h"
+#include "Filesystem/File.h"
+#include "Maps/Ark.h"
+#include "Maps/Data/WorldMapData.h"
+#include "Maps/Overworld.h"
+#include "Maps/TileMap.h"
+#include "Maps/TileMapFile.h"
+#include "Memory/AllocationTracker.h"
+#include "TestWorldMapData.h"
+
+/// A namespace for testing the TileMapFile class.
+namespace TEST_TILE_MAP_FILE
+{
+    using namespace MAPS;
+
+    /// Creates a layer with every tile having the same ID.
+    /// @param[in]  tile_id - The ID of all tiles in the layer.
+    /// @return The layer.
+    CONTAINERS::Array2D<std::uint8_t> CreateLayer(const std::uint8_t tile_id)
+    {
+        CONTAINERS::Array2D<std::uint8_t> layer(TileMap::WIDTH_IN_TILES, TileMap::HEIGHT_IN_TILES);
+        for (unsigned int y = 0; y < layer.GetHeight(); ++y)
+        {
+            for (unsigned int x = 0; x < layer.GetWidth(); ++x)
+            {
+                layer(x, y) = tile_id;
+            }
+        }
+        return layer;
+    }
+
+    /// Creates map data for the world with the expected number of tile maps, each only having
+    /// a ground layer with every tile having the same ID.
+    /// @return The map data.
+    DATA::WorldMapData CreateUniformMapData()
+    {
+        constexpr std::uint8_t GROUND_TILE_ID = 3;
+
+        DATA::WorldMapData map_data;
+        map_data.Overworld.Resize(Overworld::WIDTH_IN_TILE_MAPS, Overworld::HEIGHT_IN_TILE_MAPS);
+        for (unsigned int row = 0; row < Overworld::HEIGHT_IN_TILE_MAPS; ++row)
+        {
+            for (unsigned int column = 0; column < Overworld::WIDTH_IN_TILE_MAPS; ++column)
+            {
+                map_data.Overworld(column, row).GroundLayer = CreateLayer(GROUND_TILE_ID);
+            }
+        }
+
+        map_data.ArkInteriorLayersFromBottomToTop.resize(Ark::LAYER_COUNT);
+        for (CONTAINERS::Array2D<DATA::TileMapData>& ark_interior_layer_data : map_data.ArkInteriorLayersFromBottomToTop)
+        {
+            ark_interior_layer_data.Resize(Ark::INTERIOR_WIDTH_IN_TILE_MAPS, Ark::INTERIOR_HEIGHT_IN_TILE_MAPS);
+            for (unsigned int row = 0; row < Ark::INTERIOR_HEIGHT_IN_TILE_MAPS; ++row)
+            {
+                for (unsigned int column = 0; column < Ark::INTERIOR_WIDTH_IN_TILE_MAPS; ++column)
+                {
+                    ark_interior_layer_data(column, row).GroundLayer = CreateLayer(GROUND_TILE_ID);
+                }
+            }
+        }
+
+        return map_data;
+    }
+
+    TEST_CASE("Map data is unchanged by writing and reading a map file.", "[TileMapFile]")
+    {
+        // CREATE MAP DATA WITH A VARIETY OF TILES AND LAYERS.
+        DATA::WorldMapData map_data = CreateUniformMapData();
+        DATA::TileMapData& varied_tile_map_data = map_data.Overworld(2, 0);
+        for (unsigned int y = 0; y < TileMap::HEIGHT_IN_TILES; ++y)
+        {
+            for (unsigned int x = 0; x < TileMap::WIDTH_IN_TILES; ++x)
+            {
+                (*varied_tile_map_data.GroundLayer)(x, y) = static_cast<std::uint8_t>((x / 3 + y) % 7);
+            }
+        }
+        varied_tile_map_data.ArkLayer = CreateLayer(0);
+        (*varied_tile_map_data.ArkLayer)(5, 6) = 17;
+        map_data.Overworld(4, 4).ObjectLayer = CreateLayer(1);
+        (*map_data.ArkInteriorLayersFromBottomToTop.back()(1, 0).GroundLayer)(31, 23) = 255;
+
+        // WRITE AND READ THE MAP DATA.
+        std::string map_file_bytes = TileMapFile::Write(map_data);
+        std::optional<DATA::WorldMapData> read_map_data = TileMapFile::Read(map_file_bytes);
+
+        // VERIFY THAT THE MAP DATA WAS UNCHANGED.
+        REQUIRE(read_map_data);
+        REQUIRE(map_data == *read_map_data);
+        REQUIRE_FALSE(read_map_data->Overworld(0, 0).ArkLayer);
+        REQUIRE_FALSE(read_map_data->Overworld(0, 0).ObjectLayer);
+    }
+
+    TEST_CASE("Map files compress runs of identical tiles.", "[TileMapFile]")
+    {
+        // WRITE A MAP FILE WITH LONG RUNS OF IDENTICAL TILES.
+        DATA::WorldMapData map_data = CreateUniformMapData();
+        std::string map_file_bytes = TileMapFile::Write(map_data);
+
+        // VERIFY THAT THE MAP FILE IS MUCH SMALLER THAN THE RAW TILE IDS.
+        constexpr std::size_t TILE_MAP_COUNT = (
+            Overworld::WIDTH_IN_TILE_MAPS * Overworld::HEIGHT_IN_TILE_MAPS +
+            Ark::LAYER_COUNT * Ark::INTERIOR_WIDTH_IN_TILE_MAPS * Ark::INTERIOR_HEIGHT_IN_TILE_MAPS);
+        constexpr std::size_t RAW_TILE_ID_SIZE_IN_BYTES = TILE_MAP_COUNT * TileMap::WIDTH_IN_TILES * TileMap::HEIGHT_IN_TILES;
+        REQUIRE(map_file_bytes.size() < RAW_TILE_ID_SIZE_IN_BYTES / 20);
+    }
+
+    TEST_CASE("Invalid map files are rejected.", "[TileMapFile]")
+    {
+        std::string map_file_bytes = TileMapFile::Write(CreateUniformMapData());
+        REQUIRE(TileMapFile::Read(map_file_bytes));
+
+        // VERIFY THAT INCOMPLETE MAP FILES ARE REJECTED.
+        REQUIRE_FALSE(TileMapFile::Read(""));
+        REQUIRE_FALSE(TileMapFile::Read(map_file_bytes.substr(0, map_file_bytes.size() - 1)));
+
+        // VERIFY THAT MAP FILES WITH EXTRA DATA ARE REJECTED.
+        REQUIRE_FALSE(TileMapFile::Read(map_file_bytes + '\0'));
+
+        // VERIFY THAT MAP FILES WITH A DIFFERENT FORMAT ARE REJECTED.
+        std::string unknown_version_bytes = map_file_bytes;
+        unknown_version_bytes[TileMapFile::FILE_MAGIC.size()] = static_cast<char>(TileMapFile::FILE_FORMAT_VERSION + 1);
+        REQUIRE_FALSE(TileMapFile::Read(unknown_version_bytes));
+
+        // VERIFY THAT MAP FILES FOR A DIFFERENTLY SIZED WORLD ARE REJECTED.
+        DATA::WorldMapData smaller_map_data = CreateUniformMapData();
+        smaller_map_data.Overworld.Resize(Overworld::WIDTH_IN_TILE_MAPS - 1, Overworld::HEIGHT_IN_TILE_MAPS);
+        REQUIRE_FALSE(TileMapFile::Read(TileMapFile::Write(smaller_map_data)));
+
+        DATA::WorldMapData missing_ground_map_data = CreateUniformMapData();
+        missing_ground_map_data.ArkInteriorLayersFromBottomToTop.front()(0, 0).GroundLayer.reset();
+        REQUIRE_FALSE(TileMapFile::Read(TileMapFile::Write(missing_ground_map_data)));
+    }
+
+    TEST_CASE("Benchmark reading the game's map file.", "[.][benchmark][TileMapFile]")
+    {
+        // READ THE GAME'S MAP FILE.
+        std::string map_file_bytes = FILESYSTEM::File::ReadBinary(TEST_WORLD_MAP_DATA::WORLD_MAP_FILEPATH);
+        REQUIRE(TileMapFile::Read(map_file_bytes));
+
+        // MEASURE A SINGLE READ OF THE MAP FILE.
+        // This mirrors reading map data when the game starts.
+        std::size_t allocation_count_before_reading = MEMORY::AllocationTracker::GetTotalAllocationCount();
+        auto start_time = std::chrono::steady_clock::now();
+        std::optional<DATA::WorldMapData> map_data = TileMapFile::Read(map_file_bytes);
+        auto end_time = std::chrono::steady_clock::now();
+        std::size_t allocation_count = MEMORY::AllocationTracker::GetTotalAllocationCount() - allocation_count_before_reading;
+        auto read_time_in_microseconds = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time).count();
+        WARN("Reading " << map_file_bytes.size() << " bytes of map data took " << read_time_in_microseconds << " microseconds and " << allocation_count << " allocations.");
+
+        // BENCHMARK READING THE MAP FILE REPEATEDLY.
+        std::size_t read_count = 0;
+        BENCHMARK("Reading the game's map file")
+        {
+            std::optional<DATA::WorldMapData> benchmarked_map_data = TileMapFile::Read(map_file_bytes);
+            read_count += benchmarked_map_data.has_value();
+        }
+        REQUIRE(read_count > 0);
+    }
+}
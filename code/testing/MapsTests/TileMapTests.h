@@ -0,0 +1,188 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+#include <SFML/System.hpp>
+#include "Bible/BibleVerse.h"
+#include "Bible/BibleVerses.h"
+#include "Containers/ObjectPool.h"
+#include "Maps/World.h"
+#include "Memory/AllocationTracker.h"
+#include "Memory/Pointers.h"
+#include "Objects/EntityStorage.h"
+#include "Objects/FlamingSword.h"
+#include "Objects/Food.h"
+#include "Resources/AnimalGraphics.h"
+#include "Resources/AnimalSounds.h"
+#include "TestWorldMapData.h"
+
+/// A namespace for testing the TileMap class.
+namespace TEST_TILE_MAP
+{
+    using namespace MAPS;
+
+    /// Simulates a frame of gameplay for the transient objects in a tile map, with objects being created
+    /// and destroyed at a steady rate similar to the player chopping trees and collecting things.
+    /// @param[in]  frame_index - The index of the frame being simulated.
+    /// @param[in,out]  bible_verses_left_to_find - The Bible verses that may still be put in presents.
+    ///     Verses are removed as they're put in presents, like during gameplay.
+    /// @param[in,out]  tile_map - The tile map in which to simulate gameplay.
+    void SimulateGameplayFrame(
+        const std::size_t frame_index,
+        std::vector<BIBLE::BibleVerse>& bible_verses_left_to_find,
+        TileMap& tile_map)
+    {
+        const sf::Time ELAPSED_TIME_PER_FRAME = sf::seconds(1.0f / 60.0f);
+        const MATH::Vector2f TREE_WORLD_POSITION = tile_map.GetCenterWorldPosition();
+
+        // DROP FOOD FROM A TREE.
+        constexpr std::size_t FRAMES_BETWEEN_FALLING_FOOD = 30;
+        if (0 == frame_index % FRAMES_BETWEEN_FALLING_FOOD)
+        {
+            // Assertions aren't made here since they may allocate memory themselves.
+            std::optional<CONTAINERS::ObjectPoolHandle> falling_food_handle = tile_map.FallingFood.Create();
+            if (falling_food_handle)
+            {
+                OBJECTS::FallingFood* falling_food = tile_map.FallingFood.Get(*falling_food_handle);
+                falling_food->FoodItem.Type = OBJECTS::Food::TypeId::MANGO;
+                falling_food->FoodItem.Count = OBJECTS::Food::COUNT_PER_INSTANCE_FROM_TREES;
+                falling_food->FoodItem.Sprite.WorldPosition = TREE_WORLD_POSITION;
+                falling_food->DestinationWorldPosition = TREE_WORLD_POSITION + MATH::Vector2f(0.0f, 16.0f);
+            }
+        }
+
+        // CHOP DOWN A TREE AND COLLECT ITS WOOD.
+        constexpr std::size_t FRAMES_BETWEEN_CHOPPED_TREES = 60;
+        if (0 == frame_index % FRAMES_BETWEEN_CHOPPED_TREES)
+        {
+            tile_map.Entities.RemoveAll(OBJECTS::EntityKind::WOOD_LOGS);
+            tile_map.Entities.AddWoodLogs(TREE_WORLD_POSITION);
+            tile_map.Entities.AddDustCloud(TREE_WORLD_POSITION);
+        }
+
+        // HAVE PRESENTS AND THE FLAMING SWORD APPEAR AND BE COLLECTED.
+        constexpr std::size_t FRAMES_BETWEEN_PRESENTS = 90;
+        if (0 == frame_index % FRAMES_BETWEEN_PRESENTS)
+        {
+            tile_map.Presents.Clear();
+            if (!bible_verses_left_to_find.empty())
+            {
+                tile_map.Presents.Create(TREE_WORLD_POSITION, std::move(bible_verses_left_to_find.back()));
+                bible_verses_left_to_find.pop_back();
+            }
+
+            tile_map.FlamingSword.reset();
+            tile_map.FlamingSword = OBJECTS::FlamingSword(TREE_WORLD_POSITION.X, TREE_WORLD_POSITION.Y);
+        }
+
+        // UPDATE THE TILE MAP.
+        tile_map.UpdateTransientObjects(true, ELAPSED_TIME_PER_FRAME);
+
+        // COLLECT ANY FOOD THAT HAS FINISHED FALLING.
+        tile_map.Entities.RemoveAll(OBJECTS::EntityKind::FOOD);
+    }
+
+    TEST_CASE("Gameplay frames with transient objects don't allocate memory.", "[TileMap]")
+    {
+        // GET A TILE MAP IN THE WORLD.
+        MEMORY::NonNullSharedPointer<World> world = World::CreateInitial(TEST_WORLD_MAP_DATA::GetWorldMapData());
+        constexpr unsigned int ROW = 0;
+        constexpr unsigned int COLUMN = 0;
+        TileMap* tile_map = world->Overworld.MapGrid.GetTileMap(ROW, COLUMN);
+        REQUIRE(tile_map);
+
+        // GET BIBLE VERSES TO PUT IN PRESENTS.
+        // Real verses are used since their text is too long to avoid allocating if copied.
+        std::vector<BIBLE::BibleVerse> bible_verses_left_to_find = BIBLE::BIBLE_VERSES;
+
+        // SIMULATE GAMEPLAY UNTIL REACHING A STEADY STATE.
+        // Storage for simple entities grows as needed, so it may allocate until it is large enough.
+        constexpr std::size_t WARM_UP_FRAME_COUNT = 600;
+        for (std::size_t frame_index = 0; frame_index < WARM_UP_FRAME_COUNT; ++frame_index)
+        {
+            SimulateGameplayFrame(frame_index, bible_verses_left_to_find, *tile_map);
+        }
+
+        // VERIFY THAT FURTHER GAMEPLAY FRAMES DON'T ALLOCATE MEMORY.
+        constexpr std::size_t MEASURED_FRAME_COUNT = 600;
+        std::size_t allocation_count_before_frames = MEMORY::AllocationTracker::GetTotalAllocationCount();
+        for (std::size_t frame_index = 0; frame_index < MEASURED_FRAME_COUNT; ++frame_index)
+        {
+            SimulateGameplayFrame(frame_index, bible_verses_left_to_find, *tile_map);
+        }
+        std::size_t allocation_count = MEMORY::AllocationTracker::GetTotalAllocationCount() - allocation_count_before_frames;
+        REQUIRE(0 == allocation_count);
+
+        // VERIFY THAT TRANSIENT OBJECTS WERE ACTUALLY CREATED DURING GAMEPLAY.
+        REQUIRE(1 == tile_map->Entities.Count(OBJECTS::EntityKind::WOOD_LOGS));
+        REQUIRE_FALSE(tile_map->FallingFood.Empty());
+        REQUIRE(1 == tile_map->Presents.Count());
+        const OBJECTS::Present& present = *tile_map->Presents.begin();
+        REQUIRE_FALSE(present.BibleVerse.Text.empty());
+        REQUIRE(tile_map->FlamingSword);
+    }
+
+    TEST_CASE("Resetting a tile map restores the animations of trees and animals.", "[TileMap]")
+    {
+        // GET A TILE MAP WITH TREES IN THE WORLD.
+        MEMORY::NonNullSharedPointer<World> world = World::CreateInitial(TEST_WORLD_MAP_DATA::GetWorldMapData());
+        TileMap* tile_map = nullptr;
+        for (unsigned int row = 0; row < Overworld::HEIGHT_IN_TILE_MAPS && !tile_map; ++row)
+        {
+            for (unsigned int column = 0; column < Overworld::WIDTH_IN_TILE_MAPS && !tile_map; ++column)
+            {
+                TileMap* current_tile_map = world->Overworld.MapGrid.GetTileMap(row, column);
+                bool current_tile_map_has_trees = (current_tile_map && !current_tile_map->Trees.empty());
+                if (current_tile_map_has_trees)
+                {
+                    tile_map = current_tile_map;
+                }
+            }
+        }
+        REQUIRE(tile_map);
+
+        // ADD A ROAMING ANIMAL TO THE INITIAL STATE OF THE TILE MAP.
+        OBJECTS::AnimalType animal_type(OBJECTS::AnimalSpecies::CAMEL, OBJECTS::AnimalGender::MALE);
+        std::shared_ptr<GRAPHICS::AnimatedSprite> animal_sprite = RESOURCES::AnimalGraphics::GetSprite(animal_type);
+        REQUIRE(animal_sprite);
+        const MATH::Vector2f INITIAL_ANIMAL_WORLD_POSITION = tile_map->GetCenterWorldPosition();
+        auto animal = MEMORY::NonNullSharedPointer<OBJECTS::Animal>(std::make_shared<OBJECTS::Animal>(
+            animal_type,
+            *animal_sprite,
+            RESOURCES::AnimalSounds::GetSound(animal_type.Species)));
+        animal->Sprite.SetWorldPosition(INITIAL_ANIMAL_WORLD_POSITION);
+        tile_map->RoamingAnimals.emplace_back(animal);
+        tile_map->SaveInitialState();
+
+        // SHAKE A TREE AND MOVE THE ANIMAL.
+        const sf::Time ELAPSED_TIME = sf::seconds(0.1f);
+        OBJECTS::Tree& tree = tile_map->Trees.front();
+        tree.StartShaking();
+        tree.Update(ELAPSED_TIME);
+        REQUIRE(tree.IsShaking());
+
+        OBJECTS::Animal& roaming_animal = *tile_map->RoamingAnimals.front();
+        roaming_animal.Sprite.SetWorldPosition(INITIAL_ANIMAL_WORLD_POSITION + MATH::Vector2f(16.0f, 16.0f));
+        roaming_animal.Sprite.Play();
+        roaming_animal.Sprite.Update(ELAPSED_TIME);
+        REQUIRE(roaming_animal.Sprite.IsAnimating());
+        tile_map->MarkChangedFromInitialState();
+
+        // VERIFY THAT RESETTING THE TILE MAP RESTORES THE TREE AND ANIMAL.
+        REQUIRE(tile_map->ResetToInitialState());
+        REQUIRE_FALSE(tile_map->Trees.front().IsShaking());
+        REQUIRE(1 == tile_map->RoamingAnimals.size());
+        const OBJECTS::Animal& reset_animal = *tile_map->RoamingAnimals.front();
+        REQUIRE(INITIAL_ANIMAL_WORLD_POSITION == reset_animal.Sprite.GetWorldPosition());
+        REQUIRE_FALSE(reset_animal.Sprite.IsAnimating());
+
+        // VERIFY THAT CHANGES AFTER A RESET CAN ALSO BE UNDONE.
+        tile_map->Trees.front().StartShaking();
+        tile_map->MarkChangedFromInitialState();
+        REQUIRE(tile_map->ResetToInitialState());
+        REQUIRE_FALSE(tile_map->Trees.front().IsShaking());
+    }
+}
@@ -0,0 +1,208 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Maps/World.h"
+#include "Maps/WorldSnapshot.h"
+#include "Memory/AllocationTracker.h"
+#include "Memory/Pointers.h"
+#include "TestWorldMapData.h"
+
+/// A namespace for testing the WorldSnapshot class.
+namespace TEST_WORLD_SNAPSHOT
+{
+    using namespace MAPS;
+
+    /// Gets the index of a map grid within a world, in the same order as in world snapshots.
+    /// @param[in]  world - The world containing the map grid.
+    /// @param[in]  map_grid - The map grid whose index to get.
+    /// @return The index of the map grid; the number of map grids in the world if it isn't in the world.
+    std::size_t GetMapGridIndex(const World& world, const MultiTileMapGrid* const map_grid)
+    {
+        if (&world.Overworld.MapGrid == map_grid)
+        {
+            return WorldSnapshot::OVERWORLD_MAP_GRID_INDEX;
+        }
+
+        std::size_t ark_interior_layer_count = world.Ark.Interior.LayersFromBottomToTop.size();
+        for (std::size_t layer_index = 0; layer_index < ark_interior_layer_count; ++layer_index)
+        {
+            if (&world.Ark.Interior.LayersFromBottomToTop[layer_index] == map_grid)
+            {
+                return WorldSnapshot::FIRST_ARK_INTERIOR_MAP_GRID_INDEX + layer_index;
+            }
+        }
+
+        return WorldSnapshot::FIRST_ARK_INTERIOR_MAP_GRID_INDEX + ark_interior_layer_count;
+    }
+
+    /// Requires that a map grid restored from a snapshot matches the map grid it was created from.
+    /// @param[in]  expected_world - The world from which the snapshot was created.
+    /// @param[in]  expected_map_grid - The map grid from which the snapshot was created.
+    /// @param[in]  actual_world - The world restored from the snapshot.
+    /// @param[in]  actual_map_grid - The map grid restored from the snapshot.
+    void RequireSameMapGrid(
+        const World& expected_world,
+        const MultiTileMapGrid& expected_map_grid,
+        const World& actual_world,
+        const MultiTileMapGrid& actual_map_grid)
+    {
+        REQUIRE(expected_map_grid.TileMaps.GetWidth() == actual_map_grid.TileMaps.GetWidth());
+        REQUIRE(expected_map_grid.TileMaps.GetHeight() == actual_map_grid.TileMaps.GetHeight());
+        for (unsigned int row = 0; row < expected_map_grid.TileMaps.GetHeight(); ++row)
+        {
+            for (unsigned int column = 0; column < expected_map_grid.TileMaps.GetWidth(); ++column)
+            {
+                // VERIFY THE TILE MAP IS IN THE SAME PLACE.
+                const TileMap* expected_tile_map = expected_map_grid.GetTileMap(row, column);
+                const TileMap* actual_tile_map = actual_map_grid.GetTileMap(row, column);
+                REQUIRE(expected_tile_map);
+                REQUIRE(actual_tile_map);
+                REQUIRE(expected_tile_map->Type == actual_tile_map->Type);
+                REQUIRE(&actual_map_grid == actual_tile_map->MapGrid.get());
+                REQUIRE(expected_tile_map->GetWorldBoundingBox() == actual_tile_map->GetWorldBoundingBox());
+
+                // VERIFY THE TILES ARE THE SAME.
+                for (unsigned int tile_y = 0; tile_y < TileMap::HEIGHT_IN_TILES; ++tile_y)
+                {
+                    for (unsigned int tile_x = 0; tile_x < TileMap::WIDTH_IN_TILES; ++tile_x)
+                    {
+                        const std::shared_ptr<Tile>& expected_tile = expected_tile_map->Ground.Tiles(tile_x, tile_y);
+                        const std::shared_ptr<Tile>& actual_tile = actual_tile_map->Ground.Tiles(tile_x, tile_y);
+                        REQUIRE(static_cast<bool>(expected_tile) == static_cast<bool>(actual_tile));
+                        if (expected_tile)
+                        {
+                            REQUIRE(expected_tile->Id == actual_tile->Id);
+                            REQUIRE(expected_tile->Sprite.GetWorldPosition() == actual_tile->Sprite.GetWorldPosition());
+                        }
+                    }
+                }
+
+                // VERIFY THE OBJECTS ARE THE SAME.
+                REQUIRE(expected_tile_map->ArkPieces.size() == actual_tile_map->ArkPieces.size());
+                for (std::size_t ark_piece_index = 0; ark_piece_index < expected_tile_map->ArkPieces.size(); ++ark_piece_index)
+                {
+                    const OBJECTS::ArkPiece& expected_ark_piece = expected_tile_map->ArkPieces[ark_piece_index];
+                    const OBJECTS::ArkPiece& actual_ark_piece = actual_tile_map->ArkPieces[ark_piece_index];
+                    REQUIRE(expected_ark_piece.Id == actual_ark_piece.Id);
+                    REQUIRE(expected_ark_piece.IsExternalDoorway == actual_ark_piece.IsExternalDoorway);
+                    REQUIRE(expected_ark_piece.Sprite.WorldPosition == actual_ark_piece.Sprite.WorldPosition);
+                }
+
+                REQUIRE(expected_tile_map->Trees.size() == actual_tile_map->Trees.size());
+                for (std::size_t tree_index = 0; tree_index < expected_tile_map->Trees.size(); ++tree_index)
+                {
+                    const OBJECTS::Tree& expected_tree = expected_tile_map->Trees[tree_index];
+                    const OBJECTS::Tree& actual_tree = actual_tile_map->Trees[tree_index];
+                    REQUIRE(expected_tree.GetWorldBoundingBox() == actual_tree.GetWorldBoundingBox());
+                }
+
+                REQUIRE(expected_tile_map->AnimalPens.size() == actual_tile_map->AnimalPens.size());
+                for (std::size_t animal_pen_index = 0; animal_pen_index < expected_tile_map->AnimalPens.size(); ++animal_pen_index)
+                {
+                    const AnimalPen& expected_animal_pen = expected_tile_map->AnimalPens[animal_pen_index];
+                    const AnimalPen& actual_animal_pen = actual_tile_map->AnimalPens[animal_pen_index];
+                    REQUIRE(expected_animal_pen.TileMapLayerIndex == actual_animal_pen.TileMapLayerIndex);
+                    REQUIRE(expected_animal_pen.TileMapColumnIndex == actual_animal_pen.TileMapColumnIndex);
+                    REQUIRE(expected_animal_pen.TileMapRowIndex == actual_animal_pen.TileMapRowIndex);
+                    REQUIRE(expected_animal_pen.AnimalPenIndex == actual_animal_pen.AnimalPenIndex);
+                    REQUIRE(expected_animal_pen.InteriorBoundingBox == actual_animal_pen.InteriorBoundingBox);
+                }
+
+                // VERIFY THE EXIT POINTS LEAD TO THE SAME PLACES IN EACH WORLD.
+                REQUIRE(expected_tile_map->ExitPoints.size() == actual_tile_map->ExitPoints.size());
+                for (std::size_t exit_point_index = 0; exit_point_index < expected_tile_map->ExitPoints.size(); ++exit_point_index)
+                {
+                    const ExitPoint& expected_exit_point = expected_tile_map->ExitPoints[exit_point_index];
+                    const ExitPoint& actual_exit_point = actual_tile_map->ExitPoints[exit_point_index];
+                    REQUIRE(expected_exit_point.BoundingBox == actual_exit_point.BoundingBox);
+                    REQUIRE(expected_exit_point.NewPlayerWorldPosition == actual_exit_point.NewPlayerWorldPosition);
+                    REQUIRE(GetMapGridIndex(expected_world, expected_exit_point.NewMapGrid) == GetMapGridIndex(actual_world, actual_exit_point.NewMapGrid));
+                    REQUIRE(actual_exit_point.NewMapGrid == actual_exit_point.NewTileMap->MapGrid.get());
+                    REQUIRE(expected_exit_point.NewTileMap->GridRowIndex == actual_exit_point.NewTileMap->GridRowIndex);
+                    REQUIRE(expected_exit_point.NewTileMap->GridColumnIndex == actual_exit_point.NewTileMap->GridColumnIndex);
+                }
+            }
+        }
+    }
+
+    TEST_CASE("A world restored from a snapshot matches the world built from map data.", "[WorldSnapshot]")
+    {
+        // CREATE A SNAPSHOT OF A WORLD BUILT FROM MAP DATA.
+        MEMORY::NonNullSharedPointer<World> built_world = World::CreateInitial(TEST_WORLD_MAP_DATA::GetWorldMapData());
+        std::string snapshot = WorldSnapshot::Create(*built_world);
+        REQUIRE(snapshot.starts_with(WorldSnapshot::FILE_MAGIC));
+
+        // RESTORE A WORLD FROM THE SNAPSHOT.
+        std::shared_ptr<World> restored_world = std::make_shared<World>(TEST_WORLD_MAP_DATA::GetWorldMapData(), snapshot);
+        REQUIRE(WorldSnapshot::Restore(snapshot, *restored_world));
+
+        // VERIFY THAT THE RESTORED WORLD MATCHES.
+        RequireSameMapGrid(*built_world, built_world->Overworld.MapGrid, *restored_world, restored_world->Overworld.MapGrid);
+        REQUIRE(built_world->Ark.Interior.LayersFromBottomToTop.size() == restored_world->Ark.Interior.LayersFromBottomToTop.size());
+        for (std::size_t layer_index = 0; layer_index < built_world->Ark.Interior.LayersFromBottomToTop.size(); ++layer_index)
+        {
+            RequireSameMapGrid(
+                *built_world,
+                built_world->Ark.Interior.LayersFromBottomToTop[layer_index],
+                *restored_world,
+                restored_world->Ark.Interior.LayersFromBottomToTop[layer_index]);
+        }
+
+        // VERIFY THAT A SNAPSHOT OF THE RESTORED WORLD IS THE SAME.
+        REQUIRE(snapshot == WorldSnapshot::Create(*restored_world));
+    }
+
+    TEST_CASE("Out-of-date or corrupted world snapshots aren't restored.", "[WorldSnapshot]")
+    {
+        // CREATE A SNAPSHOT.
+        MEMORY::NonNullSharedPointer<World> world = World::CreateInitial(TEST_WORLD_MAP_DATA::GetWorldMapData());
+        std::string snapshot = WorldSnapshot::Create(*world);
+        const TileMap* original_tile_map = world->Overworld.MapGrid.GetTileMap(0u, 0u);
+
+        // VERIFY THAT A SNAPSHOT OF DIFFERENT MAP DATA ISN'T RESTORED.
+        constexpr std::size_t MAP_DATA_HASH_OFFSET_IN_BYTES = WorldSnapshot::FILE_MAGIC.size() + sizeof(WorldSnapshot::FILE_FORMAT_VERSION);
+        std::string out_of_date_snapshot = snapshot;
+        out_of_date_snapshot[MAP_DATA_HASH_OFFSET_IN_BYTES] = static_cast<char>(~out_of_date_snapshot[MAP_DATA_HASH_OFFSET_IN_BYTES]);
+        REQUIRE_FALSE(WorldSnapshot::Restore(out_of_date_snapshot, *world));
+
+        // VERIFY THAT A TRUNCATED SNAPSHOT ISN'T RESTORED.
+        std::string truncated_snapshot = snapshot.substr(0, snapshot.size() - 1);
+        REQUIRE_FALSE(WorldSnapshot::Restore(truncated_snapshot, *world));
+
+        // VERIFY THAT THE WORLD WASN'T CHANGED.
+        REQUIRE(original_tile_map == world->Overworld.MapGrid.GetTileMap(0u, 0u));
+
+        // VERIFY THAT A WORLD WITH AN INVALID SNAPSHOT IS STILL BUILT FROM MAP DATA.
+        std::shared_ptr<World> world_built_from_map_data = std::make_shared<World>(TEST_WORLD_MAP_DATA::GetWorldMapData(), truncated_snapshot);
+        REQUIRE(snapshot == WorldSnapshot::Create(*world_built_from_map_data));
+    }
+
+    TEST_CASE("Benchmark restoring the world from a snapshot.", "[.][benchmark][World]")
+    {
+        // MEASURE A SINGLE RESTORATION OF THE WORLD.
+        // This mirrors creating the world when the game starts.
+        MEMORY::NonNullSharedPointer<World> built_world = World::CreateInitial(TEST_WORLD_MAP_DATA::GetWorldMapData());
+        std::string snapshot = WorldSnapshot::Create(*built_world);
+        std::size_t allocation_count_before_restoring = MEMORY::AllocationTracker::GetTotalAllocationCount();
+        auto start_time = std::chrono::steady_clock::now();
+        std::shared_ptr<World> world = std::make_shared<World>(TEST_WORLD_MAP_DATA::GetWorldMapData(), snapshot);
+        auto end_time = std::chrono::steady_clock::now();
+        std::size_t allocation_count = MEMORY::AllocationTracker::GetTotalAllocationCount() - allocation_count_before_restoring;
+        auto restore_time_in_microseconds = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time).count();
+        WARN("Restoring the world from a " << snapshot.size() << "-byte snapshot took "
+            << restore_time_in_microseconds << " microseconds and " << allocation_count << " allocations.");
+
+        // BENCHMARK RESTORING THE WORLD REPEATEDLY.
+        std::size_t tile_map_count = 0;
+        BENCHMARK("Restoring the world from a snapshot")
+        {
+            std::shared_ptr<World> benchmarked_world = std::make_shared<World>(TEST_WORLD_MAP_DATA::GetWorldMapData(), snapshot);
+            tile_map_count += benchmarked_world->Overworld.MapGrid.TileMaps.GetWidth();
+        }
+        REQUIRE(tile_map_count > 0);
+    }
+}
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Graphics/AnimationSequence.h"
+#include "Maps/Tileset.h"
+#include "Maps/World.h"
+#include "Maps/WorldSnapshot.h"
+#include "Memory/AllocationTracker.h"
+#include "Memory/Pointers.h"
+#include "Objects/Food.h"
+#include "TestWorldMapData.h"
+
+/// A namespace for testing the World class.
+namespace TEST_WORLD
+{
+    using namespace MAPS;
+
+    TEST_CASE("The world is built without redundant containers or animation frames.", "[World]")
+    {
+        // BUILD THE WORLD.
+        MEMORY::NonNullSharedPointer<World> world = World::CreateInitial(TEST_WORLD_MAP_DATA::GetWorldMapData());
+
+        // VERIFY THAT ALL OVERWORLD TILE MAPS WERE BUILT WITHOUT EXTRA SPACE.
+        std::shared_ptr<const std::vector<MATH::IntRectangle>> water_animation_frames = nullptr;
+        std::shared_ptr<const std::vector<MATH::IntRectangle>> tree_shake_animation_frames = nullptr;
+        std::size_t tree_count = 0;
+        for (unsigned int row = 0; row < Overworld::HEIGHT_IN_TILE_MAPS; ++row)
+        {
+            for (unsigned int column = 0; column < Overworld::WIDTH_IN_TILE_MAPS; ++column)
+            {
+                TileMap* tile_map = world->Overworld.MapGrid.GetTileMap(row, column);
+                REQUIRE(tile_map);
+                REQUIRE(tile_map->Trees.size() == tile_map->Trees.capacity());
+                REQUIRE(tile_map->ArkPieces.size() == tile_map->ArkPieces.capacity());
+                tree_count += tile_map->Trees.size();
+
+                // VERIFY THAT ANIMATION FRAMES ARE SHARED BETWEEN ALL WATER TILES.
+                for (unsigned int tile_y = 0; tile_y < TileMap::HEIGHT_IN_TILES; ++tile_y)
+                {
+                    for (unsigned int tile_x = 0; tile_x < TileMap::WIDTH_IN_TILES; ++tile_x)
+                    {
+                        std::shared_ptr<Tile> tile = tile_map->Ground.Tiles(tile_x, tile_y);
+                        bool is_water_tile = tile && TileType::IsForWater(tile->Type);
+                        if (!is_water_tile)
+                        {
+                            continue;
+                        }
+
+                        std::shared_ptr<GRAPHICS::AnimationSequence> water_animation = tile->Sprite.GetCurrentAnimationSequence();
+                        REQUIRE(water_animation);
+                        if (!water_animation_frames)
+                        {
+                            water_animation_frames = water_animation->Frames;
+                        }
+                        REQUIRE(water_animation_frames == water_animation->Frames);
+                    }
+                }
+
+                // VERIFY THAT ANIMATION FRAMES ARE SHARED BETWEEN ALL TREES.
+                for (OBJECTS::Tree& tree : tile_map->Trees)
+                {
+                    tree.Sprite.UseAnimationSequence("TreeShake");
+                    std::shared_ptr<GRAPHICS::AnimationSequence> tree_shake_animation = tree.Sprite.GetCurrentAnimationSequence();
+                    REQUIRE(tree_shake_animation);
+                    if (!tree_shake_animation_frames)
+                    {
+                        tree_shake_animation_frames = tree_shake_animation->Frames;
+                    }
+                    REQUIRE(tree_shake_animation_frames == tree_shake_animation->Frames);
+                }
+            }
+        }
+        REQUIRE(water_animation_frames);
+        REQUIRE(tree_count > 0);
+
+        // VERIFY THAT THE ARK INTERIOR WAS BUILT.
+        REQUIRE(Ark::LAYER_COUNT == world->Ark.Interior.LayersFromBottomToTop.size());
+        REQUIRE(world->Ark.GetEntranceMap());
+    }
+
+    TEST_CASE("Resetting the world only restores tile maps that may have changed.", "[World]")
+    {
+        // BUILD THE WORLD.
+        MEMORY::NonNullSharedPointer<World> world = World::CreateInitial(TEST_WORLD_MAP_DATA::GetWorldMapData());
+        std::string initial_snapshot = WorldSnapshot::Create(*world);
+
+        // FIND TWO TILE MAPS WITH TREES.
+        // Tile maps are only accessed as const here to avoid marking them as changed.
+        const World& const_world = *world;
+        const TileMap* changed_tile_map = nullptr;
+        const TileMap* unchanged_tile_map = nullptr;
+        for (unsigned int row = 0; row < Overworld::HEIGHT_IN_TILE_MAPS; ++row)
+        {
+            for (unsigned int column = 0; column < Overworld::WIDTH_IN_TILE_MAPS; ++column)
+            {
+                const TileMap* tile_map = const_world.Overworld.MapGrid.GetTileMap(row, column);
+                if (tile_map->Trees.empty())
+                {
+                    continue;
+                }
+
+                if (!changed_tile_map)
+                {
+                    changed_tile_map = tile_map;
+                }
+                else if (!unchanged_tile_map)
+                {
+                    unchanged_tile_map = tile_map;
+                }
+            }
+        }
+        REQUIRE(changed_tile_map);
+        REQUIRE(unchanged_tile_map);
+        const OBJECTS::Tree* unchanged_trees = unchanged_tile_map->Trees.data();
+
+        // CHANGE A TILE MAP IN THE OVERWORLD.
+        TileMap* tile_map_to_change = world->Overworld.MapGrid.GetTileMapForChanging(changed_tile_map->GridRowIndex, changed_tile_map->GridColumnIndex);
+        REQUIRE(changed_tile_map == tile_map_to_change);
+        tile_map_to_change->Trees.pop_back();
+        tile_map_to_change->Entities.AddFood(OBJECTS::Food());
+
+        // BUILD PART OF THE ARK.
+        TileMap* ark_tile_map = world->Overworld.MapGrid.GetTileMapForChanging(Overworld::ARK_ENTRANCE_TILE_MAP_ROW, Overworld::ARK_ENTRANCE_TILE_MAP_COLUMN);
+        REQUIRE(ark_tile_map);
+        REQUIRE_FALSE(ark_tile_map->ArkPieces.empty());
+        ark_tile_map->ArkPieces.front().Built = true;
+
+        // REPLACE A GROUND TILE IN THE ARK.
+        TileMap* ark_entrance_map = world->Ark.GetEntranceMapForChanging();
+        REQUIRE(ark_entrance_map);
+        REQUIRE(ark_entrance_map->HasChangedFromInitialState());
+        std::shared_ptr<Tile> original_ark_entrance_tile = ark_entrance_map->Ground.Tiles(0, 0);
+        std::shared_ptr<Tile> replacement_tile = Tileset().CreateTile(TileType::ARK_INTERIOR_CENTER_EXIT_CLOSED);
+        REQUIRE(replacement_tile);
+        ark_entrance_map->Ground.SetTile(0, 0, replacement_tile);
+
+        // RESET THE WORLD.
+        world->ResetToInitialState();
+
+        // VERIFY THAT CHANGED TILE MAPS WERE RESTORED IN PLACE.
+        REQUIRE(initial_snapshot == WorldSnapshot::Create(*world));
+        REQUIRE(changed_tile_map == const_world.Overworld.MapGrid.GetTileMap(changed_tile_map->GridRowIndex, changed_tile_map->GridColumnIndex));
+        REQUIRE(0 == changed_tile_map->Entities.Count());
+        REQUIRE_FALSE(ark_tile_map->ArkPieces.front().Built);
+
+        // VERIFY THAT GROUND TILES ARE SHARED WITH THE INITIAL STATE RATHER THAN RECREATED.
+        REQUIRE(ark_entrance_map == const_world.Ark.GetEntranceMap());
+        REQUIRE(original_ark_entrance_tile == ark_entrance_map->Ground.Tiles(0, 0));
+
+        // VERIFY THAT UNCHANGED TILE MAPS WEREN'T RESTORED.
+        REQUIRE(unchanged_trees == unchanged_tile_map->Trees.data());
+    }
+
+    TEST_CASE("Benchmark building the world.", "[.][benchmark][World]")
+    {
+        // MEASURE A SINGLE BUILD OF THE WORLD.
+        // This mirrors building the world when the game starts.
+        std::size_t allocation_count_before_building = MEMORY::AllocationTracker::GetTotalAllocationCount();
+        auto start_time = std::chrono::steady_clock::now();
+        MEMORY::NonNullSharedPointer<World> world = World::CreateInitial(TEST_WORLD_MAP_DATA::GetWorldMapData());
+        auto end_time = std::chrono::steady_clock::now();
+        std::size_t allocation_count = MEMORY::AllocationTracker::GetTotalAllocationCount() - allocation_count_before_building;
+        auto build_time_in_microseconds = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time).count();
+        WARN("Building the world took " << build_time_in_microseconds << " microseconds and " << allocation_count << " allocations.");
+
+        // BENCHMARK BUILDING THE WORLD REPEATEDLY.
+        std::size_t tile_map_count = 0;
+        BENCHMARK("Building the world")
+        {
+            MEMORY::NonNullSharedPointer<World> benchmarked_world = World::CreateInitial(TEST_WORLD_MAP_DATA::GetWorldMapData());
+            tile_map_count += benchmarked_world->Overworld.MapGrid.TileMaps.GetWidth();
+        }
+        REQUIRE(tile_map_count > 0);
+    }
+
+    TEST_CASE("Benchmark resetting the world.", "[.][benchmark][World]")
+    {
+        // MEASURE A SINGLE RESET OF THE WORLD AFTER A TILE MAP HAS CHANGED.
+        // This mirrors loading a different saved game after playing briefly.
+        MEMORY::NonNullSharedPointer<World> world = World::CreateInitial(TEST_WORLD_MAP_DATA::GetWorldMapData());
+        TileMap* changed_tile_map = world->Overworld.MapGrid.GetTileMapForChanging(0u, 0u);
+        REQUIRE(changed_tile_map);
+        std::size_t allocation_count_before_resetting = MEMORY::AllocationTracker::GetTotalAllocationCount();
+        auto start_time = std::chrono::steady_clock::now();
+        world->ResetToInitialState();
+        auto end_time = std::chrono::steady_clock::now();
+        std::size_t allocation_count = MEMORY::AllocationTracker::GetTotalAllocationCount() - allocation_count_before_resetting;
+        auto reset_time_in_microseconds = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time).count();
+        WARN("Resetting the world after changing a tile map took " << reset_time_in_microseconds << " microseconds and " << allocation_count << " allocations.");
+
+        // BENCHMARK RESETTING THE WORLD REPEATEDLY.
+        std::size_t reset_count = 0;
+        BENCHMARK("Resetting the world after changing a tile map")
+        {
+            world->Overworld.MapGrid.GetTileMapForChanging(0u, 0u);
+            world->ResetToInitialState();
+            ++reset_count;
+        }
+        REQUIRE(reset_count > 0);
+    }
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Memory/AllocationTracker.h"
+
+/// A namespace for testing the AllocationTracker class.
+namespace ALLOCATION_TRACKER_TESTS
+{
+    using namespace MEMORY;
+
+    TEST_CASE("Allocations are attributed to the innermost tagged scope.", "[AllocationTracker]")
+    {
+        std::vector<std::unique_ptr<int>> allocations;
+        allocations.reserve(4);
+
+        // ALLOCATE MEMORY WITHIN NESTED SCOPES.
+        // Assertions aren't made within the scopes since they may allocate memory themselves.
+        AllocationTag inner_scope_tag = AllocationTag::OTHER;
+        AllocationTag outer_scope_tag = AllocationTag::OTHER;
+        AllocationTracker::EndFrame();
+        {
+            AllocationScope render_scope(AllocationTag::RENDER);
+            allocations.push_back(std::make_unique<int>(1));
+            {
+                AllocationScope gui_scope(AllocationTag::GUI);
+                inner_scope_tag = AllocationTracker::GetCurrentTag();
+                allocations.push_back(std::make_unique<int>(2));
+                allocations.push_back(std::make_unique<int>(3));
+            }
+            outer_scope_tag = AllocationTracker::GetCurrentTag();
+        }
+        FrameAllocationStatistics frame_statistics = AllocationTracker::EndFrame();
+
+        // VERIFY THAT ALLOCATIONS WERE ATTRIBUTED TO THE RIGHT TAGS.
+        REQUIRE(AllocationTag::GUI == inner_scope_tag);
+        REQUIRE(AllocationTag::RENDER == outer_scope_tag);
+        REQUIRE(AllocationTag::OTHER == AllocationTracker::GetCurrentTag());
+        const AllocationCounts& render_counts = frame_statistics.CountsByTag[static_cast<std::size_t>(AllocationTag::RENDER)];
+        const AllocationCounts& gui_counts = frame_statistics.CountsByTag[static_cast<std::size_t>(AllocationTag::GUI)];
+        REQUIRE(1 == render_counts.AllocationCount);
+        REQUIRE(sizeof(int) == render_counts.AllocatedByteCount);
+        REQUIRE(2 == gui_counts.AllocationCount);
+        REQUIRE(frame_statistics.Total.AllocationCount >= 3);
+
+        // VERIFY THAT A NEW FRAME STARTS WITHOUT ANY ALLOCATIONS.
+        FrameAllocationStatistics new_frame_statistics = AllocationTracker::GetCurrentFrameStatistics();
+        REQUIRE(0 == new_frame_statistics.CountsByTag[static_cast<std::size_t>(AllocationTag::GUI)].AllocationCount);
+    }
+
+    TEST_CASE("The call sites making the most allocations are reported.", "[AllocationTracker]")
+    {
+        std::vector<std::unique_ptr<int>> allocations;
+        constexpr std::size_t ALLOCATION_COUNT = 100;
+        allocations.reserve(ALLOCATION_COUNT);
+
+        // ALLOCATE MEMORY REPEATEDLY FROM THE SAME CALL SITE.
+        AllocationTracker::ClearCallSites();
+        AllocationTracker::EnableCallSiteTracking(true);
+        for (std::size_t allocation_index = 0; allocation_index < ALLOCATION_COUNT; ++allocation_index)
+        {
+            allocations.push_back(std::make_unique<int>(0));
+        }
+        AllocationTracker::EnableCallSiteTracking(false);
+
+        // VERIFY THAT THE CALL SITE IS REPORTED AS MAKING THE MOST ALLOCATIONS.
+        std::vector<AllocationCallSite> top_call_sites = AllocationTracker::GetTopCallSites(1);
+        REQUIRE(1 == top_call_sites.size());
+        REQUIRE(ALLOCATION_COUNT == top_call_sites.front().Counts.AllocationCount);
+        REQUIRE(ALLOCATION_COUNT * sizeof(int) == top_call_sites.front().Counts.AllocatedByteCount);
+        REQUIRE(nullptr != top_call_sites.front().ReturnAddresses.front());
+
+        std::string report = AllocationTracker::GetTopCallSitesReport(1);
+        REQUIRE(report.find("100 allocations") != std::string::npos);
+    }
+}
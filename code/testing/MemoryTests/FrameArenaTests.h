@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include "Memory/AllocationTracker.h"
+#include "Memory/FrameArena.h"
+
+/// A namespace for testing the FrameArena class.
+namespace FRAME_ARENA_TESTS
+{
+    using namespace MEMORY;
+
+    TEST_CASE("Temporary containers can be allocated from a frame arena without using the heap.", "[FrameArena]")
+    {
+        FrameArena frame_arena;
+
+        // CREATE TEMPORARY CONTAINERS LIKE THOSE NEEDED DURING A FRAME.
+        // Assertions aren't made here since they may allocate memory themselves.
+        std::size_t allocation_count_before_frame = AllocationTracker::GetTotalAllocationCount();
+        std::size_t used_byte_count_during_frame = 0;
+        {
+            std::pmr::unordered_set<int> tile_types(&frame_arena);
+            tile_types.insert({ 1, 2, 3, 4 });
+
+            std::pmr::vector<std::pmr::string> lines(&frame_arena);
+            lines.emplace_back("A line of text long enough to not fit in a small string buffer.");
+            lines.emplace_back("Another line of text long enough to not fit in a small string buffer.");
+
+            used_byte_count_during_frame = frame_arena.UsedByteCount();
+        }
+        std::size_t allocation_count = AllocationTracker::GetTotalAllocationCount() - allocation_count_before_frame;
+
+        // VERIFY THAT THE CONTAINERS WERE ALLOCATED FROM THE ARENA.
+        REQUIRE(0 == allocation_count);
+        REQUIRE(used_byte_count_during_frame > 0);
+        const FrameArenaStatistics& current_frame_statistics = frame_arena.GetCurrentFrameStatistics();
+        REQUIRE(current_frame_statistics.HighWaterMarkInBytes >= used_byte_count_during_frame);
+        REQUIRE(0 == current_frame_statistics.OverflowAllocationCount);
+
+        // VERIFY THAT THE ARENA IS RESET FOR THE NEXT FRAME.
+        std::size_t previous_frame_high_water_mark_in_bytes = current_frame_statistics.HighWaterMarkInBytes;
+        frame_arena.BeginFrame();
+        REQUIRE(0 == frame_arena.UsedByteCount());
+        REQUIRE(0 == frame_arena.GetCurrentFrameStatistics().HighWaterMarkInBytes);
+        REQUIRE(previous_frame_high_water_mark_in_bytes == frame_arena.GetPreviousFrameStatistics().HighWaterMarkInBytes);
+        REQUIRE(previous_frame_high_water_mark_in_bytes == frame_arena.PeakHighWaterMarkInBytes());
+    }
+
+    TEST_CASE("Temporaries created and destroyed in a loop reuse the same frame arena memory.", "[FrameArena]")
+    {
+        FrameArena frame_arena;
+
+        // CREATE AND DESTROY A TEMPORARY MANY TIMES.
+        constexpr std::size_t ITERATION_COUNT = 1000;
+        for (std::size_t iteration = 0; iteration < ITERATION_COUNT; ++iteration)
+        {
+            std::pmr::string text("A line of text long enough to not fit in a small string buffer.", &frame_arena);
+        }
+
+        // VERIFY THAT THE MEMORY WAS REUSED.
+        REQUIRE(0 == frame_arena.UsedByteCount());
+        std::size_t high_water_mark_in_bytes = frame_arena.GetCurrentFrameStatistics().HighWaterMarkInBytes;
+        REQUIRE(high_water_mark_in_bytes > 0);
+        REQUIRE(high_water_mark_in_bytes < 128);
+    }
+
+    TEST_CASE("Allocations that don't fit in a frame arena are made from the heap.", "[FrameArena]")
+    {
+        constexpr std::size_t CAPACITY_IN_BYTES = 64;
+        FrameArena frame_arena(CAPACITY_IN_BYTES);
+
+        // ALLOCATE MORE THAN THE ARENA CAN HOLD.
+        constexpr std::size_t OVERFLOWING_BYTE_COUNT = 2 * CAPACITY_IN_BYTES;
+        std::pmr::vector<std::byte> bytes(OVERFLOWING_BYTE_COUNT, std::byte(1), &frame_arena);
+
+        // VERIFY THAT THE OVERFLOW WAS COUNTED.
+        REQUIRE(OVERFLOWING_BYTE_COUNT == bytes.size());
+        REQUIRE(CAPACITY_IN_BYTES == frame_arena.CapacityInBytes());
+        const FrameArenaStatistics& current_frame_statistics = frame_arena.GetCurrentFrameStatistics();
+        REQUIRE(1 == current_frame_statistics.OverflowAllocationCount);
+        REQUIRE(OVERFLOWING_BYTE_COUNT == current_frame_statistics.OverflowAllocatedByteCount);
+        REQUIRE(0 == frame_arena.UsedByteCount());
+    }
+}
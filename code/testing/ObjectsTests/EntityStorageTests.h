@@ -0,0 +1,64 @@
+#pragma once
+
+#include <SFML/System.hpp>
+#include "Math/Vector2.h"
+#include "Objects/EntityStorage.h"
+#include "Objects/Food.h"
+
+/// A namespace for testing the EntityStorage class.
+namespace ENTITY_STORAGE_TESTS
+{
+    using namespace OBJECTS;
+
+    TEST_CASE("Removing an entity keeps the remaining entities' components together.", "[EntityStorage]")
+    {
+        // ADD SEVERAL DIFFERENT ENTITIES.
+        EntityStorage entities;
+        entities.AddWoodLogs(MATH::Vector2f(10.0f, 10.0f));
+        entities.AddDustCloud(MATH::Vector2f(20.0f, 20.0f));
+        Food food;
+        food.Type = Food::TypeId::MANGO;
+        food.Count = 3;
+        food.Sprite.WorldPosition = MATH::Vector2f(30.0f, 30.0f);
+        entities.AddFood(food);
+        REQUIRE(3 == entities.Count());
+
+        // REMOVE THE FIRST ENTITY.
+        entities.Remove(0);
+
+        // VERIFY THAT THE LAST ENTITY WAS MOVED INTO THE REMOVED ENTITY'S PLACE WITH ALL OF ITS COMPONENTS.
+        REQUIRE(2 == entities.Count());
+        REQUIRE(0 == entities.Count(EntityKind::WOOD_LOGS));
+        REQUIRE(EntityKind::FOOD == entities.Kinds[0]);
+        REQUIRE(MATH::Vector2f(30.0f, 30.0f) == entities.WorldPositions[0]);
+        REQUIRE(Food::TypeId::MANGO == entities.FoodTypes[0]);
+        REQUIRE(3 == entities.FoodCounts[0]);
+        REQUIRE(EntityKind::DUST_CLOUD == entities.Kinds[1]);
+        REQUIRE(MATH::Vector2f(20.0f, 20.0f) == entities.WorldPositions[1]);
+        REQUIRE(2 == entities.AnimationTimesInSeconds.size());
+        REQUIRE(2 == entities.SpriteFrames.size());
+        REQUIRE(2 == entities.WorldBoundingBoxes.size());
+
+        // VERIFY THAT FOOD CAN BE RETRIEVED AFTER BEING MOVED.
+        Food moved_food = entities.GetFood(0);
+        REQUIRE(Food::TypeId::MANGO == moved_food.Type);
+        REQUIRE(3 == moved_food.Count);
+    }
+
+    TEST_CASE("Dust clouds disappear once their animation completes.", "[EntityStorage]")
+    {
+        // ADD A DUST CLOUD ALONG WITH OTHER ENTITIES.
+        EntityStorage entities;
+        entities.AddDustCloud(MATH::Vector2f(20.0f, 20.0f));
+        entities.AddWoodLogs(MATH::Vector2f(10.0f, 10.0f));
+
+        // VERIFY THAT THE DUST CLOUD REMAINS PARTWAY THROUGH ITS ANIMATION.
+        entities.Update(sf::seconds(EntityStorage::DUST_CLOUD_DURATION_IN_SECONDS / 2.0f));
+        REQUIRE(1 == entities.Count(EntityKind::DUST_CLOUD));
+
+        // VERIFY THAT ONLY THE DUST CLOUD IS REMOVED ONCE ITS ANIMATION COMPLETES.
+        entities.Update(sf::seconds(EntityStorage::DUST_CLOUD_DURATION_IN_SECONDS));
+        REQUIRE(1 == entities.Count());
+        REQUIRE(EntityKind::WOOD_LOGS == entities.Kinds[0]);
+    }
+}
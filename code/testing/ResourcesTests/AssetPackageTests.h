@@ -0,0 +1,60 @@
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <unordered_map>
+#include "Resources/AssetPackage.h"
+
+/// A namespace for testing the AssetPackage class.
+namespace TEST_ASSET_PACKAGE
+{
+    using namespace RESOURCES;
+
+    TEST_CASE("Audio properties are read back from an asset package.", "[AssetPackage]")
+    {
+        // WRITE SOME ASSET FILES.
+        const std::filesystem::path TEMP_DIRECTORY = std::filesystem::temp_directory_path();
+        const std::filesystem::path SOUND_FILEPATH = TEMP_DIRECTORY / "noah_ark_asset_package_test_sound.wav";
+        const std::filesystem::path MUSIC_FILEPATH = TEMP_DIRECTORY / "noah_ark_asset_package_test_music.wav";
+        const std::filesystem::path PACKAGE_FILEPATH = TEMP_DIRECTORY / "noah_ark_asset_package_test.package";
+        {
+            std::ofstream sound_file(SOUND_FILEPATH, std::ios::binary);
+            sound_file << "sound";
+            std::ofstream music_file(MUSIC_FILEPATH, std::ios::binary);
+            music_file << "music data";
+        }
+
+        // WRITE THE ASSETS TO A PACKAGE.
+        AssetPackageDefinition asset_package_definition({
+            AssetDefinition(AssetType::SOUND_EFFECT, AssetId::AXE_HIT_SOUND, SOUND_FILEPATH, AUDIO::SoundProperties { .Priority = 2, .MaxInstanceCount = 1 }),
+            AssetDefinition(AssetType::MUSIC, AssetId::OVERWORLD_BACKGROUND_MUSIC, MUSIC_FILEPATH, AUDIO::MusicProperties { .Pitch = 0.5f, .VolumePercent = 60.0f, .Looping = true }),
+        });
+        REQUIRE(AssetPackage::WriteFile(asset_package_definition, PACKAGE_FILEPATH));
+
+        // READ THE ASSETS BACK IN.
+        std::unordered_map<AssetId, Asset> assets = AssetPackage::ReadFile(PACKAGE_FILEPATH);
+        std::filesystem::remove(SOUND_FILEPATH);
+        std::filesystem::remove(MUSIC_FILEPATH);
+        std::filesystem::remove(PACKAGE_FILEPATH);
+        REQUIRE(2 == assets.size());
+
+        // VERIFY THE SOUND EFFECT.
+        const Asset& sound = assets[AssetId::AXE_HIT_SOUND];
+        REQUIRE(AssetType::SOUND_EFFECT == sound.Type);
+        REQUIRE("sound" == sound.BinaryData);
+        REQUIRE(2 == sound.SoundProperties.Priority);
+        REQUIRE(1 == sound.SoundProperties.MaxInstanceCount);
+        REQUIRE(AUDIO::SoundProperties::DEFAULT_MAX_AUDIBLE_DISTANCE_IN_PIXELS == sound.SoundProperties.MaxAudibleDistanceInPixels);
+
+        // VERIFY THE MUSIC.
+        // Music data isn't read in since it is streamed when played.
+        const Asset& music = assets[AssetId::OVERWORLD_BACKGROUND_MUSIC];
+        REQUIRE(AssetType::MUSIC == music.Type);
+        REQUIRE(music.BinaryData.empty());
+        REQUIRE(PACKAGE_FILEPATH == music.DataLocation.Filepath);
+        REQUIRE(10 == music.DataLocation.SizeInBytes);
+        REQUIRE(0.5f == music.MusicProperties.Pitch);
+        REQUIRE(60.0f == music.MusicProperties.VolumePercent);
+        REQUIRE(music.MusicProperties.Looping);
+    }
+}
@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <filesystem>
 #include "Bible/BibleVerses.h"
+#include "Filesystem/BinaryWriter.h"
+#include "Filesystem/File.h"
 #include "Resources/AnimalGraphics.h"
 #include "Resources/AnimalSounds.h"
 #include "States/GameSelectionScreen.h"
@@ -607,4 +609,180 @@ namespace SAVED_GAME_DATA_TESTS
         REQUIRE(original_saved_game_data.FoodCountsOnArk == reread_saved_game_data->FoodCountsOnArk);
         REQUIRE(original_saved_game_data.FloodElapsedGameplayTime == reread_saved_game_data->FloodElapsedGameplayTime);
     }
+
+    TEST_CASE("Saved game data skips unknown chunks.", "[SavedGameData]")
+    {
+        // SERIALIZE SOME SAVED GAME DATA.
+        STATES::SavedGameData original_saved_game_data;
+        original_saved_game_data.CurrentGameState = STATES::GameState::DURING_FLOOD_GAMEPLAY;
+        original_saved_game_data.Player->Inventory.WoodCount = 42;
+        original_saved_game_data.FloodElapsedGameplayTime = sf::seconds(7.0f);
+        std::string saved_game_bytes = original_saved_game_data.Serialize();
+        REQUIRE(saved_game_bytes.starts_with(STATES::SavedGameData::FILE_MAGIC));
+
+        // ADD A CHUNK THAT ISN'T KNOWN ABOUT, AS IF FROM A NEWER VERSION OF THE GAME.
+        FILESYSTEM::BinaryWriter unknown_chunk_writer;
+        constexpr std::uint32_t UNKNOWN_CHUNK_ID = 0xFFFF;
+        unknown_chunk_writer.WriteUInt32(UNKNOWN_CHUNK_ID);
+        unknown_chunk_writer.WriteUInt32(3);
+        unknown_chunk_writer.WriteBytes("new");
+        saved_game_bytes.insert(
+            STATES::SavedGameData::FILE_MAGIC.size() + sizeof(STATES::SavedGameData::FILE_FORMAT_VERSION),
+            unknown_chunk_writer.Bytes);
+
+        // VERIFY THAT THE KNOWN DATA IS STILL READ.
+        std::unique_ptr<STATES::SavedGameData> reread_saved_game_data = STATES::SavedGameData::Deserialize(saved_game_bytes);
+        REQUIRE(original_saved_game_data.CurrentGameState == reread_saved_game_data->CurrentGameState);
+        REQUIRE(original_saved_game_data.Player->Inventory.WoodCount == reread_saved_game_data->Player->Inventory.WoodCount);
+        REQUIRE(original_saved_game_data.FloodElapsedGameplayTime == reread_saved_game_data->FloodElapsedGameplayTime);
+    }
+
+    TEST_CASE("Saved game data in the legacy layout can be migrated.", "[SavedGameData]")
+    {
+        // WRITE SAVED GAME DATA IN THE LEGACY LAYOUT.
+        FILESYSTEM::BinaryWriter legacy_writer;
+        legacy_writer.WriteUInt32(static_cast<std::uint32_t>(STATES::GameState::PRE_FLOOD_GAMEPLAY));
+        legacy_writer.WriteFloat(300.0f);
+        legacy_writer.WriteFloat(100.0f);
+        legacy_writer.WriteUInt32(3);
+
+        const BIBLE::BibleVerse& collected_bible_verse = BIBLE::BIBLE_VERSES[50];
+        legacy_writer.WriteUInt64(1);
+        legacy_writer.WriteUInt32(static_cast<std::uint32_t>(collected_bible_verse.Book));
+        legacy_writer.WriteUInt32(collected_bible_verse.Chapter);
+        legacy_writer.WriteUInt32(collected_bible_verse.Verse);
+        legacy_writer.WriteUInt64(collected_bible_verse.Text.size());
+        legacy_writer.WriteBytes(collected_bible_verse.Text);
+
+        for (unsigned int food_id = 0; food_id < OBJECTS::Food::TypeId::COUNT; ++food_id)
+        {
+            legacy_writer.WriteUInt32(food_id);
+        }
+
+        legacy_writer.WriteFloat(300.0f);
+        legacy_writer.WriteFloat(64.0f);
+        legacy_writer.WriteUInt64(1);
+        legacy_writer.WriteUInt32(OBJECTS::AnimalSpecies::CAT);
+        legacy_writer.WriteUInt32(OBJECTS::AnimalGender::FEMALE);
+
+        legacy_writer.WriteUInt64(1);
+        legacy_writer.WriteUInt32(23);
+        legacy_writer.WriteFloat(16.0f);
+        legacy_writer.WriteFloat(32.0f);
+        legacy_writer.WriteBool(true);
+        legacy_writer.WriteBool(false);
+
+        for (unsigned int animal_type_index = 0; animal_type_index < OBJECTS::AnimalSpecies::COUNT * OBJECTS::AnimalGender::COUNT; ++animal_type_index)
+        {
+            legacy_writer.WriteUInt32(animal_type_index);
+            legacy_writer.WriteUInt32(1);
+            legacy_writer.WriteUInt32(0);
+            legacy_writer.WriteUInt32(2);
+            legacy_writer.WriteUInt32(0);
+            legacy_writer.WriteUInt32(1);
+        }
+
+        for (unsigned int family_member_id = 0; family_member_id < OBJECTS::FamilyMember::COUNT; ++family_member_id)
+        {
+            legacy_writer.WriteBool(family_member_id % 2);
+        }
+
+        for (unsigned int food_id = 0; food_id < OBJECTS::Food::TypeId::COUNT; ++food_id)
+        {
+            legacy_writer.WriteUInt32(2 * food_id);
+        }
+
+        legacy_writer.WriteFloat(23.0f);
+
+        // READ THE LEGACY SAVED GAME DATA.
+        std::unique_ptr<STATES::SavedGameData> migrated_saved_game_data = STATES::SavedGameData::Deserialize(legacy_writer.Bytes);
+
+        // VERIFY THAT THE CORRECT DATA WAS READ.
+        REQUIRE(STATES::GameState::PRE_FLOOD_GAMEPLAY == migrated_saved_game_data->CurrentGameState);
+        REQUIRE(300.0f == migrated_saved_game_data->Player->GetWorldPosition().X);
+        REQUIRE(100.0f == migrated_saved_game_data->Player->GetWorldPosition().Y);
+        REQUIRE(3 == migrated_saved_game_data->Player->Inventory.WoodCount);
+        REQUIRE(std::set<BIBLE::BibleVerse>({ collected_bible_verse }) == migrated_saved_game_data->Player->Inventory.BibleVerses);
+        REQUIRE(BIBLE::BIBLE_VERSES.size() - 1 == migrated_saved_game_data->BibleVersesLeftToFind.size());
+        REQUIRE(OBJECTS::Food::TypeId::WALNUT == migrated_saved_game_data->Player->Inventory.FoodCounts[OBJECTS::Food::TypeId::WALNUT]);
+        REQUIRE(64.0f == migrated_saved_game_data->Player->Inventory.FollowingAnimals.CurrentCenterWorldPosition.Y);
+        REQUIRE(1 == migrated_saved_game_data->Player->Inventory.FollowingAnimals.Animals.size());
+        REQUIRE(OBJECTS::AnimalSpecies::CAT == migrated_saved_game_data->Player->Inventory.FollowingAnimals.Animals.front()->Type.Species);
+        REQUIRE(1 == migrated_saved_game_data->BuiltArkPieces.size());
+        REQUIRE(23 == migrated_saved_game_data->BuiltArkPieces.front().Id);
+        REQUIRE(32.0f == migrated_saved_game_data->BuiltArkPieces.front().Sprite.WorldPosition.Y);
+        REQUIRE(migrated_saved_game_data->BuiltArkPieces.front().Built);
+        REQUIRE_FALSE(migrated_saved_game_data->BuiltArkPieces.front().IsExternalDoorway);
+
+        const INVENTORY::AnimalCollectionStatistics& last_animal_statistics = migrated_saved_game_data->CollectedAnimalsBySpeciesThenGender.back().back();
+        REQUIRE(OBJECTS::AnimalSpecies::COUNT * OBJECTS::AnimalGender::COUNT - 1 == last_animal_statistics.FollowingPlayerCount);
+        REQUIRE(2 == last_animal_statistics.AnimalPenTileMapColumnIndex);
+        REQUIRE(1 == last_animal_statistics.AnimalPenTileMapPenIndex);
+
+        REQUIRE_FALSE(migrated_saved_game_data->FamilyMembersGathered[0]);
+        REQUIRE(migrated_saved_game_data->FamilyMembersGathered[1]);
+        REQUIRE(2 * OBJECTS::Food::TypeId::WALNUT == migrated_saved_game_data->FoodCountsOnArk[OBJECTS::Food::TypeId::WALNUT]);
+        REQUIRE(sf::seconds(23.0f) == migrated_saved_game_data->FloodElapsedGameplayTime);
+
+        // VERIFY THAT THE MIGRATED DATA IS WRITTEN IN THE CURRENT FORMAT.
+        std::string migrated_saved_game_bytes = migrated_saved_game_data->Serialize();
+        REQUIRE(migrated_saved_game_bytes.starts_with(STATES::SavedGameData::FILE_MAGIC));
+        std::unique_ptr<STATES::SavedGameData> reread_saved_game_data = STATES::SavedGameData::Deserialize(migrated_saved_game_bytes);
+        REQUIRE(migrated_saved_game_data->CollectedAnimalsBySpeciesThenGender == reread_saved_game_data->CollectedAnimalsBySpeciesThenGender);
+        REQUIRE(migrated_saved_game_data->Player->Inventory.BibleVerses == reread_saved_game_data->Player->Inventory.BibleVerses);
+    }
+
+    TEST_CASE("Saved game summaries can be loaded without loading the full saved game.", "[SavedGameData]")
+    {
+        // WRITE SOME SAVED GAME DATA.
+        STATES::SavedGameData original_saved_game_data;
+        original_saved_game_data.CurrentGameState = STATES::GameState::DURING_FLOOD_GAMEPLAY;
+        original_saved_game_data.Player->Inventory.BibleVerses =
+        {
+            BIBLE::BIBLE_VERSES[0],
+            BIBLE::BIBLE_VERSES[1],
+        };
+        original_saved_game_data.Player->Inventory.FoodCounts[OBJECTS::Food::TypeId::ALMOND] = 4;
+        original_saved_game_data.FoodCountsOnArk[OBJECTS::Food::TypeId::WALNUT] = 6;
+        original_saved_game_data.CollectedAnimalsBySpeciesThenGender[OBJECTS::AnimalSpecies::CAT][OBJECTS::AnimalGender::MALE].InArkCount = 1;
+        original_saved_game_data.CollectedAnimalsBySpeciesThenGender[OBJECTS::AnimalSpecies::CAT][OBJECTS::AnimalGender::FEMALE].FollowingPlayerCount = 1;
+        original_saved_game_data.FloodElapsedGameplayTime = sf::seconds(0.0f);
+
+        const std::filesystem::path SAVED_GAME_DATA_FILEPATH = STATES::GameSelectionScreen::SAVED_GAMES_FOLDER_PATH / "TestSavedGameSummary.dat";
+        original_saved_game_data.Write(SAVED_GAME_DATA_FILEPATH);
+
+        // LOAD THE SUMMARY.
+        std::optional<STATES::SavedGameSummary> summary = STATES::SavedGameData::LoadSummary(SAVED_GAME_DATA_FILEPATH);
+
+        // VERIFY THAT THE SUMMARY MATCHES THE SAVED GAME.
+        REQUIRE(summary);
+        REQUIRE(SAVED_GAME_DATA_FILEPATH == summary->Filepath);
+        REQUIRE_FALSE(summary->NewGame);
+        REQUIRE(STATES::GameState::DURING_FLOOD_GAMEPLAY == summary->CurrentGameState);
+        REQUIRE(2 == summary->CollectedAnimalCount);
+        REQUIRE(2 == summary->CollectedBibleVerseCount);
+        REQUIRE(10 == summary->CollectedFoodCount);
+        REQUIRE(summary->SavedTimeInSecondsSinceEpoch > 0);
+
+        // VERIFY THAT A SAVED GAME WITHOUT A SUMMARY UP-FRONT IS SUMMARIZED FROM ITS FULL DATA.
+        // An unknown chunk is inserted before the summary so that the summary isn't the first chunk.
+        std::string saved_game_bytes = original_saved_game_data.Serialize();
+        FILESYSTEM::BinaryWriter unknown_chunk_writer;
+        constexpr std::uint32_t UNKNOWN_CHUNK_ID = 0xFFFF;
+        unknown_chunk_writer.WriteUInt32(UNKNOWN_CHUNK_ID);
+        unknown_chunk_writer.WriteUInt32(0);
+        saved_game_bytes.insert(
+            STATES::SavedGameData::FILE_MAGIC.size() + sizeof(STATES::SavedGameData::FILE_FORMAT_VERSION),
+            unknown_chunk_writer.Bytes);
+        REQUIRE(FILESYSTEM::File::WriteBinaryAtomically(SAVED_GAME_DATA_FILEPATH, saved_game_bytes));
+
+        std::optional<STATES::SavedGameSummary> full_data_summary = STATES::SavedGameData::LoadSummary(SAVED_GAME_DATA_FILEPATH);
+        REQUIRE(full_data_summary);
+        REQUIRE(SAVED_GAME_DATA_FILEPATH == full_data_summary->Filepath);
+        REQUIRE(summary->CurrentGameState == full_data_summary->CurrentGameState);
+        REQUIRE(summary->FloodDay == full_data_summary->FloodDay);
+        REQUIRE(summary->CollectedAnimalCount == full_data_summary->CollectedAnimalCount);
+        REQUIRE(summary->CollectedBibleVerseCount == full_data_summary->CollectedBibleVerseCount);
+        REQUIRE(summary->CollectedFoodCount == full_data_summary->CollectedFoodCount);
+    }
 }
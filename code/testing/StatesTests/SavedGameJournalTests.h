@@ -0,0 +1,125 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include "Bible/BibleVerses.h"
+#include "Filesystem/BinaryWriter.h"
+#include "Objects/ArkPiece.h"
+#include "States/SavedGameData.h"
+#include "States/SavedGameJournal.h"
+
+/// A namespace for testing the SavedGameJournal class.
+namespace TEST_SAVED_GAME_JOURNAL
+{
+    using namespace STATES;
+
+    TEST_CASE("Only changes to saved games are journaled.", "[SavedGameJournal]")
+    {
+        // FULLY SERIALIZE SOME SAVED GAME DATA.
+        SavedGameData saved_game_data;
+        saved_game_data.CurrentGameState = GameState::PRE_FLOOD_GAMEPLAY;
+        saved_game_data.Player->Inventory.BibleVerses = { BIBLE::BIBLE_VERSES[0] };
+        saved_game_data.Player->Inventory.FoodCounts[OBJECTS::Food::TypeId::ALMOND] = 2;
+        std::string saved_game_bytes = saved_game_data.Serialize();
+
+        SavedGameJournal journal;
+        journal.Reset(saved_game_data, saved_game_bytes);
+
+        // CHANGE THE SAVED GAME DATA.
+        saved_game_data.Player->SetWorldPosition(MATH::Vector2f(50.0f, 60.0f));
+        saved_game_data.Player->Inventory.WoodCount = 7;
+        saved_game_data.Player->Inventory.BibleVerses.insert(BIBLE::BIBLE_VERSES[20]);
+        saved_game_data.Player->Inventory.FoodCounts[OBJECTS::Food::TypeId::ALMOND] = 1;
+        saved_game_data.FoodCountsOnArk[OBJECTS::Food::TypeId::WALNUT] = 3;
+        OBJECTS::ArkPiece built_ark_piece(5);
+        built_ark_piece.Sprite.WorldPosition = MATH::Vector2f(16.0f, 32.0f);
+        built_ark_piece.Built = true;
+        saved_game_data.BuiltArkPieces.emplace_back(built_ark_piece);
+        saved_game_data.CollectedAnimalsBySpeciesThenGender[OBJECTS::AnimalSpecies::CAT][OBJECTS::AnimalGender::MALE].InArkCount = 1;
+        saved_game_data.FamilyMembersGathered[0] = true;
+
+        // JOURNAL THE CHANGES.
+        FILESYSTEM::BinaryWriter journal_writer;
+        REQUIRE(journal.RecordChanges(saved_game_data, journal_writer));
+        REQUIRE(journal_writer.Bytes.size() == journal.SizeInBytes);
+
+        // VERIFY THAT THE JOURNAL IS SMALL.
+        // In particular, the text of the collected Bible verse shouldn't be journaled.
+        REQUIRE(std::string::npos == journal_writer.Bytes.find(BIBLE::BIBLE_VERSES[20].Text));
+        REQUIRE(journal_writer.Bytes.size() < 256);
+
+        // VERIFY THAT APPLYING THE JOURNAL RESTORES THE CHANGES.
+        std::unique_ptr<SavedGameData> restored_saved_game_data = SavedGameData::Deserialize(saved_game_bytes);
+        SavedGameJournal::Apply(saved_game_bytes, journal_writer.Bytes, *restored_saved_game_data);
+        REQUIRE(50.0f == restored_saved_game_data->Player->GetWorldPosition().X);
+        REQUIRE(60.0f == restored_saved_game_data->Player->GetWorldPosition().Y);
+        REQUIRE(7 == restored_saved_game_data->Player->Inventory.WoodCount);
+        REQUIRE(saved_game_data.Player->Inventory.BibleVerses == restored_saved_game_data->Player->Inventory.BibleVerses);
+        REQUIRE(BIBLE::BIBLE_VERSES.size() - 2 == restored_saved_game_data->BibleVersesLeftToFind.size());
+        REQUIRE(saved_game_data.Player->Inventory.FoodCounts == restored_saved_game_data->Player->Inventory.FoodCounts);
+        REQUIRE(saved_game_data.FoodCountsOnArk == restored_saved_game_data->FoodCountsOnArk);
+        REQUIRE(1 == restored_saved_game_data->BuiltArkPieces.size());
+        REQUIRE(5 == restored_saved_game_data->BuiltArkPieces.front().Id);
+        REQUIRE(32.0f == restored_saved_game_data->BuiltArkPieces.front().Sprite.WorldPosition.Y);
+        REQUIRE(saved_game_data.CollectedAnimalsBySpeciesThenGender == restored_saved_game_data->CollectedAnimalsBySpeciesThenGender);
+        REQUIRE(restored_saved_game_data->FamilyMembersGathered[0]);
+
+        // VERIFY THAT UNCHANGED DATA ISN'T JOURNALED AGAIN.
+        FILESYSTEM::BinaryWriter unchanged_journal_writer;
+        REQUIRE(journal.RecordChanges(saved_game_data, unchanged_journal_writer));
+        REQUIRE(unchanged_journal_writer.Bytes.size() < journal_writer.Bytes.size() / 2);
+
+        // VERIFY THAT ENTRIES APPENDED TO THE JOURNAL ARE APPLIED IN ORDER.
+        saved_game_data.Player->Inventory.FoodCounts[OBJECTS::Food::TypeId::ALMOND] = 9;
+        FILESYSTEM::BinaryWriter appended_journal_writer;
+        REQUIRE(journal.RecordChanges(saved_game_data, appended_journal_writer));
+        std::string full_journal_bytes = journal_writer.Bytes + unchanged_journal_writer.Bytes + appended_journal_writer.Bytes;
+        restored_saved_game_data = SavedGameData::Deserialize(saved_game_bytes);
+        SavedGameJournal::Apply(saved_game_bytes, full_journal_bytes, *restored_saved_game_data);
+        REQUIRE(9 == restored_saved_game_data->Player->Inventory.FoodCounts[OBJECTS::Food::TypeId::ALMOND]);
+        REQUIRE(1 == restored_saved_game_data->BuiltArkPieces.size());
+    }
+
+    TEST_CASE("Journals only apply to the saved game they were started for.", "[SavedGameJournal]")
+    {
+        // JOURNAL A CHANGE.
+        SavedGameData saved_game_data;
+        std::string saved_game_bytes = saved_game_data.Serialize();
+        SavedGameJournal journal;
+        journal.Reset(saved_game_data, saved_game_bytes);
+
+        saved_game_data.Player->Inventory.WoodCount = 4;
+        FILESYSTEM::BinaryWriter journal_writer;
+        REQUIRE(journal.RecordChanges(saved_game_data, journal_writer));
+
+        // VERIFY THAT THE JOURNAL ISN'T APPLIED TO A NEWER SAVED GAME FILE.
+        saved_game_data.Player->Inventory.WoodCount = 6;
+        std::string newer_saved_game_bytes = saved_game_data.Serialize();
+        std::unique_ptr<SavedGameData> restored_saved_game_data = SavedGameData::Deserialize(newer_saved_game_bytes);
+        SavedGameJournal::Apply(newer_saved_game_bytes, journal_writer.Bytes, *restored_saved_game_data);
+        REQUIRE(6 == restored_saved_game_data->Player->Inventory.WoodCount);
+
+        // VERIFY THAT AN INCOMPLETE RECORD AT THE END OF THE JOURNAL IS IGNORED.
+        saved_game_data.Player->Inventory.WoodCount = 8;
+        FILESYSTEM::BinaryWriter incomplete_journal_writer;
+        REQUIRE(journal.RecordChanges(saved_game_data, incomplete_journal_writer));
+        std::string journal_bytes = journal_writer.Bytes + incomplete_journal_writer.Bytes.substr(0, incomplete_journal_writer.Bytes.size() - 1);
+        restored_saved_game_data = SavedGameData::Deserialize(saved_game_bytes);
+        SavedGameJournal::Apply(saved_game_bytes, journal_bytes, *restored_saved_game_data);
+        REQUIRE(4 == restored_saved_game_data->Player->Inventory.WoodCount);
+    }
+
+    TEST_CASE("Removals from saved games can't be journaled.", "[SavedGameJournal]")
+    {
+        // START JOURNALING A SAVED GAME WITH A BUILT ARK PIECE.
+        SavedGameData saved_game_data;
+        saved_game_data.BuiltArkPieces.emplace_back(OBJECTS::ArkPiece(1));
+        SavedGameJournal journal;
+        journal.Reset(saved_game_data, saved_game_data.Serialize());
+
+        // VERIFY THAT REMOVING THE ARK PIECE CAN'T BE JOURNALED.
+        saved_game_data.BuiltArkPieces.clear();
+        FILESYSTEM::BinaryWriter journal_writer;
+        REQUIRE_FALSE(journal.RecordChanges(saved_game_data, journal_writer));
+    }
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <vector>
+#include "States/SavedGameData.h"
+#include "States/SavedGameJournal.h"
+#include "States/SavedGameWriter.h"
+
+/// A namespace for testing the SavedGameWriter class.
+namespace TEST_SAVED_GAME_WRITER
+{
+    using namespace STATES;
+
+    TEST_CASE("Saved games are written in the background with completion callbacks.", "[SavedGameWriter]")
+    {
+        // CREATE SAVED GAME DATA TO WRITE.
+        const std::filesystem::path FILEPATH = std::filesystem::temp_directory_path() / "noah_ark_saved_game_writer_test.dat";
+        std::filesystem::remove(FILEPATH);
+        SavedGameData saved_game_data;
+        saved_game_data.Filepath = FILEPATH;
+        saved_game_data.CurrentGameState = GameState::PRE_FLOOD_GAMEPLAY;
+        saved_game_data.Player->Inventory.WoodCount = 12;
+
+        // SAVE THE GAME.
+        SavedGameWriter saved_game_writer;
+        std::vector<bool> completed_save_results;
+        saved_game_writer.Save(saved_game_data, [&completed_save_results](const std::filesystem::path&, const bool saved)
+        {
+            completed_save_results.push_back(saved);
+        });
+
+        // CHANGE THE DATA WHILE THE SAVE MAY STILL BE IN PROGRESS.
+        // The save should have the data from when it was requested.
+        saved_game_data.Player->Inventory.WoodCount = 13;
+
+        // VERIFY THAT THE CALLBACK IS ONLY CALLED ONCE DISPATCHED.
+        saved_game_writer.WaitForPendingSaves();
+        REQUIRE(0 == saved_game_writer.PendingSaveCount());
+        REQUIRE(completed_save_results.empty());
+        saved_game_writer.DispatchCompletedSaves();
+        REQUIRE(std::vector<bool>({ true }) == completed_save_results);
+
+        // VERIFY THAT THE SAVE WAS WRITTEN WITHOUT LEAVING ANY TEMPORARY FILE.
+        std::filesystem::path temporary_filepath = FILEPATH;
+        temporary_filepath += ".tmp";
+        REQUIRE_FALSE(std::filesystem::exists(temporary_filepath));
+        std::unique_ptr<SavedGameData> reread_saved_game_data = SavedGameData::Load(FILEPATH);
+        REQUIRE(reread_saved_game_data);
+        REQUIRE(12 == reread_saved_game_data->Player->Inventory.WoodCount);
+
+        std::filesystem::remove(FILEPATH);
+    }
+
+    TEST_CASE("Saved games are automatically saved periodically.", "[SavedGameWriter]")
+    {
+        // CREATE SAVED GAME DATA TO WRITE.
+        const std::filesystem::path FILEPATH = std::filesystem::temp_directory_path() / "noah_ark_saved_game_writer_autosave_test.dat";
+        std::filesystem::remove(FILEPATH);
+        SavedGameData saved_game_data;
+        saved_game_data.Filepath = FILEPATH;
+
+        // UPDATE FOR LESS THAN THE AUTOSAVE INTERVAL.
+        SavedGameWriter saved_game_writer;
+        unsigned int autosave_count = 0;
+        saved_game_writer.AutosaveInterval = sf::seconds(10.0f);
+        saved_game_writer.AutosaveCompletionCallback = [&autosave_count](const std::filesystem::path&, const bool saved)
+        {
+            REQUIRE(saved);
+            ++autosave_count;
+        };
+        saved_game_writer.UpdateAutosave(sf::seconds(6.0f), saved_game_data);
+        saved_game_writer.WaitForPendingSaves();
+        saved_game_writer.DispatchCompletedSaves();
+        REQUIRE(0 == autosave_count);
+        REQUIRE_FALSE(std::filesystem::exists(FILEPATH));
+
+        // UPDATE PAST THE AUTOSAVE INTERVAL.
+        saved_game_writer.UpdateAutosave(sf::seconds(6.0f), saved_game_data);
+        saved_game_writer.WaitForPendingSaves();
+        saved_game_writer.DispatchCompletedSaves();
+        REQUIRE(1 == autosave_count);
+        REQUIRE(std::filesystem::exists(FILEPATH));
+
+        // VERIFY THAT THE AUTOSAVE TIMER RESTARTED.
+        saved_game_writer.UpdateAutosave(sf::seconds(6.0f), saved_game_data);
+        saved_game_writer.WaitForPendingSaves();
+        saved_game_writer.DispatchCompletedSaves();
+        REQUIRE(1 == autosave_count);
+
+        std::filesystem::remove(FILEPATH);
+    }
+
+    TEST_CASE("Saved games only journal changes after being fully written until compacted.", "[SavedGameWriter]")
+    {
+        // FULLY WRITE A SAVED GAME.
+        const std::filesystem::path FILEPATH = std::filesystem::temp_directory_path() / "noah_ark_saved_game_writer_journal_test.dat";
+        const std::filesystem::path JOURNAL_FILEPATH = SavedGameJournal::GetFilepath(FILEPATH);
+        std::filesystem::remove(FILEPATH);
+        std::filesystem::remove(JOURNAL_FILEPATH);
+        SavedGameData saved_game_data;
+        saved_game_data.Filepath = FILEPATH;
+        saved_game_data.Player->Inventory.WoodCount = 1;
+
+        SavedGameWriter saved_game_writer;
+        saved_game_writer.Save(saved_game_data);
+        saved_game_writer.WaitForPendingSaves();
+        REQUIRE(std::filesystem::exists(FILEPATH));
+        REQUIRE_FALSE(std::filesystem::exists(JOURNAL_FILEPATH));
+        auto saved_game_file_size_in_bytes = std::filesystem::file_size(FILEPATH);
+
+        // SAVE SOME CHANGES.
+        saved_game_data.Player->Inventory.WoodCount = 2;
+        saved_game_writer.Save(saved_game_data);
+        saved_game_data.Player->Inventory.WoodCount = 3;
+        saved_game_writer.Save(saved_game_data);
+        saved_game_writer.WaitForPendingSaves();
+
+        // VERIFY THAT ONLY THE JOURNAL WAS WRITTEN.
+        REQUIRE(saved_game_file_size_in_bytes == std::filesystem::file_size(FILEPATH));
+        REQUIRE(std::filesystem::exists(JOURNAL_FILEPATH));
+        std::unique_ptr<SavedGameData> reread_saved_game_data = SavedGameData::Load(FILEPATH);
+        REQUIRE(reread_saved_game_data);
+        REQUIRE(3 == reread_saved_game_data->Player->Inventory.WoodCount);
+
+        // VERIFY THAT A LARGE ENOUGH JOURNAL IS COMPACTED INTO THE SAVED GAME FILE.
+        saved_game_writer.MaxJournalSizeInBytes = 0;
+        saved_game_data.Player->Inventory.WoodCount = 4;
+        saved_game_writer.Save(saved_game_data);
+        saved_game_writer.WaitForPendingSaves();
+        REQUIRE_FALSE(std::filesystem::exists(JOURNAL_FILEPATH));
+        reread_saved_game_data = SavedGameData::Load(FILEPATH);
+        REQUIRE(reread_saved_game_data);
+        REQUIRE(4 == reread_saved_game_data->Player->Inventory.WoodCount);
+
+        std::filesystem::remove(FILEPATH);
+    }
+}
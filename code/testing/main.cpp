@@ -1,12 +1,38 @@
 #define CATCH_CONFIG_MAIN
 #include <catch.hpp>
+#include "Memory/GlobalAllocationHooks.h"
+#include "AudioTests/AudioMixerTests.h"
+#include "AudioTests/AudioOutputTests.h"
+#include "AudioTests/AudioPrerendererTests.h"
+#include "AudioTests/SoundEventSchedulerTests.h"
+#include "AudioTests/SoundVoicePoolTests.h"
 #include "ContainersTests/Array2DTests.h"
+#include "ContainersTests/ObjectPoolTests.h"
+#include "ContainersTests/SingleProducerSingleConsumerQueueTests.h"
+#include "FilesystemTests/BinaryReaderTests.h"
+#include "FilesystemTests/FileRegionStreamTests.h"
 #include "GraphicsTests/AnimatedSpriteTests.h"
 #include "GraphicsTests/AnimationSequenceTests.h"
+#include "GraphicsTests/DirtyRegionTrackerTests.h"
+#include "GraphicsTests/GuiTests/GlyphRunTests.h"
+#include "GraphicsTests/GuiTests/GuiIconCacheTests.h"
 #include "GraphicsTests/GuiTests/TextBoxTests.h"
+#include "GraphicsTests/GuiTests/TextLayoutTests.h"
 #include "GraphicsTests/GuiTests/TextPageTests.h"
+#include "GraphicsTests/GuiTests/TextTests.h"
+#include "MapsTests/MultiTileMapGridTests.h"
+#include "MapsTests/TileMapFileTests.h"
+#include "MapsTests/TileMapTests.h"
+#include "MapsTests/WorldSnapshotTests.h"
+#include "MapsTests/WorldTests.h"
 #include "MathTests/FloatRectangleTests.h"
+#include "MemoryTests/AllocationTrackerTests.h"
+#include "MemoryTests/FrameArenaTests.h"
+#include "ObjectsTests/EntityStorageTests.h"
+#include "ResourcesTests/AssetPackageTests.h"
 #include "StatesTests/SavedGameDataTests.h"
+#include "StatesTests/SavedGameJournalTests.h"
+#include "StatesTests/SavedGameWriterTests.h"
 
 TEST_CASE( "Final test case to use for debugging." )
 {